@@ -201,6 +201,11 @@ if(USE_LIBURSA)
   find_package(ursa)
 endif()
 
+##########################
+#          zlib          #
+##########################
+find_package(ZLIB REQUIRED)
+
 ###################################
 #              fmt                #
 ###################################
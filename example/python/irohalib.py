@@ -51,6 +51,14 @@ class IrohaCrypto(object):
         # because they do not have a payload in their schema
         elif hasattr(proto_with_payload, 'meta'):
             obj = getattr(proto_with_payload, 'meta')
+            # queries streaming committed blocks are signed as a whole
+            # without the signature, so that their start height and filter
+            # are signed
+            if proto_with_payload.HasField('start_height') \
+                    or proto_with_payload.HasField('filter'):
+                obj = type(proto_with_payload)()
+                obj.CopyFrom(proto_with_payload)
+                obj.ClearField('signature')
 
         bytes = obj.SerializeToString()
         hash = hashlib.sha3_256(bytes).digest()
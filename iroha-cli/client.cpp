@@ -7,10 +7,6 @@
 
 #include "backend/protobuf/queries/proto_query.hpp"
 #include "backend/protobuf/transaction.hpp"
-#include "model/converters/json_query_factory.hpp"
-#include "model/converters/json_transaction_factory.hpp"
-#include "model/converters/pb_query_factory.hpp"
-#include "model/converters/pb_transaction_factory.hpp"
 #include "network/impl/grpc_channel_builder.hpp"
 
 namespace iroha_cli {
@@ -27,7 +23,7 @@ namespace iroha_cli {
 
   CliClient::Response<CliClient::TxStatus> CliClient::sendTx(
       const shared_model::interface::Transaction &tx) {
-    const auto proto_tx =
+    const auto &proto_tx =
         static_cast<const shared_model::proto::Transaction &>(tx);
     CliClient::Response<CliClient::TxStatus> response;
     // Send to iroha:
@@ -55,9 +51,9 @@ namespace iroha_cli {
   CliClient::Response<iroha::protocol::QueryResponse> CliClient::sendQuery(
       const shared_model::interface::Query &query) {
     CliClient::Response<iroha::protocol::QueryResponse> response;
-    // Convert to proto and send to Iroha
-    iroha::model::converters::PbQueryFactory pb_factory(pb_qry_factory_log_);
-    auto proto_query = static_cast<const shared_model::proto::Query &>(query);
+    // Send the protobuf query to Iroha as it is
+    const auto &proto_query =
+        static_cast<const shared_model::proto::Query &>(query);
     iroha::protocol::QueryResponse query_response;
     response.status =
         query_client_.Find(proto_query.getTransport(), query_response);
@@ -0,0 +1,190 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "load_generator.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "backend/protobuf/transaction.hpp"
+#include "builders/protobuf/transaction.hpp"
+#include "datetime/time.hpp"
+#include "logger/logger.hpp"
+
+namespace iroha_cli {
+
+  namespace {
+    /// detail key set by the generated transactions
+    const std::string kDetailKey = "load";
+
+    /// sent batch waiting for the final statuses of its transactions
+    struct SentBatch {
+      const iroha::protocol::TxStatusesRequest *hashes;
+      std::chrono::steady_clock::time_point sent;
+    };
+  }  // namespace
+
+  LoadGenerator::LoadGenerator(torii::CommandSyncClient client,
+                               std::string account_id,
+                               std::shared_ptr<SigningPool> signer,
+                               Options options,
+                               logger::LoggerPtr log)
+      : client_(std::move(client)),
+        account_id_(std::move(account_id)),
+        signer_(std::move(signer)),
+        options_(options),
+        log_(std::move(log)) {
+    options_.batch_size = std::max<size_t>(options_.batch_size, 1);
+    options_.status_threads = std::max<size_t>(options_.status_threads, 1);
+  }
+
+  std::vector<LoadGenerator::SignedBatch> LoadGenerator::signBatches() {
+    const auto batches =
+        (options_.transactions + options_.batch_size - 1) / options_.batch_size;
+    std::vector<SignedBatch> signed_batches(batches);
+    for (auto &batch : signed_batches) {
+      batch.transactions.mutable_transactions()->Reserve(options_.batch_size);
+      batch.hashes.mutable_tx_hashes()->Reserve(options_.batch_size);
+    }
+    // created times are unique, so that the hashes of the transactions differ
+    const auto created_time = iroha::time::now() - options_.transactions;
+
+    std::mutex mutex;
+    auto is_signed = signer_->sign(
+        account_id_,
+        options_.transactions,
+        [&](size_t i) {
+          return shared_model::proto::TransactionBuilder()
+              .creatorAccountId(account_id_)
+              .createdTime(created_time + i)
+              .quorum(1)
+              .setAccountDetail(account_id_, kDetailKey, std::to_string(i))
+              .build();
+        },
+        [&](size_t i, shared_model::proto::Transaction tx) {
+          auto hash = tx.hash().hex();
+          auto &batch = signed_batches[i / options_.batch_size];
+          // transactions of a batch are signed concurrently
+          std::lock_guard<std::mutex> lock(mutex);
+          *batch.hashes.add_tx_hashes() = std::move(hash);
+          *batch.transactions.add_transactions() = tx.getTransport();
+        });
+    if (not is_signed) {
+      return {};
+    }
+    return signed_batches;
+  }
+
+  LoadGenerator::Report LoadGenerator::run() {
+    log_->info("Signing {} transactions", options_.transactions);
+    const auto signed_batches = signBatches();
+    const auto signing = signer_->stats();
+    log_->info("Signed {} transactions in {:.1f}s ({:.1f} tx/s)",
+               signing.transactions,
+               signing.time.count(),
+               signing.transactions / signing.time.count());
+
+    Report report{};
+    std::atomic<size_t> committed{0}, rejected{0};
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<SentBatch> sent;
+    bool sending_finished = false;
+
+    latency_.reset();
+    std::vector<std::thread> status_threads;
+    for (size_t t = 0; t < options_.status_threads; ++t) {
+      status_threads.emplace_back([&] {
+        while (true) {
+          SentBatch batch;
+          {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait(lock, [&] { return sending_finished or not sent.empty(); });
+            if (sent.empty()) {
+              return;
+            }
+            batch = std::move(sent.front());
+            sent.pop_front();
+          }
+          auto status = client_.StatusesStream(
+              *batch.hashes,
+              [&](const iroha::protocol::ToriiResponse &response) {
+                switch (response.tx_status()) {
+                  case iroha::protocol::TxStatus::COMMITTED:
+                    ++committed;
+                    latency_.record(
+                        std::chrono::duration_cast<std::chrono::microseconds>(
+                            std::chrono::steady_clock::now() - batch.sent)
+                            .count());
+                    break;
+                  case iroha::protocol::TxStatus::REJECTED:
+                  case iroha::protocol::TxStatus::STATELESS_VALIDATION_FAILED:
+                    ++rejected;
+                    break;
+                  default:
+                    break;
+                }
+              });
+          if (not status.ok()) {
+            log_->warn("Status stream failed: {}", status.error_message());
+          }
+        }
+      });
+    }
+
+    log_->info("Sending {} batches of up to {} transactions",
+               signed_batches.size(),
+               options_.batch_size);
+    const auto start = std::chrono::steady_clock::now();
+    size_t offered = 0;
+    for (const auto &batch : signed_batches) {
+      if (options_.rate > 0) {
+        std::this_thread::sleep_until(
+            start
+            + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                  std::chrono::duration<double>(offered / options_.rate)));
+      }
+      const size_t size = batch.transactions.transactions_size();
+      offered += size;
+
+      const auto sent_time = std::chrono::steady_clock::now();
+      auto status = client_.ListTorii(batch.transactions);
+      if (not status.ok()) {
+        log_->warn("ListTorii failed: {}", status.error_message());
+        report.failed_to_send += size;
+        continue;
+      }
+      report.sent += size;
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        sent.push_back(SentBatch{&batch.hashes, sent_time});
+      }
+      cv.notify_one();
+    }
+    report.sending_time = std::chrono::steady_clock::now() - start;
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      sending_finished = true;
+    }
+    cv.notify_all();
+    for (auto &thread : status_threads) {
+      thread.join();
+    }
+    report.total_time = std::chrono::steady_clock::now() - start;
+    report.committed = committed;
+    report.rejected = rejected;
+    return report;
+  }
+
+  const iroha::metrics::Histogram &LoadGenerator::latency() const {
+    return latency_;
+  }
+
+}  // namespace iroha_cli
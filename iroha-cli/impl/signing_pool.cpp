@@ -0,0 +1,59 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "signing_pool.hpp"
+
+#include <utility>
+
+#include <boost/filesystem.hpp>
+
+#include "crypto/keys_manager_impl.hpp"
+#include "logger/logger.hpp"
+
+namespace iroha_cli {
+
+  SigningPool::SigningPool(size_t threads, logger::LoggerPtr log)
+      : pool_(threads), log_(std::move(log)) {}
+
+  bool SigningPool::loadKeypair(const std::string &account_id,
+                                const std::string &key_path,
+                                const boost::optional<std::string> &pass_phrase,
+                                logger::LoggerPtr keys_manager_log) {
+    std::lock_guard<std::mutex> lock(signers_mutex_);
+    if (signers_.count(account_id) != 0) {
+      return true;
+    }
+    iroha::KeysManagerImpl manager(
+        (boost::filesystem::path(key_path) / account_id).string(),
+        std::move(keys_manager_log));
+    auto keypair =
+        pass_phrase ? manager.loadKeys(*pass_phrase) : manager.loadKeys();
+    if (not keypair) {
+      log_->error("Cannot load keypair of {} from {}", account_id, key_path);
+      return false;
+    }
+    signers_.emplace(
+        account_id,
+        std::make_unique<shared_model::crypto::KeypairSigner>(*keypair));
+    return true;
+  }
+
+  SigningPool::Stats SigningPool::stats() const {
+    return Stats{signed_transactions_,
+                 std::chrono::microseconds(signing_microseconds_)};
+  }
+
+  const shared_model::crypto::KeypairSigner *SigningPool::findSigner(
+      const std::string &account_id) {
+    std::lock_guard<std::mutex> lock(signers_mutex_);
+    auto it = signers_.find(account_id);
+    if (it == signers_.end()) {
+      log_->error("Keypair of {} is not loaded", account_id);
+      return nullptr;
+    }
+    return it->second.get();
+  }
+
+}  // namespace iroha_cli
@@ -0,0 +1,125 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "traffic_replay.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "logger/logger.hpp"
+
+namespace iroha_cli {
+
+  TrafficReplay::TrafficReplay(torii::CommandSyncClient command_client,
+                               torii_utils::QuerySyncClient query_client,
+                               Options options,
+                               logger::LoggerPtr log)
+      : command_client_(std::move(command_client)),
+        query_client_(std::move(query_client)),
+        options_(options),
+        log_(std::move(log)) {
+    options_.threads = std::max<size_t>(options_.threads, 1);
+  }
+
+  bool TrafficReplay::run(const std::string &path) {
+    auto read = iroha::torii::TrafficCapture::read(path);
+    if (auto error = iroha::expected::resultToOptionalError(read)) {
+      log_->error("{}", *error);
+      return false;
+    }
+    auto records = std::move(*iroha::expected::resultToOptionalValue(read));
+    // records are written when the calls complete
+    std::stable_sort(records.begin(),
+                     records.end(),
+                     [](const auto &lhs, const auto &rhs) {
+                       return lhs.received < rhs.received;
+                     });
+    log_->info(
+        "Replaying {} requests at speed {}", records.size(), options_.speed);
+
+    std::atomic<size_t> next{0};
+    const auto start = std::chrono::steady_clock::now();
+    const auto first =
+        records.empty() ? std::chrono::microseconds(0) : records[0].received;
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < options_.threads; ++t) {
+      threads.emplace_back([&] {
+        for (auto i = next++; i < records.size(); i = next++) {
+          const auto &record = records[i];
+          if (options_.speed > 0) {
+            std::this_thread::sleep_until(
+                start
+                + std::chrono::duration_cast<
+                      std::chrono::steady_clock::duration>(
+                      (record.received - first) / options_.speed));
+          }
+          auto &stats = mutableStats(record.call);
+          ++stats.calls;
+          const auto sent = std::chrono::steady_clock::now();
+          if (not send(record)) {
+            ++stats.failed;
+            continue;
+          }
+          stats.replayed.record(
+              std::chrono::duration_cast<std::chrono::microseconds>(
+                  std::chrono::steady_clock::now() - sent)
+                  .count());
+          stats.captured.record(record.duration.count());
+        }
+      });
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+    return true;
+  }
+
+  const TrafficReplay::CallStats &TrafficReplay::stats(Call call) const {
+    return stats_[static_cast<size_t>(call) - 1];
+  }
+
+  bool TrafficReplay::send(
+      const iroha::torii::TrafficCapture::Record &record) {
+    switch (record.call) {
+      case Call::kTransactions: {
+        iroha::protocol::TxList request;
+        if (not request.ParseFromString(record.request)) {
+          return false;
+        }
+        auto status = command_client_.ListTorii(request);
+        if (not status.ok()) {
+          log_->warn("ListTorii failed: {}", status.error_message());
+        }
+        return status.ok();
+      }
+      case Call::kQuery: {
+        iroha::protocol::Query request;
+        iroha::protocol::QueryResponse response;
+        if (not request.ParseFromString(record.request)) {
+          return false;
+        }
+        auto status = query_client_.Find(request, response);
+        if (not status.ok()) {
+          log_->warn("Find failed: {}", status.error_message());
+        }
+        return status.ok();
+      }
+      case Call::kQueryStream: {
+        iroha::protocol::Query request;
+        if (not request.ParseFromString(record.request)) {
+          return false;
+        }
+        return not query_client_.FindStream(request).empty();
+      }
+    }
+    return false;
+  }
+
+  TrafficReplay::CallStats &TrafficReplay::mutableStats(Call call) {
+    return stats_[static_cast<size_t>(call) - 1];
+  }
+
+}  // namespace iroha_cli
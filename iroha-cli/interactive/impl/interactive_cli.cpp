@@ -36,16 +36,15 @@ namespace iroha_cli {
         const std::string &default_peer_ip,
         int default_port,
         uint64_t qry_counter,
-        const std::shared_ptr<iroha::model::ModelCryptoProvider> &provider,
+        const shared_model::crypto::Keypair &keypair,
         logger::LoggerManagerTreePtr response_handler_log_manager,
         logger::LoggerPtr pb_qry_factory_log,
-        logger::LoggerPtr json_qry_factory_log,
         logger::LoggerManagerTreePtr log_manager)
         : creator_(account_name),
           tx_cli_(creator_,
                   default_peer_ip,
                   default_port,
-                  provider,
+                  keypair,
                   response_handler_log_manager,
                   pb_qry_factory_log,
                   log_manager->getChild("Transaction")->getLogger()),
@@ -53,10 +52,9 @@ namespace iroha_cli {
                      default_peer_ip,
                      default_port,
                      qry_counter,
-                     provider,
+                     keypair,
                      std::move(response_handler_log_manager),
                      pb_qry_factory_log,
-                     std::move(json_qry_factory_log),
                      log_manager->getChild("Query")->getLogger()),
           statusCli_(
               default_peer_ip, default_port, std::move(pb_qry_factory_log)) {
@@ -10,18 +10,17 @@
 
 #include "client.hpp"
 #include "common/byteutils.hpp"
+#include "converters/protobuf/json_proto_converter.hpp"
 #include "crypto/keys_manager_impl.hpp"
+#include "cryptography/crypto_provider/crypto_signer.hpp"
 #include "cryptography/ed25519_sha3_impl/internal/ed25519_impl.hpp"
 #include "datetime/time.hpp"
 #include "grpc_response_handler.hpp"
 #include "interactive/interactive_query_cli.hpp"
 #include "logger/logger.hpp"
-#include "model/converters/json_query_factory.hpp"
 #include "model/converters/pb_query_factory.hpp"
-#include "model/model_crypto_provider.hpp"  // for ModelCryptoProvider
 #include "model/queries/get_asset_info.hpp"
 #include "model/queries/get_roles.hpp"
-#include "model/sha3_hash.hpp"
 
 using namespace iroha::model;
 
@@ -95,21 +94,19 @@ namespace iroha_cli {
         const std::string &default_peer_ip,
         int default_port,
         uint64_t query_counter,
-        const std::shared_ptr<iroha::model::ModelCryptoProvider> &provider,
+        shared_model::crypto::Keypair keypair,
         logger::LoggerManagerTreePtr response_handler_log_manager,
         logger::LoggerPtr pb_qry_factory_log,
-        logger::LoggerPtr json_qry_factory_log,
         logger::LoggerPtr log)
         : current_context_(MAIN),
           creator_(account_name),
           default_peer_ip_(default_peer_ip),
           default_port_(default_port),
           counter_(query_counter),
-          provider_(provider),
+          keypair_(std::move(keypair)),
           response_handler_log_manager_(
               std::move(response_handler_log_manager)),
           pb_qry_factory_log_(std::move(pb_qry_factory_log)),
-          json_qry_factory_log_(std::move(json_qry_factory_log)),
           log_(std::move(log)) {
       create_queries_menu();
       create_result_menu();
@@ -268,27 +265,19 @@ namespace iroha_cli {
         return true;
       }
 
-      provider_->sign(*query_);
-
       CliClient client(
           address.value().first, address.value().second, pb_qry_factory_log_);
-      auto query = shared_model::proto::Query(
-          *iroha::model::converters::PbQueryFactory(pb_qry_factory_log_)
-               .serialize(query_));
       GrpcResponseHandler{response_handler_log_manager_}.handle(
-          client.sendQuery(query));
+          client.sendQuery(signedQuery()));
       printEnd();
       // Stop parsing
       return false;
     }
 
     bool InteractiveQueryCli::parseSaveFile(QueryParams params) {
-      provider_->sign(*query_);
-
       auto path = params[0];
-      iroha::model::converters::JsonQueryFactory json_factory(
-          json_qry_factory_log_);
-      auto json_string = json_factory.serialize(query_);
+      auto json_string =
+          shared_model::converters::protobuf::modelToJson(signedQuery());
       std::ofstream output_file(path);
       if (not output_file) {
         std::cout << "Cannot create file" << std::endl;
@@ -302,5 +291,15 @@ namespace iroha_cli {
       return false;
     }
 
+    shared_model::proto::Query InteractiveQueryCli::signedQuery() const {
+      auto query = shared_model::proto::Query(
+          *iroha::model::converters::PbQueryFactory(pb_qry_factory_log_)
+               .serialize(query_));
+      query.addSignature(
+          shared_model::crypto::CryptoSigner<>::sign(query.payload(), keypair_),
+          keypair_.publicKey());
+      return query;
+    }
+
   }  // namespace interactive
 }  // namespace iroha_cli
@@ -10,6 +10,8 @@
 
 #include "backend/protobuf/transaction.hpp"
 #include "client.hpp"
+#include "converters/protobuf/json_proto_converter.hpp"
+#include "cryptography/crypto_provider/crypto_signer.hpp"
 #include "grpc_response_handler.hpp"
 #include "logger/logger.hpp"
 #include "model/commands/append_role.hpp"
@@ -18,13 +20,8 @@
 #include "model/commands/grant_permission.hpp"
 #include "model/commands/revoke_permission.hpp"
 #include "model/commands/set_account_detail.hpp"
-#include "model/converters/json_common.hpp"
-#include "model/converters/json_transaction_factory.hpp"
-#include "model/converters/pb_common.hpp"
 #include "model/converters/pb_transaction_factory.hpp"
-#include "model/model_crypto_provider.hpp"  // for ModelCryptoProvider
 #include "model/permissions.hpp"
-#include "model/sha3_hash.hpp"
 #include "parser/parser.hpp"  // for parser::ParseValue
 
 using namespace iroha::model;
@@ -170,7 +167,7 @@ namespace iroha_cli {
         const std::string &creator_account,
         const std::string &default_peer_ip,
         int default_port,
-        const std::shared_ptr<iroha::model::ModelCryptoProvider> &provider,
+        shared_model::crypto::Keypair keypair,
         logger::LoggerManagerTreePtr response_handler_log_manager,
         logger::LoggerPtr pb_qry_factory_log,
         logger::LoggerPtr log)
@@ -178,7 +175,7 @@ namespace iroha_cli {
           creator_(creator_account),
           default_peer_ip_(default_peer_ip),
           default_port_(default_port),
-          provider_(provider),
+          keypair_(std::move(keypair)),
           response_handler_log_manager_(
               std::move(response_handler_log_manager)),
           pb_qry_factory_log_(std::move(pb_qry_factory_log)),
@@ -445,21 +442,13 @@ namespace iroha_cli {
         return true;
       }
 
-      // Forming a transaction
-
-      auto tx = tx_generator_.generateTransaction(creator_, commands_);
-      // clear commands so that we can start creating new tx
-      commands_.clear();
-
-      provider_->sign(tx);
+      auto tx = formSignedTransaction();
 
       GrpcResponseHandler response_handler(response_handler_log_manager_);
-      auto shared_tx = shared_model::proto::Transaction(
-          iroha::model::converters::PbTransactionFactory().serialize(tx));
       response_handler.handle(CliClient(address.value().first,
                                         address.value().second,
                                         pb_qry_factory_log_)
-                                  .sendTx(shared_tx));
+                                  .sendTx(tx));
 
       printTxHash(tx);
       printEnd();
@@ -477,18 +466,8 @@ namespace iroha_cli {
         return true;
       }
 
-      // Forming a transaction
-      auto tx = tx_generator_.generateTransaction(creator_, commands_);
-
-      // clear commands so that we can start creating new tx
-      commands_.clear();
-
-      provider_->sign(tx);
-
-      iroha::model::converters::JsonTransactionFactory json_factory;
-      auto json_doc = json_factory.serialize(tx);
-      auto json_string = iroha::model::converters::jsonToString(json_doc);
-      output_file << json_string;
+      output_file << shared_model::converters::protobuf::modelToJson(
+          formSignedTransaction());
       std::cout << "Successfully saved!" << std::endl;
       printEnd();
       // Stop parsing
@@ -516,12 +495,26 @@ namespace iroha_cli {
       return true;
     }
 
-    void InteractiveTransactionCli::printTxHash(iroha::model::Transaction &tx) {
+    shared_model::proto::Transaction
+    InteractiveTransactionCli::formSignedTransaction() {
+      auto tx = shared_model::proto::Transaction(
+          iroha::model::converters::PbTransactionFactory().serialize(
+              tx_generator_.generateTransaction(creator_, commands_)));
+      // clear commands so that we can start creating new tx
+      commands_.clear();
+
+      tx.addSignature(
+          shared_model::crypto::CryptoSigner<>::sign(tx.payload(), keypair_),
+          keypair_.publicKey());
+      return tx;
+    }
+
+    void InteractiveTransactionCli::printTxHash(
+        const shared_model::proto::Transaction &tx) {
       std::cout
           << "Congratulation, your transaction was accepted for processing."
           << std::endl;
-      std::cout << "Its hash is " << iroha::hash(tx).to_hexstring()
-                << std::endl;
+      std::cout << "Its hash is " << tx.hash().hex() << std::endl;
     }
 
   }  // namespace interactive
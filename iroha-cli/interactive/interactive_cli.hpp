@@ -22,10 +22,9 @@ namespace iroha_cli {
        * @param default_peer_ip default peer ip to send transactions/query
        * @param default_port default port of peer's Iroha Torii
        * @param qry_counter synchronized nonce for sending queries
-       * @param provider crypto provider to make signatures
+       * @param keypair to sign transactions and queries
        * @param response_handler_log_manager for ResponseHandler messages
        * @param pb_qry_factory_log for PbQueryFactory mesages
-       * @param json_qry_factory_log for JsonQueryFactory mesages
        * @param log_manager log manager for interactive CLIs
        */
       InteractiveCli(
@@ -33,10 +32,9 @@ namespace iroha_cli {
           const std::string &default_peer_ip,
           int default_port,
           uint64_t qry_counter,
-          const std::shared_ptr<iroha::model::ModelCryptoProvider> &provider,
+          const shared_model::crypto::Keypair &keypair,
           logger::LoggerManagerTreePtr response_handler_log_manager,
           logger::LoggerPtr pb_qry_factory_log,
-          logger::LoggerPtr json_qry_factory_log,
           logger::LoggerManagerTreePtr log_manager);
       /**
        * Run interactive cli. Print menu and parse commands
@@ -9,6 +9,7 @@
 #include <memory>
 #include <unordered_map>
 
+#include "cryptography/keypair.hpp"
 #include "interactive/interactive_common_cli.hpp"
 #include "logger/logger_fwd.hpp"
 #include "logger/logger_manager_fwd.hpp"
@@ -16,11 +17,16 @@
 
 namespace iroha {
   namespace model {
-    class ModelCryptoProvider;
     struct Query;
   }  // namespace model
 }  // namespace iroha
 
+namespace shared_model {
+  namespace proto {
+    class Query;
+  }  // namespace proto
+}  // namespace shared_model
+
 namespace iroha_cli {
   namespace interactive {
     class InteractiveQueryCli {
@@ -31,10 +37,9 @@ namespace iroha_cli {
        * @param default_peer_ip of Iroha peer
        * @param default_port of Iroha peer
        * @param query_counter counter associated with creator's account
-       * @param provider for signing queries
+       * @param keypair for signing queries
        * @param response_handler_log_manager for ResponseHandler mesages
        * @param pb_qry_factory_log for PbQueryFactory mesages
-       * @param json_qry_factory_log for JsonQueryFactory mesages
        * @param log for internal messages
        */
       InteractiveQueryCli(
@@ -42,10 +47,9 @@ namespace iroha_cli {
           const std::string &default_peer_ip,
           int default_port,
           uint64_t query_counter,
-          const std::shared_ptr<iroha::model::ModelCryptoProvider> &provider,
+          shared_model::crypto::Keypair keypair,
           logger::LoggerManagerTreePtr response_handler_log_manager,
           logger::LoggerPtr pb_qry_factory_log,
-          logger::LoggerPtr json_qry_factory_log,
           logger::LoggerPtr log);
       /**
        * Run interactive query command line
@@ -136,6 +140,12 @@ namespace iroha_cli {
       bool parseSendToIroha(QueryParams line);
       bool parseSaveFile(QueryParams line);
 
+      /**
+       * Convert the formed query to protobuf once and sign it
+       * @return signed query
+       */
+      shared_model::proto::Query signedQuery() const;
+
       // Current context for query forming
       MenuContext current_context_;
 
@@ -158,8 +168,8 @@ namespace iroha_cli {
       // Query generator for new queries
       iroha::model::generators::QueryGenerator generator_;
 
-      // Crypto provider
-      std::shared_ptr<iroha::model::ModelCryptoProvider> provider_;
+      // Keypair signing the queries
+      shared_model::crypto::Keypair keypair_;
 
       /// Logger manager for GrpcResponseHandler
       logger::LoggerManagerTreePtr response_handler_log_manager_;
@@ -167,9 +177,6 @@ namespace iroha_cli {
       /// Logger for PbQueryFactory
       logger::LoggerPtr pb_qry_factory_log_;
 
-      /// Logger for JsonQueryFactory
-      logger::LoggerPtr json_qry_factory_log_;
-
       /// Internal logger
       logger::LoggerPtr log_;
     };
@@ -11,15 +11,21 @@
 #include "interactive/interactive_common_cli.hpp"
 #include "logger/logger_fwd.hpp"
 #include "logger/logger_manager_fwd.hpp"
+#include "cryptography/keypair.hpp"
 #include "model/generators/transaction_generator.hpp"
 
 namespace iroha {
   namespace model {
     struct Command;
-    class ModelCryptoProvider;
   }  // namespace model
 }  // namespace iroha
 
+namespace shared_model {
+  namespace proto {
+    class Transaction;
+  }  // namespace proto
+}  // namespace shared_model
+
 namespace iroha_cli {
   namespace interactive {
     class InteractiveTransactionCli {
@@ -29,7 +35,7 @@ namespace iroha_cli {
        * @param creator_account user Iroha account
        * @param default_peer_ip of Iroha peer
        * @param default_port of Iroha peer
-       * @param provider for signing transactions
+       * @param keypair for signing transactions
        * @param response_handler_log_manager for ResponseHandler messages
        * @param pb_qry_factory_log for PbQueryFactory mesages
        * @param log for internal messages
@@ -38,7 +44,7 @@ namespace iroha_cli {
           const std::string &creator_account,
           const std::string &default_peer_ip,
           int default_port,
-          const std::shared_ptr<iroha::model::ModelCryptoProvider> &provider,
+          shared_model::crypto::Keypair keypair,
           logger::LoggerManagerTreePtr response_handler_log_manager,
           logger::LoggerPtr pb_qry_factory_log,
           logger::LoggerPtr log);
@@ -161,10 +167,17 @@ namespace iroha_cli {
       bool parseGoBack(std::vector<std::string> params);
       bool parseAddCommand(std::vector<std::string> params);
 
+      /**
+       * Form a transaction of the added commands, convert it to protobuf once
+       * and sign it, clears the added commands
+       * @return signed transaction
+       */
+      shared_model::proto::Transaction formSignedTransaction();
+
       /**
        * Prints hash of a transaction for user in a readable form
        */
-      void printTxHash(iroha::model::Transaction &tx);
+      void printTxHash(const shared_model::proto::Transaction &tx);
 
       // ---- Tx data ----
 
@@ -179,8 +192,8 @@ namespace iroha_cli {
       // Commands to be formed
       std::vector<std::shared_ptr<iroha::model::Command>> commands_;
 
-      // Crypto provider
-      std::shared_ptr<iroha::model::ModelCryptoProvider> provider_;
+      // Keypair signing the transactions
+      shared_model::crypto::Keypair keypair_;
 
       // Transaction generator
       iroha::model::generators::TransactionGenerator tx_generator_;
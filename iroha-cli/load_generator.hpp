@@ -0,0 +1,88 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CLI_LOAD_GENERATOR_HPP
+#define IROHA_CLI_LOAD_GENERATOR_HPP
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "logger/logger_fwd.hpp"
+#include "metrics/metrics.hpp"
+#include "signing_pool.hpp"
+#include "torii/command_client.hpp"
+
+namespace iroha_cli {
+
+  /**
+   * Sends an open-loop load of transactions to a peer: batches are sent on
+   * schedule regardless of how fast the previous ones are committed. Every
+   * transaction sets a detail of the creator account, so that no other
+   * permissions or balances are needed. Transactions are signed in advance
+   * by the signing pool, so that signing does not limit the offered rate.
+   */
+  class LoadGenerator {
+   public:
+    struct Options {
+      /// number of transactions to send
+      size_t transactions;
+      /// number of transactions sent by one ListTorii call
+      size_t batch_size;
+      /// offered transactions per second, 0 sends as fast as possible
+      double rate;
+      /// number of concurrent status streams waiting for sent batches
+      size_t status_threads;
+    };
+
+    struct Report {
+      size_t sent;
+      size_t committed;
+      size_t rejected;
+      /// number of transactions ListTorii failed to deliver
+      size_t failed_to_send;
+      std::chrono::duration<double> sending_time;
+      std::chrono::duration<double> total_time;
+    };
+
+    LoadGenerator(torii::CommandSyncClient client,
+                  std::string account_id,
+                  std::shared_ptr<SigningPool> signer,
+                  Options options,
+                  logger::LoggerPtr log);
+
+    /**
+     * Sign the transactions, send them and wait for their final statuses
+     * @return counts of the transactions by outcome
+     */
+    Report run();
+
+    /**
+     * @return time in microseconds from sending a batch to the commit of
+     * its transactions
+     */
+    const iroha::metrics::Histogram &latency() const;
+
+   private:
+    /// transactions sent by one ListTorii call and their hashes
+    struct SignedBatch {
+      iroha::protocol::TxList transactions;
+      iroha::protocol::TxStatusesRequest hashes;
+    };
+
+    std::vector<SignedBatch> signBatches();
+
+    torii::CommandSyncClient client_;
+    std::string account_id_;
+    std::shared_ptr<SigningPool> signer_;
+    Options options_;
+    iroha::metrics::Histogram latency_;
+    logger::LoggerPtr log_;
+  };
+
+}  // namespace iroha_cli
+
+#endif  // IROHA_CLI_LOAD_GENERATOR_HPP
@@ -18,15 +18,19 @@
 #include "crypto/keys_manager_impl.hpp"
 #include "grpc_response_handler.hpp"
 #include "interactive/interactive_cli.hpp"
+#include "load_generator.hpp"
 #include "logger/logger.hpp"
 #include "logger/logger_manager.hpp"
 #include "model/converters/json_block_factory.hpp"
+#include "model/converters/json_common.hpp"
 #include "model/converters/json_query_factory.hpp"
+#include "model/converters/json_transaction_factory.hpp"
 #include "model/converters/pb_block_factory.hpp"
 #include "model/converters/pb_query_factory.hpp"
 #include "model/converters/pb_transaction_factory.hpp"
 #include "model/generators/block_generator.hpp"
-#include "model/model_crypto_provider_impl.hpp"
+#include "network/impl/grpc_channel_builder.hpp"
+#include "traffic_replay.hpp"
 
 // Account information
 DEFINE_bool(new_account,
@@ -58,6 +62,39 @@ DEFINE_string(peers_address,
               "",
               "File with peers address for new Iroha network");
 
+// Load generation:
+DEFINE_bool(load,
+            false,
+            "Send signed transactions of the account to Iroha peer at the "
+            "given rate and report their commit latency");
+DEFINE_uint64(load_transactions, 100000, "Number of transactions to send");
+DEFINE_uint64(load_batch_size,
+              100,
+              "Number of transactions sent by one ListTorii call");
+DEFINE_double(load_rate,
+              0,
+              "Offered transactions per second, 0 sends as fast as possible");
+DEFINE_uint64(load_signing_threads,
+              0,
+              "Number of threads signing the transactions before sending, 0 "
+              "means one per hardware thread");
+DEFINE_uint64(load_status_threads,
+              16,
+              "Number of concurrent status streams of the sent transactions");
+
+// Replay of captured traffic:
+DEFINE_string(replay,
+              "",
+              "Send the requests captured by torii to Iroha peer at their "
+              "original times and compare their latencies");
+DEFINE_double(replay_speed,
+              1,
+              "Rate of the replay relative to the capture, 0 sends as fast as "
+              "possible");
+DEFINE_uint64(replay_threads,
+              16,
+              "Number of threads sending the captured requests");
+
 // Run iroha-cli in interactive mode
 DEFINE_bool(interactive, true, "Run iroha-cli in interactive mode");
 
@@ -67,10 +104,50 @@ using namespace iroha::model::converters;
 using namespace iroha_cli::interactive;
 namespace fs = boost::filesystem;
 
-iroha::keypair_t *makeOldModel(const shared_model::crypto::Keypair &keypair) {
-  return new iroha::keypair_t{
-      iroha::pubkey_t::from_string(toBinaryString(keypair.publicKey())),
-      iroha::privkey_t::from_string(toBinaryString(keypair.privateKey()))};
+/**
+ * Parse a transaction saved by the interactive mode, which is protobuf json,
+ * or a transaction in the legacy json format
+ */
+boost::optional<shared_model::proto::Transaction> parseJsonTransaction(
+    const std::string &json) {
+  using shared_model::converters::protobuf::jsonToModel;
+  if (auto tx = jsonToModel<shared_model::proto::Transaction>(json)) {
+    return tx;
+  }
+  auto doc = iroha::model::converters::stringToJson(json);
+  if (not doc) {
+    return boost::none;
+  }
+  auto tx = JsonTransactionFactory().deserialize(doc.value());
+  if (not tx) {
+    return boost::none;
+  }
+  return shared_model::proto::Transaction(
+      PbTransactionFactory().serialize(*tx));
+}
+
+/**
+ * Parse a query saved by the interactive mode, which is protobuf json, or a
+ * query in the legacy json format
+ */
+boost::optional<shared_model::proto::Query> parseJsonQuery(
+    const std::string &json,
+    logger::LoggerPtr json_qry_factory_log,
+    logger::LoggerPtr pb_qry_factory_log) {
+  using shared_model::converters::protobuf::jsonToModel;
+  if (auto query = jsonToModel<shared_model::proto::Query>(json)) {
+    return query;
+  }
+  auto query =
+      JsonQueryFactory(std::move(json_qry_factory_log)).deserialize(json);
+  if (not query) {
+    return boost::none;
+  }
+  auto proto = PbQueryFactory(std::move(pb_qry_factory_log)).serialize(*query);
+  if (not proto) {
+    return boost::none;
+  }
+  return shared_model::proto::Query(std::move(*proto));
 }
 
 int main(int argc, char *argv[]) {
@@ -170,21 +247,12 @@ int main(int argc, char *argv[]) {
       std::ifstream file(FLAGS_json_transaction);
       std::string str((std::istreambuf_iterator<char>(file)),
                       std::istreambuf_iterator<char>());
-      iroha::model::converters::JsonTransactionFactory serializer;
-      auto doc = iroha::model::converters::stringToJson(str);
-      if (not doc) {
-        logger->error("Json has wrong format.");
-        return EXIT_FAILURE;
-      }
-      auto tx_opt = serializer.deserialize(doc.value());
-      if (not tx_opt) {
+      auto tx = parseJsonTransaction(str);
+      if (not tx) {
         logger->error("Json transaction has wrong format.");
         return EXIT_FAILURE;
       } else {
-        auto tx = shared_model::proto::Transaction(
-            iroha::model::converters::PbTransactionFactory().serialize(
-                *tx_opt));
-        response_handler.handle(client.sendTx(tx));
+        response_handler.handle(client.sendTx(*tx));
       }
     }
     if (not FLAGS_json_query.empty()) {
@@ -192,21 +260,107 @@ int main(int argc, char *argv[]) {
       std::ifstream file(FLAGS_json_query);
       std::string str((std::istreambuf_iterator<char>(file)),
                       std::istreambuf_iterator<char>());
-      iroha::model::converters::JsonQueryFactory serializer(
-          json_qry_factory_log);
-      auto query_opt = serializer.deserialize(std::move(str));
-      if (not query_opt) {
+      auto query =
+          parseJsonQuery(str, json_qry_factory_log, pb_qry_factory_log);
+      if (not query) {
         logger->error("Json has wrong format.");
         return EXIT_FAILURE;
       } else {
-        auto query = shared_model::proto::Query(
-            *iroha::model::converters::PbQueryFactory(pb_qry_factory_log)
-                 .serialize(*query_opt));
-        auto response = client.sendQuery(query);
+        auto response = client.sendQuery(*query);
         response_handler.handle(response);
       }
     }
   }
+  // Send load of transactions to Iroha Peer
+  else if (FLAGS_load) {
+    if (FLAGS_account_name.empty()) {
+      logger->error("Specify your account name");
+      return EXIT_FAILURE;
+    }
+    auto signer = std::make_shared<iroha_cli::SigningPool>(
+        FLAGS_load_signing_threads,
+        log_manager->getChild("SigningPool")->getLogger());
+    if (not signer->loadKeypair(
+            FLAGS_account_name,
+            FLAGS_key_path,
+            FLAGS_pass_phrase.empty()
+                ? boost::none
+                : boost::make_optional(FLAGS_pass_phrase),
+            keys_manager_log)) {
+      return EXIT_FAILURE;
+    }
+    iroha_cli::LoadGenerator generator(
+        torii::CommandSyncClient(
+            iroha::network::createClient<iroha::protocol::CommandService_v1>(
+                FLAGS_peer_ip + ":" + std::to_string(FLAGS_torii_port)),
+            log_manager->getChild("CommandClient")->getLogger()),
+        FLAGS_account_name,
+        signer,
+        {FLAGS_load_transactions,
+         FLAGS_load_batch_size,
+         FLAGS_load_rate,
+         FLAGS_load_status_threads},
+        log_manager->getChild("LoadGenerator")->getLogger());
+    auto report = generator.run();
+    const auto &latency = generator.latency();
+    logger->info(
+        "Sent {} transactions in {:.1f}s ({:.1f} tx/s), {} failed to send",
+        report.sent,
+        report.sending_time.count(),
+        report.sent / report.sending_time.count(),
+        report.failed_to_send);
+    logger->info("Committed {} transactions in {:.1f}s ({:.1f} tx/s), {} "
+                 "rejected, {} without final status",
+                 report.committed,
+                 report.total_time.count(),
+                 report.committed / report.total_time.count(),
+                 report.rejected,
+                 report.sent - report.committed - report.rejected);
+    logger->info("Commit latency ms: p50 {:.1f}, p90 {:.1f}, p99 {:.1f}, "
+                 "max {:.1f}",
+                 latency.quantile(0.5) / 1000.,
+                 latency.quantile(0.9) / 1000.,
+                 latency.quantile(0.99) / 1000.,
+                 latency.quantile(1) / 1000.);
+  }
+  // Replay requests captured by torii of another peer
+  else if (not FLAGS_replay.empty()) {
+    using Call = iroha_cli::TrafficReplay::Call;
+    iroha_cli::TrafficReplay replay(
+        torii::CommandSyncClient(
+            iroha::network::createClient<iroha::protocol::CommandService_v1>(
+                FLAGS_peer_ip + ":" + std::to_string(FLAGS_torii_port)),
+            log_manager->getChild("CommandClient")->getLogger()),
+        torii_utils::QuerySyncClient(FLAGS_peer_ip, FLAGS_torii_port),
+        {FLAGS_replay_speed, FLAGS_replay_threads},
+        log_manager->getChild("TrafficReplay")->getLogger());
+    if (not replay.run(FLAGS_replay)) {
+      return EXIT_FAILURE;
+    }
+    for (auto call : {std::make_pair(Call::kTransactions, "ListTorii"),
+                      std::make_pair(Call::kQuery, "Find"),
+                      std::make_pair(Call::kQueryStream, "FindStream")}) {
+      const auto &stats = replay.stats(call.first);
+      if (stats.calls == 0) {
+        continue;
+      }
+      auto ms = [](const auto &histogram, double quantile) {
+        return histogram.quantile(quantile) / 1000.;
+      };
+      logger->info("{}: {} calls, {} failed, latency ms captured p50 {:.1f} "
+                   "p99 {:.1f}, replayed p50 {:.1f} p99 {:.1f}, delta p50 "
+                   "{:+.1f} p99 {:+.1f}",
+                   call.second,
+                   stats.calls.load(),
+                   stats.failed.load(),
+                   ms(stats.captured, 0.5),
+                   ms(stats.captured, 0.99),
+                   ms(stats.replayed, 0.5),
+                   ms(stats.replayed, 0.99),
+                   ms(stats.replayed, 0.5) - ms(stats.captured, 0.5),
+                   ms(stats.replayed, 0.99) - ms(stats.captured, 0.99));
+    }
+  }
   // Run iroha-cli in interactive mode
   else if (FLAGS_interactive) {
     if (FLAGS_account_name.empty()) {
@@ -240,11 +394,9 @@ int main(int argc, char *argv[]) {
         FLAGS_peer_ip,
         FLAGS_torii_port,
         0,
-        std::make_shared<iroha::model::ModelCryptoProviderImpl>(
-            *std::unique_ptr<iroha::keypair_t>(makeOldModel(*keypair))),
+        *keypair,
         response_handler_log_manager,
         pb_qry_factory_log,
-        json_qry_factory_log,
         log_manager->getChild("InteractiveCli"));
     interactiveCli.run();
   } else {
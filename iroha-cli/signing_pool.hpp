@@ -0,0 +1,106 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CLI_SIGNING_POOL_HPP
+#define IROHA_CLI_SIGNING_POOL_HPP
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <boost/optional.hpp>
+#include "common/thread_pool.hpp"
+#include "cryptography/ed25519_sha3_impl/keypair_signer.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace iroha_cli {
+
+  /**
+   * Long-lived signing service for tools submitting many transactions.
+   * Keypairs are loaded from disk and decrypted once, their keys are kept by
+   * signers in memory locked against swapping and wiped on destruction.
+   * Transactions are signed on a pool of worker threads.
+   */
+  class SigningPool {
+   public:
+    /// signing throughput since the pool was created
+    struct Stats {
+      size_t transactions;
+      std::chrono::duration<double> time;
+    };
+
+    /**
+     * @param threads - number of worker threads, 0 means one per hardware
+     * thread
+     * @param log - logger
+     */
+    SigningPool(size_t threads, logger::LoggerPtr log);
+
+    /**
+     * Load and decrypt the keypair of the account, unless it is loaded
+     * @param account_id - account, whose key files are named after it
+     * @param key_path - directory of the key files
+     * @param pass_phrase - pass phrase of the private key, if it is encrypted
+     * @param keys_manager_log - logger of the keys manager
+     * @return whether the keypair is loaded
+     */
+    bool loadKeypair(const std::string &account_id,
+                     const std::string &key_path,
+                     const boost::optional<std::string> &pass_phrase,
+                     logger::LoggerPtr keys_manager_log);
+
+    /**
+     * Build count transactions and sign them by the account on the workers
+     * @param account_id - account with a loaded keypair
+     * @param count - number of transactions
+     * @param make - make(i) returns the i-th unsigned transaction
+     * @param consume - consume(i, transaction) takes the i-th signed
+     * transaction, it is called on the workers
+     * @return whether the keypair of the account is loaded
+     */
+    template <typename Make, typename Consume>
+    bool sign(const std::string &account_id,
+              size_t count,
+              Make &&make,
+              Consume &&consume) {
+      auto signer = findSigner(account_id);
+      if (not signer) {
+        return false;
+      }
+      const auto start = std::chrono::steady_clock::now();
+      pool_.parallelFor(count, [&](size_t i) {
+        consume(i, make(i).signAndAddSignature(*signer).finish());
+      });
+      signed_transactions_ += count;
+      signing_microseconds_ +=
+          std::chrono::duration_cast<std::chrono::microseconds>(
+              std::chrono::steady_clock::now() - start)
+              .count();
+      return true;
+    }
+
+    /// @return number of signed transactions and time spent signing them
+    Stats stats() const;
+
+   private:
+    const shared_model::crypto::KeypairSigner *findSigner(
+        const std::string &account_id);
+
+    iroha::ThreadPool pool_;
+    std::mutex signers_mutex_;
+    std::unordered_map<std::string,
+                       std::unique_ptr<shared_model::crypto::KeypairSigner>>
+        signers_;
+    std::atomic<size_t> signed_transactions_{0};
+    std::atomic<uint64_t> signing_microseconds_{0};
+    logger::LoggerPtr log_;
+  };
+
+}  // namespace iroha_cli
+
+#endif  // IROHA_CLI_SIGNING_POOL_HPP
@@ -0,0 +1,79 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CLI_TRAFFIC_REPLAY_HPP
+#define IROHA_CLI_TRAFFIC_REPLAY_HPP
+
+#include <array>
+#include <atomic>
+#include <string>
+
+#include "logger/logger_fwd.hpp"
+#include "metrics/metrics.hpp"
+#include "torii/command_client.hpp"
+#include "torii/query_client.hpp"
+#include "torii/traffic_capture.hpp"
+
+namespace iroha_cli {
+
+  /**
+   * Sends the requests captured by torii of a peer to another one at their
+   * original times, optionally scaled. Requests are sent by several threads
+   * regardless of how fast the previous ones are handled, so that the load
+   * stays as it was captured. Latencies of the calls are compared with the
+   * times the captured peer took to handle them, the difference includes
+   * the network round trip
+   */
+  class TrafficReplay {
+   public:
+    using Call = iroha::torii::TrafficCapture::Call;
+
+    struct Options {
+      /// rate of the replay relative to the capture, 0 sends as fast as
+      /// possible
+      double speed;
+      /// number of threads sending the requests
+      size_t threads;
+    };
+
+    /// statistics of the calls of a kind, times are in microseconds
+    struct CallStats {
+      std::atomic<size_t> calls{0};
+      std::atomic<size_t> failed{0};
+      iroha::metrics::Histogram captured;
+      iroha::metrics::Histogram replayed;
+    };
+
+    TrafficReplay(torii::CommandSyncClient command_client,
+                  torii_utils::QuerySyncClient query_client,
+                  Options options,
+                  logger::LoggerPtr log);
+
+    /**
+     * Send the requests of the log and wait for their responses
+     * @param path - path of the log captured by torii
+     * @return false if the log cannot be read
+     */
+    bool run(const std::string &path);
+
+    /// @return statistics of the calls of the kind
+    const CallStats &stats(Call call) const;
+
+   private:
+    /// @return whether the call succeeded
+    bool send(const iroha::torii::TrafficCapture::Record &record);
+
+    CallStats &mutableStats(Call call);
+
+    torii::CommandSyncClient command_client_;
+    torii_utils::QuerySyncClient query_client_;
+    Options options_;
+    std::array<CallStats, 3> stats_;
+    logger::LoggerPtr log_;
+  };
+
+}  // namespace iroha_cli
+
+#endif  // IROHA_CLI_TRAFFIC_REPLAY_HPP
@@ -6,6 +6,8 @@
 #ifndef IROHA_BLOCK_QUERY_HPP
 #define IROHA_BLOCK_QUERY_HPP
 
+#include <vector>
+
 #include <boost/optional.hpp>
 #include "ametsuchi/tx_cache_response.hpp"
 #include "common/result.hpp"
@@ -28,9 +30,10 @@ namespace iroha {
         std::string message;
       };
 
-      using BlockResult =
-          expected::Result<std::unique_ptr<shared_model::interface::Block>,
-                           GetBlockError>;
+      /// blocks are immutable, so cached blocks are shared with the callers
+      using BlockResult = expected::
+          Result<std::shared_ptr<const shared_model::interface::Block>,
+                 GetBlockError>;
 
       virtual ~BlockQuery() = default;
 
@@ -42,6 +45,17 @@ namespace iroha {
       virtual BlockResult getBlock(
           shared_model::interface::types::HeightType height) = 0;
 
+      /**
+       * Retrieve block with given height as it is stored, if it is stored as
+       * a binary serialized iroha.protocol.Block. The block is neither parsed
+       * nor validated, its integrity relies on the block store
+       * @param height - height of a block to retrieve
+       * @return serialized block, boost::none if the block is missing or is
+       * stored in another form, in which case getBlock is to be used
+       */
+      virtual boost::optional<std::string> getSerializedBlock(
+          shared_model::interface::types::HeightType height) = 0;
+
       /**
        * Get height of the top block.
        * @return height
@@ -59,6 +73,32 @@ namespace iroha {
        */
       virtual boost::optional<TxCacheStatusType> checkTxPresence(
           const shared_model::crypto::Hash &hash) = 0;
+
+      /**
+       * Synchronously checks presence of several transactions at once
+       * @param hashes - transactions' hashes
+       * @return statuses of transactions in the order of hashes if storage
+       * query was successful, boost::none otherwise
+       */
+      virtual boost::optional<std::vector<TxCacheStatusType>> checkTxsPresence(
+          const std::vector<shared_model::crypto::Hash> &hashes) = 0;
+
+      /**
+       * Get heights of blocks with transactions created by the accounts or
+       * transferring assets from or to them
+       * @param account_ids - accounts
+       * @param from - the least height
+       * @param limit - maximum number of heights
+       * @return heights in ascending order, boost::none if storage query
+       * failed
+       */
+      virtual boost::optional<
+          std::vector<shared_model::interface::types::HeightType>>
+      getAccountsBlockHeights(
+          const std::vector<shared_model::interface::types::AccountIdType>
+              &account_ids,
+          shared_model::interface::types::HeightType from,
+          size_t limit) = 0;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
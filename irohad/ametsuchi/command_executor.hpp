@@ -38,14 +38,19 @@ namespace iroha {
 
     /**
      * Error for command execution or validation
-     * Contains command name, as well as an error message
+     * Contains command name, as well as an error message, which is rendered
+     * only when it is read
      */
     struct CommandError {
       using ErrorCodeType = uint32_t;
 
+      /// codes common for all commands, others are specific to a command
+      static constexpr ErrorCodeType kInternalError = 1;
+      static constexpr ErrorCodeType kNoPermissions = 2;
+
       std::string command_name;
       ErrorCodeType error_code;
-      std::string error_extra;
+      expected::LazyMessage error_extra;
 
       std::string toString() const;
     };
@@ -70,6 +75,21 @@ namespace iroha {
 
       virtual void doValidation(bool do_validation) = 0;
 
+      /**
+       * Defer execution of commands which are not validated until flush, so
+       * that they are sent to the database together instead of waiting for
+       * the result of every command. Deferred commands succeed when called,
+       * their errors are returned by flush
+       * @param defer_execution - whether commands are deferred
+       */
+      virtual void deferExecution(bool defer_execution) = 0;
+
+      /**
+       * Execute deferred commands in order
+       * @return error of the first failed command
+       */
+      virtual CommandResult flush() = 0;
+
       virtual CommandResult operator()(
           const shared_model::interface::AddAssetQuantity &command) = 0;
 
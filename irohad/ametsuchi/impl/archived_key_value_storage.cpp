@@ -0,0 +1,119 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/archived_key_value_storage.hpp"
+
+#include <algorithm>
+
+#include "logger/logger.hpp"
+
+namespace {
+  /// entries archived by a single add, so that a backlog of entries stored
+  /// before archiving was enabled does not delay the add
+  constexpr iroha::ametsuchi::KeyValueStorage::Identifier kMaxArchivedPerAdd =
+      100;
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    ArchivedKeyValueStorage::ArchivedKeyValueStorage(
+        std::unique_ptr<KeyValueStorage> storage,
+        std::unique_ptr<KeyValueStorage> archive,
+        Identifier retained,
+        logger::LoggerPtr log)
+        : storage_(std::move(storage)),
+          archive_(std::move(archive)),
+          retained_(std::max<Identifier>(retained, 1)),
+          log_(std::move(log)),
+          archived_(archive_->last_id()) {}
+
+    bool ArchivedKeyValueStorage::add(Identifier id, const Bytes &blob) {
+      if (not storage_->add(id, blob)) {
+        return false;
+      }
+      if (id > retained_) {
+        archive(id - retained_);
+      }
+      return true;
+    }
+
+    boost::optional<KeyValueStorage::Bytes> ArchivedKeyValueStorage::get(
+        Identifier id) const {
+      auto order = lookupOrder(id);
+      if (auto bytes = order.first->get(id)) {
+        return bytes;
+      }
+      return order.second->get(id);
+    }
+
+    boost::optional<KeyValueStorage::BytesView>
+    ArchivedKeyValueStorage::getView(Identifier id) const {
+      auto order = lookupOrder(id);
+      if (auto view = order.first->getView(id)) {
+        return view;
+      }
+      return order.second->getView(id);
+    }
+
+    std::string ArchivedKeyValueStorage::directory() const {
+      return storage_->directory();
+    }
+
+    KeyValueStorage::Identifier ArchivedKeyValueStorage::last_id() const {
+      return std::max(storage_->last_id(), archive_->last_id());
+    }
+
+    void ArchivedKeyValueStorage::dropAll() {
+      storage_->dropAll();
+      archive_->dropAll();
+      archived_ = 0;
+    }
+
+    bool ArchivedKeyValueStorage::sync(Identifier from, Identifier to) {
+      return storage_->sync(from, to);
+    }
+
+    void ArchivedKeyValueStorage::archive(Identifier id) {
+      const Identifier from = archived_ + 1;
+      auto to = archived_.load();
+      const auto last = std::min(id, from + kMaxArchivedPerAdd - 1);
+      for (auto i = from; i <= last; ++i) {
+        auto bytes = storage_->get(i);
+        if (not bytes) {
+          log_->warn("Entry {} to archive is missing", i);
+          break;
+        }
+        if (not archive_->add(i, *bytes)) {
+          log_->error("Cannot archive entry {}", i);
+          break;
+        }
+        to = i;
+      }
+      if (to < from) {
+        return;
+      }
+      if (not archive_->sync(from, to)) {
+        log_->error("Cannot sync archived entries {}-{}", from, to);
+        return;
+      }
+      archived_ = to;
+      if (not storage_->removeUpTo(to)) {
+        log_->warn("Cannot remove archived entries up to {} locally", to);
+      }
+    }
+
+    std::pair<const KeyValueStorage *, const KeyValueStorage *>
+    ArchivedKeyValueStorage::lookupOrder(Identifier id) const {
+      // an entry may be removed locally after it is looked up, so the other
+      // storage is checked as well
+      if (id <= archived_) {
+        return {archive_.get(), storage_.get()};
+      }
+      return {storage_.get(), archive_.get()};
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
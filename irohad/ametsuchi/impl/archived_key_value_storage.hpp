@@ -0,0 +1,81 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ARCHIVED_KEY_VALUE_STORAGE_HPP
+#define IROHA_ARCHIVED_KEY_VALUE_STORAGE_HPP
+
+#include "ametsuchi/key_value_storage.hpp"
+
+#include <atomic>
+#include <utility>
+
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Storage which keeps only the last entries in the local storage and
+     * moves older ones to an archive, e.g. a directory of a mounted object
+     * storage bucket, so the local disk holds a bounded number of entries.
+     * An entry is removed locally only after it is added to the archive and
+     * synced there, and archived entries are read from the archive on
+     * request, so the storage still holds all the entries.
+     */
+    class ArchivedKeyValueStorage : public KeyValueStorage {
+     public:
+      /**
+       * @param storage - local storage of the last entries
+       * @param archive - storage of the archived entries
+       * @param retained - number of the last entries kept locally, at least 1
+       * @param log - logger
+       */
+      ArchivedKeyValueStorage(std::unique_ptr<KeyValueStorage> storage,
+                              std::unique_ptr<KeyValueStorage> archive,
+                              Identifier retained,
+                              logger::LoggerPtr log);
+
+      /**
+       * Archives the entries which are not retained after the new one is
+       * added, failures of archiving are logged and retried by the next add
+       */
+      bool add(Identifier id, const Bytes &blob) override;
+
+      boost::optional<Bytes> get(Identifier id) const override;
+
+      boost::optional<BytesView> getView(Identifier id) const override;
+
+      std::string directory() const override;
+
+      Identifier last_id() const override;
+
+      /**
+       * Drops the archived entries as well
+       */
+      void dropAll() override;
+
+      bool sync(Identifier from, Identifier to) override;
+
+     private:
+      /// move the entries up to the given one to the archive
+      void archive(Identifier id);
+
+      /// @return the storage to look an entry up in first and the other one
+      std::pair<const KeyValueStorage *, const KeyValueStorage *> lookupOrder(
+          Identifier id) const;
+
+      std::unique_ptr<KeyValueStorage> storage_;
+      std::unique_ptr<KeyValueStorage> archive_;
+      const Identifier retained_;
+      logger::LoggerPtr log_;
+
+      /// last entry which is archived and synced
+      std::atomic<Identifier> archived_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_ARCHIVED_KEY_VALUE_STORAGE_HPP
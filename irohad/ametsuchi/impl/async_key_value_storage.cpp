@@ -0,0 +1,156 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/async_key_value_storage.hpp"
+
+#include <algorithm>
+
+#include "logger/logger.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    AsyncKeyValueStorage::AsyncKeyValueStorage(
+        std::unique_ptr<KeyValueStorage> storage, logger::LoggerPtr log)
+        : storage_(std::move(storage)),
+          log_(std::move(log)),
+          durable_id_(storage_->last_id()),
+          writing_(false),
+          failed_(false),
+          stop_(false),
+          writer_([this] { writeLoop(); }) {}
+
+    AsyncKeyValueStorage::~AsyncKeyValueStorage() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+      }
+      pending_cv_.notify_one();
+      writer_.join();
+    }
+
+    bool AsyncKeyValueStorage::add(Identifier id, const Bytes &blob) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (failed_) {
+          log_->error("Refusing to add entry {} after a write failure", id);
+          return false;
+        }
+        // entries are written in order, so the ones up to the durable
+        // watermark are stored already and the storage is not read here
+        if (id <= durable_id_ or pending_.count(id) != 0) {
+          log_->warn("Entry with id {} already exists", id);
+          return false;
+        }
+        pending_.emplace(id, std::make_shared<const Bytes>(blob));
+        queue_.push_back(id);
+      }
+      pending_cv_.notify_one();
+      return true;
+    }
+
+    boost::optional<KeyValueStorage::Bytes> AsyncKeyValueStorage::get(
+        Identifier id) const {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = pending_.find(id);
+        if (it != pending_.end()) {
+          return *it->second;
+        }
+      }
+      std::lock_guard<std::mutex> storage_lock(storage_mutex_);
+      return storage_->get(id);
+    }
+
+    boost::optional<KeyValueStorage::BytesView> AsyncKeyValueStorage::getView(
+        Identifier id) const {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = pending_.find(id);
+        if (it != pending_.end()) {
+          return BytesView(it->second->data(), it->second->size(), it->second);
+        }
+      }
+      std::lock_guard<std::mutex> storage_lock(storage_mutex_);
+      return storage_->getView(id);
+    }
+
+    std::string AsyncKeyValueStorage::directory() const {
+      return storage_->directory();
+    }
+
+    KeyValueStorage::Identifier AsyncKeyValueStorage::last_id() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return pending_.empty()
+          ? durable_id_
+          : std::max(durable_id_, pending_.rbegin()->first);
+    }
+
+    void AsyncKeyValueStorage::dropAll() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      // wait for the entry being written, pending ones are discarded
+      written_cv_.wait(lock, [this] { return not writing_; });
+      pending_.clear();
+      queue_.clear();
+      {
+        std::lock_guard<std::mutex> storage_lock(storage_mutex_);
+        storage_->dropAll();
+        durable_id_ = storage_->last_id();
+      }
+      failed_ = false;
+    }
+
+    bool AsyncKeyValueStorage::sync(Identifier from, Identifier to) {
+      std::lock_guard<std::mutex> storage_lock(storage_mutex_);
+      return storage_->sync(from, to);
+    }
+
+    KeyValueStorage::Identifier AsyncKeyValueStorage::durableId() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return durable_id_;
+    }
+
+    bool AsyncKeyValueStorage::flush() const {
+      std::unique_lock<std::mutex> lock(mutex_);
+      written_cv_.wait(lock, [this] { return failed_ or queue_.empty(); });
+      return not failed_;
+    }
+
+    void AsyncKeyValueStorage::writeLoop() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (true) {
+        pending_cv_.wait(lock, [this] {
+          return stop_ or (not failed_ and not queue_.empty());
+        });
+        if (failed_ or queue_.empty()) {
+          // stop requested and nothing can be written anymore
+          return;
+        }
+
+        const auto id = queue_.front();
+        const auto blob = pending_.at(id);
+        writing_ = true;
+        lock.unlock();
+        const auto written = [&] {
+          std::lock_guard<std::mutex> storage_lock(storage_mutex_);
+          return storage_->add(id, *blob);
+        }();
+        lock.lock();
+        writing_ = false;
+
+        if (written) {
+          queue_.pop_front();
+          pending_.erase(id);
+          durable_id_ = std::max(durable_id_, id);
+        } else {
+          log_->critical("Failed to write entry {}, stopping writes", id);
+          failed_ = true;
+        }
+        written_cv_.notify_all();
+      }
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
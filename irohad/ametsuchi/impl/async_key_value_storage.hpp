@@ -0,0 +1,105 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ASYNC_KEY_VALUE_STORAGE_HPP
+#define IROHA_ASYNC_KEY_VALUE_STORAGE_HPP
+
+#include "ametsuchi/key_value_storage.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Storage which writes entries to the underlying storage on a background
+     * thread. Added entries are immediately readable from memory until they
+     * are written, so add() latency does not include the disk write.
+     * Entries are written in order of addition; the last written entry is
+     * the durable watermark, and ids up to it are treated as stored. If a write fails, the storage stops writing and
+     * rejects new entries, while pending ones remain readable.
+     */
+    class AsyncKeyValueStorage : public KeyValueStorage {
+     public:
+      /**
+       * @param storage - storage to write entries to
+       * @param log - logger
+       */
+      AsyncKeyValueStorage(std::unique_ptr<KeyValueStorage> storage,
+                           logger::LoggerPtr log);
+
+      /**
+       * Writes all pending entries before destruction
+       */
+      ~AsyncKeyValueStorage() override;
+
+      bool add(Identifier id, const Bytes &blob) override;
+
+      boost::optional<Bytes> get(Identifier id) const override;
+
+      boost::optional<BytesView> getView(Identifier id) const override;
+
+      std::string directory() const override;
+
+      Identifier last_id() const override;
+
+      void dropAll() override;
+
+      /**
+       * Syncs only the entries which are written to the underlying storage
+       */
+      bool sync(Identifier from, Identifier to) override;
+
+      /**
+       * @return id of the last entry written to the underlying storage
+       */
+      Identifier durableId() const;
+
+      /**
+       * Block until all pending entries are written or writing fails
+       * @return true if all entries were written
+       */
+      bool flush() const;
+
+     private:
+      /// background thread routine
+      void writeLoop();
+
+      std::unique_ptr<KeyValueStorage> storage_;
+      /// serializes access to storage_, which may not be thread-safe
+      mutable std::mutex storage_mutex_;
+      logger::LoggerPtr log_;
+
+      /// guards the state below
+      mutable std::mutex mutex_;
+      /// notifies the writer about new entries and stop request
+      std::condition_variable pending_cv_;
+      /// notifies waiters about written entries and failures
+      mutable std::condition_variable written_cv_;
+
+      /// entries which are not written yet
+      std::map<Identifier, std::shared_ptr<const Bytes>> pending_;
+      /// ids of pending entries in order of addition
+      std::deque<Identifier> queue_;
+      /// id of the last entry written to storage_
+      Identifier durable_id_;
+      /// the writer is writing the first entry of the queue
+      bool writing_;
+      bool failed_;
+      bool stop_;
+
+      std::thread writer_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_ASYNC_KEY_VALUE_STORAGE_HPP
@@ -0,0 +1,81 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/block_cache.hpp"
+
+#include "interfaces/iroha_internal/block.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    BlockCache::BlockCache(size_t capacity)
+        : capacity_(capacity), weight_(0), hits_(0), misses_(0) {}
+
+    void BlockCache::insert(BlockPtr block, size_t size) {
+      if (not block or size > capacity_) {
+        return;
+      }
+      const auto height = block->height();
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = index_.find(height);
+      if (it != index_.end()) {
+        weight_ -= it->second->size;
+        entries_.erase(it->second);
+        index_.erase(it);
+      }
+
+      while (weight_ + size > capacity_) {
+        auto &victim = entries_.back();
+        weight_ -= victim.size;
+        index_.erase(victim.height);
+        entries_.pop_back();
+      }
+
+      entries_.push_front(Entry{height, std::move(block), size});
+      index_.emplace(height, entries_.begin());
+      weight_ += size;
+    }
+
+    BlockCache::BlockPtr BlockCache::find(
+        shared_model::interface::types::HeightType height) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = index_.find(height);
+      if (it == index_.end()) {
+        ++misses_;
+        return nullptr;
+      }
+      ++hits_;
+      entries_.splice(entries_.begin(), entries_, it->second);
+      return it->second->block;
+    }
+
+    void BlockCache::clear() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      entries_.clear();
+      index_.clear();
+      weight_ = 0;
+    }
+
+    uint64_t BlockCache::hits() const {
+      return hits_;
+    }
+
+    uint64_t BlockCache::misses() const {
+      return misses_;
+    }
+
+    size_t BlockCache::weight() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return weight_;
+    }
+
+    size_t BlockCache::count() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return entries_.size();
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
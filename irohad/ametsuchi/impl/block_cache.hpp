@@ -0,0 +1,104 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_BLOCK_CACHE_HPP
+#define IROHA_BLOCK_CACHE_HPP
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "interfaces/common_objects/types.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Thread-safe LRU cache of parsed blocks keyed by height. Cache capacity
+     * is limited by the total size of serialized blocks it holds.
+     */
+    class BlockCache {
+     public:
+      using BlockPtr = std::shared_ptr<const shared_model::interface::Block>;
+
+      /**
+       * @param capacity - maximum total size in bytes of cached blocks, zero
+       * disables the cache
+       */
+      explicit BlockCache(size_t capacity);
+
+      /**
+       * Put block to the cache, evicting least recently used blocks if
+       * capacity is exceeded. Blocks larger than capacity are not cached
+       * @param block - block to insert
+       * @param size - size of the serialized block in bytes
+       */
+      void insert(BlockPtr block, size_t size);
+
+      /**
+       * @return block with given height or nullptr if it is not cached
+       */
+      BlockPtr find(shared_model::interface::types::HeightType height);
+
+      /**
+       * Remove all blocks from the cache
+       */
+      void clear();
+
+      /**
+       * @return number of successful lookups
+       */
+      uint64_t hits() const;
+
+      /**
+       * @return number of failed lookups
+       */
+      uint64_t misses() const;
+
+      /**
+       * @return total size in bytes of cached blocks
+       */
+      size_t weight() const;
+
+      /**
+       * @return number of cached blocks
+       */
+      size_t count() const;
+
+     private:
+      struct Entry {
+        shared_model::interface::types::HeightType height;
+        BlockPtr block;
+        size_t size;
+      };
+      using EntryList = std::list<Entry>;
+
+      const size_t capacity_;
+
+      mutable std::mutex mutex_;
+
+      /// entries ordered from most to least recently used
+      EntryList entries_;
+      std::unordered_map<shared_model::interface::types::HeightType,
+                         EntryList::iterator>
+          index_;
+      size_t weight_;
+
+      std::atomic<uint64_t> hits_;
+      std::atomic<uint64_t> misses_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_BLOCK_CACHE_HPP
@@ -0,0 +1,112 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_BLOCK_STORE_OPTIONS_HPP
+#define IROHA_BLOCK_STORE_OPTIONS_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Type of persistent key-value storage used to keep committed blocks
+     */
+    enum class BlockStoreType {
+      /// one file per block, see FlatFile
+      kFlatFile,
+      /// append-only segment files with an offset index, see SegmentedBlockLog
+      kSegmentedLog
+    };
+
+    /**
+     * When written blocks are flushed from the OS buffers to disk, see
+     * SyncedKeyValueStorage
+     */
+    enum class BlockStoreSync {
+      /// the OS flushes blocks at its own pace
+      kNone,
+      /// every block is on disk before its write returns
+      kEveryBlock,
+      /// blocks written during an interval are flushed together
+      kGroup
+    };
+
+    /**
+     * Parameters of the persistent block store
+     */
+    struct BlockStoreOptions {
+      /// default maximum size of a single segment file: 64 MiB
+      static constexpr uint64_t kDefaultSegmentSize = 64ull * 1024 * 1024;
+      /// default capacity of the recent blocks cache: 32 MiB
+      static constexpr uint64_t kDefaultBlockCacheSize = 32ull * 1024 * 1024;
+
+      BlockStoreType type = BlockStoreType::kFlatFile;
+
+      /// segment is sealed and a new one is started when it reaches this size,
+      /// used only by BlockStoreType::kSegmentedLog
+      uint64_t segment_size = kDefaultSegmentSize;
+
+      /// reserve disk space of a segment when it is started, used only by
+      /// BlockStoreType::kSegmentedLog
+      bool preallocate_segments = false;
+
+      /// write segments bypassing the page cache, so block ingestion does not
+      /// evict pages of the database; used only by
+      /// BlockStoreType::kSegmentedLog
+      bool direct_io = false;
+
+      /// total size in bytes of serialized blocks kept parsed in memory for
+      /// recent heights, zero disables the cache
+      uint64_t block_cache_size = kDefaultBlockCacheSize;
+
+      /// write blocks to the store in a background thread, so commit does not
+      /// wait for disk; blocks which were not written before a crash are
+      /// fetched again from peers, see AsyncKeyValueStorage
+      bool async_write = false;
+
+      /// compress blocks in the store, see CompressedKeyValueStorage; blocks
+      /// written without compression remain readable
+      bool compression = false;
+
+      /// store blocks as binary protobuf instead of JSON, so they are sent to
+      /// peers and clients without being parsed; blocks written as JSON
+      /// remain readable
+      bool binary_format = false;
+
+      /// store blocks in the compact form of CompactBlock, which writes the
+      /// values repeated in a block once; takes precedence over binary_format,
+      /// blocks written in other forms remain readable
+      bool compact_format = false;
+
+      /// check at startup that stored blocks form a chain and remove the
+      /// blocks after the first invalid one, see verifyBlockStore; used only
+      /// by BlockStoreType::kFlatFile, segmented log checks its records anyway
+      bool verify_on_startup = false;
+
+      /// durability of written blocks, trading the latency of writes
+      BlockStoreSync sync = BlockStoreSync::kNone;
+
+      /// blocks written during the interval are flushed together, used only
+      /// by BlockStoreSync::kGroup
+      std::chrono::milliseconds sync_interval{10};
+
+      /// number of the last blocks kept in the block store, older blocks are
+      /// moved to archive_path and read from there on request, and their
+      /// history index rows are pruned once their transactions expire; zero
+      /// keeps all the blocks, see ArchivedKeyValueStorage
+      uint32_t retained_blocks = 0;
+
+      /// directory of archived blocks, e.g. a mounted object storage bucket,
+      /// used only with retained_blocks
+      std::string archive_path;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_BLOCK_STORE_OPTIONS_HPP
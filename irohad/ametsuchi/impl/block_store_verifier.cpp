@@ -0,0 +1,107 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/block_store_verifier.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+#include "common/thread_pool.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/iroha_internal/block_json_deserializer.hpp"
+#include "logger/logger.hpp"
+
+namespace {
+  /// number of blocks parsed at once
+  constexpr size_t kBlocksPerChunk = 1024;
+
+  /// data of a parsed block needed to check the chain
+  struct BlockSummary {
+    bool valid = false;
+    shared_model::interface::types::HashType hash;
+    shared_model::interface::types::HashType prev_hash;
+    size_t size = 0;
+  };
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    KeyValueStorage::Identifier verifyBlockStore(
+        const KeyValueStorage &block_store,
+        KeyValueStorage::Identifier first_id,
+        const shared_model::interface::BlockJsonDeserializer &deserializer,
+        ThreadPool &pool,
+        logger::LoggerPtr log) {
+      const auto last_id = block_store.last_id();
+      const auto start = std::chrono::steady_clock::now();
+      size_t verified = 0;
+      size_t verified_bytes = 0;
+      auto report = [&] {
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                           std::chrono::steady_clock::now() - start)
+                           .count();
+        auto seconds = std::max<double>(elapsed, 1) / 1000;
+        log->info(
+            "Verified {} blocks, {} MiB in {} ms: {:.0f} blocks/s, {:.1f} "
+            "MiB/s",
+            verified,
+            verified_bytes >> 20,
+            elapsed,
+            verified / seconds,
+            verified_bytes / seconds / (1 << 20));
+      };
+
+      std::vector<BlockSummary> chunk;
+      boost::optional<shared_model::interface::types::HashType> previous_hash;
+      for (uint64_t begin = first_id; begin <= last_id;
+           begin += kBlocksPerChunk) {
+        auto count =
+            static_cast<size_t>(std::min<uint64_t>(kBlocksPerChunk,
+                                                   last_id - begin + 1));
+        chunk.assign(count, BlockSummary{});
+        pool.parallelFor(count, [&](size_t i) {
+          auto id = static_cast<KeyValueStorage::Identifier>(begin + i);
+          auto view = block_store.getView(id);
+          if (not view) {
+            return;
+          }
+          deserializer.deserialize(view->charData(), view->size())
+              .match(
+                  [&](const auto &block) {
+                    if (block.value->height() == id) {
+                      chunk[i].valid = true;
+                      chunk[i].hash = block.value->hash();
+                      chunk[i].prev_hash = block.value->prevHash();
+                      chunk[i].size = view->size();
+                    }
+                  },
+                  [](const auto &) {});
+        });
+
+        for (size_t i = 0; i < count; ++i) {
+          const auto &summary = chunk[i];
+          if (not summary.valid
+              or (previous_hash and summary.prev_hash != *previous_hash)) {
+            auto id = static_cast<KeyValueStorage::Identifier>(begin + i);
+            log->error("Block {} is missing, corrupted or does not continue "
+                       "the chain",
+                       id);
+            report();
+            return id - 1;
+          }
+          ++verified;
+          verified_bytes += summary.size;
+          previous_hash = summary.hash;
+        }
+      }
+
+      report();
+      return last_id;
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
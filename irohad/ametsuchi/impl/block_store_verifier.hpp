@@ -0,0 +1,47 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_BLOCK_STORE_VERIFIER_HPP
+#define IROHA_BLOCK_STORE_VERIFIER_HPP
+
+#include "ametsuchi/key_value_storage.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class BlockJsonDeserializer;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+  class ThreadPool;
+
+  namespace ametsuchi {
+
+    /**
+     * Check that the block store entries starting from first_id form a
+     * chain: every entry is a parseable block of the height equal to its id
+     * and refers to the hash of the previous block. Entries are parsed and
+     * hashed on the pool in chunks, links are checked in order
+     * @param block_store - store with blocks serialized to JSON
+     * @param first_id - id of the first stored block, its previous hash is
+     * not checked
+     * @param deserializer - parser of stored blocks
+     * @param pool - threads parsing the blocks
+     * @param log - logger to report the result and throughput
+     * @return id of the last entry of the valid chain, first_id - 1 if the
+     * first entry is invalid
+     */
+    KeyValueStorage::Identifier verifyBlockStore(
+        const KeyValueStorage &block_store,
+        KeyValueStorage::Identifier first_id,
+        const shared_model::interface::BlockJsonDeserializer &deserializer,
+        ThreadPool &pool,
+        logger::LoggerPtr log);
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_BLOCK_STORE_VERIFIER_HPP
@@ -0,0 +1,262 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/compressed_key_value_storage.hpp"
+
+#include <zlib.h>
+#include "logger/logger.hpp"
+
+namespace {
+  using iroha::ametsuchi::KeyValueStorage;
+  using Bytes = KeyValueStorage::Bytes;
+
+  /// first byte of encoded entries
+  constexpr uint8_t kEnvelope = 0;
+  /// methods of encoding, stored after the envelope byte
+  enum Method : uint8_t {
+    kStored = 0,
+    kDeflate = 1,
+    kDeflateWithDictionary = 2,
+  };
+  /// envelope byte, method and size of the decoded entry
+  constexpr size_t kHeaderSize = 6;
+  /// entry used as the preset dictionary
+  constexpr KeyValueStorage::Identifier kDictionaryId = 1;
+  /// deflate does not look further back than its window
+  constexpr size_t kMaxDictionarySize = 32 * 1024;
+
+  Bytes header(Method method, size_t size) {
+    return Bytes{kEnvelope,
+                 method,
+                 static_cast<uint8_t>(size),
+                 static_cast<uint8_t>(size >> 8),
+                 static_cast<uint8_t>(size >> 16),
+                 static_cast<uint8_t>(size >> 24)};
+  }
+
+  /// @return entry with the deflated blob, boost::none on failure
+  boost::optional<Bytes> compress(const Bytes &blob, const Bytes *dictionary) {
+    z_stream stream{};
+    if (deflateInit2(&stream,
+                     Z_DEFAULT_COMPRESSION,
+                     Z_DEFLATED,
+                     -MAX_WBITS,
+                     8,
+                     Z_DEFAULT_STRATEGY)
+        != Z_OK) {
+      return boost::none;
+    }
+    if (dictionary
+        and deflateSetDictionary(&stream,
+                                 dictionary->data(),
+                                 static_cast<uInt>(dictionary->size()))
+            != Z_OK) {
+      deflateEnd(&stream);
+      return boost::none;
+    }
+
+    auto bound = deflateBound(&stream, static_cast<uLong>(blob.size()));
+    auto result =
+        header(dictionary ? kDeflateWithDictionary : kDeflate, blob.size());
+    result.resize(kHeaderSize + bound);
+    stream.next_in = const_cast<Bytef *>(blob.data());
+    stream.avail_in = static_cast<uInt>(blob.size());
+    stream.next_out = result.data() + kHeaderSize;
+    stream.avail_out = static_cast<uInt>(bound);
+    auto status = deflate(&stream, Z_FINISH);
+    result.resize(kHeaderSize + stream.total_out);
+    deflateEnd(&stream);
+    if (status != Z_STREAM_END) {
+      return boost::none;
+    }
+    return result;
+  }
+
+  /// @return inflated data of the given size, boost::none if it is corrupted
+  boost::optional<Bytes> decompress(const uint8_t *data,
+                                    size_t size,
+                                    size_t decoded_size,
+                                    const Bytes *dictionary) {
+    z_stream stream{};
+    if (inflateInit2(&stream, -MAX_WBITS) != Z_OK) {
+      return boost::none;
+    }
+    if (dictionary
+        and inflateSetDictionary(&stream,
+                                 dictionary->data(),
+                                 static_cast<uInt>(dictionary->size()))
+            != Z_OK) {
+      inflateEnd(&stream);
+      return boost::none;
+    }
+
+    Bytes result(decoded_size);
+    stream.next_in = const_cast<Bytef *>(data);
+    stream.avail_in = static_cast<uInt>(size);
+    stream.next_out = result.data();
+    stream.avail_out = static_cast<uInt>(result.size());
+    auto status = inflate(&stream, Z_FINISH);
+    auto total_out = stream.total_out;
+    inflateEnd(&stream);
+    if (status != Z_STREAM_END or total_out != decoded_size) {
+      return boost::none;
+    }
+    return result;
+  }
+
+  bool usesDictionary(const uint8_t *data, size_t size) {
+    return size >= kHeaderSize and data[0] == kEnvelope
+        and data[1] == kDeflateWithDictionary;
+  }
+
+  /**
+   * @param dictionary - preset dictionary, entries compressed with it are
+   * treated as corrupted if null
+   * @return decoded entry, boost::none if it is corrupted
+   */
+  boost::optional<Bytes> decodeEntry(const uint8_t *data,
+                                     size_t size,
+                                     const Bytes *dictionary) {
+    if (size == 0 or data[0] != kEnvelope) {
+      return Bytes(data, data + size);
+    }
+    if (size < kHeaderSize) {
+      return boost::none;
+    }
+    size_t decoded_size = static_cast<size_t>(data[2])
+        | static_cast<size_t>(data[3]) << 8 | static_cast<size_t>(data[4]) << 16
+        | static_cast<size_t>(data[5]) << 24;
+    switch (data[1]) {
+      case kStored:
+        if (size - kHeaderSize != decoded_size) {
+          return boost::none;
+        }
+        return Bytes(data + kHeaderSize, data + size);
+      case kDeflate:
+        return decompress(
+            data + kHeaderSize, size - kHeaderSize, decoded_size, nullptr);
+      case kDeflateWithDictionary:
+        if (not dictionary) {
+          return boost::none;
+        }
+        return decompress(
+            data + kHeaderSize, size - kHeaderSize, decoded_size, dictionary);
+      default:
+        return boost::none;
+    }
+  }
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    CompressedKeyValueStorage::CompressedKeyValueStorage(
+        std::unique_ptr<KeyValueStorage> storage, logger::LoggerPtr log)
+        : storage_(std::move(storage)),
+          log_(std::move(log)),
+          dictionary_loaded_(false) {}
+
+    bool CompressedKeyValueStorage::add(Identifier id, const Bytes &blob) {
+      auto dictionary = id == kDictionaryId ? nullptr : this->dictionary();
+      auto encoded = compress(blob, dictionary.get());
+
+      bool inserted = false;
+      if (encoded and encoded->size() < blob.size()) {
+        inserted = storage_->add(id, *encoded);
+      } else if (blob.empty() or blob.front() != kEnvelope) {
+        inserted = storage_->add(id, blob);
+      } else {
+        auto stored = header(kStored, blob.size());
+        stored.insert(stored.end(), blob.begin(), blob.end());
+        inserted = storage_->add(id, stored);
+      }
+
+      if (inserted and id == kDictionaryId) {
+        std::lock_guard<std::mutex> lock(dictionary_mutex_);
+        dictionary_.reset();
+        dictionary_loaded_ = false;
+      }
+      return inserted;
+    }
+
+    boost::optional<KeyValueStorage::Bytes> CompressedKeyValueStorage::get(
+        Identifier id) const {
+      auto view = storage_->getView(id);
+      if (not view) {
+        return boost::none;
+      }
+      return decode(view->data(), view->size());
+    }
+
+    boost::optional<KeyValueStorage::BytesView>
+    CompressedKeyValueStorage::getView(Identifier id) const {
+      auto view = storage_->getView(id);
+      if (not view or view->empty() or view->data()[0] != kEnvelope) {
+        return view;
+      }
+      auto decoded = decode(view->data(), view->size());
+      if (not decoded) {
+        return boost::none;
+      }
+      return BytesView(std::move(*decoded));
+    }
+
+    std::string CompressedKeyValueStorage::directory() const {
+      return storage_->directory();
+    }
+
+    KeyValueStorage::Identifier CompressedKeyValueStorage::last_id() const {
+      return storage_->last_id();
+    }
+
+    void CompressedKeyValueStorage::dropAll() {
+      storage_->dropAll();
+      std::lock_guard<std::mutex> lock(dictionary_mutex_);
+      dictionary_.reset();
+      dictionary_loaded_ = false;
+    }
+
+    bool CompressedKeyValueStorage::sync(Identifier from, Identifier to) {
+      return storage_->sync(from, to);
+    }
+
+    std::shared_ptr<const KeyValueStorage::Bytes>
+    CompressedKeyValueStorage::dictionary() const {
+      std::lock_guard<std::mutex> lock(dictionary_mutex_);
+      if (dictionary_loaded_) {
+        return dictionary_;
+      }
+      dictionary_loaded_ = true;
+
+      auto view = storage_->getView(kDictionaryId);
+      if (not view) {
+        return nullptr;
+      }
+      // the first entry itself is never compressed with the dictionary
+      auto entry = decodeEntry(view->data(), view->size(), nullptr);
+      if (not entry) {
+        log_->error("Entry {} is corrupted", kDictionaryId);
+        return nullptr;
+      }
+      if (entry->size() > kMaxDictionarySize) {
+        entry->erase(entry->begin(), entry->end() - kMaxDictionarySize);
+      }
+      dictionary_ = std::make_shared<const Bytes>(std::move(*entry));
+      return dictionary_;
+    }
+
+    boost::optional<KeyValueStorage::Bytes> CompressedKeyValueStorage::decode(
+        const uint8_t *data, size_t size) const {
+      auto dictionary =
+          usesDictionary(data, size) ? this->dictionary() : nullptr;
+      auto entry = decodeEntry(data, size, dictionary.get());
+      if (not entry) {
+        log_->error("Stored entry is corrupted");
+      }
+      return entry;
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,80 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_COMPRESSED_KEY_VALUE_STORAGE_HPP
+#define IROHA_COMPRESSED_KEY_VALUE_STORAGE_HPP
+
+#include "ametsuchi/key_value_storage.hpp"
+
+#include <mutex>
+
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Storage which deflates entries before writing them to the underlying
+     * storage and inflates them on reading. Entries other than the first one
+     * are compressed with the tail of the first entry as a preset
+     * dictionary: for the block store it is the genesis block, which holds
+     * the account, asset and domain ids repeated by later blocks.
+     *
+     * Compressed entries start with a zero byte, which neither serialized
+     * protobuf nor JSON can start with, so entries written without
+     * compression are read as they are.
+     */
+    class CompressedKeyValueStorage : public KeyValueStorage {
+     public:
+      /**
+       * @param storage - storage to write compressed entries to
+       * @param log - logger
+       */
+      CompressedKeyValueStorage(std::unique_ptr<KeyValueStorage> storage,
+                                logger::LoggerPtr log);
+
+      bool add(Identifier id, const Bytes &blob) override;
+
+      boost::optional<Bytes> get(Identifier id) const override;
+
+      /**
+       * Returns the view of the underlying storage for entries stored
+       * without compression, so they are not copied
+       */
+      boost::optional<BytesView> getView(Identifier id) const override;
+
+      std::string directory() const override;
+
+      Identifier last_id() const override;
+
+      void dropAll() override;
+
+      bool sync(Identifier from, Identifier to) override;
+
+     private:
+      /**
+       * @return preset dictionary, null if the first entry does not exist
+       */
+      std::shared_ptr<const Bytes> dictionary() const;
+
+      /**
+       * @return entry decoded from stored data, boost::none if it is corrupted
+       */
+      boost::optional<Bytes> decode(const uint8_t *data, size_t size) const;
+
+      std::unique_ptr<KeyValueStorage> storage_;
+      logger::LoggerPtr log_;
+
+      /// guards the dictionary state
+      mutable std::mutex dictionary_mutex_;
+      mutable std::shared_ptr<const Bytes> dictionary_;
+      /// the first entry was looked up for the dictionary
+      mutable bool dictionary_loaded_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_COMPRESSED_KEY_VALUE_STORAGE_HPP
@@ -5,7 +5,11 @@
 
 #include "ametsuchi/impl/flat_file/flat_file.hpp"
 
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include <ciso646>
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
@@ -111,6 +115,35 @@ boost::optional<FlatFile::Bytes> FlatFile::get(Identifier id) const {
   return buf;
 }
 
+boost::optional<FlatFile::BytesView> FlatFile::getView(Identifier id) const {
+  const auto filename =
+      (boost::filesystem::path{dump_dir_} / FlatFile::id_to_name(id)).string();
+  int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    log_->info("get({}) file not found", id);
+    return boost::none;
+  }
+  struct stat file_stat;
+  if (::fstat(fd, &file_stat) != 0) {
+    ::close(fd);
+    log_->info("get({}) problem with opening file", id);
+    return boost::none;
+  }
+  const size_t file_size = file_stat.st_size;
+  if (file_size == 0) {
+    ::close(fd);
+    return BytesView(Bytes{});
+  }
+  auto mapping = iroha::map_file_region(fd, 0, file_size);
+  ::close(fd);
+  if (not mapping) {
+    log_->info("get({}) problem with mapping file", id);
+    return boost::none;
+  }
+  auto data = mapping.get();
+  return BytesView(data, file_size, std::move(mapping));
+}
+
 std::string FlatFile::directory() const {
   return dump_dir_;
 }
@@ -124,6 +157,62 @@ void FlatFile::dropAll() {
   available_blocks_.clear();
 }
 
+bool FlatFile::sync(Identifier from, Identifier to) {
+  auto synced = true;
+  for (auto it = available_blocks_.lower_bound(from);
+       it != available_blocks_.end() and *it <= to;
+       ++it) {
+    if (not iroha::sync_path(
+            (boost::filesystem::path{dump_dir_} / id_to_name(*it)).string(),
+            true)) {
+      log_->error("Cannot sync entry {}: {}", *it, std::strerror(errno));
+      synced = false;
+    }
+  }
+  if (not iroha::sync_path(dump_dir_, false)) {
+    log_->error(
+        "Cannot sync directory {}: {}", dump_dir_, std::strerror(errno));
+    synced = false;
+  }
+  return synced;
+}
+
+bool FlatFile::truncate(Identifier id) {
+  auto removed = true;
+  for (auto it = available_blocks_.upper_bound(id);
+       it != available_blocks_.end();) {
+    boost::system::error_code err;
+    boost::filesystem::remove(
+        boost::filesystem::path{dump_dir_} / id_to_name(*it), err);
+    if (err) {
+      log_->error("Cannot remove entry {}: {}", *it, err.message());
+      removed = false;
+      ++it;
+    } else {
+      it = available_blocks_.erase(it);
+    }
+  }
+  return removed;
+}
+
+bool FlatFile::removeUpTo(Identifier id) {
+  auto removed = true;
+  for (auto it = available_blocks_.begin();
+       it != available_blocks_.end() and *it <= id;) {
+    boost::system::error_code err;
+    boost::filesystem::remove(
+        boost::filesystem::path{dump_dir_} / id_to_name(*it), err);
+    if (err) {
+      log_->error("Cannot remove entry {}: {}", *it, err.message());
+      removed = false;
+      ++it;
+    } else {
+      it = available_blocks_.erase(it);
+    }
+  }
+  return removed;
+}
+
 const BlockIdCollectionType &FlatFile::blockIdentifiers() const {
   return available_blocks_;
 }
@@ -67,12 +67,32 @@ namespace iroha {
 
       boost::optional<Bytes> get(Identifier id) const override;
 
+      /**
+       * Memory-maps the file of the entry instead of reading it
+       */
+      boost::optional<BytesView> getView(Identifier id) const override;
+
       std::string directory() const override;
 
       Identifier last_id() const override;
 
       void dropAll() override;
 
+      /**
+       * Flushes the files of existing entries in the range and the directory
+       * which lists them
+       */
+      bool sync(Identifier from, Identifier to) override;
+
+      /**
+       * Remove entries with ids greater than the given one
+       * @param id - last entry to keep
+       * @return true if all the entries were removed
+       */
+      bool truncate(Identifier id);
+
+      bool removeUpTo(Identifier id) override;
+
       /**
        * @return collection of available block ids
        */
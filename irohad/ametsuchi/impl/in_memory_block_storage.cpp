@@ -10,30 +10,48 @@ using namespace iroha::ametsuchi;
 bool InMemoryBlockStorage::insert(
     std::shared_ptr<const shared_model::interface::Block> block) {
   auto height = block->height();
-  return block_store_.emplace(height, std::move(block)).second;
+  if (size_ == 0) {
+    blocks_.clear();
+    first_height_ = height;
+  } else if (height < first_height_) {
+    blocks_.insert(blocks_.begin(), first_height_ - height, nullptr);
+    first_height_ = height;
+  }
+  auto offset = height - first_height_;
+  if (offset >= blocks_.size()) {
+    blocks_.resize(offset + 1);
+  } else if (blocks_[offset]) {
+    return false;
+  }
+  blocks_[offset] = std::move(block);
+  ++size_;
+  return true;
 }
 
 boost::optional<std::shared_ptr<const shared_model::interface::Block>>
 InMemoryBlockStorage::fetch(
     shared_model::interface::types::HeightType height) const {
-  auto it = block_store_.find(height);
-  if (it != block_store_.end()) {
-    return it->second;
-  } else {
+  if (size_ == 0 or height < first_height_
+      or height - first_height_ >= blocks_.size()
+      or not blocks_[height - first_height_]) {
     return boost::none;
   }
+  return blocks_[height - first_height_];
 }
 
 size_t InMemoryBlockStorage::size() const {
-  return block_store_.size();
+  return size_;
 }
 
 void InMemoryBlockStorage::clear() {
-  block_store_.clear();
+  blocks_.clear();
+  size_ = 0;
 }
 
 void InMemoryBlockStorage::forEach(FunctionType function) const {
-  for (const auto &pair : block_store_) {
-    function(pair.second);
+  for (const auto &block : blocks_) {
+    if (block) {
+      function(block);
+    }
   }
 }
@@ -8,13 +8,16 @@
 
 #include "ametsuchi/block_storage.hpp"
 
-#include <map>
+#include <vector>
 
 namespace iroha {
   namespace ametsuchi {
 
     /**
-     * Ordered map implementation of block storage
+     * Block storage which keeps blocks in a contiguous array indexed by the
+     * offset of their height from the lowest stored height. Blocks are
+     * usually inserted at consecutive heights, so that a lookup is a single
+     * index and iteration follows the order of heights
      */
     class InMemoryBlockStorage : public BlockStorage {
      public:
@@ -31,9 +34,15 @@ namespace iroha {
       void forEach(FunctionType function) const override;
 
      private:
-      std::map<shared_model::interface::types::HeightType,
-               std::shared_ptr<const shared_model::interface::Block>>
-          block_store_;
+      /// height of the first slot, meaningful if the storage is not empty
+      shared_model::interface::types::HeightType first_height_{0};
+
+      /// blocks by offset of height, heights which are not inserted are null
+      std::vector<std::shared_ptr<const shared_model::interface::Block>>
+          blocks_;
+
+      /// number of inserted blocks
+      size_t size_{0};
     };
 
   }  // namespace ametsuchi
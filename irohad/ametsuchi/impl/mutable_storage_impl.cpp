@@ -6,6 +6,7 @@
 #include "ametsuchi/impl/mutable_storage_impl.hpp"
 
 #include <boost/variant/apply_visitor.hpp>
+#include "ametsuchi/impl/peer_query_ledger_state.hpp"
 #include "ametsuchi/impl/peer_query_wsv.hpp"
 #include "ametsuchi/impl/postgres_block_index.hpp"
 #include "ametsuchi/impl/postgres_indexer.hpp"
@@ -25,6 +26,7 @@ namespace iroha {
         std::shared_ptr<TransactionExecutor> transaction_executor,
         std::unique_ptr<soci::session> sql,
         std::unique_ptr<BlockStorage> block_storage,
+        std::shared_ptr<TxHashFilter> tx_filter,
         logger::LoggerManagerTreePtr log_manager)
         : ledger_state_(std::move(ledger_state)),
           sql_(std::move(sql)),
@@ -33,11 +35,18 @@ namespace iroha {
                   *sql_, log_manager->getChild("WsvQuery")->getLogger()))),
           block_index_(std::make_unique<PostgresBlockIndex>(
               std::make_unique<PostgresIndexer>(*sql_),
-              log_manager->getChild("PostgresBlockIndex")->getLogger())),
+              log_manager->getChild("PostgresBlockIndex")->getLogger(),
+              std::move(tx_filter))),
           transaction_executor_(std::move(transaction_executor)),
           block_storage_(std::move(block_storage)),
           committed(false),
-          log_(log_manager->getLogger()) {
+          log_(log_manager->getLogger()),
+          execution_time_metric_(metrics::registry().histogram(
+              "iroha_storage_execution_microseconds",
+              "Time spent executing the commands of applied blocks")),
+          indexing_time_metric_(metrics::registry().histogram(
+              "iroha_storage_indexing_microseconds",
+              "Time spent indexing the transactions of applied blocks")) {
       *sql_ << "BEGIN";
     }
 
@@ -54,15 +63,30 @@ namespace iroha {
                  block->hash().hex());
 
       auto block_applied =
-          (not ledger_state_ or predicate(block, *ledger_state_.value()))
-          and std::all_of(block->transactions().begin(),
-                          block->transactions().end(),
-                          execute_transaction);
+          (not ledger_state_ or predicate(block, *ledger_state_.value()));
+      if (block_applied) {
+        metrics::ScopedTimer timer(execution_time_metric_);
+        block_applied = std::all_of(block->transactions().begin(),
+                                    block->transactions().end(),
+                                    execute_transaction);
+        auto flushed = transaction_executor_->flush();
+        if (auto error = expected::resultToOptionalError(flushed)) {
+          log_->warn("Failed to apply block commands: {}", *error);
+          block_applied = false;
+        }
+      }
       if (block_applied) {
         block_storage_->insert(block);
-        block_index_->index(*block);
+        {
+          metrics::ScopedTimer timer(indexing_time_metric_);
+          block_index_->index(*block);
+        }
 
-        auto opt_ledger_peers = peer_query_->getLedgerPeers();
+        // peers are read from WSV only when the block changes them
+        auto opt_ledger_peers =
+            ledger_state_ and not changesLedgerPeers(*block)
+            ? boost::make_optional(ledger_state_.value()->ledger_peers)
+            : peer_query_->getLedgerPeers();
         if (not opt_ledger_peers) {
           log_->error("Failed to get ledger peers!");
           return false;
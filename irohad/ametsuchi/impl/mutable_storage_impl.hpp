@@ -10,9 +10,11 @@
 
 #include <soci/soci.h>
 #include "ametsuchi/block_storage.hpp"
+#include "ametsuchi/impl/tx_hash_filter.hpp"
 #include "interfaces/common_objects/types.hpp"
 #include "logger/logger_fwd.hpp"
 #include "logger/logger_manager_fwd.hpp"
+#include "metrics/metrics.hpp"
 
 namespace iroha {
   namespace ametsuchi {
@@ -30,6 +32,7 @@ namespace iroha {
           std::shared_ptr<TransactionExecutor> transaction_executor,
           std::unique_ptr<soci::session> sql,
           std::unique_ptr<BlockStorage> block_storage,
+          std::shared_ptr<TxHashFilter> tx_filter,
           logger::LoggerManagerTreePtr log_manager);
 
       bool apply(
@@ -71,6 +74,9 @@ namespace iroha {
       bool committed;
 
       logger::LoggerPtr log_;
+
+      metrics::Histogram &execution_time_metric_;
+      metrics::Histogram &indexing_time_metric_;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
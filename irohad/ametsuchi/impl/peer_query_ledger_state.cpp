@@ -0,0 +1,53 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/peer_query_ledger_state.hpp"
+
+#include <algorithm>
+
+#include "common/visitor.hpp"
+#include "interfaces/commands/add_peer.hpp"
+#include "interfaces/commands/command.hpp"
+#include "interfaces/commands/command_variant.hpp"
+#include "interfaces/commands/remove_peer.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/transaction.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    PeerQueryLedgerState::PeerQueryLedgerState(
+        std::shared_ptr<const LedgerState> ledger_state)
+        : ledger_state_(std::move(ledger_state)) {}
+
+    boost::optional<std::vector<PeerQuery::wPeer>>
+    PeerQueryLedgerState::getLedgerPeers() {
+      return ledger_state_->ledger_peers;
+    }
+
+    bool changesLedgerPeers(const shared_model::interface::Block &block) {
+      return std::any_of(
+          block.transactions().begin(),
+          block.transactions().end(),
+          [](const auto &tx) {
+            return std::any_of(
+                tx.commands().begin(),
+                tx.commands().end(),
+                [](const auto &command) {
+                  return iroha::visit_in_place(
+                      command.get(),
+                      [](const shared_model::interface::AddPeer &) {
+                        return true;
+                      },
+                      [](const shared_model::interface::RemovePeer &) {
+                        return true;
+                      },
+                      [](const auto &) { return false; });
+                });
+          });
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
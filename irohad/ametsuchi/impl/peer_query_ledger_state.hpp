@@ -0,0 +1,51 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PEER_QUERY_LEDGER_STATE_HPP
+#define IROHA_PEER_QUERY_LEDGER_STATE_HPP
+
+#include "ametsuchi/peer_query.hpp"
+
+#include "ametsuchi/ledger_state.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Implementation of PeerQuery interface based on the ledger state of a
+     * commit, which is shared by all the queries instead of reading peers
+     * from WSV
+     */
+    class PeerQueryLedgerState : public PeerQuery {
+     public:
+      explicit PeerQueryLedgerState(
+          std::shared_ptr<const LedgerState> ledger_state);
+
+      /**
+       * Fetch peers stored in ledger
+       * @return list of peers in insertion to ledger order
+       */
+      boost::optional<std::vector<wPeer>> getLedgerPeers() override;
+
+     private:
+      std::shared_ptr<const LedgerState> ledger_state_;
+    };
+
+    /**
+     * @param block - block to apply
+     * @return true if the block adds or removes peers, so ledger peers of the
+     * previous block are not valid after it
+     */
+    bool changesLedgerPeers(const shared_model::interface::Block &block);
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+#endif  // IROHA_PEER_QUERY_LEDGER_STATE_HPP
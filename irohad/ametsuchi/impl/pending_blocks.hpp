@@ -0,0 +1,74 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PENDING_BLOCKS_HPP
+#define IROHA_PENDING_BLOCKS_HPP
+
+#include <atomic>
+#include <memory>
+
+#include "ametsuchi/impl/in_memory_block_storage.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Blocks committed to WSV which are not written to the block store yet.
+     * Block queries read them from here, so that a block is served as soon
+     * as its WSV is committed. The blocks are replaced as a whole, readers
+     * keep the set they have taken
+     */
+    class PendingBlocks {
+     public:
+      using BlockPtr = std::shared_ptr<const shared_model::interface::Block>;
+
+      /**
+       * Publish committed blocks
+       * @param blocks - blocks which are written to the block store next
+       */
+      void set(std::shared_ptr<const InMemoryBlockStorage> blocks) {
+        auto snapshot = std::make_shared<Snapshot>();
+        blocks->forEach([&snapshot](const auto &block) {
+          snapshot->top_height = block->height();
+        });
+        snapshot->blocks = std::move(blocks);
+        std::atomic_store(&snapshot_,
+                          std::shared_ptr<const Snapshot>(std::move(snapshot)));
+      }
+
+      /// the published blocks are written to the block store
+      void reset() {
+        std::atomic_store(&snapshot_, std::shared_ptr<const Snapshot>());
+      }
+
+      /// @return the pending block with the given height, none if there is no
+      /// such block
+      boost::optional<BlockPtr> fetch(
+          shared_model::interface::types::HeightType height) const {
+        if (auto snapshot = std::atomic_load(&snapshot_)) {
+          return snapshot->blocks->fetch(height);
+        }
+        return boost::none;
+      }
+
+      /// @return height of the top pending block, 0 if there is none
+      shared_model::interface::types::HeightType topHeight() const {
+        auto snapshot = std::atomic_load(&snapshot_);
+        return snapshot ? snapshot->top_height : 0;
+      }
+
+     private:
+      struct Snapshot {
+        std::shared_ptr<const InMemoryBlockStorage> blocks;
+        shared_model::interface::types::HeightType top_height{0};
+      };
+
+      std::shared_ptr<const Snapshot> snapshot_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_PENDING_BLOCKS_HPP
@@ -13,7 +13,13 @@ using namespace iroha::ametsuchi;
 PoolWrapper::PoolWrapper(
     std::shared_ptr<soci::connection_pool> connection_pool,
     std::unique_ptr<FailoverCallbackHolder> failover_callback_holder,
-    bool enable_prepared_transactions)
+    bool enable_prepared_transactions,
+    std::vector<std::shared_ptr<soci::connection_pool>> replica_pools,
+    std::shared_ptr<soci::connection_pool> commit_pool,
+    std::shared_ptr<soci::connection_pool> validation_pool)
     : connection_pool_(std::move(connection_pool)),
       failover_callback_holder_(std::move(failover_callback_holder)),
-      enable_prepared_transactions_(enable_prepared_transactions) {}
+      enable_prepared_transactions_(enable_prepared_transactions),
+      replica_pools_(std::move(replica_pools)),
+      commit_pool_(std::move(commit_pool)),
+      validation_pool_(std::move(validation_pool)) {}
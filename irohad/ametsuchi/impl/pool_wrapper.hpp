@@ -7,6 +7,7 @@
 #define IROHA_POOL_WRAPPER_HPP
 
 #include <memory>
+#include <vector>
 
 namespace soci {
   class connection_pool;
@@ -20,11 +21,21 @@ namespace iroha {
       PoolWrapper(
           std::shared_ptr<soci::connection_pool> connection_pool,
           std::unique_ptr<FailoverCallbackHolder> failover_callback_holder,
-          bool enable_prepared_transactions);
+          bool enable_prepared_transactions,
+          std::vector<std::shared_ptr<soci::connection_pool>> replica_pools =
+              {},
+          std::shared_ptr<soci::connection_pool> commit_pool = nullptr,
+          std::shared_ptr<soci::connection_pool> validation_pool = nullptr);
 
       std::shared_ptr<soci::connection_pool> connection_pool_;
       std::unique_ptr<FailoverCallbackHolder> failover_callback_holder_;
       bool enable_prepared_transactions_;
+      /// pools of read-only replicas, used for queries
+      std::vector<std::shared_ptr<soci::connection_pool>> replica_pools_;
+      /// connections reserved for block commit, or nullptr if none are
+      std::shared_ptr<soci::connection_pool> commit_pool_;
+      /// connections reserved for stateful validation, or nullptr if none are
+      std::shared_ptr<soci::connection_pool> validation_pool_;
     };
 
   }  // namespace ametsuchi
@@ -61,8 +61,11 @@ void PostgresBlockIndex::makeAccountAssetIndex(
 }
 
 PostgresBlockIndex::PostgresBlockIndex(std::unique_ptr<Indexer> indexer,
-                                       logger::LoggerPtr log)
-    : indexer_(std::move(indexer)), log_(std::move(log)) {}
+                                       logger::LoggerPtr log,
+                                       std::shared_ptr<TxHashFilter> tx_filter)
+    : indexer_(std::move(indexer)),
+      log_(std::move(log)),
+      tx_filter_(std::move(tx_filter)) {}
 
 void PostgresBlockIndex::index(const shared_model::interface::Block &block) {
   auto height = block.height();
@@ -74,12 +77,20 @@ void PostgresBlockIndex::index(const shared_model::interface::Block &block) {
     indexer_->txHashPosition(tx.value().hash(), position);
     indexer_->committedTxHash(tx.value().hash());
     indexer_->txPositionByCreator(creator_id, position);
+    if (tx_filter_) {
+      tx_filter_->insert(tx.value().hash());
+    }
   }
 
   for (const auto &rejected_tx_hash : block.rejected_transactions_hashes()) {
     indexer_->rejectedTxHash(rejected_tx_hash);
+    if (tx_filter_) {
+      tx_filter_->insert(rejected_tx_hash);
+    }
   }
 
+  indexer_->topBlock(height, block.hash());
+
   if (auto e = resultToOptionalError(indexer_->flush())) {
     log_->error(e.value());
   }
@@ -8,6 +8,7 @@
 
 #include "ametsuchi/impl/block_index.hpp"
 
+#include "ametsuchi/impl/tx_hash_filter.hpp"
 #include "ametsuchi/indexer.hpp"
 #include "interfaces/transaction.hpp"
 #include "logger/logger_fwd.hpp"
@@ -29,8 +30,15 @@ namespace iroha {
      */
     class PostgresBlockIndex : public BlockIndex {
      public:
+      /**
+       * @param indexer - storage of indices
+       * @param log - logger
+       * @param tx_filter - filter of stored transaction hashes which is
+       * updated with hashes of indexed blocks, may be null
+       */
       PostgresBlockIndex(std::unique_ptr<Indexer> indexer,
-                         logger::LoggerPtr log);
+                         logger::LoggerPtr log,
+                         std::shared_ptr<TxHashFilter> tx_filter = nullptr);
 
       /// Index a block.
       void index(const shared_model::interface::Block &block) override;
@@ -44,6 +52,7 @@ namespace iroha {
 
       std::unique_ptr<Indexer> indexer_;
       logger::LoggerPtr log_;
+      std::shared_ptr<TxHashFilter> tx_filter_;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
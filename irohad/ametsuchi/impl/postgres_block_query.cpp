@@ -5,9 +5,13 @@
 
 #include "ametsuchi/impl/postgres_block_query.hpp"
 
+#include <algorithm>
+#include <unordered_map>
+
+#include <soci/boost-tuple.h>
 #include <boost/format.hpp>
 #include "ametsuchi/impl/soci_utils.hpp"
-#include "common/byteutils.hpp"
+#include "backend/protobuf/proto_block_json_converter.hpp"
 #include "logger/logger.hpp"
 
 namespace iroha {
@@ -17,10 +21,16 @@ namespace iroha {
         KeyValueStorage &file_store,
         std::shared_ptr<shared_model::interface::BlockJsonDeserializer>
             converter,
-        logger::LoggerPtr log)
+        logger::LoggerPtr log,
+        std::shared_ptr<BlockCache> block_cache,
+        std::shared_ptr<const TxHashFilter> tx_filter,
+        std::shared_ptr<const PendingBlocks> pending_blocks)
         : sql_(sql),
           block_store_(file_store),
           converter_(std::move(converter)),
+          block_cache_(std::move(block_cache)),
+          tx_filter_(std::move(tx_filter)),
+          pending_blocks_(std::move(pending_blocks)),
           log_(std::move(log)) {}
 
     PostgresBlockQuery::PostgresBlockQuery(
@@ -28,23 +38,40 @@ namespace iroha {
         KeyValueStorage &file_store,
         std::shared_ptr<shared_model::interface::BlockJsonDeserializer>
             converter,
-        logger::LoggerPtr log)
+        logger::LoggerPtr log,
+        std::shared_ptr<BlockCache> block_cache,
+        std::shared_ptr<const TxHashFilter> tx_filter,
+        std::shared_ptr<const PendingBlocks> pending_blocks)
         : psql_(std::move(sql)),
           sql_(*psql_),
           block_store_(file_store),
           converter_(std::move(converter)),
+          block_cache_(std::move(block_cache)),
+          tx_filter_(std::move(tx_filter)),
+          pending_blocks_(std::move(pending_blocks)),
           log_(std::move(log)) {}
 
     BlockQuery::BlockResult PostgresBlockQuery::getBlock(
         shared_model::interface::types::HeightType height) {
-      auto serialized_block = block_store_.get(height);
+      if (pending_blocks_) {
+        if (auto block = pending_blocks_->fetch(height)) {
+          return expected::makeValue(std::move(*block));
+        }
+      }
+      if (block_cache_) {
+        if (auto block = block_cache_->find(height)) {
+          return expected::makeValue(std::move(block));
+        }
+      }
+      auto serialized_block = block_store_.getView(height);
       if (not serialized_block) {
         auto error =
             boost::format("Failed to retrieve block with height %d") % height;
         return expected::makeError(
             GetBlockError{GetBlockError::Code::kNoBlock, error.str()});
       }
-      return converter_->deserialize(bytesToString(*serialized_block))
+      return converter_
+          ->deserialize(serialized_block->charData(), serialized_block->size())
           .match([](auto &&val) -> BlockResult { return std::move(val.value); },
                  [](auto &&err) -> BlockResult {
                    return GetBlockError{GetBlockError::Code::kInternalError,
@@ -52,18 +79,44 @@ namespace iroha {
                  });
     }
 
+    boost::optional<std::string> PostgresBlockQuery::getSerializedBlock(
+        shared_model::interface::types::HeightType height) {
+      // pending blocks are not in the block store yet
+      if (pending_blocks_ and pending_blocks_->fetch(height)) {
+        return boost::none;
+      }
+      auto serialized_block = block_store_.getView(height);
+      if (not serialized_block
+          or not shared_model::proto::ProtoBlockJsonConverter::isBinary(
+                 serialized_block->charData(), serialized_block->size())) {
+        return boost::none;
+      }
+      return std::string(serialized_block->charData(),
+                         serialized_block->size());
+    }
+
     shared_model::interface::types::HeightType
     PostgresBlockQuery::getTopBlockHeight() {
-      return block_store_.last_id();
+      auto top_height = block_store_.last_id();
+      if (pending_blocks_) {
+        top_height = std::max(top_height, pending_blocks_->topHeight());
+      }
+      return top_height;
     }
 
     boost::optional<TxCacheStatusType> PostgresBlockQuery::checkTxPresence(
         const shared_model::crypto::Hash &hash) {
+      if (tx_filter_ and not tx_filter_->mayContain(hash)) {
+        return boost::make_optional<TxCacheStatusType>(
+            tx_cache_status_responses::Missing{hash});
+      }
+
       int res = -1;
       const auto &hash_str = hash.hex();
 
       try {
-        sql_ << "SELECT status FROM tx_status_by_hash WHERE hash = :hash",
+        sql_ << "SELECT status FROM tx_status_by_hash "
+                "WHERE hash = decode(:hash, 'hex')",
             soci::into(res), soci::use(hash_str);
       } catch (const std::exception &e) {
         log_->error("Failed to execute query: {}", e.what());
@@ -84,5 +137,109 @@ namespace iroha {
           tx_cache_status_responses::Missing{hash});
     }
 
+    boost::optional<std::vector<TxCacheStatusType>>
+    PostgresBlockQuery::checkTxsPresence(
+        const std::vector<shared_model::crypto::Hash> &hashes) {
+      std::vector<TxCacheStatusType> statuses;
+      statuses.reserve(hashes.size());
+
+      // hex representation contains no characters which have to be escaped
+      // in postgres array literal
+      std::string hashes_array = "{";
+      for (const auto &hash : hashes) {
+        if (not tx_filter_ or tx_filter_->mayContain(hash)) {
+          hashes_array += hash.hex();
+          hashes_array += ',';
+        }
+      }
+      if (hashes_array.size() == 1) {
+        // all hashes are definitely missing
+        for (const auto &hash : hashes) {
+          statuses.emplace_back(tx_cache_status_responses::Missing{hash});
+        }
+        return statuses;
+      }
+      hashes_array.back() = '}';
+
+      std::unordered_map<std::string, bool> committed;
+      try {
+        using T = boost::tuple<std::string, int>;
+        soci::rowset<T> rows =
+            (sql_.prepare
+                 << "SELECT encode(hash, 'hex'), status FROM tx_status_by_hash "
+                    "WHERE hash = ANY(ARRAY(SELECT decode(h, 'hex') "
+                    "FROM unnest(CAST(:hashes AS text[])) AS h))",
+             soci::use(hashes_array));
+        for (const auto &row : rows) {
+          committed.emplace(row.get<0>(), row.get<1>() > 0);
+        }
+      } catch (const std::exception &e) {
+        log_->error("Failed to execute query: {}", e.what());
+        return boost::none;
+      }
+
+      for (const auto &hash : hashes) {
+        auto it = committed.find(hash.hex());
+        if (it == committed.end()) {
+          statuses.emplace_back(tx_cache_status_responses::Missing{hash});
+        } else if (it->second) {
+          statuses.emplace_back(tx_cache_status_responses::Committed{hash});
+        } else {
+          statuses.emplace_back(tx_cache_status_responses::Rejected{hash});
+        }
+      }
+      return statuses;
+    }
+
+    boost::optional<std::vector<shared_model::interface::types::HeightType>>
+    PostgresBlockQuery::getAccountsBlockHeights(
+        const std::vector<shared_model::interface::types::AccountIdType>
+            &account_ids,
+        shared_model::interface::types::HeightType from,
+        size_t limit) {
+      // account ids come from clients, so every element of the array literal
+      // is quoted
+      std::string accounts_array = "{";
+      for (const auto &account_id : account_ids) {
+        accounts_array += '"';
+        for (auto c : account_id) {
+          if (c == '"' or c == '\\') {
+            accounts_array += '\\';
+          }
+          accounts_array += c;
+        }
+        accounts_array += "\",";
+      }
+      if (accounts_array.size() > 1) {
+        accounts_array.pop_back();
+      }
+      accounts_array += '}';
+
+      const auto query = (boost::format(R"(
+          WITH ids AS (
+            SELECT id FROM interned_id
+            WHERE name = ANY(CAST(:accounts AS text[]))
+          )
+          SELECT height FROM tx_position_by_creator
+          WHERE creator_id IN (SELECT id FROM ids) AND height >= %1%
+          UNION
+          SELECT height FROM position_by_account_asset
+          WHERE account_id IN (SELECT id FROM ids) AND height >= %1%
+          ORDER BY height LIMIT %2%)")
+                          % from % limit)
+                             .str();
+
+      std::vector<shared_model::interface::types::HeightType> heights;
+      try {
+        soci::rowset<shared_model::interface::types::HeightType> rows =
+            (sql_.prepare << query, soci::use(accounts_array));
+        heights.assign(rows.begin(), rows.end());
+      } catch (const std::exception &e) {
+        log_->error("Failed to execute query: {}", e.what());
+        return boost::none;
+      }
+      return heights;
+    }
+
   }  // namespace ametsuchi
 }  // namespace iroha
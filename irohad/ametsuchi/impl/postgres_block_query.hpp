@@ -10,6 +10,9 @@
 
 #include <soci/soci.h>
 #include <boost/optional.hpp>
+#include "ametsuchi/impl/block_cache.hpp"
+#include "ametsuchi/impl/pending_blocks.hpp"
+#include "ametsuchi/impl/tx_hash_filter.hpp"
 #include "ametsuchi/key_value_storage.hpp"
 #include "interfaces/iroha_internal/block_json_deserializer.hpp"
 #include "logger/logger_fwd.hpp"
@@ -27,23 +30,42 @@ namespace iroha {
           KeyValueStorage &file_store,
           std::shared_ptr<shared_model::interface::BlockJsonDeserializer>
               converter,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          std::shared_ptr<BlockCache> block_cache = nullptr,
+          std::shared_ptr<const TxHashFilter> tx_filter = nullptr,
+          std::shared_ptr<const PendingBlocks> pending_blocks = nullptr);
 
       PostgresBlockQuery(
           std::unique_ptr<soci::session> sql,
           KeyValueStorage &file_store,
           std::shared_ptr<shared_model::interface::BlockJsonDeserializer>
               converter,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          std::shared_ptr<BlockCache> block_cache = nullptr,
+          std::shared_ptr<const TxHashFilter> tx_filter = nullptr,
+          std::shared_ptr<const PendingBlocks> pending_blocks = nullptr);
 
       BlockResult getBlock(
           shared_model::interface::types::HeightType height) override;
 
+      boost::optional<std::string> getSerializedBlock(
+          shared_model::interface::types::HeightType height) override;
+
       shared_model::interface::types::HeightType getTopBlockHeight() override;
 
       boost::optional<TxCacheStatusType> checkTxPresence(
           const shared_model::crypto::Hash &hash) override;
 
+      boost::optional<std::vector<TxCacheStatusType>> checkTxsPresence(
+          const std::vector<shared_model::crypto::Hash> &hashes) override;
+
+      boost::optional<std::vector<shared_model::interface::types::HeightType>>
+      getAccountsBlockHeights(
+          const std::vector<shared_model::interface::types::AccountIdType>
+              &account_ids,
+          shared_model::interface::types::HeightType from,
+          size_t limit) override;
+
      private:
       std::unique_ptr<soci::session> psql_;
       soci::session &sql_;
@@ -52,6 +74,15 @@ namespace iroha {
       std::shared_ptr<shared_model::interface::BlockJsonDeserializer>
           converter_;
 
+      /// recently committed blocks, may be null
+      std::shared_ptr<BlockCache> block_cache_;
+
+      /// filter of stored transaction hashes, may be null
+      std::shared_ptr<const TxHashFilter> tx_filter_;
+
+      /// committed blocks which are not in the block store yet, may be null
+      std::shared_ptr<const PendingBlocks> pending_blocks_;
+
       logger::LoggerPtr log_;
     };
   }  // namespace ametsuchi
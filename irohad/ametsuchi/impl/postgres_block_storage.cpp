@@ -44,12 +44,13 @@ bool PostgresBlockStorage::insert(
     return false;
   }
 
+  const auto block_data = block->blob().hex();
   soci::statement st =
       (sql_.prepare << "INSERT INTO blocks(height, block_data) VALUES(:height, "
                        ":block_data)",
        soci::use(block->height()),
-       soci::use(block->blob().hex()));
-  log_->debug("insert: {}", block->blob().hex());
+       soci::use(block_data));
+  log_->debug("insert: {}", block_data);
   try {
     st.execute(true);
     return true;
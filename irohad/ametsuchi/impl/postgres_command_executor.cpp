@@ -79,13 +79,20 @@ namespace {
     sql << queries.second;
   }
 
+  /**
+   * @param query_args - callable to get a string representation of query
+   * arguments, it is called only when the message of the error is read, so it
+   * must own the arguments
+   */
   template <typename QueryArgsCallable>
   iroha::expected::Error<iroha::ametsuchi::CommandError> makeCommandError(
       std::string &&command_name,
       const iroha::ametsuchi::CommandError::ErrorCodeType code,
       QueryArgsCallable &&query_args) noexcept {
     return iroha::expected::makeError(iroha::ametsuchi::CommandError{
-        std::move(command_name), code, query_args()});
+        std::move(command_name),
+        code,
+        std::forward<QueryArgsCallable>(query_args)});
   }
 
   /// mapping between pairs of SQL error substrings and related fake error
@@ -194,7 +201,7 @@ namespace {
     }
     // parsing is not successful, return the general error
     return makeCommandError(std::move(command_name),
-                            1,
+                            iroha::ametsuchi::CommandError::kInternalError,
                             std::forward<QueryArgsCallable>(query_args));
   }
 
@@ -218,6 +225,7 @@ namespace {
       QueryArgsCallable &&query_args) noexcept {
     uint32_t result;
     try {
+      iroha::ametsuchi::TimedStatement statement(command_name);
       sql << cmd, soci::into(result);
       if (result != 0) {
         return makeCommandError(std::move(command_name),
@@ -275,6 +283,13 @@ namespace {
     return res.at(1);
   }
 
+  shared_model::interface::types::DomainIdType getDomainFromAssetId(
+      const shared_model::interface::types::AssetIdType &asset_id) {
+    std::vector<std::string> res;
+    boost::split(res, asset_id, boost::is_any_of("#"));
+    return res.at(1);
+  }
+
   /**
    * Generate an SQL subquery which checks if creator has corresponding
    * permissions for target account
@@ -380,14 +395,198 @@ namespace {
         .str();
   }
 
-  template <typename Format>
-  void appendCommandName(const std::string &name,
-                         Format &cmd,
-                         bool do_validation) {
-    auto command_name = name
-        + (do_validation ? PreparedStatement::validationPrefix
-                         : PreparedStatement::noValidationPrefix);
-    cmd % command_name;
+  /**
+   * Name of the prepared statement of a command, specialized for every
+   * command, so that the statement is selected at compile time
+   */
+  template <typename Command>
+  struct CommandStatement;
+
+  template <>
+  struct CommandStatement<shared_model::interface::AddAssetQuantity> {
+    static const char *name() {
+      return "addAssetQuantity";
+    }
+  };
+
+  template <>
+  struct CommandStatement<shared_model::interface::AddPeer> {
+    static const char *name() {
+      return "addPeer";
+    }
+  };
+
+  template <>
+  struct CommandStatement<shared_model::interface::AddSignatory> {
+    static const char *name() {
+      return "addSignatory";
+    }
+  };
+
+  template <>
+  struct CommandStatement<shared_model::interface::AppendRole> {
+    static const char *name() {
+      return "appendRole";
+    }
+  };
+
+  template <>
+  struct CommandStatement<shared_model::interface::CreateAccount> {
+    static const char *name() {
+      return "createAccount";
+    }
+  };
+
+  template <>
+  struct CommandStatement<shared_model::interface::CreateAsset> {
+    static const char *name() {
+      return "createAsset";
+    }
+  };
+
+  template <>
+  struct CommandStatement<shared_model::interface::CreateDomain> {
+    static const char *name() {
+      return "createDomain";
+    }
+  };
+
+  template <>
+  struct CommandStatement<shared_model::interface::CreateRole> {
+    static const char *name() {
+      return "createRole";
+    }
+  };
+
+  template <>
+  struct CommandStatement<shared_model::interface::DetachRole> {
+    static const char *name() {
+      return "detachRole";
+    }
+  };
+
+  template <>
+  struct CommandStatement<shared_model::interface::GrantPermission> {
+    static const char *name() {
+      return "grantPermission";
+    }
+  };
+
+  template <>
+  struct CommandStatement<shared_model::interface::RemovePeer> {
+    static const char *name() {
+      return "removePeer";
+    }
+  };
+
+  template <>
+  struct CommandStatement<shared_model::interface::RemoveSignatory> {
+    static const char *name() {
+      return "removeSignatory";
+    }
+  };
+
+  template <>
+  struct CommandStatement<shared_model::interface::RevokePermission> {
+    static const char *name() {
+      return "revokePermission";
+    }
+  };
+
+  template <>
+  struct CommandStatement<shared_model::interface::SetAccountDetail> {
+    static const char *name() {
+      return "setAccountDetail";
+    }
+  };
+
+  template <>
+  struct CommandStatement<shared_model::interface::SetQuorum> {
+    static const char *name() {
+      return "setQuorum";
+    }
+  };
+
+  template <>
+  struct CommandStatement<shared_model::interface::SubtractAssetQuantity> {
+    static const char *name() {
+      return "subtractAssetQuantity";
+    }
+  };
+
+  template <>
+  struct CommandStatement<shared_model::interface::TransferAsset> {
+    static const char *name() {
+      return "transferAsset";
+    }
+  };
+
+  template <>
+  struct CommandStatement<shared_model::interface::CompareAndSetAccountDetail> {
+    static const char *name() {
+      return "compareAndSetAccountDetail";
+    }
+  };
+
+  /**
+   * Builds EXECUTE of a prepared statement by appending its arguments, so
+   * that no format string is parsed for every executed command
+   */
+  class ExecuteStatement {
+   public:
+    explicit ExecuteStatement(const std::string &execute)
+        : statement_(execute) {}
+
+    /// Append an argument as a string literal
+    ExecuteStatement &quoted(const std::string &value) {
+      next().append("'").append(value).append("'");
+      return *this;
+    }
+
+    /// Append an argument as bytes given by their hex representation
+    ExecuteStatement &hex(const std::string &value) {
+      next().append("decode('").append(value).append("', 'hex')");
+      return *this;
+    }
+
+    /// Append an argument as it is, for numbers and SQL expressions
+    ExecuteStatement &unquoted(const std::string &value) {
+      next().append(value);
+      return *this;
+    }
+
+    std::string str() {
+      statement_.append(")");
+      return std::move(statement_);
+    }
+
+   private:
+    std::string &next() {
+      if (has_args_) {
+        statement_.append(", ");
+      }
+      has_args_ = true;
+      return statement_;
+    }
+
+    std::string statement_;
+    bool has_args_ = false;
+  };
+
+  /**
+   * @return builder of EXECUTE of the prepared statement of the command,
+   * beginnings of both statements of a command are built once
+   */
+  template <typename Command>
+  ExecuteStatement executeStatement(const Command &, bool do_validation) {
+    static const std::string with_validation = std::string("EXECUTE ")
+        + CommandStatement<Command>::name()
+        + PreparedStatement::validationPrefix + " (";
+    static const std::string without_validation = std::string("EXECUTE ")
+        + CommandStatement<Command>::name()
+        + PreparedStatement::noValidationPrefix + " (";
+    return ExecuteStatement(do_validation ? with_validation
+                                          : without_validation);
   }
 
   /**
@@ -447,7 +646,7 @@ namespace iroha {
           END AS result;)";
 
     const std::string PostgresCommandExecutor::addPeerBase = R"(
-          PREPARE %s (text, text, text) AS
+          PREPARE %s (text, bytea, text) AS
           WITH
           %s
           inserted AS (
@@ -462,7 +661,7 @@ namespace iroha {
               ELSE 1 END AS result)";
 
     const std::string PostgresCommandExecutor::addSignatoryBase = R"(
-          PREPARE %s (text, text, text) AS
+          PREPARE %s (text, text, bytea) AS
           WITH %s
           insert_signatory AS
           (
@@ -504,7 +703,7 @@ namespace iroha {
             END AS result)";
 
     const std::string PostgresCommandExecutor::createAccountBase = R"(
-          PREPARE %s (text, text, text, text) AS
+          PREPARE %s (text, text, text, bytea) AS
           WITH get_domain_default_role AS (SELECT default_role FROM domain
                                            WHERE domain_id = $3),
           %s
@@ -519,9 +718,9 @@ namespace iroha {
           has_signatory AS (SELECT * FROM signatory WHERE public_key = $4),
           insert_account AS
           (
-              INSERT INTO account(account_id, domain_id, quorum, data)
+              INSERT INTO account(account_id, domain_id, quorum)
               (
-                  SELECT $2, $3, 1, '{}' WHERE (EXISTS
+                  SELECT $2, $3, 1 WHERE (EXISTS
                       (SELECT * FROM insert_signatory) OR EXISTS
                       (SELECT * FROM has_signatory)
                   ) AND EXISTS (SELECT * FROM get_domain_default_role)
@@ -642,7 +841,7 @@ namespace iroha {
               ELSE 1 END AS result)";
 
     const std::string PostgresCommandExecutor::removePeerBase = R"(
-          PREPARE %s (text, text) AS
+          PREPARE %s (text, bytea) AS
           WITH
           %s
           removed AS (
@@ -655,7 +854,7 @@ namespace iroha {
               ELSE 1 END AS result)";
 
     const std::string PostgresCommandExecutor::removeSignatoryBase = R"(
-          PREPARE %s (text, text, text) AS
+          PREPARE %s (text, text, bytea) AS
           WITH
           %s
           delete_account_signatory AS (DELETE FROM account_has_signatory
@@ -707,10 +906,13 @@ namespace iroha {
           WITH %s
               inserted AS
               (
-                  UPDATE account SET data = jsonb_set(
-                  CASE WHEN data ?$1 THEN data ELSE
-                  jsonb_set(data, array[$1], '{}') END,
-                  array[$1, $3], $4::jsonb) WHERE account_id=$2 %s
+                  INSERT INTO account_has_detail(account_id, writer, key, value)
+                  (
+                      SELECT $2, $1, $3, $4::jsonb WHERE EXISTS
+                      (SELECT * FROM account WHERE account_id = $2) %s
+                  )
+                  ON CONFLICT (account_id, writer, key)
+                  DO UPDATE SET value = excluded.value
                   RETURNING (1)
               )
               SELECT CASE WHEN EXISTS (SELECT * FROM inserted) THEN 0
@@ -847,9 +1049,44 @@ namespace iroha {
               ELSE (SELECT code FROM checks WHERE not result LIMIT 1)
           END AS result)";
 
+    // changes are netted per account and asset, so that every balance is
+    // updated once; error codes are the ones of TransferAsset
+    const std::string PostgresCommandExecutor::assetQuantityDeltasBase = R"(
+          WITH deltas AS (
+                  SELECT account_id, asset_id, sum(delta) AS delta,
+                      max(delta_precision) AS delta_precision
+                  FROM (VALUES %s)
+                      AS d(account_id, asset_id, delta, delta_precision)
+                  GROUP BY account_id, asset_id
+              ),
+              updated AS (
+                  INSERT INTO account_has_asset(account_id, asset_id, amount)
+                  SELECT account_id, asset_id, delta FROM deltas
+                  ON CONFLICT (account_id, asset_id)
+                  DO UPDATE
+                  SET amount = account_has_asset.amount + EXCLUDED.amount
+                  RETURNING asset_id, amount
+              )
+          SELECT CASE
+              WHEN EXISTS (SELECT * FROM deltas JOIN asset USING (asset_id)
+                           WHERE delta_precision > precision) THEN 5
+              WHEN EXISTS (SELECT * FROM updated WHERE amount < 0) THEN 6
+              WHEN EXISTS (SELECT * FROM updated JOIN asset USING (asset_id)
+                           WHERE amount >= (2::decimal ^ 256)
+                               / (10::decimal ^ precision))
+                  THEN 7
+              ELSE 0
+          END AS result)";
+
     const std::string PostgresCommandExecutor::compareAndSetAccountDetailBase =
         R"(PREPARE %s (text, text, text, text, text, text, text) AS
           WITH %s
+              old_detail AS
+              (
+                  SELECT value
+                  FROM account_has_detail
+                  WHERE account_id = $2 AND writer = $1 AND key = $3
+              ),
               old_value AS
               (
                   SELECT *
@@ -857,10 +1094,11 @@ namespace iroha {
                   WHERE
                     account_id = $2
                     AND CASE
-                      WHEN data ? $1 AND data->$1 ?$3
+                      WHEN EXISTS (SELECT * FROM old_detail)
                         THEN
                           CASE
-                            WHEN $5 IS NOT NULL THEN data->$1->$3 = $5::jsonb
+                            WHEN $5 IS NOT NULL THEN
+                              (SELECT value FROM old_detail) = $5::jsonb
                             ELSE FALSE
                           END
                       ELSE TRUE
@@ -868,18 +1106,15 @@ namespace iroha {
               ),
               inserted AS
               (
-                  UPDATE account
-                  SET data = jsonb_set(
-                    CASE
-                      WHEN data ? $1 THEN data
-                      ELSE jsonb_set(data, array[$1], '{}')
-                    END,
-                    array[$1, $3], $4::jsonb
+                  INSERT INTO account_has_detail(account_id, writer, key, value)
+                  (
+                      SELECT $2, $1, $3, $4::jsonb
+                      WHERE
+                        EXISTS (SELECT * FROM old_value)
+                        %s
                   )
-                  WHERE
-                    EXISTS (SELECT * FROM old_value)
-                    AND account_id = $2
-                    %s
+                  ON CONFLICT (account_id, writer, key)
+                  DO UPDATE SET value = excluded.value
                   RETURNING (1)
               )
               SELECT CASE
@@ -892,10 +1127,12 @@ namespace iroha {
                 END
               AS result)";
 
+    constexpr CommandError::ErrorCodeType CommandError::kInternalError;
+    constexpr CommandError::ErrorCodeType CommandError::kNoPermissions;
+
     std::string CommandError::toString() const {
-      return (boost::format("%s: %d with extra info '%s'") % command_name
-              % error_code % error_extra)
-          .str();
+      return command_name + ": " + std::to_string(error_code)
+          + " with extra info '" + error_extra.str() + "'";
     }
 
     PostgresCommandExecutor::PostgresCommandExecutor(
@@ -904,6 +1141,8 @@ namespace iroha {
             perm_converter)
         : sql_(sql),
           do_validation_(true),
+          defer_execution_(false),
+          aggregate_asset_quantities_(false),
           perm_converter_{std::move(perm_converter)} {}
 
     void PostgresCommandExecutor::setCreatorAccountId(
@@ -916,6 +1155,166 @@ namespace iroha {
       do_validation_ = do_validation;
     }
 
+    void PostgresCommandExecutor::deferExecution(bool defer_execution) {
+      defer_execution_ = defer_execution;
+    }
+
+    void PostgresCommandExecutor::aggregateAssetQuantities(
+        bool aggregate_asset_quantities) {
+      aggregate_asset_quantities_ = aggregate_asset_quantities;
+    }
+
+    CommandResult PostgresCommandExecutor::flush() {
+      // aggregated changes follow the deferred commands, which may create
+      // the accounts and assets
+      if (not asset_quantity_deltas_.empty()) {
+        deferred_commands_.push_back(DeferredCommand{
+            (boost::format(assetQuantityDeltasBase) % asset_quantity_deltas_)
+                .str(),
+            "AssetQuantityDeltas"});
+        asset_quantity_deltas_.clear();
+      }
+      if (deferred_commands_.empty()) {
+        return {};
+      }
+      auto commands = std::move(deferred_commands_);
+      deferred_commands_.clear();
+
+      std::string statements;
+      for (const auto &command : commands) {
+        statements.append(command.statement).append(";\n");
+      }
+      auto statement_args = [](const DeferredCommand &command) {
+        return [statement = command.statement] {
+          return "statement: " + statement;
+        };
+      };
+
+      // all statements are sent at once, and the server returns a separate
+      // result for every statement, stopping at the first exception. The
+      // results arrive as the statements finish, so the time between them is
+      // the time of every statement
+      boost::optional<TimedStatement> timed_statement;
+      timed_statement.emplace(commands.front().command_name);
+      auto connection =
+          static_cast<soci::postgresql_session_backend *>(sql_.get_backend())
+              ->conn_;
+      if (PQsendQuery(connection, statements.c_str()) == 0) {
+        return getCommandError(std::string{commands.front().command_name},
+                               PQerrorMessage(connection),
+                               statement_args(commands.front()));
+      }
+
+      CommandResult result;
+      size_t index = 0;
+      while (auto pg_result = PQgetResult(connection)) {
+        std::unique_ptr<PGresult, decltype(&PQclear)> guard(pg_result,
+                                                            &PQclear);
+        timed_statement = boost::none;
+        // all results must be read before the connection is used again
+        if (index >= commands.size() or expected::hasError(result)) {
+          continue;
+        }
+        const auto &command = commands[index++];
+        if (PQresultStatus(pg_result) != PGRES_TUPLES_OK) {
+          result = getCommandError(std::string{command.command_name},
+                                   PQresultErrorMessage(pg_result),
+                                   statement_args(command));
+        } else if (PQntuples(pg_result) > 0) {
+          auto code = std::stoul(PQgetvalue(pg_result, 0, 0));
+          if (code != 0) {
+            result = makeCommandError(std::string{command.command_name},
+                                      code,
+                                      statement_args(command));
+          }
+        }
+        if (index < commands.size() and not expected::hasError(result)) {
+          timed_statement.emplace(commands[index].command_name);
+        }
+      }
+      return result;
+    }
+
+    template <typename QueryArgsCallable>
+    CommandResult PostgresCommandExecutor::executeCommand(
+        std::string cmd,
+        std::string command_name,
+        QueryArgsCallable &&query_args) {
+      if (defer_execution_ and not do_validation_) {
+        deferred_commands_.push_back(
+            DeferredCommand{std::move(cmd), std::move(command_name)});
+        return {};
+      }
+      return executeQuery(sql_,
+                          cmd,
+                          std::move(command_name),
+                          std::forward<QueryArgsCallable>(query_args));
+    }
+
+    bool PostgresCommandExecutor::aggregatesAssetQuantities() const {
+      return aggregate_asset_quantities_ and defer_execution_
+          and not do_validation_;
+    }
+
+    void PostgresCommandExecutor::addAssetQuantityDelta(
+        const shared_model::interface::types::AccountIdType &account_id,
+        const shared_model::interface::types::AssetIdType &asset_id,
+        const std::string &delta,
+        int precision) {
+      if (not asset_quantity_deltas_.empty()) {
+        asset_quantity_deltas_.append(", ");
+      }
+      asset_quantity_deltas_.append("('")
+          .append(account_id)
+          .append("', '")
+          .append(asset_id)
+          .append("', ")
+          .append(delta)
+          .append("::decimal, ")
+          .append(std::to_string(precision))
+          .append(")");
+    }
+
+    bool PostgresCommandExecutor::lacksRolePermissions(
+        const shared_model::interface::types::AccountIdType &account_id,
+        const shared_model::interface::RolePermissionSet &permissions) {
+      if (accounts_with_changed_roles_.count(account_id) != 0) {
+        return false;
+      }
+
+      auto cached = role_permissions_cache_.find(account_id);
+      if (cached == role_permissions_cache_.end()) {
+        std::string account_permissions;
+        try {
+          sql_ << (boost::format(R"(
+                  SELECT COALESCE(bit_or(rp.permission), '0'::bit(%1%))
+                  FROM role_has_permissions AS rp
+                  JOIN account_has_roles AS ar ON ar.role_id = rp.role_id
+                  WHERE ar.account_id = :account_id)")
+                   % shared_model::interface::RolePermissionSet::size())
+                      .str(),
+              soci::into(account_permissions),
+              soci::use(account_id, "account_id");
+        } catch (const std::exception &) {
+          // the command itself will report the error
+          return false;
+        }
+        cached =
+            role_permissions_cache_
+                .emplace(account_id,
+                         shared_model::interface::RolePermissionSet(
+                             account_permissions))
+                .first;
+      }
+      return not permissions.isSubsetOf(cached->second);
+    }
+
+    void PostgresCommandExecutor::invalidateRolePermissions(
+        const shared_model::interface::types::AccountIdType &account_id) {
+      role_permissions_cache_.erase(account_id);
+      accounts_with_changed_roles_.insert(account_id);
+    }
+
     CommandResult PostgresCommandExecutor::operator()(
         const shared_model::interface::AddAssetQuantity &command) {
       auto &account_id = creator_account_id_;
@@ -923,14 +1322,19 @@ namespace iroha {
       auto amount = command.amount().toStringRepr();
       int precision = command.amount().precision();
 
-      // 14.09.2018 nickaleks: IR-1707 move common logic to separate function
-      auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%', %4%, '%5%')");
-
-      appendCommandName("addAssetQuantity", cmd, do_validation_);
+      if (aggregatesAssetQuantities()) {
+        addAssetQuantityDelta(account_id, asset_id, amount, precision);
+        return {};
+      }
 
-      cmd = (cmd % account_id % asset_id % precision % amount);
+      auto cmd = executeStatement(command, do_validation_)
+                 .quoted(account_id)
+                 .quoted(asset_id)
+                 .unquoted(std::to_string(precision))
+                 .quoted(amount)
+                 .str();
 
-      auto str_args = [&account_id, &asset_id, &amount, precision] {
+      auto str_args = [account_id, asset_id, amount, precision] {
         return getQueryArgsStringBuilder()
             .append("account_id", account_id)
             .append("asset_id", asset_id)
@@ -939,84 +1343,116 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(
-          sql_, cmd.str(), "AddAssetQuantity", std::move(str_args));
+      if (do_validation_
+          and lacksRolePermissions(
+                  account_id,
+                  {shared_model::interface::permissions::Role::kAddAssetQty})
+          and (getDomainFromName(account_id) != getDomainFromAssetId(asset_id)
+               or lacksRolePermissions(
+                      account_id,
+                      {shared_model::interface::permissions::Role::
+                           kAddDomainAssetQty}))) {
+        return makeCommandError("AddAssetQuantity",
+                                CommandError::kNoPermissions,
+                                std::move(str_args));
+      }
+
+      return executeCommand(
+          std::move(cmd), "AddAssetQuantity", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
         const shared_model::interface::AddPeer &command) {
       auto &peer = command.peer();
 
-      auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%', '%4%')");
-
-      appendCommandName("addPeer", cmd, do_validation_);
+      auto cmd = executeStatement(command, do_validation_)
+                 .quoted(creator_account_id_)
+                 .hex(peer.pubkey().hex())
+                 .quoted(peer.address())
+                 .str();
 
-      cmd = (cmd % creator_account_id_ % peer.pubkey().hex() % peer.address());
-
-      auto str_args = [&peer] {
+      auto str_args = [address = peer.address(), pubkey = peer.pubkey()] {
         return getQueryArgsStringBuilder()
-            .append("peer", peer.toString())
+            .append("peer",
+                    shared_model::detail::PrettyStringBuilder()
+                        .init("Peer")
+                        .append("address", address)
+                        .append("pubkey", pubkey.toString())
+                        .finalize())
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "AddPeer", std::move(str_args));
+      if (do_validation_
+          and lacksRolePermissions(
+                  creator_account_id_,
+                  {shared_model::interface::permissions::Role::kAddPeer})) {
+        return makeCommandError("AddPeer",
+                                CommandError::kNoPermissions,
+                                std::move(str_args));
+      }
+
+      return executeCommand(std::move(cmd), "AddPeer", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
         const shared_model::interface::AddSignatory &command) {
       auto &account_id = command.accountId();
       auto pubkey = command.pubkey().hex();
-      auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%', '%4%')");
+      auto cmd = executeStatement(command, do_validation_)
+                 .quoted(creator_account_id_)
+                 .quoted(account_id)
+                 .hex(pubkey)
+                 .str();
 
-      appendCommandName("addSignatory", cmd, do_validation_);
-
-      cmd = (cmd % creator_account_id_ % account_id % pubkey);
-
-      auto str_args = [&account_id, &pubkey] {
+      auto str_args = [account_id, pubkey] {
         return getQueryArgsStringBuilder()
             .append("account_id", account_id)
             .append("pubkey", pubkey)
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "AddSignatory", std::move(str_args));
+      return executeCommand(
+          std::move(cmd), "AddSignatory", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
         const shared_model::interface::AppendRole &command) {
       auto &account_id = command.accountId();
       auto &role_name = command.roleName();
-      auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%', '%4%')");
-
-      appendCommandName("appendRole", cmd, do_validation_);
+      auto cmd = executeStatement(command, do_validation_)
+                 .quoted(creator_account_id_)
+                 .quoted(account_id)
+                 .quoted(role_name)
+                 .str();
 
-      cmd = (cmd % creator_account_id_ % account_id % role_name);
-
-      auto str_args = [&account_id, &role_name] {
+      auto str_args = [account_id, role_name] {
         return getQueryArgsStringBuilder()
             .append("account_id", account_id)
             .append("role_name", role_name)
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "AppendRole", std::move(str_args));
+      invalidateRolePermissions(account_id);
+
+      return executeCommand(std::move(cmd), "AppendRole", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
         const shared_model::interface::CreateAccount &command) {
       auto &account_name = command.accountName();
       auto &domain_id = command.domainId();
-      auto &pubkey = command.pubkey().hex();
+      auto pubkey = command.pubkey().hex();
       shared_model::interface::types::AccountIdType account_id =
           account_name + "@" + domain_id;
 
-      auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%', '%4%', '%5%')");
+      auto cmd = executeStatement(command, do_validation_)
+                 .quoted(creator_account_id_)
+                 .quoted(account_id)
+                 .quoted(domain_id)
+                 .hex(pubkey)
+                 .str();
 
-      appendCommandName("createAccount", cmd, do_validation_);
-
-      cmd = (cmd % creator_account_id_ % account_id % domain_id % pubkey);
-
-      auto str_args = [&account_id, &domain_id, &pubkey] {
+      auto str_args = [account_id, domain_id, pubkey] {
         return getQueryArgsStringBuilder()
             .append("account_id", account_id)
             .append("domain_id", domain_id)
@@ -1024,8 +1460,10 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(
-          sql_, cmd.str(), "CreateAccount", std::move(str_args));
+      invalidateRolePermissions(account_id);
+
+      return executeCommand(
+          std::move(cmd), "CreateAccount", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -1033,13 +1471,14 @@ namespace iroha {
       auto &domain_id = command.domainId();
       auto asset_id = command.assetName() + "#" + domain_id;
       int precision = command.precision();
-      auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%', '%4%', %5%)");
-
-      appendCommandName("createAsset", cmd, do_validation_);
-
-      cmd = (cmd % creator_account_id_ % asset_id % domain_id % precision);
-
-      auto str_args = [&domain_id, &asset_id, precision] {
+      auto cmd = executeStatement(command, do_validation_)
+                 .quoted(creator_account_id_)
+                 .quoted(asset_id)
+                 .quoted(domain_id)
+                 .unquoted(std::to_string(precision))
+                 .str();
+
+      auto str_args = [domain_id, asset_id, precision] {
         return getQueryArgsStringBuilder()
             .append("domain_id", domain_id)
             .append("asset_id", asset_id)
@@ -1047,27 +1486,46 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "CreateAsset", std::move(str_args));
+      if (do_validation_
+          and lacksRolePermissions(
+                  creator_account_id_,
+                  {shared_model::interface::permissions::Role::kCreateAsset})) {
+        return makeCommandError("CreateAsset",
+                                CommandError::kNoPermissions,
+                                std::move(str_args));
+      }
+
+      return executeCommand(std::move(cmd), "CreateAsset", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
         const shared_model::interface::CreateDomain &command) {
       auto &domain_id = command.domainId();
       auto &default_role = command.userDefaultRole();
-      auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%', '%4%')");
-
-      appendCommandName("createDomain", cmd, do_validation_);
+      auto cmd = executeStatement(command, do_validation_)
+                 .quoted(creator_account_id_)
+                 .quoted(domain_id)
+                 .quoted(default_role)
+                 .str();
 
-      cmd = (cmd % creator_account_id_ % domain_id % default_role);
-
-      auto str_args = [&domain_id, &default_role] {
+      auto str_args = [domain_id, default_role] {
         return getQueryArgsStringBuilder()
             .append("domain_id", domain_id)
             .append("default_role", default_role)
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "CreateDomain", std::move(str_args));
+      if (do_validation_
+          and lacksRolePermissions(
+                  creator_account_id_,
+                  {shared_model::interface::permissions::Role::kCreateDomain})) {
+        return makeCommandError("CreateDomain",
+                                CommandError::kNoPermissions,
+                                std::move(str_args));
+      }
+
+      return executeCommand(
+          std::move(cmd), "CreateDomain", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -1075,13 +1533,13 @@ namespace iroha {
       auto &role_id = command.roleName();
       auto &permissions = command.rolePermissions();
       auto perm_str = permissions.toBitstring();
-      auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%', '%4%')");
+      auto cmd = executeStatement(command, do_validation_)
+                 .quoted(creator_account_id_)
+                 .quoted(role_id)
+                 .quoted(perm_str)
+                 .str();
 
-      appendCommandName("createRole", cmd, do_validation_);
-
-      cmd = (cmd % creator_account_id_ % role_id % perm_str);
-
-      auto str_args = [&role_id, &perm_str] {
+      auto str_args = [role_id, perm_str] {
         // TODO [IR-1889] Akvinikym 21.11.18: integrate
         // PermissionSet::toString() instead of bit string, when it is created
         return getQueryArgsStringBuilder()
@@ -1090,27 +1548,41 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "CreateRole", std::move(str_args));
+      // creator can not grant permissions it does not have itself
+      if (do_validation_
+          and lacksRolePermissions(
+                  creator_account_id_,
+                  shared_model::interface::RolePermissionSet(permissions).set(
+                      shared_model::interface::permissions::Role::
+                          kCreateRole))) {
+        return makeCommandError("CreateRole",
+                                CommandError::kNoPermissions,
+                                std::move(str_args));
+      }
+
+      return executeCommand(std::move(cmd), "CreateRole", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
         const shared_model::interface::DetachRole &command) {
       auto &account_id = command.accountId();
       auto &role_name = command.roleName();
-      auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%', '%4%')");
-
-      appendCommandName("detachRole", cmd, do_validation_);
-
-      cmd = (cmd % creator_account_id_ % account_id % role_name);
+      auto cmd = executeStatement(command, do_validation_)
+                 .quoted(creator_account_id_)
+                 .quoted(account_id)
+                 .quoted(role_name)
+                 .str();
 
-      auto str_args = [&account_id, &role_name] {
+      auto str_args = [account_id, role_name] {
         return getQueryArgsStringBuilder()
             .append("account_id", account_id)
             .append("role_name", role_name)
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "DetachRole", std::move(str_args));
+      invalidateRolePermissions(account_id);
+
+      return executeCommand(std::move(cmd), "DetachRole", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -1124,63 +1596,73 @@ namespace iroha {
       const auto perm_str =
           shared_model::interface::GrantablePermissionSet({permission})
               .toBitstring();
-      auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%', '%4%', '%5%')");
-
-      appendCommandName("grantPermission", cmd, do_validation_);
-
-      cmd =
-          (cmd % creator_account_id_ % permittee_account_id % perm_str % perm);
-
-      auto str_args = [&creator_account_id = creator_account_id_,
-                       &permittee_account_id,
-                       permission = perm_converter_->toString(permission)] {
+      auto cmd = executeStatement(command, do_validation_)
+                 .quoted(creator_account_id_)
+                 .quoted(permittee_account_id)
+                 .quoted(perm_str)
+                 .quoted(perm)
+                 .str();
+
+      auto str_args = [creator_account_id = creator_account_id_,
+                       permittee_account_id,
+                       permission,
+                       perm_converter = perm_converter_] {
         return getQueryArgsStringBuilder()
             .append("creator_account_id_", creator_account_id)
             .append("permittee_account_id", permittee_account_id)
-            .append("permission", permission)
+            .append("permission", perm_converter->toString(permission))
             .finalize();
       };
 
-      return executeQuery(
-          sql_, cmd.str(), "GrantPermission", std::move(str_args));
+      if (do_validation_
+          and lacksRolePermissions(
+                  creator_account_id_,
+                  {shared_model::interface::permissions::permissionFor(
+                      permission)})) {
+        return makeCommandError("GrantPermission",
+                                CommandError::kNoPermissions,
+                                std::move(str_args));
+      }
+
+      return executeCommand(
+          std::move(cmd), "GrantPermission", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
         const shared_model::interface::RemovePeer &command) {
       auto pubkey = command.pubkey();
 
-      auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%')");
+      auto cmd = executeStatement(command, do_validation_)
+                 .quoted(creator_account_id_)
+                 .hex(pubkey.hex())
+                 .str();
 
-      appendCommandName("removePeer", cmd, do_validation_);
-
-      cmd = (cmd % creator_account_id_ % pubkey.hex());
-
-      auto str_args = [&pubkey] {
+      auto str_args = [pubkey] {
         return getQueryArgsStringBuilder().append(pubkey.toString()).finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "RemovePeer", std::move(str_args));
+      return executeCommand(std::move(cmd), "RemovePeer", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
         const shared_model::interface::RemoveSignatory &command) {
       auto &account_id = command.accountId();
-      auto &pubkey = command.pubkey().hex();
-      auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%', '%4%')");
-
-      appendCommandName("removeSignatory", cmd, do_validation_);
-
-      cmd = (cmd % creator_account_id_ % account_id % pubkey);
+      auto pubkey = command.pubkey().hex();
+      auto cmd = executeStatement(command, do_validation_)
+                 .quoted(creator_account_id_)
+                 .quoted(account_id)
+                 .hex(pubkey)
+                 .str();
 
-      auto str_args = [&account_id, &pubkey] {
+      auto str_args = [account_id, pubkey] {
         return getQueryArgsStringBuilder()
             .append("account_id", account_id)
             .append("pubkey", pubkey)
             .finalize();
       };
 
-      return executeQuery(
-          sql_, cmd.str(), "RemoveSignatory", std::move(str_args));
+      return executeCommand(
+          std::move(cmd), "RemoveSignatory", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -1196,25 +1678,26 @@ namespace iroha {
                              .set(permission)
                              .toBitstring();
 
-      auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%', '%4%', '%5%')");
-
-      appendCommandName("revokePermission", cmd, do_validation_);
-
-      cmd = (cmd % creator_account_id_ % permittee_account_id % perms
-             % without_perm_str);
-
-      auto str_args = [&creator_account_id = creator_account_id_,
-                       &permittee_account_id,
-                       permission = perm_converter_->toString(permission)] {
+      auto cmd = executeStatement(command, do_validation_)
+                 .quoted(creator_account_id_)
+                 .quoted(permittee_account_id)
+                 .quoted(perms)
+                 .quoted(without_perm_str)
+                 .str();
+
+      auto str_args = [creator_account_id = creator_account_id_,
+                       permittee_account_id,
+                       permission,
+                       perm_converter = perm_converter_] {
         return getQueryArgsStringBuilder()
             .append("creator_account_id_", creator_account_id)
             .append("permittee_account_id", permittee_account_id)
-            .append("permission", permission)
+            .append("permission", perm_converter->toString(permission))
             .finalize();
       };
 
-      return executeQuery(
-          sql_, cmd.str(), "RevokePermission", std::move(str_args));
+      return executeCommand(
+          std::move(cmd), "RevokePermission", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -1228,13 +1711,14 @@ namespace iroha {
       }
       std::string val = "\"" + value + "\"";
 
-      auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%', '%4%', '%5%')");
-
-      appendCommandName("setAccountDetail", cmd, do_validation_);
+      auto cmd = executeStatement(command, do_validation_)
+                 .quoted(creator_account_id_)
+                 .quoted(account_id)
+                 .quoted(key)
+                 .quoted(val)
+                 .str();
 
-      cmd = (cmd % creator_account_id_ % account_id % key % val);
-
-      auto str_args = [&account_id, &key, &value] {
+      auto str_args = [account_id, key, value] {
         return getQueryArgsStringBuilder()
             .append("account_id", account_id)
             .append("key", key)
@@ -1242,28 +1726,28 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(
-          sql_, cmd.str(), "SetAccountDetail", std::move(str_args));
+      return executeCommand(
+          std::move(cmd), "SetAccountDetail", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
         const shared_model::interface::SetQuorum &command) {
       auto &account_id = command.accountId();
       int quorum = command.newQuorum();
-      auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%', %4%)");
-
-      appendCommandName("setQuorum", cmd, do_validation_);
-
-      cmd = (cmd % creator_account_id_ % account_id % quorum);
+      auto cmd = executeStatement(command, do_validation_)
+                 .quoted(creator_account_id_)
+                 .quoted(account_id)
+                 .unquoted(std::to_string(quorum))
+                 .str();
 
-      auto str_args = [&account_id, quorum] {
+      auto str_args = [account_id, quorum] {
         return getQueryArgsStringBuilder()
             .append("account_id", account_id)
             .append("quorum", std::to_string(quorum))
             .finalize();
       };
 
-      return executeQuery(sql_, cmd.str(), "SetQuorum", std::move(str_args));
+      return executeCommand(std::move(cmd), "SetQuorum", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -1271,15 +1755,23 @@ namespace iroha {
       auto &asset_id = command.assetId();
       auto amount = command.amount().toStringRepr();
       uint32_t precision = command.amount().precision();
-      auto cmd = boost::format("EXECUTE %1% ('%2%', '%3%', %4%, '%5%')");
 
-      appendCommandName("subtractAssetQuantity", cmd, do_validation_);
+      if (aggregatesAssetQuantities()) {
+        addAssetQuantityDelta(
+            creator_account_id_, asset_id, "-" + amount, precision);
+        return {};
+      }
 
-      cmd = (cmd % creator_account_id_ % asset_id % precision % amount);
+      auto cmd = executeStatement(command, do_validation_)
+                 .quoted(creator_account_id_)
+                 .quoted(asset_id)
+                 .unquoted(std::to_string(precision))
+                 .quoted(amount)
+                 .str();
 
-      auto str_args = [&creator_account_id = creator_account_id_,
-                       &asset_id,
-                       &amount,
+      auto str_args = [creator_account_id = creator_account_id_,
+                       asset_id,
+                       amount,
                        precision] {
         return getQueryArgsStringBuilder()
             .append("creator_account_id", creator_account_id)
@@ -1289,8 +1781,24 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(
-          sql_, cmd.str(), "SubtractAssetQuantity", std::move(str_args));
+      if (do_validation_
+          and lacksRolePermissions(
+                  creator_account_id_,
+                  {shared_model::interface::permissions::Role::
+                       kSubtractAssetQty})
+          and (getDomainFromName(creator_account_id_)
+                   != getDomainFromAssetId(asset_id)
+               or lacksRolePermissions(
+                      creator_account_id_,
+                      {shared_model::interface::permissions::Role::
+                           kSubtractDomainAssetQty}))) {
+        return makeCommandError("SubtractAssetQuantity",
+                                CommandError::kNoPermissions,
+                                std::move(str_args));
+      }
+
+      return executeCommand(
+          std::move(cmd), "SubtractAssetQuantity", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -1300,16 +1808,25 @@ namespace iroha {
       auto &asset_id = command.assetId();
       auto amount = command.amount().toStringRepr();
       uint32_t precision = command.amount().precision();
-      auto cmd =
-          boost::format("EXECUTE %1% ('%2%', '%3%', '%4%', '%5%', %6%, '%7%')");
 
-      appendCommandName("transferAsset", cmd, do_validation_);
+      if (aggregatesAssetQuantities()) {
+        addAssetQuantityDelta(
+            src_account_id, asset_id, "-" + amount, precision);
+        addAssetQuantityDelta(dest_account_id, asset_id, amount, precision);
+        return {};
+      }
 
-      cmd = (cmd % creator_account_id_ % src_account_id % dest_account_id
-             % asset_id % precision % amount);
+      auto cmd = executeStatement(command, do_validation_)
+                 .quoted(creator_account_id_)
+                 .quoted(src_account_id)
+                 .quoted(dest_account_id)
+                 .quoted(asset_id)
+                 .unquoted(std::to_string(precision))
+                 .quoted(amount)
+                 .str();
 
       auto str_args =
-          [&src_account_id, &dest_account_id, &asset_id, &amount, precision] {
+          [src_account_id, dest_account_id, asset_id, amount, precision] {
             return getQueryArgsStringBuilder()
                 .append("src_account_id", src_account_id)
                 .append("dest_account_id", dest_account_id)
@@ -1319,8 +1836,24 @@ namespace iroha {
                 .finalize();
           };
 
-      return executeQuery(
-          sql_, cmd.str(), "TransferAsset", std::move(str_args));
+      // transfers from other accounts are allowed by grantable permissions,
+      // which are not cached
+      if (do_validation_
+          and (lacksRolePermissions(
+                   dest_account_id,
+                   {shared_model::interface::permissions::Role::kReceive})
+               or (creator_account_id_ == src_account_id
+                   and lacksRolePermissions(
+                           creator_account_id_,
+                           {shared_model::interface::permissions::Role::
+                                kTransfer})))) {
+        return makeCommandError("TransferAsset",
+                                CommandError::kNoPermissions,
+                                std::move(str_args));
+      }
+
+      return executeCommand(
+          std::move(cmd), "TransferAsset", std::move(str_args));
     }
 
     CommandResult PostgresCommandExecutor::operator()(
@@ -1330,11 +1863,6 @@ namespace iroha {
       auto &value = command.value();
       auto &old_value = command.oldValue();
 
-      auto cmd = boost::format(
-          "EXECUTE %1% ('%2%', '%3%', '%4%', '%5%', %6%, '%7%', '%8%')");
-
-      appendCommandName("compareAndSetAccountDetail", cmd, do_validation_);
-
       std::string new_json_value = "\"" + value + "\"";
       std::string expected_json_value = "NULL";
 
@@ -1342,11 +1870,17 @@ namespace iroha {
         expected_json_value = "'\"" + old_value.get() + "\"'";
       }
 
-      cmd = (cmd % creator_account_id_ % account_id % key % new_json_value
-             % expected_json_value % getDomainFromName(creator_account_id_)
-             % getDomainFromName(account_id));
-
-      auto str_args = [&account_id, &key, &new_json_value, &old_value] {
+      auto cmd = executeStatement(command, do_validation_)
+                 .quoted(creator_account_id_)
+                 .quoted(account_id)
+                 .quoted(key)
+                 .quoted(new_json_value)
+                 .unquoted(expected_json_value)
+                 .quoted(getDomainFromName(creator_account_id_))
+                 .quoted(getDomainFromName(account_id))
+                 .str();
+
+      auto str_args = [account_id, key, new_json_value, old_value] {
         return getQueryArgsStringBuilder()
             .append("account_id", account_id)
             .append("key", key)
@@ -1356,8 +1890,8 @@ namespace iroha {
             .finalize();
       };
 
-      return executeQuery(
-          sql_, cmd.str(), "compareAndSetAccountDetail", std::move(str_args));
+      return executeCommand(
+          std::move(cmd), "compareAndSetAccountDetail", std::move(str_args));
     }
 
     void PostgresCommandExecutor::prepareStatements(soci::session &sql) {
@@ -7,7 +7,13 @@
 #define IROHA_POSTGRES_COMMAND_EXECUTOR_HPP
 
 #include "ametsuchi/command_executor.hpp"
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 #include "ametsuchi/impl/soci_utils.hpp"
+#include "interfaces/permissions.hpp"
 
 namespace shared_model {
   namespace interface {
@@ -31,6 +37,18 @@ namespace iroha {
 
       void doValidation(bool do_validation) override;
 
+      void deferExecution(bool defer_execution) override;
+
+      /**
+       * Net changes of asset quantities made by deferred commands per account
+       * and asset, and apply them by a single statement on flush. Balances
+       * are checked only after all changes, so it is meant for commands of
+       * validated blocks
+       */
+      void aggregateAssetQuantities(bool aggregate_asset_quantities);
+
+      CommandResult flush() override;
+
       CommandResult operator()(
           const shared_model::interface::AddAssetQuantity &command) override;
 
@@ -90,13 +108,90 @@ namespace iroha {
       static void prepareStatements(soci::session &sql);
 
      private:
+      /// statement of a command whose execution is deferred until flush
+      struct DeferredCommand {
+        std::string statement;
+        std::string command_name;
+      };
+
+      /**
+       * Execute the statement of a command, or defer it until flush if
+       * execution is deferred and the command is not validated
+       * @param cmd - statement of the command
+       * @param command_name - name of the command for errors
+       * @param query_args - callable to get a string representation of
+       * command arguments
+       * @return result of the command
+       */
+      template <typename QueryArgsCallable>
+      CommandResult executeCommand(std::string cmd,
+                                   std::string command_name,
+                                   QueryArgsCallable &&query_args);
+
+      /// @return true if changes of asset quantities are aggregated
+      bool aggregatesAssetQuantities() const;
+
+      /**
+       * Add a change of asset quantity to the aggregated ones
+       * @param delta - signed change of the quantity
+       * @param precision - precision of the change
+       */
+      void addAssetQuantityDelta(
+          const shared_model::interface::types::AccountIdType &account_id,
+          const shared_model::interface::types::AssetIdType &asset_id,
+          const std::string &delta,
+          int precision);
+
+      /**
+       * Checks role permissions of the account using the cache, reading them
+       * from the database on a cache miss
+       * @param account_id - account to be checked
+       * @param permissions - required permissions
+       * @return true if the account is known to lack some of the permissions,
+       * false if it has them or they can not be checked without executing the
+       * command
+       */
+      bool lacksRolePermissions(
+          const shared_model::interface::types::AccountIdType &account_id,
+          const shared_model::interface::RolePermissionSet &permissions);
+
+      /**
+       * Stops caching of role permissions of the account, since its roles
+       * may be changed by the command being executed
+       */
+      void invalidateRolePermissions(
+          const shared_model::interface::types::AccountIdType &account_id);
+
       soci::session &sql_;
       bool do_validation_;
+      bool defer_execution_;
+      std::vector<DeferredCommand> deferred_commands_;
+      bool aggregate_asset_quantities_;
+      /// rows of aggregated changes of asset quantities, for VALUES list
+      std::string asset_quantity_deltas_;
 
       shared_model::interface::types::AccountIdType creator_account_id_;
       std::shared_ptr<shared_model::interface::PermissionToString>
           perm_converter_;
 
+      /**
+       * Role permissions of accounts read during lifetime of the executor,
+       * which covers a single proposal or block. Permissions of roles can not
+       * be changed, so cached sets stay valid until roles of the account are
+       * changed
+       */
+      std::unordered_map<shared_model::interface::types::AccountIdType,
+                         shared_model::interface::RolePermissionSet>
+          role_permissions_cache_;
+
+      /**
+       * Accounts whose roles were changed by executed commands. They are not
+       * cached anymore, since the changes may be rolled back together with an
+       * enclosing savepoint
+       */
+      std::unordered_set<shared_model::interface::types::AccountIdType>
+          accounts_with_changed_roles_;
+
       // 14.09.18 nickaleks: IR-1708 Load SQL from separate files
       static const std::string addAssetQuantityBase;
       static const std::string addPeerBase;
@@ -116,6 +211,7 @@ namespace iroha {
       static const std::string subtractAssetQuantityBase;
       static const std::string transferAssetBase;
       static const std::string compareAndSetAccountDetailBase;
+      static const std::string assetQuantityDeltasBase;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -5,34 +5,84 @@
 
 #include "ametsuchi/impl/postgres_indexer.hpp"
 
+#include <initializer_list>
+
 #include <soci/soci.h>
-#include <boost/format.hpp>
+#include "ametsuchi/impl/soci_utils.hpp"
 #include "cryptography/hash.hpp"
 
 using namespace iroha::ametsuchi;
 using namespace shared_model::interface::types;
 
+namespace {
+  /// Append a row of quoted values to a multi-row VALUES list
+  void appendRow(std::string &rows, std::initializer_list<std::string> values) {
+    rows.append(rows.empty() ? "(" : ",\n(");
+    bool first = true;
+    for (const auto &value : values) {
+      rows.append(first ? "'" : ", '").append(value).append("'");
+      first = false;
+    }
+    rows.append(")");
+  }
+
+  /// @return bytea literal of the hash, without quotes
+  std::string byteaLiteral(const HashType &hash) {
+    return "\\x" + hash.hex();
+  }
+
+  /// Append insertion of rows into a table to statements if there are any
+  void appendInsert(std::string &statements,
+                    const char *table_with_columns,
+                    std::string &rows) {
+    if (not rows.empty()) {
+      statements.append("INSERT INTO ")
+          .append(table_with_columns)
+          .append(" VALUES\n")
+          .append(rows)
+          .append(";\n");
+      rows.clear();
+    }
+  }
+
+  /// Append insertion of rows into a table, which are converted by the select
+  /// list from the values named by the alias, e.g. to intern the ids
+  void appendInsert(std::string &statements,
+                    const char *table_with_columns,
+                    const char *select_list,
+                    const char *values_alias,
+                    std::string &rows) {
+    if (not rows.empty()) {
+      statements.append("INSERT INTO ")
+          .append(table_with_columns)
+          .append(" SELECT ")
+          .append(select_list)
+          .append(" FROM (VALUES\n")
+          .append(rows)
+          .append(") AS ")
+          .append(values_alias)
+          .append(";\n");
+      rows.clear();
+    }
+  }
+}  // namespace
+
 PostgresIndexer::PostgresIndexer(soci::session &sql) : sql_(sql) {}
 
 void PostgresIndexer::txHashPosition(const HashType &hash,
                                      TxPosition position) {
-  boost::format base(
-      "INSERT INTO position_by_hash"
-      "(hash, height, index) VALUES "
-      "('%s', '%s', '%s');\n");
-  statements_.append(
-      (base % hash.hex() % position.height % position.index).str());
+  ++rows_;
+  appendRow(position_by_hash_,
+            {byteaLiteral(hash),
+             std::to_string(position.height),
+             std::to_string(position.index)});
 }
 
 void PostgresIndexer::txHashStatus(const HashType &rejected_tx_hash,
                                    bool is_committed) {
-  boost::format base(
-      "INSERT INTO tx_status_by_hash"
-      "(hash, status) VALUES "
-      "('%s', '%s');\n");
-  statements_.append(
-      (base % rejected_tx_hash.hex() % (is_committed ? "TRUE" : "FALSE"))
-          .str());
+  ++rows_;
+  appendRow(tx_status_by_hash_,
+            {byteaLiteral(rejected_tx_hash), is_committed ? "TRUE" : "FALSE"});
 }
 
 void PostgresIndexer::committedTxHash(const HashType &committed_tx_hash) {
@@ -45,27 +95,66 @@ void PostgresIndexer::rejectedTxHash(const HashType &rejected_tx_hash) {
 
 void PostgresIndexer::txPositionByCreator(const AccountIdType creator,
                                           TxPosition position) {
-  boost::format base(
-      "INSERT INTO tx_position_by_creator"
-      "(creator_id, height, index) VALUES "
-      "('%s', '%s', '%s');\n");
-  statements_.append((base % creator % position.height % position.index).str());
+  ++rows_;
+  appendRow(tx_position_by_creator_,
+            {creator,
+             std::to_string(position.height),
+             std::to_string(position.index)});
 }
 
 void PostgresIndexer::accountAssetTxPosition(const AccountIdType &account_id,
                                              const AssetIdType &asset_id,
                                              TxPosition position) {
-  boost::format base(
-      "INSERT INTO position_by_account_asset"
-      "(account_id, asset_id, height, index) VALUES "
-      "('%s', '%s', '%s', '%s');\n");
-  statements_.append(
-      (base % account_id % asset_id % position.height % position.index).str());
+  ++rows_;
+  appendRow(position_by_account_asset_,
+            {account_id,
+             asset_id,
+             std::to_string(position.height),
+             std::to_string(position.index)});
+}
+
+void PostgresIndexer::topBlock(HeightType height, const HashType &hash) {
+  top_block_.clear();
+  ++rows_;
+  appendRow(top_block_, {std::to_string(height), hash.hex()});
+  height_partitions_ =
+      "SELECT create_height_partitions(" + std::to_string(height) + ");\n";
 }
 
 iroha::expected::Result<void, std::string> PostgresIndexer::flush() {
+  std::string statements;
+  statements.swap(height_partitions_);
+  appendInsert(
+      statements, "position_by_hash(hash, height, index)", position_by_hash_);
+  appendInsert(
+      statements, "tx_status_by_hash(hash, status)", tx_status_by_hash_);
+  appendInsert(statements,
+               "tx_position_by_creator(creator_id, height, index)",
+               "intern_id(creator_id), height::bigint, index::bigint",
+               "v(creator_id, height, index)",
+               tx_position_by_creator_);
+  appendInsert(statements,
+               "position_by_account_asset(account_id, asset_id, height, index)",
+               "intern_id(account_id), intern_id(asset_id), height::bigint, "
+               "index::bigint",
+               "v(account_id, asset_id, height, index)",
+               position_by_account_asset_);
+  if (not top_block_.empty()) {
+    statements.append("INSERT INTO top_block_info(height, hash) VALUES ")
+        .append(top_block_)
+        .append(
+            "\nON CONFLICT (lock) DO UPDATE "
+            "SET height = excluded.height, hash = excluded.hash;\n");
+    top_block_.clear();
+  }
+  if (statements.empty()) {
+    return {};
+  }
   try {
-    sql_ << statements_;
+    TimedStatement statement("indexBlock");
+    statement.addRows(rows_);
+    rows_ = 0;
+    sql_ << statements;
   } catch (const std::exception &e) {
     return e.what();
   }
@@ -37,6 +37,10 @@ namespace iroha {
           const shared_model::interface::types::AssetIdType &asset_id,
           TxPosition position) override;
 
+      void topBlock(
+          shared_model::interface::types::HeightType height,
+          const shared_model::interface::types::HashType &hash) override;
+
       iroha::expected::Result<void, std::string> flush() override;
 
      private:
@@ -46,7 +50,18 @@ namespace iroha {
           bool is_committed);
 
       soci::session &sql_;
-      std::string statements_;  ///< A bunch of SQL to be committed on flush().
+
+      /// Rows of each index table, inserted with one statement per table on
+      /// flush().
+      std::string position_by_hash_;
+      std::string tx_status_by_hash_;
+      std::string tx_position_by_creator_;
+      std::string position_by_account_asset_;
+      std::string top_block_;
+      /// Creation of the partitions of the history tables for the top block
+      std::string height_partitions_;
+      /// Rows of all the tables appended since the last flush()
+      size_t rows_ = 0;
     };
 
   }  // namespace ametsuchi
@@ -69,14 +69,24 @@ PostgresOptions::PostgresOptions(const std::string &host,
                                  const std::string &password,
                                  const std::string &working_dbname,
                                  const std::string &maintenance_dbname,
-                                 logger::LoggerPtr log)
+                                 logger::LoggerPtr log,
+                                 std::vector<Replica> replicas,
+                                 PoolReservation pool_reservation,
+                                 bool async_validation_commit,
+                                 boost::optional<std::string> template_dbname,
+                                 bool lazy_statement_preparation)
     : host_(host),
       port_(port),
       user_(user),
       password_(password),
       working_dbname_(working_dbname),
       maintenance_dbname_(maintenance_dbname),
-      prepared_block_name_(kPreparedBlockPrefix + working_dbname_) {
+      prepared_block_name_(kPreparedBlockPrefix + working_dbname_),
+      replicas_(std::move(replicas)),
+      pool_reservation_(pool_reservation),
+      async_validation_commit_(async_validation_commit),
+      template_dbname_(std::move(template_dbname)),
+      lazy_statement_preparation_(lazy_statement_preparation) {
   if (working_dbname_ == maintenance_dbname_) {
     log->warn(
         "Working database has the same name with maintenance database: '{}'. "
@@ -104,6 +114,27 @@ std::string PostgresOptions::getConnectionStringWithDbName(
   return connectionStringWithoutDbName() + " dbname=" + dbname;
 }
 
+std::string PostgresOptions::replicaConnectionString(
+    const Replica &replica) const {
+  return (boost::format("host=%1% port=%2% user=%3% password=%4% dbname=%5%")
+          % replica.host % replica.port % user_ % password_ % working_dbname_)
+      .str();
+}
+
+const std::vector<PostgresOptions::Replica> &PostgresOptions::replicas()
+    const {
+  return replicas_;
+}
+
+const PostgresOptions::PoolReservation &PostgresOptions::poolReservation()
+    const {
+  return pool_reservation_;
+}
+
+bool PostgresOptions::asyncValidationCommit() const {
+  return async_validation_commit_;
+}
+
 std::string PostgresOptions::workingDbName() const {
   return working_dbname_;
 }
@@ -112,6 +143,14 @@ std::string PostgresOptions::maintenanceDbName() const {
   return maintenance_dbname_;
 }
 
+const boost::optional<std::string> &PostgresOptions::templateDbName() const {
+  return template_dbname_;
+}
+
+bool PostgresOptions::lazyStatementPreparation() const {
+  return lazy_statement_preparation_;
+}
+
 const std::string &PostgresOptions::preparedBlockName() const {
   return prepared_block_name_;
 }
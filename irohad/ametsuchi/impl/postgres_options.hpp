@@ -6,18 +6,48 @@
 #ifndef IROHA_POSTGRES_OPTIONS_HPP
 #define IROHA_POSTGRES_OPTIONS_HPP
 
+#include <chrono>
 #include <unordered_map>
+#include <vector>
+
+#include <boost/optional.hpp>
 #include "common/result.hpp"
 #include "logger/logger_fwd.hpp"
 
 namespace iroha {
   namespace ametsuchi {
 
+    /**
+     * Connections of the working database reserved for components, so that
+     * they do not wait for connections taken by queries.
+     */
+    struct PostgresPoolReservation {
+      /// connections reserved for block commit
+      size_t commit = 2;
+      /// connections reserved for stateful validation of proposals
+      size_t validation = 2;
+      /// how long a query waits for a free connection, zero is forever
+      std::chrono::milliseconds query_timeout{0};
+    };
+
     /**
      * Type for convenient formatting of PostgreSQL connection strings.
      */
     class PostgresOptions {
      public:
+      /**
+       * Read-only replica of the working database. It is accessed with the
+       * same credentials and database name as the primary server.
+       */
+      struct Replica {
+        std::string host;
+        uint16_t port;
+      };
+
+      /// declared outside of the class, since its default member initializers
+      /// are needed by the default arguments of the constructor
+      using PoolReservation = PostgresPoolReservation;
+
       /**
        * @param pg_opt The connection options string.
        * @param default_dbname The default name of database to use when one is
@@ -40,6 +70,16 @@ namespace iroha {
        * purposes. It will not be altered in any way and is used to manage
        * working database.
        * @param log Logger for internal messages.
+       * @param replicas Read-only replicas of the working database.
+       * @param pool_reservation Connections reserved for components.
+       * @param async_validation_commit Whether blocks committed by the
+       * transactions of stateful validation are committed without waiting
+       * for WAL flush.
+       * @param template_dbname The name of database the working database is
+       * created as a copy of, if it does not exist.
+       * @param lazy_statement_preparation Whether the statements of the
+       * executors are prepared on a connection when it is first used instead
+       * of when the connection pool is created.
        */
       PostgresOptions(const std::string &host,
                       uint16_t port,
@@ -47,7 +87,13 @@ namespace iroha {
                       const std::string &password,
                       const std::string &working_dbname,
                       const std::string &maintenance_dbname,
-                      logger::LoggerPtr log);
+                      logger::LoggerPtr log,
+                      std::vector<Replica> replicas = {},
+                      PoolReservation pool_reservation = {},
+                      bool async_validation_commit = false,
+                      boost::optional<std::string> template_dbname =
+                          boost::none,
+                      bool lazy_statement_preparation = false);
 
       /// @return connection string without dbname param
       std::string connectionStringWithoutDbName() const;
@@ -58,12 +104,30 @@ namespace iroha {
       /// @return connection string to maintenance database
       std::string maintenanceConnectionString() const;
 
+      /// @return connection string to working database on the given replica
+      std::string replicaConnectionString(const Replica &replica) const;
+
+      /// @return read-only replicas of the working database
+      const std::vector<Replica> &replicas() const;
+
+      /// @return connections reserved for components
+      const PoolReservation &poolReservation() const;
+
+      /// @return whether validation transactions commit asynchronously
+      bool asyncValidationCommit() const;
+
       /// @return working database name
       std::string workingDbName() const;
 
       /// @return maintenance database name
       std::string maintenanceDbName() const;
 
+      /// @return name of database the working database is created from
+      const boost::optional<std::string> &templateDbName() const;
+
+      /// @return whether statements are prepared on first use of connections
+      bool lazyStatementPreparation() const;
+
       /// @return prepared block name
       const std::string &preparedBlockName() const;
 
@@ -78,6 +142,11 @@ namespace iroha {
       const std::string working_dbname_;
       const std::string maintenance_dbname_;
       const std::string prepared_block_name_;
+      const std::vector<Replica> replicas_;
+      const PoolReservation pool_reservation_;
+      const bool async_validation_commit_;
+      const boost::optional<std::string> template_dbname_;
+      const bool lazy_statement_preparation_;
     };
 
   }  // namespace ametsuchi
@@ -5,17 +5,19 @@
 
 #include "ametsuchi/impl/postgres_specific_query_executor.hpp"
 
-#include <boost/algorithm/string/classification.hpp>
+#include <unordered_map>
+
+#include <boost/algorithm/string/join.hpp>
 #include <boost/algorithm/string/split.hpp>
 #include <boost/format.hpp>
 #include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/transformed.hpp>
 #include <boost/range/algorithm/transform.hpp>
-#include <boost/range/irange.hpp>
+#include "ametsuchi/impl/block_cache.hpp"
 #include "ametsuchi/impl/soci_utils.hpp"
 #include "ametsuchi/key_value_storage.hpp"
 #include "backend/plain/peer.hpp"
-#include "common/byteutils.hpp"
+#include "backend/protobuf/proto_block_json_converter.hpp"
 #include "interfaces/common_objects/amount.hpp"
 #include "interfaces/iroha_internal/block.hpp"
 #include "interfaces/iroha_internal/block_json_converter.hpp"
@@ -46,17 +48,15 @@ namespace {
 
   using namespace iroha;
 
-  shared_model::interface::types::DomainIdType getDomainFromName(
-      const shared_model::interface::types::AccountIdType &account_id) {
-    // TODO 03.10.18 andrei: IR-1728 Move getDomainFromName to shared_model
-    std::vector<std::string> res;
-    boost::split(res, account_id, boost::is_any_of("@"));
-    return res.at(1);
-  }
-
+  /**
+   * Generate an SQL subquery which checks if account has the role permission
+   * @param permission - permission to be checked
+   * @param account - SQL expression with id of the account, e.g. a bind
+   * variable or a parameter of prepared statement
+   */
   std::string getAccountRolePermissionCheckSql(
       shared_model::interface::permissions::Role permission,
-      const std::string &account_alias = "role_account_id") {
+      const std::string &account = ":role_account_id") {
     const auto perm_str =
         shared_model::interface::RolePermissionSet({permission}).toBitstring();
     const auto bits = shared_model::interface::RolePermissionSet::size();
@@ -65,8 +65,8 @@ namespace {
           SELECT (COALESCE(bit_or(rp.permission), '0'::bit(%1%))
           & '%2%') = '%2%' AS perm FROM role_has_permissions AS rp
               JOIN account_has_roles AS ar on ar.role_id = rp.role_id
-              WHERE ar.account_id = :%3%)")
-                         % bits % perm_str % account_alias)
+              WHERE ar.account_id = %3%)")
+                         % bits % perm_str % account)
                             .str();
     return query;
   }
@@ -76,13 +76,13 @@ namespace {
    * permissions for target account
    * It verifies individual, domain, and global permissions, and returns true if
    * any of listed permissions is present
+   * @param creator, target_account - SQL expressions with ids of the accounts
    */
-  auto hasQueryPermission(
-      const shared_model::interface::types::AccountIdType &creator,
-      const shared_model::interface::types::AccountIdType &target_account,
-      Role indiv_permission_id,
-      Role all_permission_id,
-      Role domain_permission_id) {
+  auto hasQueryPermission(const std::string &creator,
+                          const std::string &target_account,
+                          Role indiv_permission_id,
+                          Role all_permission_id,
+                          Role domain_permission_id) {
     const auto bits = shared_model::interface::RolePermissionSet::size();
     const auto perm_str =
         shared_model::interface::RolePermissionSet({indiv_permission_id})
@@ -100,31 +100,368 @@ namespace {
           SELECT (COALESCE(bit_or(rp.permission), '0'::bit(%1%))
           & '%3%') = '%3%' FROM role_has_permissions AS rp
               JOIN account_has_roles AS ar on ar.role_id = rp.role_id
-              WHERE ar.account_id = '%2%'
+              WHERE ar.account_id = %2%
         ),
         has_all_perm AS (
           SELECT (COALESCE(bit_or(rp.permission), '0'::bit(%1%))
           & '%4%') = '%4%' FROM role_has_permissions AS rp
               JOIN account_has_roles AS ar on ar.role_id = rp.role_id
-              WHERE ar.account_id = '%2%'
+              WHERE ar.account_id = %2%
         ),
         has_domain_perm AS (
           SELECT (COALESCE(bit_or(rp.permission), '0'::bit(%1%))
           & '%5%') = '%5%' FROM role_has_permissions AS rp
               JOIN account_has_roles AS ar on ar.role_id = rp.role_id
-              WHERE ar.account_id = '%2%'
+              WHERE ar.account_id = %2%
         )
-    SELECT ('%2%' = '%6%' AND (SELECT * FROM has_indiv_perm))
+    SELECT (%2% = %6% AND (SELECT * FROM has_indiv_perm))
         OR (SELECT * FROM has_all_perm)
-        OR ('%7%' = '%8%' AND (SELECT * FROM has_domain_perm)) AS perm
+        OR (split_part(%2%, '@', 2) = split_part(%6%, '@', 2)
+            AND (SELECT * FROM has_domain_perm)) AS perm
     )");
 
     return (cmd % bits % creator % perm_str % all_perm_str % domain_perm_str
-            % target_account % getDomainFromName(creator)
-            % getDomainFromName(target_account))
+            % target_account)
         .str();
   }
 
+  /**
+   * Query statement which is prepared once per database session
+   */
+  struct QueryStatement {
+    std::string name;
+    std::string arg_types;
+    std::string body;
+  };
+
+  /**
+   * Build statements for queries which text does not depend on query
+   * arguments. Arguments are passed as parameters of prepared statements,
+   * $1 is always the query creator
+   */
+  std::vector<QueryStatement> queryStatements() {
+    std::vector<QueryStatement> statements;
+
+    statements.push_back(
+        {"getAccount",
+         "text, text",
+         (boost::format(R"(WITH has_perms AS (%s),
+      details AS (
+          SELECT COALESCE(jsonb_object_agg(writer, by_writer), '{}') AS data
+          FROM (
+              SELECT writer, jsonb_object_agg(key, value) AS by_writer
+              FROM account_has_detail
+              WHERE account_id = $2
+              GROUP BY writer
+          ) d
+      ),
+      t AS (
+          SELECT a.account_id, a.domain_id, a.quorum, details.data, ARRAY_AGG(ar.role_id) AS roles
+          FROM account AS a, account_has_roles AS ar, details
+          WHERE a.account_id = $2
+          AND ar.account_id = a.account_id
+          GROUP BY a.account_id, details.data
+      )
+      SELECT account_id, domain_id, quorum, data, roles, perm
+      FROM t RIGHT OUTER JOIN has_perms AS p ON TRUE
+      )")
+          % hasQueryPermission("$1",
+                               "$2",
+                               Role::kGetMyAccount,
+                               Role::kGetAllAccounts,
+                               Role::kGetDomainAccounts))
+             .str()});
+
+    statements.push_back(
+        {"getSignatories",
+         "text, text",
+         (boost::format(R"(WITH has_perms AS (%s),
+      t AS (
+          SELECT encode(public_key, 'hex') AS public_key
+          FROM account_has_signatory
+          WHERE account_id = $2
+      )
+      SELECT public_key, perm FROM t
+      RIGHT OUTER JOIN has_perms ON TRUE
+      )")
+          % hasQueryPermission("$1",
+                               "$2",
+                               Role::kGetMySignatories,
+                               Role::kGetAllSignatories,
+                               Role::kGetDomainSignatories))
+             .str()});
+
+    // every transactions query has two statements: one starting from the
+    // paging hash, which is the last parameter, and one starting from the
+    // first transaction. Pages are selected with a (height, index) keyset
+    // condition, so that they are read from the covering index of the
+    // positions table instead of scanning all related transactions
+    auto transactions_statements = [&statements](
+                                       const std::string &name,
+                                       const std::string &arg_types,
+                                       const std::string &related_txs,
+                                       size_t page_size_arg,
+                                       Role indiv_permission_id,
+                                       Role all_permission_id,
+                                       Role domain_permission_id) {
+      auto base = boost::format(R"(WITH has_perms AS (%s),
+      total_size AS (
+        SELECT COUNT(*) FROM (SELECT DISTINCT height, index FROM %s) my_txs
+      ),
+      t AS (
+        SELECT DISTINCT height, index FROM %s%s
+        ORDER BY height, index ASC
+        LIMIT $%d
+      )
+      SELECT height, index, count, perm FROM t
+      RIGHT OUTER JOIN has_perms ON TRUE
+      JOIN total_size ON TRUE
+      )")
+          % hasQueryPermission("$1",
+                               "$2",
+                               indiv_permission_id,
+                               all_permission_id,
+                               domain_permission_id)
+          % related_txs % related_txs;
+
+      // start from tx with specified hash
+      auto from_hash =
+          (boost::format(R"(
+        AND (height, index) >= (SELECT height, index FROM position_by_hash
+                                WHERE hash = decode($%d, 'hex') LIMIT 1))")
+           % (page_size_arg + 1))
+              .str();
+
+      statements.push_back(
+          {name + "FromHash",
+           arg_types + ", bigint, text",
+           (boost::format(base) % from_hash % page_size_arg).str()});
+      statements.push_back({name,
+                            arg_types + ", bigint",
+                            (boost::format(base) % "" % page_size_arg).str()});
+    };
+
+    transactions_statements("getAccountTransactions",
+                            "text, text",
+                            R"(tx_position_by_creator
+        WHERE creator_id = (SELECT id FROM interned_id WHERE name = $2))",
+                            3,
+                            Role::kGetMyAccTxs,
+                            Role::kGetAllAccTxs,
+                            Role::kGetDomainAccTxs);
+
+    transactions_statements(
+        "getAccountAssetTransactions",
+        "text, text, text",
+        R"(position_by_account_asset
+        WHERE account_id = (SELECT id FROM interned_id WHERE name = $2)
+        AND asset_id = (SELECT id FROM interned_id WHERE name = $3))",
+        // consider index when changing this
+        4,
+        Role::kGetMyAccAstTxs,
+        Role::kGetAllAccAstTxs,
+        Role::kGetDomainAccAstTxs);
+
+    statements.push_back({"getAccountAssets",
+                          "text, text, text, bigint",
+                          (boost::format(R"(
+      with has_perms as (%s),
+      all_data as (
+          select row_number() over () rn, *
+          from (
+              select *
+              from account_has_asset
+              where account_id = $2
+              order by asset_id
+          ) t
+      ),
+      total_number as (
+          select rn total_number
+          from all_data
+          order by rn desc
+          limit 1
+      ),
+      page_start as (
+          select rn
+          from all_data
+          where coalesce(asset_id = $3, true)
+          limit 1
+      ),
+      page_data as (
+          select * from all_data, page_start, total_number
+          where
+              all_data.rn >= page_start.rn and
+              coalesce( -- TODO remove after pagination is mandatory IR-516
+                  all_data.rn < page_start.rn + $4,
+                  true
+              )
+      )
+      select account_id, asset_id, amount, total_number, perm
+          from
+              page_data
+              right join has_perms on true
+      )")
+                           % hasQueryPermission("$1",
+                                                "$2",
+                                                Role::kGetMyAccAst,
+                                                Role::kGetAllAccAst,
+                                                Role::kGetDomainAccAst))
+                              .str()});
+
+    statements.push_back({"getAccountDetail",
+                          "text, text, text, text, text, text, bigint",
+                          (boost::format(R"(
+      with has_perms as (%s),
+      detail AS (
+          with filtered_plain_data as (
+              select row_number() over () rn, *
+              from (
+                  select writer, key, value
+                  from account_has_detail
+                  where
+                      account_id = $2 and
+                      coalesce(writer = $3, true) and
+                      coalesce(key = $4, true)
+                  order by writer asc, key asc
+              ) t
+          ),
+          page_limits as (
+              select start.rn as start, start.rn + $7 as end
+                  from (
+                      select rn
+                      from filtered_plain_data
+                      where
+                          coalesce(writer = $5, true) and
+                          coalesce(key = $6, true)
+                      limit 1
+                  ) start
+          ),
+          total_number as (select count(1) total_number from filtered_plain_data),
+          next_record as (
+              select writer, key
+              from
+                  filtered_plain_data,
+                  page_limits
+              where rn = page_limits.end
+          ),
+          page as (
+              select json_object_agg(writer, data_by_writer) json
+              from (
+                  select writer, json_object_agg(key, value) data_by_writer
+                  from
+                      filtered_plain_data,
+                      page_limits
+                  where
+                      rn >= page_limits.start and
+                      coalesce(rn < page_limits.end, true)
+                  group by writer
+              ) t
+          ),
+          target_account_exists as (
+            select count(1) val
+            from account
+            where account_id = $2
+          )
+          select
+              page.json json,
+              total_number,
+              next_record.writer next_writer,
+              next_record.key next_key,
+              target_account_exists.val target_account_exists
+          from
+              page
+              left join total_number on true
+              left join next_record on true
+              right join target_account_exists on true
+      )
+      select detail.*, perm from detail
+      right join has_perms on true
+      )")
+                           % hasQueryPermission("$1",
+                                                "$2",
+                                                Role::kGetMyAccDetail,
+                                                Role::kGetAllAccDetail,
+                                                Role::kGetDomainAccDetail))
+                              .str()});
+
+    statements.push_back(
+        {"getRoles",
+         "text",
+         (boost::format(R"(WITH has_perms AS (%s)
+      SELECT role_id, perm FROM role
+      RIGHT OUTER JOIN has_perms ON TRUE
+      )")
+          % getAccountRolePermissionCheckSql(Role::kGetRoles, "$1"))
+             .str()});
+
+    statements.push_back(
+        {"getRolePermissions",
+         "text, text",
+         (boost::format(R"(WITH has_perms AS (%s),
+      perms AS (SELECT permission FROM role_has_permissions
+                WHERE role_id = $2)
+      SELECT permission, perm FROM perms
+      RIGHT OUTER JOIN has_perms ON TRUE
+      )")
+          % getAccountRolePermissionCheckSql(Role::kGetRoles, "$1"))
+             .str()});
+
+    statements.push_back(
+        {"getAssetInfo",
+         "text, text",
+         (boost::format(R"(WITH has_perms AS (%s),
+      perms AS (SELECT domain_id, precision FROM asset
+                WHERE asset_id = $2)
+      SELECT domain_id, precision, perm FROM perms
+      RIGHT OUTER JOIN has_perms ON TRUE
+      )")
+          % getAccountRolePermissionCheckSql(Role::kReadAssets, "$1"))
+             .str()});
+
+    statements.push_back(
+        {"getPeers",
+         "text",
+         (boost::format(R"(WITH has_perms AS (%s)
+      SELECT encode(public_key, 'hex'), address, perm FROM peer
+      RIGHT OUTER JOIN has_perms ON TRUE
+      )")
+          % getAccountRolePermissionCheckSql(Role::kGetPeers, "$1"))
+             .str()});
+
+    return statements;
+  }
+
+  /// Quote string as SQL literal
+  std::string sqlLiteral(const std::string &value) {
+    std::string result{"'"};
+    for (auto c : value) {
+      if (c == '\'') {
+        result += c;
+      }
+      result += c;
+    }
+    return result + "'";
+  }
+
+  std::string sqlLiteral(const boost::optional<std::string> &value) {
+    return value ? sqlLiteral(*value) : "NULL";
+  }
+
+  std::string sqlLiteral(const boost::optional<size_t> &value) {
+    return value ? std::to_string(*value) : "NULL";
+  }
+
+  /**
+   * Generate text which executes prepared query statement
+   * @param name - name of the statement
+   * @param args - SQL literals of the statement parameters
+   */
+  std::string executeStatement(const std::string &name,
+                               const std::vector<std::string> &args) {
+    return "EXECUTE " + name + " (" + boost::algorithm::join(args, ", ")
+        + ")";
+  }
+
   /// Query result is a tuple of optionals, since there could be no entry
   template <typename... Value>
   using QueryType = boost::tuple<boost::optional<Value>...>;
@@ -170,6 +507,7 @@ namespace iroha {
     PostgresSpecificQueryExecutor::PostgresSpecificQueryExecutor(
         soci::session &sql,
         KeyValueStorage &block_store,
+        std::shared_ptr<BlockCache> block_cache,
         std::shared_ptr<PendingTransactionStorage> pending_txs_storage,
         std::shared_ptr<shared_model::interface::BlockJsonConverter> converter,
         std::shared_ptr<shared_model::interface::QueryResponseFactory>
@@ -179,6 +517,7 @@ namespace iroha {
         logger::LoggerPtr log)
         : sql_(sql),
           block_store_(block_store),
+          block_cache_(std::move(block_cache)),
           pending_txs_storage_(std::move(pending_txs_storage)),
           converter_(std::move(converter)),
           query_response_factory_{std::move(response_factory)},
@@ -195,25 +534,31 @@ namespace iroha {
     PostgresSpecificQueryExecutor::getTransactionsFromBlock(
         uint64_t block_id, RangeGen &&range_gen, Pred &&pred) {
       std::vector<std::unique_ptr<shared_model::interface::Transaction>> result;
-      auto serialized_block = block_store_.get(block_id);
-      if (not serialized_block) {
-        log_->error("Failed to retrieve block with id {}", block_id);
-        return result;
-      }
-      auto deserialized_block =
-          converter_->deserialize(bytesToString(*serialized_block));
-      // boost::get of pointer returns pointer to requested type, or nullptr
-      if (auto e =
-              boost::get<expected::Error<std::string>>(&deserialized_block)) {
-        log_->error("{}", e->error);
-        return result;
+      std::shared_ptr<const shared_model::interface::Block> block;
+      if (block_cache_) {
+        block = block_cache_->find(block_id);
       }
+      if (not block) {
+        auto serialized_block = block_store_.getView(block_id);
+        if (not serialized_block) {
+          log_->error("Failed to retrieve block with id {}", block_id);
+          return result;
+        }
+        auto deserialized_block = converter_->deserialize(
+            serialized_block->charData(), serialized_block->size());
+        // boost::get of pointer returns pointer to requested type, or nullptr
+        if (auto e =
+                boost::get<expected::Error<std::string>>(&deserialized_block)) {
+          log_->error("{}", e->error);
+          return result;
+        }
 
-      auto &block =
-          boost::get<
-              expected::Value<std::unique_ptr<shared_model::interface::Block>>>(
-              deserialized_block)
-              .value;
+        block = std::move(
+            boost::get<expected::Value<
+                std::unique_ptr<shared_model::interface::Block>>>(
+                deserialized_block)
+                .value);
+      }
 
       boost::transform(range_gen(boost::size(block->transactions()))
                            | boost::adaptors::transformed(
@@ -233,13 +578,15 @@ namespace iroha {
               typename ResponseCreator,
               typename PermissionsErrResponse>
     QueryExecutorResult PostgresSpecificQueryExecutor::executeQuery(
+        const std::string &statement_name,
         QueryExecutor &&query_executor,
         ResponseCreator &&response_creator,
         PermissionsErrResponse &&perms_err_response) {
       using T = concat<QueryTuple, PermissionTuple>;
+      TimedStatement statement(statement_name);
       try {
         soci::rowset<T> st = std::forward<QueryExecutor>(query_executor)();
-        auto range = boost::make_iterator_range(st.begin(), st.end());
+        auto range = countedRows(st, statement);
 
         return apply(
             viewPermissions<PermissionTuple>(range.front()),
@@ -332,15 +679,12 @@ namespace iroha {
           error_type, error, error_code, query_hash_);
     }
 
-    template <typename Query,
-              typename QueryChecker,
-              typename QueryApplier,
-              typename... Permissions>
+    template <typename Query, typename QueryChecker, typename... Permissions>
     QueryExecutorResult PostgresSpecificQueryExecutor::executeTransactionsQuery(
         const Query &q,
         QueryChecker &&qry_checker,
-        const std::string &related_txs,
-        QueryApplier applier,
+        const std::string &statement,
+        std::vector<std::string> args,
         Permissions... perms) {
       using QueryTuple = QueryType<shared_model::interface::types::HeightType,
                                    uint64_t,
@@ -351,45 +695,19 @@ namespace iroha {
       // retrieve one extra transaction to populate next_hash
       auto query_size = pagination_info.pageSize() + 1u;
 
-      auto base = boost::format(R"(WITH has_perms AS (%s),
-      my_txs AS (%s),
-      first_hash AS (%s),
-      total_size AS (
-        SELECT COUNT(*) FROM my_txs
-      ),
-      t AS (
-        SELECT my_txs.height, my_txs.index
-        FROM my_txs JOIN
-        first_hash ON my_txs.height > first_hash.height
-        OR (my_txs.height = first_hash.height AND
-            my_txs.index >= first_hash.index)
-        LIMIT :page_size
-      )
-      SELECT height, index, count, perm FROM t
-      RIGHT OUTER JOIN has_perms ON TRUE
-      JOIN total_size ON TRUE
-      )");
-
-      // select tx with specified hash
-      auto first_by_hash = R"(SELECT height, index FROM position_by_hash
-      WHERE hash = :hash LIMIT 1)";
-
-      // select first ever tx
-      auto first_tx = R"(SELECT height, index FROM position_by_hash
-      ORDER BY height, index ASC LIMIT 1)";
-
-      auto cmd = base % hasQueryPermission(creator_id_, q.accountId(), perms...)
-          % related_txs;
+      args.insert(args.begin(), sqlLiteral(creator_id_));
+      args.push_back(std::to_string(query_size));
       if (first_hash) {
-        cmd = base % first_by_hash;
-      } else {
-        cmd = base % first_tx;
+        args.push_back(sqlLiteral(first_hash->hex()));
       }
 
-      auto query = cmd.str();
+      auto query =
+          executeStatement(first_hash ? statement + "FromHash" : statement,
+                           args);
 
       return executeQuery<QueryTuple, PermissionTuple>(
-          applier(query),
+          statement,
+          [&] { return sql_.prepare << query; },
           [&](auto range, auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
             uint64_t total_size = 0;
@@ -468,23 +786,9 @@ namespace iroha {
                     std::string>;
       using PermissionTuple = boost::tuple<int>;
 
-      auto cmd = (boost::format(R"(WITH has_perms AS (%s),
-      t AS (
-          SELECT a.account_id, a.domain_id, a.quorum, a.data, ARRAY_AGG(ar.role_id) AS roles
-          FROM account AS a, account_has_roles AS ar
-          WHERE a.account_id = :target_account_id
-          AND ar.account_id = a.account_id
-          GROUP BY a.account_id
-      )
-      SELECT account_id, domain_id, quorum, data, roles, perm
-      FROM t RIGHT OUTER JOIN has_perms AS p ON TRUE
-      )")
-                  % hasQueryPermission(creator_id_,
-                                       q.accountId(),
-                                       Role::kGetMyAccount,
-                                       Role::kGetAllAccounts,
-                                       Role::kGetDomainAccounts))
-                     .str();
+      auto cmd =
+          executeStatement("getAccount",
+                           {sqlLiteral(creator_id_), sqlLiteral(q.accountId())});
 
       auto query_apply = [this](auto &account_id,
                                 auto &domain_id,
@@ -500,10 +804,8 @@ namespace iroha {
       };
 
       return executeQuery<QueryTuple, PermissionTuple>(
-          [&] {
-            return (sql_.prepare << cmd,
-                    soci::use(q.accountId(), "target_account_id"));
-          },
+          "getAccount",
+          [&] { return sql_.prepare << cmd; },
           [this, &q, &query_apply](auto range, auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
             if (range_without_nulls.empty()) {
@@ -546,14 +848,22 @@ namespace iroha {
         return "could not retrieve block with given height: "
             + std::to_string(height);
       };
-      auto serialized_block = block_store_.get(q.height());
+      auto serialized_block = block_store_.getView(q.height());
       if (not serialized_block) {
         // for some reason, block with such height was not retrieved
         return logAndReturnErrorResponse(
             QueryErrorType::kStatefulFailed, block_deserialization_msg(), 1);
       }
+      if (shared_model::proto::ProtoBlockJsonConverter::isBinary(
+              serialized_block->charData(), serialized_block->size())) {
+        return query_response_factory_->createSerializedBlockResponse(
+            std::string(serialized_block->charData(),
+                        serialized_block->size()),
+            query_hash_);
+      }
 
-      return converter_->deserialize(bytesToString(*serialized_block))
+      return converter_
+          ->deserialize(serialized_block->charData(), serialized_block->size())
           .match(
               [this](auto &&block) {
                 return this->query_response_factory_->createBlockResponse(
@@ -574,23 +884,13 @@ namespace iroha {
       using QueryTuple = QueryType<std::string>;
       using PermissionTuple = boost::tuple<int>;
 
-      auto cmd = (boost::format(R"(WITH has_perms AS (%s),
-      t AS (
-          SELECT public_key FROM account_has_signatory
-          WHERE account_id = :account_id
-      )
-      SELECT public_key, perm FROM t
-      RIGHT OUTER JOIN has_perms ON TRUE
-      )")
-                  % hasQueryPermission(creator_id_,
-                                       q.accountId(),
-                                       Role::kGetMySignatories,
-                                       Role::kGetAllSignatories,
-                                       Role::kGetDomainSignatories))
-                     .str();
+      auto cmd =
+          executeStatement("getSignatories",
+                           {sqlLiteral(creator_id_), sqlLiteral(q.accountId())});
 
       return executeQuery<QueryTuple, PermissionTuple>(
-          [&] { return (sql_.prepare << cmd, soci::use(q.accountId())); },
+          "getSignatories",
+          [&] { return sql_.prepare << cmd; },
           [this, &q](auto range, auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
             if (range_without_nulls.empty()) {
@@ -618,31 +918,6 @@ namespace iroha {
 
     QueryExecutorResult PostgresSpecificQueryExecutor::operator()(
         const shared_model::interface::GetAccountTransactions &q) {
-      std::string related_txs = R"(SELECT DISTINCT height, index
-      FROM tx_position_by_creator
-      WHERE creator_id = :account_id
-      ORDER BY height, index ASC)";
-
-      const auto &pagination_info = q.paginationMeta();
-      auto first_hash = pagination_info.firstTxHash();
-      // retrieve one extra transaction to populate next_hash
-      auto query_size = pagination_info.pageSize() + 1u;
-
-      auto apply_query = [&](const auto &query) {
-        return [&] {
-          if (first_hash) {
-            return (sql_.prepare << query,
-                    soci::use(q.accountId()),
-                    soci::use(first_hash->hex()),
-                    soci::use(query_size));
-          } else {
-            return (sql_.prepare << query,
-                    soci::use(q.accountId()),
-                    soci::use(query_size));
-          }
-        };
-      };
-
       auto check_query = [this](const auto &q) {
         if (this->existsInDb<int>(
                 "account", "account_id", "quorum", q.accountId())) {
@@ -654,8 +929,8 @@ namespace iroha {
 
       return executeTransactionsQuery(q,
                                       std::move(check_query),
-                                      related_txs,
-                                      apply_query,
+                                      "getAccountTransactions",
+                                      {sqlLiteral(q.accountId())},
                                       Role::kGetMyAccTxs,
                                       Role::kGetAllAccTxs,
                                       Role::kGetDomainAccTxs);
@@ -663,32 +938,38 @@ namespace iroha {
 
     QueryExecutorResult PostgresSpecificQueryExecutor::operator()(
         const shared_model::interface::GetTransactions &q) {
-      auto escape = [](auto &hash) { return "'" + hash.hex() + "'"; };
+      auto escape = [](auto &hash) {
+        return "decode('" + hash.hex() + "', 'hex')";
+      };
       std::string hash_str = std::accumulate(
           std::next(q.transactionHashes().begin()),
           q.transactionHashes().end(),
           escape(q.transactionHashes().front()),
           [&escape](auto &acc, auto &val) { return acc + "," + escape(val); });
 
-      using QueryTuple =
-          QueryType<shared_model::interface::types::HeightType, std::string>;
+      using QueryTuple = QueryType<shared_model::interface::types::HeightType,
+                                   uint64_t,
+                                   std::string>;
       using PermissionTuple = boost::tuple<int, int>;
 
       auto cmd =
           (boost::format(R"(WITH has_my_perm AS (%s),
       has_all_perm AS (%s),
       t AS (
-          SELECT height, hash FROM position_by_hash WHERE hash IN (%s)
+          SELECT height, index, encode(hash, 'hex') AS hash
+          FROM position_by_hash
+          WHERE hash IN (%s)
       )
-      SELECT height, hash, has_my_perm.perm, has_all_perm.perm FROM t
+      SELECT height, index, hash, has_my_perm.perm, has_all_perm.perm FROM t
       RIGHT OUTER JOIN has_my_perm ON TRUE
       RIGHT OUTER JOIN has_all_perm ON TRUE
-      )") % getAccountRolePermissionCheckSql(Role::kGetMyTxs, "account_id")
-           % getAccountRolePermissionCheckSql(Role::kGetAllTxs, "account_id")
+      )") % getAccountRolePermissionCheckSql(Role::kGetMyTxs, ":account_id")
+           % getAccountRolePermissionCheckSql(Role::kGetAllTxs, ":account_id")
            % hash_str)
               .str();
 
       return executeQuery<QueryTuple, PermissionTuple>(
+          "getTransactions",
           [&] {
             return (sql_.prepare << cmd, soci::use(creator_id_, "account_id"));
           },
@@ -705,31 +986,45 @@ namespace iroha {
                   "At least one of the supplied hashes is incorrect",
                   4);
             }
-            std::map<uint64_t, std::unordered_set<std::string>> index;
+            // every block is read once and only the requested transactions
+            // of it are taken, their positions in the request keep its order
+            std::map<uint64_t, std::vector<uint64_t>> index;
+            std::unordered_map<std::string, size_t> request_position;
             for (const auto &t : range_without_nulls) {
-              apply(t, [&index](auto &height, auto &hash) {
-                index[height].insert(hash);
+              apply(t, [&index](auto &height, auto &idx, auto &) {
+                index[height].push_back(idx);
               });
             }
+            for (const auto &hash : q.transactionHashes()) {
+              request_position.emplace(hash.hex(), request_position.size());
+            }
 
             std::vector<std::unique_ptr<shared_model::interface::Transaction>>
-                response_txs;
+                ordered_txs(request_position.size());
             for (auto &block : index) {
               auto txs = this->getTransactionsFromBlock(
                   block.first,
-                  [](auto size) {
-                    return boost::irange(static_cast<decltype(size)>(0), size);
-                  },
+                  [&block](auto) { return block.second; },
                   [&](auto &tx) {
-                    return block.second.count(tx.hash().hex()) > 0
-                        and (all_perm
-                             or (my_perm
-                                 and tx.creatorAccountId() == creator_id_));
+                    return all_perm
+                        or (my_perm and tx.creatorAccountId() == creator_id_);
                   });
-              std::move(
-                  txs.begin(), txs.end(), std::back_inserter(response_txs));
+              for (auto &tx : txs) {
+                auto position = request_position.find(tx->hash().hex());
+                if (position != request_position.end()) {
+                  ordered_txs[position->second] = std::move(tx);
+                }
+              }
             }
 
+            std::vector<std::unique_ptr<shared_model::interface::Transaction>>
+                response_txs;
+            response_txs.reserve(ordered_txs.size());
+            for (auto &tx : ordered_txs) {
+              if (tx) {
+                response_txs.push_back(std::move(tx));
+              }
+            }
             return query_response_factory_->createTransactionsResponse(
                 std::move(response_txs), query_hash_);
           },
@@ -739,34 +1034,6 @@ namespace iroha {
 
     QueryExecutorResult PostgresSpecificQueryExecutor::operator()(
         const shared_model::interface::GetAccountAssetTransactions &q) {
-      std::string related_txs = R"(SELECT DISTINCT height, index
-          FROM position_by_account_asset
-          WHERE account_id = :account_id
-          AND asset_id = :asset_id
-          ORDER BY height, index ASC)";  // consider index when changing this
-
-      const auto &pagination_info = q.paginationMeta();
-      auto first_hash = pagination_info.firstTxHash();
-      // retrieve one extra transaction to populate next_hash
-      auto query_size = pagination_info.pageSize() + 1u;
-
-      auto apply_query = [&](const auto &query) {
-        return [&] {
-          if (first_hash) {
-            return (sql_.prepare << query,
-                    soci::use(q.accountId()),
-                    soci::use(q.assetId()),
-                    soci::use(first_hash->hex()),
-                    soci::use(query_size));
-          } else {
-            return (sql_.prepare << query,
-                    soci::use(q.accountId()),
-                    soci::use(q.assetId()),
-                    soci::use(query_size));
-          }
-        };
-      };
-
       auto check_query = [this](const auto &q) {
         if (not this->existsInDb<int>(
                 "account", "account_id", "quorum", q.accountId())) {
@@ -782,13 +1049,14 @@ namespace iroha {
         return QueryFallbackCheckResult{};
       };
 
-      return executeTransactionsQuery(q,
-                                      std::move(check_query),
-                                      related_txs,
-                                      apply_query,
-                                      Role::kGetMyAccAstTxs,
-                                      Role::kGetAllAccAstTxs,
-                                      Role::kGetDomainAccAstTxs);
+      return executeTransactionsQuery(
+          q,
+          std::move(check_query),
+          "getAccountAssetTransactions",
+          {sqlLiteral(q.accountId()), sqlLiteral(q.assetId())},
+          Role::kGetMyAccAstTxs,
+          Role::kGetAllAccAstTxs,
+          Role::kGetDomainAccAstTxs);
     }
 
     QueryExecutorResult PostgresSpecificQueryExecutor::operator()(
@@ -800,51 +1068,6 @@ namespace iroha {
                     size_t>;
       using PermissionTuple = boost::tuple<int>;
 
-      // get the assets
-      auto cmd = (boost::format(R"(
-      with has_perms as (%s),
-      all_data as (
-          select row_number() over () rn, *
-          from (
-              select *
-              from account_has_asset
-              where account_id = :account_id
-              order by asset_id
-          ) t
-      ),
-      total_number as (
-          select rn total_number
-          from all_data
-          order by rn desc
-          limit 1
-      ),
-      page_start as (
-          select rn
-          from all_data
-          where coalesce(asset_id = :first_asset_id, true)
-          limit 1
-      ),
-      page_data as (
-          select * from all_data, page_start, total_number
-          where
-              all_data.rn >= page_start.rn and
-              coalesce( -- TODO remove after pagination is mandatory IR-516
-                  all_data.rn < page_start.rn + :page_size,
-                  true
-              )
-      )
-      select account_id, asset_id, amount, total_number, perm
-          from
-              page_data
-              right join has_perms on true
-      )")
-                  % hasQueryPermission(creator_id_,
-                                       q.accountId(),
-                                       Role::kGetMyAccAst,
-                                       Role::kGetAllAccAst,
-                                       Role::kGetDomainAccAst))
-                     .str();
-
       // These must stay alive while soci query is being done.
       const auto pagination_meta{q.paginationMeta()};
       const auto req_first_asset_id =
@@ -857,19 +1080,23 @@ namespace iroha {
             return boost::optional<size_t>(pagination_meta.pageSize() + 1);
           };
 
+      // get the assets
+      auto cmd = executeStatement("getAccountAssets",
+                                  {sqlLiteral(creator_id_),
+                                   sqlLiteral(q.accountId()),
+                                   sqlLiteral(req_first_asset_id),
+                                   sqlLiteral(req_page_size)});
+
       return executeQuery<QueryTuple, PermissionTuple>(
-          [&] {
-            return (sql_.prepare << cmd,
-                    soci::use(q.accountId(), "account_id"),
-                    soci::use(req_first_asset_id, "first_asset_id"),
-                    soci::use(req_page_size, "page_size"));
-          },
+          "getAccountAssets",
+          [&] { return sql_.prepare << cmd; },
           [&](auto range, auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
+            // balances are passed as they are stored, they are valid amounts
             std::vector<
                 std::tuple<shared_model::interface::types::AccountIdType,
                            shared_model::interface::types::AssetIdType,
-                           shared_model::interface::Amount>>
+                           std::string>>
                 assets;
             size_t total_number = 0;
             for (const auto &row : range_without_nulls) {
@@ -879,10 +1106,9 @@ namespace iroha {
                                              auto &amount,
                                              auto &total_number_col) {
                       total_number = total_number_col;
-                      assets.push_back(std::make_tuple(
-                          std::move(account_id),
-                          std::move(asset_id),
-                          shared_model::interface::Amount(amount)));
+                      assets.push_back(std::make_tuple(std::move(account_id),
+                                                       std::move(asset_id),
+                                                       std::move(amount)));
                     });
             }
             if (assets.empty() and req_first_asset_id) {
@@ -919,88 +1145,6 @@ namespace iroha {
                     uint32_t>;
       using PermissionTuple = boost::tuple<int>;
 
-      auto cmd = (boost::format(R"(
-      with has_perms as (%s),
-      detail AS (
-          with filtered_plain_data as (
-              select row_number() over () rn, *
-              from (
-                  select
-                      data_by_writer.key writer,
-                      plain_data.key as key,
-                      plain_data.value as value
-                  from
-                      jsonb_each((
-                          select data
-                          from account
-                          where account_id = :account_id
-                      )) data_by_writer,
-                  jsonb_each(data_by_writer.value) plain_data
-                  where
-                      coalesce(data_by_writer.key = :writer, true) and
-                      coalesce(plain_data.key = :key, true)
-                  order by data_by_writer.key asc, plain_data.key asc
-              ) t
-          ),
-          page_limits as (
-              select start.rn as start, start.rn + :page_size as end
-                  from (
-                      select rn
-                      from filtered_plain_data
-                      where
-                          coalesce(writer = :first_record_writer, true) and
-                          coalesce(key = :first_record_key, true)
-                      limit 1
-                  ) start
-          ),
-          total_number as (select count(1) total_number from filtered_plain_data),
-          next_record as (
-              select writer, key
-              from
-                  filtered_plain_data,
-                  page_limits
-              where rn = page_limits.end
-          ),
-          page as (
-              select json_object_agg(writer, data_by_writer) json
-              from (
-                  select writer, json_object_agg(key, value) data_by_writer
-                  from
-                      filtered_plain_data,
-                      page_limits
-                  where
-                      rn >= page_limits.start and
-                      coalesce(rn < page_limits.end, true)
-                  group by writer
-              ) t
-          ),
-          target_account_exists as (
-            select count(1) val
-            from account
-            where account_id = :account_id
-          )
-          select
-              page.json json,
-              total_number,
-              next_record.writer next_writer,
-              next_record.key next_key,
-              target_account_exists.val target_account_exists
-          from
-              page
-              left join total_number on true
-              left join next_record on true
-              right join target_account_exists on true
-      )
-      select detail.*, perm from detail
-      right join has_perms on true
-      )")
-                  % hasQueryPermission(creator_id_,
-                                       q.accountId(),
-                                       Role::kGetMyAccDetail,
-                                       Role::kGetAllAccDetail,
-                                       Role::kGetDomainAccDetail))
-                     .str();
-
       const auto writer = q.writer();
       const auto key = q.key();
       boost::optional<std::string> first_record_writer;
@@ -1016,16 +1160,18 @@ namespace iroha {
         };
       };
 
+      auto cmd = executeStatement("getAccountDetail",
+                                  {sqlLiteral(creator_id_),
+                                   sqlLiteral(q.accountId()),
+                                   sqlLiteral(writer),
+                                   sqlLiteral(key),
+                                   sqlLiteral(first_record_writer),
+                                   sqlLiteral(first_record_key),
+                                   sqlLiteral(page_size)});
+
       return executeQuery<QueryTuple, PermissionTuple>(
-          [&] {
-            return (sql_.prepare << cmd,
-                    soci::use(q.accountId(), "account_id"),
-                    soci::use(writer, "writer"),
-                    soci::use(key, "key"),
-                    soci::use(first_record_writer, "first_record_writer"),
-                    soci::use(first_record_key, "first_record_key"),
-                    soci::use(page_size, "page_size"));
-          },
+          "getAccountDetail",
+          [&] { return sql_.prepare << cmd; },
           [&, this](auto range, auto &) {
             if (range.empty()) {
               assert(not range.empty());
@@ -1080,7 +1226,7 @@ namespace iroha {
                           return boost::none;
                         }()};
                     return query_response_factory_->createAccountDetailResponse(
-                        json.value(),
+                        std::move(json.value()),
                         total_number.value_or(0),
                         next_record_id,
                         query_hash_);
@@ -1110,18 +1256,11 @@ namespace iroha {
       using QueryTuple = QueryType<shared_model::interface::types::RoleIdType>;
       using PermissionTuple = boost::tuple<int>;
 
-      auto cmd = (boost::format(
-                      R"(WITH has_perms AS (%s)
-      SELECT role_id, perm FROM role
-      RIGHT OUTER JOIN has_perms ON TRUE
-      )") % getAccountRolePermissionCheckSql(Role::kGetRoles))
-                     .str();
+      auto cmd = executeStatement("getRoles", {sqlLiteral(creator_id_)});
 
       return executeQuery<QueryTuple, PermissionTuple>(
-          [&] {
-            return (sql_.prepare << cmd,
-                    soci::use(creator_id_, "role_account_id"));
-          },
+          "getRoles",
+          [&] { return sql_.prepare << cmd; },
           [&](auto range, auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
             auto roles = boost::copy_range<
@@ -1141,21 +1280,13 @@ namespace iroha {
       using QueryTuple = QueryType<std::string>;
       using PermissionTuple = boost::tuple<int>;
 
-      auto cmd = (boost::format(
-                      R"(WITH has_perms AS (%s),
-      perms AS (SELECT permission FROM role_has_permissions
-                WHERE role_id = :role_name)
-      SELECT permission, perm FROM perms
-      RIGHT OUTER JOIN has_perms ON TRUE
-      )") % getAccountRolePermissionCheckSql(Role::kGetRoles))
-                     .str();
+      auto cmd = executeStatement(
+          "getRolePermissions",
+          {sqlLiteral(creator_id_), sqlLiteral(q.roleId())});
 
       return executeQuery<QueryTuple, PermissionTuple>(
-          [&] {
-            return (sql_.prepare << cmd,
-                    soci::use(creator_id_, "role_account_id"),
-                    soci::use(q.roleId(), "role_name"));
-          },
+          "getRolePermissions",
+          [&] { return sql_.prepare << cmd; },
           [this, &q](auto range, auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
             if (range_without_nulls.empty()) {
@@ -1180,21 +1311,12 @@ namespace iroha {
           QueryType<shared_model::interface::types::DomainIdType, uint32_t>;
       using PermissionTuple = boost::tuple<int>;
 
-      auto cmd = (boost::format(
-                      R"(WITH has_perms AS (%s),
-      perms AS (SELECT domain_id, precision FROM asset
-                WHERE asset_id = :asset_id)
-      SELECT domain_id, precision, perm FROM perms
-      RIGHT OUTER JOIN has_perms ON TRUE
-      )") % getAccountRolePermissionCheckSql(Role::kReadAssets))
-                     .str();
+      auto cmd = executeStatement(
+          "getAssetInfo", {sqlLiteral(creator_id_), sqlLiteral(q.assetId())});
 
       return executeQuery<QueryTuple, PermissionTuple>(
-          [&] {
-            return (sql_.prepare << cmd,
-                    soci::use(creator_id_, "role_account_id"),
-                    soci::use(q.assetId(), "asset_id"));
-          },
+          "getAssetInfo",
+          [&] { return sql_.prepare << cmd; },
           [this, &q](auto range, auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
             if (range_without_nulls.empty()) {
@@ -1283,18 +1405,11 @@ namespace iroha {
           QueryType<std::string, shared_model::interface::types::AddressType>;
       using PermissionTuple = boost::tuple<int>;
 
-      auto cmd = (boost::format(
-                      R"(WITH has_perms AS (%s)
-      SELECT public_key, address, perm FROM peer
-      RIGHT OUTER JOIN has_perms ON TRUE
-      )") % getAccountRolePermissionCheckSql(Role::kGetPeers))
-                     .str();
+      auto cmd = executeStatement("getPeers", {sqlLiteral(creator_id_)});
 
       return executeQuery<QueryTuple, PermissionTuple>(
-          [&] {
-            return (sql_.prepare << cmd,
-                    soci::use(creator_id_, "role_account_id"));
-          },
+          "getPeers",
+          [&] { return sql_.prepare << cmd; },
           [&](auto range, auto &) {
             auto range_without_nulls = resultWithoutNulls(std::move(range));
             shared_model::interface::types::PeerList peers;
@@ -1328,5 +1443,13 @@ namespace iroha {
       return result.begin() != result.end();
     }
 
+    void PostgresSpecificQueryExecutor::prepareStatements(soci::session &sql) {
+      for (const auto &statement : queryStatements()) {
+        sql << (boost::format("PREPARE %s (%s) AS %s") % statement.name
+                % statement.arg_types % statement.body)
+                   .str();
+      }
+    }
+
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -38,6 +38,7 @@ namespace iroha {
 
   namespace ametsuchi {
 
+    class BlockCache;
     class KeyValueStorage;
 
     using QueryErrorType =
@@ -52,6 +53,7 @@ namespace iroha {
       PostgresSpecificQueryExecutor(
           soci::session &sql,
           KeyValueStorage &block_store,
+          std::shared_ptr<BlockCache> block_cache,
           std::shared_ptr<PendingTransactionStorage> pending_txs_storage,
           std::shared_ptr<shared_model::interface::BlockJsonConverter>
               converter,
@@ -112,6 +114,12 @@ namespace iroha {
       QueryExecutorResult operator()(
           const shared_model::interface::GetPeers &q);
 
+      /**
+       * Prepare statements of queries for the given session. Must be called
+       * once for every session used by the executor
+       */
+      static void prepareStatements(soci::session &sql);
+
      private:
       /**
        * Get transactions from block using range from range_gen and filtered by
@@ -132,6 +140,7 @@ namespace iroha {
        * the query, successful or error one
        * @tparam PermissionsErrResponse - type of function, which creates error
        * response in case something wrong with permissions
+       * @param statement_name - name of the statement for its metrics
        * @param query_executor - function, executing query
        * @param response_creator - function, creating query response
        * @param perms_err_response - function, creating error response
@@ -143,6 +152,7 @@ namespace iroha {
                 typename ResponseCreator,
                 typename PermissionsErrResponse>
       QueryExecutorResult executeQuery(
+          const std::string &statement_name,
           QueryExecutor &&query_executor,
           ResponseCreator &&response_creator,
           PermissionsErrResponse &&perms_err_response);
@@ -165,22 +175,18 @@ namespace iroha {
        * @param query - query object
        * @param qry_checker - fallback checker of the query, needed if paging
        * hash is not specified and 0 transaction are returned as a query result
-       * @param related_txs - SQL query which returns transaction relevant
-       * to this query
-       * @param applier - function which accepts SQL
-       * and returns another function which executes that query
+       * @param statement - name of prepared statement which returns
+       * transactions relevant to this query
+       * @param args - SQL literals of the query specific statement parameters
        * @param perms - permissions, necessary to execute the query
        * @return Result of a query execution
        */
-      template <typename Query,
-                typename QueryChecker,
-                typename QueryApplier,
-                typename... Permissions>
+      template <typename Query, typename QueryChecker, typename... Permissions>
       QueryExecutorResult executeTransactionsQuery(
           const Query &query,
           QueryChecker &&qry_checker,
-          const std::string &related_txs,
-          QueryApplier applier,
+          const std::string &statement,
+          std::vector<std::string> args,
           Permissions... perms);
 
       /**
@@ -227,6 +233,8 @@ namespace iroha {
 
       soci::session &sql_;
       KeyValueStorage &block_store_;
+      /// parsed recently committed blocks, may be null
+      std::shared_ptr<BlockCache> block_cache_;
       shared_model::interface::types::AccountIdType creator_id_;
       shared_model::interface::types::HashType query_hash_;
       std::shared_ptr<PendingTransactionStorage> pending_txs_storage_;
@@ -177,8 +177,13 @@ namespace iroha {
     WsvCommandResult PostgresWsvCommand::insertAccount(
         const shared_model::interface::Account &account) {
       soci::statement st = sql_.prepare
-          << "INSERT INTO account(account_id, domain_id, quorum,"
-             "data) VALUES (:id, :domain_id, :quorum, :data)";
+          << "WITH inserted AS (INSERT INTO account(account_id, domain_id, "
+             "quorum) VALUES (:id, :domain_id, :quorum) RETURNING account_id) "
+             "INSERT INTO account_has_detail(account_id, writer, key, value) "
+             "SELECT inserted.account_id, by_writer.key, detail.key, "
+             "detail.value FROM inserted, "
+             "jsonb_each(CAST(:data AS jsonb)) AS by_writer, "
+             "jsonb_each(by_writer.value) AS detail";
       uint32_t quorum = account.quorum();
       st.exchange(soci::use(account.accountId()));
       st.exchange(soci::use(account.domainId()));
@@ -242,15 +247,16 @@ namespace iroha {
 
     WsvCommandResult PostgresWsvCommand::insertSignatory(
         const shared_model::interface::types::PubkeyType &signatory) {
+      const auto signatory_hex = signatory.hex();
       soci::statement st = sql_.prepare
-          << "INSERT INTO signatory(public_key) VALUES (:pk) ON CONFLICT DO "
-             "NOTHING;";
-      st.exchange(soci::use(signatory.hex()));
+          << "INSERT INTO signatory(public_key) VALUES (decode(:pk, 'hex')) "
+             "ON CONFLICT DO NOTHING;";
+      st.exchange(soci::use(signatory_hex));
 
       auto msg = [&] {
         return (boost::format(
                     "failed to insert signatory, signatory hex string: '%s'")
-                % signatory.hex())
+                % signatory_hex)
             .str();
       };
       return execute(st, msg);
@@ -259,16 +265,17 @@ namespace iroha {
     WsvCommandResult PostgresWsvCommand::insertAccountSignatory(
         const shared_model::interface::types::AccountIdType &account_id,
         const shared_model::interface::types::PubkeyType &signatory) {
+      const auto signatory_hex = signatory.hex();
       soci::statement st = sql_.prepare
           << "INSERT INTO account_has_signatory(account_id, public_key) "
-             "VALUES (:account_id, :pk)";
+             "VALUES (:account_id, decode(:pk, 'hex'))";
       st.exchange(soci::use(account_id));
-      st.exchange(soci::use(signatory.hex()));
+      st.exchange(soci::use(signatory_hex));
 
       auto msg = [&] {
         return (boost::format("failed to insert account signatory, account id: "
                               "'%s', signatory hex string: '%s")
-                % account_id % signatory.hex())
+                % account_id % signatory_hex)
             .str();
       };
       return execute(st, msg);
@@ -277,16 +284,17 @@ namespace iroha {
     WsvCommandResult PostgresWsvCommand::deleteAccountSignatory(
         const shared_model::interface::types::AccountIdType &account_id,
         const shared_model::interface::types::PubkeyType &signatory) {
+      const auto signatory_hex = signatory.hex();
       soci::statement st = sql_.prepare
           << "DELETE FROM account_has_signatory WHERE account_id = "
-             ":account_id AND public_key = :pk";
+             ":account_id AND public_key = decode(:pk, 'hex')";
       st.exchange(soci::use(account_id));
-      st.exchange(soci::use(signatory.hex()));
+      st.exchange(soci::use(signatory_hex));
 
       auto msg = [&] {
         return (boost::format("failed to delete account signatory, account id: "
                               "'%s', signatory hex string: '%s'")
-                % account_id % signatory.hex())
+                % account_id % signatory_hex)
             .str();
       };
       return execute(st, msg);
@@ -294,17 +302,18 @@ namespace iroha {
 
     WsvCommandResult PostgresWsvCommand::deleteSignatory(
         const shared_model::interface::types::PubkeyType &signatory) {
+      const auto signatory_hex = signatory.hex();
       soci::statement st = sql_.prepare
-          << "DELETE FROM signatory WHERE public_key = :pk AND NOT EXISTS "
-             "(SELECT 1 FROM account_has_signatory "
-             "WHERE public_key = :pk) AND NOT EXISTS (SELECT 1 FROM peer "
-             "WHERE public_key = :pk)";
-      st.exchange(soci::use(signatory.hex(), "pk"));
+          << "DELETE FROM signatory WHERE public_key = decode(:pk, 'hex') "
+             "AND NOT EXISTS (SELECT 1 FROM account_has_signatory "
+             "WHERE public_key = decode(:pk, 'hex')) AND NOT EXISTS "
+             "(SELECT 1 FROM peer WHERE public_key = decode(:pk, 'hex'))";
+      st.exchange(soci::use(signatory_hex, "pk"));
 
       auto msg = [&] {
         return (boost::format(
                     "failed to delete signatory, signatory hex string: '%s'")
-                % signatory.hex())
+                % signatory_hex)
             .str();
       };
       return execute(st, msg);
@@ -312,15 +321,17 @@ namespace iroha {
 
     WsvCommandResult PostgresWsvCommand::insertPeer(
         const shared_model::interface::Peer &peer) {
+      const auto pubkey_hex = peer.pubkey().hex();
       soci::statement st = sql_.prepare
-          << "INSERT INTO peer(public_key, address) VALUES (:pk, :address)";
-      st.exchange(soci::use(peer.pubkey().hex()));
+          << "INSERT INTO peer(public_key, address) "
+             "VALUES (decode(:pk, 'hex'), :address)";
+      st.exchange(soci::use(pubkey_hex));
       st.exchange(soci::use(peer.address()));
 
       auto msg = [&] {
         return (boost::format(
                     "failed to insert peer, public key: '%s', address: '%s'")
-                % peer.pubkey().hex() % peer.address())
+                % pubkey_hex % peer.address())
             .str();
       };
       return execute(st, msg);
@@ -328,15 +339,17 @@ namespace iroha {
 
     WsvCommandResult PostgresWsvCommand::deletePeer(
         const shared_model::interface::Peer &peer) {
+      const auto pubkey_hex = peer.pubkey().hex();
       soci::statement st = sql_.prepare
-          << "DELETE FROM peer WHERE public_key = :pk AND address = :address";
-      st.exchange(soci::use(peer.pubkey().hex()));
+          << "DELETE FROM peer WHERE public_key = decode(:pk, 'hex') "
+             "AND address = :address";
+      st.exchange(soci::use(pubkey_hex));
       st.exchange(soci::use(peer.address()));
 
       auto msg = [&] {
         return (boost::format(
                     "failed to delete peer, public key: '%s', address: '%s'")
-                % peer.pubkey().hex() % peer.address())
+                % pubkey_hex % peer.address())
             .str();
       };
       return execute(st, msg);
@@ -382,20 +395,15 @@ namespace iroha {
         const std::string &key,
         const std::string &val) {
       soci::statement st = sql_.prepare
-          << "UPDATE account SET data = jsonb_set("
-             "CASE WHEN data ?:creator_account_id THEN data ELSE "
-             "jsonb_set(data, :json, :empty_json) END, "
-             " :filled_json, :val) WHERE account_id=:account_id";
-      std::string json = "{" + creator_account_id + "}";
-      std::string empty_json = "{}";
-      std::string filled_json = "{" + creator_account_id + ", " + key + "}";
+          << "INSERT INTO account_has_detail(account_id, writer, key, value) "
+             "VALUES (:account_id, :creator_account_id, :key, "
+             "CAST(:val AS jsonb)) ON CONFLICT (account_id, writer, key) "
+             "DO UPDATE SET value = excluded.value";
       std::string value = "\"" + val + "\"";
+      st.exchange(soci::use(account_id));
       st.exchange(soci::use(creator_account_id));
-      st.exchange(soci::use(json));
-      st.exchange(soci::use(empty_json));
-      st.exchange(soci::use(filled_json));
+      st.exchange(soci::use(key));
       st.exchange(soci::use(value));
-      st.exchange(soci::use(account_id));
 
       auto msg = [&] {
         return (boost::format(
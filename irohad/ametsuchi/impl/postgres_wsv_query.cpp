@@ -9,6 +9,7 @@
 #include "ametsuchi/impl/soci_utils.hpp"
 #include "backend/plain/peer.hpp"
 #include "common/result.hpp"
+#include "cryptography/hash.hpp"
 #include "cryptography/public_key.hpp"
 #include "logger/logger.hpp"
 
@@ -42,7 +43,8 @@ namespace iroha {
       using T = boost::tuple<std::string>;
       auto result = execute<T>([&] {
         return (sql_.prepare
-                    << "SELECT public_key FROM account_has_signatory WHERE "
+                    << "SELECT encode(public_key, 'hex') "
+                       "FROM account_has_signatory WHERE "
                        "account_id = :account_id",
                 soci::use(account_id));
       });
@@ -57,7 +59,8 @@ namespace iroha {
     PostgresWsvQuery::getPeers() {
       using T = boost::tuple<std::string, AddressType>;
       auto result = execute<T>([&] {
-        return (sql_.prepare << "SELECT public_key, address FROM peer");
+        return (sql_.prepare
+                << "SELECT encode(public_key, 'hex'), address FROM peer");
       });
 
       return flatMapValues<
@@ -71,5 +74,23 @@ namespace iroha {
                             public_key)}));
           });
     }
+
+    boost::optional<TopBlockInfo> PostgresWsvQuery::getTopBlockInfo() {
+      using T = boost::tuple<shared_model::interface::types::HeightType,
+                             std::string>;
+      auto result = execute<T>([&] {
+        return (sql_.prepare << "SELECT height, hash FROM top_block_info");
+      });
+      if (not result) {
+        return boost::none;
+      }
+      auto row = result->begin();
+      if (row == result->end()) {
+        return boost::none;
+      }
+      return TopBlockInfo{row->get<0>(),
+                          shared_model::crypto::Hash::fromHexString(
+                              row->get<1>())};
+    }
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -28,6 +28,8 @@ namespace iroha {
           std::vector<std::shared_ptr<shared_model::interface::Peer>>>
       getPeers() override;
 
+      boost::optional<TopBlockInfo> getTopBlockInfo() override;
+
      private:
       /**
        * Executes given lambda of type F, catches exceptions if any, logs the
@@ -0,0 +1,220 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/postgres_wsv_snapshot.hpp"
+
+#include <algorithm>
+
+#include <soci/soci.h>
+#include <boost/format.hpp>
+#include "ametsuchi/block_query.hpp"
+#include "ametsuchi/impl/postgres_wsv_query.hpp"
+#include "cryptography/default_hash_provider.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "logger/logger.hpp"
+
+namespace {
+  /// tables of the snapshot in the order of their dependencies
+  const std::vector<std::string> kSnapshotTables{
+      "role",
+      "domain",
+      "signatory",
+      "account",
+      "account_has_detail",
+      "account_has_signatory",
+      "peer",
+      "asset",
+      "account_has_asset",
+      "role_has_permissions",
+      "account_has_roles",
+      "account_has_grantable_permissions",
+      "interned_id",
+      "position_by_hash",
+      "tx_status_by_hash",
+      "tx_position_by_creator",
+      "position_by_account_asset",
+      "top_block_info"};
+
+  /// tables which may be partitioned by height
+  const std::vector<std::string> kHeightPartitionedTables{
+      "position_by_hash", "tx_position_by_creator", "position_by_account_asset"};
+
+  /// hash of a chunk which follows the one with prev_hash
+  shared_model::crypto::Hash chunkHash(
+      const shared_model::crypto::Hash &prev_hash,
+      const std::string &table,
+      const std::string &rows) {
+    std::string data(prev_hash.blob().begin(), prev_hash.blob().end());
+    data.append(table).push_back('\0');
+    data.append(rows);
+    return shared_model::crypto::DefaultHashProvider::makeHash(
+        shared_model::crypto::Blob(data));
+  }
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    constexpr size_t PostgresWsvSnapshotExporter::kChunkSize;
+
+    PostgresWsvSnapshotExporter::PostgresWsvSnapshotExporter(
+        std::unique_ptr<soci::session> sql,
+        std::shared_ptr<BlockQuery> block_query,
+        logger::LoggerPtr log)
+        : sql_(std::move(sql)),
+          block_query_(std::move(block_query)),
+          log_(std::move(log)) {}
+
+    expected::Result<std::shared_ptr<const shared_model::interface::Block>,
+                     std::string>
+    PostgresWsvSnapshotExporter::exportSnapshot(const ChunkHandler &handler) {
+      boost::optional<TopBlockInfo> top_block;
+      try {
+        *sql_ << "BEGIN ISOLATION LEVEL REPEATABLE READ READ ONLY";
+        top_block = PostgresWsvQuery(*sql_, log_).getTopBlockInfo();
+        if (not top_block) {
+          *sql_ << "ROLLBACK";
+          return expected::makeError("WSV has no top block info");
+        }
+
+        WsvSnapshotChunk chunk;
+        auto send = [&](const std::string &table) {
+          chunk.table = table;
+          chunk.rows.push_back(']');
+          chunk.hash = chunkHash(chunk.hash, chunk.table, chunk.rows);
+          auto sent = handler(chunk);
+          chunk.rows.clear();
+          return sent;
+        };
+        for (const auto &table : kSnapshotTables) {
+          soci::rowset<std::string> rows =
+              (sql_->prepare << "SELECT row_to_json(t)::text FROM " + table
+                       + " t");
+          for (const auto &row : rows) {
+            chunk.rows.push_back(chunk.rows.empty() ? '[' : ',');
+            chunk.rows.append(row);
+            if (chunk.rows.size() >= kChunkSize and not send(table)) {
+              *sql_ << "ROLLBACK";
+              return expected::makeError("Snapshot export was aborted");
+            }
+          }
+          if (not chunk.rows.empty() and not send(table)) {
+            *sql_ << "ROLLBACK";
+            return expected::makeError("Snapshot export was aborted");
+          }
+        }
+        *sql_ << "COMMIT";
+      } catch (const std::exception &e) {
+        try {
+          *sql_ << "ROLLBACK";
+        } catch (const std::exception &) {
+        }
+        return expected::makeError(
+            std::string{"Failed to export WSV snapshot: "} + e.what());
+      }
+
+      log_->info("Exported WSV snapshot at height {}", top_block->height);
+      return block_query_->getBlock(top_block->height)
+          .match(
+              [&top_block](auto &&block)
+                  -> expected::Result<
+                      std::shared_ptr<const shared_model::interface::Block>,
+                      std::string> {
+                if (block.value->hash() != top_block->top_hash) {
+                  return expected::makeError(
+                      "Top block of WSV does not match the block store");
+                }
+                return expected::makeValue(std::move(block.value));
+              },
+              [](auto &&err)
+                  -> expected::Result<
+                      std::shared_ptr<const shared_model::interface::Block>,
+                      std::string> { return std::move(err).error.message; });
+    }
+
+    PostgresWsvSnapshotImporter::PostgresWsvSnapshotImporter(
+        std::unique_ptr<soci::session> sql,
+        StoreBlock store_block,
+        logger::LoggerPtr log)
+        : sql_(std::move(sql)),
+          store_block_(std::move(store_block)),
+          committed_(false),
+          log_(std::move(log)) {}
+
+    PostgresWsvSnapshotImporter::~PostgresWsvSnapshotImporter() {
+      if (not committed_) {
+        try {
+          *sql_ << "ROLLBACK";
+        } catch (const std::exception &e) {
+          log_->warn("Failed to rollback snapshot import: {}", e.what());
+        }
+      }
+    }
+
+    expected::Result<void, std::string> PostgresWsvSnapshotImporter::apply(
+        const WsvSnapshotChunk &chunk) {
+      if (std::find(kSnapshotTables.begin(), kSnapshotTables.end(), chunk.table)
+          == kSnapshotTables.end()) {
+        return expected::makeError(
+            (boost::format("Unknown snapshot table %s") % chunk.table).str());
+      }
+      auto hash = chunkHash(last_hash_, chunk.table, chunk.rows);
+      if (hash != chunk.hash) {
+        return expected::makeError(
+            (boost::format("Wrong hash of snapshot chunk of table %s")
+             % chunk.table)
+                .str());
+      }
+      try {
+        if (std::find(kHeightPartitionedTables.begin(),
+                      kHeightPartitionedTables.end(),
+                      chunk.table)
+            != kHeightPartitionedTables.end()) {
+          *sql_ << "SELECT create_height_partitions("
+                   "COALESCE(max(height), 0)) FROM json_populate_recordset("
+                   "NULL::"
+                  + chunk.table + ", CAST(:rows AS json))",
+              soci::use(chunk.rows);
+        }
+        *sql_ << "INSERT INTO " + chunk.table
+                + " SELECT * FROM json_populate_recordset(NULL::" + chunk.table
+                + ", CAST(:rows AS json))",
+            soci::use(chunk.rows);
+        if (chunk.table == "interned_id") {
+          // ids are imported as they are, so the sequence has to skip them
+          *sql_ << "SELECT setval(pg_get_serial_sequence('interned_id', 'id'), "
+                   "max(id)) FROM interned_id";
+        }
+      } catch (const std::exception &e) {
+        return expected::makeError(
+            (boost::format("Failed to insert snapshot rows of table %s: %s")
+             % chunk.table % e.what())
+                .str());
+      }
+      last_hash_ = std::move(hash);
+      return {};
+    }
+
+    CommitResult PostgresWsvSnapshotImporter::commit(
+        std::shared_ptr<const shared_model::interface::Block> top_block) {
+      auto top_block_info = PostgresWsvQuery(*sql_, log_).getTopBlockInfo();
+      if (not top_block_info or top_block_info->height != top_block->height()
+          or top_block_info->top_hash != top_block->hash()) {
+        return expected::makeError(
+            "Snapshot does not correspond to the top block");
+      }
+      try {
+        *sql_ << "COMMIT";
+        committed_ = true;
+      } catch (const std::exception &e) {
+        return expected::makeError(
+            std::string{"Failed to commit WSV snapshot: "} + e.what());
+      }
+      log_->info("Imported WSV snapshot at height {}", top_block->height());
+      return store_block_(std::move(top_block));
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,90 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_POSTGRES_WSV_SNAPSHOT_HPP
+#define IROHA_POSTGRES_WSV_SNAPSHOT_HPP
+
+#include "ametsuchi/wsv_snapshot.hpp"
+
+#include "logger/logger_fwd.hpp"
+
+namespace soci {
+  class session;
+}
+
+namespace iroha {
+  namespace ametsuchi {
+
+    class BlockQuery;
+
+    /**
+     * Exports WSV and transaction index tables as JSON rows within a single
+     * read-only repeatable read transaction
+     */
+    class PostgresWsvSnapshotExporter : public WsvSnapshotExporter {
+     public:
+      /// chunk is sent when its rows reach this size
+      static constexpr size_t kChunkSize = 1024 * 1024;
+
+      /**
+       * @param sql - session to export tables with
+       * @param block_query - block query to retrieve the top block
+       * @param log - logger
+       */
+      PostgresWsvSnapshotExporter(std::unique_ptr<soci::session> sql,
+                                  std::shared_ptr<BlockQuery> block_query,
+                                  logger::LoggerPtr log);
+
+      expected::
+          Result<std::shared_ptr<const shared_model::interface::Block>,
+                 std::string>
+          exportSnapshot(const ChunkHandler &handler) override;
+
+     private:
+      std::unique_ptr<soci::session> sql_;
+      std::shared_ptr<BlockQuery> block_query_;
+      logger::LoggerPtr log_;
+    };
+
+    /**
+     * Imports snapshot tables in a transaction which starts with truncation
+     * of WSV and is committed after the top block is checked
+     */
+    class PostgresWsvSnapshotImporter : public WsvSnapshotImporter {
+     public:
+      /// stores the top block of the committed snapshot to the block store
+      using StoreBlock = std::function<CommitResult(
+          std::shared_ptr<const shared_model::interface::Block>)>;
+
+      /**
+       * @param sql - session with an open transaction and truncated WSV
+       * @param store_block - called after the snapshot is committed
+       * @param log - logger
+       */
+      PostgresWsvSnapshotImporter(std::unique_ptr<soci::session> sql,
+                                  StoreBlock store_block,
+                                  logger::LoggerPtr log);
+
+      ~PostgresWsvSnapshotImporter() override;
+
+      expected::Result<void, std::string> apply(
+          const WsvSnapshotChunk &chunk) override;
+
+      CommitResult commit(std::shared_ptr<const shared_model::interface::Block>
+                              top_block) override;
+
+     private:
+      std::unique_ptr<soci::session> sql_;
+      StoreBlock store_block_;
+      /// hash of the last applied chunk
+      shared_model::crypto::Hash last_hash_;
+      bool committed_;
+      logger::LoggerPtr log_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_POSTGRES_WSV_SNAPSHOT_HPP
@@ -0,0 +1,822 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/segmented_block_log/segmented_block_log.hpp"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+#include <boost/crc.hpp>
+#include <boost/filesystem.hpp>
+#include "common/files.hpp"
+#include "logger/logger.hpp"
+
+using namespace iroha::ametsuchi;
+using Identifier = SegmentedBlockLog::Identifier;
+using IndexEntry = SegmentedBlockLog::IndexEntry;
+using Segment = SegmentedBlockLog::Segment;
+
+const std::string SegmentedBlockLog::kSegmentExtension = ".seg";
+
+namespace {
+  /// number of digits in segment file name
+  constexpr size_t kNameDigits = 16;
+  /// | id | size | crc32 |
+  constexpr size_t kRecordHeaderSize = 12;
+  /// | id | size | offset |
+  constexpr size_t kIndexEntrySize = 16;
+  /// | index offset | entries count | index crc32 | magic |
+  constexpr size_t kFooterSize = 24;
+  /// "IRSEGLOG" in ASCII
+  constexpr uint64_t kFooterMagic = 0x474f4c4745535249ull;
+  /// maximum number of simultaneously open reader descriptors
+  constexpr size_t kMaxOpenReaders = 64;
+  /// maximum number of simultaneously mapped sealed segments
+  constexpr size_t kMaxOpenMappings = 64;
+  /// offset, size and memory alignment of direct writes
+  constexpr size_t kDirectIoAlignment = 4096;
+
+  // values are stored in native byte order
+  template <typename T>
+  void put(uint8_t *&dst, T value) {
+    std::memcpy(dst, &value, sizeof(T));
+    dst += sizeof(T);
+  }
+
+  template <typename T>
+  T take(const uint8_t *&src) {
+    T value;
+    std::memcpy(&value, src, sizeof(T));
+    src += sizeof(T);
+    return value;
+  }
+
+  uint32_t crc32(const uint8_t *data, size_t size) {
+    boost::crc_32_type crc;
+    crc.process_bytes(data, size);
+    return crc.checksum();
+  }
+
+  bool writeAll(int fd, const uint8_t *data, size_t size, uint64_t offset) {
+    while (size > 0) {
+      auto written = ::pwrite(fd, data, size, offset);
+      if (written < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return false;
+      }
+      data += written;
+      size -= written;
+      offset += written;
+    }
+    return true;
+  }
+
+  bool readAll(int fd, uint8_t *data, size_t size, uint64_t offset) {
+    while (size > 0) {
+      auto read = ::pread(fd, data, size, offset);
+      if (read < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return false;
+      }
+      if (read == 0) {
+        return false;
+      }
+      data += read;
+      size -= read;
+      offset += read;
+    }
+    return true;
+  }
+
+  std::string segmentName(Identifier id) {
+    std::ostringstream os;
+    os << std::setw(kNameDigits) << std::setfill('0') << id
+       << SegmentedBlockLog::kSegmentExtension;
+    return os.str();
+  }
+
+  bool isSegmentName(const boost::filesystem::path &path) {
+    auto stem = path.stem().string();
+    return path.extension() == SegmentedBlockLog::kSegmentExtension
+        and stem.size() == kNameDigits
+        and std::all_of(stem.begin(), stem.end(), ::isdigit);
+  }
+
+  /**
+   * Serialize index of the records and the footer starting from offset
+   */
+  std::vector<uint8_t> serializeIndex(uint64_t offset,
+                                      const std::vector<IndexEntry> &entries) {
+    std::vector<uint8_t> buf(entries.size() * kIndexEntrySize + kFooterSize);
+    auto dst = buf.data();
+    for (const auto &entry : entries) {
+      put<uint32_t>(dst, entry.id);
+      put<uint32_t>(dst, entry.size);
+      put<uint64_t>(dst, entry.offset);
+    }
+    put<uint64_t>(dst, offset);
+    put<uint32_t>(dst, entries.size());
+    put<uint32_t>(dst, crc32(buf.data(), entries.size() * kIndexEntrySize));
+    put<uint64_t>(dst, kFooterMagic);
+    return buf;
+  }
+
+  /**
+   * Try to read the index of a sealed segment
+   * @return records of the segment or none if the segment is not sealed
+   */
+  boost::optional<std::vector<IndexEntry>> readIndex(int fd,
+                                                     uint64_t file_size,
+                                                     uint32_t segment) {
+    if (file_size < kFooterSize) {
+      return boost::none;
+    }
+    uint8_t footer[kFooterSize];
+    if (not readAll(fd, footer, kFooterSize, file_size - kFooterSize)) {
+      return boost::none;
+    }
+    const uint8_t *src = footer;
+    auto index_offset = take<uint64_t>(src);
+    auto count = take<uint32_t>(src);
+    auto crc = take<uint32_t>(src);
+    auto magic = take<uint64_t>(src);
+    if (magic != kFooterMagic
+        or index_offset + uint64_t{count} * kIndexEntrySize + kFooterSize
+            != file_size) {
+      return boost::none;
+    }
+
+    std::vector<uint8_t> buf(count * kIndexEntrySize);
+    if (not readAll(fd, buf.data(), buf.size(), index_offset)
+        or crc32(buf.data(), buf.size()) != crc) {
+      return boost::none;
+    }
+
+    std::vector<IndexEntry> entries;
+    entries.reserve(count);
+    src = buf.data();
+    for (uint32_t i = 0; i < count; ++i) {
+      IndexEntry entry;
+      entry.id = take<uint32_t>(src);
+      entry.size = take<uint32_t>(src);
+      entry.offset = take<uint64_t>(src);
+      entry.segment = segment;
+      entries.push_back(entry);
+    }
+    return entries;
+  }
+
+  /**
+   * Sequentially scan records of an unsealed segment, up to the zero header
+   * of padding if any
+   * @param end - set to the end of the last valid record
+   * @return valid records of the segment
+   */
+  std::vector<IndexEntry> scanRecords(int fd,
+                                      uint64_t file_size,
+                                      uint32_t segment,
+                                      uint64_t &end) {
+    std::vector<IndexEntry> entries;
+    std::vector<uint8_t> payload;
+    end = 0;
+    while (end + kRecordHeaderSize <= file_size) {
+      uint8_t header[kRecordHeaderSize];
+      if (not readAll(fd, header, kRecordHeaderSize, end)) {
+        break;
+      }
+      const uint8_t *src = header;
+      IndexEntry entry;
+      entry.id = take<uint32_t>(src);
+      entry.size = take<uint32_t>(src);
+      auto crc = take<uint32_t>(src);
+      if (entry.id == 0 and entry.size == 0 and crc == 0) {
+        break;
+      }
+      entry.offset = end + kRecordHeaderSize;
+      entry.segment = segment;
+      if (entry.offset + entry.size > file_size) {
+        break;
+      }
+      payload.resize(entry.size);
+      if (not readAll(fd, payload.data(), entry.size, entry.offset)
+          or crc32(payload.data(), payload.size()) != crc) {
+        break;
+      }
+      entries.push_back(entry);
+      end = entry.offset + entry.size;
+    }
+    return entries;
+  }
+
+  /**
+   * @return true if the bytes from offset to the end of file are zeros
+   * padding the last direct write
+   */
+  bool isPadding(int fd, uint64_t offset, uint64_t file_size) {
+    if (file_size - offset >= kDirectIoAlignment) {
+      return false;
+    }
+    std::vector<uint8_t> buf(file_size - offset);
+    return readAll(fd, buf.data(), buf.size(), offset)
+        and std::all_of(
+                buf.begin(), buf.end(), [](auto byte) { return byte == 0; });
+  }
+
+  bool lessById(const IndexEntry &lhs, const IndexEntry &rhs) {
+    return lhs.id < rhs.id;
+  }
+}  // namespace
+
+SegmentedBlockLog::File::File(int fd) : fd_(fd) {}
+
+SegmentedBlockLog::File::~File() {
+  ::close(fd_);
+}
+
+int SegmentedBlockLog::File::fd() const {
+  return fd_;
+}
+
+boost::optional<std::unique_ptr<SegmentedBlockLog>> SegmentedBlockLog::create(
+    const std::string &path,
+    logger::LoggerPtr log,
+    uint64_t segment_size,
+    SegmentWriteOptions write_options) {
+  boost::system::error_code err;
+  if (not boost::filesystem::is_directory(path, err)
+      and not boost::filesystem::create_directory(path, err)) {
+    log->error("Cannot create storage dir: {}\n{}", path, err.message());
+    return boost::none;
+  }
+
+  std::vector<boost::filesystem::path> files;
+  for (auto it = boost::filesystem::directory_iterator{path};
+       it != boost::filesystem::directory_iterator{};
+       ++it) {
+    if (isSegmentName(it->path())) {
+      files.push_back(it->path());
+    } else {
+      log->warn("Unexpected file {} in block log directory",
+                it->path().string());
+    }
+  }
+  // zero-padded names are ordered as their first ids
+  std::sort(files.begin(), files.end());
+
+  std::vector<Segment> segments;
+  std::vector<IndexEntry> index;
+  std::vector<IndexEntry> active_entries;
+  for (size_t i = 0; i < files.size(); ++i) {
+    const auto file_path = files[i].string();
+    const auto file_size = boost::filesystem::file_size(files[i], err);
+    if (err or file_size == 0) {
+      boost::filesystem::remove(files[i], err);
+      continue;
+    }
+    const bool is_last = i + 1 == files.size();
+    int fd = ::open(file_path.c_str(), is_last ? O_RDWR : O_RDONLY);
+    if (fd < 0) {
+      log->error("Cannot open segment {}: {}", file_path, std::strerror(errno));
+      return boost::none;
+    }
+    File file{fd};
+
+    const uint32_t segment_number = segments.size();
+    auto sealed = readIndex(file.fd(), file_size, segment_number);
+    if (sealed) {
+      index.insert(index.end(), sealed->begin(), sealed->end());
+      segments.push_back(Segment{file_path, file_size, true, nullptr});
+      continue;
+    }
+
+    uint64_t end;
+    auto entries = scanRecords(file.fd(), file_size, segment_number, end);
+    if (end != file_size and not isPadding(file.fd(), end, file_size)) {
+      if (not is_last) {
+        log->error("Segment {} is corrupted at offset {}", file_path, end);
+        return boost::none;
+      }
+      log->warn("Dropping {} bytes of incomplete tail of segment {}",
+                file_size - end,
+                file_path);
+      if (::ftruncate(file.fd(), end) != 0) {
+        log->error(
+            "Cannot truncate segment {}: {}", file_path, std::strerror(errno));
+        return boost::none;
+      }
+    }
+    if (entries.empty()) {
+      boost::filesystem::remove(files[i], err);
+      continue;
+    }
+    index.insert(index.end(), entries.begin(), entries.end());
+    if (is_last) {
+      active_entries = std::move(entries);
+    } else {
+      log->warn("Segment {} was not sealed", file_path);
+    }
+    segments.push_back(Segment{file_path, end, false, nullptr});
+  }
+
+  std::stable_sort(index.begin(), index.end(), lessById);
+  auto duplicate = std::adjacent_find(
+      index.begin(), index.end(), [](const auto &lhs, const auto &rhs) {
+        return lhs.id == rhs.id;
+      });
+  if (duplicate != index.end()) {
+    log->error("Block log contains duplicate entry {}", duplicate->id);
+    return boost::none;
+  }
+  log->info("Block log loaded {} entries from {} segments",
+            index.size(),
+            segments.size());
+
+  return std::make_unique<SegmentedBlockLog>(path,
+                                             segment_size,
+                                             std::move(segments),
+                                             std::move(index),
+                                             std::move(active_entries),
+                                             write_options,
+                                             private_tag{},
+                                             std::move(log));
+}
+
+bool SegmentedBlockLog::add(Identifier id, const Bytes &blob) {
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+  if (find(id)) {
+    log_->warn("insertion for {} failed, because entry already exists", id);
+    return false;
+  }
+  if (not writer_ and not startSegment(id)) {
+    return false;
+  }
+
+  auto &segment = segments_.back();
+  uint8_t header[kRecordHeaderSize];
+  auto dst = header;
+  put<uint32_t>(dst, id);
+  put<uint32_t>(dst, blob.size());
+  put<uint32_t>(dst, crc32(blob.data(), blob.size()));
+
+  IndexEntry entry{id,
+                   static_cast<uint32_t>(blob.size()),
+                   segment.end + kRecordHeaderSize,
+                   static_cast<uint32_t>(segments_.size() - 1)};
+  if (not append(header, kRecordHeaderSize, blob.data(), blob.size())) {
+    log_->warn("Cannot write entry {} to {}: {}",
+               id,
+               segment.path,
+               std::strerror(errno));
+    if (::ftruncate(writer_->fd(), segment.end) != 0) {
+      log_->error("Cannot truncate segment {}", segment.path);
+    }
+    return false;
+  }
+  segment.end = entry.offset + entry.size;
+  active_entries_.push_back(entry);
+  if (index_.empty() or index_.back().id < id) {
+    index_.push_back(entry);
+  } else {
+    index_.insert(
+        std::lower_bound(index_.begin(), index_.end(), entry, lessById),
+        entry);
+  }
+
+  if (segment.end >= segment_size_) {
+    sealActiveSegment();
+  }
+  return true;
+}
+
+boost::optional<SegmentedBlockLog::Bytes> SegmentedBlockLog::get(
+    Identifier id) const {
+  IndexEntry entry;
+  std::shared_ptr<File> file;
+  {
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    auto found = find(id);
+    if (not found) {
+      log_->info("get({}) entry not found", id);
+      return boost::none;
+    }
+    entry = *found;
+    file = reader(entry.segment);
+  }
+  if (not file) {
+    log_->info("get({}) problem with opening segment", id);
+    return boost::none;
+  }
+
+  Bytes buf(entry.size);
+  if (not readAll(file->fd(), buf.data(), entry.size, entry.offset)) {
+    log_->info("get({}) problem with reading segment", id);
+    return boost::none;
+  }
+  return buf;
+}
+
+boost::optional<SegmentedBlockLog::BytesView> SegmentedBlockLog::getView(
+    Identifier id) const {
+  IndexEntry entry;
+  std::shared_ptr<const uint8_t> memory;
+  {
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+    auto found = find(id);
+    if (not found) {
+      log_->info("get({}) entry not found", id);
+      return boost::none;
+    }
+    entry = *found;
+    if (entry.size == 0) {
+      return BytesView(Bytes{});
+    }
+    if (segments_[entry.segment].sealed) {
+      if (auto segment_memory = mapping(entry.segment)) {
+        // aliasing constructor shares ownership of the whole mapping
+        memory = std::shared_ptr<const uint8_t>(
+            segment_memory, segment_memory.get() + entry.offset);
+      }
+    } else if (auto file = reader(entry.segment)) {
+      memory = iroha::map_file_region(file->fd(), entry.offset, entry.size);
+    }
+  }
+  if (not memory) {
+    log_->info("get({}) problem with mapping segment", id);
+    return boost::none;
+  }
+  auto data = memory.get();
+  return BytesView(data, entry.size, std::move(memory));
+}
+
+std::string SegmentedBlockLog::directory() const {
+  return dump_dir_;
+}
+
+Identifier SegmentedBlockLog::last_id() const {
+  std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+  return index_.empty() ? 0 : index_.back().id;
+}
+
+void SegmentedBlockLog::dropAll() {
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+  {
+    std::lock_guard<std::mutex> readers_lock(readers_mutex_);
+    open_readers_.clear();
+    open_mappings_.clear();
+  }
+  writer_.reset();
+  tail_.clear();
+  iroha::remove_dir_contents(dump_dir_, log_);
+  segments_.clear();
+  index_.clear();
+  active_entries_.clear();
+  unsynced_sealed_.clear();
+  directory_unsynced_ = false;
+}
+
+bool SegmentedBlockLog::sync(Identifier, Identifier) {
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+  auto synced = true;
+  if (writer_ and ::fdatasync(writer_->fd()) != 0) {
+    log_->error("Cannot sync segment {}: {}",
+                segments_.back().path,
+                std::strerror(errno));
+    synced = false;
+  }
+  for (auto segment : unsynced_sealed_) {
+    if (not iroha::sync_path(segments_[segment].path, true)) {
+      log_->error("Cannot sync segment {}: {}",
+                  segments_[segment].path,
+                  std::strerror(errno));
+      synced = false;
+    }
+  }
+  if (directory_unsynced_ and not iroha::sync_path(dump_dir_, false)) {
+    log_->error(
+        "Cannot sync directory {}: {}", dump_dir_, std::strerror(errno));
+    synced = false;
+  }
+  if (synced) {
+    unsynced_sealed_.clear();
+    directory_unsynced_ = false;
+  }
+  return synced;
+}
+
+bool SegmentedBlockLog::removeUpTo(Identifier id) {
+  std::unique_lock<std::shared_timed_mutex> lock(mutex_);
+  // entries are added in any order, so a segment is removable only if none
+  // of its records is kept
+  std::vector<bool> kept(segments_.size(), false);
+  for (const auto &entry : index_) {
+    if (entry.id > id) {
+      kept[entry.segment] = true;
+    }
+  }
+  uint32_t removable = 0;
+  while (removable + 1 < segments_.size() and segments_[removable].sealed
+         and not kept[removable]) {
+    ++removable;
+  }
+
+  auto removed_all = true;
+  uint32_t removed = 0;
+  for (; removed < removable; ++removed) {
+    boost::system::error_code err;
+    boost::filesystem::remove(segments_[removed].path, err);
+    if (err) {
+      log_->error("Cannot remove segment {}: {}",
+                  segments_[removed].path,
+                  err.message());
+      removed_all = false;
+      break;
+    }
+  }
+  if (removed == 0) {
+    return removed_all;
+  }
+
+  // positions of the remaining segments are shifted
+  auto shift = [removed](auto &segments) {
+    segments.erase(std::remove_if(segments.begin(),
+                                  segments.end(),
+                                  [removed](uint32_t segment) {
+                                    return segment < removed;
+                                  }),
+                   segments.end());
+    for (auto &segment : segments) {
+      segment -= removed;
+    }
+  };
+  {
+    std::lock_guard<std::mutex> readers_lock(readers_mutex_);
+    shift(open_readers_);
+    shift(open_mappings_);
+    segments_.erase(segments_.begin(), segments_.begin() + removed);
+  }
+  shift(unsynced_sealed_);
+  index_.erase(std::remove_if(index_.begin(),
+                              index_.end(),
+                              [removed](const IndexEntry &entry) {
+                                return entry.segment < removed;
+                              }),
+               index_.end());
+  for (auto &entry : index_) {
+    entry.segment -= removed;
+  }
+  for (auto &entry : active_entries_) {
+    entry.segment -= removed;
+  }
+  return removed_all;
+}
+
+size_t SegmentedBlockLog::size() const {
+  std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+  return index_.size();
+}
+
+size_t SegmentedBlockLog::segmentsCount() const {
+  std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+  return segments_.size();
+}
+
+SegmentedBlockLog::SegmentedBlockLog(std::string path,
+                                     uint64_t segment_size,
+                                     std::vector<Segment> segments,
+                                     std::vector<IndexEntry> index,
+                                     std::vector<IndexEntry> active_entries,
+                                     SegmentWriteOptions write_options,
+                                     private_tag,
+                                     logger::LoggerPtr log)
+    : dump_dir_(std::move(path)),
+      segment_size_(segment_size),
+      preallocate_(write_options.preallocate),
+      direct_io_(write_options.direct_io),
+      segments_(std::move(segments)),
+      index_(std::move(index)),
+      active_entries_(std::move(active_entries)),
+      log_(std::move(log)) {
+  if (not segments_.empty() and not segments_.back().sealed) {
+    if (openWriter(0)) {
+      if (segments_.back().end >= segment_size_) {
+        sealActiveSegment();
+      }
+    } else {
+      log_->error("Cannot reopen segment {} for writing: {}",
+                  segments_.back().path,
+                  std::strerror(errno));
+    }
+  }
+}
+
+SegmentedBlockLog::~SegmentedBlockLog() = default;
+
+const IndexEntry *SegmentedBlockLog::find(Identifier id) const {
+  IndexEntry key{};
+  key.id = id;
+  auto it = std::lower_bound(index_.begin(), index_.end(), key, lessById);
+  if (it == index_.end() or it->id != id) {
+    return nullptr;
+  }
+  return &*it;
+}
+
+bool SegmentedBlockLog::startSegment(Identifier id) {
+  const auto file_name =
+      (boost::filesystem::path{dump_dir_} / segmentName(id)).string();
+  segments_.push_back(Segment{file_name, 0, false, nullptr});
+  if (not openWriter(O_CREAT | O_EXCL)) {
+    log_->warn(
+        "Cannot create segment {}: {}", file_name, std::strerror(errno));
+    segments_.pop_back();
+    return false;
+  }
+  active_entries_.clear();
+  directory_unsynced_ = true;
+#ifdef __linux__
+  if (preallocate_
+      and ::fallocate(writer_->fd(), FALLOC_FL_KEEP_SIZE, 0, segment_size_)
+          != 0) {
+    log_->warn(
+        "Cannot preallocate segment {}: {}", file_name, std::strerror(errno));
+  }
+#endif
+  return true;
+}
+
+bool SegmentedBlockLog::openWriter(int flags) {
+  auto &segment = segments_.back();
+  writer_.reset();
+  tail_.clear();
+  int fd = ::open(segment.path.c_str(), O_WRONLY | flags, 0644);
+  if (fd < 0) {
+    return false;
+  }
+  writer_ = std::make_unique<File>(fd);
+  if (not direct_io_) {
+    return true;
+  }
+
+#ifdef O_DIRECT
+  // the file is created before, since a rejected O_DIRECT may leave it
+  fd = ::open(segment.path.c_str(), O_WRONLY | O_DIRECT);
+#else
+  fd = -1;
+  errno = EINVAL;
+#endif
+  if (fd < 0) {
+    log_->warn(
+        "Cannot open segment {} for direct writes: {}. Writing through the "
+        "page cache",
+        segment.path,
+        std::strerror(errno));
+    direct_io_ = false;
+    return true;
+  }
+  writer_ = std::make_unique<File>(fd);
+
+  // direct writes start from the aligned offset preceding the end
+  tail_.resize(segment.end % kDirectIoAlignment);
+  if (not tail_.empty()) {
+    File file{::open(segment.path.c_str(), O_RDONLY)};
+    if (file.fd() < 0
+        or not readAll(file.fd(),
+                       tail_.data(),
+                       tail_.size(),
+                       segment.end - tail_.size())) {
+      writer_.reset();
+      tail_.clear();
+      return false;
+    }
+  }
+  return true;
+}
+
+bool SegmentedBlockLog::append(const uint8_t *header,
+                               size_t header_size,
+                               const uint8_t *data,
+                               size_t size) {
+  const auto fd = writer_->fd();
+  const auto end = segments_.back().end;
+  if (not direct_io_) {
+    return writeAll(fd, header, header_size, end)
+        and writeAll(fd, data, size, end + header_size);
+  }
+
+  const auto total = tail_.size() + header_size + size;
+  const auto padded = (total + kDirectIoAlignment - 1) / kDirectIoAlignment
+      * kDirectIoAlignment;
+  auto buffer = writeBuffer(padded);
+  if (not buffer) {
+    return false;
+  }
+  auto dst = std::copy(tail_.begin(), tail_.end(), buffer);
+  dst = std::copy_n(header, header_size, dst);
+  dst = std::copy_n(data, size, dst);
+  std::fill(dst, buffer + padded, 0);
+  if (not writeAll(fd, buffer, padded, end - tail_.size())) {
+    return false;
+  }
+  const auto tail_size = (end + header_size + size) % kDirectIoAlignment;
+  tail_.assign(buffer + total - tail_size, buffer + total);
+  return true;
+}
+
+uint8_t *SegmentedBlockLog::writeBuffer(size_t size) {
+  if (write_buffer_size_ < size) {
+    void *memory = nullptr;
+    size = std::max(size, write_buffer_size_ * 2);
+    if (::posix_memalign(&memory, kDirectIoAlignment, size) != 0) {
+      return nullptr;
+    }
+    write_buffer_.reset(static_cast<uint8_t *>(memory));
+    write_buffer_size_ = size;
+  }
+  return write_buffer_.get();
+}
+
+bool SegmentedBlockLog::sealActiveSegment() {
+  auto &segment = segments_.back();
+  const auto index = serializeIndex(segment.end, active_entries_);
+  // the footer must end the file, so the padding of direct writes and the
+  // preallocated space are cut
+  if (not append(nullptr, 0, index.data(), index.size())
+      or ::ftruncate(writer_->fd(), segment.end + index.size()) != 0) {
+    log_->warn("Cannot seal segment {}: {}. Continue writing to it",
+               segment.path,
+               std::strerror(errno));
+    if (::ftruncate(writer_->fd(), segment.end) != 0) {
+      log_->error("Cannot truncate segment {}", segment.path);
+    }
+    return false;
+  }
+  log_->debug("Sealed segment {} with {} entries",
+              segment.path,
+              active_entries_.size());
+  segment.sealed = true;
+  segment.end += index.size();
+  unsynced_sealed_.push_back(segments_.size() - 1);
+  writer_.reset();
+  tail_.clear();
+  active_entries_.clear();
+  return true;
+}
+
+std::shared_ptr<SegmentedBlockLog::File> SegmentedBlockLog::reader(
+    uint32_t segment) const {
+  std::lock_guard<std::mutex> lock(readers_mutex_);
+  auto &cached = segments_[segment].reader;
+  if (cached) {
+    return cached;
+  }
+  int fd = ::open(segments_[segment].path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return nullptr;
+  }
+  cached = std::make_shared<File>(fd);
+  open_readers_.push_back(segment);
+  if (open_readers_.size() > kMaxOpenReaders) {
+    segments_[open_readers_.front()].reader.reset();
+    open_readers_.pop_front();
+  }
+  return cached;
+}
+
+std::shared_ptr<const uint8_t> SegmentedBlockLog::mapping(
+    uint32_t segment) const {
+  auto file = reader(segment);
+  if (not file) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lock(readers_mutex_);
+  auto &cached = segments_[segment].mapping;
+  if (cached) {
+    return cached;
+  }
+  struct stat file_stat;
+  if (::fstat(file->fd(), &file_stat) != 0 or file_stat.st_size == 0) {
+    return nullptr;
+  }
+  cached = iroha::map_file_region(file->fd(), 0, file_stat.st_size);
+  if (not cached) {
+    return nullptr;
+  }
+  open_mappings_.push_back(segment);
+  if (open_mappings_.size() > kMaxOpenMappings) {
+    segments_[open_mappings_.front()].mapping.reset();
+    open_mappings_.pop_front();
+  }
+  return cached;
+}
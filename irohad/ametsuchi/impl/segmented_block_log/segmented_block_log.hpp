@@ -0,0 +1,275 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SEGMENTED_BLOCK_LOG_HPP
+#define IROHA_SEGMENTED_BLOCK_LOG_HPP
+
+#include "ametsuchi/key_value_storage.hpp"
+
+#include <cstdlib>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * How segment files of SegmentedBlockLog are written
+     */
+    struct SegmentWriteOptions {
+      /// reserve disk space of the whole segment when it is started, so
+      /// appends do not allocate blocks one by one
+      bool preallocate = false;
+      /// write segments with O_DIRECT, bypassing the page cache; falls back
+      /// to buffered writes if the file system does not support it
+      bool direct_io = false;
+    };
+
+    /**
+     * Solid storage which appends entries to a small number of fixed-size
+     * segment files instead of creating one file per entry.
+     *
+     * Segment file layout:
+     * | record | record | ... | index | footer |
+     * where record is | id | size | crc32 | payload | and index is a sequence
+     * of | id | size | payload offset | for every record in the segment. Index
+     * and footer are written when the segment becomes full (sealed), so
+     * startup reads only footers of sealed segments and scans the last
+     * unsealed one, dropping a partially written tail record if any.
+     *
+     * Direct writes are padded with zeros up to the alignment, the padding
+     * after the last record of an unsealed segment is recognized by its zero
+     * record header, so id 0 is never stored.
+     */
+    class SegmentedBlockLog : public KeyValueStorage {
+      /**
+       * Private tag used to construct unique and shared pointers
+       * without new operator
+       */
+      struct private_tag {};
+
+     public:
+      /// extension of segment files, name is the id of the first record
+      static const std::string kSegmentExtension;
+
+      /**
+       * Location of a single record in the log
+       */
+      struct IndexEntry {
+        Identifier id;
+        uint32_t size;
+        /// offset of the payload inside the segment file
+        uint64_t offset;
+        /// position of the segment in segments_
+        uint32_t segment;
+      };
+
+      /**
+       * Owning wrapper over an open POSIX file descriptor
+       */
+      class File {
+       public:
+        explicit File(int fd);
+        ~File();
+        File(const File &) = delete;
+        File &operator=(const File &) = delete;
+        int fd() const;
+
+       private:
+        int fd_;
+      };
+
+      /**
+       * Segment metadata
+       */
+      struct Segment {
+        std::string path;
+        /// offset where the next record would be written
+        uint64_t end;
+        bool sealed;
+        /// cached read descriptor, may be null
+        mutable std::shared_ptr<File> reader;
+        /// cached memory mapping of a sealed segment, may be null
+        mutable std::shared_ptr<const uint8_t> mapping;
+      };
+
+      /**
+       * Create storage in path
+       * @param path - target path for creating
+       * @param log - logger
+       * @param segment_size - size of segment after which it is sealed
+       * @param write_options - how segment files are written
+       * @return created storage
+       */
+      static boost::optional<std::unique_ptr<SegmentedBlockLog>> create(
+          const std::string &path,
+          logger::LoggerPtr log,
+          uint64_t segment_size,
+          SegmentWriteOptions write_options = {});
+
+      bool add(Identifier id, const Bytes &blob) override;
+
+      boost::optional<Bytes> get(Identifier id) const override;
+
+      /**
+       * Returns a view into the memory-mapped segment. Sealed segments are
+       * mapped once and the mapping is reused by subsequent reads
+       */
+      boost::optional<BytesView> getView(Identifier id) const override;
+
+      std::string directory() const override;
+
+      Identifier last_id() const override;
+
+      void dropAll() override;
+
+      /**
+       * Flushes the active segment, the segments sealed since the previous
+       * sync and the directory if a segment was started, regardless of the
+       * range
+       */
+      bool sync(Identifier from, Identifier to) override;
+
+      /**
+       * Removes the leading sealed segments which hold only such entries,
+       * the active segment is kept
+       */
+      bool removeUpTo(Identifier id) override;
+
+      /**
+       * @return number of stored entries
+       */
+      size_t size() const;
+
+      /**
+       * @return number of segment files
+       */
+      size_t segmentsCount() const;
+
+      SegmentedBlockLog(std::string path,
+                        uint64_t segment_size,
+                        std::vector<Segment> segments,
+                        std::vector<IndexEntry> index,
+                        std::vector<IndexEntry> active_entries,
+                        SegmentWriteOptions write_options,
+                        private_tag,
+                        logger::LoggerPtr log);
+
+      SegmentedBlockLog(const SegmentedBlockLog &rhs) = delete;
+
+      SegmentedBlockLog(SegmentedBlockLog &&rhs) = delete;
+
+      SegmentedBlockLog &operator=(const SegmentedBlockLog &rhs) = delete;
+
+      SegmentedBlockLog &operator=(SegmentedBlockLog &&rhs) = delete;
+
+      ~SegmentedBlockLog() override;
+
+     private:
+      /**
+       * Find entry by id in index_
+       * @return pointer to entry or nullptr, must be called under lock
+       */
+      const IndexEntry *find(Identifier id) const;
+
+      /**
+       * Open a new segment file for records starting from id
+       */
+      bool startSegment(Identifier id);
+
+      /**
+       * Open the writer of the active segment, with O_DIRECT if enabled
+       * @param flags - open flags besides O_WRONLY
+       */
+      bool openWriter(int flags);
+
+      /**
+       * Write header and data at the end of the active segment. Direct
+       * writes rewrite the unaligned tail kept in memory and pad the data
+       */
+      bool append(const uint8_t *header,
+                  size_t header_size,
+                  const uint8_t *data,
+                  size_t size);
+
+      /**
+       * @return aligned buffer for direct writes of at least size bytes,
+       * reused by subsequent writes
+       */
+      uint8_t *writeBuffer(size_t size);
+
+      /**
+       * Write index and footer of the active segment
+       */
+      bool sealActiveSegment();
+
+      /**
+       * @return descriptor for reading segment with given position
+       */
+      std::shared_ptr<File> reader(uint32_t segment) const;
+
+      /**
+       * @return memory mapping of the whole sealed segment
+       */
+      std::shared_ptr<const uint8_t> mapping(uint32_t segment) const;
+
+      const std::string dump_dir_;
+
+      const uint64_t segment_size_;
+
+      const bool preallocate_;
+
+      /// disabled if the file system rejects O_DIRECT
+      bool direct_io_;
+
+      mutable std::shared_timed_mutex mutex_;
+
+      /// all segments ordered by their first record
+      std::vector<Segment> segments_;
+
+      /// all records sorted by id
+      std::vector<IndexEntry> index_;
+
+      /// records of the active (last, unsealed) segment in write order
+      std::vector<IndexEntry> active_entries_;
+
+      /// write descriptor of the active segment
+      std::unique_ptr<File> writer_;
+
+      /// bytes of the active segment after its last aligned offset, which
+      /// direct writes rewrite together with the new data
+      std::vector<uint8_t> tail_;
+
+      /// aligned buffer of direct writes
+      std::unique_ptr<uint8_t[], void (*)(void *)> write_buffer_{nullptr,
+                                                                &std::free};
+      size_t write_buffer_size_{0};
+
+      /// segments sealed since the previous sync
+      std::vector<uint32_t> unsynced_sealed_;
+
+      /// a segment file was created since the previous sync
+      bool directory_unsynced_{false};
+
+      /// guards reader descriptors and mappings cache
+      mutable std::mutex readers_mutex_;
+
+      /// segments with open reader descriptors, oldest first
+      mutable std::deque<uint32_t> open_readers_;
+
+      /// segments with cached mappings, oldest first
+      mutable std::deque<uint32_t> open_mappings_;
+
+      logger::LoggerPtr log_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_SEGMENTED_BLOCK_LOG_HPP
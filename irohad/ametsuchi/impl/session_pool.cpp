@@ -0,0 +1,62 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/session_pool.hpp"
+
+#include <vector>
+
+#include <soci/soci.h>
+#include "metrics/metrics.hpp"
+
+using namespace iroha::ametsuchi;
+
+SessionPool::SessionPool(std::shared_ptr<soci::connection_pool> pool,
+                         const std::string &component,
+                         std::chrono::milliseconds timeout)
+    : pool_(std::move(pool)),
+      component_(component),
+      timeout_(timeout),
+      wait_time_metric_(metrics::registry().histogram(
+          "iroha_db_" + component + "_session_wait_microseconds",
+          "Time " + component + " waits for a free database connection")),
+      timeouts_metric_(metrics::registry().counter(
+          "iroha_db_" + component + "_session_timeouts_total",
+          "Times " + component
+              + " did not get a free database connection in time")) {}
+
+iroha::expected::Result<std::unique_ptr<soci::session>, std::string>
+SessionPool::session() const {
+  if (not pool_) {
+    return expected::makeError("Connection was closed");
+  }
+  metrics::ScopedTimer timer(wait_time_metric_);
+  if (timeout_.count() > 0) {
+    // soci sessions can not be made of a leased position, so the connection
+    // is given back and leased again by the session, which waits again only
+    // if another thread has taken it in between
+    std::size_t position;
+    if (not pool_->try_lease(position, static_cast<int>(timeout_.count()))) {
+      timeouts_metric_.increment();
+      return expected::makeError("No free database connection for "
+                                 + component_ + " in "
+                                 + std::to_string(timeout_.count()) + " ms");
+    }
+    pool_->give_back(position);
+  }
+  return expected::makeValue(std::make_unique<soci::session>(*pool_));
+}
+
+void SessionPool::close(size_t size) {
+  if (not pool_) {
+    return;
+  }
+  std::vector<std::unique_ptr<soci::session>> sessions;
+  for (size_t i = 0; i < size; ++i) {
+    sessions.push_back(std::make_unique<soci::session>(*pool_));
+    sessions.back()->close();
+  }
+  sessions.clear();
+  pool_.reset();
+}
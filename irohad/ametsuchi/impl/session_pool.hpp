@@ -0,0 +1,73 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SESSION_POOL_HPP
+#define IROHA_SESSION_POOL_HPP
+
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include "common/result.hpp"
+
+namespace soci {
+  class connection_pool;
+  class session;
+}  // namespace soci
+
+namespace iroha {
+  namespace metrics {
+    class Counter;
+    class Histogram;
+  }  // namespace metrics
+
+  namespace ametsuchi {
+
+    /**
+     * Sessions of a component leased from a connection pool, with the time
+     * spent waiting for a free connection measured and limited. The pool can
+     * be reserved for the component or shared with other components.
+     */
+    class SessionPool {
+     public:
+      /**
+       * @param pool - connections to lease sessions from
+       * @param component - name of the component in the metric names
+       * @param timeout - how long to wait for a free connection, zero waits
+       * forever
+       */
+      SessionPool(std::shared_ptr<soci::connection_pool> pool,
+                  const std::string &component,
+                  std::chrono::milliseconds timeout);
+
+      /**
+       * Lease a session, it is given back to the pool when destroyed
+       * @return session or error if the pool is closed or no connection
+       * became free in time
+       */
+      expected::Result<std::unique_ptr<soci::session>, std::string> session()
+          const;
+
+      /**
+       * Close the given number of connections of the pool and stop leasing
+       * sessions. Connections of a shared pool are closed by its owner, so
+       * zero is given for it
+       * @param size - number of connections in the pool to close
+       */
+      void close(size_t size);
+
+     private:
+      std::shared_ptr<soci::connection_pool> pool_;
+      const std::string component_;
+      const std::chrono::milliseconds timeout_;
+
+      metrics::Histogram &wait_time_metric_;
+      metrics::Counter &timeouts_metric_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_SESSION_POOL_HPP
@@ -0,0 +1,86 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/signatories_cache.hpp"
+
+#include <mutex>
+
+#include "common/visitor.hpp"
+#include "interfaces/commands/add_signatory.hpp"
+#include "interfaces/commands/command.hpp"
+#include "interfaces/commands/command_variant.hpp"
+#include "interfaces/commands/remove_signatory.hpp"
+#include "interfaces/commands/set_quorum.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "interfaces/transaction.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    SignatoriesCache::SignatoriesCache(size_t max_accounts)
+        : max_accounts_(max_accounts) {}
+
+    SignatoriesCache::Version SignatoriesCache::version() const {
+      std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+      return version_;
+    }
+
+    std::shared_ptr<const SignatoriesCache::AccountSignatories>
+    SignatoriesCache::find(
+        const shared_model::interface::types::AccountIdType &account_id)
+        const {
+      std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+      auto it = accounts_.find(account_id);
+      return it == accounts_.end() ? nullptr : it->second;
+    }
+
+    void SignatoriesCache::insert(
+        const shared_model::interface::types::AccountIdType &account_id,
+        std::shared_ptr<const AccountSignatories> signatories,
+        Version version) {
+      std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+      if (version != version_) {
+        return;
+      }
+      if (accounts_.size() >= max_accounts_) {
+        accounts_.clear();
+      }
+      accounts_[account_id] = std::move(signatories);
+    }
+
+    void SignatoriesCache::invalidate(
+        const shared_model::interface::Block &block) {
+      namespace interface = shared_model::interface;
+      std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+      ++version_;
+      if (accounts_.empty()) {
+        return;
+      }
+      for (const auto &transaction : block.transactions()) {
+        for (const auto &command : transaction.commands()) {
+          visit_in_place(
+              command.get(),
+              [this](const interface::AddSignatory &c) {
+                accounts_.erase(c.accountId());
+              },
+              [this](const interface::RemoveSignatory &c) {
+                accounts_.erase(c.accountId());
+              },
+              [this](const interface::SetQuorum &c) {
+                accounts_.erase(c.accountId());
+              },
+              [](const auto &) {});
+        }
+      }
+    }
+
+    void SignatoriesCache::clear() {
+      std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+      ++version_;
+      accounts_.clear();
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
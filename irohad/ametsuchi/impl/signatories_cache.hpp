@@ -0,0 +1,92 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SIGNATORIES_CACHE_HPP
+#define IROHA_SIGNATORIES_CACHE_HPP
+
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "interfaces/common_objects/types.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }  // namespace interface
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Thread-safe cache of quorums and signatories of accounts in the
+     * committed ledger state, shared by validations of proposals. Entries of
+     * accounts which may be changed by a block are dropped when the block is
+     * committed. Every commit increments the version of the cache, and
+     * signatories read from the database are inserted only if the version
+     * has not changed since the read started, so a state read before a
+     * commit is not cached after it. Missing accounts are not cached
+     */
+    class SignatoriesCache {
+     public:
+      /// quorum and signatories of an account
+      struct AccountSignatories {
+        int quorum;
+        /// hex of the public keys
+        std::unordered_set<std::string> public_keys;
+      };
+
+      using Version = uint64_t;
+
+      /// default maximum number of cached accounts
+      static constexpr size_t kDefaultMaxAccounts = 100000;
+
+      /// @param max_accounts - the cache is emptied when it grows beyond it
+      explicit SignatoriesCache(size_t max_accounts = kDefaultMaxAccounts);
+
+      /// @return current version, to be passed to insert
+      Version version() const;
+
+      /// @return signatories of the account, nullptr if they are not cached
+      std::shared_ptr<const AccountSignatories> find(
+          const shared_model::interface::types::AccountIdType &account_id)
+          const;
+
+      /**
+       * Cache signatories of the account read from the committed state
+       * @param version - version of the cache before the state was read
+       */
+      void insert(
+          const shared_model::interface::types::AccountIdType &account_id,
+          std::shared_ptr<const AccountSignatories> signatories,
+          Version version);
+
+      /**
+       * Drop signatories of accounts whose quorum or signatories may be
+       * changed by the committed block
+       */
+      void invalidate(const shared_model::interface::Block &block);
+
+      /// Drop all entries, when the ledger state is reset
+      void clear();
+
+     private:
+      const size_t max_accounts_;
+
+      mutable std::shared_timed_mutex mutex_;
+      Version version_{0};
+      std::unordered_map<shared_model::interface::types::AccountIdType,
+                         std::shared_ptr<const AccountSignatories>>
+          accounts_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_SIGNATORIES_CACHE_HPP
@@ -7,12 +7,17 @@
 #define IROHA_POSTGRES_WSV_COMMON_HPP
 
 #include <soci/soci.h>
+#include <chrono>
+#include <string>
+#include <boost/iterator/iterator_adaptor.hpp>
 #include <boost/optional.hpp>
 #include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/transformed.hpp>
 #include <boost/range/iterator_range.hpp>
 #include <boost/tuple/tuple.hpp>
 #include "common/bind.hpp"
+#include "logger/logger.hpp"
+#include "metrics/metrics.hpp"
 
 namespace iroha {
   namespace ametsuchi {
@@ -157,6 +162,114 @@ namespace iroha {
       };
     }
 
+    /**
+     * Log of the statements running longer than the threshold, it is set on
+     * startup before the storage is created
+     */
+    struct SlowStatementLog {
+      /// 0 disables the log
+      std::chrono::milliseconds threshold{0};
+      logger::LoggerPtr log;
+    };
+
+    /// @return slow statement log of the process
+    inline SlowStatementLog &slowStatementLog() {
+      static SlowStatementLog slow_statement_log;
+      return slow_statement_log;
+    }
+
+    /**
+     * Execution of a statement tagged with a static name, from construction
+     * to destruction. Records the time to iroha_sql_<name>_microseconds and
+     * the rows, if they are counted, to iroha_sql_<name>_rows, and logs the
+     * statement if it is slow. Looking the histograms up on every execution
+     * is negligible next to a database round trip
+     */
+    class TimedStatement {
+     public:
+      /// @param name - name of the statement, a valid part of a metric name
+      explicit TimedStatement(std::string name)
+          : name_(std::move(name)), start_(std::chrono::steady_clock::now()) {}
+
+      TimedStatement(const TimedStatement &) = delete;
+      TimedStatement &operator=(const TimedStatement &) = delete;
+
+      /// count rows returned or affected by the statement
+      void addRows(uint64_t rows) {
+        rows_ = rows_.value_or(0) + rows;
+      }
+
+      ~TimedStatement() {
+        auto elapsed = std::chrono::steady_clock::now() - start_;
+        auto &registry = metrics::registry();
+        registry
+            .histogram("iroha_sql_" + name_ + "_microseconds",
+                       "Execution time of the " + name_ + " statement")
+            .record(
+                std::chrono::duration_cast<std::chrono::microseconds>(elapsed)
+                    .count());
+        if (rows_) {
+          registry
+              .histogram("iroha_sql_" + name_ + "_rows",
+                         "Rows of the " + name_ + " statement")
+              .record(*rows_);
+        }
+        const auto &slow = slowStatementLog();
+        if (slow.log and slow.threshold.count() != 0
+            and elapsed >= slow.threshold) {
+          slow.log->warn(
+              "Slow statement {}: {} ms, {} rows",
+              name_,
+              std::chrono::duration_cast<std::chrono::milliseconds>(elapsed)
+                  .count(),
+              rows_ ? std::to_string(*rows_) : std::string{"uncounted"});
+        }
+      }
+
+     private:
+      const std::string name_;
+      const std::chrono::steady_clock::time_point start_;
+      boost::optional<uint64_t> rows_;
+    };
+
+    /// Iterator over rows of a rowset which counts the fetched rows
+    template <typename Iterator>
+    class CountingRowIterator
+        : public boost::iterator_adaptor<CountingRowIterator<Iterator>,
+                                         Iterator> {
+     public:
+      CountingRowIterator() = default;
+
+      CountingRowIterator(Iterator it, TimedStatement *statement)
+          : CountingRowIterator::iterator_adaptor_(std::move(it)),
+            statement_(statement) {}
+
+     private:
+      friend class boost::iterator_core_access;
+
+      void increment() {
+        ++this->base_reference();
+        if (this->base() != Iterator{}) {
+          statement_->addRows(1);
+        }
+      }
+
+      TimedStatement *statement_ = nullptr;
+    };
+
+    /**
+     * @return range over the rows of the rowset, which counts the rows in
+     * the statement as they are fetched
+     */
+    template <typename T>
+    auto countedRows(soci::rowset<T> &rowset, TimedStatement &statement) {
+      using Iterator = CountingRowIterator<typename soci::rowset<T>::iterator>;
+      auto begin = rowset.begin();
+      statement.addRows(begin != rowset.end() ? 1 : 0);
+      return boost::make_iterator_range(Iterator(begin, &statement),
+                                        Iterator(rowset.end(), &statement));
+    }
+
   }  // namespace ametsuchi
 }  // namespace iroha
 
@@ -5,6 +5,9 @@
 
 #include "ametsuchi/impl/storage_impl.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <thread>
 #include <utility>
 
 #include <soci/callbacks.h>
@@ -12,8 +15,13 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/format.hpp>
 #include <boost/range/algorithm/replace_if.hpp>
+#include "ametsuchi/impl/archived_key_value_storage.hpp"
+#include "ametsuchi/impl/async_key_value_storage.hpp"
+#include "ametsuchi/impl/block_store_verifier.hpp"
+#include "ametsuchi/impl/compressed_key_value_storage.hpp"
 #include "ametsuchi/impl/flat_file/flat_file.hpp"
 #include "ametsuchi/impl/mutable_storage_impl.hpp"
+#include "ametsuchi/impl/peer_query_ledger_state.hpp"
 #include "ametsuchi/impl/peer_query_wsv.hpp"
 #include "ametsuchi/impl/postgres_block_index.hpp"
 #include "ametsuchi/impl/postgres_block_query.hpp"
@@ -23,16 +31,22 @@
 #include "ametsuchi/impl/postgres_specific_query_executor.hpp"
 #include "ametsuchi/impl/postgres_wsv_command.hpp"
 #include "ametsuchi/impl/postgres_wsv_query.hpp"
+#include "ametsuchi/impl/postgres_wsv_snapshot.hpp"
+#include "ametsuchi/impl/segmented_block_log/segmented_block_log.hpp"
+#include "ametsuchi/impl/synced_key_value_storage.hpp"
 #include "ametsuchi/impl/temporary_wsv_impl.hpp"
 #include "ametsuchi/tx_executor.hpp"
 #include "backend/protobuf/permissions.hpp"
 #include "common/bind.hpp"
 #include "common/byteutils.hpp"
+#include "common/thread_pool.hpp"
 #include "converters/protobuf/json_proto_converter.hpp"
+#include "cryptography/hash.hpp"
 #include "cryptography/public_key.hpp"
 #include "logger/logger.hpp"
 #include "logger/logger_manager.hpp"
 #include "main/impl/pg_connection_init.hpp"
+#include "validators/field_validator.hpp"
 
 namespace iroha {
   namespace ametsuchi {
@@ -41,6 +55,57 @@ namespace iroha {
     const char *kPsqlBroken = "Connection to PostgreSQL broken: %s";
     const char *kTmpWsv = "TemporaryWsv";
 
+    /// heights in a partition of the history tables, the same as
+    /// height_partition_blocks() of the schema
+    const shared_model::interface::types::HeightType kHistoryPartitionBlocks =
+        100000;
+
+    /// time after which the height of a replica is read again even if it is
+    /// not behind, since a replica may be reset or rebuilt
+    const std::chrono::steady_clock::duration kReplicaHeightExpiry =
+        std::chrono::seconds(1);
+
+    namespace {
+      /**
+       * Build filter of all transaction hashes stored in the ledger
+       * @return filter or nullptr if hashes could not be loaded
+       */
+      bool loadTxHashes(soci::session &sql,
+                        TxHashFilter &filter,
+                        const logger::LoggerPtr &log) {
+        try {
+          soci::rowset<std::string> hashes =
+              (sql.prepare
+               << "SELECT encode(hash, 'hex') FROM tx_status_by_hash");
+          for (const auto &hash : hashes) {
+            filter.insert(shared_model::crypto::Hash::fromHexString(hash));
+          }
+          log->info("Loaded {} transaction hashes to filter", filter.count());
+          return true;
+        } catch (const std::exception &e) {
+          log->warn("Failed to load transaction hashes to filter: {}",
+                    e.what());
+          return false;
+        }
+      }
+
+      std::shared_ptr<TxHashFilter> loadTxHashFilter(
+          soci::session &sql, const logger::LoggerPtr &log) {
+        long long hashes_count = 0;
+        try {
+          sql << "SELECT count(*) FROM tx_status_by_hash",
+              soci::into(hashes_count);
+        } catch (const std::exception &e) {
+          log->warn("Failed to count transaction hashes: {}", e.what());
+          return nullptr;
+        }
+        // reserve space for new transactions
+        auto filter = std::make_shared<TxHashFilter>(
+            2 * static_cast<size_t>(hashes_count));
+        return loadTxHashes(sql, *filter, log) ? filter : nullptr;
+      }
+    }  // namespace
+
     ConnectionContext::ConnectionContext(
         std::unique_ptr<KeyValueStorage> block_store)
         : block_store(std::move(block_store)) {}
@@ -55,11 +120,32 @@ namespace iroha {
             perm_converter,
         std::unique_ptr<BlockStorageFactory> block_storage_factory,
         size_t pool_size,
+        std::shared_ptr<BlockCache> block_cache,
+        std::shared_ptr<TxHashFilter> tx_filter,
+        shared_model::interface::types::HeightType retained_blocks,
         logger::LoggerManagerTreePtr log_manager)
         : postgres_options_(std::move(postgres_options)),
           block_store_(std::move(block_store)),
+          block_cache_(std::move(block_cache)),
+          tx_filter_(std::move(tx_filter)),
+          signatories_cache_(std::make_shared<SignatoriesCache>()),
+          pending_blocks_(std::make_shared<PendingBlocks>()),
+          retained_blocks_(retained_blocks),
           pool_wrapper_(std::move(pool_wrapper)),
           connection_(pool_wrapper_.connection_pool_),
+          query_sessions_(connection_,
+                          "query",
+                          postgres_options_->poolReservation().query_timeout),
+          commit_sessions_(pool_wrapper_.commit_pool_
+                               ? pool_wrapper_.commit_pool_
+                               : connection_,
+                           "commit",
+                           std::chrono::milliseconds::zero()),
+          validation_sessions_(pool_wrapper_.validation_pool_
+                                   ? pool_wrapper_.validation_pool_
+                                   : connection_,
+                               "validation",
+                               std::chrono::milliseconds::zero()),
           notifier_(notifier_lifetime_),
           converter_(std::move(converter)),
           perm_converter_(std::move(perm_converter)),
@@ -68,21 +154,45 @@ namespace iroha {
           log_(log_manager_->getLogger()),
           pool_size_(pool_size),
           prepared_blocks_enabled_(pool_wrapper_.enable_prepared_transactions_),
+          replica_heights_(pool_wrapper_.replica_pools_.size()),
+          replica_checks_(pool_wrapper_.replica_pools_.size()),
           block_is_prepared_(false),
           prepared_block_name_(postgres_options_->preparedBlockName()),
-          ledger_state_(std::move(ledger_state)) {}
+          ledger_state_(std::move(ledger_state)),
+          commit_time_metric_(metrics::registry().histogram(
+              "iroha_storage_commit_microseconds",
+              "Time spent committing blocks to the ledger")),
+          database_commit_time_metric_(metrics::registry().histogram(
+              "iroha_storage_database_commit_microseconds",
+              "Time spent committing the database transaction of blocks")),
+          block_store_time_metric_(metrics::registry().histogram(
+              "iroha_storage_block_store_microseconds",
+              "Time spent writing blocks to the block store")),
+          height_metric_(metrics::registry().gauge(
+              "iroha_storage_height", "Height of the top committed block")) {
+      if (ledger_state_) {
+        height_metric_.set((*ledger_state_)->top_block_info.height);
+        ledger_peers_ = *ledger_state_;
+      }
+    }
 
     expected::Result<std::unique_ptr<TemporaryWsv>, std::string>
     StorageImpl::createTemporaryWsv() {
       std::shared_lock<std::shared_timed_mutex> lock(drop_mutex_);
-      if (connection_ == nullptr) {
-        return expected::makeError("Connection was closed");
+      auto session = validation_sessions_.session();
+      if (auto e = boost::get<expected::Error<std::string>>(&session)) {
+        return *e;
       }
-      auto sql = std::make_unique<soci::session>(*connection_);
+      auto sql = std::move(
+          boost::get<expected::Value<std::unique_ptr<soci::session>>>(session)
+              .value);
       // if we create temporary storage, then we intend to validate a new
       // proposal. this means that any state prepared before that moment is
       // not needed and must be removed to prevent locking
       tryRollback(*sql);
+      if (auto e = expected::resultToOptionalError(prepareStatements(*sql))) {
+        return expected::makeError(std::move(*e));
+      }
       return expected::makeValue<std::unique_ptr<TemporaryWsv>>(
           std::make_unique<TemporaryWsvImpl>(
               std::move(sql),
@@ -90,7 +200,9 @@ namespace iroha {
                   std::make_unique<PostgresCommandExecutor>(*sql,
                                                             perm_converter_)),
 
-              log_manager_->getChild("TemporaryWorldStateView")));
+              log_manager_->getChild("TemporaryWorldStateView"),
+              postgres_options_->asyncValidationCommit(),
+              signatories_cache_));
     }
 
     expected::Result<std::unique_ptr<MutableStorage>, std::string>
@@ -100,6 +212,10 @@ namespace iroha {
 
     boost::optional<std::shared_ptr<PeerQuery>> StorageImpl::createPeerQuery()
         const {
+      if (auto ledger_state = std::atomic_load(&ledger_peers_)) {
+        return boost::make_optional<std::shared_ptr<PeerQuery>>(
+            std::make_shared<PeerQueryLedgerState>(std::move(ledger_state)));
+      }
       auto wsv = getWsvQuery();
       if (not wsv) {
         return boost::none;
@@ -110,11 +226,99 @@ namespace iroha {
 
     boost::optional<std::shared_ptr<BlockQuery>> StorageImpl::createBlockQuery()
         const {
+      std::shared_lock<std::shared_timed_mutex> lock(drop_mutex_);
+      if (not connection_) {
+        log_->info(
+            "createBlockQuery: connection to database is not initialised");
+        return boost::none;
+      }
+      auto session = createReadSession();
+      if (auto e = boost::get<expected::Error<std::string>>(&session)) {
+        log_->warn("createBlockQuery: {}", e->error);
+        return boost::none;
+      }
+      return boost::make_optional<std::shared_ptr<BlockQuery>>(
+          std::make_shared<PostgresBlockQuery>(
+              std::move(
+                  boost::get<expected::Value<std::unique_ptr<soci::session>>>(
+                      session)
+                      .value),
+              *block_store_,
+              converter_,
+              log_manager_->getChild("PostgresBlockQuery")->getLogger(),
+              block_cache_,
+              tx_filter_,
+              pending_blocks_));
+    }
+
+    boost::optional<std::unique_ptr<WsvSnapshotExporter>>
+    StorageImpl::createWsvSnapshotExporter() const {
       auto block_query = getBlockQuery();
-      if (not block_query) {
+      std::shared_lock<std::shared_timed_mutex> lock(drop_mutex_);
+      if (not connection_ or not block_query) {
+        log_->info(
+            "createWsvSnapshotExporter: connection to database is not "
+            "initialised");
         return boost::none;
       }
-      return boost::make_optional(block_query);
+      return boost::make_optional<std::unique_ptr<WsvSnapshotExporter>>(
+          std::make_unique<PostgresWsvSnapshotExporter>(
+              std::make_unique<soci::session>(*connection_),
+              std::move(block_query),
+              log_manager_->getChild("WsvSnapshotExporter")->getLogger()));
+    }
+
+    boost::optional<std::unique_ptr<WsvSnapshotImporter>>
+    StorageImpl::createWsvSnapshotImporter() {
+      std::shared_lock<std::shared_timed_mutex> lock(drop_mutex_);
+      if (not connection_) {
+        log_->info(
+            "createWsvSnapshotImporter: connection to database is not "
+            "initialised");
+        return boost::none;
+      }
+      auto sql = std::make_unique<soci::session>(*connection_);
+      tryRollback(*sql);
+      try {
+        *sql << "BEGIN";
+      } catch (const std::exception &e) {
+        log_->error("Failed to start snapshot import: {}", e.what());
+        return boost::none;
+      }
+      auto reset = PgConnectionInit::resetWsv(*sql);
+      if (auto e = expected::resultToOptionalError(reset)) {
+        log_->error("{}", e.value());
+        return boost::none;
+      }
+
+      auto store_block =
+          [this](std::shared_ptr<const shared_model::interface::Block> block)
+          -> CommitResult {
+        log_->info("drop blocks from disk");
+        block_store_->dropAll();
+        block_cache_->clear();
+        signatories_cache_->clear();
+        if (tx_filter_) {
+          tx_filter_->clear();
+          soci::session sql(*connection_);
+          loadTxHashes(sql, *tx_filter_, log_);
+        }
+        return storeBlock(block) | [this, &block]() -> CommitResult {
+          auto opt_ledger_peers = getWsvQuery()->getPeers();
+          if (not opt_ledger_peers) {
+            return expected::makeError(
+                std::string{"Failed to get ledger peers"});
+          }
+          setLedgerState(std::make_shared<const LedgerState>(
+              std::move(*opt_ledger_peers), block->height(), block->hash()));
+          return expected::makeValue(ledger_state_.value());
+        };
+      };
+      return boost::make_optional<std::unique_ptr<WsvSnapshotImporter>>(
+          std::make_unique<PostgresWsvSnapshotImporter>(
+              std::move(sql),
+              std::move(store_block),
+              log_manager_->getChild("WsvSnapshotImporter")->getLogger()));
     }
 
     boost::optional<std::shared_ptr<QueryExecutor>>
@@ -128,7 +332,18 @@ namespace iroha {
             "createQueryExecutor: connection to database is not initialised");
         return boost::none;
       }
-      auto sql = std::make_unique<soci::session>(*connection_);
+      auto session = createReadSession();
+      if (auto e = boost::get<expected::Error<std::string>>(&session)) {
+        log_->warn("createQueryExecutor: {}", e->error);
+        return boost::none;
+      }
+      auto sql = std::move(
+          boost::get<expected::Value<std::unique_ptr<soci::session>>>(session)
+              .value);
+      if (auto e = expected::resultToOptionalError(prepareStatements(*sql))) {
+        log_->warn("createQueryExecutor: {}", *e);
+        return boost::none;
+      }
       auto log_manager = log_manager_->getChild("QueryExecutor");
       return boost::make_optional<std::shared_ptr<QueryExecutor>>(
           std::make_shared<PostgresQueryExecutor>(
@@ -137,6 +352,7 @@ namespace iroha {
               std::make_shared<PostgresSpecificQueryExecutor>(
                   *sql,
                   *block_store_,
+                  block_cache_,
                   std::move(pending_txs_storage),
                   converter_,
                   response_factory,
@@ -164,29 +380,43 @@ namespace iroha {
       log_->info("Insert peer {}", peer.pubkey().hex());
       soci::session sql(*connection_);
       PostgresWsvCommand wsv_command(sql);
-      return wsv_command.insertPeer(peer);
+      auto result = wsv_command.insertPeer(peer);
+      reloadLedgerPeers(sql);
+      return result;
     }
 
     expected::Result<std::unique_ptr<MutableStorage>, std::string>
     StorageImpl::createMutableStorage(BlockStorageFactory &storage_factory) {
       std::shared_lock<std::shared_timed_mutex> lock(drop_mutex_);
-      if (connection_ == nullptr) {
-        return expected::makeError("Connection was closed");
+      auto session = commit_sessions_.session();
+      if (auto e = boost::get<expected::Error<std::string>>(&session)) {
+        return *e;
       }
-
-      auto sql = std::make_unique<soci::session>(*connection_);
+      auto sql = std::move(
+          boost::get<expected::Value<std::unique_ptr<soci::session>>>(session)
+              .value);
       // if we create mutable storage, then we intend to mutate wsv
       // this means that any state prepared before that moment is not needed
       // and must be removed to prevent locking
       tryRollback(*sql);
+      if (auto e = expected::resultToOptionalError(prepareStatements(*sql))) {
+        return expected::makeError(std::move(*e));
+      }
+      auto command_executor =
+          std::make_shared<PostgresCommandExecutor>(*sql, perm_converter_);
+      // blocks are applied without validation, so all commands of a block
+      // are sent to the database together, and each balance changed by the
+      // block is updated once
+      command_executor->deferExecution(true);
+      command_executor->aggregateAssetQuantities(true);
       return expected::makeValue<std::unique_ptr<MutableStorage>>(
           std::make_unique<MutableStorageImpl>(
               ledger_state_,
               std::make_shared<TransactionExecutor>(
-                  std::make_shared<PostgresCommandExecutor>(*sql,
-                                                            perm_converter_)),
+                  std::move(command_executor)),
               std::move(sql),
               storage_factory.create(),
+              tx_filter_,
               log_manager_->getChild("MutableStorageImpl")));
     }
 
@@ -195,6 +425,7 @@ namespace iroha {
           [this](auto &&v) {
             log_->debug("drop blocks from disk");
             block_store_->dropAll();
+            block_cache_->clear();
           },
           [this](auto &&e) {
             log_->warn("Failed to drop WSV. Reason: {}", e.error);
@@ -207,17 +438,41 @@ namespace iroha {
         soci::session sql(*connection_);
         // rollback possible prepared transaction
         tryRollback(sql);
-        return PgConnectionInit::resetWsv(sql);
+        if (tx_filter_) {
+          tx_filter_->clear();
+        }
+        signatories_cache_->clear();
+        auto result = PgConnectionInit::resetWsv(sql);
+        reloadLedgerPeers(sql);
+        return result;
       } catch (std::exception &e) {
         return expected::makeError(e.what());
       }
     }
 
+    expected::Result<void, std::string> StorageImpl::dropConstraints() {
+      log_->info("drop constraints of db tables");
+      try {
+        soci::session sql(*connection_);
+        return PgConnectionInit::dropConstraints(sql);
+      } catch (std::exception &e) {
+        return expected::makeError(e.what());
+      }
+    }
+
+    expected::Result<void, std::string> StorageImpl::restoreConstraints(
+        size_t threads) {
+      log_->info("restore constraints of db tables");
+      return PgConnectionInit::restoreConstraints(
+          *connection_, std::min(threads, pool_size_));
+    }
+
     void StorageImpl::resetPeers() {
       log_->info("Remove everything from peers table");
       soci::session sql(*connection_);
       expected::resultToOptionalError(PgConnectionInit::resetPeers(sql)) |
           [this](const auto &e) { this->log_->error("{}", e); };
+      reloadLedgerPeers(sql);
     }
 
     void StorageImpl::dropStorage() {
@@ -238,6 +493,12 @@ namespace iroha {
       // erase blocks
       log_->info("drop block store");
       block_store_->dropAll();
+      block_cache_->clear();
+      if (tx_filter_) {
+        tx_filter_->clear();
+      }
+      signatories_cache_->clear();
+      std::atomic_store(&ledger_peers_, {});
     }
 
     void StorageImpl::freeConnections() {
@@ -258,14 +519,91 @@ namespace iroha {
       }
       connections.clear();
       connection_.reset();
+      pool_wrapper_.replica_pools_.clear();
+
+      const auto &reservation = postgres_options_->poolReservation();
+      query_sessions_.close(0);
+      commit_sessions_.close(pool_wrapper_.commit_pool_ ? reservation.commit
+                                                        : 0);
+      validation_sessions_.close(
+          pool_wrapper_.validation_pool_ ? reservation.validation : 0);
+      pool_wrapper_.commit_pool_.reset();
+      pool_wrapper_.validation_pool_.reset();
+    }
+
+    expected::Result<std::unique_ptr<soci::session>, std::string>
+    StorageImpl::createReadSession() const {
+      const auto &replica_pools = pool_wrapper_.replica_pools_;
+      // ledger_state_ is replaced by commits running concurrently
+      auto ledger_state = std::atomic_load(&ledger_peers_);
+      if (ledger_state and not replica_pools.empty()) {
+        const auto required_height = ledger_state->top_block_info.height;
+        const auto first = next_replica_++;
+        const auto now = std::chrono::steady_clock::now().time_since_epoch();
+        for (size_t i = 0; i < replica_pools.size(); ++i) {
+          const auto index = (first + i) % replica_pools.size();
+          auto &known_height = replica_heights_[index];
+          auto &checked = replica_checks_[index];
+          try {
+            auto sql = std::make_unique<soci::session>(*replica_pools[index]);
+            // the height is read from the replica when the one read last time
+            // is behind or expired
+            if (known_height < required_height
+                or now - std::chrono::steady_clock::duration(checked)
+                    >= kReplicaHeightExpiry) {
+              soci::rowset<
+                  boost::tuple<shared_model::interface::types::HeightType>>
+                  heights =
+                      (sql->prepare << "SELECT height FROM top_block_info");
+              auto row = heights.begin();
+              known_height = row != heights.end() ? row->get<0>() : 0;
+              checked = now.count();
+            }
+            if (known_height >= required_height) {
+              return expected::makeValue(std::move(sql));
+            }
+          } catch (const std::exception &e) {
+            // the replica is checked again by the next read session
+            known_height = 0;
+            log_->warn("Failed to check height of replica: {}", e.what());
+          }
+        }
+        log_->debug("Replicas are behind height {}, using primary server",
+                    required_height);
+      }
+      return query_sessions_.session();
     }
 
     expected::Result<ConnectionContext, std::string>
-    StorageImpl::initConnections(std::string block_store_dir,
-                                 logger::LoggerPtr log) {
+    StorageImpl::initConnections(
+        std::string block_store_dir,
+        const BlockStoreOptions &block_store_options,
+        const shared_model::interface::BlockJsonConverter &converter,
+        logger::LoggerPtr log) {
       log->info("Start storage creation");
 
-      auto block_store = FlatFile::create(block_store_dir, log);
+      boost::optional<std::unique_ptr<KeyValueStorage>> block_store;
+      FlatFile *flat_file = nullptr;
+      switch (block_store_options.type) {
+        case BlockStoreType::kFlatFile:
+          if (auto created = FlatFile::create(block_store_dir, log)) {
+            flat_file = created->get();
+            block_store =
+                std::unique_ptr<KeyValueStorage>(std::move(*created));
+          }
+          break;
+        case BlockStoreType::kSegmentedLog: {
+          SegmentWriteOptions write_options;
+          write_options.preallocate = block_store_options.preallocate_segments;
+          write_options.direct_io = block_store_options.direct_io;
+          block_store =
+              SegmentedBlockLog::create(block_store_dir,
+                                        log,
+                                        block_store_options.segment_size,
+                                        write_options);
+          break;
+        }
+      }
       if (not block_store) {
         return expected::makeError(
             (boost::format("Cannot create block store in %s") % block_store_dir)
@@ -273,6 +611,72 @@ namespace iroha {
       }
       log->info("block store created");
 
+      if (block_store_options.retained_blocks != 0) {
+        auto archive = FlatFile::create(block_store_options.archive_path, log);
+        if (not archive) {
+          return expected::makeError(
+              (boost::format("Cannot create block archive in %s")
+               % block_store_options.archive_path)
+                  .str());
+        }
+        block_store = std::make_unique<ArchivedKeyValueStorage>(
+            std::move(*block_store),
+            std::move(*archive),
+            block_store_options.retained_blocks,
+            log);
+        log->info("block store retains {} blocks, older ones are archived",
+                  block_store_options.retained_blocks);
+      }
+
+      if (block_store_options.compression) {
+        block_store = std::make_unique<CompressedKeyValueStorage>(
+            std::move(*block_store), log);
+        log->info("block store is compressed");
+      }
+
+      if (block_store_options.verify_on_startup and flat_file
+          and not flat_file->blockIdentifiers().empty()) {
+        ThreadPool pool(std::max(1u, std::thread::hardware_concurrency()));
+        auto last_valid_id =
+            verifyBlockStore(**block_store,
+                             *flat_file->blockIdentifiers().begin(),
+                             converter,
+                             pool,
+                             log);
+        if (last_valid_id != flat_file->last_id()) {
+          log->warn("Removing blocks after {} from the block store",
+                    last_valid_id);
+          if (not flat_file->truncate(last_valid_id)) {
+            return expected::makeError(
+                (boost::format("Cannot remove invalid blocks from %s")
+                 % block_store_dir)
+                    .str());
+          }
+        }
+      }
+
+      switch (block_store_options.sync) {
+        case BlockStoreSync::kNone:
+          break;
+        case BlockStoreSync::kEveryBlock:
+          block_store = std::make_unique<SyncedKeyValueStorage>(
+              std::move(*block_store), std::chrono::milliseconds::zero(), log);
+          log->info("block store syncs every block");
+          break;
+        case BlockStoreSync::kGroup:
+          block_store = std::make_unique<SyncedKeyValueStorage>(
+              std::move(*block_store), block_store_options.sync_interval, log);
+          log->info("block store syncs blocks every {} ms",
+                    block_store_options.sync_interval.count());
+          break;
+      }
+
+      if (block_store_options.async_write) {
+        block_store = std::make_unique<AsyncKeyValueStorage>(
+            std::move(*block_store), log);
+        log->info("block store writes are asynchronous");
+      }
+
       return expected::makeValue(ConnectionContext(std::move(*block_store)));
     }
 
@@ -286,9 +690,26 @@ namespace iroha {
             perm_converter,
         std::unique_ptr<BlockStorageFactory> block_storage_factory,
         logger::LoggerManagerTreePtr log_manager,
-        size_t pool_size) {
-      return initConnections(block_store_dir, log_manager->getLogger()) |
+        size_t pool_size,
+        const BlockStoreOptions &block_store_options) {
+      auto log = log_manager->getLogger();
+      auto start = std::chrono::steady_clock::now();
+      auto log_phase = [&log, &start](const char *phase) {
+        auto now = std::chrono::steady_clock::now();
+        log->info("{} in {} ms",
+                  phase,
+                  std::chrono::duration_cast<std::chrono::milliseconds>(
+                      now - start)
+                      .count());
+        start = now;
+      };
+
+      return initConnections(block_store_dir,
+                             block_store_options,
+                             *converter,
+                             log) |
           [&](auto &&ctx) {
+            log_phase("Opened block store");
             auto opt_ledger_state = [&] {
               soci::session sql{*pool_wrapper.connection_pool_};
 
@@ -346,6 +767,14 @@ namespace iroha {
                   });
             }();
 
+            log_phase("Loaded ledger state");
+
+            auto tx_filter = [&] {
+              soci::session sql{*pool_wrapper.connection_pool_};
+              return loadTxHashFilter(sql, log);
+            }();
+            log_phase("Loaded transaction hash filter");
+
             return expected::makeValue(std::shared_ptr<StorageImpl>(
                 new StorageImpl(std::move(opt_ledger_state),
                                 std::move(postgres_options),
@@ -355,27 +784,67 @@ namespace iroha {
                                 perm_converter,
                                 std::move(block_storage_factory),
                                 pool_size,
+                                std::make_shared<BlockCache>(
+                                    block_store_options.block_cache_size),
+                                std::move(tx_filter),
+                                block_store_options.retained_blocks,
                                 std::move(log_manager))));
           };
     }
 
     CommitResult StorageImpl::commit(
         std::unique_ptr<MutableStorage> mutable_storage) {
-      auto storage = static_cast<MutableStorageImpl *>(mutable_storage.get());
+      return commitStorage(
+          static_cast<MutableStorageImpl &>(*mutable_storage));
+    }
+
+    CommitResult StorageImpl::commitIntermediate(
+        MutableStorage &mutable_storage) {
+      auto &storage = static_cast<MutableStorageImpl &>(mutable_storage);
+      auto result = commitStorage(storage);
+      if (expected::hasValue(result)) {
+        // stored blocks are not kept in memory until the final commit
+        storage.block_storage_->clear();
+        try {
+          *storage.sql_ << "BEGIN";
+        } catch (std::exception &e) {
+          return expected::makeError(e.what());
+        }
+        storage.committed = false;
+      }
+      return result;
+    }
+
+    CommitResult StorageImpl::commitStorage(MutableStorageImpl &storage) {
+      metrics::ScopedTimer timer(commit_time_metric_);
 
       try {
-        *(storage->sql_) << "COMMIT";
+        metrics::ScopedTimer database_timer(database_commit_time_metric_);
+        *(storage.sql_) << "COMMIT";
       } catch (std::exception &e) {
-        storage->committed = false;
+        storage.committed = false;
         return expected::makeError(e.what());
       }
-      storage->committed = true;
+      storage.committed = true;
 
-      storage->block_storage_->forEach(
-          [this](const auto &block) { this->storeBlock(block); });
+      {
+        metrics::ScopedTimer block_store_timer(block_store_time_metric_);
+        // the blocks are served from memory until they are stored
+        auto pending = std::make_shared<InMemoryBlockStorage>();
+        storage.block_storage_->forEach(
+            [&pending](const auto &block) { pending->insert(block); });
+        if (pending->size() != 0) {
+          pending_blocks_->set(std::move(pending));
+        }
+        storage.block_storage_->forEach(
+            [this](const auto &block) { this->storeBlock(block); });
+        pending_blocks_->reset();
+      }
 
-      ledger_state_ = storage->getLedgerState();
+      setLedgerState(storage.getLedgerState());
       if (ledger_state_) {
+        height_metric_.set((*ledger_state_)->top_block_info.height);
+        pruneHistory(*storage.sql_, (*ledger_state_)->top_block_info.height);
         return expected::makeValue(ledger_state_.value());
       } else {
         return expected::makeError(
@@ -385,21 +854,17 @@ namespace iroha {
     }
 
     bool StorageImpl::preparedCommitEnabled() const {
-      return prepared_blocks_enabled_ and block_is_prepared_;
+      return block_is_prepared_;
     }
 
     CommitResult StorageImpl::commitPrepared(
         std::shared_ptr<const shared_model::interface::Block> block) {
-      if (not prepared_blocks_enabled_) {
-        return expected::makeError(
-            std::string{"prepared blocks are not enabled"});
-      }
-
       if (not block_is_prepared_) {
         return expected::makeError("there are no prepared blocks");
       }
 
       log_->info("applying prepared block");
+      metrics::ScopedTimer timer(commit_time_metric_);
 
       try {
         std::shared_lock<std::shared_timed_mutex> lock(drop_mutex_);
@@ -408,31 +873,38 @@ namespace iroha {
               "commitPrepared: connection to database is not initialised");
           return expected::makeError(std::move(msg));
         }
-        soci::session sql(*connection_);
-        sql << "COMMIT PREPARED '" + prepared_block_name_ + "';";
-        PostgresBlockIndex block_index(
-            std::make_unique<PostgresIndexer>(sql),
-            log_manager_->getChild("BlockIndex")->getLogger());
-        block_index.index(*block);
-        block_is_prepared_ = false;
 
-        return storeBlock(block) | [this, &sql, &block]() -> CommitResult {
-          decltype(
-              std::declval<PostgresWsvQuery>().getPeers()) opt_ledger_peers;
+        if (not prepared_blocks_enabled_) {
+          std::unique_ptr<TemporaryWsv> wsv;
           {
-            auto peer_query = PostgresWsvQuery(
-                sql, this->log_manager_->getChild("WsvQuery")->getLogger());
-            if (not(opt_ledger_peers = peer_query.getPeers())) {
-              return expected::makeError(
-                  std::string{"Failed to get ledger peers! Will retry."});
-            }
+            std::lock_guard<std::mutex> wsv_lock(prepared_wsv_mutex_);
+            wsv = std::move(prepared_wsv_);
+            block_is_prepared_ = false;
           }
-          assert(opt_ledger_peers);
+          if (not wsv) {
+            return expected::makeError("there are no prepared blocks");
+          }
+          // the state is rolled back when wsv is destroyed, unless the
+          // transaction is committed
+          return storePreparedBlock(
+              *static_cast<TemporaryWsvImpl &>(*wsv).sql_, block, true);
+        }
 
-          ledger_state_ = std::make_shared<const LedgerState>(
-              std::move(*opt_ledger_peers), block->height(), block->hash());
-          return expected::makeValue(ledger_state_.value());
-        };
+        auto session = commit_sessions_.session();
+        if (auto e = boost::get<expected::Error<std::string>>(&session)) {
+          return *e;
+        }
+        soci::session &sql =
+            *boost::get<expected::Value<std::unique_ptr<soci::session>>>(
+                 session)
+                 .value;
+        // the prepared state is indexed after it is committed, so top block
+        // info is invalid until the block is indexed and WSV restore must not
+        // start from it if indexing is interrupted
+        sql << "DELETE FROM top_block_info";
+        sql << "COMMIT PREPARED '" + prepared_block_name_ + "';";
+        block_is_prepared_ = false;
+        return storePreparedBlock(sql, block, false);
       } catch (const std::exception &e) {
         std::string msg((boost::format("failed to apply prepared block %s: %s")
                          % block->hash().hex() % e.what())
@@ -441,14 +913,147 @@ namespace iroha {
       }
     }
 
+    CommitResult StorageImpl::storePreparedBlock(
+        soci::session &sql,
+        std::shared_ptr<const shared_model::interface::Block> block,
+        bool index_in_transaction) {
+      PostgresBlockIndex block_index(
+          std::make_unique<PostgresIndexer>(sql),
+          log_manager_->getChild("BlockIndex")->getLogger(),
+          tx_filter_);
+      block_index.index(*block);
+      if (index_in_transaction) {
+        sql << "COMMIT";
+      }
+
+      return storeBlock(block) | [this, &sql, &block]() -> CommitResult {
+        decltype(std::declval<PostgresWsvQuery>().getPeers()) opt_ledger_peers;
+        if (ledger_state_ and not changesLedgerPeers(*block)) {
+          opt_ledger_peers = ledger_state_.value()->ledger_peers;
+        } else {
+          auto peer_query = PostgresWsvQuery(
+              sql, this->log_manager_->getChild("WsvQuery")->getLogger());
+          if (not(opt_ledger_peers = peer_query.getPeers())) {
+            return expected::makeError(
+                std::string{"Failed to get ledger peers! Will retry."});
+          }
+        }
+        assert(opt_ledger_peers);
+
+        setLedgerState(std::make_shared<const LedgerState>(
+            std::move(*opt_ledger_peers), block->height(), block->hash()));
+        height_metric_.set(block->height());
+        pruneHistory(sql, block->height());
+        return expected::makeValue(ledger_state_.value());
+      };
+    }
+
+    void StorageImpl::pruneHistory(
+        soci::session &sql,
+        shared_model::interface::types::HeightType top_height) {
+      if (retained_blocks_ == 0
+          or top_height < retained_blocks_ + kHistoryPartitionBlocks) {
+        return;
+      }
+      const auto pruned_height = (top_height - retained_blocks_ + 1)
+              / kHistoryPartitionBlocks * kHistoryPartitionBlocks
+          - 1;
+      if (pruned_height <= pruned_height_) {
+        return;
+      }
+
+      // the last pruned block is the newest one, its transactions expire last
+      if (prune_candidate_.first != pruned_height) {
+        auto serialized_block = block_store_->getView(pruned_height);
+        if (not serialized_block) {
+          log_->warn("Cannot read block {} to prune history", pruned_height);
+          return;
+        }
+        using TimestampType = shared_model::interface::types::TimestampType;
+        auto created_time =
+            converter_
+                ->deserialize(serialized_block->charData(),
+                              serialized_block->size())
+                .match(
+                    [](const auto &block) -> boost::optional<TimestampType> {
+                      return block.value->createdTime();
+                    },
+                    [this, pruned_height](const auto &error)
+                        -> boost::optional<TimestampType> {
+                      log_->warn("Cannot parse block {} to prune history: {}",
+                                 pruned_height,
+                                 error.error);
+                      return boost::none;
+                    });
+        if (not created_time) {
+          return;
+        }
+        prune_candidate_ = {pruned_height, *created_time};
+      }
+      const auto now = std::chrono::duration_cast<std::chrono::milliseconds>(
+                           std::chrono::system_clock::now().time_since_epoch())
+                           .count();
+      if (now - static_cast<int64_t>(prune_candidate_.second)
+          < shared_model::validation::FieldValidator::kMaxDelay) {
+        return;
+      }
+
+      try {
+        sql << "SELECT prune_history(" + std::to_string(pruned_height) + ")";
+        pruned_height_ = pruned_height;
+        log_->info("Pruned history up to height {}", pruned_height);
+      } catch (const std::exception &e) {
+        log_->warn("Failed to prune history up to height {}: {}",
+                   pruned_height,
+                   e.what());
+      }
+    }
+
+    void StorageImpl::setLedgerState(
+        boost::optional<std::shared_ptr<const iroha::LedgerState>>
+            ledger_state) {
+      ledger_state_ = std::move(ledger_state);
+      std::atomic_store(&ledger_peers_,
+                        ledger_state_ ? ledger_state_.value() : nullptr);
+    }
+
+    void StorageImpl::reloadLedgerPeers(soci::session &sql) {
+      if (not ledger_state_) {
+        return;
+      }
+      auto opt_ledger_peers =
+          PostgresWsvQuery(sql,
+                           log_manager_->getChild("WsvQuery")->getLogger())
+              .getPeers();
+      if (not opt_ledger_peers) {
+        // blocks read peers from WSV until the next commit
+        log_->error("Failed to reload ledger peers");
+        setLedgerState(boost::none);
+        return;
+      }
+      const auto &top_block_info = ledger_state_.value()->top_block_info;
+      setLedgerState(
+          std::make_shared<const LedgerState>(std::move(*opt_ledger_peers),
+                                              top_block_info.height,
+                                              top_block_info.top_hash));
+    }
+
     std::shared_ptr<WsvQuery> StorageImpl::getWsvQuery() const {
       std::shared_lock<std::shared_timed_mutex> lock(drop_mutex_);
       if (not connection_) {
         log_->info("getWsvQuery: connection to database is not initialised");
         return nullptr;
       }
+      auto session = query_sessions_.session();
+      if (auto e = boost::get<expected::Error<std::string>>(&session)) {
+        log_->warn("getWsvQuery: {}", e->error);
+        return nullptr;
+      }
       return std::make_shared<PostgresWsvQuery>(
-          std::make_unique<soci::session>(*connection_),
+          std::move(
+              boost::get<expected::Value<std::unique_ptr<soci::session>>>(
+                  session)
+                  .value),
           log_manager_->getChild("WsvQuery")->getLogger());
     }
 
@@ -458,11 +1063,22 @@ namespace iroha {
         log_->info("getBlockQuery: connection to database is not initialised");
         return nullptr;
       }
+      auto session = query_sessions_.session();
+      if (auto e = boost::get<expected::Error<std::string>>(&session)) {
+        log_->warn("getBlockQuery: {}", e->error);
+        return nullptr;
+      }
       return std::make_shared<PostgresBlockQuery>(
-          std::make_unique<soci::session>(*connection_),
+          std::move(
+              boost::get<expected::Value<std::unique_ptr<soci::session>>>(
+                  session)
+                  .value),
           *block_store_,
           converter_,
-          log_manager_->getChild("PostgresBlockQuery")->getLogger());
+          log_manager_->getChild("PostgresBlockQuery")->getLogger(),
+          block_cache_,
+          tx_filter_,
+          pending_blocks_);
     }
 
     rxcpp::observable<std::shared_ptr<const shared_model::interface::Block>>
@@ -472,14 +1088,17 @@ namespace iroha {
 
     void StorageImpl::prepareBlock(std::unique_ptr<TemporaryWsv> wsv) {
       auto &wsv_impl = static_cast<TemporaryWsvImpl &>(*wsv);
-      if (not prepared_blocks_enabled_) {
-        log_->warn("prepared blocks are not enabled");
-        return;
-      }
       if (block_is_prepared_) {
         log_->warn(
             "Refusing to add new prepared state, because there already is one. "
             "Multiple prepared states are not yet supported.");
+      } else if (not prepared_blocks_enabled_) {
+        // keep the transaction of temporary WSV open until the block is
+        // committed or another state is needed
+        std::lock_guard<std::mutex> lock(prepared_wsv_mutex_);
+        prepared_wsv_ = std::move(wsv);
+        block_is_prepared_ = true;
+        log_->info("state kept for commit");
       } else {
         soci::session &sql = *wsv_impl.sql_;
         try {
@@ -500,9 +1119,13 @@ namespace iroha {
 
     StorageImpl::StoreBlockResult StorageImpl::storeBlock(
         std::shared_ptr<const shared_model::interface::Block> block) {
+      // the state changed by the block is committed already, so the cached
+      // signatories are stale even if the block fails to be stored
+      signatories_cache_->invalidate(*block);
       return converter_->serialize(*block).match(
           [this, &block](const auto &v) -> StoreBlockResult {
             if (block_store_->add(block->height(), stringToBytes(v.value))) {
+              block_cache_->insert(block, v.value.size());
               notifier_.get_subscriber().on_next(block);
               return {};
             } else {
@@ -523,6 +1146,15 @@ namespace iroha {
     void StorageImpl::tryRollback(soci::session &session) {
       // TODO 17.06.2019 luckychess IR-568 split connection and schema
       // initialisation
+      {
+        std::lock_guard<std::mutex> lock(prepared_wsv_mutex_);
+        if (prepared_wsv_) {
+          // rolls back the kept state and returns its session to the pool
+          prepared_wsv_.reset();
+          block_is_prepared_ = false;
+          return;
+        }
+      }
       if (block_is_prepared_) {
         PgConnectionInit::rollbackPrepared(session, prepared_block_name_)
             .match([this](auto &&v) { block_is_prepared_ = false; },
@@ -533,5 +1165,19 @@ namespace iroha {
       }
     }
 
+    expected::Result<void, std::string> StorageImpl::prepareStatements(
+        soci::session &sql) const {
+      if (not postgres_options_->lazyStatementPreparation()) {
+        return expected::Value<void>();
+      }
+      try {
+        PgConnectionInit::prepareStatementsOnce(sql);
+      } catch (const std::exception &e) {
+        return expected::makeError(
+            std::string{"Failed to prepare statements: "} + e.what());
+      }
+      return expected::Value<void>();
+    }
+
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -9,13 +9,22 @@
 #include "ametsuchi/storage.hpp"
 
 #include <atomic>
+#include <chrono>
+#include <mutex>
 #include <shared_mutex>
+#include <vector>
 
 #include <soci/soci.h>
 #include <boost/optional.hpp>
 #include "ametsuchi/block_storage_factory.hpp"
+#include "ametsuchi/impl/block_cache.hpp"
+#include "ametsuchi/impl/block_store_options.hpp"
+#include "ametsuchi/impl/pending_blocks.hpp"
+#include "ametsuchi/impl/tx_hash_filter.hpp"
 #include "ametsuchi/impl/pool_wrapper.hpp"
 #include "ametsuchi/impl/postgres_options.hpp"
+#include "ametsuchi/impl/session_pool.hpp"
+#include "ametsuchi/impl/signatories_cache.hpp"
 #include "ametsuchi/key_value_storage.hpp"
 #include "ametsuchi/ledger_state.hpp"
 #include "ametsuchi/reconnection_strategy.hpp"
@@ -24,6 +33,7 @@
 #include "interfaces/permission_to_string.hpp"
 #include "logger/logger_fwd.hpp"
 #include "logger/logger_manager_fwd.hpp"
+#include "metrics/metrics.hpp"
 
 namespace iroha {
   namespace ametsuchi {
@@ -37,7 +47,10 @@ namespace iroha {
     class StorageImpl : public Storage {
      protected:
       static expected::Result<ConnectionContext, std::string> initConnections(
-          std::string block_store_dir, logger::LoggerPtr log);
+          std::string block_store_dir,
+          const BlockStoreOptions &block_store_options,
+          const shared_model::interface::BlockJsonConverter &converter,
+          logger::LoggerPtr log);
 
      public:
       static expected::Result<std::shared_ptr<StorageImpl>, std::string> create(
@@ -50,7 +63,8 @@ namespace iroha {
               perm_converter,
           std::unique_ptr<BlockStorageFactory> block_storage_factory,
           logger::LoggerManagerTreePtr log_manager,
-          size_t pool_size = 10);
+          size_t pool_size = 10,
+          const BlockStoreOptions &block_store_options = BlockStoreOptions{});
 
       expected::Result<std::unique_ptr<TemporaryWsv>, std::string>
       createTemporaryWsv() override;
@@ -64,6 +78,12 @@ namespace iroha {
       boost::optional<std::shared_ptr<BlockQuery>> createBlockQuery()
           const override;
 
+      boost::optional<std::unique_ptr<WsvSnapshotExporter>>
+      createWsvSnapshotExporter() const override;
+
+      boost::optional<std::unique_ptr<WsvSnapshotImporter>>
+      createWsvSnapshotImporter() override;
+
       boost::optional<std::shared_ptr<QueryExecutor>> createQueryExecutor(
           std::shared_ptr<PendingTransactionStorage> pending_txs_storage,
           std::shared_ptr<shared_model::interface::QueryResponseFactory>
@@ -82,6 +102,11 @@ namespace iroha {
 
       expected::Result<void, std::string> resetWsv() override;
 
+      expected::Result<void, std::string> dropConstraints() override;
+
+      expected::Result<void, std::string> restoreConstraints(
+          size_t threads) override;
+
       void resetPeers() override;
 
       void dropStorage() override;
@@ -91,6 +116,8 @@ namespace iroha {
       CommitResult commit(
           std::unique_ptr<MutableStorage> mutable_storage) override;
 
+      CommitResult commitIntermediate(MutableStorage &mutable_storage) override;
+
       bool preparedCommitEnabled() const override;
 
       CommitResult commitPrepared(
@@ -119,6 +146,9 @@ namespace iroha {
                       perm_converter,
                   std::unique_ptr<BlockStorageFactory> block_storage_factory,
                   size_t pool_size,
+                  std::shared_ptr<BlockCache> block_cache,
+                  std::shared_ptr<TxHashFilter> tx_filter,
+                  shared_model::interface::types::HeightType retained_blocks,
                   logger::LoggerManagerTreePtr log_manager);
 
       // db info
@@ -137,18 +167,105 @@ namespace iroha {
       StoreBlockResult storeBlock(
           std::shared_ptr<const shared_model::interface::Block> block);
 
+      /// commit the transaction of mutable storage and store its blocks
+      CommitResult commitStorage(MutableStorageImpl &storage);
+
+      /// set the ledger state of the top block and share its peers
+      void setLedgerState(
+          boost::optional<std::shared_ptr<const iroha::LedgerState>>
+              ledger_state);
+
+      /// read ledger peers changed outside of blocks into the ledger state
+      void reloadLedgerPeers(soci::session &sql);
+
       /**
        * Method tries to perform rollback on passed session
        */
       void tryRollback(soci::session &session);
 
+      /**
+       * Prepare the statements of the executors on the session if they are
+       * prepared lazily and not prepared on its connection yet
+       * @return error message if preparation has failed
+       */
+      expected::Result<void, std::string> prepareStatements(
+          soci::session &sql) const;
+
+      /**
+       * Index the prepared block, add it to block storage and update ledger
+       * state after its WSV changes are committed
+       * @param sql - session to index the block with
+       * @param block - the committed block
+       * @param index_in_transaction - whether sql has an open transaction to
+       * be committed after the block is indexed
+       */
+      CommitResult storePreparedBlock(
+          soci::session &sql,
+          std::shared_ptr<const shared_model::interface::Block> block,
+          bool index_in_transaction);
+
+      /**
+       * Remove history index rows of the blocks which are not retained by
+       * the block store, by whole partitions of the history tables and only
+       * when the transactions of the blocks have expired, so their replays
+       * are still rejected. Failures are logged and retried after the next
+       * commit
+       * @param sql - session to prune the history with
+       * @param top_height - height of the committed top block
+       */
+      void pruneHistory(soci::session &sql,
+                        shared_model::interface::types::HeightType top_height);
+
+      /**
+       * Create session for read-only queries. A replica is used if it has
+       * applied the current top block, otherwise the session is connected to
+       * the primary server. The height of a replica is read only if the last
+       * one read is behind the top block or expired, or the last read failed.
+       * Must be called under drop_mutex_
+       * @return session or error if no connection to the primary server
+       * became free in time
+       */
+      expected::Result<std::unique_ptr<soci::session>, std::string>
+      createReadSession() const;
+
       std::unique_ptr<KeyValueStorage> block_store_;
 
+      /// parsed recently committed blocks, shared with block queries
+      std::shared_ptr<BlockCache> block_cache_;
+
+      /// hashes of stored transactions, shared with block indices and queries
+      std::shared_ptr<TxHashFilter> tx_filter_;
+
+      /// signatories of accounts in the committed state, shared with
+      /// temporary WSVs validating proposals
+      std::shared_ptr<SignatoriesCache> signatories_cache_;
+
+      /// blocks of the last commit until they are stored, shared with block
+      /// queries
+      std::shared_ptr<PendingBlocks> pending_blocks_;
+
+      /// number of the last blocks whose history is kept, zero keeps all
+      const shared_model::interface::types::HeightType retained_blocks_;
+      /// last height whose history is pruned since the start
+      shared_model::interface::types::HeightType pruned_height_{0};
+      /// height and creation time of the block checked by the last prune
+      std::pair<shared_model::interface::types::HeightType,
+                shared_model::interface::types::TimestampType>
+          prune_candidate_{0, 0};
+
       PoolWrapper pool_wrapper_;
 
       /// ref for pool_wrapper_::connection_pool_
       std::shared_ptr<soci::connection_pool> &connection_;
 
+      /// sessions of queries, block queries and WSV queries
+      SessionPool query_sessions_;
+      /// sessions of block commit, reserved unless reservation is disabled
+      SessionPool commit_sessions_;
+      /// sessions of stateful validation, reserved unless reservation is
+      /// disabled
+      SessionPool validation_sessions_;
+
       rxcpp::composite_subscription notifier_lifetime_;
       rxcpp::subjects::subject<
           std::shared_ptr<const shared_model::interface::Block>>
@@ -170,11 +287,38 @@ namespace iroha {
 
       bool prepared_blocks_enabled_;
 
+      /// replica to be checked first by the next read session
+      mutable std::atomic<size_t> next_replica_{0};
+
+      /// heights of replicas read by the last checks of read sessions
+      mutable std::vector<
+          std::atomic<shared_model::interface::types::HeightType>>
+          replica_heights_;
+
+      /// times of the last reads of replica heights, since the steady clock
+      /// epoch
+      mutable std::vector<std::atomic<std::chrono::steady_clock::rep>>
+          replica_checks_;
+
       std::atomic<bool> block_is_prepared_;
 
       std::string prepared_block_name_;
 
+      /// temporary WSV with uncommitted prepared state, used when prepared
+      /// transactions are not enabled
+      std::unique_ptr<TemporaryWsv> prepared_wsv_;
+      std::mutex prepared_wsv_mutex_;
+
       boost::optional<std::shared_ptr<const iroha::LedgerState>> ledger_state_;
+
+      /// ledger_state_ shared with peer queries and read sessions, it is
+      /// replaced as a whole and accessed atomically
+      std::shared_ptr<const iroha::LedgerState> ledger_peers_;
+
+      metrics::Histogram &commit_time_metric_;
+      metrics::Histogram &database_commit_time_metric_;
+      metrics::Histogram &block_store_time_metric_;
+      metrics::Gauge &height_metric_;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
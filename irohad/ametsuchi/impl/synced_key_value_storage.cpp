@@ -0,0 +1,115 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/synced_key_value_storage.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "logger/logger.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    SyncedKeyValueStorage::SyncedKeyValueStorage(
+        std::unique_ptr<KeyValueStorage> storage,
+        std::chrono::milliseconds interval,
+        logger::LoggerPtr log)
+        : storage_(std::move(storage)),
+          interval_(interval),
+          log_(std::move(log)),
+          sync_time_metric_(metrics::registry().histogram(
+              "iroha_block_store_sync_microseconds",
+              "Time spent flushing written blocks to disk")),
+          unsynced_from_(std::numeric_limits<Identifier>::max()),
+          unsynced_to_(0),
+          stop_(false) {
+      if (interval_.count() > 0) {
+        syncer_ = std::thread([this] { syncLoop(); });
+      }
+    }
+
+    SyncedKeyValueStorage::~SyncedKeyValueStorage() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+      }
+      stop_cv_.notify_one();
+      if (syncer_.joinable()) {
+        syncer_.join();
+      }
+      std::lock_guard<std::mutex> lock(mutex_);
+      syncUnsynced();
+    }
+
+    bool SyncedKeyValueStorage::add(Identifier id, const Bytes &blob) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (not storage_->add(id, blob)) {
+        return false;
+      }
+      unsynced_from_ = std::min(unsynced_from_, id);
+      unsynced_to_ = std::max(unsynced_to_, id);
+      if (interval_.count() == 0) {
+        return syncUnsynced();
+      }
+      return true;
+    }
+
+    boost::optional<KeyValueStorage::Bytes> SyncedKeyValueStorage::get(
+        Identifier id) const {
+      return storage_->get(id);
+    }
+
+    boost::optional<KeyValueStorage::BytesView> SyncedKeyValueStorage::getView(
+        Identifier id) const {
+      return storage_->getView(id);
+    }
+
+    std::string SyncedKeyValueStorage::directory() const {
+      return storage_->directory();
+    }
+
+    KeyValueStorage::Identifier SyncedKeyValueStorage::last_id() const {
+      return storage_->last_id();
+    }
+
+    void SyncedKeyValueStorage::dropAll() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      storage_->dropAll();
+      unsynced_from_ = std::numeric_limits<Identifier>::max();
+      unsynced_to_ = 0;
+    }
+
+    bool SyncedKeyValueStorage::sync(Identifier from, Identifier to) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return storage_->sync(from, to);
+    }
+
+    bool SyncedKeyValueStorage::syncUnsynced() {
+      if (unsynced_from_ > unsynced_to_) {
+        return true;
+      }
+      metrics::ScopedTimer timer(sync_time_metric_);
+      if (not storage_->sync(unsynced_from_, unsynced_to_)) {
+        // the range is kept and synced again next time
+        log_->error("Cannot sync entries from {} to {}",
+                    unsynced_from_,
+                    unsynced_to_);
+        return false;
+      }
+      unsynced_from_ = std::numeric_limits<Identifier>::max();
+      unsynced_to_ = 0;
+      return true;
+    }
+
+    void SyncedKeyValueStorage::syncLoop() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (not stop_cv_.wait_for(lock, interval_, [this] { return stop_; })) {
+        syncUnsynced();
+      }
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
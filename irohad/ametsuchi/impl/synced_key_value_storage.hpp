@@ -0,0 +1,90 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SYNCED_KEY_VALUE_STORAGE_HPP
+#define IROHA_SYNCED_KEY_VALUE_STORAGE_HPP
+
+#include "ametsuchi/key_value_storage.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "logger/logger_fwd.hpp"
+#include "metrics/metrics.hpp"
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Storage which flushes added entries of the underlying storage to disk.
+     * With zero interval every entry is synced before add() returns, so a
+     * committed block survives a crash of the host. Otherwise entries added
+     * during an interval are synced together by a background thread, which
+     * bounds the loss on a crash by the interval while a sync is shared by
+     * many entries. Time of syncs is recorded in a metric.
+     */
+    class SyncedKeyValueStorage : public KeyValueStorage {
+     public:
+      /**
+       * @param storage - storage to sync entries of
+       * @param interval - interval of group syncs, zero syncs every entry
+       * @param log - logger
+       */
+      SyncedKeyValueStorage(std::unique_ptr<KeyValueStorage> storage,
+                            std::chrono::milliseconds interval,
+                            logger::LoggerPtr log);
+
+      /**
+       * Syncs entries which are not synced yet before destruction
+       */
+      ~SyncedKeyValueStorage() override;
+
+      /**
+       * Returns false if the entry is added but is not synced in the mode
+       * of syncing every entry
+       */
+      bool add(Identifier id, const Bytes &blob) override;
+
+      boost::optional<Bytes> get(Identifier id) const override;
+
+      boost::optional<BytesView> getView(Identifier id) const override;
+
+      std::string directory() const override;
+
+      Identifier last_id() const override;
+
+      void dropAll() override;
+
+      bool sync(Identifier from, Identifier to) override;
+
+     private:
+      /// sync the range of unsynced entries, must be called under mutex_
+      bool syncUnsynced();
+
+      /// background thread routine of group syncs
+      void syncLoop();
+
+      std::unique_ptr<KeyValueStorage> storage_;
+      const std::chrono::milliseconds interval_;
+      logger::LoggerPtr log_;
+      metrics::Histogram &sync_time_metric_;
+
+      /// serializes access to storage_ and guards the state below
+      std::mutex mutex_;
+      std::condition_variable stop_cv_;
+      /// range of added entries which are not synced, empty if from > to
+      Identifier unsynced_from_;
+      Identifier unsynced_to_;
+      bool stop_;
+
+      std::thread syncer_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_SYNCED_KEY_VALUE_STORAGE_HPP
@@ -5,11 +5,20 @@
 
 #include "ametsuchi/impl/temporary_wsv_impl.hpp"
 
-#include <boost/format.hpp>
+#include <algorithm>
+
+#include <boost/range/size.hpp>
+#include <boost/tuple/tuple.hpp>
 #include "ametsuchi/impl/postgres_command_executor.hpp"
 #include "ametsuchi/tx_executor.hpp"
+#include "common/visitor.hpp"
 #include "cryptography/public_key.hpp"
+#include "interfaces/commands/add_signatory.hpp"
 #include "interfaces/commands/command.hpp"
+#include "interfaces/commands/command_variant.hpp"
+#include "interfaces/commands/create_account.hpp"
+#include "interfaces/commands/remove_signatory.hpp"
+#include "interfaces/commands/set_quorum.hpp"
 #include "interfaces/permission_to_string.hpp"
 #include "interfaces/transaction.hpp"
 #include "logger/logger.hpp"
@@ -20,64 +29,140 @@ namespace iroha {
     TemporaryWsvImpl::TemporaryWsvImpl(
         std::unique_ptr<soci::session> sql,
         std::unique_ptr<TransactionExecutor> transaction_executor,
-        logger::LoggerManagerTreePtr log_manager)
+        logger::LoggerManagerTreePtr log_manager,
+        bool async_commit,
+        std::shared_ptr<SignatoriesCache> committed_signatories)
         : sql_(std::move(sql)),
           transaction_executor_(std::move(transaction_executor)),
+          committed_signatories_(std::move(committed_signatories)),
           log_manager_(std::move(log_manager)),
           log_(log_manager_->getLogger()) {
       *sql_ << "BEGIN";
+      if (async_commit) {
+        // the setting is local to the transaction, so that sessions shared
+        // with other components are not affected
+        *sql_ << "SET LOCAL synchronous_commit = off";
+      }
+    }
+
+    const boost::optional<TemporaryWsvImpl::AccountSignatories>
+        &TemporaryWsvImpl::getAccountSignatories(
+            const shared_model::interface::types::AccountIdType &account_id) {
+      auto cached = signatories_cache_.find(account_id);
+      if (cached != signatories_cache_.end()) {
+        return cached->second;
+      }
+
+      const bool committed = committed_signatories_
+          and changed_accounts_.count(account_id) == 0;
+      SignatoriesCache::Version version = 0;
+      if (committed) {
+        if (auto signatories = committed_signatories_->find(account_id)) {
+          return signatories_cache_.emplace(account_id, *signatories)
+              .first->second;
+        }
+        version = committed_signatories_->version();
+      }
+
+      boost::optional<AccountSignatories> signatories;
+      soci::rowset<boost::tuple<int, boost::optional<std::string>>> rows =
+          (sql_->prepare << R"(SELECT account.quorum,
+                      encode(signatory.public_key, 'hex')
+                  FROM account
+                  LEFT JOIN account_has_signatory AS signatory
+                      ON signatory.account_id = account.account_id
+                  WHERE account.account_id = :account_id)",
+           soci::use(account_id, "account_id"));
+      for (const auto &row : rows) {
+        if (not signatories) {
+          signatories = AccountSignatories{row.get<0>(), {}};
+        }
+        if (auto &public_key = row.get<1>()) {
+          signatories->public_keys.insert(*public_key);
+        }
+      }
+      if (committed and signatories) {
+        committed_signatories_->insert(
+            account_id,
+            std::make_shared<const AccountSignatories>(*signatories),
+            version);
+      }
+      return signatories_cache_.emplace(account_id, std::move(signatories))
+          .first->second;
+    }
+
+    void TemporaryWsvImpl::invalidateSignatories(
+        const shared_model::interface::Transaction &transaction) {
+      namespace interface = shared_model::interface;
+      for (const auto &command : transaction.commands()) {
+        visit_in_place(
+            command.get(),
+            [this](const interface::AddSignatory &c) {
+              this->invalidateSignatories(c.accountId());
+            },
+            [this](const interface::RemoveSignatory &c) {
+              this->invalidateSignatories(c.accountId());
+            },
+            [this](const interface::SetQuorum &c) {
+              this->invalidateSignatories(c.accountId());
+            },
+            [this](const interface::CreateAccount &c) {
+              this->invalidateSignatories(c.accountName() + "@"
+                                          + c.domainId());
+            },
+            [](const auto &) {});
+      }
+    }
+
+    void TemporaryWsvImpl::invalidateSignatories(
+        const shared_model::interface::types::AccountIdType &account_id) {
+      signatories_cache_.erase(account_id);
+      changed_accounts_.insert(account_id);
     }
 
     expected::Result<void, validation::CommandError>
     TemporaryWsvImpl::validateSignatures(
         const shared_model::interface::Transaction &transaction) {
-      auto keys_range = transaction.signatures()
-          | boost::adaptors::transformed(
-                            [](const auto &s) { return s.publicKey().hex(); });
-      auto keys = std::accumulate(
-          std::next(std::begin(keys_range)),
-          std::end(keys_range),
-          keys_range.front(),
-          [](auto acc, const auto &val) { return acc + "'), ('" + val; });
-      // not using bool since it is not supported by SOCI
-      boost::optional<uint8_t> signatories_valid;
-
-      boost::format query(R"(SELECT sum(count) = :signatures_count
-                          AND sum(quorum) <= :signatures_count
-                  FROM
-                      (SELECT count(public_key)
-                      FROM ( VALUES ('%s') ) AS CTE1(public_key)
-                      WHERE public_key IN
-                          (SELECT public_key
-                          FROM account_has_signatory
-                          WHERE account_id = :account_id ) ) AS CTE2(count),
-                          (SELECT quorum
-                          FROM account
-                          WHERE account_id = :account_id) AS CTE3(quorum))");
-
+      const boost::optional<AccountSignatories> *signatories;
       try {
-        auto keys_range_size = boost::size(keys_range);
-        *sql_ << (query % keys).str(), soci::into(signatories_valid),
-            soci::use(keys_range_size, "signatures_count"),
-            soci::use(transaction.creatorAccountId(), "account_id");
+        signatories = &getAccountSignatories(transaction.creatorAccountId());
       } catch (const std::exception &e) {
-        auto error_str = "Transaction " + transaction.toString()
-            + " failed signatures validation with db error: " + e.what();
+        auto error_str = [hash = transaction.hash(),
+                          db_error = std::string{e.what()}] {
+          return "Transaction " + hash.hex()
+              + " failed signatures validation with db error: " + db_error;
+        };
         // TODO [IR-1816] Akvinikym 29.10.18: substitute error code magic number
         // with named constant
         return expected::makeError(validation::CommandError{
-            "signatures validation", 1, error_str, false});
+            "signatures validation", 1, std::move(error_str), false});
       }
 
-      if (signatories_valid and *signatories_valid) {
+      // every signature has to belong to the account, and there has to be at
+      // least quorum of them
+      auto signatures = transaction.signatures();
+      auto signatures_count = boost::size(signatures);
+      auto signatories_valid = *signatories
+          and std::all_of(signatures.begin(),
+                          signatures.end(),
+                          [&signatories](const auto &signature) {
+                            return (*signatories)->public_keys.count(
+                                       signature.publicKey().hex())
+                                != 0;
+                          })
+          and (*signatories)->quorum >= 0
+          and static_cast<size_t>((*signatories)->quorum) <= signatures_count;
+
+      if (signatories_valid) {
         return {};
       } else {
-        auto error_str = "Transaction " + transaction.toString()
-            + " failed signatures validation";
+        auto error_str = [hash = transaction.hash()] {
+          return "Transaction " + hash.hex() + " failed signatures validation";
+        };
         // TODO [IR-1816] Akvinikym 29.10.18: substitute error code magic number
         // with named constant
         return expected::makeError(validation::CommandError{
-            "signatures validation", 2, error_str, false});
+            "signatures validation", 2, std::move(error_str), false});
       }
     }
 
@@ -90,6 +175,7 @@ namespace iroha {
                   savepoint = std::move(savepoint_wrapper),
                   &transaction]()
                  -> expected::Result<void, validation::CommandError> {
+        invalidateSignatories(transaction);
         if (auto error = expected::resultToOptionalError(
                 transaction_executor_->execute(transaction, true))) {
           return expected::makeError(
@@ -108,10 +194,7 @@ namespace iroha {
     std::unique_ptr<TemporaryWsv::SavepointWrapper>
     TemporaryWsvImpl::createSavepoint(const std::string &name) {
       return std::make_unique<TemporaryWsvImpl::SavepointWrapperImpl>(
-          SavepointWrapperImpl(
-              *this,
-              name,
-              log_manager_->getChild("SavepointWrapper")->getLogger()));
+          *this, name, log_manager_->getChild("SavepointWrapper")->getLogger());
     }
 
     TemporaryWsvImpl::~TemporaryWsvImpl() {
@@ -123,14 +206,19 @@ namespace iroha {
     }
 
     TemporaryWsvImpl::SavepointWrapperImpl::SavepointWrapperImpl(
-        const iroha::ametsuchi::TemporaryWsvImpl &wsv,
+        iroha::ametsuchi::TemporaryWsvImpl &wsv,
         std::string savepoint_name,
         logger::LoggerPtr log)
-        : sql_{*wsv.sql_},
+        : wsv_{wsv},
           savepoint_name_{std::move(savepoint_name)},
           is_released_{false},
           log_(std::move(log)) {
-      sql_ << "SAVEPOINT " + savepoint_name_ + ";";
+      std::string query;
+      if (not wsv_.pending_release_.empty()) {
+        query = "RELEASE SAVEPOINT " + wsv_.pending_release_ + "; ";
+        wsv_.pending_release_.clear();
+      }
+      *wsv_.sql_ << query + "SAVEPOINT " + savepoint_name_ + ";";
     }
 
     void TemporaryWsvImpl::SavepointWrapperImpl::release() {
@@ -138,11 +226,15 @@ namespace iroha {
     }
 
     TemporaryWsvImpl::SavepointWrapperImpl::~SavepointWrapperImpl() {
+      // savepoint left pending is nested in this one, since it would have
+      // been released in the database when this one was created otherwise
+      wsv_.pending_release_.clear();
       try {
         if (not is_released_) {
-          sql_ << "ROLLBACK TO SAVEPOINT " + savepoint_name_ + ";";
+          wsv_.signatories_cache_.clear();
+          *wsv_.sql_ << "ROLLBACK TO SAVEPOINT " + savepoint_name_ + ";";
         } else {
-          sql_ << "RELEASE SAVEPOINT " + savepoint_name_ + ";";
+          wsv_.pending_release_ = savepoint_name_;
         }
       } catch (std::exception &e) {
         log_->error("SQL error. Reason: {}", e.what());
@@ -8,8 +8,13 @@
 
 #include "ametsuchi/temporary_wsv.hpp"
 
+#include <unordered_map>
+#include <unordered_set>
+
+#include <boost/optional.hpp>
 #include <soci/soci.h>
 #include "ametsuchi/command_executor.hpp"
+#include "ametsuchi/impl/signatories_cache.hpp"
 #include "logger/logger_fwd.hpp"
 #include "logger/logger_manager_fwd.hpp"
 
@@ -29,7 +34,7 @@ namespace iroha {
 
      public:
       struct SavepointWrapperImpl : public TemporaryWsv::SavepointWrapper {
-        SavepointWrapperImpl(const TemporaryWsvImpl &wsv,
+        SavepointWrapperImpl(TemporaryWsvImpl &wsv,
                              std::string savepoint_name,
                              logger::LoggerPtr log);
 
@@ -38,16 +43,27 @@ namespace iroha {
         ~SavepointWrapperImpl() override;
 
        private:
-        soci::session &sql_;
+        TemporaryWsvImpl &wsv_;
         std::string savepoint_name_;
         bool is_released_;
         logger::LoggerPtr log_;
       };
 
+      /**
+       * @param sql - session of the validation transaction
+       * @param transaction_executor - executor of validated transactions
+       * @param log_manager - log manager
+       * @param async_commit - whether the transaction, if it is committed
+       * with the validated block, does not wait for WAL flush
+       * @param committed_signatories - signatories of accounts in the
+       * committed state, may be null
+       */
       TemporaryWsvImpl(
           std::unique_ptr<soci::session> sql,
           std::unique_ptr<TransactionExecutor> transaction_executor,
-          logger::LoggerManagerTreePtr log_manager);
+          logger::LoggerManagerTreePtr log_manager,
+          bool async_commit = false,
+          std::shared_ptr<SignatoriesCache> committed_signatories = nullptr);
 
       expected::Result<void, validation::CommandError> apply(
           const shared_model::interface::Transaction &transaction) override;
@@ -65,9 +81,57 @@ namespace iroha {
       expected::Result<void, validation::CommandError> validateSignatures(
           const shared_model::interface::Transaction &transaction);
 
+      using AccountSignatories = SignatoriesCache::AccountSignatories;
+
+      /**
+       * @return signatories of the account read from the cache, from the
+       * cache of the committed state unless the account was changed by this
+       * WSV, or from the database, none if there is no such account
+       * @throws soci::soci_error in case of database error
+       */
+      const boost::optional<AccountSignatories> &getAccountSignatories(
+          const shared_model::interface::types::AccountIdType &account_id);
+
+      /**
+       * Drops cached signatories of accounts which may be changed by the
+       * transaction
+       */
+      void invalidateSignatories(
+          const shared_model::interface::Transaction &transaction);
+
+      /// Drop cached signatories of the account changed by this WSV
+      void invalidateSignatories(
+          const shared_model::interface::types::AccountIdType &account_id);
+
       std::unique_ptr<soci::session> sql_;
       std::unique_ptr<TransactionExecutor> transaction_executor_;
 
+      /**
+       * Name of the last released savepoint which is not released in the
+       * database yet, empty if there is none. Its RELEASE is sent together
+       * with the next SAVEPOINT, or is dropped when an enclosing savepoint is
+       * released or rolled back, since that ends it as well. Changes made
+       * after a savepoint stay in the transaction whether it is released or
+       * not, so delaying RELEASE saves a round trip per transaction
+       */
+      std::string pending_release_;
+
+      /**
+       * Signatories of transaction creators read during this WSV lifetime.
+       * Entries are dropped before execution of commands changing them, and
+       * the whole cache is dropped on rollback to a savepoint
+       */
+      std::unordered_map<shared_model::interface::types::AccountIdType,
+                         boost::optional<AccountSignatories>>
+          signatories_cache_;
+
+      /// signatories of accounts in the committed state, may be null
+      std::shared_ptr<SignatoriesCache> committed_signatories_;
+
+      /// accounts whose signatories may differ from the committed state
+      std::unordered_set<shared_model::interface::types::AccountIdType>
+          changed_accounts_;
+
       logger::LoggerManagerTreePtr log_manager_;
       logger::LoggerPtr log_;
     };
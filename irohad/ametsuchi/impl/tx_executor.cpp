@@ -32,3 +32,7 @@ iroha::expected::Result<void, TxExecutionError> TransactionExecutor::execute(
   }
   return {};
 }
+
+CommandResult TransactionExecutor::flush() const {
+  return command_executor_->flush();
+}
@@ -0,0 +1,101 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/tx_hash_filter.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include <boost/functional/hash.hpp>
+#include "cryptography/hash.hpp"
+
+namespace {
+  /// bit mixer from splitmix64, used to derive the second hash function
+  uint64_t mix(uint64_t x) {
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+    return x ^ (x >> 31);
+  }
+
+  uint64_t bitsCount(size_t capacity, double false_positive_rate) {
+    const auto ln2 = std::log(2.);
+    return std::max<uint64_t>(
+        64,
+        static_cast<uint64_t>(
+            std::ceil(-static_cast<double>(capacity)
+                      * std::log(false_positive_rate) / (ln2 * ln2))));
+  }
+}  // namespace
+
+namespace iroha {
+  namespace ametsuchi {
+
+    constexpr size_t TxHashFilter::kMinCapacity;
+
+    TxHashFilter::TxHashFilter(size_t capacity, double false_positive_rate)
+        : capacity_(std::max(capacity, kMinCapacity)),
+          bits_count_(bitsCount(capacity_, false_positive_rate)),
+          hashes_count_(std::max<size_t>(
+              1,
+              static_cast<size_t>(std::round(
+                  static_cast<double>(bits_count_) / capacity_
+                  * std::log(2.))))),
+          words_count_((bits_count_ + 63) / 64),
+          words_(new std::atomic<uint64_t>[words_count_]),
+          count_(0) {
+      clear();
+    }
+
+    template <typename F>
+    void TxHashFilter::forEachBit(const shared_model::crypto::Hash &hash,
+                                  F &&f) const {
+      // double hashing: i-th bit is h1 + i * h2
+      const auto &bytes = hash.blob();
+      const uint64_t h1 = boost::hash_range(bytes.begin(), bytes.end());
+      const uint64_t h2 = mix(h1) | 1;
+      for (size_t i = 0; i < hashes_count_; ++i) {
+        if (not f((h1 + i * h2) % bits_count_)) {
+          return;
+        }
+      }
+    }
+
+    void TxHashFilter::insert(const shared_model::crypto::Hash &hash) {
+      forEachBit(hash, [this](uint64_t bit) {
+        words_[bit / 64].fetch_or(1ull << (bit % 64),
+                                  std::memory_order_relaxed);
+        return true;
+      });
+      count_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool TxHashFilter::mayContain(
+        const shared_model::crypto::Hash &hash) const {
+      bool result = true;
+      forEachBit(hash, [this, &result](uint64_t bit) {
+        result = words_[bit / 64].load(std::memory_order_relaxed)
+            & (1ull << (bit % 64));
+        return result;
+      });
+      return result;
+    }
+
+    void TxHashFilter::clear() {
+      for (size_t i = 0; i < words_count_; ++i) {
+        words_[i].store(0, std::memory_order_relaxed);
+      }
+      count_ = 0;
+    }
+
+    size_t TxHashFilter::count() const {
+      return count_;
+    }
+
+    size_t TxHashFilter::capacity() const {
+      return capacity_;
+    }
+
+  }  // namespace ametsuchi
+}  // namespace iroha
@@ -0,0 +1,85 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_TX_HASH_FILTER_HPP
+#define IROHA_TX_HASH_FILTER_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace shared_model {
+  namespace crypto {
+    class Hash;
+  }  // namespace crypto
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Thread-safe Bloom filter over hashes of transactions stored in the
+     * ledger. Negative answer means that the transaction is definitely not
+     * stored, so a database lookup can be skipped. Filter never gives false
+     * negatives, even when more hashes than its capacity are inserted, only
+     * the false positive rate grows.
+     */
+    class TxHashFilter {
+     public:
+      /// minimal capacity of the filter
+      static constexpr size_t kMinCapacity = 1 << 20;
+
+      /**
+       * @param capacity - expected number of hashes
+       * @param false_positive_rate - desired false positive rate when the
+       * filter holds capacity hashes
+       */
+      explicit TxHashFilter(size_t capacity,
+                            double false_positive_rate = 0.01);
+
+      /**
+       * Add hash to the filter
+       */
+      void insert(const shared_model::crypto::Hash &hash);
+
+      /**
+       * @return false if hash was definitely never inserted
+       */
+      bool mayContain(const shared_model::crypto::Hash &hash) const;
+
+      /**
+       * Remove all hashes from the filter
+       */
+      void clear();
+
+      /**
+       * @return number of inserted hashes
+       */
+      size_t count() const;
+
+      /**
+       * @return number of hashes the filter was sized for
+       */
+      size_t capacity() const;
+
+     private:
+      /**
+       * Call f with position of every bit corresponding to the hash
+       */
+      template <typename F>
+      void forEachBit(const shared_model::crypto::Hash &hash, F &&f) const;
+
+      const size_t capacity_;
+      const uint64_t bits_count_;
+      const size_t hashes_count_;
+      const size_t words_count_;
+      std::unique_ptr<std::atomic<uint64_t>[]> words_;
+      std::atomic<size_t> count_;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_TX_HASH_FILTER_HPP
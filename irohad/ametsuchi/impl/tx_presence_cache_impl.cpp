@@ -5,6 +5,8 @@
 
 #include "ametsuchi/impl/tx_presence_cache_impl.hpp"
 
+#include <algorithm>
+
 #include "common/bind.hpp"
 #include "common/visitor.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
@@ -12,12 +14,23 @@
 
 namespace iroha {
   namespace ametsuchi {
-    TxPresenceCacheImpl::TxPresenceCacheImpl(std::shared_ptr<Storage> storage)
-        : storage_(std::move(storage)) {}
+    constexpr size_t TxPresenceCacheImpl::kShardsCount;
+
+    TxPresenceCacheImpl::TxPresenceCacheImpl(std::shared_ptr<Storage> storage,
+                                             size_t cache_size)
+        : storage_(std::move(storage)) {
+      const auto shard_size =
+          static_cast<uint32_t>(std::max<size_t>(cache_size / kShardsCount, 2));
+      memory_cache_.reserve(kShardsCount);
+      for (size_t i = 0; i < kShardsCount; ++i) {
+        memory_cache_.push_back(
+            std::make_unique<CacheShard>(shard_size, shard_size / 2));
+      }
+    }
 
     boost::optional<TxCacheStatusType> TxPresenceCacheImpl::check(
         const shared_model::crypto::Hash &hash) const {
-      auto res = memory_cache_.findItem(hash);
+      auto res = shard(hash).findItem(hash);
       if (res) {
         return *res;
       }
@@ -27,15 +40,51 @@ namespace iroha {
     boost::optional<TxPresenceCache::BatchStatusCollectionType>
     TxPresenceCacheImpl::check(
         const shared_model::interface::TransactionBatch &batch) const {
-      TxPresenceCache::BatchStatusCollectionType batch_statuses;
-      for (const auto &tx : batch.transactions()) {
-        if (auto status = check(tx->hash())) {
-          batch_statuses.emplace_back(*status);
+      const auto &transactions = batch.transactions();
+      std::vector<shared_model::crypto::Hash> hashes;
+      hashes.reserve(transactions.size());
+      for (const auto &tx : transactions) {
+        hashes.push_back(tx->hash());
+      }
+      return check(hashes);
+    }
+
+    boost::optional<TxPresenceCache::BatchStatusCollectionType>
+    TxPresenceCacheImpl::check(
+        const std::vector<shared_model::crypto::Hash> &hashes) const {
+      TxPresenceCache::BatchStatusCollectionType statuses;
+      statuses.reserve(hashes.size());
+
+      // positions of transactions which statuses are not in memory
+      std::vector<size_t> missed_positions;
+      std::vector<shared_model::crypto::Hash> missed_hashes;
+      for (const auto &hash : hashes) {
+        if (auto status = shard(hash).findItem(hash)) {
+          statuses.push_back(std::move(*status));
         } else {
-          return boost::none;
+          missed_positions.push_back(statuses.size());
+          missed_hashes.push_back(hash);
+          statuses.emplace_back(tx_cache_status_responses::Missing{hash});
         }
       }
-      return batch_statuses;
+      if (missed_hashes.empty()) {
+        return statuses;
+      }
+
+      auto block_query = storage_->getBlockQuery();
+      if (not block_query) {
+        return boost::none;
+      }
+      auto storage_statuses = block_query->checkTxsPresence(missed_hashes);
+      if (not storage_statuses
+          or storage_statuses->size() != missed_hashes.size()) {
+        return boost::none;
+      }
+      for (size_t i = 0; i < missed_hashes.size(); ++i) {
+        remember(missed_hashes[i], (*storage_statuses)[i]);
+        statuses[missed_positions[i]] = std::move((*storage_statuses)[i]);
+      }
+      return statuses;
     }
 
     boost::optional<TxCacheStatusType> TxPresenceCacheImpl::checkInStorage(
@@ -46,16 +95,24 @@ namespace iroha {
       }
       return block_query->checkTxPresence(hash) |
           [this, &hash](const auto &status) {
-            visit_in_place(status,
-                           [](const tx_cache_status_responses::Missing &) {
-                             // don't put this hash into cache since "Missing"
-                             // can become "Committed" or "Rejected" later
-                           },
-                           [this, &hash](const auto &status) {
-                             memory_cache_.addItem(hash, status);
-                           });
+            this->remember(hash, status);
             return status;
           };
     }
+
+    TxPresenceCacheImpl::CacheShard &TxPresenceCacheImpl::shard(
+        const shared_model::crypto::Hash &hash) const {
+      return *memory_cache_[shared_model::crypto::Hash::Hasher{}(hash)
+                            % kShardsCount];
+    }
+
+    void TxPresenceCacheImpl::remember(const shared_model::crypto::Hash &hash,
+                                       const TxCacheStatusType &status) const {
+      visit_in_place(status,
+                     [](const tx_cache_status_responses::Missing &) {},
+                     [this, &hash](const auto &status) {
+                       this->shard(hash).addItem(hash, status);
+                     });
+    }
   }  // namespace ametsuchi
 }  // namespace iroha
@@ -13,9 +13,22 @@
 namespace iroha {
   namespace ametsuchi {
 
+    /**
+     * TxPresenceCache which keeps known statuses in memory. The memory cache
+     * is split into independently locked shards selected by hash, so
+     * concurrent checks of different hashes rarely contend
+     */
     class TxPresenceCacheImpl : public TxPresenceCache {
      public:
-      explicit TxPresenceCacheImpl(std::shared_ptr<Storage> storage);
+      /// number of memory cache shards
+      static constexpr size_t kShardsCount = 16;
+
+      /**
+       * @param storage - storage to query statuses not found in memory
+       * @param cache_size - maximum number of statuses kept in memory
+       */
+      explicit TxPresenceCacheImpl(std::shared_ptr<Storage> storage,
+                                   size_t cache_size = 20000);
 
       boost::optional<TxCacheStatusType> check(
           const shared_model::crypto::Hash &hash) const override;
@@ -24,6 +37,10 @@ namespace iroha {
           const shared_model::interface::TransactionBatch &batch)
           const override;
 
+      boost::optional<BatchStatusCollectionType> check(
+          const std::vector<shared_model::crypto::Hash> &hashes)
+          const override;
+
      private:
       /**
        * Performs an actual storage request about hash status
@@ -34,11 +51,24 @@ namespace iroha {
       boost::optional<TxCacheStatusType> checkInStorage(
           const shared_model::crypto::Hash &hash) const;
 
+      using CacheShard = cache::ClockCache<shared_model::crypto::Hash,
+                                           TxCacheStatusType,
+                                           shared_model::crypto::Hash::Hasher>;
+
+      /**
+       * @return memory cache shard responsible for the hash
+       */
+      CacheShard &shard(const shared_model::crypto::Hash &hash) const;
+
+      /**
+       * Put status to the memory cache unless it is Missing, since "Missing"
+       * can become "Committed" or "Rejected" later
+       */
+      void remember(const shared_model::crypto::Hash &hash,
+                    const TxCacheStatusType &status) const;
+
       std::shared_ptr<Storage> storage_;
-      mutable cache::Cache<shared_model::crypto::Hash,
-                           TxCacheStatusType,
-                           shared_model::crypto::Hash::Hasher>
-          memory_cache_;
+      std::vector<std::unique_ptr<CacheShard>> memory_cache_;
     };
   }  // namespace ametsuchi
 }  // namespace iroha
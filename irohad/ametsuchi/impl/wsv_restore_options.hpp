@@ -0,0 +1,34 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_WSV_RESTORE_OPTIONS_HPP
+#define IROHA_WSV_RESTORE_OPTIONS_HPP
+
+#include <cstddef>
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Parameters of WSV restoration on startup
+     */
+    struct WsvRestoreOptions {
+      /// apply only blocks above the last block recorded in WSV if it matches
+      /// the block store, instead of rebuilding WSV from the genesis block
+      bool incremental = false;
+
+      /// number of threads which load blocks and verify their signatures while
+      /// blocks are applied, zero means the number of hardware threads
+      size_t validation_threads = 0;
+
+      /// rebuild WSV without foreign keys and secondary indices, which are
+      /// restored in parallel once all blocks are applied
+      bool bulk = false;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_WSV_RESTORE_OPTIONS_HPP
@@ -5,12 +5,23 @@
 
 #include "wsv_restorer_impl.hpp"
 
+#include <algorithm>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <boost/format.hpp>
 #include "ametsuchi/block_query.hpp"
 #include "ametsuchi/block_storage.hpp"
 #include "ametsuchi/block_storage_factory.hpp"
 #include "ametsuchi/mutable_storage.hpp"
 #include "ametsuchi/storage.hpp"
+#include "ametsuchi/wsv_query.hpp"
+#include "cryptography/crypto_provider/crypto_verifier.hpp"
 #include "interfaces/iroha_internal/block.hpp"
+#include "logger/logger.hpp"
 
 namespace {
   /**
@@ -60,57 +71,271 @@ namespace {
     }
   };
 
+  using BlockPtr = std::shared_ptr<const shared_model::interface::Block>;
+  using LoadResult = iroha::expected::Result<BlockPtr, std::string>;
+  using shared_model::interface::types::HeightType;
+
+  /**
+   * Loads blocks in height order using several threads, verifying signatures
+   * of every block, so that only application of blocks to WSV is sequential.
+   * Loading is limited to a window of heights ahead of the consumer
+   */
+  class BlockPrefetcher {
+   public:
+    /// number of heights in the window per loading thread
+    static constexpr size_t kWindowPerThread = 16;
+
+    /**
+     * @param block_query - block query used by all threads, block reads do not
+     * use its database session
+     * @param first - first height to load
+     * @param last - last height to load
+     * @param threads - number of loading threads
+     */
+    BlockPrefetcher(iroha::ametsuchi::BlockQuery &block_query,
+                    HeightType first,
+                    HeightType last,
+                    size_t threads)
+        : block_query_(block_query),
+          next_to_load_(first),
+          next_to_take_(first),
+          last_(last),
+          window_(threads * kWindowPerThread),
+          stop_(false) {
+      for (size_t i = 0; i < threads; ++i) {
+        workers_.emplace_back([this] { work(); });
+      }
+    }
+
+    ~BlockPrefetcher() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+      }
+      window_cv_.notify_all();
+      for (auto &worker : workers_) {
+        worker.join();
+      }
+    }
+
+    /**
+     * Wait until the block at the next height is loaded
+     * @return the block or loading error
+     */
+    LoadResult take() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      auto height = next_to_take_++;
+      loaded_cv_.wait(lock, [&] { return loaded_.count(height) != 0; });
+      auto it = loaded_.find(height);
+      auto result = std::move(it->second);
+      loaded_.erase(it);
+      window_cv_.notify_all();
+      return result;
+    }
+
+   private:
+    void work() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (true) {
+        window_cv_.wait(lock, [&] {
+          return stop_ or next_to_load_ > last_
+              or next_to_load_ < next_to_take_ + window_;
+        });
+        if (stop_ or next_to_load_ > last_) {
+          return;
+        }
+        auto height = next_to_load_++;
+        lock.unlock();
+        auto result = load(height);
+        lock.lock();
+        loaded_.emplace(height, std::move(result));
+        loaded_cv_.notify_all();
+      }
+    }
+
+    LoadResult load(HeightType height) {
+      return block_query_.getBlock(height).match(
+          [height](auto &&block) -> LoadResult {
+            BlockPtr loaded = std::move(block).value;
+            for (const auto &signature : loaded->signatures()) {
+              if (not shared_model::crypto::CryptoVerifier<>::verify(
+                      signature.signedData(),
+                      loaded->payload(),
+                      signature.publicKey())) {
+                return iroha::expected::makeError(
+                    (boost::format("Wrong signature of block %d by %s")
+                     % height % signature.publicKey().hex())
+                        .str());
+              }
+            }
+            return iroha::expected::makeValue(std::move(loaded));
+          },
+          [](auto &&err) -> LoadResult {
+            return std::move(err).error.message;
+          });
+    }
+
+    iroha::ametsuchi::BlockQuery &block_query_;
+
+    std::mutex mutex_;
+    std::condition_variable loaded_cv_;
+    std::condition_variable window_cv_;
+    std::map<HeightType, LoadResult> loaded_;
+    HeightType next_to_load_;
+    HeightType next_to_take_;
+    const HeightType last_;
+    const size_t window_;
+    bool stop_;
+
+    std::vector<std::thread> workers_;
+  };
+
+  constexpr size_t BlockPrefetcher::kWindowPerThread;
+
   /**
    * Reapply blocks from existing storage to WSV
    * @param storage - current storage
    * @param mutable_storage - mutable storage without blocks
    * @param block_query - current block storage
+   * @param top_block - block already applied to WSV, none if WSV is empty
+   * @param threads - number of threads loading blocks
    * @return commit status after applying the blocks
    */
   iroha::ametsuchi::CommitResult reindexBlocks(
       iroha::ametsuchi::Storage &storage,
       std::unique_ptr<iroha::ametsuchi::MutableStorage> &mutable_storage,
-      std::shared_ptr<iroha::ametsuchi::BlockQuery> &block_query) {
-    // apply all blocks starting from the genesis
-    auto top_height = block_query->getTopBlockHeight();
-    for (decltype(top_height) i = 1; i <= top_height; ++i) {
-      auto result = block_query->getBlock(i).match(
-          [&mutable_storage](
-              auto &&block) -> iroha::expected::Result<void, std::string> {
-            if (not mutable_storage->apply(std::move(block).value)) {
-              return iroha::expected::makeError("Cannot apply block!");
-            }
-            return iroha::expected::Value<void>();
-          },
-          [](auto &&err) -> iroha::expected::Result<void, std::string> {
-            return std::move(err).error.message;
-          });
+      iroha::ametsuchi::BlockQuery &block_query,
+      const boost::optional<iroha::TopBlockInfo> &top_block,
+      size_t threads) {
+    auto first_height = top_block ? top_block->height + 1 : 1;
+    auto top_height = block_query.getTopBlockHeight();
+    if (first_height <= top_height) {
+      BlockPrefetcher prefetcher(
+          block_query, first_height, top_height, threads);
+      boost::optional<shared_model::interface::types::HashType> prev_hash;
+      if (top_block) {
+        prev_hash = top_block->top_hash;
+      }
+      for (auto i = first_height; i <= top_height; ++i) {
+        auto result = prefetcher.take() |
+            [&](auto &&block) -> iroha::expected::Result<void, std::string> {
+          if (prev_hash and block->prevHash() != *prev_hash) {
+            return iroha::expected::makeError(
+                (boost::format("Block %d does not refer to the previous block")
+                 % i)
+                    .str());
+          }
+          prev_hash = block->hash();
+          if (not mutable_storage->apply(std::move(block))) {
+            return iroha::expected::makeError("Cannot apply block!");
+          }
+          return iroha::expected::Value<void>();
+        };
 
-      if (auto e = iroha::expected::resultToOptionalError(result)) {
-        return std::move(e).value();
+        if (auto e = iroha::expected::resultToOptionalError(result)) {
+          return std::move(e).value();
+        }
       }
     }
 
     return storage.commit(std::move(mutable_storage));
   }
+
+  /**
+   * Find the block WSV can be restored from incrementally
+   * @return top block of WSV if it is present in the block store, none if
+   * WSV has to be rebuilt
+   */
+  boost::optional<iroha::TopBlockInfo> incrementalStart(
+      iroha::ametsuchi::Storage &storage,
+      iroha::ametsuchi::BlockQuery &block_query) {
+    auto wsv_query = storage.getWsvQuery();
+    if (not wsv_query) {
+      return boost::none;
+    }
+    auto top_block = wsv_query->getTopBlockInfo();
+    if (not top_block
+        or top_block->height > block_query.getTopBlockHeight()) {
+      return boost::none;
+    }
+    return block_query.getBlock(top_block->height)
+        .match(
+            [&top_block](const auto &block)
+                -> boost::optional<iroha::TopBlockInfo> {
+              return block.value->hash() == top_block->top_hash
+                  ? top_block
+                  : boost::none;
+            },
+            [](const auto &) -> boost::optional<iroha::TopBlockInfo> {
+              return boost::none;
+            });
+  }
 }  // namespace
 
 namespace iroha {
   namespace ametsuchi {
+    WsvRestorerImpl::WsvRestorerImpl(const WsvRestoreOptions &options,
+                                     logger::LoggerPtr log)
+        : incremental_(options.incremental),
+          bulk_(options.bulk),
+          validation_threads_(
+              options.validation_threads != 0
+                  ? options.validation_threads
+                  : std::max(1u, std::thread::hardware_concurrency())),
+          log_(std::move(log)) {}
+
     CommitResult WsvRestorerImpl::restoreWsv(Storage &storage) {
+      auto result = applyBlocks(storage);
+      auto restored = storage.restoreConstraints(validation_threads_);
+      if (auto e = expected::resultToOptionalError(restored)) {
+        if (expected::hasValue(result)) {
+          return expected::makeError(std::move(e).value());
+        }
+      }
+      return result;
+    }
+
+    CommitResult WsvRestorerImpl::applyBlocks(Storage &storage) {
       BlockStorageStubFactory storage_factory;
 
       return storage.createMutableStorage(storage_factory) |
-                 [&storage](auto &&mutable_storage) -> CommitResult {
+                 [this, &storage](auto &&mutable_storage) -> CommitResult {
         auto block_query = storage.getBlockQuery();
         if (not block_query) {
           return expected::makeError("Cannot create BlockQuery");
         }
 
-        return storage.resetWsv() |
-            [&storage, &mutable_storage, &block_query]() {
-              return reindexBlocks(storage, mutable_storage, block_query);
-            };
+        // ledger loaded from a WSV snapshot has no blocks below the snapshot
+        // height and can only be restored incrementally
+        auto incremental = incremental_
+            or (block_query->getTopBlockHeight() != 0
+                and not expected::hasValue(block_query->getBlock(1)));
+        if (incremental) {
+          if (auto top_block = incrementalStart(storage, *block_query)) {
+            log_->info("Restoring WSV from height {}", top_block->height);
+            return reindexBlocks(storage,
+                                 mutable_storage,
+                                 *block_query,
+                                 top_block,
+                                 validation_threads_);
+          }
+          log_->info("WSV does not match the block store, rebuilding it");
+        }
+
+        auto rebuild = [&, this]() {
+          return reindexBlocks(storage,
+                               mutable_storage,
+                               *block_query,
+                               boost::none,
+                               validation_threads_);
+        };
+        if (bulk_) {
+          log_->info("Rebuilding WSV without constraints");
+          return storage.resetWsv() | [&]() {
+            return storage.dropConstraints() | rebuild;
+          };
+        }
+        return storage.resetWsv() | rebuild;
       };
     }
   }  // namespace ametsuchi
@@ -8,7 +8,10 @@
 
 #include "ametsuchi/ledger_state.hpp"
 #include "ametsuchi/wsv_restorer.hpp"
+
+#include "ametsuchi/impl/wsv_restore_options.hpp"
 #include "common/result.hpp"
+#include "logger/logger_fwd.hpp"
 
 namespace iroha {
   namespace ametsuchi {
@@ -19,15 +22,37 @@ namespace iroha {
      */
     class WsvRestorerImpl : public WsvRestorer {
      public:
+      /**
+       * @param options - restoration parameters
+       * @param log - logger
+       */
+      WsvRestorerImpl(const WsvRestoreOptions &options, logger::LoggerPtr log);
+
       virtual ~WsvRestorerImpl() = default;
       /**
        * Recover WSV (World State View).
-       * Drop storage and apply blocks one by one.
+       * Drop storage and apply blocks one by one. In incremental mode WSV is
+       * kept and only blocks above its top block are applied, if that block
+       * is present in the block store, which is also done for ledgers loaded
+       * from a WSV snapshot. Blocks are loaded and their signatures
+       * and hash links are verified in parallel with application. In bulk
+       * mode constraints of the storage are dropped while WSV is rebuilt.
+       * Dropped constraints are restored after every restoration, so that
+       * an interrupted bulk restoration is completed on the next start.
        * @param storage of blocks in ledger
        * @return ledger state after restoration on success, otherwise error
        * string
        */
       CommitResult restoreWsv(Storage &storage) override;
+
+     private:
+      /// apply blocks to WSV according to the mode of restoration
+      CommitResult applyBlocks(Storage &storage);
+
+      const bool incremental_;
+      const bool bulk_;
+      const size_t validation_threads_;
+      logger::LoggerPtr log_;
     };
 
   }  // namespace ametsuchi
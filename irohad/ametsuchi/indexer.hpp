@@ -54,6 +54,11 @@ namespace iroha {
           const shared_model::interface::types::AssetIdType &asset_id,
           TxPosition position) = 0;
 
+      /// Store the block as the last one applied to WSV.
+      virtual void topBlock(
+          shared_model::interface::types::HeightType height,
+          const shared_model::interface::types::HashType &hash) = 0;
+
       /**
        * Flush the indices to storage.
        * Makes the effects of new indices (that were created before this call)
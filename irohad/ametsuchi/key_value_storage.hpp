@@ -6,10 +6,12 @@
 #ifndef IROHA_KV_STORAGE_HPP
 #define IROHA_KV_STORAGE_HPP
 
-#include <boost/optional.hpp>
+#include <memory>
 #include <string>
 #include <vector>
 
+#include <boost/optional.hpp>
+
 namespace iroha {
 
   namespace ametsuchi {
@@ -25,6 +27,47 @@ namespace iroha {
       using Identifier = uint32_t;
       using Bytes = std::vector<uint8_t>;
 
+      /**
+       * Read-only view of stored data. The view shares ownership of the
+       * memory it points to, e.g. a memory-mapped file region, so the data
+       * can be parsed in place without being copied into Bytes.
+       */
+      class BytesView {
+       public:
+        BytesView(const uint8_t *data,
+                  size_t size,
+                  std::shared_ptr<const void> holder)
+            : data_(data), size_(size), holder_(std::move(holder)) {}
+
+        explicit BytesView(Bytes bytes) {
+          auto owned = std::make_shared<const Bytes>(std::move(bytes));
+          data_ = owned->data();
+          size_ = owned->size();
+          holder_ = std::move(owned);
+        }
+
+        const uint8_t *data() const {
+          return data_;
+        }
+
+        const char *charData() const {
+          return reinterpret_cast<const char *>(data_);
+        }
+
+        size_t size() const {
+          return size_;
+        }
+
+        bool empty() const {
+          return size_ == 0;
+        }
+
+       private:
+        const uint8_t *data_;
+        size_t size_;
+        std::shared_ptr<const void> holder_;
+      };
+
       /**
        * Add entity with binary data
        * @param id - reference key
@@ -39,6 +82,20 @@ namespace iroha {
        */
       virtual boost::optional<Bytes> get(Identifier id) const = 0;
 
+      /**
+       * Get view of data associated with the key. Implementations may avoid
+       * copying the data, the default one falls back to get()
+       * @param id - reference key
+       * @return - view of blob, if exists
+       */
+      virtual boost::optional<BytesView> getView(Identifier id) const {
+        auto bytes = get(id);
+        if (not bytes) {
+          return boost::none;
+        }
+        return BytesView(std::move(*bytes));
+      }
+
       /**
        * @return folder of storage
        */
@@ -51,6 +108,28 @@ namespace iroha {
 
       virtual void dropAll() = 0;
 
+      /**
+       * Make added entries durable, so that they survive a crash of the
+       * host. The default implementation keeps nothing on disk and does
+       * nothing
+       * @param from - lowest id of the added entries to sync
+       * @param to - highest id of the added entries to sync
+       * @return true if the entries are on disk
+       */
+      virtual bool sync(Identifier from, Identifier to) {
+        return true;
+      }
+
+      /**
+       * Remove entries which are kept elsewhere, e.g. in an archive.
+       * Implementations may keep some of them, the default one keeps all
+       * @param id - last entry which may be removed
+       * @return false if an entry could not be removed
+       */
+      virtual bool removeUpTo(Identifier id) {
+        return true;
+      }
+
       virtual ~KeyValueStorage() = default;
     };
   }  // namespace ametsuchi
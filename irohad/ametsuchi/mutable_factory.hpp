@@ -43,7 +43,17 @@ namespace iroha {
       virtual CommitResult commit(
           std::unique_ptr<MutableStorage> mutableStorage) = 0;
 
-      /// Check if prepared commits are enabled.
+      /**
+       * Commit the blocks applied by mutable storage so far, and keep it to
+       * apply the next blocks in a new transaction. Mutable storage must not
+       * be used if the commit fails
+       * @param mutableStorage
+       * @return the status of commit
+       */
+      virtual CommitResult commitIntermediate(
+          MutableStorage &mutableStorage) = 0;
+
+      /// Check if there is a prepared state to be committed.
       virtual bool preparedCommitEnabled() const = 0;
 
       /**
@@ -14,6 +14,7 @@
 #include "ametsuchi/peer_query_factory.hpp"
 #include "ametsuchi/query_executor_factory.hpp"
 #include "ametsuchi/temporary_factory.hpp"
+#include "ametsuchi/wsv_snapshot_factory.hpp"
 #include "common/result.hpp"
 
 namespace shared_model {
@@ -38,7 +39,8 @@ namespace iroha {
                     public MutableFactory,
                     public PeerQueryFactory,
                     public BlockQueryFactory,
-                    public QueryExecutorFactory {
+                    public QueryExecutorFactory,
+                    public WsvSnapshotFactory {
      public:
       virtual std::shared_ptr<WsvQuery> getWsvQuery() const = 0;
 
@@ -88,6 +90,24 @@ namespace iroha {
        */
       virtual expected::Result<void, std::string> resetWsv() = 0;
 
+      /**
+       * Drop foreign keys and secondary indices of the tables, so that blocks
+       * are applied without checking and indexing every row. The storage
+       * does not enforce consistency until restoreConstraints is called
+       * @return error message if dropping has failed
+       */
+      virtual expected::Result<void, std::string> dropConstraints() = 0;
+
+      /**
+       * Build the indices dropped by dropConstraints and add the foreign keys
+       * back, validating the stored rows. Does nothing if none is dropped
+       * @param threads - number of indices built in parallel
+       * @return error message if the rows are inconsistent or building has
+       * failed
+       */
+      virtual expected::Result<void, std::string> restoreConstraints(
+          size_t threads) = 0;
+
       /**
        * Removes all peers from WSV
        */
@@ -28,7 +28,9 @@ namespace iroha {
 
       /**
        * Prepare state which was accumulated in temporary WSV.
-       * After preparation, this state is not visible until commited.
+       * After preparation, this state is not visible until commited. It is
+       * kept as a prepared transaction if they are enabled, or as the open
+       * transaction of the temporary WSV otherwise.
        *
        * @param wsv - state which will be prepared.
        */
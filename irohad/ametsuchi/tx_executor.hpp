@@ -33,6 +33,12 @@ namespace iroha {
           const shared_model::interface::Transaction &transaction,
           bool do_validation) const;
 
+      /**
+       * Execute the commands of transactions deferred by the command executor
+       * @return error of the first failed command
+       */
+      CommandResult flush() const;
+
      private:
       std::shared_ptr<CommandExecutor> command_executor_;
     };
@@ -9,6 +9,7 @@
 #include <vector>
 
 #include <boost/optional.hpp>
+#include "ametsuchi/ledger_state.hpp"
 #include "interfaces/common_objects/peer.hpp"
 
 namespace iroha {
@@ -37,6 +38,12 @@ namespace iroha {
       virtual boost::optional<
           std::vector<std::shared_ptr<shared_model::interface::Peer>>>
       getPeers() = 0;
+
+      /**
+       * Get height and hash of the last block applied to WSV
+       * @return top block info, none if WSV is empty or query failed
+       */
+      virtual boost::optional<TopBlockInfo> getTopBlockInfo() = 0;
     };
 
   }  // namespace ametsuchi
@@ -0,0 +1,90 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_WSV_SNAPSHOT_HPP
+#define IROHA_WSV_SNAPSHOT_HPP
+
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "ametsuchi/commit_result.hpp"
+#include "common/result.hpp"
+#include "cryptography/hash.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+  namespace ametsuchi {
+
+    /**
+     * Part of WSV snapshot: a number of rows of a single table. Chunks are
+     * chained, so that every chunk carries a hash of its contents and of all
+     * previous chunks of the snapshot
+     */
+    struct WsvSnapshotChunk {
+      /// name of the table the rows belong to
+      std::string table;
+      /// JSON array of rows
+      std::string rows;
+      /// hash of the previous chunk hash, table and rows
+      shared_model::crypto::Hash hash;
+    };
+
+    /**
+     * Streams WSV tables at a consistent height
+     */
+    class WsvSnapshotExporter {
+     public:
+      /// receives chunks in snapshot order, returns false to abort export
+      using ChunkHandler = std::function<bool(const WsvSnapshotChunk &)>;
+
+      virtual ~WsvSnapshotExporter() = default;
+
+      /**
+       * Export snapshot of WSV
+       * @param handler - receiver of the snapshot chunks
+       * @return the top block of WSV the snapshot corresponds to, or error
+       */
+      virtual expected::
+          Result<std::shared_ptr<const shared_model::interface::Block>,
+                 std::string>
+          exportSnapshot(const ChunkHandler &handler) = 0;
+    };
+
+    /**
+     * Replaces WSV with a snapshot received chunk by chunk. WSV is not
+     * changed until the snapshot is committed
+     */
+    class WsvSnapshotImporter {
+     public:
+      virtual ~WsvSnapshotImporter() = default;
+
+      /**
+       * Verify the chunk hash and insert its rows
+       * @param chunk - next chunk of the snapshot
+       * @return error if the chunk is corrupted or cannot be inserted
+       */
+      virtual expected::Result<void, std::string> apply(
+          const WsvSnapshotChunk &chunk) = 0;
+
+      /**
+       * Commit the snapshot and store its top block to the block store
+       * @param top_block - the block WSV snapshot corresponds to, must match
+       * top block info of the snapshot
+       * @return ledger state after the import or error
+       */
+      virtual CommitResult commit(
+          std::shared_ptr<const shared_model::interface::Block> top_block) = 0;
+    };
+
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_WSV_SNAPSHOT_HPP
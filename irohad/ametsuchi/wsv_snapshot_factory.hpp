@@ -0,0 +1,36 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_WSV_SNAPSHOT_FACTORY_HPP
+#define IROHA_WSV_SNAPSHOT_FACTORY_HPP
+
+#include "ametsuchi/wsv_snapshot.hpp"
+
+#include <boost/optional.hpp>
+
+namespace iroha {
+  namespace ametsuchi {
+    class WsvSnapshotFactory {
+     public:
+      /**
+       * Creates an exporter of the current WSV
+       * @return Created exporter
+       */
+      virtual boost::optional<std::unique_ptr<WsvSnapshotExporter>>
+      createWsvSnapshotExporter() const = 0;
+
+      /**
+       * Creates an importer which replaces WSV and the block store contents
+       * @return Created importer
+       */
+      virtual boost::optional<std::unique_ptr<WsvSnapshotImporter>>
+      createWsvSnapshotImporter() = 0;
+
+      virtual ~WsvSnapshotFactory() = default;
+    };
+  }  // namespace ametsuchi
+}  // namespace iroha
+
+#endif  // IROHA_WSV_SNAPSHOT_FACTORY_HPP
@@ -27,6 +27,9 @@ namespace iroha {
        */
       class ClusterOrdering {
        public:
+        using PeerList =
+            std::vector<std::shared_ptr<shared_model::interface::Peer>>;
+
         /**
          * Creates cluster ordering from the vector of peers
          * @param order vector of peers
@@ -36,6 +39,15 @@ namespace iroha {
             const std::vector<std::shared_ptr<shared_model::interface::Peer>>
                 &order);
 
+        /**
+         * Creates cluster ordering sharing the vector of peers, so that
+         * copies of the ordering do not copy the vector
+         * @param order vector of peers
+         * @return false if vector is empty, true otherwise
+         */
+        static boost::optional<ClusterOrdering> create(
+            std::shared_ptr<const PeerList> order);
+
         /**
          * Provide current leader peer
          */
@@ -63,10 +75,9 @@ namespace iroha {
 
        private:
         // prohibit creation of the object not from create method
-        explicit ClusterOrdering(
-            std::vector<std::shared_ptr<shared_model::interface::Peer>> order);
+        explicit ClusterOrdering(std::shared_ptr<const PeerList> order);
 
-        std::vector<std::shared_ptr<shared_model::interface::Peer>> order_;
+        std::shared_ptr<const PeerList> order_;
         PeersNumberType index_ = 0;
       };
     }  // namespace yac
@@ -12,26 +12,30 @@ namespace iroha {
       boost::optional<ClusterOrdering> ClusterOrdering::create(
           const std::vector<std::shared_ptr<shared_model::interface::Peer>>
               &order) {
-        if (order.empty()) {
+        return create(std::make_shared<const PeerList>(order));
+      }
+
+      boost::optional<ClusterOrdering> ClusterOrdering::create(
+          std::shared_ptr<const PeerList> order) {
+        if (order->empty()) {
           return boost::none;
         }
-        return ClusterOrdering(order);
+        return ClusterOrdering(std::move(order));
       }
 
-      ClusterOrdering::ClusterOrdering(
-          std::vector<std::shared_ptr<shared_model::interface::Peer>> order)
+      ClusterOrdering::ClusterOrdering(std::shared_ptr<const PeerList> order)
           : order_(std::move(order)) {}
 
       // TODO :  24/03/2018 x3medima17: make it const, IR-1164
       const shared_model::interface::Peer &ClusterOrdering::currentLeader() {
-        if (index_ >= order_.size()) {
+        if (index_ >= order_->size()) {
           index_ = 0;
         }
-        return *order_.at(index_);
+        return *order_->at(index_);
       }
 
       bool ClusterOrdering::hasNext() const {
-        return index_ != order_.size();
+        return index_ != order_->size();
       }
 
       ClusterOrdering &ClusterOrdering::switchToNext() {
@@ -41,11 +45,11 @@ namespace iroha {
 
       const std::vector<std::shared_ptr<shared_model::interface::Peer>>
           &ClusterOrdering::getPeers() const {
-        return order_;
+        return *order_;
       }
 
       size_t ClusterOrdering::getNumberOfPeers() const {
-        return order_.size();
+        return order_->size();
       }
 
     }  // namespace yac
@@ -5,6 +5,7 @@
 
 #include "consensus/yac/impl/peer_orderer_impl.hpp"
 
+#include <numeric>
 #include <random>
 
 #include "common/bind.hpp"
@@ -21,12 +22,32 @@ namespace iroha {
 
       boost::optional<ClusterOrdering> PeerOrdererImpl::getOrdering(
           const YacHash &hash,
-          std::vector<std::shared_ptr<shared_model::interface::Peer>> peers) {
+          const std::vector<std::shared_ptr<shared_model::interface::Peer>>
+              &peers) {
+        if (peers.empty()) {
+          return boost::none;
+        }
+
+        // peers change rarely, rounds only shuffle their indices
+        if (peers != peers_) {
+          peers_ = peers;
+          permutation_.resize(peers_.size());
+        }
+        std::iota(permutation_.begin(), permutation_.end(), 0);
+
+        // the swaps of shuffle do not depend on the type of elements, so the
+        // order is the same as of shuffling the peers themselves
         std::seed_seq seed(hash.vote_hashes.block_hash.begin(),
                            hash.vote_hashes.block_hash.end());
         std::default_random_engine gen(seed);
-        std::shuffle(peers.begin(), peers.end(), gen);
-        return ClusterOrdering::create(peers);
+        std::shuffle(permutation_.begin(), permutation_.end(), gen);
+
+        auto order = std::make_shared<ClusterOrdering::PeerList>();
+        order->reserve(permutation_.size());
+        for (auto index : permutation_) {
+          order->push_back(peers_[index]);
+        }
+        return ClusterOrdering::create(std::move(order));
       }
     }  // namespace yac
   }    // namespace consensus
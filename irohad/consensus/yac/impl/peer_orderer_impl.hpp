@@ -7,6 +7,7 @@
 #define IROHA_PEER_ORDERER_IMPL_HPP
 
 #include <memory>
+#include <vector>
 
 #include "ametsuchi/peer_query_factory.hpp"
 #include "consensus/yac/yac_peer_orderer.hpp"
@@ -27,11 +28,18 @@ namespace iroha {
 
         boost::optional<ClusterOrdering> getOrdering(
             const YacHash &hash,
-            std::vector<std::shared_ptr<shared_model::interface::Peer>> peers)
+            const std::vector<std::shared_ptr<shared_model::interface::Peer>>
+                &peers)
             override;
 
        private:
         std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory_;
+
+        /// peers of the last ordering, the permutation is applied to them;
+        /// orderings are requested by the gate one at a time
+        std::vector<std::shared_ptr<shared_model::interface::Peer>> peers_;
+        /// indices of peers_ shuffled by the hash of the round
+        std::vector<PeersNumberType> permutation_;
       };
 
     }  // namespace yac
@@ -4,41 +4,52 @@
  */
 
 #include "consensus/yac/impl/timer_impl.hpp"
-#include <iostream>
 
 namespace iroha {
   namespace consensus {
     namespace yac {
       TimerImpl::TimerImpl(std::chrono::milliseconds delay_milliseconds,
-                           rxcpp::observe_on_one_worker coordination)
+                           std::shared_ptr<TimerWheel> wheel)
           : delay_milliseconds_(delay_milliseconds),
-            // use the same worker for all the invocations
-            coordination_(coordination.create_coordinator(coordinator_lifetime_)
-                              .get_scheduler()) {}
+            wheel_(std::move(wheel)) {}
 
       void TimerImpl::invokeAfterDelay(std::function<void()> handler) {
         deny();
-        auto timer_lifetime =
-            rxcpp::observable<>::timer(delay_milliseconds_, coordination_)
-                .subscribe([handler{std::move(handler)}](auto) { handler(); });
+        std::chrono::milliseconds delay;
         {
-          std::lock_guard<std::mutex> lock(timer_lifetime_mutex);
-          timer_lifetime_ = timer_lifetime;
+          std::lock_guard<std::mutex> lock(task_mutex_);
+          delay = delay_milliseconds_;
         }
+        auto task = wheel_->schedule(delay, std::move(handler));
+        {
+          std::lock_guard<std::mutex> lock(task_mutex_);
+          task_ = task;
+        }
+      }
+
+      void TimerImpl::setDelay(std::chrono::milliseconds delay_milliseconds) {
+        std::lock_guard<std::mutex> lock(task_mutex_);
+        delay_milliseconds_ = delay_milliseconds;
       }
 
       void TimerImpl::deny() {
-        rxcpp::composite_subscription timer_lifetime;
+        TimerWheel::TaskId task;
         {
-          std::lock_guard<std::mutex> lock(timer_lifetime_mutex);
-          timer_lifetime = timer_lifetime_;
+          std::lock_guard<std::mutex> lock(task_mutex_);
+          task = task_;
         }
-        timer_lifetime.unsubscribe();
+        wheel_->cancel(task);
       }
 
       TimerImpl::~TimerImpl() {
-        deny();
-        coordinator_lifetime_.unsubscribe();
+        TimerWheel::TaskId task;
+        {
+          std::lock_guard<std::mutex> lock(task_mutex_);
+          task = task_;
+        }
+        wheel_->cancel(task);
+        // the handler may refer to the owner of the timer
+        wheel_->wait(task);
       }
     }  // namespace yac
   }    // namespace consensus
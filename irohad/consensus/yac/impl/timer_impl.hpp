@@ -6,9 +6,11 @@
 #ifndef IROHA_TIMER_IMPL_HPP
 #define IROHA_TIMER_IMPL_HPP
 
+#include <chrono>
+#include <memory>
 #include <mutex>
 
-#include <rxcpp/rx.hpp>
+#include "common/timer_wheel.hpp"
 #include "consensus/yac/timer.hpp"
 
 namespace iroha {
@@ -19,24 +21,27 @@ namespace iroha {
         /**
          * Constructor
          * @param delay_milliseconds delay before the next method invoke
-         * @param coordination factory for coordinators to run the timer on
+         * @param wheel timer wheel to run the handlers on
          */
         TimerImpl(std::chrono::milliseconds delay_milliseconds,
-                  rxcpp::observe_on_one_worker coordination);
+                  std::shared_ptr<TimerWheel> wheel);
         TimerImpl(const TimerImpl &) = delete;
         TimerImpl &operator=(const TimerImpl &) = delete;
 
         void invokeAfterDelay(std::function<void()> handler) override;
         void deny() override;
 
+        /// Change the delay of the handlers scheduled afterwards
+        void setDelay(std::chrono::milliseconds delay_milliseconds);
+
         ~TimerImpl() override;
 
        private:
-        std::mutex timer_lifetime_mutex;
+        std::mutex task_mutex_;
         std::chrono::milliseconds delay_milliseconds_;
-        rxcpp::composite_subscription coordinator_lifetime_;
-        rxcpp::observe_on_one_worker coordination_;
-        rxcpp::composite_subscription timer_lifetime_;
+        std::shared_ptr<TimerWheel> wheel_;
+        /// the last scheduled handler
+        TimerWheel::TaskId task_{0};
       };
     }  // namespace yac
   }    // namespace consensus
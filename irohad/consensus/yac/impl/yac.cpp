@@ -52,7 +52,10 @@ namespace iroha {
           ClusterOrdering order,
           Round round,
           rxcpp::observe_on_one_worker worker,
-          logger::LoggerPtr log) {
+          logger::LoggerPtr log,
+          size_t commit_fanout,
+          boost::optional<shared_model::interface::types::PubkeyType>
+              own_key) {
         return std::make_shared<Yac>(vote_storage,
                                      network,
                                      crypto,
@@ -60,7 +63,9 @@ namespace iroha {
                                      order,
                                      round,
                                      worker,
-                                     std::move(log));
+                                     std::move(log),
+                                     commit_fanout,
+                                     std::move(own_key));
       }
 
       Yac::Yac(YacVoteStorage vote_storage,
@@ -70,7 +75,10 @@ namespace iroha {
                ClusterOrdering order,
                Round round,
                rxcpp::observe_on_one_worker worker,
-               logger::LoggerPtr log)
+               logger::LoggerPtr log,
+               size_t commit_fanout,
+               boost::optional<shared_model::interface::types::PubkeyType>
+                   own_key)
           : log_(std::move(log)),
             cluster_order_(order),
             round_(round),
@@ -79,7 +87,16 @@ namespace iroha {
             vote_storage_(std::move(vote_storage)),
             network_(std::move(network)),
             crypto_(std::move(crypto)),
-            timer_(std::move(timer)) {}
+            timer_(std::move(timer)),
+            commit_fanout_(commit_fanout),
+            own_key_(std::move(own_key)),
+            round_time_metric_(metrics::registry().histogram(
+                "iroha_yac_round_microseconds",
+                "Time from the own vote to the outcome of the round")),
+            outcomes_metric_(metrics::registry().counter(
+                "iroha_yac_outcomes_total",
+                "Consensus outcomes passed to the pipeline")),
+            memory_account_(metrics::registry(), "consensus") {}
 
       Yac::~Yac() {
         notifier_lifetime_.unsubscribe();
@@ -88,13 +105,17 @@ namespace iroha {
       // ------|Hash gate|------
 
       void Yac::vote(YacHash hash, ClusterOrdering order) {
-        log_->info("Order for voting: {}",
-                   logger::to_string(order.getPeers(),
-                                     [](auto val) { return val->address(); }));
-
-        std::unique_lock<std::mutex> lock(mutex_);
+        metrics::MemoryScope memory_scope(memory_account_);
+        log_->info("Order for voting: {}", logger::lazy([&order] {
+                     return logger::to_string(
+                         order.getPeers(),
+                         [](auto val) { return val->address(); });
+                   }));
+
+        std::unique_lock<Mutex> lock(mutex_);
         cluster_order_ = order;
         round_ = hash.vote_round;
+        round_start_ = std::chrono::steady_clock::now();
         lock.unlock();
         auto vote = crypto_->getVote(hash);
         // TODO 10.06.2018 andrei: IR-1407 move YAC propagation strategy to a
@@ -137,7 +158,8 @@ namespace iroha {
       }
 
       void Yac::onState(std::vector<VoteMessage> state) {
-        std::unique_lock<std::mutex> guard(mutex_);
+        metrics::MemoryScope memory_scope(memory_account_);
+        std::unique_lock<Mutex> guard(mutex_);
 
         removeUnknownPeersVotes(state);
         if (state.empty()) {
@@ -145,17 +167,29 @@ namespace iroha {
           return;
         }
 
-        if (crypto_->verify(state)) {
-          applyState(state, guard);
-        } else {
+        // signatures are verified without the lock, so that voting and
+        // processing of other states are not stalled by large commits
+        guard.unlock();
+        if (not crypto_->verify(state)) {
           log_->warn("{}", cryptoError(state));
+          return;
+        }
+        guard.lock();
+
+        // peers list may have changed during verification
+        removeUnknownPeersVotes(state);
+        if (state.empty()) {
+          log_->debug("No votes left in the message.");
+          return;
         }
+
+        applyState(state, guard);
       }
 
       // ------|Private interface|------
 
       void Yac::votingStep(VoteMessage vote) {
-        std::unique_lock<std::mutex> lock(mutex_);
+        std::unique_lock<Mutex> lock(mutex_);
 
         auto committed = vote_storage_.isCommitted(vote.hash.vote_round);
         if (committed) {
@@ -197,7 +231,7 @@ namespace iroha {
       // ------|Apply data|------
 
       void Yac::applyState(const std::vector<VoteMessage> &state,
-                           std::unique_lock<std::mutex> &lock) {
+                           std::unique_lock<Mutex> &lock) {
         assert(lock.owns_lock());
         auto answer =
             vote_storage_.store(state, cluster_order_.getNumberOfPeers());
@@ -217,23 +251,31 @@ namespace iroha {
                * not accept our message with valid supermajority because he
                * cannot apply votes from unknown peers.
                */
+              auto votes = [](const auto &state) { return state.votes; };
+
               if (state.size() > 1) {
                 // some peer has already collected commit/reject, so it is sent
                 if (vote_storage_.getProcessingState(proposal_round)
                     == ProposalState::kNotSentNotProcessed) {
                   vote_storage_.nextProcessingState(proposal_round);
-                  log_->info(
-                      "Received supermajority of votes for {}, skip "
-                      "propagation",
-                      proposal_round);
+                  if (commit_fanout_ != 0) {
+                    log_->info(
+                        "Received supermajority of votes for {}, forward it "
+                        "to children",
+                        proposal_round);
+                    this->forwardState(visit_in_place(answer, votes));
+                  } else {
+                    log_->info(
+                        "Received supermajority of votes for {}, skip "
+                        "propagation",
+                        proposal_round);
+                  }
                 }
               }
 
               auto processing_state =
                   vote_storage_.getProcessingState(proposal_round);
 
-              auto votes = [](const auto &state) { return state.votes; };
-
               auto current_round = round_;
               switch (processing_state) {
                 case ProposalState::kNotSentNotProcessed:
@@ -245,7 +287,14 @@ namespace iroha {
                 case ProposalState::kSentNotProcessed:
                   vote_storage_.nextProcessingState(proposal_round);
                   log_->info("Pass outcome for {} to pipeline", proposal_round);
+                  if (proposal_round == current_round) {
+                    round_time_metric_.record(
+                        std::chrono::duration_cast<std::chrono::microseconds>(
+                            std::chrono::steady_clock::now() - round_start_)
+                            .count());
+                  }
                   lock.unlock();
+                  outcomes_metric_.increment();
                   if (proposal_round >= current_round) {
                     this->closeRound();
                   }
@@ -290,9 +339,57 @@ namespace iroha {
       // ------|Propagation|------
 
       void Yac::propagateState(const std::vector<VoteMessage> &msg) {
-        for (const auto &peer : cluster_order_.getPeers()) {
-          propagateStateDirectly(*peer, msg);
+        const auto &peers = cluster_order_.getPeers();
+        auto position = commit_fanout_ != 0 ? ownPosition() : boost::none;
+        if (not position) {
+          for (const auto &peer : peers) {
+            propagateStateDirectly(*peer, msg);
+          }
+          return;
+        }
+
+        /*
+         * Peers form a tree where the children of the peer at position i in
+         * the cluster order are at positions i * fanout + 1 ... i * fanout +
+         * fanout. The outcome is passed to the root, which forwards it down
+         * the tree, and to this peer itself to apply it. Peers missed because
+         * of a failure in their branch get the outcome by back propagation
+         * when they vote.
+         */
+        propagateStateDirectly(*peers.at(*position), msg);
+        if (*position == 0) {
+          forwardState(msg);
+        } else {
+          propagateStateDirectly(*peers.front(), msg);
+        }
+      }
+
+      void Yac::forwardState(const std::vector<VoteMessage> &msg) {
+        ownPosition() | [&](auto position) {
+          const auto &peers = cluster_order_.getPeers();
+          for (size_t i = 1; i <= commit_fanout_; ++i) {
+            auto child = position * commit_fanout_ + i;
+            if (child >= peers.size()) {
+              break;
+            }
+            this->propagateStateDirectly(*peers.at(child), msg);
+          }
+        };
+      }
+
+      boost::optional<size_t> Yac::ownPosition() const {
+        if (not own_key_) {
+          return boost::none;
+        }
+        const auto &peers = cluster_order_.getPeers();
+        auto it =
+            std::find_if(peers.begin(), peers.end(), [this](const auto &peer) {
+              return peer->pubkey() == *own_key_;
+            });
+        if (it == peers.end()) {
+          return boost::none;
         }
+        return static_cast<size_t>(it - peers.begin());
       }
 
       void Yac::propagateStateDirectly(const shared_model::interface::Peer &to,
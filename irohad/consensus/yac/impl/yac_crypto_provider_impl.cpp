@@ -5,30 +5,59 @@
 
 #include "consensus/yac/impl/yac_crypto_provider_impl.hpp"
 
+#include <atomic>
+
 #include "backend/plain/signature.hpp"
+#include "common/thread_pool.hpp"
 #include "consensus/yac/transport/yac_pb_converters.hpp"
-#include "cryptography/crypto_provider/crypto_signer.hpp"
 #include "cryptography/crypto_provider/crypto_verifier.hpp"
 
 namespace iroha {
   namespace consensus {
     namespace yac {
       CryptoProviderImpl::CryptoProviderImpl(
-          const shared_model::crypto::Keypair &keypair)
-          : keypair_(keypair) {}
+          const shared_model::crypto::Keypair &keypair,
+          std::shared_ptr<ThreadPool> verification_pool)
+          : signer_(keypair),
+            verification_pool_(std::move(verification_pool)) {}
 
       bool CryptoProviderImpl::verify(const std::vector<VoteMessage> &msg) {
-        return std::all_of(
-            std::begin(msg), std::end(msg), [](const auto &vote) {
-              auto serialized =
-                  PbConverters::serializeVote(vote).hash().SerializeAsString();
-              auto blob = shared_model::crypto::Blob(serialized);
-
-              return shared_model::crypto::CryptoVerifier<>::verify(
-                  vote.signature->signedData(),
-                  blob,
-                  vote.signature->publicKey());
-            });
+        auto blob = [](const VoteMessage &vote) {
+          return shared_model::crypto::Blob(
+              PbConverters::serializeVote(vote).hash().SerializeAsString());
+        };
+
+        // votes of a commit are signed by different peers over payloads with
+        // their own block signatures, so they are independent
+        if (verification_pool_ and msg.size() > 1) {
+          std::atomic<bool> valid{true};
+          verification_pool_->parallelFor(msg.size(), [&](size_t i) {
+            if (not valid.load(std::memory_order_relaxed)) {
+              return;
+            }
+            const auto &vote = msg[i];
+            if (not shared_model::crypto::CryptoVerifier<>::verify(
+                    vote.signature->signedData(),
+                    blob(vote),
+                    vote.signature->publicKey())) {
+              valid.store(false, std::memory_order_relaxed);
+            }
+          });
+          return valid.load();
+        }
+
+        // blobs must stay in place while entries refer to them
+        std::vector<shared_model::crypto::Blob> blobs;
+        blobs.reserve(msg.size());
+        std::vector<shared_model::crypto::VerificationEntry> entries;
+        entries.reserve(msg.size());
+        for (const auto &vote : msg) {
+          blobs.push_back(blob(vote));
+          entries.push_back({vote.signature->signedData(),
+                             blobs.back(),
+                             vote.signature->publicKey()});
+        }
+        return shared_model::crypto::CryptoVerifier<>::verifyBatch(entries);
       }
 
       VoteMessage CryptoProviderImpl::getVote(YacHash hash) {
@@ -36,16 +65,12 @@ namespace iroha {
         vote.hash = hash;
         auto serialized =
             PbConverters::serializeVotePayload(vote).hash().SerializeAsString();
-        auto blob = shared_model::crypto::Blob(serialized);
-        const auto &pubkey = keypair_.publicKey();
-        const auto &privkey = keypair_.privateKey();
-        auto signature = shared_model::crypto::CryptoSigner<>::sign(
-            blob, shared_model::crypto::Keypair(pubkey, privkey));
+        auto signature = signer_.sign(shared_model::crypto::Blob(serialized));
 
         // TODO 30.08.2018 andrei: IR-1670 Remove optional from YAC
         // CryptoProviderImpl::getVote
-        vote.signature =
-            std::make_shared<shared_model::plain::Signature>(signature, pubkey);
+        vote.signature = std::make_shared<shared_model::plain::Signature>(
+            signature, signer_.publicKey());
 
         return vote;
       }
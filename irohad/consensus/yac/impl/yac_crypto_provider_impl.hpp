@@ -8,21 +8,33 @@
 
 #include "consensus/yac/yac_crypto_provider.hpp"
 
-#include "cryptography/keypair.hpp"
+#include <memory>
+
+#include "cryptography/ed25519_sha3_impl/keypair_signer.hpp"
 
 namespace iroha {
+  class ThreadPool;
+
   namespace consensus {
     namespace yac {
       class CryptoProviderImpl : public YacCryptoProvider {
        public:
-        CryptoProviderImpl(const shared_model::crypto::Keypair &keypair);
+        /**
+         * @param keypair - keypair to sign votes with
+         * @param verification_pool - threads verifying signatures of votes in
+         * parallel, nullptr to verify them on the calling thread
+         */
+        CryptoProviderImpl(
+            const shared_model::crypto::Keypair &keypair,
+            std::shared_ptr<ThreadPool> verification_pool = nullptr);
 
         bool verify(const std::vector<VoteMessage> &msg) override;
 
         VoteMessage getVote(YacHash hash) override;
 
        private:
-        shared_model::crypto::Keypair keypair_;
+        shared_model::crypto::KeypairSigner signer_;
+        std::shared_ptr<ThreadPool> verification_pool_;
       };
     }  // namespace yac
   }    // namespace consensus
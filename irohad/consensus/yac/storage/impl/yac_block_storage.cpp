@@ -5,6 +5,7 @@
 
 #include "consensus/yac/storage/yac_block_storage.hpp"
 
+#include "cryptography/public_key.hpp"
 #include "logger/logger.hpp"
 
 namespace iroha {
@@ -25,6 +26,7 @@ namespace iroha {
 
       boost::optional<Answer> YacBlockStorage::insert(VoteMessage msg) {
         if (validScheme(msg) and uniqueVote(msg)) {
+          voters_.insert(voterKey(msg));
           votes_.push_back(msg);
 
           log_->info(
@@ -65,7 +67,7 @@ namespace iroha {
       }
 
       bool YacBlockStorage::isContains(const VoteMessage &msg) const {
-        return std::count(votes_.begin(), votes_.end(), msg) != 0;
+        return msg.hash == storage_key_ and voters_.count(voterKey(msg)) != 0;
       }
 
       YacHash YacBlockStorage::getStorageKey() const {
@@ -75,10 +77,12 @@ namespace iroha {
       // --------| private api |--------
 
       bool YacBlockStorage::uniqueVote(VoteMessage &msg) {
-        // lookup take O(n) times
-        return std::all_of(votes_.begin(), votes_.end(), [&msg](auto vote) {
-          return vote != msg;
-        });
+        return voters_.count(voterKey(msg)) == 0;
+      }
+
+      std::string YacBlockStorage::voterKey(const VoteMessage &vote) {
+        return shared_model::crypto::toBinaryString(
+            vote.signature->publicKey());
       }
 
       bool YacBlockStorage::validScheme(VoteMessage &vote) {
@@ -17,15 +17,20 @@ namespace iroha {
 
       // --------| private api |--------
 
+      std::vector<YacBlockStorage>::iterator
+      YacProposalStorage::findExistingStore(const YacHash &store_hash) {
+        // storages are not copied, since they hold all their votes
+        return std::find_if(block_storages_.begin(),
+                            block_storages_.end(),
+                            [&store_hash](const auto &block_storage) {
+                              return block_storage.getStorageKey()
+                                  == store_hash;
+                            });
+      }
+
       auto YacProposalStorage::findStore(const YacHash &store_hash) {
         // find exist
-        auto iter = std::find_if(block_storages_.begin(),
-                                 block_storages_.end(),
-                                 [&store_hash](auto block_storage) {
-                                   auto storage_key =
-                                       block_storage.getStorageKey();
-                                   return storage_key == store_hash;
-                                 });
+        auto iter = findExistingStore(store_hash);
         if (iter != block_storages_.end()) {
           return iter;
         }
@@ -111,14 +116,9 @@ namespace iroha {
       }
 
       bool YacProposalStorage::checkPeerUniqueness(const VoteMessage &msg) {
-        return std::all_of(block_storages_.begin(),
-                           block_storages_.end(),
-                           [&msg](YacBlockStorage &storage) {
-                             if (storage.getStorageKey() != msg.hash) {
-                               return true;
-                             }
-                             return not storage.isContains(msg);
-                           });
+        // only the storage of the vote hash may contain the vote
+        auto iter = findExistingStore(msg.hash);
+        return iter == block_storages_.end() or not iter->isContains(msg);
       }
 
       boost::optional<Answer> YacProposalStorage::findRejectProof() {
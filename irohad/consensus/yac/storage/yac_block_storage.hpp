@@ -7,6 +7,8 @@
 #define IROHA_YAC_BLOCK_VOTE_STORAGE_HPP
 
 #include <memory>
+#include <string>
+#include <unordered_set>
 #include <vector>
 
 #include <boost/optional.hpp>
@@ -91,6 +93,12 @@ namespace iroha {
          */
         bool uniqueVote(VoteMessage &vote);
 
+        /**
+         * @return key identifying the voter of the vote, votes are equal when
+         * they are signed with the same public key
+         */
+        static std::string voterKey(const VoteMessage &vote);
+
         /**
          * Verify that vote has the same hash attached as the storage
          * @param vote - vote to be checked
@@ -100,6 +108,11 @@ namespace iroha {
 
         // --------| fields |--------
 
+        /**
+         * Voters of stored votes, makes uniqueness checks constant time
+         */
+        std::unordered_set<std::string> voters_;
+
         /**
          * Key of the storage; currently it's yac hash
          */
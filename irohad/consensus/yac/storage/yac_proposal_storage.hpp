@@ -40,6 +40,14 @@ namespace iroha {
          */
         auto findStore(const YacHash &store_hash);
 
+        /**
+         * Find block storage with provided hash
+         * @param store_hash - hash of store of interest
+         * @return iterator to storage, end if it is absent
+         */
+        std::vector<YacBlockStorage>::iterator findExistingStore(
+            const YacHash &store_hash);
+
        public:
         // --------| public api |--------
 
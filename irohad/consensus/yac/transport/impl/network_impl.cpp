@@ -6,8 +6,15 @@
 #include "consensus/yac/transport/impl/network_impl.hpp"
 
 #include <grpc++/grpc++.h>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <iterator>
 #include <memory>
+#include <mutex>
+#include <thread>
 
+#include "common/timer_wheel.hpp"
 #include "consensus/yac/storage/yac_common.hpp"
 #include "consensus/yac/transport/yac_pb_converters.hpp"
 #include "consensus/yac/vote_message.hpp"
@@ -15,9 +22,130 @@
 #include "logger/logger.hpp"
 #include "yac.pb.h"
 
+namespace {
+  /// @return message carrying the first state and the others batched in it
+  iroha::consensus::yac::proto::State mergeStates(
+      std::vector<iroha::consensus::yac::proto::State> states) {
+    auto merged = std::move(states.front());
+    for (auto it = std::next(states.begin()); it != states.end(); ++it) {
+      *merged.add_batched() = std::move(*it);
+    }
+    return merged;
+  }
+}  // namespace
+
 namespace iroha {
   namespace consensus {
     namespace yac {
+      /**
+       * Stream of states to a peer. States are written by a dedicated thread,
+       * so a slow peer does not block the consensus. If a write fails, the
+       * state is passed to the fallback and the stream is opened again for the
+       * next state
+       */
+      class NetworkImpl::StateStream {
+       public:
+        /// maximum number of states waiting to be written, older are dropped
+        static constexpr size_t kMaxQueuedStates = 128;
+
+        StateStream(proto::Yac::StubInterface &stub,
+                    std::function<void(const proto::State &)> fallback,
+                    std::string address,
+                    logger::LoggerPtr log)
+            : stub_(stub),
+              fallback_(std::move(fallback)),
+              address_(std::move(address)),
+              log_(std::move(log)),
+              thread_([this] { this->run(); }) {}
+
+        ~StateStream() {
+          {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+            // unblocks a write to a peer which does not read the stream
+            if (context_) {
+              context_->TryCancel();
+            }
+          }
+          cv_.notify_one();
+          thread_.join();
+        }
+
+        void send(proto::State state) {
+          {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (queue_.size() == kMaxQueuedStates) {
+              log_->warn("States queue to {} is full, dropping the oldest",
+                         address_);
+              queue_.pop_front();
+            }
+            queue_.push_back(std::move(state));
+          }
+          cv_.notify_one();
+        }
+
+       private:
+        void run() {
+          std::unique_lock<std::mutex> lock(mutex_);
+          while (true) {
+            cv_.wait(lock, [this] { return stop_ or not queue_.empty(); });
+            if (stop_) {
+              break;
+            }
+            auto state = std::move(queue_.front());
+            queue_.pop_front();
+            if (not writer_) {
+              context_ = std::make_unique<grpc::ClientContext>();
+              writer_ = stub_.SendStates(context_.get(), &response_);
+            }
+            lock.unlock();
+
+            if (not writer_->Write(state)) {
+              log_->warn("Failed to write state to stream to {}", address_);
+              close();
+              fallback_(state);
+            }
+
+            lock.lock();
+          }
+          lock.unlock();
+          close();
+        }
+
+        void close() {
+          if (not writer_) {
+            return;
+          }
+          writer_->WritesDone();
+          auto status = writer_->Finish();
+          if (not status.ok()) {
+            log_->info("Stream to {} is closed: {}",
+                       address_,
+                       status.error_message());
+          }
+          std::lock_guard<std::mutex> lock(mutex_);
+          writer_.reset();
+          context_.reset();
+        }
+
+        proto::Yac::StubInterface &stub_;
+        std::function<void(const proto::State &)> fallback_;
+        const std::string address_;
+        logger::LoggerPtr log_;
+
+        std::unique_ptr<grpc::ClientContext> context_;
+        google::protobuf::Empty response_;
+        std::unique_ptr<grpc::ClientWriterInterface<proto::State>> writer_;
+
+        std::mutex mutex_;
+        std::condition_variable cv_;
+        std::deque<proto::State> queue_;
+        bool stop_ = false;
+        std::thread thread_;
+      };
+
+      constexpr size_t NetworkImpl::kMaxBatchedStates;
+
       // ----------| Public API |----------
 
       NetworkImpl::NetworkImpl(
@@ -25,10 +153,24 @@ namespace iroha {
               async_call,
           std::function<std::unique_ptr<proto::Yac::StubInterface>(
               const shared_model::interface::Peer &)> client_creator,
-          logger::LoggerPtr log)
+          logger::LoggerPtr log,
+          bool compact_state,
+          bool stream_states,
+          std::chrono::milliseconds batch_window,
+          std::shared_ptr<TimerWheel> timer_wheel)
           : async_call_(async_call),
             client_creator_(client_creator),
-            log_(std::move(log)) {}
+            log_(std::move(log)),
+            compact_state_(compact_state),
+            stream_states_(stream_states),
+            batch_window_(timer_wheel ? batch_window
+                                      : std::chrono::milliseconds::zero()),
+            timer_wheel_(std::move(timer_wheel)) {}
+
+      NetworkImpl::~NetworkImpl() {
+        // streams refer to stubs
+        streams_.clear();
+      }
 
       void NetworkImpl::subscribe(
           std::shared_ptr<YacNetworkNotifications> handler) {
@@ -37,29 +179,143 @@ namespace iroha {
 
       void NetworkImpl::sendState(const shared_model::interface::Peer &to,
                                   const std::vector<VoteMessage> &state) {
+        auto request = makeState(state);
+        log_->info(
+            "Send votes bundle[size={}] to {}", state.size(), to.address());
+
+        std::lock_guard<std::mutex> lock(mutex_);
         createPeerConnection(to);
+        if (batch_window_ == std::chrono::milliseconds::zero()) {
+          send(to.address(), std::move(request));
+          return;
+        }
+
+        auto &batch = batches_[to.address()];
+        batch.push_back(std::move(request));
+        if (batch.size() == 1) {
+          std::weak_ptr<NetworkImpl> weak_this = shared_from_this();
+          timer_wheel_->schedule(batch_window_,
+                                 [weak_this, address = to.address()] {
+                                   if (auto self = weak_this.lock()) {
+                                     self->flush(address);
+                                   }
+                                 });
+        } else if (batch.size() == kMaxBatchedStates) {
+          // the scheduled flush finds the batch empty
+          auto states = std::move(batch);
+          batch.clear();
+          send(to.address(), mergeStates(std::move(states)));
+        }
+      }
 
+      proto::State NetworkImpl::makeState(
+          const std::vector<VoteMessage> &state) const {
         proto::State request;
+        // votes of a commit have equal round and hashes, and differ only by
+        // signatures
+        auto compact = compact_state_ and not state.empty()
+            and std::all_of(state.begin(), state.end(), [&](const auto &vote) {
+                           return vote.hash == state.front().hash;
+                         });
         for (const auto &vote : state) {
           auto pb_vote = request.add_votes();
           *pb_vote = PbConverters::serializeVote(vote);
+          if (compact) {
+            pb_vote->mutable_hash()->clear_vote_round();
+            pb_vote->mutable_hash()->clear_vote_hashes();
+          }
+        }
+        if (compact) {
+          auto common = PbConverters::serializeVotePayload(state.front());
+          *request.mutable_vote_round() = common.hash().vote_round();
+          *request.mutable_vote_hashes() = common.hash().vote_hashes();
         }
+        return request;
+      }
 
-        async_call_->Call([&](auto context, auto cq) {
-          return peers_.at(to.address())->AsyncSendState(context, request, cq);
-        });
+      void NetworkImpl::send(
+          const shared_model::interface::types::AddressType &address,
+          proto::State request) {
+        if (stream_states_) {
+          auto &stream = streams_[address];
+          if (not stream) {
+            auto &stub = *peers_.at(address);
+            stream = std::make_unique<StateStream>(
+                stub,
+                [async_call = async_call_, &stub, address](
+                    const proto::State &state) {
+                  async_call->Call(address, [&](auto context, auto cq) {
+                    return stub.AsyncSendState(context, state, cq);
+                  });
+                },
+                address,
+                log_);
+          }
+          stream->send(std::move(request));
+        } else {
+          async_call_->Call(address, [&](auto context, auto cq) {
+            return peers_.at(address)->AsyncSendState(context, request, cq);
+          });
+        }
+      }
 
-        log_->info(
-            "Send votes bundle[size={}] to {}", state.size(), to.address());
+      void NetworkImpl::flush(
+          const shared_model::interface::types::AddressType &address) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = batches_.find(address);
+        if (it == batches_.end() or it->second.empty()) {
+          return;
+        }
+        auto states = std::move(it->second);
+        batches_.erase(it);
+        log_->debug("Send {} batched states to {}", states.size(), address);
+        send(address, mergeStates(std::move(states)));
       }
 
       grpc::Status NetworkImpl::SendState(
           ::grpc::ServerContext *context,
           const ::iroha::consensus::yac::proto::State *request,
           ::google::protobuf::Empty *response) {
+        return handleStates(*request, context->peer());
+      }
+
+      grpc::Status NetworkImpl::SendStates(
+          ::grpc::ServerContext *context,
+          ::grpc::ServerReader<proto::State> *reader,
+          ::google::protobuf::Empty *response) {
+        proto::State request;
+        while (reader->Read(&request)) {
+          handleStates(request, context->peer());
+        }
+        return grpc::Status::OK;
+      }
+
+      grpc::Status NetworkImpl::handleStates(const proto::State &request,
+                                             const std::string &from) {
+        auto status = handleState(request, from);
+        for (const auto &batched : request.batched()) {
+          handleState(batched, from);
+        }
+        return status;
+      }
+
+      grpc::Status NetworkImpl::handleState(const proto::State &request,
+                                            const std::string &from) {
         std::vector<VoteMessage> state;
-        for (const auto &pb_vote : request->votes()) {
-          if (auto vote = PbConverters::deserializeVote(pb_vote, log_)) {
+        for (const auto &pb_vote : request.votes()) {
+          auto vote = [&] {
+            if (pb_vote.hash().has_vote_hashes()
+                or not request.has_vote_hashes()) {
+              return PbConverters::deserializeVote(pb_vote, log_);
+            }
+            auto full_vote = pb_vote;
+            *full_vote.mutable_hash()->mutable_vote_round() =
+                request.vote_round();
+            *full_vote.mutable_hash()->mutable_vote_hashes() =
+                request.vote_hashes();
+            return PbConverters::deserializeVote(full_vote, log_);
+          }();
+          if (vote) {
             state.push_back(*vote);
           }
         }
@@ -73,8 +329,7 @@ namespace iroha {
           return grpc::Status::CANCELLED;
         }
 
-        log_->info(
-            "Received votes[size={}] from {}", state.size(), context->peer());
+        log_->info("Received votes[size={}] from {}", state.size(), from);
 
         if (auto notifications = handler_.lock()) {
           notifications->onState(std::move(state));
@@ -9,8 +9,11 @@
 #include "consensus/yac/transport/yac_network_interface.hpp"  // for YacNetwork
 #include "yac.grpc.pb.h"
 
+#include <chrono>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 #include "consensus/yac/outcome_messages.hpp"
 #include "consensus/yac/vote_message.hpp"
@@ -20,6 +23,8 @@
 #include "network/impl/async_grpc_client.hpp"
 
 namespace iroha {
+  class TimerWheel;
+
   namespace consensus {
     namespace yac {
 
@@ -27,14 +32,39 @@ namespace iroha {
        * Class which provides implementation of transport for consensus based on
        * grpc
        */
-      class NetworkImpl : public YacNetwork, public proto::Yac::Service {
+      class NetworkImpl : public YacNetwork,
+                          public proto::Yac::Service,
+                          public std::enable_shared_from_this<NetworkImpl> {
        public:
+        /// states sent to a peer in one message at most
+        static constexpr size_t kMaxBatchedStates = 64;
+
+        /**
+         * @param compact_state - whether round and hashes shared by all sent
+         * votes are sent once per state instead of once per vote. States in
+         * both forms are accepted regardless of this flag
+         * @param stream_states - whether states are written to a long-lived
+         * stream per peer instead of a call per state. States which cannot be
+         * written to the stream are sent with a call
+         * @param batch_window - time during which states sent to a peer are
+         * collected and sent in one message, zero sends every state at once.
+         * States in both forms are accepted regardless of the window
+         * @param timer_wheel - timer of the batches, required if batch_window
+         * is not zero
+         */
         explicit NetworkImpl(
             std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
                 async_call,
             std::function<std::unique_ptr<proto::Yac::StubInterface>(
                 const shared_model::interface::Peer &)> client_creator,
-            logger::LoggerPtr log);
+            logger::LoggerPtr log,
+            bool compact_state = false,
+            bool stream_states = false,
+            std::chrono::milliseconds batch_window =
+                std::chrono::milliseconds::zero(),
+            std::shared_ptr<TimerWheel> timer_wheel = nullptr);
+
+        ~NetworkImpl() override;
 
         void subscribe(
             std::shared_ptr<YacNetworkNotifications> handler) override;
@@ -52,7 +82,53 @@ namespace iroha {
             const ::iroha::consensus::yac::proto::State *request,
             ::google::protobuf::Empty *response) override;
 
+        /**
+         * Receive states from another peer through a long-lived stream
+         */
+        grpc::Status SendStates(
+            ::grpc::ServerContext *context,
+            ::grpc::ServerReader<proto::State> *reader,
+            ::google::protobuf::Empty *response) override;
+
        private:
+        class StateStream;
+
+        /// @return message of the state
+        proto::State makeState(const std::vector<VoteMessage> &state) const;
+
+        /**
+         * Send the message to the peer, must be called under the lock
+         * @param address - address of the peer, connected already
+         * @param request - message to send
+         */
+        void send(const shared_model::interface::types::AddressType &address,
+                  proto::State request);
+
+        /**
+         * Send the states collected for the peer in one message
+         * @param address - address of the peer
+         */
+        void flush(const shared_model::interface::types::AddressType &address);
+
+        /**
+         * Deserialize received states of all rounds in the message and pass
+         * them to the subscriber
+         * @param request - received message
+         * @param from - address of the sender for logging
+         * @return CANCELLED if the first state is invalid, OK otherwise
+         */
+        grpc::Status handleStates(const proto::State &request,
+                                  const std::string &from);
+
+        /**
+         * Deserialize received state and pass it to the subscriber
+         * @param request - received state
+         * @param from - address of the sender for logging
+         * @return CANCELLED if the state is invalid, OK otherwise
+         */
+        grpc::Status handleState(const proto::State &request,
+                                 const std::string &from);
+
         /**
          * Create GRPC connection for given peer if it does not exist in
          * peers map
@@ -67,6 +143,13 @@ namespace iroha {
                            std::unique_ptr<proto::Yac::StubInterface>>
             peers_;
 
+        /**
+         * Streams of states to peers, used if stream_states is set
+         */
+        std::unordered_map<shared_model::interface::types::AddressType,
+                           std::unique_ptr<StateStream>>
+            streams_;
+
         /**
          * Subscriber of network messages
          */
@@ -86,6 +169,22 @@ namespace iroha {
             client_creator_;
 
         logger::LoggerPtr log_;
+
+        const bool compact_state_;
+        const bool stream_states_;
+        const std::chrono::milliseconds batch_window_;
+        std::shared_ptr<TimerWheel> timer_wheel_;
+
+        /// guards connections and batches, which are used by the timer thread
+        /// besides the consensus
+        std::mutex mutex_;
+
+        /**
+         * States collected for peers during the batch window
+         */
+        std::unordered_map<shared_model::interface::types::AddressType,
+                           std::vector<proto::State>>
+            batches_;
       };
 
     }  // namespace yac
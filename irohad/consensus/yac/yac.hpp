@@ -9,6 +9,7 @@
 #include "consensus/yac/transport/yac_network_interface.hpp"  // for YacNetworkNotifications
 #include "consensus/yac/yac_gate.hpp"                         // for HashGate
 
+#include <chrono>
 #include <memory>
 #include <mutex>
 
@@ -17,7 +18,11 @@
 #include "consensus/yac/cluster_order.hpp"     //  for ClusterOrdering
 #include "consensus/yac/outcome_messages.hpp"  // because messages passed by value
 #include "consensus/yac/storage/yac_vote_storage.hpp"  // for VoteStorage
+#include "interfaces/common_objects/types.hpp"  // for PubkeyType
 #include "logger/logger_fwd.hpp"
+#include "metrics/memory_accounting.hpp"
+#include "metrics/metrics.hpp"
+#include "metrics/profiled_mutex.hpp"
 
 namespace iroha {
   namespace consensus {
@@ -31,6 +36,11 @@ namespace iroha {
         /**
          * Method for creating Yac consensus object
          * @param delay for timer in milliseconds
+         * @param commit_fanout - number of peers to which every peer forwards
+         * collected commit and reject messages, 0 means that the peer which
+         * collected the outcome sends it to the whole network
+         * @param own_key - public key of this peer, required to find its
+         * position in the fan-out tree
          */
         static std::shared_ptr<Yac> create(
             YacVoteStorage vote_storage,
@@ -40,7 +50,10 @@ namespace iroha {
             ClusterOrdering order,
             Round round,
             rxcpp::observe_on_one_worker worker,
-            logger::LoggerPtr log);
+            logger::LoggerPtr log,
+            size_t commit_fanout = 0,
+            boost::optional<shared_model::interface::types::PubkeyType>
+                own_key = boost::none);
 
         Yac(YacVoteStorage vote_storage,
             std::shared_ptr<YacNetwork> network,
@@ -49,7 +62,10 @@ namespace iroha {
             ClusterOrdering order,
             Round round,
             rxcpp::observe_on_one_worker worker,
-            logger::LoggerPtr log);
+            logger::LoggerPtr log,
+            size_t commit_fanout = 0,
+            boost::optional<shared_model::interface::types::PubkeyType>
+                own_key = boost::none);
 
         ~Yac() override;
 
@@ -64,6 +80,8 @@ namespace iroha {
         void onState(std::vector<VoteMessage> state) override;
 
        private:
+        using Mutex = metrics::ProfiledMutex<std::mutex>;
+
         // ------|Private interface|------
 
         /**
@@ -94,10 +112,18 @@ namespace iroha {
          * @post lock is unlocked
          */
         void applyState(const std::vector<VoteMessage> &state,
-                        std::unique_lock<std::mutex> &lock);
+                        std::unique_lock<Mutex> &lock);
 
         // ------|Propagation|------
         void propagateState(const std::vector<VoteMessage> &msg);
+        /**
+         * Send the outcome to the children of this peer in the fan-out tree
+         * over the current cluster order
+         * @pre commit fan-out is enabled
+         */
+        void forwardState(const std::vector<VoteMessage> &msg);
+        /// @return position of this peer in the current cluster order
+        boost::optional<size_t> ownPosition() const;
         void propagateStateDirectly(const shared_model::interface::Peer &to,
                                     const std::vector<VoteMessage> &msg);
         void tryPropagateBack(const std::vector<VoteMessage> &state);
@@ -105,11 +131,13 @@ namespace iroha {
         // ------|Logger|------
         logger::LoggerPtr log_;
 
-        std::mutex mutex_;
+        Mutex mutex_{"yac"};
 
         // ------|One round|------
         ClusterOrdering cluster_order_;
         Round round_;
+        /// time of the own vote for the current round
+        std::chrono::steady_clock::time_point round_start_;
 
         // ------|Fields|------
         rxcpp::observe_on_one_worker worker_;
@@ -119,6 +147,14 @@ namespace iroha {
         std::shared_ptr<YacNetwork> network_;
         std::shared_ptr<YacCryptoProvider> crypto_;
         std::shared_ptr<Timer> timer_;
+        const size_t commit_fanout_;
+        const boost::optional<shared_model::interface::types::PubkeyType>
+            own_key_;
+
+        // ------|Metrics|------
+        metrics::Histogram &round_time_metric_;
+        metrics::Counter &outcomes_metric_;
+        metrics::MemoryAccount memory_account_;
       };
     }  // namespace yac
   }    // namespace consensus
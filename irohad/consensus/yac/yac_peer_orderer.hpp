@@ -29,8 +29,8 @@ namespace iroha {
          */
         virtual boost::optional<ClusterOrdering> getOrdering(
             const YacHash &hash,
-            std::vector<std::shared_ptr<shared_model::interface::Peer>>
-                peers) = 0;
+            const std::vector<std::shared_ptr<shared_model::interface::Peer>>
+                &peers) = 0;
 
         virtual ~YacPeerOrderer() = default;
       };
@@ -5,6 +5,8 @@
 
 #include "main/application.hpp"
 
+#include <algorithm>
+
 #include <boost/filesystem.hpp>
 
 #include "ametsuchi/impl/flat_file_block_storage_factory.hpp"
@@ -20,6 +22,10 @@
 #include "backend/protobuf/proto_transport_factory.hpp"
 #include "backend/protobuf/proto_tx_status_factory.hpp"
 #include "common/bind.hpp"
+#include "common/bounded_scheduler.hpp"
+#include "common/lane_scheduler.hpp"
+#include "common/thread_pool.hpp"
+#include "common/timer_wheel.hpp"
 #include "consensus/yac/consistency_model.hpp"
 #include "cryptography/crypto_provider/crypto_model_signer.hpp"
 #include "interfaces/iroha_internal/transaction_batch_factory_impl.hpp"
@@ -33,22 +39,32 @@
 #include "multi_sig_transactions/mst_processor_impl.hpp"
 #include "multi_sig_transactions/mst_propagation_strategy_stub.hpp"
 #include "multi_sig_transactions/mst_time_provider_impl.hpp"
+#include "multi_sig_transactions/storage/mst_journal.hpp"
 #include "multi_sig_transactions/storage/mst_storage_impl.hpp"
 #include "multi_sig_transactions/transport/mst_transport_grpc.hpp"
 #include "multi_sig_transactions/transport/mst_transport_stub.hpp"
 #include "network/impl/block_loader_impl.hpp"
 #include "network/impl/peer_communication_service_impl.hpp"
+#include "network/impl/wsv_snapshot_loader.hpp"
+#include "network/transaction_pool.hpp"
 #include "ordering/impl/on_demand_common.hpp"
 #include "ordering/impl/on_demand_ordering_gate.hpp"
+#include "ordering/impl/proposal_selection_policies.hpp"
 #include "pending_txs_storage/impl/pending_txs_storage_impl.hpp"
 #include "simulator/impl/simulator.hpp"
+#include "synchronizer/chain_follower.hpp"
 #include "synchronizer/impl/synchronizer_impl.hpp"
 #include "torii/impl/command_service_impl.hpp"
 #include "torii/impl/command_service_transport_grpc.hpp"
+#include "torii/impl/sharded_status_bus.hpp"
 #include "torii/impl/status_bus_impl.hpp"
 #include "torii/processor/query_processor_impl.hpp"
 #include "torii/processor/transaction_processor_impl.hpp"
+#include "torii/admission_control.hpp"
+#include "torii/async_query_service.hpp"
+#include "torii/query_jobs.hpp"
 #include "torii/query_service.hpp"
+#include "torii/traffic_capture.hpp"
 #include "validation/impl/chain_validator_impl.hpp"
 #include "validation/impl/stateful_validator_impl.hpp"
 #include "validators/default_validator.hpp"
@@ -92,7 +108,14 @@ Irohad::Irohad(const std::string &block_store_dir,
                    opt_alternative_peers,
                logger::LoggerManagerTreePtr logger_manager,
                const boost::optional<GossipPropagationStrategyParams>
-                   &opt_mst_gossip_params)
+                   &opt_mst_gossip_params,
+               const ametsuchi::BlockStoreOptions &block_store_options,
+               const ametsuchi::WsvRestoreOptions &wsv_restore_options,
+               const ToriiOptions &torii_options,
+               const OrderingOptions &ordering_options,
+               const ConsensusOptions &consensus_options,
+               const MstOptions &mst_options,
+               const PipelineOptions &pipeline_options)
     : block_store_dir_(block_store_dir),
       listen_ip_(listen_ip),
       torii_port_(torii_port),
@@ -106,18 +129,26 @@ Irohad::Irohad(const std::string &block_store_dir,
       stale_stream_max_rounds_(stale_stream_max_rounds),
       opt_alternative_peers_(std::move(opt_alternative_peers)),
       opt_mst_gossip_params_(opt_mst_gossip_params),
+      block_store_options_(block_store_options),
+      wsv_restore_options_(wsv_restore_options),
+      torii_options_(torii_options),
+      ordering_options_(ordering_options),
+      consensus_options_(consensus_options),
+      mst_options_(mst_options),
+      pipeline_options_(pipeline_options),
       keypair(keypair),
       ordering_init(logger_manager->getLogger()),
       yac_init(std::make_unique<iroha::consensus::yac::YacInit>()),
       consensus_gate_objects(consensus_gate_objects_lifetime),
       log_manager_(std::move(logger_manager)),
-      log_(log_manager_->getLogger()) {
+      log_(log_manager_->getLogger()),
+      startup_profiler_(iroha::metrics::registry()) {
   log_->info("created");
 
   // Initializing storage at this point in order to insert genesis block before
   // initialization of iroha daemon
-  if (auto e =
-          expected::resultToOptionalError(initStorage(std::move(pg_opt)))) {
+  if (auto e = expected::resultToOptionalError(startup_profiler_.profile(
+          "storage", [&] { return initStorage(std::move(pg_opt)); }))) {
     log_->error("Storage initialization failed: {}", e.value());
   }
 }
@@ -139,39 +170,83 @@ Irohad::RunResult Irohad::init() {
     }
   };
 
+  if (torii_options_.validation_threads != 1) {
+    verification_pool_ =
+        std::make_shared<iroha::ThreadPool>(torii_options_.validation_threads);
+  }
+
   validators_config_ =
       std::make_shared<shared_model::validation::ValidatorsConfig>(
-          max_proposal_size_);
+          max_proposal_size_, false, verification_pool_);
   block_validators_config_ =
       std::make_shared<shared_model::validation::ValidatorsConfig>(
-          max_proposal_size_, true);
-
-  // clang-format off
-  return initWsvRestorer() // Recover WSV from the existing ledger
-                           // to be sure it is consistent
-  | [this]{ return restoreWsv();}
-  | peers_updater
-  | [this]{ return initCryptoProvider();}
-  | [this]{ return initBatchParser();}
-  | [this]{ return initValidators();}
-  | [this]{ return initNetworkClient();}
-  | [this]{ return initFactories();}
-  | [this]{ return initPersistentCache();}
-  | [this]{ return initOrderingGate();}
-  | [this]{ return initSimulator();}
-  | [this]{ return initConsensusCache();}
-  | [this]{ return initBlockLoader();}
-  | [this]{ return initConsensusGate();}
-  | [this]{ return initSynchronizer();}
-  | [this]{ return initPeerCommunicationService();}
-  | [this]{ return initStatusBus();}
-  | [this]{ return initMstProcessor();}
-  | [this]{ return initPendingTxsStorage();}
-
-  // Torii
-  | [this]{ return initTransactionCommandService();}
-  | [this]{ return initQueryService();};
-  // clang-format on
+          max_proposal_size_, true, verification_pool_);
+  timer_wheel_ = std::make_shared<iroha::TimerWheel>();
+  if (pipeline_options_.executor_threads > 0) {
+    executor_ = std::make_unique<iroha::WorkStealingExecutor>(
+        pipeline_options_.executor_threads);
+  }
+
+  // runs the phase of the given name, recording its time and memory
+  auto phase = [this](const char *name, auto init_phase) {
+    return [this, name, init_phase] {
+      return startup_profiler_.profile(name, init_phase);
+    };
+  };
+
+  RunResult result;
+  if (consensus_options_.observer) {
+    // clang-format off
+    result = phase("wsv_restorer", [this]{ return initWsvRestorer();})()
+    | phase("wsv_restore", [this]{ return restoreWsv();})
+    | phase("peers_update", peers_updater)
+    | phase("crypto_provider", [this]{ return initCryptoProvider();})
+    | phase("batch_parser", [this]{ return initBatchParser();})
+    | phase("validators", [this]{ return initValidators();})
+    | phase("network_client", [this]{ return initNetworkClient();})
+    | phase("factories", [this]{ return initFactories();})
+    | phase("consensus_cache", [this]{ return initConsensusCache();})
+    | phase("block_loader", [this]{ return initBlockLoader();})
+    | phase("chain_follower", [this]{ return initChainFollower();})
+    | phase("pending_txs_storage", [this]{ return initPendingTxsStorage();})
+    | phase("traffic_capture", [this]{ return initTrafficCapture();})
+    | phase("query_service", [this]{ return initQueryService();});
+    // clang-format on
+  } else {
+    // clang-format off
+    // Recover WSV from the existing ledger to be sure it is consistent
+    result = phase("wsv_restorer", [this]{ return initWsvRestorer();})()
+    | phase("wsv_restore", [this]{ return restoreWsv();})
+    | phase("peers_update", peers_updater)
+    | phase("crypto_provider", [this]{ return initCryptoProvider();})
+    | phase("batch_parser", [this]{ return initBatchParser();})
+    | phase("validators", [this]{ return initValidators();})
+    | phase("network_client", [this]{ return initNetworkClient();})
+    | phase("factories", [this]{ return initFactories();})
+    | phase("persistent_cache", [this]{ return initPersistentCache();})
+    | phase("ordering_gate", [this]{ return initOrderingGate();})
+    | phase("simulator", [this]{ return initSimulator();})
+    | phase("consensus_cache", [this]{ return initConsensusCache();})
+    | phase("block_loader", [this]{ return initBlockLoader();})
+    | phase("consensus_gate", [this]{ return initConsensusGate();})
+    | phase("synchronizer", [this]{ return initSynchronizer();})
+    | phase("peer_communication_service",
+            [this]{ return initPeerCommunicationService();})
+    | phase("status_bus", [this]{ return initStatusBus();})
+    | phase("mst_processor", [this]{ return initMstProcessor();})
+    | phase("pending_txs_storage", [this]{ return initPendingTxsStorage();})
+
+    // Torii
+    | phase("traffic_capture", [this]{ return initTrafficCapture();})
+    | phase("command_service",
+            [this]{ return initTransactionCommandService();})
+    | phase("query_service", [this]{ return initQueryService();})
+    | phase("mst_restore", [this]{ return restoreMstState();});
+    // clang-format on
+  }
+
+  log_->info("Startup phases: {}", startup_profiler_.summary());
+  return result;
 }
 
 /**
@@ -189,7 +264,9 @@ Irohad::RunResult Irohad::initStorage(
   auto perm_converter =
       std::make_shared<shared_model::proto::ProtoPermissionToString>();
   auto block_converter =
-      std::make_shared<shared_model::proto::ProtoBlockJsonConverter>();
+      std::make_shared<shared_model::proto::ProtoBlockJsonConverter>(
+          block_store_options_.binary_format,
+          block_store_options_.compact_format);
   auto block_storage_factory = std::make_unique<FlatFileBlockStorageFactory>(
       []() {
         return (boost::filesystem::temp_directory_path()
@@ -230,7 +307,9 @@ Irohad::RunResult Irohad::initStorage(
                              std::move(block_converter),
                              perm_converter,
                              std::move(block_storage_factory),
-                             log_manager_->getChild("Storage"))
+                             log_manager_->getChild("Storage"),
+                             pool_size,
+                             block_store_options_)
              | [&](auto &&v) -> RunResult {
     storage = std::move(v);
     log_->info("[Init] => storage");
@@ -263,12 +342,42 @@ Irohad::RunResult Irohad::resetPeers(
   return {};
 }
 
+Irohad::RunResult Irohad::loadWsvSnapshot(
+    const std::vector<shared_model::interface::types::AddressType>
+        &addresses) {
+  if (addresses.size() < 2) {
+    return iroha::expected::makeError<std::string>(
+        "WSV snapshot must be verified by at least one more peer");
+  }
+  auto importer = storage->createWsvSnapshotImporter();
+  if (not importer) {
+    return iroha::expected::makeError<std::string>(
+        "Cannot create WSV snapshot importer");
+  }
+  shared_model::proto::ProtoBlockFactory block_factory(
+      std::make_unique<shared_model::validation::DefaultSignedBlockValidator>(
+          std::make_shared<shared_model::validation::ValidatorsConfig>(
+              max_proposal_size_, true)),
+      std::make_unique<shared_model::validation::ProtoBlockValidator>());
+  iroha::network::WsvSnapshotLoader loader(
+      std::move(block_factory),
+      log_manager_->getChild("WsvSnapshotLoader")->getLogger());
+  std::vector<shared_model::interface::types::AddressType> verifiers(
+      std::next(addresses.begin()), addresses.end());
+  return loader.retrieveSnapshot(addresses.front(), verifiers, **importer) |
+             [this](const auto &ledger_state) -> RunResult {
+    log_->info("WSV snapshot at height {} is loaded",
+               ledger_state->top_block_info.height);
+    return {};
+  };
+}
+
 /**
  * Initializing crypto provider
  */
 Irohad::RunResult Irohad::initCryptoProvider() {
   crypto_signer_ =
-      std::make_shared<shared_model::crypto::CryptoModelSigner<>>(keypair);
+      std::make_shared<shared_model::crypto::CryptoModelSigner>(keypair);
 
   log_->info("[Init] => crypto provider");
   return {};
@@ -291,8 +400,12 @@ Irohad::RunResult Irohad::initValidators() {
   auto validators_log_manager = log_manager_->getChild("Validators");
   stateful_validator = std::make_shared<StatefulValidatorImpl>(
       std::move(factory),
-      batch_parser,
-      validators_log_manager->getChild("Stateful")->getLogger());
+      validators_log_manager->getChild("Stateful")->getLogger(),
+      pipeline_options_.stateful_validation_threads > 1 ? storage : nullptr,
+      pipeline_options_.stateful_validation_threads > 1
+          ? std::make_shared<iroha::ThreadPool>(
+                pipeline_options_.stateful_validation_threads - 1)
+          : nullptr);
   chain_validator = std::make_shared<ChainValidatorImpl>(
       getSupermajorityChecker(kConsensusConsistencyModel),
       validators_log_manager->getChild("Chain")->getLogger());
@@ -305,9 +418,12 @@ Irohad::RunResult Irohad::initValidators() {
  * Initializing network client
  */
 Irohad::RunResult Irohad::initNetworkClient() {
+  auto affinity = pinThreads(pipeline_options_.cpu_affinity.network_client,
+                             "network client");
   async_call_ =
       std::make_shared<network::AsyncGrpcClient<google::protobuf::Empty>>(
-          log_manager_->getChild("AsyncNetworkClient")->getLogger());
+          log_manager_->getChild("AsyncNetworkClient")->getLogger(),
+          pipeline_options_.network_client_threads);
   return {};
 }
 
@@ -326,7 +442,7 @@ Irohad::RunResult Irohad::initFactories() {
       shared_model::validation::AbstractValidator<iroha::protocol::Proposal>>
       proto_proposal_validator =
           std::make_unique<shared_model::validation::ProtoProposalValidator>(
-              proto_transaction_validator);
+              proto_transaction_validator, verification_pool_);
   proposal_factory =
       std::make_shared<shared_model::proto::ProtoTransportFactory<
           shared_model::interface::Proposal,
@@ -352,6 +468,7 @@ Irohad::RunResult Irohad::initFactories() {
           shared_model::proto::Transaction>>(
           std::move(transaction_validator),
           std::move(proto_transaction_validator));
+  transaction_pool_ = std::make_shared<iroha::network::TransactionPool>();
 
   // query factories
   query_response_factory_ =
@@ -402,6 +519,8 @@ Irohad::RunResult Irohad::initPersistentCache() {
  * Initializing ordering gate
  */
 Irohad::RunResult Irohad::initOrderingGate() {
+  auto affinity =
+      pinThreads(pipeline_options_.cpu_affinity.ordering, "ordering");
   auto block_query = storage->createBlockQuery();
   if (not block_query) {
     return iroha::expected::makeError<std::string>(
@@ -428,9 +547,7 @@ Irohad::RunResult Irohad::initOrderingGate() {
     }
 
     auto &block =
-        boost::get<
-            expected::Value<std::unique_ptr<shared_model::interface::Block>>>(
-            block_result)
+        boost::get<expected::ValueOf<decltype(block_result)>>(block_result)
             .value;
     hashes.push_back(block->hash());
   }
@@ -465,19 +582,48 @@ Irohad::RunResult Irohad::initOrderingGate() {
     return reject_delay;
   };
 
-  ordering_gate =
-      ordering_init.initOrderingGate(max_proposal_size_,
-                                     proposal_delay_,
-                                     std::move(hashes),
-                                     transaction_factory,
-                                     batch_parser,
-                                     transaction_batch_factory_,
-                                     async_call_,
-                                     std::move(factory),
-                                     proposal_factory,
-                                     persistent_cache,
-                                     delay,
-                                     log_manager_->getChild("Ordering"));
+  // the batch may still be ordered by other peers, so the status of its
+  // transactions is not final, and they may be sent once more
+  auto status_factory =
+      std::make_shared<shared_model::proto::ProtoTxStatusFactory>();
+  auto shed_batches_handler = [this, status_factory](const auto &batch) {
+    if (not status_bus_) {
+      return;
+    }
+    for (const auto &tx : batch->transactions()) {
+      status_bus_->publish(status_factory->makeNotReceived(tx->hash()));
+    }
+  };
+
+  ordering_gate = ordering_init.initOrderingGate(
+      max_proposal_size_,
+      proposal_delay_,
+      std::move(hashes),
+      transaction_factory,
+      batch_parser,
+      transaction_batch_factory_,
+      async_call_,
+      std::move(factory),
+      proposal_factory,
+      persistent_cache,
+      delay,
+      log_manager_->getChild("Ordering"),
+      ordering::makeProposalSelectionPolicy(
+          ordering_options_.proposal_selection_policy),
+      ordering_options_.batches_coalescing_window,
+      ordering_options_.compact_proposals,
+      boost::make_optional(
+          ordering_options_.adaptive_round_delay,
+          ordering::RoundDelayBounds{ordering_options_.min_round_delay,
+                                     max_rounds_delay_}),
+      ordering_options_.gate_cache_size,
+      ordering_options_.prefetch_proposals,
+      transaction_pool_,
+      ordering_options_.shards,
+      ordering_options_.proposal_hedging_percentile / 100.,
+      ordering_options_.pending_size,
+      ordering_options_.creator_size,
+      std::move(shed_batches_handler));
   log_->info("[Init] => init ordering gate - [{}]",
              logger::logBool(ordering_gate));
   return {};
@@ -525,10 +671,12 @@ Irohad::RunResult Irohad::initConsensusCache() {
 Irohad::RunResult Irohad::initBlockLoader() {
   block_loader =
       loader_init.initBlockLoader(storage,
+                                  storage,
                                   storage,
                                   consensus_result_cache_,
                                   block_validators_config_,
-                                  log_manager_->getChild("BlockLoader"));
+                                  log_manager_->getChild("BlockLoader"),
+                                  verification_pool_);
 
   log_->info("[Init] => block loader");
   return {};
@@ -538,6 +686,8 @@ Irohad::RunResult Irohad::initBlockLoader() {
  * Initializing consensus gate
  */
 Irohad::RunResult Irohad::initConsensusGate() {
+  auto affinity =
+      pinThreads(pipeline_options_.cpu_affinity.consensus, "consensus");
   auto block_query = storage->createBlockQuery();
   if (not block_query) {
     return iroha::expected::makeError<std::string>(
@@ -562,7 +712,14 @@ Irohad::RunResult Irohad::initConsensusGate() {
       vote_delay_,
       async_call_,
       kConsensusConsistencyModel,
-      log_manager_->getChild("Consensus"));
+      log_manager_->getChild("Consensus"),
+      consensus_options_.compact_votes,
+      consensus_options_.stream_votes,
+      consensus_options_.vote_batch_window,
+      verification_pool_,
+      consensus_options_.commit_fanout,
+      timer_wheel_,
+      pipelineStage("consensus"));
   consensus_gate->onOutcome().subscribe(
       consensus_gate_events_subscription,
       consensus_gate_objects.get_subscriber());
@@ -586,6 +743,24 @@ Irohad::RunResult Irohad::initSynchronizer() {
   return {};
 }
 
+/**
+ * Initializing chain follower of observer peer
+ */
+Irohad::RunResult Irohad::initChainFollower() {
+  chain_follower_ = std::make_shared<synchronizer::ChainFollower>(
+      chain_validator,
+      storage,
+      storage,
+      storage,
+      block_loader,
+      proposal_delay_,
+      log_manager_->getChild("ChainFollower")->getLogger(),
+      SynchronizerImpl::kDefaultBlocksPerCommit);
+
+  log_->info("[Init] => chain follower");
+  return {};
+}
+
 /**
  * Initializing peer communication service
  */
@@ -622,7 +797,16 @@ Irohad::RunResult Irohad::initPeerCommunicationService() {
 }
 
 Irohad::RunResult Irohad::initStatusBus() {
-  status_bus_ = std::make_shared<StatusBusImpl>();
+  auto affinity =
+      pinThreads(pipeline_options_.cpu_affinity.status_bus, "status bus");
+  if (pipeline_options_.status_bus_workers > 1) {
+    status_bus_ = ShardedStatusBus::create(
+        pipeline_options_.status_bus_workers, [this](size_t shard) {
+          return pipelineStage("status_bus_" + std::to_string(shard));
+        });
+  } else {
+    status_bus_ = std::make_shared<StatusBusImpl>(pipelineStage("status_bus"));
+  }
   log_->info("[Init] => Tx status bus");
   return {};
 }
@@ -635,7 +819,9 @@ Irohad::RunResult Irohad::initMstProcessor() {
   auto mst_storage = std::make_shared<MstStorageStateImpl>(
       mst_completer,
       mst_state_logger,
-      mst_logger_manager->getChild("Storage")->getLogger());
+      mst_logger_manager->getChild("Storage")->getLogger(),
+      mst_options_.storage_size,
+      mst_options_.creator_size);
   std::shared_ptr<iroha::PropagationStrategy> mst_propagation;
   if (is_mst_supported_) {
     mst_transport = std::make_shared<iroha::network::MstTransportGrpc>(
@@ -647,30 +833,106 @@ Irohad::RunResult Irohad::initMstProcessor() {
         mst_completer,
         keypair.publicKey(),
         std::move(mst_state_logger),
-        mst_logger_manager->getChild("Transport")->getLogger());
-    mst_propagation = std::make_shared<GossipPropagationStrategy>(
-        storage, rxcpp::observe_on_new_thread(), *opt_mst_gossip_params_);
+        mst_logger_manager->getChild("Transport")->getLogger(),
+        boost::none,
+        mst_options_.signature_deltas,
+        transaction_pool_);
+    auto mst_gossip = std::make_shared<GossipPropagationStrategy>(
+        storage, timer_wheel_, *opt_mst_gossip_params_);
+    mst_gossip_ = mst_gossip;
+    mst_propagation = std::move(mst_gossip);
   } else {
     mst_transport = std::make_shared<iroha::network::MstTransportStub>();
     mst_propagation = std::make_shared<iroha::PropagationStrategyStub>();
   }
 
+  if (not mst_options_.journal_file.empty()) {
+    auto journal =
+        MstJournal::open(mst_options_.journal_file,
+                         mst_logger_manager->getChild("Journal")->getLogger());
+    if (auto error = iroha::expected::resultToOptionalError(journal)) {
+      return iroha::expected::makeError(std::move(*error));
+    }
+    mst_journal_ =
+        std::move(*iroha::expected::resultToOptionalValue(std::move(journal)));
+  }
+
   auto mst_time = std::make_shared<MstTimeProviderImpl>();
   auto fair_mst_processor = std::make_shared<FairMstProcessor>(
       mst_transport,
       mst_storage,
       mst_propagation,
       mst_time,
-      mst_logger_manager->getChild("Processor")->getLogger());
+      mst_logger_manager->getChild("Processor")->getLogger(),
+      mst_journal_);
   mst_processor = fair_mst_processor;
   mst_transport->subscribe(fair_mst_processor);
   log_->info("[Init] => MST processor");
   return {};
 }
 
+Irohad::RunResult Irohad::restoreMstState() {
+  if (not mst_journal_) {
+    return {};
+  }
+  size_t restored = 0;
+  for (const auto &transactions : mst_journal_->takeRestored()) {
+    shared_model::interface::types::SharedTxsCollectionType batch_transactions;
+    for (const auto &transaction : transactions) {
+      transaction_factory->build(transaction)
+          .match(
+              [&](auto &&value) {
+                batch_transactions.push_back(std::move(value).value);
+              },
+              [this](const auto &error) {
+                log_->warn("Skipping restored MST transaction {}: {}",
+                           error.error.hash,
+                           error.error.error);
+              });
+    }
+    transaction_batch_factory_->createTransactionBatch(batch_transactions)
+        .match(
+            [&](auto &&value) {
+              // the batch may have been committed or rejected after the
+              // journal was written
+              auto presence = persistent_cache->check(*value.value);
+              if (not presence
+                  or std::any_of(
+                         presence->begin(),
+                         presence->end(),
+                         [](const auto &status) {
+                           return not boost::get<
+                               iroha::ametsuchi::tx_cache_status_responses::
+                                   Missing>(&status);
+                         })) {
+                return;
+              }
+              mst_processor->propagateBatch(std::move(value).value);
+              ++restored;
+            },
+            [this](const auto &error) {
+              log_->warn("Skipping restored MST batch: {}", error.error);
+            });
+  }
+  log_->info("[Init] => MST state, {} batches restored", restored);
+  return {};
+}
+
 Irohad::RunResult Irohad::initPendingTxsStorage() {
   using PreparedTransactionDescriptor =
       PendingTransactionStorageImpl::PreparedTransactionDescriptor;
+  if (consensus_options_.observer) {
+    // observers receive no transactions
+    using SharedBatch = PendingTransactionStorageImpl::SharedBatch;
+    pending_txs_storage_ = std::make_shared<PendingTransactionStorageImpl>(
+        rxcpp::observable<>::empty<
+            PendingTransactionStorageImpl::SharedState>(),
+        rxcpp::observable<>::empty<SharedBatch>(),
+        rxcpp::observable<>::empty<SharedBatch>(),
+        rxcpp::observable<>::empty<PreparedTransactionDescriptor>());
+    log_->info("[Init] => pending transactions storage");
+    return {};
+  }
   pending_txs_storage_ = std::make_shared<PendingTransactionStorageImpl>(
       mst_processor->onStateUpdate(),
       mst_processor->onPreparedBatches(),
@@ -693,6 +955,21 @@ Irohad::RunResult Irohad::initPendingTxsStorage() {
   return {};
 }
 
+/**
+ * Initializing log of requests received by torii
+ */
+Irohad::RunResult Irohad::initTrafficCapture() {
+  if (torii_options_.capture_file.empty()) {
+    return {};
+  }
+  return ::torii::TrafficCapture::create(torii_options_.capture_file) |
+             [this](auto &&capture) -> RunResult {
+    traffic_capture_ = std::move(capture);
+    log_->info("[Init] => traffic capture to {}", torii_options_.capture_file);
+    return {};
+  };
+}
+
 /**
  * Initializing transaction command service
  */
@@ -700,14 +977,27 @@ Irohad::RunResult Irohad::initTransactionCommandService() {
   auto command_service_log_manager = log_manager_->getChild("CommandService");
   auto status_factory =
       std::make_shared<shared_model::proto::ProtoTxStatusFactory>();
-  auto cs_cache = std::make_shared<::torii::CommandServiceImpl::CacheType>();
+  auto cs_cache = torii_options_.status_cache_size == 0
+      ? std::make_shared<::torii::CommandServiceImpl::CacheType>()
+      : std::make_shared<::torii::CommandServiceImpl::CacheType>(
+            torii_options_.status_cache_size / 4 * 3,
+            torii_options_.status_cache_size / 4);
+  boost::optional<rxcpp::observe_on_one_worker> status_coordination;
+  if (torii_options_.async_status_publishing) {
+    // a single worker keeps statuses of proposals and commits in order
+    status_coordination = executor_ or pipeline_options_.queue_size > 0
+        ? pipelineStage("transaction_statuses")
+        : rxcpp::observe_on_one_worker(rxcpp::schedulers::make_same_worker(
+              rxcpp::schedulers::make_new_thread().create_worker()));
+  }
   auto tx_processor = std::make_shared<TransactionProcessorImpl>(
       pcs,
       mst_processor,
       status_bus_,
       status_factory,
       storage->on_commit(),
-      command_service_log_manager->getChild("Processor")->getLogger());
+      command_service_log_manager->getChild("Processor")->getLogger(),
+      std::move(status_coordination));
   command_service = std::make_shared<::torii::CommandServiceImpl>(
       tx_processor,
       storage,
@@ -716,6 +1006,11 @@ Irohad::RunResult Irohad::initTransactionCommandService() {
       cs_cache,
       persistent_cache,
       command_service_log_manager->getLogger());
+  std::shared_ptr<::torii::AdmissionControl> admission_control;
+  if (torii_options_.account_tx_rate > 0 or torii_options_.peer_tx_rate > 0) {
+    admission_control = std::make_shared<::torii::AdmissionControl>(
+        torii_options_.account_tx_rate, torii_options_.peer_tx_rate);
+  }
   command_service_transport =
       std::make_shared<::torii::CommandServiceTransportGrpc>(
           command_service,
@@ -728,7 +1023,14 @@ Irohad::RunResult Irohad::initTransactionCommandService() {
             return ::torii::CommandServiceTransportGrpc::ConsensusGateEvent{};
           }),
           stale_stream_max_rounds_,
-          command_service_log_manager->getChild("Transport")->getLogger());
+          command_service_log_manager->getChild("Transport")->getLogger(),
+          verification_pool_,
+          [gate_cache = ordering_init.gate_cache] {
+            return gate_cache->isFull();
+          },
+          std::move(admission_control),
+          transaction_pool_,
+          traffic_capture_);
 
   log_->info("[Init] => command service");
   return {};
@@ -739,28 +1041,86 @@ Irohad::RunResult Irohad::initTransactionCommandService() {
  */
 Irohad::RunResult Irohad::initQueryService() {
   auto query_service_log_manager = log_manager_->getChild("QueryService");
+  std::shared_ptr<iroha::WorkStealingExecutor::Lane> query_lane;
+  std::shared_ptr<::torii::QueryJobs> query_jobs;
+  if (torii_options_.query_threads > 0) {
+    if (not executor_) {
+      query_executor_ = std::make_unique<iroha::WorkStealingExecutor>(
+          torii_options_.query_threads);
+    }
+    auto &executor = executor_ ? *executor_ : *query_executor_;
+    query_lane = executor.makeLane(torii_options_.query_threads);
+    if (torii_options_.max_query_jobs > 0) {
+      query_jobs = std::make_shared<::torii::QueryJobs>(
+          torii_options_.max_query_jobs,
+          executor,
+          query_lane,
+          timer_wheel_,
+          query_service_log_manager->getChild("Jobs")->getLogger());
+    }
+  } else if (torii_options_.max_query_jobs > 0) {
+    log_->warn("Query jobs are disabled, they need query threads");
+  }
   auto query_processor = std::make_shared<QueryProcessorImpl>(
       storage,
       storage,
       pending_txs_storage_,
       query_response_factory_,
-      query_service_log_manager->getChild("Processor")->getLogger());
+      query_service_log_manager->getChild("Processor")->getLogger(),
+      QueryResponseCache::kDefaultBytes,
+      std::move(query_lane));
 
   query_service = std::make_shared<::torii::QueryService>(
       query_processor,
       query_factory,
       blocks_query_factory,
-      query_service_log_manager->getLogger());
+      query_service_log_manager->getLogger(),
+      traffic_capture_,
+      std::move(query_jobs));
+  if (torii_options_.query_threads > 0) {
+    auto block_broadcast = std::make_shared<::torii::BlockBroadcast>(
+        storage->on_commit(),
+        query_response_factory_,
+        query_service_log_manager->getChild("BlockBroadcast")->getLogger());
+    async_query_service_ = std::make_shared<::torii::AsyncQueryService>(
+        query_service,
+        std::move(block_broadcast),
+        query_service_log_manager->getLogger());
+  }
 
   log_->info("[Init] => query service");
   return {};
 }
 
 Irohad::RunResult Irohad::initWsvRestorer() {
-  wsv_restorer_ = std::make_shared<iroha::ametsuchi::WsvRestorerImpl>();
+  wsv_restorer_ = std::make_shared<iroha::ametsuchi::WsvRestorerImpl>(
+      wsv_restore_options_, log_manager_->getChild("WsvRestorer")->getLogger());
   return {};
 }
 
+rxcpp::observe_on_one_worker Irohad::pipelineStage(
+    const std::string &name) const {
+  if (executor_) {
+    return iroha::schedulers::makeLaneStage(*executor_, timer_wheel_);
+  }
+  if (pipeline_options_.queue_size == 0) {
+    return rxcpp::observe_on_new_thread();
+  }
+  return iroha::schedulers::makeBoundedStage(name,
+                                             pipeline_options_.queue_size);
+}
+
+std::unique_ptr<iroha::ScopedCpuAffinity> Irohad::pinThreads(
+    const iroha::CpuSet &cpus, const std::string &group) const {
+  auto affinity = std::make_unique<iroha::ScopedCpuAffinity>(cpus);
+  if (not affinity->ok()) {
+    log_->warn("Failed to pin {} threads to their CPUs", group);
+  } else if (not cpus.empty()) {
+    log_->info("Pinned {} threads to {} CPUs", group, cpus.size());
+  }
+  return affinity;
+}
+
 /**
  * Run iroha daemon
  */
@@ -772,7 +1132,10 @@ Irohad::RunResult Irohad::run() {
   torii_server = std::make_unique<ServerRunner>(
       listen_ip_ + ":" + std::to_string(torii_port_),
       log_manager_->getChild("ToriiServerRunner")->getLogger(),
-      false);
+      false,
+      ServerRunner::ThreadingOptions{
+          static_cast<int>(torii_options_.completion_queues),
+          static_cast<int>(torii_options_.pollers_per_queue)});
 
   // Initializing internal server
   internal_server = std::make_unique<ServerRunner>(
@@ -780,13 +1143,32 @@ Irohad::RunResult Irohad::run() {
       log_manager_->getChild("InternalServerRunner")->getLogger(),
       false);
 
-  // Run torii server
-  return (torii_server->append(command_service_transport)
-              .append(query_service)
-              .run()
+  if (command_service_transport) {
+    torii_server->append(command_service_transport);
+  }
+  if (async_query_service_) {
+    torii_server->append(
+        async_query_service_,
+        [service = async_query_service_](grpc::ServerCompletionQueue &queue) {
+          service->serve(queue);
+        });
+  } else {
+    torii_server->append(query_service);
+  }
+
+  // Run torii server, its threads are started by the call
+  auto torii_result = [this] {
+    auto affinity = pinThreads(pipeline_options_.cpu_affinity.torii, "torii");
+    return torii_server->run();
+  }();
+  return (std::move(torii_result)
           |
           [&](const auto &port) {
             log_->info("Torii server bound on port {}", port);
+            if (consensus_options_.observer) {
+              // observers take part only in block loading
+              return internal_server->append(loader_init.service).run();
+            }
             if (is_mst_supported_) {
               internal_server->append(
                   std::static_pointer_cast<MstTransportGrpc>(mst_transport));
@@ -800,6 +1182,10 @@ Irohad::RunResult Irohad::run() {
              [&](const auto &port) -> RunResult {
     log_->info("Internal server bound on port {}", port);
     log_->info("===> iroha initialized");
+    if (consensus_options_.observer) {
+      chain_follower_->start();
+      return {};
+    }
     // initiate first round
     auto block_query = storage->createBlockQuery();
     if (not block_query) {
@@ -839,3 +1225,30 @@ Irohad::RunResult Irohad::run() {
     return {};
   };
 }
+
+void Irohad::setTunableParameters(
+    size_t max_proposal_size,
+    std::chrono::milliseconds proposal_delay,
+    std::chrono::milliseconds vote_delay,
+    const iroha::GossipPropagationStrategyParams &mst_gossip_params) {
+  if (max_proposal_size > max_proposal_size_) {
+    log_->warn("Max proposal size {} exceeds {} set at startup, using the "
+               "latter",
+               max_proposal_size,
+               max_proposal_size_);
+    max_proposal_size = max_proposal_size_;
+  }
+  ordering_init.setProposalParameters(max_proposal_size, proposal_delay);
+  yac_init->setVoteDelay(vote_delay);
+  if (auto mst_gossip = mst_gossip_.lock()) {
+    mst_gossip->setParams(mst_gossip_params);
+  }
+  log_->info(
+      "Parameters changed: max proposal size {}, proposal delay {} ms, vote "
+      "delay {} ms, MST gossip period {} ms to {} peers",
+      max_proposal_size,
+      proposal_delay.count(),
+      vote_delay.count(),
+      mst_gossip_params.emission_period.count(),
+      mst_gossip_params.amount_per_once);
+}
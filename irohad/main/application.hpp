@@ -6,6 +6,9 @@
 #ifndef IROHA_APPLICATION_HPP
 #define IROHA_APPLICATION_HPP
 
+#include "ametsuchi/impl/block_store_options.hpp"
+#include "ametsuchi/impl/wsv_restore_options.hpp"
+#include "common/thread_affinity.hpp"
 #include "consensus/consensus_block_cache.hpp"
 #include "consensus/gate_object.hpp"
 #include "cryptography/crypto_provider/abstract_crypto_model_signer.hpp"
@@ -16,11 +19,18 @@
 #include "logger/logger_manager_fwd.hpp"
 #include "main/impl/block_loader_init.hpp"
 #include "main/impl/on_demand_ordering_init.hpp"
+#include "main/irohad_options.hpp"
+#include "metrics/startup_profiler.hpp"
 #include "multi_sig_transactions/gossip_propagation_strategy_params.hpp"
 
 namespace iroha {
+  class GossipPropagationStrategy;
   class PendingTransactionStorage;
+  class MstJournal;
   class MstProcessor;
+  class ThreadPool;
+  class TimerWheel;
+  class WorkStealingExecutor;
   namespace ametsuchi {
     class WsvRestorer;
     class TxPresenceCache;
@@ -44,14 +54,17 @@ namespace iroha {
     class Simulator;
   }
   namespace synchronizer {
+    class ChainFollower;
     class Synchronizer;
-  }
+  }  // namespace synchronizer
   namespace torii {
     class QueryProcessor;
     class StatusBus;
     class CommandService;
     class CommandServiceTransportGrpc;
     class QueryService;
+    class AsyncQueryService;
+    class TrafficCapture;
   }  // namespace torii
   namespace validation {
     class ChainValidator;
@@ -99,7 +112,13 @@ class Irohad {
    * @param logger_manager - the logger manager to use
    * @param opt_mst_gossip_params - parameters for Gossip MST propagation
    * (optional). If not provided, disables mst processing support
-   * TODO mboldyrev 03.11.2018 IR-1844 Refactor the constructor.
+   * @param block_store_options - type and parameters of the block store
+   * @param wsv_restore_options - parameters of WSV restoration on startup
+   * @param torii_options - parameters of torii
+   * @param ordering_options - parameters of the ordering service and gate
+   * @param consensus_options - parameters of consensus
+   * @param mst_options - parameters of multisignature transactions processing
+   * @param pipeline_options - threads and queues of the pipeline
    */
   Irohad(const std::string &block_store_dir,
          std::unique_ptr<iroha::ametsuchi::PostgresOptions> pg_opt,
@@ -117,7 +136,19 @@ class Irohad {
              opt_alternative_peers,
          logger::LoggerManagerTreePtr logger_manager,
          const boost::optional<iroha::GossipPropagationStrategyParams>
-             &opt_mst_gossip_params = boost::none);
+             &opt_mst_gossip_params = boost::none,
+         const iroha::ametsuchi::BlockStoreOptions &block_store_options =
+             iroha::ametsuchi::BlockStoreOptions{},
+         const iroha::ametsuchi::WsvRestoreOptions &wsv_restore_options =
+             iroha::ametsuchi::WsvRestoreOptions{},
+         const iroha::ToriiOptions &torii_options = iroha::ToriiOptions{},
+         const iroha::OrderingOptions &ordering_options =
+             iroha::OrderingOptions{},
+         const iroha::ConsensusOptions &consensus_options =
+             iroha::ConsensusOptions{},
+         const iroha::MstOptions &mst_options = iroha::MstOptions{},
+         const iroha::PipelineOptions &pipeline_options =
+             iroha::PipelineOptions{});
 
   /**
    * Initialization of whole objects in system
@@ -138,6 +169,16 @@ class Irohad {
   Irohad::RunResult resetPeers(
       const shared_model::interface::types::PeerList &alternative_peers);
 
+  /**
+   * Replace WSV and block store with a WSV snapshot of another peer
+   * @param addresses - address of the peer to load the snapshot from,
+   * followed by the addresses of the peers which verify it
+   * @return void on success, error otherwise
+   */
+  RunResult loadWsvSnapshot(
+      const std::vector<shared_model::interface::types::AddressType>
+          &addresses);
+
   /**
    * Drop wsv and block store
    */
@@ -149,6 +190,22 @@ class Irohad {
    */
   RunResult run();
 
+  /**
+   * Change the parameters of the running components, so that they can be
+   * tuned under load without a restart
+   * @param max_proposal_size - maximum transactions in a proposal, limited
+   * by the one passed to the constructor since proposals are validated
+   * against it
+   * @param proposal_delay - timeout of proposal requests of the next rounds
+   * @param vote_delay - delay before votes are sent again
+   * @param mst_gossip_params - parameters of MST gossip, if it is enabled
+   */
+  void setTunableParameters(
+      size_t max_proposal_size,
+      std::chrono::milliseconds proposal_delay,
+      std::chrono::milliseconds vote_delay,
+      const iroha::GossipPropagationStrategyParams &mst_gossip_params);
+
   virtual ~Irohad();
 
  protected:
@@ -180,14 +237,24 @@ class Irohad {
 
   virtual RunResult initSynchronizer();
 
+  virtual RunResult initChainFollower();
+
   virtual RunResult initPeerCommunicationService();
 
   virtual RunResult initStatusBus();
 
   virtual RunResult initMstProcessor();
 
+  /**
+   * Restore multisignature batches recorded in the journal, which are
+   * neither committed nor rejected
+   */
+  virtual RunResult restoreMstState();
+
   virtual RunResult initPendingTxsStorage();
 
+  virtual RunResult initTrafficCapture();
+
   virtual RunResult initTransactionCommandService();
 
   virtual RunResult initQueryService();
@@ -197,6 +264,23 @@ class Irohad {
    */
   virtual RunResult initWsvRestorer();
 
+  /**
+   * Coordination passing events to the given stage of the pipeline, a lane
+   * of the shared executor if executor_threads is set, a bounded queue if
+   * pipeline_queue_size is set, a new thread otherwise
+   * @param name - name of the stage in the metrics
+   */
+  rxcpp::observe_on_one_worker pipelineStage(const std::string &name) const;
+
+  /**
+   * Pin the calling thread to the CPUs, so that threads of the group started
+   * until the result is destroyed inherit them
+   * @param cpus - CPUs of the group, empty leaves the thread unpinned
+   * @param group - name of the group of threads for the log
+   */
+  std::unique_ptr<iroha::ScopedCpuAffinity> pinThreads(
+      const iroha::CpuSet &cpus, const std::string &group) const;
+
   // constructor dependencies
   std::string block_store_dir_;
   const std::string listen_ip_;
@@ -213,6 +297,13 @@ class Irohad {
       opt_alternative_peers_;
   boost::optional<iroha::GossipPropagationStrategyParams>
       opt_mst_gossip_params_;
+  iroha::ametsuchi::BlockStoreOptions block_store_options_;
+  iroha::ametsuchi::WsvRestoreOptions wsv_restore_options_;
+  iroha::ToriiOptions torii_options_;
+  iroha::OrderingOptions ordering_options_;
+  iroha::ConsensusOptions consensus_options_;
+  iroha::MstOptions mst_options_;
+  iroha::PipelineOptions pipeline_options_;
 
   // ------------------------| internal dependencies |-------------------------
  public:
@@ -233,6 +324,18 @@ class Irohad {
       shared_model::interface::Block>>
       crypto_signer_;
 
+  // threads verifying signatures of transactions and votes
+  std::shared_ptr<iroha::ThreadPool> verification_pool_;
+
+  // thread running the consensus and gossip timeouts
+  std::shared_ptr<iroha::TimerWheel> timer_wheel_;
+
+  // threads shared by the stages of the pipeline
+  std::unique_ptr<iroha::WorkStealingExecutor> executor_;
+
+  // threads executing queries, if the pipeline has no shared executor
+  std::unique_ptr<iroha::WorkStealingExecutor> query_executor_;
+
   // batch parser
   std::shared_ptr<shared_model::interface::TransactionBatchParser> batch_parser;
 
@@ -258,6 +361,12 @@ class Irohad {
       iroha::protocol::Transaction>>
       transaction_factory;
 
+  // transactions received by torii, MST and ordering, shared by instance
+  std::shared_ptr<iroha::network::TransactionPool> transaction_pool_;
+
+  // log of requests received by torii
+  std::shared_ptr<iroha::torii::TrafficCapture> traffic_capture_;
+
   // query response factory
   std::shared_ptr<shared_model::interface::QueryResponseFactory>
       query_response_factory_;
@@ -299,6 +408,9 @@ class Irohad {
   // synchronizer
   std::shared_ptr<iroha::synchronizer::Synchronizer> synchronizer;
 
+  // chain follower of observer peers
+  std::shared_ptr<iroha::synchronizer::ChainFollower> chain_follower_;
+
   // pcs
   std::shared_ptr<iroha::network::PeerCommunicationService> pcs;
 
@@ -308,6 +420,10 @@ class Irohad {
   // mst
   std::shared_ptr<iroha::network::MstTransport> mst_transport;
   std::shared_ptr<iroha::MstProcessor> mst_processor;
+  std::weak_ptr<iroha::GossipPropagationStrategy> mst_gossip_;
+
+  // journal of the own MST state
+  std::shared_ptr<iroha::MstJournal> mst_journal_;
 
   // pending transactions storage
   std::shared_ptr<iroha::PendingTransactionStorage> pending_txs_storage_;
@@ -319,6 +435,7 @@ class Irohad {
 
   // query service
   std::shared_ptr<iroha::torii::QueryService> query_service;
+  std::shared_ptr<iroha::torii::AsyncQueryService> async_query_service_;
 
   // consensus gate
   std::shared_ptr<iroha::network::ConsensusGate> consensus_gate;
@@ -332,6 +449,9 @@ class Irohad {
   logger::LoggerManagerTreePtr log_manager_;  ///< application root log manager
 
   logger::LoggerPtr log_;  ///< log for local messages
+
+  /// wall time and memory of the initialization phases
+  iroha::metrics::StartupProfiler startup_profiler_;
 };
 
 #endif  // IROHA_APPLICATION_HPP
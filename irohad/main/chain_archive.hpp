@@ -0,0 +1,109 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CHAIN_ARCHIVE_HPP
+#define IROHA_CHAIN_ARCHIVE_HPP
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/result.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }
+  namespace proto {
+    class ProtoBlockFactory;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+  class ThreadPool;
+
+  namespace ametsuchi {
+    class BlockQuery;
+    class Storage;
+  }  // namespace ametsuchi
+
+  namespace main {
+    /**
+     * Exports the ledger blocks to a gzip-compressed archive and imports them
+     * back. The archive holds a header followed by a record per block: the
+     * serialized block prefixed with its size and followed by CRC32 of the
+     * serialized bytes. A record of zero size and the number of blocks
+     * terminate the archive, so truncated archives are detected.
+     */
+    class ChainArchive {
+     public:
+      /**
+       * @param block_factory - factory validating imported blocks
+       * @param pool - threads verifying imported blocks
+       * @param log - logger
+       */
+      ChainArchive(
+          std::unique_ptr<shared_model::proto::ProtoBlockFactory> block_factory,
+          std::shared_ptr<ThreadPool> pool,
+          logger::LoggerPtr log);
+
+      ~ChainArchive();
+
+      /**
+       * Write all blocks of the ledger to the archive
+       * @param block_query - source of the blocks
+       * @param path - archive file, overwritten if exists
+       * @return number of exported blocks or error description
+       */
+      expected::Result<size_t, std::string> exportChain(
+          ametsuchi::BlockQuery &block_query, const std::string &path);
+
+      /**
+       * Read and verify all blocks of the archive without committing them,
+       * so a corrupted archive is rejected before the ledger is dropped
+       * @param path - archive file
+       * @return number of blocks in the archive or error description
+       */
+      expected::Result<size_t, std::string> verifyChain(
+          const std::string &path);
+
+      /**
+       * Read blocks from the archive and commit them to the storage, which
+       * is expected to be empty. Blocks are read in batches, the checksums
+       * and the blocks of a batch are verified in parallel, and the whole
+       * batch is applied to WSV in a single commit
+       * @param path - archive file
+       * @param storage - storage to commit blocks to
+       * @return number of imported blocks or error description
+       */
+      expected::Result<size_t, std::string> importChain(
+          const std::string &path, ametsuchi::Storage &storage);
+
+     private:
+      using Blocks =
+          std::vector<std::shared_ptr<const shared_model::interface::Block>>;
+      using BatchHandler =
+          std::function<expected::Result<void, std::string>(const Blocks &)>;
+
+      /**
+       * Read the archive, verify its blocks and pass them in batches
+       * @param path - archive file
+       * @param handle_batch - called for every verified batch, its error
+       * stops reading
+       * @return number of read blocks or error description
+       */
+      expected::Result<size_t, std::string> readChain(
+          const std::string &path, const BatchHandler &handle_batch);
+
+      std::unique_ptr<shared_model::proto::ProtoBlockFactory> block_factory_;
+      std::shared_ptr<ThreadPool> pool_;
+      logger::LoggerPtr log_;
+    };
+  }  // namespace main
+}  // namespace iroha
+
+#endif  // IROHA_CHAIN_ARCHIVE_HPP
@@ -15,39 +15,48 @@ using namespace iroha::network;
 
 auto BlockLoaderInit::createService(
     std::shared_ptr<BlockQueryFactory> block_query_factory,
+    std::shared_ptr<WsvSnapshotFactory> snapshot_factory,
     std::shared_ptr<consensus::ConsensusResultCache> consensus_result_cache,
     const logger::LoggerManagerTreePtr &loader_log_manager) {
   return std::make_shared<BlockLoaderService>(
       std::move(block_query_factory),
       std::move(consensus_result_cache),
-      loader_log_manager->getChild("Network")->getLogger());
+      loader_log_manager->getChild("Network")->getLogger(),
+      std::move(snapshot_factory));
 }
 
 auto BlockLoaderInit::createLoader(
     std::shared_ptr<PeerQueryFactory> peer_query_factory,
     std::shared_ptr<shared_model::validation::ValidatorsConfig>
         validators_config,
-    logger::LoggerPtr loader_log) {
+    logger::LoggerPtr loader_log,
+    std::shared_ptr<ThreadPool> verification_pool) {
   shared_model::proto::ProtoBlockFactory factory(
       std::make_unique<shared_model::validation::DefaultSignedBlockValidator>(
           validators_config),
       std::make_unique<shared_model::validation::ProtoBlockValidator>());
-  return std::make_shared<BlockLoaderImpl>(
-      std::move(peer_query_factory), std::move(factory), std::move(loader_log));
+  return std::make_shared<BlockLoaderImpl>(std::move(peer_query_factory),
+                                           std::move(factory),
+                                           std::move(loader_log),
+                                           std::move(verification_pool));
 }
 
 std::shared_ptr<BlockLoader> BlockLoaderInit::initBlockLoader(
     std::shared_ptr<PeerQueryFactory> peer_query_factory,
     std::shared_ptr<BlockQueryFactory> block_query_factory,
+    std::shared_ptr<WsvSnapshotFactory> snapshot_factory,
     std::shared_ptr<consensus::ConsensusResultCache> consensus_result_cache,
     std::shared_ptr<shared_model::validation::ValidatorsConfig>
         validators_config,
-    const logger::LoggerManagerTreePtr &loader_log_manager) {
+    const logger::LoggerManagerTreePtr &loader_log_manager,
+    std::shared_ptr<ThreadPool> verification_pool) {
   service = createService(std::move(block_query_factory),
+                          std::move(snapshot_factory),
                           std::move(consensus_result_cache),
                           loader_log_manager);
   loader = createLoader(std::move(peer_query_factory),
                         std::move(validators_config),
-                        loader_log_manager->getLogger());
+                        loader_log_manager->getLogger(),
+                        std::move(verification_pool));
   return loader;
 }
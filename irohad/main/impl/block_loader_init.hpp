@@ -7,6 +7,7 @@
 #define IROHA_BLOCK_LOADER_INIT_HPP
 
 #include "ametsuchi/block_query_factory.hpp"
+#include "ametsuchi/wsv_snapshot_factory.hpp"
 #include "consensus/consensus_block_cache.hpp"
 #include "logger/logger_fwd.hpp"
 #include "logger/logger_manager_fwd.hpp"
@@ -24,12 +25,14 @@ namespace iroha {
       /**
        * Create block loader service with given storage
        * @param block_query_factory - factory to block query component
+       * @param snapshot_factory - factory to WSV snapshot exporter
        * @param block_cache used to retrieve last block put by consensus
        * @param loader_log - the log of the loader subsystem
        * @return initialized service
        */
       auto createService(
           std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
+          std::shared_ptr<ametsuchi::WsvSnapshotFactory> snapshot_factory,
           std::shared_ptr<consensus::ConsensusResultCache> block_cache,
           const logger::LoggerManagerTreePtr &loader_log_manager);
 
@@ -39,32 +42,39 @@ namespace iroha {
        * @param peer_query_factory - factory for peer query component creation
        * @param validators_config - a config for underlying validators
        * @param loader_log - the log of the loader subsystem
+       * @param verification_pool - threads validating loaded blocks
        * @return initialized loader
        */
       auto createLoader(
           std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
           std::shared_ptr<shared_model::validation::ValidatorsConfig>
               validators_config,
-          logger::LoggerPtr loader_log);
+          logger::LoggerPtr loader_log,
+          std::shared_ptr<ThreadPool> verification_pool);
 
      public:
       /**
        * Initialize block loader with service and loader
        * @param peer_query_factory - factory to peer query component
        * @param block_query_factory - factory to block query component
+       * @param snapshot_factory - factory to WSV snapshot exporter
        * @param block_cache used to retrieve last block put by consensus
        * @param validators_config - a config for underlying validators
        * @param loader_log - the log of the loader subsystem
+       * @param verification_pool - threads validating loaded blocks, nullptr
+       * to validate them on the thread reading from the network
        * @return initialized service
        */
       std::shared_ptr<BlockLoader> initBlockLoader(
           // TODO 30.01.2019 lebdron: IR-264 Remove PeerQueryFactory
           std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
           std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
+          std::shared_ptr<ametsuchi::WsvSnapshotFactory> snapshot_factory,
           std::shared_ptr<consensus::ConsensusResultCache> block_cache,
           std::shared_ptr<shared_model::validation::ValidatorsConfig>
               validators_config,
-          const logger::LoggerManagerTreePtr &loader_log_manager);
+          const logger::LoggerManagerTreePtr &loader_log_manager,
+          std::shared_ptr<ThreadPool> verification_pool = nullptr);
 
       std::shared_ptr<BlockLoaderImpl> loader;
       std::shared_ptr<BlockLoaderService> service;
@@ -0,0 +1,291 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "main/chain_archive.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <zlib.h>
+#include "ametsuchi/block_query.hpp"
+#include "ametsuchi/mutable_storage.hpp"
+#include "ametsuchi/storage.hpp"
+#include "backend/protobuf/proto_block_factory.hpp"
+#include "common/bind.hpp"
+#include "common/thread_pool.hpp"
+#include "logger/logger.hpp"
+
+namespace {
+  /// archive header
+  constexpr char kMagic[] = {'I', 'R', 'O', 'H', 'A', 'C', 'H', 'N'};
+  /// format version written after the header
+  constexpr uint32_t kVersion = 1;
+  /// number of blocks verified and committed at once
+  constexpr size_t kBlocksPerBatch = 256;
+  /// larger records are treated as corrupted
+  constexpr uint32_t kMaxRecordSize = 1u << 30;
+
+  struct GzClose {
+    void operator()(gzFile file) const {
+      gzclose(file);
+    }
+  };
+  using GzFilePtr = std::unique_ptr<std::remove_pointer_t<gzFile>, GzClose>;
+
+  bool writeAll(gzFile file, const void *data, size_t size) {
+    return size == 0
+        or gzwrite(file, data, static_cast<unsigned>(size))
+        == static_cast<int>(size);
+  }
+
+  bool readAll(gzFile file, void *data, size_t size) {
+    auto bytes = static_cast<char *>(data);
+    while (size != 0) {
+      auto read = gzread(file, bytes, static_cast<unsigned>(size));
+      if (read <= 0) {
+        return false;
+      }
+      bytes += read;
+      size -= static_cast<size_t>(read);
+    }
+    return true;
+  }
+
+  /// write integer in little-endian order
+  template <typename T>
+  bool writeInt(gzFile file, T value) {
+    unsigned char bytes[sizeof(T)];
+    for (size_t i = 0; i < sizeof(T); ++i) {
+      bytes[i] = static_cast<unsigned char>(value >> (8 * i));
+    }
+    return writeAll(file, bytes, sizeof(T));
+  }
+
+  /// read integer written by writeInt
+  template <typename T>
+  bool readInt(gzFile file, T &value) {
+    unsigned char bytes[sizeof(T)];
+    if (not readAll(file, bytes, sizeof(T))) {
+      return false;
+    }
+    value = 0;
+    for (size_t i = 0; i < sizeof(T); ++i) {
+      value |= static_cast<T>(bytes[i]) << (8 * i);
+    }
+    return true;
+  }
+
+  uint32_t checksum(const void *data, size_t size) {
+    return static_cast<uint32_t>(crc32(crc32(0L, Z_NULL, 0),
+                                       static_cast<const Bytef *>(data),
+                                       static_cast<uInt>(size)));
+  }
+
+  iroha::expected::Error<std::string> makeError(std::string error) {
+    return iroha::expected::makeError(std::move(error));
+  }
+}  // namespace
+
+namespace iroha {
+  namespace main {
+
+    using shared_model::interface::Block;
+
+    ChainArchive::ChainArchive(
+        std::unique_ptr<shared_model::proto::ProtoBlockFactory> block_factory,
+        std::shared_ptr<ThreadPool> pool,
+        logger::LoggerPtr log)
+        : block_factory_(std::move(block_factory)),
+          pool_(std::move(pool)),
+          log_(std::move(log)) {}
+
+    ChainArchive::~ChainArchive() = default;
+
+    expected::Result<size_t, std::string> ChainArchive::exportChain(
+        ametsuchi::BlockQuery &block_query, const std::string &path) {
+      GzFilePtr file(gzopen(path.c_str(), "wb"));
+      if (not file) {
+        return makeError("Cannot open '" + path + "' for writing");
+      }
+      const auto write_error = makeError("Cannot write to '" + path + "'");
+
+      if (not writeAll(file.get(), kMagic, sizeof(kMagic))
+          or not writeInt(file.get(), kVersion)) {
+        return write_error;
+      }
+
+      const auto top_height = block_query.getTopBlockHeight();
+      for (shared_model::interface::types::HeightType height = 1;
+           height <= top_height;
+           ++height) {
+        auto result = block_query.getBlock(height);
+        if (auto error = boost::get<
+                expected::Error<ametsuchi::BlockQuery::GetBlockError>>(
+                &result)) {
+          return makeError("Cannot read block " + std::to_string(height) + ": "
+                           + error->error.message);
+        }
+        const auto &bytes =
+            boost::get<expected::ValueOf<decltype(result)>>(result)
+                .value->blob()
+                .blob();
+        if (bytes.size() > kMaxRecordSize) {
+          return makeError("Block " + std::to_string(height)
+                           + " is too large to be exported");
+        }
+        if (not writeInt(file.get(), static_cast<uint32_t>(bytes.size()))
+            or not writeAll(file.get(), bytes.data(), bytes.size())
+            or not writeInt(file.get(),
+                            checksum(bytes.data(), bytes.size()))) {
+          return write_error;
+        }
+        if (height % kBlocksPerBatch == 0) {
+          log_->info("Exported {} of {} blocks", height, top_height);
+        }
+      }
+
+      if (not writeInt<uint32_t>(file.get(), 0)
+          or not writeInt<uint64_t>(file.get(), top_height)
+          or gzclose(file.release()) != Z_OK) {
+        return write_error;
+      }
+      log_->info("Exported {} blocks to '{}'", top_height, path);
+      return expected::makeValue(static_cast<size_t>(top_height));
+    }
+
+    expected::Result<size_t, std::string> ChainArchive::verifyChain(
+        const std::string &path) {
+      return readChain(path, [](const Blocks &) {
+        return expected::Result<void, std::string>{};
+      });
+    }
+
+    expected::Result<size_t, std::string> ChainArchive::importChain(
+        const std::string &path, ametsuchi::Storage &storage) {
+      return readChain(
+          path,
+          [&storage](const Blocks &blocks)
+              -> expected::Result<void, std::string> {
+            auto result = storage.createMutableStorage() |
+                [&](auto &&mutable_storage) -> ametsuchi::CommitResult {
+              for (const auto &block : blocks) {
+                if (not mutable_storage->apply(block)) {
+                  return makeError("Cannot apply block "
+                                   + std::to_string(block->height()));
+                }
+              }
+              return storage.commit(std::move(mutable_storage));
+            };
+            if (auto error =
+                    boost::get<expected::Error<std::string>>(&result)) {
+              return *error;
+            }
+            return {};
+          });
+    }
+
+    expected::Result<size_t, std::string> ChainArchive::readChain(
+        const std::string &path, const BatchHandler &handle_batch) {
+      GzFilePtr file(gzopen(path.c_str(), "rb"));
+      if (not file) {
+        return makeError("Cannot open '" + path + "' for reading");
+      }
+      const auto read_error =
+          makeError("Archive '" + path + "' is truncated or corrupted");
+
+      char magic[sizeof(kMagic)];
+      uint32_t version = 0;
+      if (not readAll(file.get(), magic, sizeof(magic))
+          or std::memcmp(magic, kMagic, sizeof(kMagic)) != 0
+          or not readInt(file.get(), version)) {
+        return makeError("'" + path + "' is not a chain archive");
+      }
+      if (version != kVersion) {
+        return makeError("Unsupported chain archive version "
+                         + std::to_string(version));
+      }
+
+      size_t read = 0;
+      std::shared_ptr<const Block> previous;
+      std::vector<std::string> records;
+      std::vector<uint32_t> checksums;
+      bool finished = false;
+      while (not finished) {
+        records.clear();
+        checksums.clear();
+        while (records.size() < kBlocksPerBatch) {
+          uint32_t size = 0;
+          if (not readInt(file.get(), size)) {
+            return read_error;
+          }
+          if (size == 0) {
+            finished = true;
+            break;
+          }
+          uint32_t record_checksum = 0;
+          std::string record(size > kMaxRecordSize ? 0 : size, '\0');
+          if (size > kMaxRecordSize
+              or not readAll(file.get(), &record[0], size)
+              or not readInt(file.get(), record_checksum)) {
+            return read_error;
+          }
+          records.push_back(std::move(record));
+          checksums.push_back(record_checksum);
+        }
+
+        std::vector<std::shared_ptr<const Block>> blocks(records.size());
+        std::vector<std::string> errors(records.size());
+        pool_->parallelFor(records.size(), [&](size_t i) {
+          const auto &record = records[i];
+          if (checksum(record.data(), record.size()) != checksums[i]) {
+            errors[i] = "checksum mismatch";
+            return;
+          }
+          iroha::protocol::Block block;
+          if (not block.mutable_block_v1()->ParseFromString(record)) {
+            errors[i] = "malformed block";
+            return;
+          }
+          block_factory_->createBlock(std::move(block))
+              .match([&](auto &&value) { blocks[i] = std::move(value.value); },
+                     [&](const auto &error) { errors[i] = error.error; });
+        });
+
+        for (size_t i = 0; i < blocks.size(); ++i) {
+          const auto position = read + i + 1;
+          if (not blocks[i]) {
+            return makeError("Block " + std::to_string(position)
+                             + " is invalid: " + errors[i]);
+          }
+          if (blocks[i]->height() != position
+              or (previous and blocks[i]->prevHash() != previous->hash())) {
+            return makeError("Block " + std::to_string(position)
+                             + " does not continue the chain");
+          }
+          previous = blocks[i];
+        }
+        if (blocks.empty()) {
+          continue;
+        }
+
+        if (auto error =
+                expected::resultToOptionalError(handle_batch(blocks))) {
+          return makeError(std::move(*error));
+        }
+        read += blocks.size();
+        log_->info("Read {} blocks", read);
+      }
+
+      uint64_t count = 0;
+      if (not readInt(file.get(), count) or count != read) {
+        return read_error;
+      }
+      log_->info("Read {} blocks from '{}'", read, path);
+      return expected::makeValue(size_t{read});
+    }
+
+  }  // namespace main
+}  // namespace iroha
@@ -27,8 +27,11 @@ namespace {
     return std::make_shared<PeerOrdererImpl>(peer_query_factory);
   }
 
-  auto createCryptoProvider(const shared_model::crypto::Keypair &keypair) {
-    auto crypto = std::make_shared<CryptoProviderImpl>(keypair);
+  auto createCryptoProvider(
+      const shared_model::crypto::Keypair &keypair,
+      std::shared_ptr<iroha::ThreadPool> verification_pool) {
+    auto crypto = std::make_shared<CryptoProviderImpl>(
+        keypair, std::move(verification_pool));
 
     return crypto;
   }
@@ -45,7 +48,9 @@ namespace {
       std::shared_ptr<YacNetwork> network,
       ConsistencyModel consistency_model,
       rxcpp::observe_on_one_worker coordination,
-      const logger::LoggerManagerTreePtr &consensus_log_manager) {
+      const logger::LoggerManagerTreePtr &consensus_log_manager,
+      std::shared_ptr<iroha::ThreadPool> verification_pool,
+      size_t commit_fanout) {
     std::shared_ptr<iroha::consensus::yac::CleanupStrategy> cleanup_strategy =
         std::make_shared<iroha::consensus::yac::BufferedCleanupStrategy>();
     return Yac::create(
@@ -53,12 +58,14 @@ namespace {
                        getSupermajorityChecker(consistency_model),
                        consensus_log_manager->getChild("VoteStorage")),
         std::move(network),
-        createCryptoProvider(keypair),
+        createCryptoProvider(keypair, std::move(verification_pool)),
         std::move(timer),
         initial_order,
         initial_round,
         coordination,
-        consensus_log_manager->getChild("HashGate")->getLogger());
+        consensus_log_manager->getChild("HashGate")->getLogger(),
+        commit_fanout,
+        keypair.publicKey());
   }
 }  // namespace
 
@@ -73,11 +80,17 @@ namespace iroha {
         return consensus_network_;
       }
 
-      auto YacInit::createTimer(std::chrono::milliseconds delay_milliseconds) {
-        return std::make_shared<TimerImpl>(
-            delay_milliseconds,
-            // TODO 2019-04-10 andrei: IR-441 Share a thread between MST and YAC
-            rxcpp::observe_on_new_thread());
+      void YacInit::setVoteDelay(
+          std::chrono::milliseconds vote_delay_milliseconds) {
+        if (auto timer = timer_.lock()) {
+          timer->setDelay(vote_delay_milliseconds);
+        }
+      }
+
+      auto YacInit::createTimer(std::chrono::milliseconds delay_milliseconds,
+                                std::shared_ptr<TimerWheel> timer_wheel) {
+        return std::make_shared<TimerImpl>(delay_milliseconds,
+                                           std::move(timer_wheel));
       }
 
       std::shared_ptr<YacGate> YacInit::initConsensusGate(
@@ -94,7 +107,14 @@ namespace iroha {
               iroha::network::AsyncGrpcClient<google::protobuf::Empty>>
               async_call,
           ConsistencyModel consistency_model,
-          const logger::LoggerManagerTreePtr &consensus_log_manager) {
+          const logger::LoggerManagerTreePtr &consensus_log_manager,
+          bool compact_votes,
+          bool stream_votes,
+          std::chrono::milliseconds vote_batch_window,
+          std::shared_ptr<ThreadPool> verification_pool,
+          size_t commit_fanout,
+          std::shared_ptr<TimerWheel> timer_wheel,
+          rxcpp::observe_on_one_worker outcome_coordination) {
         auto peer_orderer = createPeerOrderer(peer_query_factory);
         auto peers = peer_query_factory->createPeerQuery() |
             [](auto &&peer_query) { return peer_query->getLedgerPeers(); };
@@ -102,18 +122,27 @@ namespace iroha {
         consensus_network_ = std::make_shared<NetworkImpl>(
             async_call,
             [](const shared_model::interface::Peer &peer) {
-              return network::createClient<proto::Yac>(peer.address());
+              return network::createPeerClient<proto::Yac>(peer.address());
             },
-            consensus_log_manager->getChild("Network")->getLogger());
+            consensus_log_manager->getChild("Network")->getLogger(),
+            compact_votes,
+            stream_votes,
+            vote_batch_window,
+            timer_wheel);
+        auto timer =
+            createTimer(vote_delay_milliseconds, std::move(timer_wheel));
+        timer_ = timer;
 
         auto yac = createYac(*ClusterOrdering::create(peers.value()),
                              initial_round,
                              keypair,
-                             createTimer(vote_delay_milliseconds),
+                             std::move(timer),
                              consensus_network_,
                              consistency_model,
-                             rxcpp::observe_on_new_thread(),
-                             consensus_log_manager);
+                             std::move(outcome_coordination),
+                             consensus_log_manager,
+                             std::move(verification_pool),
+                             commit_fanout);
         consensus_network_->subscribe(yac);
 
         auto hash_provider = createHashProvider();
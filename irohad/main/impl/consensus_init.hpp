@@ -24,8 +24,12 @@
 #include "simulator/block_creator.hpp"
 
 namespace iroha {
+  class ThreadPool;
+  class TimerWheel;
+
   namespace consensus {
     namespace yac {
+      class TimerImpl;
 
       class YacInit {
        public:
@@ -42,15 +46,28 @@ namespace iroha {
                 iroha::network::AsyncGrpcClient<google::protobuf::Empty>>
                 async_call,
             ConsistencyModel consistency_model,
-            const logger::LoggerManagerTreePtr &consensus_log_manager);
+            const logger::LoggerManagerTreePtr &consensus_log_manager,
+            bool compact_votes,
+            bool stream_votes,
+            std::chrono::milliseconds vote_batch_window,
+            std::shared_ptr<ThreadPool> verification_pool,
+            size_t commit_fanout,
+            std::shared_ptr<TimerWheel> timer_wheel,
+            rxcpp::observe_on_one_worker outcome_coordination);
 
         std::shared_ptr<NetworkImpl> getConsensusNetwork() const;
 
+        /// Change the delay before the next votes are sent again
+        void setVoteDelay(std::chrono::milliseconds vote_delay_milliseconds);
+
        private:
-        auto createTimer(std::chrono::milliseconds delay_milliseconds);
+        auto createTimer(std::chrono::milliseconds delay_milliseconds,
+                         std::shared_ptr<TimerWheel> timer_wheel);
 
         bool initialized_{false};
         std::shared_ptr<NetworkImpl> consensus_network_;
+        /// not owned, the timer is destroyed together with the consensus
+        std::weak_ptr<TimerImpl> timer_;
       };
     }  // namespace yac
   }    // namespace consensus
@@ -16,12 +16,15 @@
 #include "ordering/impl/on_demand_common.hpp"
 #include "ordering/impl/on_demand_connection_manager.hpp"
 #include "ordering/impl/on_demand_ordering_gate.hpp"
-#include "ordering/impl/on_demand_ordering_service_impl.hpp"
 #include "ordering/impl/on_demand_os_client_grpc.hpp"
 #include "ordering/impl/on_demand_os_server_grpc.hpp"
 #include "ordering/impl/ordering_gate_cache/on_demand_cache.hpp"
+#include "ordering/impl/sharded_connection_manager.hpp"
 
 namespace {
+  /// number of proposals whose transactions are kept for compact proposals
+  const size_t kRecentTransactionsProposals = 10;
+
   /// match event and call corresponding lambda depending on sync_outcome
   template <typename OnBlocks, typename OnNothing>
   auto matchEvent(const iroha::synchronizer::SynchronizationEvent &event,
@@ -53,13 +56,15 @@ namespace iroha {
             async_call,
         std::shared_ptr<TransportFactoryType> proposal_transport_factory,
         std::chrono::milliseconds delay,
+        std::shared_ptr<ordering::RecentTransactionsCache> recent_transactions,
         const logger::LoggerManagerTreePtr &ordering_log_manager) {
       return std::make_shared<ordering::transport::OnDemandOsClientGrpcFactory>(
           std::move(async_call),
           std::move(proposal_transport_factory),
           [] { return std::chrono::system_clock::now(); },
           delay,
-          ordering_log_manager->getChild("NetworkClient")->getLogger());
+          ordering_log_manager->getChild("NetworkClient")->getLogger(),
+          std::move(recent_transactions));
     }
 
     auto OnDemandOrderingInit::createConnectionManager(
@@ -68,6 +73,12 @@ namespace iroha {
         std::shared_ptr<TransportFactoryType> proposal_transport_factory,
         std::chrono::milliseconds delay,
         std::vector<shared_model::interface::types::HashType> initial_hashes,
+        ordering::BatchCoalescingOptions coalescing,
+        std::shared_ptr<ordering::RecentTransactionsCache> recent_transactions,
+        bool prefetch_proposals,
+        double proposal_hedging_quantile,
+        size_t shard,
+        size_t shards,
         const logger::LoggerManagerTreePtr &ordering_log_manager) {
       // since top block will be the first in commit_notifier observable,
       // hashes of two previous blocks are prepended
@@ -88,7 +99,7 @@ namespace iroha {
       auto latest_hashes =
           all_hashes.zip(all_hashes.skip(1), all_hashes.skip(2));
 
-      auto map_peers = [this](auto &&latest_data)
+      auto map_peers = [this, shard, shards](auto &&latest_data)
           -> ordering::OnDemandConnectionManager::CurrentPeers {
         auto &latest_commit = std::get<0>(latest_data);
         auto &current_hashes = std::get<1>(latest_data);
@@ -104,7 +115,7 @@ namespace iroha {
               // hash
               auto generate_permutation = [&](auto round) {
                 auto &hash = std::get<round()>(current_hashes);
-                log_->debug("Using hash: {}", hash.toString());
+                log_->debug("Using hash: {}", hash);
                 auto &permutation = permutations_[round()];
 
                 std::seed_seq seed(hash.blob().begin(), hash.blob().end());
@@ -126,13 +137,14 @@ namespace iroha {
 
         matchEvent(latest_commit, on_blocks, on_nothing);
 
-        auto getOsPeer = [this, &current_round](auto block_round_advance,
-                                                auto reject_round) {
+        auto getOsPeer = [this, &current_round, shard, shards](
+                             auto block_round_advance, auto reject_round) {
           auto &permutation = permutations_[block_round_advance];
-          // since reject round can be greater than number of peers, wrap it
-          // with number of peers
-          auto &peer =
-              current_peers_[permutation[reject_round % permutation.size()]];
+          // every reject round takes the next peer of the permutation for
+          // each shard, and since the index can be greater than number of
+          // peers, wrap it with number of peers
+          auto index = (reject_round * shards + shard) % permutation.size();
+          auto &peer = current_peers_[permutation[index]];
           log_->debug(
               "For {}, using OS on peer: {}",
               consensus::Round{current_round.block_round + block_round_advance,
@@ -180,13 +192,20 @@ namespace iroha {
                        .with_latest_from(latest_hashes)
                        .map(map_peers);
 
-      return std::make_shared<ordering::OnDemandConnectionManager>(
+      auto factory =
           createNotificationFactory(std::move(async_call),
                                     std::move(proposal_transport_factory),
                                     delay,
-                                    ordering_log_manager),
+                                    std::move(recent_transactions),
+                                    ordering_log_manager);
+      client_factories_.push_back(factory);
+      return std::make_shared<ordering::OnDemandConnectionManager>(
+          std::move(factory),
           peers,
-          ordering_log_manager->getChild("ConnectionManager")->getLogger());
+          ordering_log_manager->getChild("ConnectionManager")->getLogger(),
+          coalescing,
+          prefetch_proposals,
+          proposal_hedging_quantile);
     }
 
     auto OnDemandOrderingInit::createGate(
@@ -294,12 +313,27 @@ namespace iroha {
         std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
             proposal_factory,
         std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
-        const logger::LoggerManagerTreePtr &ordering_log_manager) {
+        std::shared_ptr<ordering::ProposalSelectionPolicy> selection_policy,
+        const logger::LoggerManagerTreePtr &ordering_log_manager,
+        size_t max_pending_size_bytes,
+        size_t max_creator_size_bytes,
+        ordering::OnDemandOrderingServiceImpl::ShedBatchesHandler
+            shed_batches_handler) {
+      // number of stored proposals and the first round after genesis block
+      const size_t kNumberOfProposals = 3;
+      const consensus::Round kInitialRound{2, ordering::kFirstRejectRound};
       return std::make_shared<ordering::OnDemandOrderingServiceImpl>(
           max_number_of_transactions,
           std::move(proposal_factory),
           std::move(tx_cache),
-          ordering_log_manager->getChild("Service")->getLogger());
+          ordering_log_manager->getChild("Service")->getLogger(),
+          kNumberOfProposals,
+          kInitialRound,
+          std::move(selection_policy),
+          ordering::OnDemandOrderingServiceImpl::kDefaultMaxTransactionAge,
+          max_pending_size_bytes,
+          max_creator_size_bytes,
+          std::move(shed_batches_handler));
     }
 
     OnDemandOrderingInit::~OnDemandOrderingInit() {
@@ -327,30 +361,110 @@ namespace iroha {
         std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
         std::function<std::chrono::milliseconds(
             const synchronizer::SynchronizationEvent &)> delay_func,
-        logger::LoggerManagerTreePtr ordering_log_manager) {
-      auto ordering_service = createService(max_number_of_transactions,
+        logger::LoggerManagerTreePtr ordering_log_manager,
+        std::shared_ptr<ordering::ProposalSelectionPolicy> selection_policy,
+        std::chrono::milliseconds batches_coalescing_window,
+        bool compact_proposals,
+        boost::optional<ordering::RoundDelayBounds> adaptive_round_delay,
+        size_t gate_cache_max_size_bytes,
+        bool prefetch_proposals,
+        std::shared_ptr<network::TransactionPool> transaction_pool,
+        size_t ordering_shards,
+        double proposal_hedging_quantile,
+        size_t max_pending_size_bytes,
+        size_t max_creator_size_bytes,
+        ordering::OnDemandOrderingServiceImpl::ShedBatchesHandler
+            shed_batches_handler) {
+      ordering_shards = std::max<size_t>(ordering_shards, 1);
+      // the proposals of all shards are merged, so each of them is limited
+      // with a part of the proposal size
+      const size_t shard_max_transactions =
+          std::max<size_t>(max_number_of_transactions / ordering_shards, 1);
+      // shared by the server and the clients, any transaction received or
+      // sent by the peer needs not to be downloaded with a compact proposal
+      auto recent_transactions = compact_proposals
+          ? std::make_shared<ordering::RecentTransactionsCache>(
+                static_cast<uint32_t>(max_number_of_transactions
+                                      * kRecentTransactionsProposals))
+          : nullptr;
+      auto ordering_service = createService(shard_max_transactions,
                                             proposal_factory,
                                             tx_cache,
-                                            ordering_log_manager);
+                                            std::move(selection_policy),
+                                            ordering_log_manager,
+                                            max_pending_size_bytes,
+                                            max_creator_size_bytes,
+                                            std::move(shed_batches_handler));
+      ordering_shards_ = ordering_shards;
+      ordering_service_ = ordering_service;
+      if (adaptive_round_delay) {
+        delay_func = ordering::AdaptiveRoundDelay(
+            *adaptive_round_delay,
+            shard_max_transactions,
+            [ordering_service] {
+              return ordering_service->pendingTransactionsQuantity();
+            });
+      }
+      gate_cache = std::make_shared<ordering::cache::OnDemandCache>(
+          gate_cache_max_size_bytes);
       service = std::make_shared<ordering::transport::OnDemandOsServerGrpc>(
           ordering_service,
           std::move(transaction_factory),
           std::move(batch_parser),
           std::move(transaction_batch_factory),
-          ordering_log_manager->getChild("Server")->getLogger());
-      return createGate(
-          ordering_service,
-          createConnectionManager(std::move(async_call),
-                                  std::move(proposal_transport_factory),
-                                  delay,
-                                  std::move(initial_hashes),
-                                  ordering_log_manager),
-          std::make_shared<ordering::cache::OnDemandCache>(),
-          std::move(proposal_factory),
-          std::move(tx_cache),
-          std::move(delay_func),
-          max_number_of_transactions,
-          ordering_log_manager);
+          ordering_log_manager->getChild("Server")->getLogger(),
+          recent_transactions,
+          std::move(transaction_pool));
+      std::vector<std::shared_ptr<ordering::transport::OdOsNotification>>
+          shards;
+      for (size_t shard = 0; shard < ordering_shards; ++shard) {
+        shards.push_back(createConnectionManager(
+            async_call,
+            proposal_transport_factory,
+            delay,
+            initial_hashes,
+            ordering::BatchCoalescingOptions{batches_coalescing_window,
+                                             shard_max_transactions},
+            recent_transactions,
+            prefetch_proposals,
+            proposal_hedging_quantile,
+            shard,
+            ordering_shards,
+            ordering_log_manager));
+      }
+      auto network_client = ordering_shards == 1
+          ? std::move(shards.front())
+          : std::make_shared<ordering::ShardedConnectionManager>(
+                std::move(shards),
+                proposal_factory,
+                ordering_log_manager->getChild("ShardedConnectionManager")
+                    ->getLogger());
+      auto gate = createGate(ordering_service,
+                             std::move(network_client),
+                             gate_cache,
+                             std::move(proposal_factory),
+                             std::move(tx_cache),
+                             std::move(delay_func),
+                             max_number_of_transactions,
+                             ordering_log_manager);
+      ordering_gate_ = gate;
+      return gate;
+    }
+
+    void OnDemandOrderingInit::setProposalParameters(
+        size_t max_number_of_transactions, std::chrono::milliseconds delay) {
+      if (auto ordering_service = ordering_service_.lock()) {
+        ordering_service->setTransactionLimit(std::max<size_t>(
+            max_number_of_transactions / ordering_shards_, 1));
+      }
+      if (auto ordering_gate = ordering_gate_.lock()) {
+        ordering_gate->setTransactionLimit(max_number_of_transactions);
+      }
+      for (const auto &client_factory : client_factories_) {
+        if (auto factory = client_factory.lock()) {
+          factory->setProposalRequestTimeout(delay);
+        }
+      }
     }
 
   }  // namespace network
@@ -17,12 +17,23 @@
 #include "network/ordering_gate.hpp"
 #include "network/peer_communication_service.hpp"
 #include "ordering.grpc.pb.h"
+#include "ordering/impl/adaptive_round_delay.hpp"
+#include "ordering/impl/on_demand_connection_manager.hpp"
+#include "ordering/impl/on_demand_ordering_service_impl.hpp"
 #include "ordering/impl/on_demand_os_server_grpc.hpp"
 #include "ordering/impl/ordering_gate_cache/ordering_gate_cache.hpp"
 #include "ordering/on_demand_ordering_service.hpp"
 #include "ordering/on_demand_os_transport.hpp"
+#include "ordering/proposal_selection_policy.hpp"
 
 namespace iroha {
+  namespace ordering {
+    class OnDemandOrderingGate;
+    namespace transport {
+      class OnDemandOsClientGrpcFactory;
+    }
+  }  // namespace ordering
+
   namespace network {
 
     /**
@@ -45,12 +56,16 @@ namespace iroha {
               async_call,
           std::shared_ptr<TransportFactoryType> proposal_transport_factory,
           std::chrono::milliseconds delay,
+          std::shared_ptr<ordering::RecentTransactionsCache>
+              recent_transactions,
           const logger::LoggerManagerTreePtr &ordering_log_manager);
 
       /**
        * Creates connection manager which redirects requests to appropriate
        * ordering services in the current round. \see initOrderingGate for
        * parameters
+       * @param shard - index of the shard the ordering services are chosen for
+       * @param shards - number of shards
        */
       auto createConnectionManager(
           std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
@@ -58,6 +73,13 @@ namespace iroha {
           std::shared_ptr<TransportFactoryType> proposal_transport_factory,
           std::chrono::milliseconds delay,
           std::vector<shared_model::interface::types::HashType> initial_hashes,
+          ordering::BatchCoalescingOptions coalescing,
+          std::shared_ptr<ordering::RecentTransactionsCache>
+              recent_transactions,
+          bool prefetch_proposals,
+          double proposal_hedging_quantile,
+          size_t shard,
+          size_t shards,
           const logger::LoggerManagerTreePtr &ordering_log_manager);
 
       /**
@@ -85,7 +107,12 @@ namespace iroha {
           std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
               proposal_factory,
           std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
-          const logger::LoggerManagerTreePtr &ordering_log_manager);
+          std::shared_ptr<ordering::ProposalSelectionPolicy> selection_policy,
+          const logger::LoggerManagerTreePtr &ordering_log_manager,
+          size_t max_pending_size_bytes,
+          size_t max_creator_size_bytes,
+          ordering::OnDemandOrderingServiceImpl::ShedBatchesHandler
+              shed_batches_handler);
 
       rxcpp::composite_subscription sync_event_notifier_lifetime_;
       rxcpp::composite_subscription commit_notifier_lifetime_;
@@ -115,6 +142,34 @@ namespace iroha {
        * requests to ordering service and processing responses
        * @param proposal_factory factory required by ordering service to produce
        * proposals
+       * @param selection_policy selects pending batches for proposals of the
+       * ordering service
+       * @param batches_coalescing_window time during which batches sent to
+       * ordering services are grouped into a single request, zero disables
+       * grouping
+       * @param compact_proposals whether proposals are requested as lists of
+       * transaction hashes, and only unknown transactions are downloaded
+       * @param adaptive_round_delay bounds of the delay before rounds which
+       * depends on the number of pending transactions, replaces delay_func if
+       * provided
+       * @param gate_cache_max_size_bytes limit of total size of transactions
+       * cached by the ordering gate for next rounds, 0 means no limit
+       * @param prefetch_proposals whether the proposal for the round after the
+       * next commit is requested while the current round is voted
+       * @param transaction_pool pool of transactions alive in the peer, which
+       * replaces transactions received by the ordering service
+       * @param ordering_shards number of ordering services in every round,
+       * each of them receives the batches with a part of hashes, and their
+       * proposals are merged
+       * @param proposal_hedging_quantile if not 0, the proposal is requested
+       * once more when the request takes longer than this quantile of recent
+       * request times of the ordering peer
+       * @param max_pending_size_bytes limit of the total size of transactions
+       * pending in the ordering service, 0 means no limit
+       * @param max_creator_size_bytes limit of the size of transactions of a
+       * creator account pending in the ordering service, 0 means no limit
+       * @param shed_batches_handler notified of batches shed by the ordering
+       * service to stay within the limits
        * @return initialized ordering gate
        */
       std::shared_ptr<network::OrderingGate> initOrderingGate(
@@ -136,11 +191,39 @@ namespace iroha {
           std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
           std::function<std::chrono::milliseconds(
               const synchronizer::SynchronizationEvent &)> delay_func,
-          logger::LoggerManagerTreePtr ordering_log_manager);
+          logger::LoggerManagerTreePtr ordering_log_manager,
+          std::shared_ptr<ordering::ProposalSelectionPolicy> selection_policy,
+          std::chrono::milliseconds batches_coalescing_window,
+          bool compact_proposals,
+          boost::optional<ordering::RoundDelayBounds> adaptive_round_delay,
+          size_t gate_cache_max_size_bytes,
+          bool prefetch_proposals,
+          std::shared_ptr<network::TransactionPool> transaction_pool,
+          size_t ordering_shards,
+          double proposal_hedging_quantile,
+          size_t max_pending_size_bytes,
+          size_t max_creator_size_bytes,
+          ordering::OnDemandOrderingServiceImpl::ShedBatchesHandler
+              shed_batches_handler);
+
+      /**
+       * Change the proposal parameters of the running ordering components,
+       * the size of the recent transactions cache and the batches grouping
+       * keep the values of initOrderingGate
+       * @param max_number_of_transactions maximum number of transactions in a
+       * proposal
+       * @param delay timeout for ordering service response on proposal
+       * request, applied to the connections of the next rounds
+       */
+      void setProposalParameters(size_t max_number_of_transactions,
+                                 std::chrono::milliseconds delay);
 
       /// gRPC service for ordering service
       std::shared_ptr<ordering::proto::OnDemandOrdering::Service> service;
 
+      /// transactions cached by ordering gate for next rounds
+      std::shared_ptr<ordering::cache::OrderingGateCache> gate_cache;
+
       /// commit notifier from peer communication service
       rxcpp::subjects::subject<decltype(std::declval<PeerCommunicationService>()
                                             .onSynchronization())::value_type>
@@ -170,6 +253,14 @@ namespace iroha {
       // TODO andrei 08.11.2018 IR-1850 Refactor default_random_engine usages
       // with platform-independent class
       std::default_random_engine gen_;
+
+      /// running components, not owned
+      size_t ordering_shards_{1};
+      std::weak_ptr<ordering::OnDemandOrderingServiceImpl> ordering_service_;
+      std::weak_ptr<ordering::OnDemandOrderingGate> ordering_gate_;
+      std::vector<
+          std::weak_ptr<ordering::transport::OnDemandOsClientGrpcFactory>>
+          client_factories_;
     };
   }  // namespace network
 }  // namespace iroha
@@ -5,6 +5,13 @@
 
 #include "main/impl/pg_connection_init.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
 #include "logger/logger.hpp"
 #include "logger/logger_manager.hpp"
 
@@ -19,6 +26,23 @@ namespace {
     auto *log = reinterpret_cast<logger::Logger *>(arg);
     log->debug("{}", formatPostgresMessage(message));
   }
+
+  /// @return libpq connection of the session
+  const PGconn *getConnection(soci::session &session) {
+    return static_cast<soci::postgresql_session_backend *>(
+               session.get_backend())
+        ->conn_;
+  }
+
+  void setNoticeProcessor(soci::session &session, logger::Logger *log) {
+    auto *backend =
+        static_cast<soci::postgresql_session_backend *>(session.get_backend());
+    PQsetNoticeProcessor(backend->conn_, &processPqNotice, log);
+  }
+
+  /// connections with the statements of the executors prepared on them
+  std::mutex prepared_connections_mutex;
+  std::unordered_set<const PGconn *> prepared_connections;
 }  // namespace
 
 using namespace iroha::ametsuchi;
@@ -28,13 +52,26 @@ PgConnectionInit::initPostgresConnection(std::string &options_str,
                                          size_t pool_size) {
   auto pool = std::make_shared<soci::connection_pool>(pool_size);
 
-  try {
-    for (size_t i = 0; i != pool_size; i++) {
-      soci::session &session = pool->at(i);
-      session.open(*soci::factory_postgresql(), options_str);
-    }
-  } catch (const std::exception &e) {
-    return expected::makeError(formatPostgresMessage(e.what()));
+  // connections are opened at once, so that the round trips of their
+  // authentication do not add up
+  std::mutex error_mutex;
+  boost::optional<std::string> error;
+  std::vector<std::thread> openers;
+  for (size_t i = 0; i != pool_size; i++) {
+    openers.emplace_back([&, i] {
+      try {
+        pool->at(i).open(*soci::factory_postgresql(), options_str);
+      } catch (const std::exception &e) {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        error = formatPostgresMessage(e.what());
+      }
+    });
+  }
+  for (auto &opener : openers) {
+    opener.join();
+  }
+  if (error) {
+    return expected::makeError(std::move(*error));
   }
   return expected::makeValue(pool);
 }
@@ -45,12 +82,25 @@ PgConnectionInit::prepareConnectionPool(
     const PostgresOptions &options,
     const int pool_size,
     logger::LoggerManagerTreePtr log_manager) {
+  auto log = log_manager->getLogger();
   auto options_str = options.workingConnectionString();
 
+  auto start = std::chrono::steady_clock::now();
+  auto log_phase = [&log, &start](const char *phase) {
+    auto now = std::chrono::steady_clock::now();
+    log->info(
+        "{} in {} ms",
+        phase,
+        std::chrono::duration_cast<std::chrono::milliseconds>(now - start)
+            .count());
+    start = now;
+  };
+
   auto conn = initPostgresConnection(options_str, pool_size);
   if (auto e = boost::get<expected::Error<std::string>>(&conn)) {
     return *e;
   }
+  log_phase("Opened connection pool");
 
   auto &connection =
       boost::get<expected::Value<std::shared_ptr<soci::connection_pool>>>(conn)
@@ -64,8 +114,8 @@ PgConnectionInit::prepareConnectionPool(
         rollbackPrepared(session, options.preparedBlockName())
             .match([](auto &&v) {},
                    [&](auto &&e) {
-                     log_manager->getLogger()->warn(
-                         "rollback on creation has failed: {}", e.error);
+                     log->warn("rollback on creation has failed: {}",
+                               e.error);
                    });
       }
     };
@@ -80,18 +130,95 @@ PgConnectionInit::prepareConnectionPool(
                              *failover_callback_factory,
                              reconnection_strategy_factory,
                              options.maintenanceConnectionString(),
+                             options.lazyStatementPreparation(),
                              log_manager);
+    log_phase("Initialized connection pool");
+
+    // prepared state is rolled back by the shared pool, so that reserved
+    // connections are only initialized
+    auto prepare_reserved_pool =
+        [&](size_t size) -> std::shared_ptr<soci::connection_pool> {
+      if (size == 0) {
+        return nullptr;
+      }
+      auto reserved = initPostgresConnection(options_str, size);
+      if (auto e = boost::get<expected::Error<std::string>>(&reserved)) {
+        throw std::runtime_error(e->error);
+      }
+      auto &pool = boost::get<
+                       expected::Value<std::shared_ptr<soci::connection_pool>>>(
+                       reserved)
+                       .value;
+      initializeConnectionPool(*pool,
+                               size,
+                               init_,
+                               [](soci::session &) {},
+                               *failover_callback_factory,
+                               reconnection_strategy_factory,
+                               options.maintenanceConnectionString(),
+                               options.lazyStatementPreparation(),
+                               log_manager);
+      return pool;
+    };
+    const auto &reservation = options.poolReservation();
+    auto commit_pool = prepare_reserved_pool(reservation.commit);
+    auto validation_pool = prepare_reserved_pool(reservation.validation);
+    log_phase("Prepared reserved connection pools");
+    auto replica_pools = prepareReplicaConnectionPools(options, pool_size, log);
+    if (not replica_pools.empty()) {
+      log_phase("Prepared replica connection pools");
+    }
 
-    return expected::makeValue<PoolWrapper>(
-        iroha::ametsuchi::PoolWrapper(std::move(connection),
-                                      std::move(failover_callback_factory),
-                                      enable_prepared_transactions));
+    return expected::makeValue<PoolWrapper>(iroha::ametsuchi::PoolWrapper(
+        std::move(connection),
+        std::move(failover_callback_factory),
+        enable_prepared_transactions,
+        std::move(replica_pools),
+        std::move(commit_pool),
+        std::move(validation_pool)));
 
   } catch (const std::exception &e) {
     return expected::makeError(e.what());
   }
 }
 
+std::vector<std::shared_ptr<soci::connection_pool>>
+PgConnectionInit::prepareReplicaConnectionPools(const PostgresOptions &options,
+                                                size_t pool_size,
+                                                logger::LoggerPtr log) {
+  std::vector<std::shared_ptr<soci::connection_pool>> pools;
+  for (const auto &replica : options.replicas()) {
+    auto options_str = options.replicaConnectionString(replica);
+    initPostgresConnection(options_str, pool_size)
+        .match(
+            [&](auto &&pool) {
+              try {
+                for (size_t i = 0; i != pool_size; i++) {
+                  soci::session &session = pool.value->at(i);
+                  setNoticeProcessor(session, log.get());
+                  // replicas serve only queries, so the statements of
+                  // commands are not prepared on them
+                  PostgresSpecificQueryExecutor::prepareStatements(session);
+                  setStatementsPrepared(session, true);
+                }
+                pools.push_back(std::move(pool.value));
+              } catch (const std::exception &e) {
+                log->warn("Failed to initialize replica {}:{}, skipping: {}",
+                          replica.host,
+                          replica.port,
+                          formatPostgresMessage(e.what()));
+              }
+            },
+            [&](const auto &error) {
+              log->warn("Failed to connect to replica {}:{}, skipping: {}",
+                        replica.host,
+                        replica.port,
+                        error.error);
+            });
+  }
+  return pools;
+}
+
 bool PgConnectionInit::preparedTransactionsAvailable(soci::session &sql) {
   int prepared_txs_count = 0;
   try {
@@ -142,7 +269,11 @@ PgConnectionInit::createDatabaseIfNotExist(const PostgresOptions &pg_opt) {
       if (not db_exists) {
         soci::session sql(*soci::factory_postgresql(),
                           pg_opt.maintenanceConnectionString());
-        sql << "CREATE DATABASE " + pg_opt.workingDbName();
+        auto statement = "CREATE DATABASE " + pg_opt.workingDbName();
+        if (auto template_dbname = pg_opt.templateDbName()) {
+          statement += " TEMPLATE " + *template_dbname;
+        }
+        sql << statement;
         return expected::makeValue(true);
       }
       return expected::makeValue(false);
@@ -163,20 +294,24 @@ void PgConnectionInit::initializeConnectionPool(
     FailoverCallbackHolder &callback_factory,
     const ReconnectionStrategyFactory &reconnection_strategy_factory,
     const std::string &pg_reconnection_options,
+    bool lazy_statement_preparation,
     logger::LoggerManagerTreePtr log_manager) {
   auto log = log_manager->getLogger();
-  auto initialize_session = [&](soci::session &session,
-                                auto on_init_db,
-                                auto on_init_connection) {
-    auto *backend =
-        static_cast<soci::postgresql_session_backend *>(session.get_backend());
-    PQsetNoticeProcessor(backend->conn_, &processPqNotice, log.get());
+  auto initialize_session = [log](soci::session &session,
+                                  auto on_init_db,
+                                  auto on_init_connection,
+                                  bool prepare_statements) {
+    setNoticeProcessor(session, log.get());
     on_init_connection(session);
 
     // TODO: 2019-05-06 @muratovv rework unhandled exception with Result
     // IR-464
     on_init_db(session);
-    PostgresCommandExecutor::prepareStatements(session);
+    if (prepare_statements) {
+      prepareStatements(session);
+    } else {
+      setStatementsPrepared(session, false);
+    }
   };
 
   /// lambda contains special actions which should be execute once
@@ -185,16 +320,22 @@ void PgConnectionInit::initializeConnectionPool(
     // if there exists any since last session
     try_rollback(session);
     session << prepare_tables_sql;
+    upgradeSchema(session);
   };
 
   /// lambda contains actions which should be invoked once for each
   /// session
+  std::mutex failover_callback_mutex;
   auto init_failover_callback = [&](soci::session &session) {
     static size_t connection_index = 0;
+    // a restored session may be in use, so its statements are prepared at
+    // once even with lazy preparation
     auto restore_session = [initialize_session](soci::session &s) {
-      return initialize_session(s, [](auto &) {}, [](auto &) {});
+      return initialize_session(s, [](auto &) {}, [](auto &) {}, true);
     };
 
+    std::lock_guard<std::mutex> lock(failover_callback_mutex);
+
     auto &callback = callback_factory.makeFailoverCallback(
         session,
         restore_session,
@@ -209,10 +350,60 @@ void PgConnectionInit::initializeConnectionPool(
 
   assert(pool_size > 0);
 
-  initialize_session(connection_pool.at(0), init_db, init_failover_callback);
+  // the schema is created on the first session, and the rest of them are
+  // initialized at once
+  initialize_session(connection_pool.at(0),
+                     init_db,
+                     init_failover_callback,
+                     not lazy_statement_preparation);
+  std::mutex error_mutex;
+  std::exception_ptr error;
+  std::vector<std::thread> initializers;
   for (size_t i = 1; i != pool_size; i++) {
-    soci::session &session = connection_pool.at(i);
-    initialize_session(session, [](auto &) {}, init_failover_callback);
+    initializers.emplace_back([&, i] {
+      try {
+        initialize_session(connection_pool.at(i),
+                           [](auto &) {},
+                           init_failover_callback,
+                           not lazy_statement_preparation);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        error = std::current_exception();
+      }
+    });
+  }
+  for (auto &initializer : initializers) {
+    initializer.join();
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+void PgConnectionInit::prepareStatements(soci::session &sql) {
+  PostgresCommandExecutor::prepareStatements(sql);
+  PostgresSpecificQueryExecutor::prepareStatements(sql);
+  setStatementsPrepared(sql, true);
+}
+
+void PgConnectionInit::prepareStatementsOnce(soci::session &sql) {
+  if (not statementsPrepared(sql)) {
+    prepareStatements(sql);
+  }
+}
+
+bool PgConnectionInit::statementsPrepared(soci::session &sql) {
+  std::lock_guard<std::mutex> lock(prepared_connections_mutex);
+  return prepared_connections.count(getConnection(sql)) != 0;
+}
+
+void PgConnectionInit::setStatementsPrepared(soci::session &sql,
+                                             bool prepared) {
+  std::lock_guard<std::mutex> lock(prepared_connections_mutex);
+  if (prepared) {
+    prepared_connections.insert(getConnection(sql));
+  } else {
+    prepared_connections.erase(getConnection(sql));
   }
 }
 
@@ -227,23 +418,33 @@ CREATE TABLE IF NOT EXISTS domain (
     PRIMARY KEY (domain_id)
 );
 CREATE TABLE IF NOT EXISTS signatory (
-    public_key varchar NOT NULL,
+    public_key bytea NOT NULL,
     PRIMARY KEY (public_key)
 );
 CREATE TABLE IF NOT EXISTS account (
     account_id character varying(288),
     domain_id character varying(255) NOT NULL REFERENCES domain,
     quorum int NOT NULL,
-    data JSONB,
     PRIMARY KEY (account_id)
 );
+CREATE TABLE IF NOT EXISTS account_has_detail (
+    account_id character varying(288) NOT NULL REFERENCES account,
+    writer character varying(288) NOT NULL,
+    key character varying(64) NOT NULL,
+    value jsonb NOT NULL,
+    PRIMARY KEY (account_id, writer, key)
+);
+CREATE INDEX IF NOT EXISTS account_has_detail_key_index
+  ON account_has_detail
+  USING btree
+  (account_id, key);
 CREATE TABLE IF NOT EXISTS account_has_signatory (
     account_id character varying(288) NOT NULL REFERENCES account,
-    public_key varchar NOT NULL REFERENCES signatory,
+    public_key bytea NOT NULL REFERENCES signatory,
     PRIMARY KEY (account_id, public_key)
 );
 CREATE TABLE IF NOT EXISTS peer (
-    public_key varchar NOT NULL,
+    public_key bytea NOT NULL,
     address character varying(261) NOT NULL UNIQUE,
     PRIMARY KEY (public_key)
 );
@@ -281,26 +482,44 @@ CREATE TABLE IF NOT EXISTS account_has_grantable_permissions (
     PRIMARY KEY (permittee_account_id, account_id)
 );
 CREATE TABLE IF NOT EXISTS position_by_hash (
-    hash varchar,
+    hash bytea,
     height bigint,
     index bigint
 );
 CREATE TABLE IF NOT EXISTS tx_status_by_hash (
-    hash varchar,
+    hash bytea,
     status boolean
 );
 CREATE INDEX IF NOT EXISTS tx_status_by_hash_hash_index
   ON tx_status_by_hash
   USING hash
   (hash);
+CREATE TABLE IF NOT EXISTS interned_id (
+    id serial PRIMARY KEY,
+    name text NOT NULL UNIQUE
+);
+CREATE OR REPLACE FUNCTION intern_id(interned_name text) RETURNS integer AS $$
+DECLARE
+    result integer;
+BEGIN
+    SELECT id INTO result FROM interned_id WHERE name = interned_name;
+    IF NOT FOUND THEN
+        INSERT INTO interned_id(name) VALUES (interned_name)
+            ON CONFLICT (name) DO NOTHING RETURNING id INTO result;
+        IF result IS NULL THEN
+            SELECT id INTO result FROM interned_id WHERE name = interned_name;
+        END IF;
+    END IF;
+    RETURN result;
+END $$ LANGUAGE plpgsql;
 CREATE TABLE IF NOT EXISTS tx_position_by_creator (
-    creator_id text,
+    creator_id integer,
     height bigint,
     index bigint
 );
 CREATE TABLE IF NOT EXISTS position_by_account_asset (
-    account_id text,
-    asset_id text,
+    account_id integer,
+    asset_id integer,
     height bigint,
     index bigint
 );
@@ -308,8 +527,211 @@ CREATE INDEX IF NOT EXISTS position_by_account_asset_index
   ON position_by_account_asset
   USING btree
   (account_id, asset_id, height, index ASC);
+CREATE TABLE IF NOT EXISTS top_block_info (
+    lock char(1) DEFAULT 'X' NOT NULL PRIMARY KEY,
+    height bigint NOT NULL,
+    hash varchar NOT NULL
+);
+CREATE TABLE IF NOT EXISTS schema_version (
+    lock char(1) DEFAULT 'X' NOT NULL PRIMARY KEY,
+    version int NOT NULL
+);
+DO $$
+BEGIN
+    -- version 1 stored transaction hashes and public keys as hex strings
+    IF (SELECT data_type FROM information_schema.columns
+        WHERE table_schema = current_schema() AND table_name = 'signatory'
+            AND column_name = 'public_key') = 'character varying' THEN
+        ALTER TABLE account_has_signatory
+            DROP CONSTRAINT account_has_signatory_public_key_fkey;
+        ALTER TABLE signatory ALTER COLUMN public_key TYPE bytea
+            USING decode(public_key, 'hex');
+        ALTER TABLE account_has_signatory ALTER COLUMN public_key TYPE bytea
+            USING decode(public_key, 'hex');
+        ALTER TABLE account_has_signatory
+            ADD FOREIGN KEY (public_key) REFERENCES signatory;
+        ALTER TABLE peer ALTER COLUMN public_key TYPE bytea
+            USING decode(public_key, 'hex');
+        ALTER TABLE position_by_hash ALTER COLUMN hash TYPE bytea
+            USING decode(hash, 'hex');
+        ALTER TABLE tx_status_by_hash ALTER COLUMN hash TYPE bytea
+            USING decode(hash, 'hex');
+    END IF;
+END $$;
+INSERT INTO schema_version(version) VALUES (2)
+    ON CONFLICT (lock) DO NOTHING;
+CREATE OR REPLACE FUNCTION height_partition_blocks() RETURNS bigint AS $$
+    SELECT 100000::bigint
+$$ LANGUAGE sql IMMUTABLE;
+CREATE OR REPLACE FUNCTION create_height_partitions(top_height bigint)
+RETURNS void AS $$
+DECLARE
+    history_table text;
+    next_partition bigint;
+BEGIN
+    -- the partition of the top height and the next one are created, so that
+    -- the partition exists before the first block of its range is indexed
+    FOREACH history_table IN ARRAY ARRAY['position_by_hash',
+            'tx_position_by_creator', 'position_by_account_asset'] LOOP
+        IF (SELECT relkind FROM pg_class
+            WHERE oid = history_table::regclass) = 'p' THEN
+            SELECT max(substring(c.relname FROM '_(\d+)$')::bigint) + 1
+                INTO next_partition
+                FROM pg_inherits JOIN pg_class AS c ON c.oid = inhrelid
+                WHERE inhparent = history_table::regclass;
+            FOR n IN COALESCE(next_partition, 0)
+                    .. top_height / height_partition_blocks() + 1 LOOP
+                EXECUTE format('CREATE TABLE %I PARTITION OF %I '
+                               'FOR VALUES FROM (%s) TO (%s)',
+                               history_table || '_' || n,
+                               history_table,
+                               n * height_partition_blocks(),
+                               (n + 1) * height_partition_blocks());
+            END LOOP;
+        END IF;
+    END LOOP;
+END $$ LANGUAGE plpgsql;
+CREATE OR REPLACE FUNCTION prune_history(pruned_height bigint)
+RETURNS void AS $$
+DECLARE
+    history_table text;
+    history_partition text;
+BEGIN
+    -- statuses of rejected transactions are kept, they have no height
+    DELETE FROM tx_status_by_hash WHERE hash IN
+        (SELECT hash FROM position_by_hash WHERE height <= pruned_height);
+    FOREACH history_table IN ARRAY ARRAY['position_by_hash',
+            'tx_position_by_creator', 'position_by_account_asset'] LOOP
+        IF (SELECT relkind FROM pg_class
+            WHERE oid = history_table::regclass) = 'p' THEN
+            -- partitions of pruned heights only are dropped as a whole
+            FOR history_partition IN SELECT c.relname
+                    FROM pg_inherits JOIN pg_class AS c ON c.oid = inhrelid
+                    WHERE inhparent = history_table::regclass
+                        AND (substring(c.relname FROM '_(\d+)$')::bigint + 1)
+                            * height_partition_blocks() <= pruned_height + 1
+                    LOOP
+                EXECUTE format('DROP TABLE %I', history_partition);
+            END LOOP;
+        END IF;
+        EXECUTE format('DELETE FROM %I WHERE height <= %s',
+                       history_table, pruned_height);
+    END LOOP;
+END $$ LANGUAGE plpgsql;
 )";
 
+/// Every statement is executed on its own, outside of a transaction block,
+/// so that indices are built concurrently. An index left invalid by an
+/// interrupted build is dropped before the build.
+const std::vector<std::pair<int, std::vector<std::string>>>
+    PgConnectionInit::upgrades_ = {
+        {3,
+         {"DROP INDEX CONCURRENTLY IF EXISTS position_by_hash_covering_index",
+          R"(CREATE INDEX CONCURRENTLY position_by_hash_covering_index
+  ON position_by_hash
+  USING btree
+  (hash, height, index))",
+          "DROP INDEX CONCURRENTLY IF EXISTS position_by_hash_hash_index",
+          "DROP INDEX CONCURRENTLY IF EXISTS "
+          "tx_position_by_creator_pkey_index",
+          R"(CREATE UNIQUE INDEX CONCURRENTLY tx_position_by_creator_pkey_index
+  ON tx_position_by_creator
+  USING btree
+  (creator_id, height, index))",
+          R"(ALTER TABLE tx_position_by_creator
+  ADD CONSTRAINT tx_position_by_creator_pkey
+  PRIMARY KEY USING INDEX tx_position_by_creator_pkey_index)",
+          "DROP INDEX CONCURRENTLY IF EXISTS tx_position_by_creator_index"}},
+        // version 3 stored account details as a JSONB object in account.data
+        {4, {R"(DO $$
+BEGIN
+    IF EXISTS (SELECT 1 FROM information_schema.columns
+        WHERE table_schema = current_schema() AND table_name = 'account'
+            AND column_name = 'data') THEN
+        INSERT INTO account_has_detail(account_id, writer, key, value)
+            SELECT account.account_id, by_writer.key, detail.key,
+                detail.value
+            FROM account,
+                jsonb_each(account.data) AS by_writer,
+                jsonb_each(by_writer.value) AS detail;
+        ALTER TABLE account DROP COLUMN data;
+    END IF;
+END $$)"}},
+        // the history tables are partitioned by height on Postgres 11 and
+        // later, the existing table becomes the partition of the top height
+        {5, {R"(DO $$
+DECLARE
+    history_table text;
+    old_table text;
+    index_name text;
+    top_partition bigint := COALESCE((SELECT height FROM top_block_info), 0)
+        / height_partition_blocks();
+BEGIN
+    IF current_setting('server_version_num')::int < 110000 THEN
+        RETURN;
+    END IF;
+    FOREACH history_table IN ARRAY ARRAY['position_by_hash',
+            'tx_position_by_creator', 'position_by_account_asset'] LOOP
+        old_table := history_table || '_' || top_partition;
+        EXECUTE format('ALTER TABLE %I RENAME TO %I',
+                       history_table, old_table);
+        FOR index_name IN SELECT indexname FROM pg_indexes
+                WHERE schemaname = current_schema()
+                    AND tablename = old_table LOOP
+            EXECUTE format('ALTER INDEX %I RENAME TO %I',
+                           index_name, index_name || '_' || top_partition);
+        END LOOP;
+        EXECUTE format('CREATE TABLE %I (LIKE %I INCLUDING DEFAULTS) '
+                       'PARTITION BY RANGE (height)',
+                       history_table, old_table);
+        EXECUTE format('ALTER TABLE %I ATTACH PARTITION %I '
+                       'FOR VALUES FROM (MINVALUE) TO (%s)',
+                       history_table, old_table,
+                       (top_partition + 1) * height_partition_blocks());
+    END LOOP;
+    CREATE INDEX position_by_hash_covering_index
+        ON position_by_hash
+        USING btree
+        (hash, height, index);
+    ALTER TABLE tx_position_by_creator
+        ADD PRIMARY KEY (creator_id, height, index);
+    CREATE INDEX position_by_account_asset_index
+        ON position_by_account_asset
+        USING btree
+        (account_id, asset_id, height, index ASC);
+END $$)"}},
+        // version 5 stored account and asset ids of the history tables as
+        // text
+        {6, {R"(DO $$
+BEGIN
+    IF (SELECT data_type FROM information_schema.columns
+        WHERE table_schema = current_schema()
+            AND table_name = 'tx_position_by_creator'
+            AND column_name = 'creator_id') = 'text' THEN
+        ALTER TABLE tx_position_by_creator ALTER COLUMN creator_id
+            TYPE integer USING intern_id(creator_id);
+        ALTER TABLE position_by_account_asset
+            ALTER COLUMN account_id TYPE integer USING intern_id(account_id),
+            ALTER COLUMN asset_id TYPE integer USING intern_id(asset_id);
+    END IF;
+END $$)"}}};
+
+void PgConnectionInit::upgradeSchema(soci::session &sql) {
+  int version = 0;
+  sql << "SELECT version FROM schema_version", soci::into(version);
+  for (const auto &upgrade : upgrades_) {
+    if (version < upgrade.first) {
+      for (const auto &statement : upgrade.second) {
+        sql << statement;
+      }
+      sql << "UPDATE schema_version SET version = :version",
+          soci::use(upgrade.first);
+    }
+  }
+  sql << "SELECT create_height_partitions("
+         "COALESCE((SELECT height FROM top_block_info), 0))";
+}
+
 iroha::expected::Result<void, std::string> PgConnectionInit::resetWsv(
     soci::session &sql) {
   try {
@@ -319,6 +741,7 @@ iroha::expected::Result<void, std::string> PgConnectionInit::resetWsv(
       TRUNCATE TABLE role_has_permissions RESTART IDENTITY CASCADE;
       TRUNCATE TABLE account_has_roles RESTART IDENTITY CASCADE;
       TRUNCATE TABLE account_has_grantable_permissions RESTART IDENTITY CASCADE;
+      TRUNCATE TABLE account_has_detail RESTART IDENTITY CASCADE;
       TRUNCATE TABLE account RESTART IDENTITY CASCADE;
       TRUNCATE TABLE asset RESTART IDENTITY CASCADE;
       TRUNCATE TABLE domain RESTART IDENTITY CASCADE;
@@ -328,7 +751,9 @@ iroha::expected::Result<void, std::string> PgConnectionInit::resetWsv(
       TRUNCATE TABLE position_by_hash RESTART IDENTITY CASCADE;
       TRUNCATE TABLE tx_status_by_hash RESTART IDENTITY CASCADE;
       TRUNCATE TABLE tx_position_by_creator RESTART IDENTITY CASCADE;
+      TRUNCATE TABLE interned_id RESTART IDENTITY CASCADE;
       TRUNCATE TABLE position_by_account_asset RESTART IDENTITY CASCADE;
+      TRUNCATE TABLE top_block_info RESTART IDENTITY CASCADE;
     )";
     sql << reset;
   } catch (std::exception &e) {
@@ -365,3 +790,139 @@ iroha::expected::Result<void, std::string> PgConnectionInit::resetPeers(
   }
   return expected::Value<void>();
 }
+
+const std::vector<std::pair<std::string, std::string>>
+    PgConnectionInit::secondary_indices_ = {
+        {"account_has_detail_key_index",
+         R"(CREATE INDEX IF NOT EXISTS account_has_detail_key_index
+  ON account_has_detail
+  USING btree
+  (account_id, key))"},
+        {"tx_status_by_hash_hash_index",
+         R"(CREATE INDEX IF NOT EXISTS tx_status_by_hash_hash_index
+  ON tx_status_by_hash
+  USING hash
+  (hash))"},
+        {"position_by_hash_covering_index",
+         R"(CREATE INDEX IF NOT EXISTS position_by_hash_covering_index
+  ON position_by_hash
+  USING btree
+  (hash, height, index))"},
+        {"position_by_account_asset_index",
+         R"(CREATE INDEX IF NOT EXISTS position_by_account_asset_index
+  ON position_by_account_asset
+  USING btree
+  (account_id, asset_id, height, index ASC))"}};
+
+const std::string PgConnectionInit::foreign_keys_ = R"(ARRAY[
+    ['domain', 'domain_default_role_fkey', 'default_role', 'role'],
+    ['account', 'account_domain_id_fkey', 'domain_id', 'domain'],
+    ['account_has_detail', 'account_has_detail_account_id_fkey',
+        'account_id', 'account'],
+    ['account_has_signatory', 'account_has_signatory_account_id_fkey',
+        'account_id', 'account'],
+    ['account_has_signatory', 'account_has_signatory_public_key_fkey',
+        'public_key', 'signatory'],
+    ['asset', 'asset_domain_id_fkey', 'domain_id', 'domain'],
+    ['account_has_asset', 'account_has_asset_account_id_fkey',
+        'account_id', 'account'],
+    ['account_has_asset', 'account_has_asset_asset_id_fkey',
+        'asset_id', 'asset'],
+    ['role_has_permissions', 'role_has_permissions_role_id_fkey',
+        'role_id', 'role'],
+    ['account_has_roles', 'account_has_roles_account_id_fkey',
+        'account_id', 'account'],
+    ['account_has_roles', 'account_has_roles_role_id_fkey',
+        'role_id', 'role'],
+    ['account_has_grantable_permissions',
+        'account_has_grantable_permissions_permittee_account_id_fkey',
+        'permittee_account_id', 'account'],
+    ['account_has_grantable_permissions',
+        'account_has_grantable_permissions_account_id_fkey',
+        'account_id', 'account']])";
+
+iroha::expected::Result<void, std::string> PgConnectionInit::dropConstraints(
+    soci::session &sql) {
+  try {
+    std::string drop = R"(DO $$
+DECLARE
+    fk text[];
+BEGIN
+    FOREACH fk SLICE 1 IN ARRAY )"
+        + foreign_keys_ + R"( LOOP
+        EXECUTE format('ALTER TABLE %I DROP CONSTRAINT IF EXISTS %I',
+                       fk[1], fk[2]);
+    END LOOP;
+END $$;
+)";
+    for (const auto &index : secondary_indices_) {
+      drop += "DROP INDEX IF EXISTS " + index.first + ";\n";
+    }
+    sql << drop;
+  } catch (std::exception &e) {
+    return iroha::expected::makeError(
+        std::string{"Failed to drop constraints: "}
+        + formatPostgresMessage(e.what()));
+  }
+  return expected::Value<void>();
+}
+
+iroha::expected::Result<void, std::string>
+PgConnectionInit::restoreConstraints(soci::connection_pool &connection_pool,
+                                     size_t threads) {
+  std::atomic<size_t> next_index{0};
+  std::mutex error_mutex;
+  boost::optional<std::string> error;
+  auto build = [&] {
+    try {
+      soci::session sql(connection_pool);
+      for (auto i = next_index++; i < secondary_indices_.size();
+           i = next_index++) {
+        sql << secondary_indices_[i].second;
+      }
+    } catch (std::exception &e) {
+      std::lock_guard<std::mutex> lock(error_mutex);
+      error = std::string{"Failed to build indices: "}
+          + formatPostgresMessage(e.what());
+    }
+  };
+
+  std::vector<std::thread> builders;
+  for (size_t i = 1;
+       i < std::min(std::max<size_t>(threads, 1), secondary_indices_.size());
+       ++i) {
+    builders.emplace_back(build);
+  }
+  build();
+  for (auto &builder : builders) {
+    builder.join();
+  }
+  if (error) {
+    return iroha::expected::makeError(std::move(*error));
+  }
+
+  // adding a foreign key locks the referenced table, so they are added one
+  // by one
+  try {
+    soci::session sql(connection_pool);
+    sql << R"(DO $$
+DECLARE
+    fk text[];
+BEGIN
+    FOREACH fk SLICE 1 IN ARRAY )"
+            + foreign_keys_ + R"( LOOP
+        IF NOT EXISTS (SELECT 1 FROM pg_constraint
+                WHERE conrelid = fk[1]::regclass AND conname = fk[2]) THEN
+            EXECUTE format('ALTER TABLE %I ADD CONSTRAINT %I '
+                           'FOREIGN KEY (%I) REFERENCES %I',
+                           fk[1], fk[2], fk[3], fk[4]);
+        END IF;
+    END LOOP;
+END $$)";
+  } catch (std::exception &e) {
+    return iroha::expected::makeError(
+        std::string{"Failed to add foreign keys: "}
+        + formatPostgresMessage(e.what()));
+  }
+  return expected::Value<void>();
+}
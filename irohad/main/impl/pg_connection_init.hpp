@@ -17,6 +17,7 @@
 #include "ametsuchi/impl/pool_wrapper.hpp"
 #include "ametsuchi/impl/postgres_command_executor.hpp"
 #include "ametsuchi/impl/postgres_options.hpp"
+#include "ametsuchi/impl/postgres_specific_query_executor.hpp"
 #include "ametsuchi/reconnection_strategy.hpp"
 #include "common/result.hpp"
 #include "interfaces/permissions.hpp"
@@ -55,7 +56,9 @@ namespace iroha {
           const PostgresOptions &pg_opt);
 
       /*
-       * Create working database if it does not exist.
+       * Create working database if it does not exist. If a template database
+       * is configured, the working database is its copy, which already has
+       * the current schema, so no tables are created or upgraded.
        * @param pg_opt Database options.
        * @return Result of bool that is true if the database was creates and
        * false otherwise, or error message if something has gone wrong.
@@ -82,7 +85,55 @@ namespace iroha {
        */
       static expected::Result<void, std::string> resetPeers(soci::session &sql);
 
+      /**
+       * Drop foreign keys of WSV tables and indices which are only read by
+       * queries, so that rows are inserted without checks and index updates
+       * @return error message if dropping has failed
+       */
+      static expected::Result<void, std::string> dropConstraints(
+          soci::session &sql);
+
+      /**
+       * Build the indices dropped by dropConstraints and add the foreign keys
+       * back, validating the existing rows. Those which exist are skipped
+       * @param connection_pool - pool of the working database
+       * @param threads - number of indices built at once, each on its own
+       * session of the pool
+       * @return error message if building has failed
+       */
+      static expected::Result<void, std::string> restoreConstraints(
+          soci::connection_pool &connection_pool, size_t threads);
+
+      /**
+       * Prepare the statements of the command and query executors on the
+       * connection of the session
+       * @param sql - session of the working database
+       */
+      static void prepareStatements(soci::session &sql);
+
+      /**
+       * Prepare the statements of the executors on the connection of the
+       * session unless they are already prepared on it, which is used when
+       * the statements are prepared lazily
+       * @param sql - session of the working database
+       */
+      static void prepareStatementsOnce(soci::session &sql);
+
      private:
+      /**
+       * Open connection pools to read-only replicas of the working database.
+       * Replicas which can not be initialized are skipped, so that queries
+       * are served by the primary server
+       * @param options - database options with replicas
+       * @param pool_size - number of connections in every pool
+       * @param log - logger
+       * @return initialized pools
+       */
+      static std::vector<std::shared_ptr<soci::connection_pool>>
+      prepareReplicaConnectionPools(const PostgresOptions &options,
+                                    size_t pool_size,
+                                    logger::LoggerPtr log);
+
       /**
        * Function initializes existing connection pool
        * @param connection_pool - pool with connections
@@ -95,6 +146,8 @@ namespace iroha {
        * for each connection
        * @param pg_reconnection_options - parameter of connection startup on
        * reconnect
+       * @param lazy_statement_preparation - whether the statements are
+       * prepared on first use of connections instead
        * @param log_manager - log manager of storage
        * @tparam RollbackFunction - type of rollback function
        */
@@ -107,8 +160,34 @@ namespace iroha {
           FailoverCallbackHolder &callback_factory,
           const ReconnectionStrategyFactory &reconnection_strategy_factory,
           const std::string &pg_reconnection_options,
+          bool lazy_statement_preparation,
           logger::LoggerManagerTreePtr log_manager);
 
+      /// @return whether the statements are prepared on the connection
+      static bool statementsPrepared(soci::session &sql);
+
+      /// Record whether the statements are prepared on the connection
+      static void setStatementsPrepared(soci::session &sql, bool prepared);
+
+      /**
+       * Bring the schema created by init_ to the latest version with the
+       * steps which can not be run in a transaction block
+       * @param sql - session of the working database
+       */
+      static void upgradeSchema(soci::session &sql);
+
+      /// statements of the upgrades of the schema by the resulting version
+      static const std::vector<std::pair<int, std::vector<std::string>>>
+          upgrades_;
+
+      /// names of the indices dropped by dropConstraints and their statements
+      static const std::vector<std::pair<std::string, std::string>>
+          secondary_indices_;
+
+      /// array of foreign keys of WSV tables as (table, constraint, column,
+      /// referenced table)
+      static const std::string foreign_keys_;
+
      public:
       static const std::string init_;
     };
@@ -5,20 +5,204 @@
 
 #include "main/raw_block_loader.hpp"
 
+#include <algorithm>
 #include <fstream>
+#include <functional>
+#include <vector>
 
+#include <google/protobuf/util/field_mask_util.h>
+#include <google/protobuf/util/json_util.h>
 #include "backend/protobuf/block.hpp"
 #include "common/bind.hpp"
+#include "common/thread_pool.hpp"
 #include "converters/protobuf/json_proto_converter.hpp"
 #include "logger/logger.hpp"
 
+namespace {
+  /// number of transactions converted at once
+  constexpr size_t kTransactionsPerChunk = 1024;
+  /// size of the buffer for reading JSON
+  constexpr size_t kReadBufferSize = 1 << 20;
+  /// longest JSON key which is remembered while scanning
+  constexpr size_t kMaxKeySize = 32;
+
+  /**
+   * Runs task for every index in [0, count) on the pool or on the calling
+   * thread if the pool is null
+   */
+  template <typename Task>
+  void forEachIndex(iroha::ThreadPool *pool, size_t count, Task &&task) {
+    if (count == 0) {
+      return;
+    }
+    if (pool) {
+      pool->parallelFor(count, std::forward<Task>(task));
+    } else {
+      for (size_t i = 0; i < count; ++i) {
+        task(i);
+      }
+    }
+  }
+
+  /**
+   * Scans JSON of a block and splits it into the block without transactions
+   * and JSON objects of the single transactions, which are passed to the
+   * given handler as soon as they are read
+   */
+  template <typename TransactionHandler>
+  class BlockJsonSplitter {
+   public:
+    explicit BlockJsonSplitter(TransactionHandler on_transaction)
+        : on_transaction_(std::move(on_transaction)) {}
+
+    /// scan the next part of JSON
+    void feed(const char *data, size_t size) {
+      for (size_t i = 0; i < size and not error_; ++i) {
+        feed(data[i]);
+      }
+    }
+
+    /// @return JSON of the block with empty transactions array
+    const std::string &rest() const {
+      return rest_;
+    }
+
+    /// @return true if JSON is complete and well-formed as far as scanned
+    bool valid() const {
+      return not error_ and not in_transactions_ and not in_string_
+          and depth_ == 0;
+    }
+
+   private:
+    static bool isSpace(char c) {
+      return c == ' ' or c == '\n' or c == '\r' or c == '\t';
+    }
+
+    void append(char c) {
+      if (not in_transactions_) {
+        rest_ += c;
+      } else if (depth_ > transactions_depth_) {
+        transaction_ += c;
+      } else if (not isSpace(c) and c != ',') {
+        // only objects are expected in the transactions array
+        error_ = true;
+      }
+    }
+
+    void feed(char c) {
+      if (in_string_) {
+        append(c);
+        if (escaped_) {
+          escaped_ = false;
+        } else if (c == '\\') {
+          escaped_ = true;
+        } else if (c == '"') {
+          in_string_ = false;
+          last_string_ = string_;
+        } else if (string_.size() <= kMaxKeySize) {
+          string_ += c;
+        }
+        return;
+      }
+
+      switch (c) {
+        case '"':
+          in_string_ = true;
+          string_.clear();
+          append(c);
+          break;
+        case '[':
+          if (not transactions_found_ and key_ == "transactions") {
+            rest_ += c;
+            transactions_found_ = true;
+            in_transactions_ = true;
+            transactions_depth_ = ++depth_;
+            break;
+          }
+          // fall through
+        case '{':
+          ++depth_;
+          append(c);
+          break;
+        case ']':
+        case '}':
+          if (depth_ == 0) {
+            error_ = true;
+            break;
+          }
+          --depth_;
+          if (in_transactions_ and depth_ < transactions_depth_) {
+            in_transactions_ = false;
+            rest_ += c;
+            break;
+          }
+          if (in_transactions_ and depth_ == transactions_depth_) {
+            transaction_ += c;
+            on_transaction_(std::move(transaction_));
+            transaction_.clear();
+            break;
+          }
+          append(c);
+          break;
+        case ':':
+          key_ = last_string_;
+          append(c);
+          return;
+        default:
+          append(c);
+          if (isSpace(c)) {
+            return;
+          }
+      }
+      key_.clear();
+    }
+
+    TransactionHandler on_transaction_;
+    std::string rest_;
+    std::string transaction_;
+    std::string string_;
+    std::string last_string_;
+    std::string key_;
+    size_t depth_ = 0;
+    size_t transactions_depth_ = 0;
+    bool in_string_ = false;
+    bool escaped_ = false;
+    bool transactions_found_ = false;
+    bool in_transactions_ = false;
+    bool error_ = false;
+  };
+
+  /// @return JSON object members of the message without the given field
+  template <typename Message>
+  std::string jsonMembersWithout(const Message &message,
+                                 const std::string &field) {
+    google::protobuf::FieldMask mask;
+    const auto *descriptor = Message::descriptor();
+    for (int i = 0; i < descriptor->field_count(); ++i) {
+      if (descriptor->field(i)->name() != field) {
+        mask.add_paths(descriptor->field(i)->name());
+      }
+    }
+    Message result;
+    google::protobuf::util::FieldMaskUtil::MergeMessageTo(
+        message, mask, google::protobuf::util::FieldMaskUtil::MergeOptions{},
+        &result);
+    std::string json;
+    google::protobuf::util::MessageToJsonString(result, &json);
+    // strip the enclosing braces
+    return json.size() > 2 ? json.substr(1, json.size() - 2) : std::string{};
+  }
+}  // namespace
+
 namespace iroha {
   namespace main {
 
     using shared_model::converters::protobuf::jsonToProto;
     using shared_model::interface::Block;
 
-    BlockLoader::BlockLoader(logger::LoggerPtr log) : log_(std::move(log)) {}
+    BlockLoader::BlockLoader(logger::LoggerPtr log,
+                             std::shared_ptr<ThreadPool> pool)
+        : log_(std::move(log)), pool_(std::move(pool)) {}
 
     boost::optional<std::shared_ptr<Block>> BlockLoader::parseBlock(
         const std::string &data) {
@@ -29,6 +213,120 @@ namespace iroha {
       };
     }
 
+    boost::optional<std::shared_ptr<Block>> BlockLoader::parseBlock(
+        std::istream &input) {
+      std::vector<iroha::protocol::Transaction> transactions;
+      std::vector<std::string> chunk;
+      bool transactions_valid = true;
+
+      auto convert_chunk = [&] {
+        auto offset = transactions.size();
+        std::vector<char> converted(chunk.size());
+        transactions.resize(offset + chunk.size());
+        forEachIndex(pool_.get(), chunk.size(), [&](size_t i) {
+          converted[i] = google::protobuf::util::JsonStringToMessage(
+                             chunk[i], &transactions[offset + i])
+                             .ok();
+        });
+        transactions_valid = transactions_valid
+            and std::all_of(converted.begin(),
+                            converted.end(),
+                            [](char ok) { return ok; });
+        chunk.clear();
+      };
+
+      BlockJsonSplitter<std::function<void(std::string)>> splitter(
+          [&](std::string transaction) {
+            chunk.push_back(std::move(transaction));
+            if (chunk.size() == kTransactionsPerChunk) {
+              convert_chunk();
+            }
+          });
+
+      std::vector<char> buffer(kReadBufferSize);
+      while (input and transactions_valid) {
+        input.read(buffer.data(), buffer.size());
+        splitter.feed(buffer.data(), static_cast<size_t>(input.gcount()));
+      }
+      convert_chunk();
+
+      if (not transactions_valid or not splitter.valid()) {
+        log_->error("Malformed block JSON");
+        return boost::none;
+      }
+
+      auto block = jsonToProto<iroha::protocol::Block>(splitter.rest());
+      if (not block) {
+        log_->error("Malformed block JSON");
+        return boost::none;
+      }
+
+      auto &payload = *block->mutable_block_v1()->mutable_payload();
+      payload.mutable_transactions()->Reserve(
+          static_cast<int>(transactions.size()));
+      for (auto &transaction : transactions) {
+        *payload.add_transactions() = std::move(transaction);
+      }
+      return boost::optional<std::shared_ptr<Block>>(
+          std::make_shared<shared_model::proto::Block>(
+              std::move(*block->mutable_block_v1())));
+    }
+
+    boost::optional<std::shared_ptr<Block>> BlockLoader::loadBlock(
+        const std::string &path) {
+      std::ifstream file(path);
+      if (not file) {
+        log_->error("Cannot read '" + path + "'");
+        return boost::none;
+      }
+      return parseBlock(file);
+    }
+
+    bool BlockLoader::writeBlock(const Block &block, std::ostream &output) {
+      const auto &proto_block =
+          static_cast<const shared_model::proto::Block &>(block)
+              .getTransport();
+      const auto &payload = proto_block.payload();
+      const auto &transactions = payload.transactions();
+
+      output << R"({"blockV1":{"payload":{"transactions":[)";
+      std::vector<std::string> chunk;
+      for (int begin = 0; begin < transactions.size();
+           begin += static_cast<int>(kTransactionsPerChunk)) {
+        chunk.resize(std::min<size_t>(kTransactionsPerChunk,
+                                      transactions.size() - begin));
+        forEachIndex(pool_.get(), chunk.size(), [&](size_t i) {
+          chunk[i].clear();
+          google::protobuf::util::MessageToJsonString(
+              transactions.Get(begin + static_cast<int>(i)), &chunk[i]);
+        });
+        for (size_t i = 0; i < chunk.size(); ++i) {
+          if (begin != 0 or i != 0) {
+            output << ',';
+          }
+          output << chunk[i];
+        }
+      }
+      output << ']';
+
+      auto payload_rest = jsonMembersWithout(payload, "transactions");
+      if (not payload_rest.empty()) {
+        output << ',' << payload_rest;
+      }
+      output << '}';
+      auto block_rest = jsonMembersWithout(proto_block, "payload");
+      if (not block_rest.empty()) {
+        output << ',' << block_rest;
+      }
+      output << "}}";
+
+      if (not output) {
+        log_->error("Failed to write block");
+        return false;
+      }
+      return true;
+    }
+
     boost::optional<std::string> BlockLoader::loadFile(
         const std::string &path) {
       std::ifstream file(path);
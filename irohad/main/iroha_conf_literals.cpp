@@ -7,8 +7,98 @@
 
 namespace config_members {
   const char *BlockStorePath = "block_store_path";
+  const char *BlockStoreType = "block_store_type";
+  const char *BlockStoreSegmentSize = "block_store_segment_size";
+  const char *BlockStorePreallocate = "block_store_preallocate";
+  const char *BlockStoreDirectIo = "block_store_direct_io";
+  const char *BlockCacheSize = "block_cache_size";
+  const char *BlockStoreAsyncWrite = "block_store_async_write";
+  const char *BlockStoreCompression = "block_store_compression";
+  const char *BlockStoreBinary = "block_store_binary";
+  const char *BlockStoreCompact = "block_store_compact";
+  const char *BlockStoreVerify = "block_store_verify";
+  const char *BlockStoreSync = "block_store_sync";
+  const char *BlockStoreSyncInterval = "block_store_sync_interval";
+  const char *BlockStoreRetainedBlocks = "block_store_retained_blocks";
+  const char *BlockArchivePath = "block_archive_path";
+  const char *WsvRestoreIncremental = "wsv_restore_incremental";
+  const char *WsvRestoreThreads = "wsv_restore_threads";
+  const char *WsvRestoreBulk = "wsv_restore_bulk";
+  const char *ToriiValidationThreads = "torii_validation_threads";
+  const char *CryptoProvider = "crypto_provider";
+  const char *ProposalSelectionPolicy = "proposal_selection_policy";
+  const char *BatchesCoalescingWindow = "batches_coalescing_window_ms";
+  const char *CompactProposals = "compact_proposals";
+  const char *AdaptiveRoundsDelay = "adaptive_rounds_delay";
+  const char *MinRoundsDelay = "min_rounds_delay";
+  const char *OrderingGateCacheSize = "ordering_gate_cache_size_mb";
+  const char *PrefetchProposals = "prefetch_proposals";
+  const char *CompactVotes = "compact_votes";
+  const char *StreamVotes = "stream_votes";
+  const char *VoteBatchWindow = "vote_batch_window_ms";
+  const char *AsyncStatusPublishing = "async_status_publishing";
+  const char *CommitFanout = "commit_fanout";
+  const char *MstSignatureDeltas = "mst_signature_deltas";
+  const char *StatusBusWorkers = "status_bus_workers";
+  const char *ToriiCompletionQueues = "torii_completion_queues";
+  const char *ToriiPollersPerQueue = "torii_pollers_per_queue";
+  const char *StatefulValidationThreads = "stateful_validation_threads";
+  const char *NetworkClientThreads = "network_client_threads";
+  const char *PipelineQueueSize = "pipeline_queue_size";
+  const char *ExecutorThreads = "executor_threads";
+  const char *QueryThreads = "query_threads";
+  const char *MaxQueryJobs = "max_query_jobs";
+  const char *StatusCacheSize = "status_cache_size_mb";
+  const char *ToriiAccountTxRate = "torii_account_tx_rate";
+  const char *ToriiPeerTxRate = "torii_peer_tx_rate";
+  const char *OrderingShards = "ordering_shards";
+  const char *ProposalHedgingPercentile = "proposal_hedging_percentile";
+  const char *Observer = "observer";
+  const char *OrderingPendingSize = "ordering_pending_size_mb";
+  const char *OrderingCreatorSize = "ordering_creator_size_mb";
+  const char *MstStorageSize = "mst_storage_size_mb";
+  const char *MstCreatorSize = "mst_creator_size_mb";
+  const char *MstJournalFile = "mst_journal_file";
+  const char *MstGossipPeriod = "mst_gossip_period_ms";
+  const char *MstGossipPeers = "mst_gossip_peers";
+  const char *CpuAffinity = "cpu_affinity";
+  const char *ConsensusCpus = "consensus";
+  const char *OrderingCpus = "ordering";
+  const char *ToriiCpus = "torii";
+  const char *NetworkClientCpus = "network_client";
+  const char *StatusBusCpus = "status_bus";
+  const char *PeerCompression = "peer_compression";
+  const char *PeerCompressionThreshold = "peer_compression_threshold";
+  const char *PeerChunkSize = "peer_chunk_size_kb";
+  const std::unordered_map<std::string, iroha::network::CompressionAlgorithm>
+      CompressionAlgorithms{
+          {"none", iroha::network::CompressionAlgorithm::kNone},
+          {"deflate", iroha::network::CompressionAlgorithm::kDeflate},
+          {"gzip", iroha::network::CompressionAlgorithm::kGzip}};
+  const std::unordered_map<std::string,
+                           iroha::ordering::ProposalSelectionPolicyType>
+      ProposalSelectionPolicies{
+          {"fifo", iroha::ordering::ProposalSelectionPolicyType::kFifo},
+          {"oldest_first",
+           iroha::ordering::ProposalSelectionPolicyType::kOldestFirst},
+          {"fair_share",
+           iroha::ordering::ProposalSelectionPolicyType::kFairShare}};
+  const std::unordered_map<std::string, iroha::ametsuchi::BlockStoreType>
+      BlockStoreTypes{
+          {"flat_file", iroha::ametsuchi::BlockStoreType::kFlatFile},
+          {"segmented", iroha::ametsuchi::BlockStoreType::kSegmentedLog}};
+  const std::unordered_map<std::string, iroha::ametsuchi::BlockStoreSync>
+      BlockStoreSyncModes{
+          {"none", iroha::ametsuchi::BlockStoreSync::kNone},
+          {"block", iroha::ametsuchi::BlockStoreSync::kEveryBlock},
+          {"group", iroha::ametsuchi::BlockStoreSync::kGroup}};
   const char *ToriiPort = "torii_port";
   const char *InternalPort = "internal_port";
+  const char *MetricsPort = "metrics_port";
+  const char *TxTraceSampleInterval = "tx_trace_sample_interval";
+  const char *SlowStatementThreshold = "slow_statement_threshold_ms";
+  const char *TxTraceFile = "tx_trace_file";
+  const char *ToriiCaptureFile = "torii_capture_file";
   const char *KeyPairPath = "key_pair_path";
   const char *PgOpt = "pg_opt";
   const char *DbConfig = "database";
@@ -18,6 +108,13 @@ namespace config_members {
   const char *Password = "password";
   const char *WorkingDbName = "working database";
   const char *MaintenanceDbName = "maintenance database";
+  const char *DbReplicas = "replicas";
+  const char *DbCommitConnections = "commit connections";
+  const char *DbValidationConnections = "validation connections";
+  const char *DbQueryTimeout = "query timeout";
+  const char *DbAsyncValidationCommit = "async validation commit";
+  const char *TemplateDbName = "template database";
+  const char *DbLazyStatementPreparation = "lazy statement preparation";
   const char *MaxProposalSize = "max_proposal_size";
   const char *ProposalDelay = "proposal_delay";
   const char *VoteDelay = "vote_delay";
@@ -29,6 +126,13 @@ namespace config_members {
   const char *LogLevel = "level";
   const char *LogPatternsSection = "patterns";
   const char *LogChildrenSection = "children";
+  const char *LogAsyncSection = "async";
+  const char *LogQueueSize = "queue_size";
+  const char *LogOverflowPolicy = "overflow_policy";
+  const std::unordered_map<std::string, logger::LogOverflowPolicy>
+      LogOverflowPolicies{
+          {"block", logger::LogOverflowPolicy::kBlock},
+          {"drop_oldest", logger::LogOverflowPolicy::kDropOldest}};
   const std::unordered_map<std::string, logger::LogLevel> LogLevels{
       {"trace", logger::LogLevel::kTrace},
       {"debug", logger::LogLevel::kDebug},
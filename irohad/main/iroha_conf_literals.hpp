@@ -9,12 +9,93 @@
 #include <string>
 #include <unordered_map>
 
-#include "logger/logger.hpp"
+#include "ametsuchi/impl/block_store_options.hpp"
+#include "logger/logger_spdlog.hpp"
+#include "network/peer_compression.hpp"
+#include "ordering/proposal_selection_policy.hpp"
 
 namespace config_members {
   extern const char *BlockStorePath;
+  extern const char *BlockStoreType;
+  extern const char *BlockStoreSegmentSize;
+  extern const char *BlockStorePreallocate;
+  extern const char *BlockStoreDirectIo;
+  extern const char *BlockCacheSize;
+  extern const char *BlockStoreAsyncWrite;
+  extern const char *BlockStoreCompression;
+  extern const char *BlockStoreBinary;
+  extern const char *BlockStoreCompact;
+  extern const char *BlockStoreVerify;
+  extern const char *BlockStoreSync;
+  extern const char *BlockStoreSyncInterval;
+  extern const char *BlockStoreRetainedBlocks;
+  extern const char *BlockArchivePath;
+  extern const char *WsvRestoreIncremental;
+  extern const char *WsvRestoreThreads;
+  extern const char *WsvRestoreBulk;
+  extern const char *ToriiValidationThreads;
+  extern const char *CryptoProvider;
+  extern const char *ProposalSelectionPolicy;
+  extern const char *BatchesCoalescingWindow;
+  extern const char *CompactProposals;
+  extern const char *AdaptiveRoundsDelay;
+  extern const char *MinRoundsDelay;
+  extern const char *OrderingGateCacheSize;
+  extern const char *PrefetchProposals;
+  extern const char *CompactVotes;
+  extern const char *StreamVotes;
+  extern const char *VoteBatchWindow;
+  extern const char *AsyncStatusPublishing;
+  extern const char *CommitFanout;
+  extern const char *MstSignatureDeltas;
+  extern const char *StatusBusWorkers;
+  extern const char *ToriiCompletionQueues;
+  extern const char *ToriiPollersPerQueue;
+  extern const char *StatefulValidationThreads;
+  extern const char *NetworkClientThreads;
+  extern const char *PipelineQueueSize;
+  extern const char *ExecutorThreads;
+  extern const char *QueryThreads;
+  extern const char *MaxQueryJobs;
+  extern const char *StatusCacheSize;
+  extern const char *ToriiAccountTxRate;
+  extern const char *ToriiPeerTxRate;
+  extern const char *OrderingShards;
+  extern const char *ProposalHedgingPercentile;
+  extern const char *Observer;
+  extern const char *OrderingPendingSize;
+  extern const char *OrderingCreatorSize;
+  extern const char *MstStorageSize;
+  extern const char *MstCreatorSize;
+  extern const char *MstJournalFile;
+  extern const char *MstGossipPeriod;
+  extern const char *MstGossipPeers;
+  extern const char *CpuAffinity;
+  extern const char *ConsensusCpus;
+  extern const char *OrderingCpus;
+  extern const char *ToriiCpus;
+  extern const char *NetworkClientCpus;
+  extern const char *StatusBusCpus;
+  extern const char *PeerCompression;
+  extern const char *PeerCompressionThreshold;
+  extern const char *PeerChunkSize;
+  extern const std::unordered_map<std::string,
+                                  iroha::network::CompressionAlgorithm>
+      CompressionAlgorithms;
+  extern const std::unordered_map<std::string,
+                                  iroha::ordering::ProposalSelectionPolicyType>
+      ProposalSelectionPolicies;
+  extern const std::unordered_map<std::string, iroha::ametsuchi::BlockStoreType>
+      BlockStoreTypes;
+  extern const std::unordered_map<std::string, iroha::ametsuchi::BlockStoreSync>
+      BlockStoreSyncModes;
   extern const char *ToriiPort;
   extern const char *InternalPort;
+  extern const char *MetricsPort;
+  extern const char *TxTraceSampleInterval;
+  extern const char *SlowStatementThreshold;
+  extern const char *TxTraceFile;
+  extern const char *ToriiCaptureFile;
   extern const char *KeyPairPath;
   extern const char *PgOpt;
   extern const char *DbConfig;
@@ -24,6 +105,13 @@ namespace config_members {
   extern const char *Password;
   extern const char *WorkingDbName;
   extern const char *MaintenanceDbName;
+  extern const char *DbReplicas;
+  extern const char *DbCommitConnections;
+  extern const char *DbValidationConnections;
+  extern const char *DbQueryTimeout;
+  extern const char *DbAsyncValidationCommit;
+  extern const char *TemplateDbName;
+  extern const char *DbLazyStatementPreparation;
   extern const char *MaxProposalSize;
   extern const char *ProposalDelay;
   extern const char *VoteDelay;
@@ -35,6 +123,11 @@ namespace config_members {
   extern const char *LogLevel;
   extern const char *LogPatternsSection;
   extern const char *LogChildrenSection;
+  extern const char *LogAsyncSection;
+  extern const char *LogQueueSize;
+  extern const char *LogOverflowPolicy;
+  extern const std::unordered_map<std::string, logger::LogOverflowPolicy>
+      LogOverflowPolicies;
   extern const std::unordered_map<std::string, logger::LogLevel> LogLevels;
   extern const char *InitialPeers;
   extern const char *Address;
@@ -292,6 +292,115 @@ inline void JsonDeserializerImpl::getVal<logger::LogLevel>(
   dest = it->second;
 }
 
+template <>
+inline void JsonDeserializerImpl::getVal<iroha::ametsuchi::BlockStoreType>(
+    const std::string &path,
+    iroha::ametsuchi::BlockStoreType &dest,
+    const rapidjson::Value &src) {
+  std::string type_str;
+  getVal(path, type_str, src);
+  const auto it = config_members::BlockStoreTypes.find(type_str);
+  if (it == config_members::BlockStoreTypes.end()) {
+    BOOST_THROW_EXCEPTION(std::runtime_error(
+        "Wrong block store type at " + path + ": must be one of '"
+        + boost::algorithm::join(
+              config_members::BlockStoreTypes | boost::adaptors::map_keys,
+              "', '")
+        + "'."));
+  }
+  dest = it->second;
+}
+
+template <>
+inline void JsonDeserializerImpl::getVal<iroha::ametsuchi::BlockStoreSync>(
+    const std::string &path,
+    iroha::ametsuchi::BlockStoreSync &dest,
+    const rapidjson::Value &src) {
+  std::string mode_str;
+  getVal(path, mode_str, src);
+  const auto it = config_members::BlockStoreSyncModes.find(mode_str);
+  if (it == config_members::BlockStoreSyncModes.end()) {
+    BOOST_THROW_EXCEPTION(std::runtime_error(
+        "Wrong block store sync mode at " + path + ": must be one of '"
+        + boost::algorithm::join(
+              config_members::BlockStoreSyncModes | boost::adaptors::map_keys,
+              "', '")
+        + "'."));
+  }
+  dest = it->second;
+}
+
+template <>
+inline void JsonDeserializerImpl::getVal<iroha::network::CompressionAlgorithm>(
+    const std::string &path,
+    iroha::network::CompressionAlgorithm &dest,
+    const rapidjson::Value &src) {
+  std::string algorithm_str;
+  getVal(path, algorithm_str, src);
+  const auto it = config_members::CompressionAlgorithms.find(algorithm_str);
+  if (it == config_members::CompressionAlgorithms.end()) {
+    BOOST_THROW_EXCEPTION(std::runtime_error(
+        "Wrong compression algorithm at " + path + ": must be one of '"
+        + boost::algorithm::join(
+              config_members::CompressionAlgorithms | boost::adaptors::map_keys,
+              "', '")
+        + "'."));
+  }
+  dest = it->second;
+}
+
+template <>
+inline void
+JsonDeserializerImpl::getVal<iroha::ordering::ProposalSelectionPolicyType>(
+    const std::string &path,
+    iroha::ordering::ProposalSelectionPolicyType &dest,
+    const rapidjson::Value &src) {
+  std::string policy_str;
+  getVal(path, policy_str, src);
+  const auto it = config_members::ProposalSelectionPolicies.find(policy_str);
+  if (it == config_members::ProposalSelectionPolicies.end()) {
+    BOOST_THROW_EXCEPTION(std::runtime_error(
+        "Wrong proposal selection policy at " + path + ": must be one of '"
+        + boost::algorithm::join(config_members::ProposalSelectionPolicies
+                                     | boost::adaptors::map_keys,
+                                 "', '")
+        + "'."));
+  }
+  dest = it->second;
+}
+
+template <>
+inline void JsonDeserializerImpl::getVal<logger::LogOverflowPolicy>(
+    const std::string &path,
+    logger::LogOverflowPolicy &dest,
+    const rapidjson::Value &src) {
+  std::string policy_str;
+  getVal(path, policy_str, src);
+  const auto it = config_members::LogOverflowPolicies.find(policy_str);
+  if (it == config_members::LogOverflowPolicies.end()) {
+    BOOST_THROW_EXCEPTION(std::runtime_error(
+        "Wrong log overflow policy at " + path + ": must be one of '"
+        + boost::algorithm::join(
+              config_members::LogOverflowPolicies | boost::adaptors::map_keys,
+              "', '")
+        + "'."));
+  }
+  dest = it->second;
+}
+
+template <>
+inline void JsonDeserializerImpl::getVal<logger::AsyncLogConfig>(
+    const std::string &path,
+    logger::AsyncLogConfig &dest,
+    const rapidjson::Value &src) {
+  assert_fatal(src.IsObject(), path + " must be an object");
+  const auto obj = src.GetObject();
+  getValByKey(path, dest.queue_size, obj, config_members::LogQueueSize);
+  assert_fatal(dest.queue_size > 0, path + " queue size must be positive");
+  getValByKey(
+      path, dest.overflow_policy, obj, config_members::LogOverflowPolicy);
+}
+
 template <>
 inline void JsonDeserializerImpl::getVal<logger::LogPatterns>(
     const std::string &path,
@@ -318,6 +427,8 @@ JsonDeserializerImpl::getVal<std::unique_ptr<logger::LoggerManagerTree>>(
   logger::LoggerConfig root_config{logger::kDefaultLogLevel,
                                    logger::LogPatterns{}};
   updateLoggerConfig(path, root_config, src.GetObject());
+  tryGetValByKey(
+      path, root_config.async, src.GetObject(), config_members::LogAsyncSection);
   dest = std::make_unique<logger::LoggerManagerTree>(
       std::make_shared<const logger::LoggerConfig>(std::move(root_config)));
   addChildrenLoggerConfigs(path, *dest, src.GetObject());
@@ -347,6 +458,41 @@ JsonDeserializerImpl::getVal<std::unique_ptr<shared_model::interface::Peer>>(
              });
 }
 
+template <>
+inline void
+JsonDeserializerImpl::getVal<iroha::ametsuchi::PostgresOptions::Replica>(
+    const std::string &path,
+    iroha::ametsuchi::PostgresOptions::Replica &dest,
+    const rapidjson::Value &src) {
+  assert_fatal(src.IsObject(), path + " must be a dictionary");
+  const auto obj = src.GetObject();
+  getValByKey(path, dest.host, obj, config_members::Host);
+  getValByKey(path, dest.port, obj, config_members::Port);
+}
+
+template <>
+inline void JsonDeserializerImpl::getVal<iroha::ThreadAffinity>(
+    const std::string &path,
+    iroha::ThreadAffinity &dest,
+    const rapidjson::Value &src) {
+  assert_fatal(src.IsObject(), path + " must be a dictionary");
+  const auto obj = src.GetObject();
+  auto get_cpus = [&](iroha::CpuSet &cpus, const char *key) {
+    if (auto list = getOptValByKey<std::string>(path, obj, key)) {
+      auto parsed = iroha::parseCpuSet(*list);
+      assert_fatal(static_cast<bool>(parsed),
+                   sublevelPath(path, key)
+                       + " must be a list of CPUs like \"0-3,8\"");
+      cpus = std::move(*parsed);
+    }
+  };
+  get_cpus(dest.consensus, config_members::ConsensusCpus);
+  get_cpus(dest.ordering, config_members::OrderingCpus);
+  get_cpus(dest.torii, config_members::ToriiCpus);
+  get_cpus(dest.network_client, config_members::NetworkClientCpus);
+  get_cpus(dest.status_bus, config_members::StatusBusCpus);
+}
+
 template <>
 inline void JsonDeserializerImpl::getVal<IrohadConfig::DbConfig>(
     const std::string &path,
@@ -362,6 +508,25 @@ inline void JsonDeserializerImpl::getVal<IrohadConfig::DbConfig>(
   getValByKey(path, dest.working_dbname, obj, config_members::WorkingDbName);
   getValByKey(
       path, dest.maintenance_dbname, obj, config_members::MaintenanceDbName);
+  getValByKey(path, dest.replicas, obj, config_members::DbReplicas);
+  getValByKey(
+      path, dest.commit_connections, obj, config_members::DbCommitConnections);
+  getValByKey(path,
+              dest.validation_connections,
+              obj,
+              config_members::DbValidationConnections);
+  getValByKey(
+      path, dest.query_timeout_ms, obj, config_members::DbQueryTimeout);
+  getValByKey(path,
+              dest.async_validation_commit,
+              obj,
+              config_members::DbAsyncValidationCommit);
+  getValByKey(
+      path, dest.template_dbname, obj, config_members::TemplateDbName);
+  getValByKey(path,
+              dest.lazy_statement_preparation,
+              obj,
+              config_members::DbLazyStatementPreparation);
 }
 
 template <>
@@ -371,8 +536,174 @@ inline void JsonDeserializerImpl::getVal<IrohadConfig>(
                path + " Irohad config top element must be an object.");
   const auto obj = src.GetObject();
   getValByKey(path, dest.block_store_path, obj, config_members::BlockStorePath);
+  getValByKey(path, dest.block_store_type, obj, config_members::BlockStoreType);
+  getValByKey(path,
+              dest.block_store_segment_size,
+              obj,
+              config_members::BlockStoreSegmentSize);
+  getValByKey(path,
+              dest.block_store_preallocate,
+              obj,
+              config_members::BlockStorePreallocate);
+  getValByKey(path,
+              dest.block_store_direct_io,
+              obj,
+              config_members::BlockStoreDirectIo);
+  getValByKey(path, dest.block_cache_size, obj, config_members::BlockCacheSize);
+  getValByKey(path,
+              dest.block_store_async_write,
+              obj,
+              config_members::BlockStoreAsyncWrite);
+  getValByKey(path,
+              dest.block_store_compression,
+              obj,
+              config_members::BlockStoreCompression);
+  getValByKey(
+      path, dest.block_store_binary, obj, config_members::BlockStoreBinary);
+  getValByKey(
+      path, dest.block_store_compact, obj, config_members::BlockStoreCompact);
+  getValByKey(
+      path, dest.block_store_verify, obj, config_members::BlockStoreVerify);
+  getValByKey(path, dest.block_store_sync, obj, config_members::BlockStoreSync);
+  getValByKey(path,
+              dest.block_store_sync_interval,
+              obj,
+              config_members::BlockStoreSyncInterval);
+  getValByKey(path,
+              dest.block_store_retained_blocks,
+              obj,
+              config_members::BlockStoreRetainedBlocks);
+  getValByKey(
+      path, dest.block_archive_path, obj, config_members::BlockArchivePath);
+  getValByKey(path,
+              dest.wsv_restore_incremental,
+              obj,
+              config_members::WsvRestoreIncremental);
+  getValByKey(
+      path, dest.wsv_restore_threads, obj, config_members::WsvRestoreThreads);
+  getValByKey(path, dest.wsv_restore_bulk, obj, config_members::WsvRestoreBulk);
+  getValByKey(path,
+              dest.torii_validation_threads,
+              obj,
+              config_members::ToriiValidationThreads);
+  getValByKey(path, dest.crypto_provider, obj, config_members::CryptoProvider);
+  getValByKey(path,
+              dest.proposal_selection_policy,
+              obj,
+              config_members::ProposalSelectionPolicy);
+  getValByKey(path,
+              dest.batches_coalescing_window_ms,
+              obj,
+              config_members::BatchesCoalescingWindow);
+  getValByKey(
+      path, dest.compact_proposals, obj, config_members::CompactProposals);
+  getValByKey(path,
+              dest.adaptive_round_delay,
+              obj,
+              config_members::AdaptiveRoundsDelay);
+  getValByKey(
+      path, dest.min_round_delay_ms, obj, config_members::MinRoundsDelay);
+  getValByKey(path,
+              dest.ordering_gate_cache_size_mb,
+              obj,
+              config_members::OrderingGateCacheSize);
+  getValByKey(
+      path, dest.prefetch_proposals, obj, config_members::PrefetchProposals);
+  getValByKey(path, dest.compact_votes, obj, config_members::CompactVotes);
+  getValByKey(path, dest.stream_votes, obj, config_members::StreamVotes);
+  getValByKey(
+      path, dest.vote_batch_window_ms, obj, config_members::VoteBatchWindow);
+  getValByKey(path,
+              dest.async_status_publishing,
+              obj,
+              config_members::AsyncStatusPublishing);
+  getValByKey(path, dest.commit_fanout, obj, config_members::CommitFanout);
+  getValByKey(path,
+              dest.mst_signature_deltas,
+              obj,
+              config_members::MstSignatureDeltas);
+  getValByKey(
+      path, dest.status_bus_workers, obj, config_members::StatusBusWorkers);
+  getValByKey(path,
+              dest.torii_completion_queues,
+              obj,
+              config_members::ToriiCompletionQueues);
+  getValByKey(path,
+              dest.torii_pollers_per_queue,
+              obj,
+              config_members::ToriiPollersPerQueue);
+  getValByKey(path,
+              dest.stateful_validation_threads,
+              obj,
+              config_members::StatefulValidationThreads);
+  getValByKey(path,
+              dest.network_client_threads,
+              obj,
+              config_members::NetworkClientThreads);
+  getValByKey(path,
+              dest.pipeline_queue_size,
+              obj,
+              config_members::PipelineQueueSize);
+  getValByKey(
+      path, dest.executor_threads, obj, config_members::ExecutorThreads);
+  getValByKey(path, dest.query_threads, obj, config_members::QueryThreads);
+  getValByKey(path, dest.max_query_jobs, obj, config_members::MaxQueryJobs);
+  getValByKey(
+      path, dest.status_cache_size_mb, obj, config_members::StatusCacheSize);
+  getValByKey(path,
+              dest.torii_account_tx_rate,
+              obj,
+              config_members::ToriiAccountTxRate);
+  getValByKey(
+      path, dest.torii_peer_tx_rate, obj, config_members::ToriiPeerTxRate);
+  getValByKey(
+      path, dest.ordering_shards, obj, config_members::OrderingShards);
+  getValByKey(path,
+              dest.proposal_hedging_percentile,
+              obj,
+              config_members::ProposalHedgingPercentile);
+  getValByKey(path, dest.observer, obj, config_members::Observer);
+  getValByKey(path,
+              dest.ordering_pending_size_mb,
+              obj,
+              config_members::OrderingPendingSize);
+  getValByKey(path,
+              dest.ordering_creator_size_mb,
+              obj,
+              config_members::OrderingCreatorSize);
+  getValByKey(
+      path, dest.mst_storage_size_mb, obj, config_members::MstStorageSize);
+  getValByKey(
+      path, dest.mst_creator_size_mb, obj, config_members::MstCreatorSize);
+  getValByKey(
+      path, dest.mst_journal_file, obj, config_members::MstJournalFile);
+  getValByKey(
+      path, dest.mst_gossip_period_ms, obj, config_members::MstGossipPeriod);
+  getValByKey(
+      path, dest.mst_gossip_peers, obj, config_members::MstGossipPeers);
+  getValByKey(path, dest.cpu_affinity, obj, config_members::CpuAffinity);
+  getValByKey(
+      path, dest.peer_compression, obj, config_members::PeerCompression);
+  getValByKey(path,
+              dest.peer_compression_threshold,
+              obj,
+              config_members::PeerCompressionThreshold);
+  getValByKey(
+      path, dest.peer_chunk_size_kb, obj, config_members::PeerChunkSize);
   getValByKey(path, dest.torii_port, obj, config_members::ToriiPort);
   getValByKey(path, dest.internal_port, obj, config_members::InternalPort);
+  getValByKey(path, dest.metrics_port, obj, config_members::MetricsPort);
+  getValByKey(path,
+              dest.tx_trace_sample_interval,
+              obj,
+              config_members::TxTraceSampleInterval);
+  getValByKey(path,
+              dest.slow_statement_threshold_ms,
+              obj,
+              config_members::SlowStatementThreshold);
+  getValByKey(path, dest.tx_trace_file, obj, config_members::TxTraceFile);
+  getValByKey(
+      path, dest.torii_capture_file, obj, config_members::ToriiCaptureFile);
   getValByKey(path, dest.pg_opt, obj, config_members::PgOpt);
   getValByKey(path, dest.database_config, obj, config_members::DbConfig);
   getValByKey(
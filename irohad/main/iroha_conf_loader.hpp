@@ -9,9 +9,14 @@
 #include <string>
 #include <unordered_map>
 
+#include "ametsuchi/impl/block_store_options.hpp"
+#include "ametsuchi/impl/postgres_options.hpp"
+#include "common/thread_affinity.hpp"
 #include "interfaces/common_objects/common_objects_factory.hpp"
 #include "interfaces/common_objects/types.hpp"
 #include "logger/logger_manager.hpp"
+#include "network/peer_compression.hpp"
+#include "ordering/proposal_selection_policy.hpp"
 
 struct IrohadConfig {
   struct DbConfig {
@@ -21,11 +26,83 @@ struct IrohadConfig {
     std::string password;
     std::string working_dbname;
     std::string maintenance_dbname;
+    boost::optional<std::vector<iroha::ametsuchi::PostgresOptions::Replica>>
+        replicas;
+    boost::optional<uint32_t> commit_connections;
+    boost::optional<uint32_t> validation_connections;
+    boost::optional<uint32_t> query_timeout_ms;
+    boost::optional<bool> async_validation_commit;
+    boost::optional<std::string> template_dbname;
+    boost::optional<bool> lazy_statement_preparation;
   };
 
   std::string block_store_path;
+  boost::optional<iroha::ametsuchi::BlockStoreType> block_store_type;
+  boost::optional<uint32_t> block_store_segment_size;
+  boost::optional<bool> block_store_preallocate;
+  boost::optional<bool> block_store_direct_io;
+  boost::optional<uint32_t> block_cache_size;
+  boost::optional<bool> block_store_async_write;
+  boost::optional<bool> block_store_compression;
+  boost::optional<bool> block_store_binary;
+  boost::optional<bool> block_store_compact;
+  boost::optional<bool> block_store_verify;
+  boost::optional<iroha::ametsuchi::BlockStoreSync> block_store_sync;
+  boost::optional<uint32_t> block_store_sync_interval;
+  boost::optional<uint32_t> block_store_retained_blocks;
+  boost::optional<std::string> block_archive_path;
+  boost::optional<bool> wsv_restore_incremental;
+  boost::optional<uint32_t> wsv_restore_threads;
+  boost::optional<bool> wsv_restore_bulk;
+  boost::optional<uint32_t> torii_validation_threads;
+  boost::optional<std::string> crypto_provider;
+  boost::optional<iroha::ordering::ProposalSelectionPolicyType>
+      proposal_selection_policy;
+  boost::optional<uint32_t> batches_coalescing_window_ms;
+  boost::optional<bool> compact_proposals;
+  boost::optional<bool> adaptive_round_delay;
+  boost::optional<uint32_t> min_round_delay_ms;
+  boost::optional<uint32_t> ordering_gate_cache_size_mb;
+  boost::optional<bool> prefetch_proposals;
+  boost::optional<bool> compact_votes;
+  boost::optional<bool> stream_votes;
+  boost::optional<uint32_t> vote_batch_window_ms;
+  boost::optional<bool> async_status_publishing;
+  boost::optional<uint32_t> commit_fanout;
+  boost::optional<bool> mst_signature_deltas;
+  boost::optional<uint32_t> status_bus_workers;
+  boost::optional<uint32_t> torii_completion_queues;
+  boost::optional<uint32_t> torii_pollers_per_queue;
+  boost::optional<uint32_t> stateful_validation_threads;
+  boost::optional<uint32_t> network_client_threads;
+  boost::optional<uint32_t> pipeline_queue_size;
+  boost::optional<uint32_t> executor_threads;
+  boost::optional<uint32_t> query_threads;
+  boost::optional<uint32_t> max_query_jobs;
+  boost::optional<uint32_t> status_cache_size_mb;
+  boost::optional<uint32_t> torii_account_tx_rate;
+  boost::optional<uint32_t> torii_peer_tx_rate;
+  boost::optional<uint32_t> ordering_shards;
+  boost::optional<uint32_t> proposal_hedging_percentile;
+  boost::optional<bool> observer;
+  boost::optional<uint32_t> ordering_pending_size_mb;
+  boost::optional<uint32_t> ordering_creator_size_mb;
+  boost::optional<uint32_t> mst_storage_size_mb;
+  boost::optional<uint32_t> mst_creator_size_mb;
+  boost::optional<std::string> mst_journal_file;
+  boost::optional<uint32_t> mst_gossip_period_ms;
+  boost::optional<uint32_t> mst_gossip_peers;
+  boost::optional<iroha::ThreadAffinity> cpu_affinity;
+  boost::optional<iroha::network::CompressionAlgorithm> peer_compression;
+  boost::optional<uint32_t> peer_compression_threshold;
+  boost::optional<uint32_t> peer_chunk_size_kb;
   uint16_t torii_port;
   uint16_t internal_port;
+  boost::optional<uint16_t> metrics_port;
+  boost::optional<uint32_t> tx_trace_sample_interval;
+  boost::optional<uint32_t> slow_statement_threshold_ms;
+  boost::optional<std::string> tx_trace_file;
+  boost::optional<std::string> torii_capture_file;
   boost::optional<std::string>
       pg_opt;  // TODO 2019.06.26 mboldyrev IR-556 remove
   boost::optional<DbConfig>
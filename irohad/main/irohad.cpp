@@ -3,32 +3,55 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <algorithm>
+#include <atomic>
 #include <csignal>
 #include <fstream>
+#include <future>
+#include <limits>
 #include <thread>
 
+#include <boost/algorithm/string/join.hpp>
+#include <boost/algorithm/string/split.hpp>
 #include <gflags/gflags.h>
 #include <grpc++/grpc++.h>
+#include "ametsuchi/impl/soci_utils.hpp"
 #include "ametsuchi/storage.hpp"
 #include "backend/protobuf/common_objects/proto_common_objects_factory.hpp"
+#include "backend/protobuf/proto_block_factory.hpp"
 #include "common/bind.hpp"
 #include "common/irohad_version.hpp"
 #include "common/result.hpp"
+#include "common/thread_pool.hpp"
 #include "crypto/keys_manager_impl.hpp"
+#include "cryptography/crypto_provider/crypto_provider_registry.hpp"
 #include "logger/logger.hpp"
 #include "logger/logger_manager.hpp"
 #include "main/application.hpp"
+#include "main/chain_archive.hpp"
 #include "main/impl/pg_connection_init.hpp"
 #include "main/iroha_conf_literals.hpp"
 #include "main/iroha_conf_loader.hpp"
 #include "main/raw_block_loader.hpp"
+#include "metrics/memory_accounting.hpp"
+#include "metrics/metrics.hpp"
+#include "metrics/metrics_server.hpp"
+#include "network/peer_chunking.hpp"
+#include "network/peer_compression.hpp"
+#include "tracing/transaction_tracer.hpp"
+#include "validators/default_validator.hpp"
 #include "validators/field_validator.hpp"
+#include "validators/protobuf/proto_block_validator.hpp"
 
 static const std::string kListenIp = "0.0.0.0";
 static const std::string kLogSettingsFromConfigFile = "config_file";
 static const uint32_t kMstExpirationTimeDefault = 1440;
 static const uint32_t kMaxRoundsDelayDefault = 3000;
 static const uint32_t kStaleStreamMaxRoundsDefault = 2;
+static const uint32_t kToriiValidationThreadsDefault = 0;
+static const uint32_t kBatchesCoalescingWindowDefault = 0;
+static const uint32_t kMinRoundDelayDefault = 0;
+static const uint32_t kOrderingGateCacheSizeDefault = 256;
 static const std::string kDefaultWorkingDatabaseName{"iroha_default"};
 
 /**
@@ -83,6 +106,30 @@ DEFINE_validator(keypair_name, &validate_keypair_name);
  */
 DEFINE_bool(overwrite_ledger, false, "Overwrite ledger data if existing");
 
+/**
+ * Creating input argument for the peer to bootstrap WSV from
+ */
+DEFINE_string(snapshot_peer,
+              "",
+              "Specify comma separated addresses of the peers to load WSV "
+              "snapshot from when blockstore is empty: the snapshot is loaded "
+              "from the first one and verified by the others");
+
+/**
+ * Creating input argument for the archive to export the ledger blocks to
+ */
+DEFINE_string(export_chain,
+              "",
+              "Export blocks of the ledger to the specified archive and exit");
+
+/**
+ * Creating input argument for the archive to import the ledger blocks from
+ */
+DEFINE_string(import_chain,
+              "",
+              "Replace the ledger with blocks imported from the specified "
+              "archive");
+
 static bool validateVerbosity(const char *flagname, const std::string &val) {
   if (val == kLogSettingsFromConfigFile) {
     return true;
@@ -105,12 +152,33 @@ DEFINE_string(verbosity, kLogSettingsFromConfigFile, "Log verbosity");
 DEFINE_validator(verbosity, &validateVerbosity);
 
 std::promise<void> exit_requested;
+std::atomic<bool> reload_requested{false};
 
 logger::LoggerManagerTreePtr getDefaultLogManager() {
   return std::make_shared<logger::LoggerManagerTree>(logger::LoggerConfig{
       logger::LogLevel::kInfo, logger::getDefaultLogPatterns()});
 }
 
+iroha::GossipPropagationStrategyParams getMstGossipParams(
+    const IrohadConfig &config) {
+  iroha::GossipPropagationStrategyParams params;
+  if (config.mst_gossip_period_ms) {
+    params.emission_period =
+        std::chrono::milliseconds(*config.mst_gossip_period_ms);
+  }
+  params.amount_per_once =
+      config.mst_gossip_peers.value_or(params.amount_per_once);
+  return params;
+}
+
+/// @return addresses of the peers given in the snapshot_peer flag
+std::vector<shared_model::interface::types::AddressType> snapshotPeers() {
+  std::vector<shared_model::interface::types::AddressType> peers;
+  boost::split(peers, FLAGS_snapshot_peer, [](char c) { return c == ','; });
+  peers.erase(std::remove(peers.begin(), peers.end(), ""), peers.end());
+  return peers;
+}
+
 std::shared_ptr<shared_model::interface::CommonObjectsFactory>
 getCommonObjectsFactory() {
   auto validators_config =
@@ -155,6 +223,7 @@ int main(int argc, char *argv[]) {
     log = log_manager->getChild("Init")->getLogger();
   }
   log->info("Irohad version: {}", iroha::kGitPrettyVersion);
+  log->info("Memory allocator: {}", iroha::metrics::allocatorName());
   log->info("config initialized");
 
   if (config.initial_peers and config.initial_peers->empty()) {
@@ -165,6 +234,19 @@ int main(int argc, char *argv[]) {
     return EXIT_FAILURE;
   }
 
+  if (config.crypto_provider
+      and not shared_model::crypto::CryptoProviderRegistry::select(
+              *config.crypto_provider)) {
+    log->critical("Unknown crypto provider '{}', available providers: {}",
+                  *config.crypto_provider,
+                  boost::algorithm::join(
+                      shared_model::crypto::CryptoProviderRegistry::names(),
+                      ", "));
+    return EXIT_FAILURE;
+  }
+  log->info("using crypto provider {}",
+            shared_model::crypto::CryptoProviderRegistry::selectedName());
+
   // Reading public and private key files
   iroha::KeysManagerImpl keysManager(
       FLAGS_keypair_name, log_manager->getChild("KeysManager")->getLogger());
@@ -178,6 +260,15 @@ int main(int argc, char *argv[]) {
 
   std::unique_ptr<iroha::ametsuchi::PostgresOptions> pg_opt;
   if (config.database_config) {
+    iroha::ametsuchi::PostgresOptions::PoolReservation pool_reservation;
+    pool_reservation.commit =
+        config.database_config->commit_connections.value_or(
+            pool_reservation.commit);
+    pool_reservation.validation =
+        config.database_config->validation_connections.value_or(
+            pool_reservation.validation);
+    pool_reservation.query_timeout = std::chrono::milliseconds(
+        config.database_config->query_timeout_ms.value_or(0));
     pg_opt = std::make_unique<iroha::ametsuchi::PostgresOptions>(
         config.database_config->host,
         config.database_config->port,
@@ -185,7 +276,13 @@ int main(int argc, char *argv[]) {
         config.database_config->password,
         config.database_config->working_dbname,
         config.database_config->maintenance_dbname,
-        log);
+        log,
+        config.database_config->replicas.value_or(
+            std::vector<iroha::ametsuchi::PostgresOptions::Replica>{}),
+        pool_reservation,
+        config.database_config->async_validation_commit.value_or(false),
+        config.database_config->template_dbname,
+        config.database_config->lazy_statement_preparation.value_or(false));
   } else if (config.pg_opt) {
     log->warn("Using deprecated database connection string!");
     pg_opt = std::make_unique<iroha::ametsuchi::PostgresOptions>(
@@ -195,6 +292,178 @@ int main(int argc, char *argv[]) {
     return EXIT_FAILURE;
   }
 
+  iroha::ametsuchi::BlockStoreOptions block_store_options;
+  block_store_options.type =
+      config.block_store_type.value_or(block_store_options.type);
+  block_store_options.segment_size =
+      config.block_store_segment_size.value_or(
+          block_store_options.segment_size);
+  block_store_options.preallocate_segments =
+      config.block_store_preallocate.value_or(
+          block_store_options.preallocate_segments);
+  block_store_options.direct_io =
+      config.block_store_direct_io.value_or(block_store_options.direct_io);
+  block_store_options.block_cache_size = config.block_cache_size.value_or(
+      block_store_options.block_cache_size);
+  block_store_options.async_write = config.block_store_async_write.value_or(
+      block_store_options.async_write);
+  block_store_options.compression = config.block_store_compression.value_or(
+      block_store_options.compression);
+  block_store_options.binary_format = config.block_store_binary.value_or(
+      block_store_options.binary_format);
+  block_store_options.compact_format = config.block_store_compact.value_or(
+      block_store_options.compact_format);
+  block_store_options.verify_on_startup = config.block_store_verify.value_or(
+      block_store_options.verify_on_startup);
+  block_store_options.sync =
+      config.block_store_sync.value_or(block_store_options.sync);
+  if (config.block_store_sync_interval) {
+    block_store_options.sync_interval =
+        std::chrono::milliseconds(*config.block_store_sync_interval);
+  }
+  block_store_options.retained_blocks =
+      config.block_store_retained_blocks.value_or(
+          block_store_options.retained_blocks);
+  block_store_options.archive_path =
+      config.block_archive_path.value_or(block_store_options.archive_path);
+  if (block_store_options.retained_blocks != 0
+      and block_store_options.archive_path.empty()) {
+    log->critical("{} requires {}",
+                  config_members::BlockStoreRetainedBlocks,
+                  config_members::BlockArchivePath);
+    return EXIT_FAILURE;
+  }
+
+  iroha::ametsuchi::WsvRestoreOptions wsv_restore_options;
+  wsv_restore_options.incremental = config.wsv_restore_incremental.value_or(
+      wsv_restore_options.incremental);
+  wsv_restore_options.validation_threads = config.wsv_restore_threads.value_or(
+      wsv_restore_options.validation_threads);
+  wsv_restore_options.bulk =
+      config.wsv_restore_bulk.value_or(wsv_restore_options.bulk);
+
+  auto &peer_compression = iroha::network::peerCompression();
+  peer_compression.algorithm =
+      config.peer_compression.value_or(peer_compression.algorithm);
+  peer_compression.threshold =
+      config.peer_compression_threshold.value_or(peer_compression.threshold);
+  iroha::network::peerChunking().max_chunk_bytes =
+      static_cast<uint32_t>(std::min<uint64_t>(
+          uint64_t{config.peer_chunk_size_kb.value_or(0)} * 1024,
+          std::numeric_limits<uint32_t>::max()));
+
+  if (config.slow_statement_threshold_ms) {
+    auto &slow_statement_log = iroha::ametsuchi::slowStatementLog();
+    slow_statement_log.threshold =
+        std::chrono::milliseconds(*config.slow_statement_threshold_ms);
+    slow_statement_log.log =
+        log_manager->getChild("SlowStatements")->getLogger();
+  }
+
+  if (config.tx_trace_sample_interval) {
+    iroha::tracing::tracer().configure(
+        *config.tx_trace_sample_interval,
+        config.tx_trace_file.value_or(""),
+        log_manager->getChild("TransactionTracer")->getLogger());
+  }
+
+  iroha::ToriiOptions torii_options;
+  torii_options.validation_threads =
+      config.torii_validation_threads.value_or(kToriiValidationThreadsDefault);
+  torii_options.completion_queues = config.torii_completion_queues.value_or(
+      torii_options.completion_queues);
+  torii_options.pollers_per_queue = config.torii_pollers_per_queue.value_or(
+      torii_options.pollers_per_queue);
+  torii_options.query_threads =
+      config.query_threads.value_or(torii_options.query_threads);
+  torii_options.max_query_jobs =
+      config.max_query_jobs.value_or(torii_options.max_query_jobs);
+  torii_options.status_cache_size =
+      static_cast<uint64_t>(config.status_cache_size_mb.value_or(0)) * 1024
+      * 1024;
+  torii_options.async_status_publishing =
+      config.async_status_publishing.value_or(
+          torii_options.async_status_publishing);
+  torii_options.account_tx_rate =
+      config.torii_account_tx_rate.value_or(torii_options.account_tx_rate);
+  torii_options.peer_tx_rate =
+      config.torii_peer_tx_rate.value_or(torii_options.peer_tx_rate);
+  torii_options.capture_file =
+      config.torii_capture_file.value_or(torii_options.capture_file);
+
+  iroha::OrderingOptions ordering_options;
+  ordering_options.proposal_selection_policy =
+      config.proposal_selection_policy.value_or(
+          ordering_options.proposal_selection_policy);
+  ordering_options.batches_coalescing_window =
+      std::chrono::milliseconds(config.batches_coalescing_window_ms.value_or(
+          kBatchesCoalescingWindowDefault));
+  ordering_options.compact_proposals =
+      config.compact_proposals.value_or(ordering_options.compact_proposals);
+  ordering_options.adaptive_round_delay = config.adaptive_round_delay.value_or(
+      ordering_options.adaptive_round_delay);
+  ordering_options.min_round_delay = std::chrono::milliseconds(
+      config.min_round_delay_ms.value_or(kMinRoundDelayDefault));
+  ordering_options.gate_cache_size =
+      static_cast<size_t>(config.ordering_gate_cache_size_mb.value_or(
+          kOrderingGateCacheSizeDefault))
+      * 1024 * 1024;
+  ordering_options.prefetch_proposals =
+      config.prefetch_proposals.value_or(ordering_options.prefetch_proposals);
+  ordering_options.shards =
+      config.ordering_shards.value_or(ordering_options.shards);
+  ordering_options.proposal_hedging_percentile =
+      config.proposal_hedging_percentile.value_or(
+          ordering_options.proposal_hedging_percentile);
+  ordering_options.pending_size =
+      static_cast<size_t>(config.ordering_pending_size_mb.value_or(0)) * 1024
+      * 1024;
+  ordering_options.creator_size =
+      static_cast<size_t>(config.ordering_creator_size_mb.value_or(0)) * 1024
+      * 1024;
+
+  iroha::ConsensusOptions consensus_options;
+  consensus_options.compact_votes =
+      config.compact_votes.value_or(consensus_options.compact_votes);
+  consensus_options.stream_votes =
+      config.stream_votes.value_or(consensus_options.stream_votes);
+  if (config.vote_batch_window_ms) {
+    consensus_options.vote_batch_window =
+        std::chrono::milliseconds(*config.vote_batch_window_ms);
+  }
+  consensus_options.commit_fanout =
+      config.commit_fanout.value_or(consensus_options.commit_fanout);
+  consensus_options.observer =
+      config.observer.value_or(consensus_options.observer);
+
+  iroha::MstOptions mst_options;
+  mst_options.signature_deltas =
+      config.mst_signature_deltas.value_or(mst_options.signature_deltas);
+  mst_options.storage_size =
+      static_cast<size_t>(config.mst_storage_size_mb.value_or(0)) * 1024
+      * 1024;
+  mst_options.creator_size =
+      static_cast<size_t>(config.mst_creator_size_mb.value_or(0)) * 1024
+      * 1024;
+  mst_options.journal_file =
+      config.mst_journal_file.value_or(mst_options.journal_file);
+
+  iroha::PipelineOptions pipeline_options;
+  pipeline_options.status_bus_workers = config.status_bus_workers.value_or(
+      pipeline_options.status_bus_workers);
+  pipeline_options.stateful_validation_threads =
+      config.stateful_validation_threads.value_or(
+          pipeline_options.stateful_validation_threads);
+  pipeline_options.network_client_threads =
+      config.network_client_threads.value_or(
+          pipeline_options.network_client_threads);
+  pipeline_options.queue_size =
+      config.pipeline_queue_size.value_or(pipeline_options.queue_size);
+  pipeline_options.executor_threads =
+      config.executor_threads.value_or(pipeline_options.executor_threads);
+  pipeline_options.cpu_affinity =
+      config.cpu_affinity.value_or(pipeline_options.cpu_affinity);
+
   // Configuring iroha daemon
   Irohad irohad(
       config.block_store_path,
@@ -214,8 +483,14 @@ int main(int argc, char *argv[]) {
       config.stale_stream_max_rounds.value_or(kStaleStreamMaxRoundsDefault),
       std::move(config.initial_peers),
       log_manager->getChild("Irohad"),
-      boost::make_optional(config.mst_support,
-                           iroha::GossipPropagationStrategyParams{}));
+      boost::make_optional(config.mst_support, getMstGossipParams(config)),
+      block_store_options,
+      wsv_restore_options,
+      torii_options,
+      ordering_options,
+      consensus_options,
+      mst_options,
+      pipeline_options);
 
   // Check if iroha daemon storage was successfully initialized
   if (not irohad.storage) {
@@ -224,6 +499,52 @@ int main(int argc, char *argv[]) {
     return EXIT_FAILURE;
   }
 
+  if (not FLAGS_export_chain.empty() or not FLAGS_import_chain.empty()) {
+    if (not FLAGS_import_chain.empty() and not FLAGS_genesis_block.empty()) {
+      log->error("--import_chain and --genesis_block cannot be used together");
+      return EXIT_FAILURE;
+    }
+
+    iroha::main::ChainArchive archive(
+        std::make_unique<shared_model::proto::ProtoBlockFactory>(
+            std::make_unique<
+                shared_model::validation::DefaultSignedBlockValidator>(
+                std::make_shared<shared_model::validation::ValidatorsConfig>(
+                    config.max_proposal_size, true)),
+            std::make_unique<shared_model::validation::ProtoBlockValidator>()),
+        std::make_shared<iroha::ThreadPool>(
+            std::max(1u, std::thread::hardware_concurrency())),
+        log_manager->getChild("ChainArchive")->getLogger());
+
+    if (not FLAGS_export_chain.empty()) {
+      auto block_query = irohad.storage->getBlockQuery();
+      if (not block_query) {
+        log->error("Cannot create BlockQuery");
+        return EXIT_FAILURE;
+      }
+      if (auto e = iroha::expected::resultToOptionalError(
+              archive.exportChain(*block_query, FLAGS_export_chain))) {
+        log->error("Failed to export the ledger: {}", e.value());
+        return EXIT_FAILURE;
+      }
+      return EXIT_SUCCESS;
+    }
+
+    // the ledger is dropped only if the whole archive is valid
+    if (auto e = iroha::expected::resultToOptionalError(
+            archive.verifyChain(FLAGS_import_chain))) {
+      log->error("Failed to import the ledger: {}", e.value());
+      return EXIT_FAILURE;
+    }
+    // clear previous storage if any
+    irohad.dropStorage();
+    if (auto e = iroha::expected::resultToOptionalError(
+            archive.importChain(FLAGS_import_chain, *irohad.storage))) {
+      log->error("Failed to import the ledger: {}", e.value());
+      return EXIT_FAILURE;
+    }
+  }
+
   /*
    * The logic implemented below is reflected in the following truth table.
    *
@@ -258,9 +579,10 @@ int main(int argc, char *argv[]) {
           "flag. Restoring existing state.");
     } else {
       iroha::main::BlockLoader loader(
-          log_manager->getChild("GenesisBlockLoader")->getLogger());
-      auto file = loader.loadFile(FLAGS_genesis_block);
-      auto block = loader.parseBlock(file.value());
+          log_manager->getChild("GenesisBlockLoader")->getLogger(),
+          std::make_shared<iroha::ThreadPool>(
+              std::max(1u, std::thread::hardware_concurrency())));
+      auto block = loader.loadBlock(FLAGS_genesis_block);
 
       if (not block) {
         log->error("Failed to parse genesis block.");
@@ -281,7 +603,13 @@ int main(int argc, char *argv[]) {
                 block.value()->transactions().size());
     }
   } else {  // genesis block file is not specified
-    if (not blockstore) {
+    if (not blockstore and not FLAGS_snapshot_peer.empty()) {
+      if (auto e = iroha::expected::resultToOptionalError(
+              irohad.loadWsvSnapshot(snapshotPeers()))) {
+        log->error("Failed to load WSV snapshot: {}", e.value());
+        return EXIT_FAILURE;
+      }
+    } else if (not blockstore) {
       log->error(
           "Cannot restore nor create new state. Blockstore is empty. No "
           "genesis block is provided. Please pecify new genesis block using "
@@ -331,6 +659,9 @@ int main(int argc, char *argv[]) {
 #ifdef SIGQUIT
   std::signal(SIGQUIT, handler);
 #endif
+#ifdef SIGHUP
+  std::signal(SIGHUP, [](int s) { reload_requested = true; });
+#endif
 
   // runs iroha
   log->info("Running iroha");
@@ -340,7 +671,40 @@ int main(int argc, char *argv[]) {
     log->critical("Irohad startup failed: {}", error->error);
     return EXIT_FAILURE;
   }
-  exit_requested.get_future().wait();
+
+  std::unique_ptr<iroha::metrics::MetricsServer> metrics_server;
+  if (config.metrics_port) {
+    iroha::metrics::registerAllocatorMetrics(iroha::metrics::registry());
+    metrics_server = std::make_unique<iroha::metrics::MetricsServer>(
+        iroha::metrics::registry(),
+        log_manager->getChild("Metrics")->getLogger());
+    auto metrics_result = metrics_server->run(kListenIp, *config.metrics_port);
+    if (auto error =
+            boost::get<iroha::expected::Error<std::string>>(&metrics_result)) {
+      log->critical("Irohad startup failed: {}", error->error);
+      return EXIT_FAILURE;
+    }
+    log->info("Serving metrics on port {}", *config.metrics_port);
+  }
+  auto exit_future = exit_requested.get_future();
+  while (exit_future.wait_for(std::chrono::seconds(1))
+         != std::future_status::ready) {
+    if (not reload_requested.exchange(false)) {
+      continue;
+    }
+    log->info("Reloading the configuration");
+    try {
+      const auto reloaded =
+          parse_iroha_config(FLAGS_config, getCommonObjectsFactory());
+      irohad.setTunableParameters(
+          reloaded.max_proposal_size,
+          std::chrono::milliseconds(reloaded.proposal_delay),
+          std::chrono::milliseconds(reloaded.vote_delay),
+          getMstGossipParams(reloaded));
+    } catch (const std::exception &e) {
+      log->error("Failed to reload the configuration: {}", e.what());
+    }
+  }
 
   // We do not care about shutting down grpc servers
   // They do all necessary work in their destructors
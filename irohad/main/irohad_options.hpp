@@ -0,0 +1,201 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_IROHAD_OPTIONS_HPP
+#define IROHA_IROHAD_OPTIONS_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "common/thread_affinity.hpp"
+#include "ordering/proposal_selection_policy.hpp"
+
+namespace iroha {
+
+  /**
+   * Parameters of torii, the client API of the peer
+   */
+  struct ToriiOptions {
+    /// number of threads validating incoming transactions lists, large
+    /// proposals and blocks and verifying consensus votes, 0 means one per
+    /// hardware thread, 1 means validation on the receiving thread
+    size_t validation_threads = 1;
+
+    /// number of completion queues of the torii server, 0 means the gRPC
+    /// default
+    size_t completion_queues = 0;
+
+    /// fixed number of threads serving every completion queue of the torii
+    /// server, 0 means the gRPC default
+    size_t pollers_per_queue = 0;
+
+    /// if not 0, Find calls are served asynchronously and queries are
+    /// executed by at most this number of threads at once, instead of a gRPC
+    /// thread per call
+    size_t query_threads = 0;
+
+    /// if not 0 and query threads are set, heavy queries may be submitted as
+    /// jobs executed in the background, at most this number of jobs is held
+    /// at once
+    size_t max_query_jobs = 0;
+
+    /// if not 0, budget in bytes of transaction statuses kept in memory,
+    /// three quarters of it for final statuses and the rest for intermediate
+    /// ones
+    uint64_t status_cache_size = 0;
+
+    /// publish transaction statuses of verified proposals and commits on a
+    /// thread of their own instead of the consensus thread, so the next round
+    /// starts without waiting for them
+    bool async_status_publishing = false;
+
+    /// if not 0, transactions per second accepted from a creator account, the
+    /// rest is refused
+    size_t account_tx_rate = 0;
+
+    /// if not 0, transactions per second accepted from a client address, the
+    /// rest is refused
+    size_t peer_tx_rate = 0;
+
+    /// if not empty, file recording the received transactions and queries,
+    /// which iroha-cli replays
+    std::string capture_file;
+  };
+
+  /**
+   * Parameters of the ordering service and the ordering gate
+   */
+  struct OrderingOptions {
+    /// order in which the ordering service takes pending batches to proposals
+    ordering::ProposalSelectionPolicyType proposal_selection_policy =
+        ordering::ProposalSelectionPolicyType::kFifo;
+
+    /// time during which batches sent to ordering services are grouped into
+    /// a single request, zero disables grouping
+    std::chrono::milliseconds batches_coalescing_window =
+        std::chrono::milliseconds::zero();
+
+    /// request proposals from other peers as lists of transaction hashes
+    bool compact_proposals = false;
+
+    /// make the delay before rounds depend on the number of pending
+    /// transactions, between min_round_delay and the maximum rounds delay
+    bool adaptive_round_delay = false;
+
+    /// minimal delay before rounds in adaptive mode
+    std::chrono::milliseconds min_round_delay =
+        std::chrono::milliseconds::zero();
+
+    /// limit of total size in bytes of transactions cached by the ordering
+    /// gate, torii refuses transactions when it is reached. 0 means no limit
+    size_t gate_cache_size = 0;
+
+    /// request the proposal for the round after the next commit while the
+    /// current round is voted
+    bool prefetch_proposals = false;
+
+    /// number of ordering services in every round, each of them orders the
+    /// transactions with a part of hashes
+    size_t shards = 1;
+
+    /// if not 0, the proposal is requested once more when the request takes
+    /// longer than this percentile of recent request times of the ordering
+    /// peer
+    size_t proposal_hedging_percentile = 0;
+
+    /// if not 0, limit of the total size in bytes of transactions pending in
+    /// the ordering service, the batches with the oldest transactions are
+    /// shed when it is exceeded
+    size_t pending_size = 0;
+
+    /// if not 0, limit of the size in bytes of transactions of a creator
+    /// account pending in the ordering service
+    size_t creator_size = 0;
+  };
+
+  /**
+   * Parameters of consensus
+   */
+  struct ConsensusOptions {
+    /// send round and hashes shared by votes once per message
+    bool compact_votes = false;
+
+    /// send votes to every peer through a long-lived stream
+    bool stream_votes = false;
+
+    /// time during which votes of several rounds sent to a peer are collected
+    /// into one message, zero sends them at once
+    std::chrono::milliseconds vote_batch_window =
+        std::chrono::milliseconds::zero();
+
+    /// number of peers to which every peer forwards consensus outcomes, 0
+    /// means the outcome is sent to every peer by the peer which collected it
+    size_t commit_fanout = 0;
+
+    /// take no part in ordering and consensus, follow the chain by loading
+    /// blocks from ledger peers and serve only queries
+    bool observer = false;
+  };
+
+  /**
+   * Parameters of multisignature transactions processing
+   */
+  struct MstOptions {
+    /// send only new signatures to peers for batches which were sent to them
+    /// earlier
+    bool signature_deltas = false;
+
+    /// if not 0, limit of the total size in bytes of batches waiting for
+    /// signatures, the batches with the oldest transactions are shed when it
+    /// is exceeded
+    size_t storage_size = 0;
+
+    /// if not 0, limit of the size in bytes of transactions of a creator
+    /// account waiting for signatures
+    size_t creator_size = 0;
+
+    /// if not empty, file persisting batches waiting for signatures across
+    /// restarts
+    std::string journal_file;
+  };
+
+  /**
+   * Threads and queues of the pipeline of the peer
+   */
+  struct PipelineOptions {
+    /// number of threads delivering transaction statuses, statuses of a
+    /// transaction are always delivered by one of them
+    size_t status_bus_workers = 1;
+
+    /// number of threads validating proposals, batches which touch different
+    /// accounts, assets, domains and signatories are validated on them in
+    /// parallel. 1 means sequential validation
+    size_t stateful_validation_threads = 1;
+
+    /// number of completion queues completing outgoing calls to the other
+    /// peers, each served by its own thread. Calls to the same peer are
+    /// always completed by the same queue
+    size_t network_client_threads = 1;
+
+    /// if not 0, consensus outcomes and transaction statuses are passed
+    /// between the stages of the pipeline through queues of this size, each
+    /// drained by its own thread, instead of unbounded rxcpp queues
+    size_t queue_size = 0;
+
+    /// if not 0, the stages of the pipeline run on a work-stealing executor
+    /// with this number of threads shared by them, instead of a thread per
+    /// stage
+    size_t executor_threads = 0;
+
+    /// CPUs of the threads of consensus, ordering, torii, network client and
+    /// status bus, by default the threads are not pinned
+    ThreadAffinity cpu_affinity;
+  };
+
+}  // namespace iroha
+
+#endif  // IROHA_IROHAD_OPTIONS_HPP
@@ -6,6 +6,7 @@
 #ifndef IROHA_RAW_BLOCK_INSERTION_HPP
 #define IROHA_RAW_BLOCK_INSERTION_HPP
 
+#include <iosfwd>
 #include <memory>
 #include <string>
 
@@ -20,6 +21,8 @@ namespace shared_model {
 }  // namespace shared_model
 
 namespace iroha {
+  class ThreadPool;
+
   namespace main {
     /**
      * Class provide functionality to insert blocks to storage
@@ -29,7 +32,13 @@ namespace iroha {
      */
     class BlockLoader {
      public:
-      explicit BlockLoader(logger::LoggerPtr log);
+      /**
+       * @param log - logger
+       * @param pool - threads converting transactions of streamed blocks,
+       * transactions are converted on the calling thread if null
+       */
+      explicit BlockLoader(logger::LoggerPtr log,
+                           std::shared_ptr<ThreadPool> pool = nullptr);
 
       /**
        * Parse block from file
@@ -39,6 +48,34 @@ namespace iroha {
       boost::optional<std::shared_ptr<shared_model::interface::Block>>
       parseBlock(const std::string &data);
 
+      /**
+       * Parse block from JSON stream, reading it in parts. Transactions are
+       * parsed in chunks, so neither the whole JSON text nor its parsed
+       * representation are kept in memory
+       * @param input - stream with JSON of the block
+       * @return object if operation done successfully, nullopt otherwise
+       */
+      boost::optional<std::shared_ptr<shared_model::interface::Block>>
+      parseBlock(std::istream &input);
+
+      /**
+       * Load block from JSON file, @see parseBlock(std::istream &)
+       * @param path - target file
+       * @return object if operation done successfully, nullopt otherwise
+       */
+      boost::optional<std::shared_ptr<shared_model::interface::Block>>
+      loadBlock(const std::string &path);
+
+      /**
+       * Write block to stream as JSON readable by parseBlock. Transactions
+       * are converted in chunks and written as soon as they are converted
+       * @param block - block to write
+       * @param output - target stream
+       * @return true if the block is written, false otherwise
+       */
+      bool writeBlock(const shared_model::interface::Block &block,
+                      std::ostream &output);
+
       /**
        * Loading file from target path
        * @param path - target file
@@ -48,6 +85,7 @@ namespace iroha {
 
      private:
       logger::LoggerPtr log_;
+      std::shared_ptr<ThreadPool> pool_;
     };
 
   }  // namespace main
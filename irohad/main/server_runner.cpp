@@ -13,14 +13,50 @@ const auto kPortBindError = "Cannot bind server to address %s";
 
 ServerRunner::ServerRunner(const std::string &address,
                            logger::LoggerPtr log,
-                           bool reuse)
-    : log_(std::move(log)), serverAddress_(address), reuse_(reuse) {}
+                           bool reuse,
+                           ThreadingOptions threading)
+    : log_(std::move(log)),
+      serverAddress_(address),
+      reuse_(reuse),
+      threading_(threading) {}
 
 ServerRunner &ServerRunner::append(std::shared_ptr<grpc::Service> service) {
   services_.push_back(service);
   return *this;
 }
 
+ServerRunner &ServerRunner::append(std::shared_ptr<grpc::Service> service,
+                                   AsyncHandler handler) {
+  services_.push_back(service);
+  async_handlers_.push_back(std::move(handler));
+  return *this;
+}
+
+ServerRunner::~ServerRunner() {
+  if (async_queues_.empty()) {
+    return;
+  }
+  // completion queues are shut down after the server
+  if (serverInstance_) {
+    serverInstance_->Shutdown();
+  }
+  for (auto &queue : async_queues_) {
+    queue->Shutdown();
+  }
+  for (auto &thread : async_threads_) {
+    thread.join();
+  }
+  if (async_threads_.empty()) {
+    // the server has not started, the queues are drained here
+    void *tag;
+    bool ok;
+    for (auto &queue : async_queues_) {
+      while (queue->Next(&tag, &ok)) {
+      }
+    }
+  }
+}
+
 iroha::expected::Result<int, std::string> ServerRunner::run() {
   grpc::ServerBuilder builder;
   int selected_port = 0;
@@ -43,9 +79,35 @@ iroha::expected::Result<int, std::string> ServerRunner::run() {
   // enable retry policy
   builder.AddChannelArgument(GRPC_ARG_ENABLE_RETRIES, 1);
 
+  if (threading_.completion_queues > 0) {
+    builder.SetSyncServerOption(grpc::ServerBuilder::SyncServerOption::NUM_CQS,
+                                threading_.completion_queues);
+  }
+  if (threading_.pollers_per_queue > 0) {
+    builder.SetSyncServerOption(
+        grpc::ServerBuilder::SyncServerOption::MIN_POLLERS,
+        threading_.pollers_per_queue);
+    builder.SetSyncServerOption(
+        grpc::ServerBuilder::SyncServerOption::MAX_POLLERS,
+        threading_.pollers_per_queue);
+  }
+
+  for (size_t i = 0; i < async_handlers_.size(); ++i) {
+    async_queues_.push_back(builder.AddCompletionQueue());
+  }
+
   serverInstance_ = builder.BuildAndStart();
   serverInstanceCV_.notify_one();
 
+  if (serverInstance_) {
+    for (size_t i = 0; i < async_handlers_.size(); ++i) {
+      async_threads_.emplace_back(
+          [handler = async_handlers_[i], queue = async_queues_[i].get()] {
+            handler(*queue);
+          });
+    }
+  }
+
   if (selected_port == 0) {
     return iroha::expected::makeError(
         (boost::format(kPortBindError) % serverAddress_).str());
@@ -6,6 +6,9 @@
 #ifndef MAIN_SERVER_RUNNER_HPP
 #define MAIN_SERVER_RUNNER_HPP
 
+#include <functional>
+#include <thread>
+
 #include <grpc++/grpc++.h>
 #include <grpc++/impl/codegen/service_type.h>
 #include "common/result.hpp"
@@ -16,15 +19,30 @@
  */
 class ServerRunner {
  public:
+  /**
+   * Threads serving the calls. The server polls several completion queues,
+   * every one by its own set of threads which execute the handlers. Zero
+   * values keep the defaults of gRPC, value initialization gives zeroes
+   */
+  struct ThreadingOptions {
+    /// number of completion queues
+    int completion_queues;
+    /// number of threads polling every completion queue, it is kept fixed
+    /// instead of growing with the number of concurrent calls
+    int pollers_per_queue;
+  };
+
   /**
    * Constructor. Initialize a new instance of ServerRunner class.
    * @param address - the address the server will be bind to in URI form
    * @param log to print progress to
    * @param reuse - allow multiple sockets to bind to the same port
+   * @param threading - completion queues and threads serving the calls
    */
   explicit ServerRunner(const std::string &address,
                         logger::LoggerPtr log,
-                        bool reuse = true);
+                        bool reuse = true,
+                        ThreadingOptions threading = ThreadingOptions{});
 
   /**
    * Adds a new grpc service to be run.
@@ -33,6 +51,23 @@ class ServerRunner {
    */
   ServerRunner &append(std::shared_ptr<grpc::Service> service);
 
+  /// handles the events of a completion queue until it is shut down
+  using AsyncHandler = std::function<void(grpc::ServerCompletionQueue &)>;
+
+  /**
+   * Adds a new grpc service with asynchronous methods to be run. The calls
+   * are served on a completion queue of their own, polled by the handler on
+   * a dedicated thread
+   * @param service - service to append.
+   * @param handler - handler of the completion queue
+   * @return reference to this with service appended
+   */
+  ServerRunner &append(std::shared_ptr<grpc::Service> service,
+                       AsyncHandler handler);
+
+  /// Shuts down the completion queues of asynchronous services
+  ~ServerRunner();
+
   /**
    * Initialize the server and run main loop.
    * @return Result with used port number or error message
@@ -63,7 +98,11 @@ class ServerRunner {
 
   std::string serverAddress_;
   bool reuse_;
+  ThreadingOptions threading_;
   std::vector<std::shared_ptr<grpc::Service>> services_;
+  std::vector<AsyncHandler> async_handlers_;
+  std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> async_queues_;
+  std::vector<std::thread> async_threads_;
 };
 
 #endif  // MAIN_SERVER_RUNNER_HPP
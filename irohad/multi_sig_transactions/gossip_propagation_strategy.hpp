@@ -11,6 +11,7 @@
 #include <mutex>
 
 #include "ametsuchi/peer_query_factory.hpp"
+#include "common/timer_wheel.hpp"
 #include "multi_sig_transactions/gossip_propagation_strategy_params.hpp"
 #include "multi_sig_transactions/mst_propagation_strategy.hpp"
 
@@ -19,7 +20,10 @@ namespace iroha {
   /**
    * This class provides strategy for propagation states in network
    * Emits exactly (or zero if provider is empty) amount of peers
-   * at some period
+   * at some period. The amount grows with the size of propagated states up
+   * to the maximal one, and periods are skipped while the emitted peers have
+   * nothing to be sent, twice as many after each idle emitting, until the
+   * own state is updated
    * note: it can be inconsistent with the peer provider
    */
   class GossipPropagationStrategy : public PropagationStrategy {
@@ -29,13 +33,13 @@ namespace iroha {
     /**
      * Initialize strategy with
      * @param peer_factory is a provider of peer list
-     * @param emit_worker is the coordinator for the data emitting
+     * @param timer_wheel runs the periodic data emitting
      * @param params configuration parameters
      */
     GossipPropagationStrategy(
         // TODO 30.01.2019 lebdron: IR-266 Remove PeerQueryFactory
         PeerProviderFactory peer_factory,
-        rxcpp::observe_on_one_worker emit_worker,
+        std::shared_ptr<TimerWheel> timer_wheel,
         const GossipPropagationStrategyParams &params);
 
     ~GossipPropagationStrategy();
@@ -44,7 +48,18 @@ namespace iroha {
 
     rxcpp::observable<PropagationData> emitter() override;
 
+    void onPropagated(size_t sent, size_t largest_state) override;
+
+    void onStateUpdated() override;
+
     // --------------------------| end override |---------------------------
+
+    /**
+     * Change the configuration parameters, the new period is applied after
+     * the next emitting
+     */
+    void setParams(const GossipPropagationStrategyParams &params);
+
    private:
     /**
      * Source of peers for propagation
@@ -62,17 +77,38 @@ namespace iroha {
     std::vector<size_t> non_visited;
 
     /**
-     * Worker that performs internal loop handling
+     * Configuration parameters
      */
-    rxcpp::observe_on_one_worker emit_worker;
+    GossipPropagationStrategyParams params;
+
+    /**
+     * Timer wheel that performs internal loop handling
+     */
+    std::shared_ptr<TimerWheel> timer_wheel;
+
+    /**
+     * Scheduled emitting of the next data
+     */
+    TimerWheel::TaskId emission{0};
+
+    /**
+     * Amount of peers emitted per once
+     */
+    uint32_t amount;
+
+    /**
+     * Periods to skip after an idle emitting, and periods skipped since it
+     */
+    uint32_t idle_periods{0};
+    uint32_t skipped_periods{0};
 
     /*
-     * Observable for the emitting propagated data
+     * Subject for the emitting propagated data
      */
-    rxcpp::observable<PropagationData> emitent;
+    rxcpp::subjects::subject<PropagationData> emitent;
 
     /*
-     * Mutex for handling observable stopping
+     * Mutex for handling observable stopping and the adaptive state
      */
     std::mutex m;
 
@@ -87,6 +123,11 @@ namespace iroha {
      * @return following peer
      */
     OptPeer visit();
+
+    /**
+     * Emit the next peers and schedule the following emitting
+     */
+    void emit();
   };
 }  // namespace iroha
 
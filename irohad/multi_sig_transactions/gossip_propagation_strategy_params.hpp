@@ -15,6 +15,9 @@
 static constexpr std::chrono::milliseconds kDefaultPeriod =
     std::chrono::seconds(5);
 static constexpr uint32_t kDefaultAmount = 2;
+static constexpr uint32_t kDefaultMaxAmount = 8;
+static constexpr uint32_t kDefaultBatchesPerExtraPeer = 100;
+static constexpr uint32_t kDefaultMaxIdlePeriods = 4;
 
 namespace iroha {
   /**
@@ -26,6 +29,16 @@ namespace iroha {
 
     /// amount of data (peers) emitted per once
     uint32_t amount_per_once{kDefaultAmount};
+
+    /// amount of peers emitted per once when many batches are propagated
+    uint32_t max_amount_per_once{kDefaultMaxAmount};
+
+    /// batches in the largest propagated state which add one emitted peer,
+    /// 0 keeps the amount fixed
+    uint32_t batches_per_extra_peer{kDefaultBatchesPerExtraPeer};
+
+    /// periods skipped at most while there is nothing to propagate
+    uint32_t max_idle_periods{kDefaultMaxIdlePeriods};
   };
 
 }  // namespace iroha
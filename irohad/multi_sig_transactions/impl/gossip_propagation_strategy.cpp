@@ -5,6 +5,7 @@
 
 #include "multi_sig_transactions/gossip_propagation_strategy.hpp"
 
+#include <algorithm>
 #include <numeric>
 #include <random>
 
@@ -17,39 +18,96 @@ namespace iroha {
   using PropagationData = PropagationStrategy::PropagationData;
   using OptPeer = GossipPropagationStrategy::OptPeer;
   using PeerProviderFactory = GossipPropagationStrategy::PeerProviderFactory;
-  using std::chrono::steady_clock;
 
   GossipPropagationStrategy::GossipPropagationStrategy(
       PeerProviderFactory peer_factory,
-      rxcpp::observe_on_one_worker emit_worker,
+      std::shared_ptr<TimerWheel> timer_wheel,
       const GossipPropagationStrategyParams &params)
       : peer_factory(peer_factory),
         non_visited({}),
-        emit_worker(emit_worker),
-        emitent(rxcpp::observable<>::interval(
-                    steady_clock::now(), params.emission_period, emit_worker)
-                    .map([this, params](int) {
-                      PropagationData vec;
-                      auto range = boost::irange(0u, params.amount_per_once);
-                      // push until find empty element
-                      std::find_if_not(
-                          range.begin(), range.end(), [this, &vec](int) {
-                            return this->visit() | [&vec](auto e) -> bool {
-                              vec.push_back(e);
-                              return true;  // proceed
-                            };
-                          });
-                      return vec;
-                    })) {}
+        params(params),
+        timer_wheel(std::move(timer_wheel)),
+        amount(params.amount_per_once) {
+    std::lock_guard<std::mutex> lock(m);
+    emission = this->timer_wheel->schedule(std::chrono::milliseconds(0),
+                                           [this] { emit(); });
+  }
 
   rxcpp::observable<PropagationData> GossipPropagationStrategy::emitter() {
-    return emitent;
+    return emitent.get_observable();
   }
 
   GossipPropagationStrategy::~GossipPropagationStrategy() {
-    // Make sure that emitent callback have finish and haven't started yet
+    TimerWheel::TaskId last_emission;
+    {
+      // Make sure that no more emitting is scheduled
+      std::lock_guard<std::mutex> lock(m);
+      peer_factory.reset();
+      last_emission = emission;
+    }
+    timer_wheel->cancel(last_emission);
+    // Make sure that emitent callback have finished
+    timer_wheel->wait(last_emission);
+  }
+
+  void GossipPropagationStrategy::onPropagated(size_t sent,
+                                               size_t largest_state) {
     std::lock_guard<std::mutex> lock(m);
-    peer_factory.reset();
+    if (sent == 0) {
+      idle_periods = std::min(params.max_idle_periods,
+                              std::max(2 * idle_periods, 1u));
+    } else {
+      idle_periods = 0;
+    }
+    size_t extra_peers = params.batches_per_extra_peer == 0
+        ? 0
+        : largest_state / params.batches_per_extra_peer;
+    amount = static_cast<uint32_t>(std::min<size_t>(
+        params.max_amount_per_once, params.amount_per_once + extra_peers));
+    // the configured amount is kept even if it exceeds the maximal one
+    amount = std::max(amount, params.amount_per_once);
+  }
+
+  void GossipPropagationStrategy::onStateUpdated() {
+    std::lock_guard<std::mutex> lock(m);
+    idle_periods = 0;
+  }
+
+  void GossipPropagationStrategy::setParams(
+      const GossipPropagationStrategyParams &params) {
+    std::lock_guard<std::mutex> lock(m);
+    this->params = params;
+    amount = params.amount_per_once;
+    idle_periods = std::min(idle_periods, params.max_idle_periods);
+  }
+
+  void GossipPropagationStrategy::emit() {
+    bool skip;
+    uint32_t amount;
+    {
+      std::lock_guard<std::mutex> lock(m);
+      skip = skipped_periods < idle_periods;
+      skipped_periods = skip ? skipped_periods + 1 : 0;
+      amount = this->amount;
+    }
+    if (not skip) {
+      PropagationData vec;
+      auto range = boost::irange(0u, amount);
+      // push until find empty element
+      std::find_if_not(range.begin(), range.end(), [this, &vec](int) {
+        return this->visit() | [&vec](auto e) -> bool {
+          vec.push_back(e);
+          return true;  // proceed
+        };
+      });
+      emitent.get_subscriber().on_next(vec);
+    }
+
+    std::lock_guard<std::mutex> lock(m);
+    if (peer_factory) {
+      emission = timer_wheel->schedule(params.emission_period,
+                                       [this] { emit(); });
+    }
   }
 
   bool GossipPropagationStrategy::initQueue() {
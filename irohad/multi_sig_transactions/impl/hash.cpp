@@ -10,6 +10,7 @@
 
 #include <boost/functional/hash.hpp>
 #include "cryptography/blob.hpp"
+#include "cryptography/hash.hpp"
 #include "cryptography/public_key.hpp"
 #include "interfaces/common_objects/peer.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
@@ -18,7 +19,7 @@ namespace iroha {
   namespace model {
 
     size_t PointerBatchHasher::operator()(const DataType &batch) const {
-      return std::hash<std::string>{}(batch->reducedHash().hex());
+      return shared_model::crypto::Hash::Hasher{}(batch->reducedHash());
     }
 
     std::size_t BlobHasher::operator()(
@@ -3,7 +3,9 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <algorithm>
 #include <utility>
+#include <vector>
 
 #include "logger/logger.hpp"
 #include "multi_sig_transactions/mst_processor_impl.hpp"
@@ -15,15 +17,27 @@ namespace iroha {
       std::shared_ptr<MstStorage> storage,
       std::shared_ptr<PropagationStrategy> strategy,
       std::shared_ptr<MstTimeProvider> time_provider,
-      logger::LoggerPtr log)
+      logger::LoggerPtr log,
+      std::shared_ptr<MstJournal> journal)
       : MstProcessor(log),  // use the same logger in base class
         transport_(std::move(transport)),
         storage_(std::move(storage)),
         strategy_(std::move(strategy)),
         time_provider_(std::move(time_provider)),
+        journal_(std::move(journal)),
         propagation_subscriber_(strategy_->emitter().subscribe(
             [this](auto data) { this->onPropagate(data); })),
-        log_(std::move(log)) {}
+        log_(std::move(log)),
+        completed_batches_metric_(metrics::registry().counter(
+            "iroha_mst_completed_batches_total",
+            "Multisignature batches which collected enough signatures")),
+        expired_batches_metric_(metrics::registry().counter(
+            "iroha_mst_expired_batches_total",
+            "Multisignature batches which expired")),
+        state_apply_time_metric_(metrics::registry().histogram(
+            "iroha_mst_state_apply_microseconds",
+            "Time spent applying states received from other peers")),
+        memory_account_(metrics::registry(), "mst") {}
 
   FairMstProcessor::~FairMstProcessor() {
     propagation_subscriber_.unsubscribe();
@@ -33,11 +47,17 @@ namespace iroha {
 
   auto FairMstProcessor::propagateBatchImpl(const iroha::DataType &batch)
       -> decltype(propagateBatch(batch)) {
+    metrics::MemoryScope memory_scope(memory_account_);
     auto state_update = storage_->updateOwnState(batch);
+    auto expired =
+        storage_->extractExpiredTransactions(time_provider_->getCurrentTime());
+    journalChanges(state_update, expired);
+    if (not state_update.updated_state_->isEmpty()) {
+      strategy_->onStateUpdated();
+    }
     completedBatchesNotify(*state_update.completed_state_);
     updatedBatchesNotify(*state_update.updated_state_);
-    expiredBatchesNotify(
-        storage_->extractExpiredTransactions(time_provider_->getCurrentTime()));
+    expiredBatchesNotify(expired);
   }
 
   auto FairMstProcessor::onStateUpdateImpl() const
@@ -58,6 +78,7 @@ namespace iroha {
   // TODO [IR-1687] Akvinikym 10.09.18: three methods below should be one
   void FairMstProcessor::completedBatchesNotify(ConstRefState state) const {
     if (not state.isEmpty()) {
+      completed_batches_metric_.increment(state.size());
       state.iterateBatches([this](const auto &batch) {
         batches_subject_.get_subscriber().on_next(batch);
       });
@@ -73,12 +94,22 @@ namespace iroha {
 
   void FairMstProcessor::expiredBatchesNotify(ConstRefState state) const {
     if (not state.isEmpty()) {
+      expired_batches_metric_.increment(state.size());
       state.iterateBatches([this](const auto &batch) {
         expired_subject_.get_subscriber().on_next(batch);
       });
     }
   }
 
+  void FairMstProcessor::journalChanges(const StateUpdateResult &state_update,
+                                        ConstRefState expired) const {
+    if (journal_) {
+      journal_->update(*state_update.updated_state_);
+      journal_->erase(*state_update.completed_state_);
+      journal_->erase(expired);
+    }
+  }
+
   bool FairMstProcessor::batchInStorageImpl(const DataType &batch) const {
     return storage_->batchInStorage(batch);
   }
@@ -88,41 +119,76 @@ namespace iroha {
   void FairMstProcessor::onNewState(const shared_model::crypto::PublicKey &from,
                                     MstState new_state) {
     log_->info("Applying new state");
+    metrics::ScopedTimer timer(state_apply_time_metric_);
+    metrics::MemoryScope memory_scope(memory_account_);
     auto current_time = time_provider_->getCurrentTime();
 
     // no need to add already expired batches to local state
     new_state.eraseExpired(current_time);
     auto state_update = storage_->apply(from, new_state);
+    auto expired = storage_->extractExpiredTransactions(current_time);
+    journalChanges(state_update, expired);
+    if (not state_update.updated_state_->isEmpty()) {
+      strategy_->onStateUpdated();
+    }
 
     // updated batches
     updatedBatchesNotify(*state_update.updated_state_);
     log_->info("New batches size: {}",
-               state_update.updated_state_->getBatches().size());
+               state_update.updated_state_->size());
 
     // completed batches
     completedBatchesNotify(*state_update.completed_state_);
 
     // expired batches
     // not nesessary to do it right here, just use the occasion to clean storage
-    expiredBatchesNotify(storage_->extractExpiredTransactions(current_time));
+    expiredBatchesNotify(expired);
   }
 
   // -----------------------------| private api |-----------------------------
 
   void FairMstProcessor::onPropagate(
       const PropagationStrategy::PropagationData &data) {
+    metrics::MemoryScope memory_scope(memory_account_);
     auto current_time = time_provider_->getCurrentTime();
-    auto size = data.size();
-    std::for_each(data.begin(),
-                  data.end(),
-                  [this, &current_time, size](const auto &dst_peer) {
-                    auto diff = storage_->getDiffState(dst_peer->pubkey(),
-                                                       current_time);
-                    if (not diff.isEmpty()) {
-                      log_->info("Propagate new data[{}]", size);
-                      transport_->sendState(*dst_peer, diff);
-                    }
-                  });
+
+    // peers with the same diff are sent one state, they usually have all
+    // the same batches when no state has been received from them
+    struct Outbound {
+      std::vector<DataType> batches;
+      MstState diff;
+      PropagationStrategy::PropagationData peers;
+    };
+    std::vector<Outbound> outbound;
+    size_t sent = 0, largest_state = 0;
+    for (const auto &dst_peer : data) {
+      auto diff = storage_->getDiffState(dst_peer->pubkey(), current_time);
+      if (diff.isEmpty()) {
+        continue;
+      }
+      std::vector<DataType> batches;
+      diff.iterateBatches(
+          [&batches](const auto &batch) { batches.push_back(batch); });
+      // states do not keep the order of batches
+      std::sort(batches.begin(), batches.end());
+      auto same = std::find_if(
+          outbound.begin(), outbound.end(), [&batches](const auto &state) {
+            return state.batches == batches;
+          });
+      if (same != outbound.end()) {
+        same->peers.push_back(dst_peer);
+      } else {
+        largest_state = std::max(largest_state, diff.size());
+        outbound.push_back({std::move(batches), std::move(diff), {dst_peer}});
+      }
+      ++sent;
+    }
+
+    for (const auto &state : outbound) {
+      log_->info("Propagate new data[{}]", state.peers.size());
+      transport_->broadcastState(state.peers, state.diff);
+    }
+    strategy_->onPropagated(sent, largest_state);
   }
 
 }  // namespace iroha
@@ -9,9 +9,12 @@
 #include <memory>
 #include "cryptography/public_key.hpp"
 #include "logger/logger_fwd.hpp"
+#include "metrics/memory_accounting.hpp"
+#include "metrics/metrics.hpp"
 #include "multi_sig_transactions/mst_processor.hpp"
 #include "multi_sig_transactions/mst_propagation_strategy.hpp"
 #include "multi_sig_transactions/mst_time_provider.hpp"
+#include "multi_sig_transactions/storage/mst_journal.hpp"
 #include "multi_sig_transactions/storage/mst_storage.hpp"
 #include "network/mst_transport.hpp"
 
@@ -29,12 +32,15 @@ namespace iroha {
      * @param storage  - repository for storing states
      * @param strategy - propagation mechanism for sharing state with others
      * @param time_provider - repository of current time
+     * @param journal - file recording changes of the own state, if it is
+     * persisted
      */
     FairMstProcessor(std::shared_ptr<iroha::network::MstTransport> transport,
                      std::shared_ptr<MstStorage> storage,
                      std::shared_ptr<PropagationStrategy> strategy,
                      std::shared_ptr<MstTimeProvider> time_provider,
-                     logger::LoggerPtr log);
+                     logger::LoggerPtr log,
+                     std::shared_ptr<MstJournal> journal = nullptr);
 
     ~FairMstProcessor();
 
@@ -88,11 +94,20 @@ namespace iroha {
      */
     void expiredBatchesNotify(ConstRefState state) const;
 
+    /**
+     * Record changes of the own state in the journal, if there is one
+     * @param state_update - result of an update of the own state
+     * @param expired - batches extracted as expired
+     */
+    void journalChanges(const StateUpdateResult &state_update,
+                        ConstRefState expired) const;
+
     // -------------------------------| fields |--------------------------------
     std::shared_ptr<iroha::network::MstTransport> transport_;
     std::shared_ptr<MstStorage> storage_;
     std::shared_ptr<PropagationStrategy> strategy_;
     std::shared_ptr<MstTimeProvider> time_provider_;
+    std::shared_ptr<MstJournal> journal_;
 
     // rx subjects
 
@@ -110,6 +125,11 @@ namespace iroha {
     rxcpp::composite_subscription propagation_subscriber_;
 
     logger::LoggerPtr log_;
+
+    metrics::Counter &completed_batches_metric_;
+    metrics::Counter &expired_batches_metric_;
+    metrics::Histogram &state_apply_time_metric_;
+    metrics::MemoryAccount memory_account_;
   };
 }  // namespace iroha
 
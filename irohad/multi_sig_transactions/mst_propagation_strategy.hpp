@@ -26,6 +26,19 @@ namespace iroha {
      * with respect to own strategy
      */
     virtual rxcpp::observable<PropagationData> emitter() = 0;
+
+    /**
+     * Report the outcome of propagation to the emitted peers, so that the
+     * strategy may adapt the amount and the rate of emitting
+     * @param sent - emitted peers which were sent a state
+     * @param largest_state - batches in the largest sent state
+     */
+    virtual void onPropagated(size_t sent, size_t largest_state) {}
+
+    /**
+     * Report that the own state has got batches to propagate
+     */
+    virtual void onStateUpdated() {}
   };
 }  // namespace iroha
 
@@ -0,0 +1,69 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_BATCHES_BUDGET_HPP
+#define IROHA_BATCHES_BUDGET_HPP
+
+#include <cstddef>
+#include <unordered_map>
+
+#include "interfaces/common_objects/types.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class TransactionBatch;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+
+  /**
+   * Accounts the memory held by batches of a component as the total size of
+   * payloads of their transactions and the size of transactions of every
+   * creator account. Payloads are used since they do not change when
+   * signatures are added
+   */
+  class BatchesBudget {
+   public:
+    /**
+     * @param max_size_bytes - limit of the total size, 0 means no limit
+     * @param max_creator_size_bytes - limit of the size of transactions of a
+     * creator account, 0 means no limit
+     */
+    BatchesBudget(size_t max_size_bytes, size_t max_creator_size_bytes);
+
+    /// @return whether any of the limits is set
+    bool isLimited() const;
+
+    /**
+     * Check whether the batch may be added without exceeding the quota of its
+     * creators. The quota may be exceeded by a single batch, so that a
+     * creator below the quota is never refused
+     */
+    bool fitsCreatorQuota(
+        const shared_model::interface::TransactionBatch &batch) const;
+
+    void add(const shared_model::interface::TransactionBatch &batch);
+
+    void remove(const shared_model::interface::TransactionBatch &batch);
+
+    /// @return whether the total size exceeds the limit
+    bool isExceeded() const;
+
+    size_t sizeBytes() const;
+
+    void clear();
+
+   private:
+    const size_t max_size_bytes_;
+    const size_t max_creator_size_bytes_;
+    size_t size_bytes_ = 0;
+    std::unordered_map<shared_model::interface::types::AccountIdType, size_t>
+        creator_size_bytes_;
+  };
+
+}  // namespace iroha
+
+#endif  // IROHA_BATCHES_BUDGET_HPP
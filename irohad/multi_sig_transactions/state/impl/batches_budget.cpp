@@ -0,0 +1,83 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "multi_sig_transactions/state/batches_budget.hpp"
+
+#include <algorithm>
+
+#include "interfaces/iroha_internal/transaction_batch.hpp"
+#include "interfaces/transaction.hpp"
+
+namespace iroha {
+
+  BatchesBudget::BatchesBudget(size_t max_size_bytes,
+                               size_t max_creator_size_bytes)
+      : max_size_bytes_(max_size_bytes),
+        max_creator_size_bytes_(max_creator_size_bytes) {}
+
+  bool BatchesBudget::isLimited() const {
+    return max_size_bytes_ != 0 or max_creator_size_bytes_ != 0;
+  }
+
+  bool BatchesBudget::fitsCreatorQuota(
+      const shared_model::interface::TransactionBatch &batch) const {
+    if (max_creator_size_bytes_ == 0) {
+      return true;
+    }
+    return std::none_of(
+        batch.transactions().begin(),
+        batch.transactions().end(),
+        [this](const auto &tx) {
+          auto creator = creator_size_bytes_.find(tx->creatorAccountId());
+          return creator != creator_size_bytes_.end()
+              and creator->second >= max_creator_size_bytes_;
+        });
+  }
+
+  void BatchesBudget::add(
+      const shared_model::interface::TransactionBatch &batch) {
+    for (const auto &tx : batch.transactions()) {
+      auto size = tx->payload().size();
+      size_bytes_ += size;
+      if (max_creator_size_bytes_ != 0) {
+        creator_size_bytes_[tx->creatorAccountId()] += size;
+      }
+    }
+  }
+
+  void BatchesBudget::remove(
+      const shared_model::interface::TransactionBatch &batch) {
+    for (const auto &tx : batch.transactions()) {
+      auto size = tx->payload().size();
+      size_bytes_ -= std::min(size, size_bytes_);
+      if (max_creator_size_bytes_ == 0) {
+        continue;
+      }
+      auto creator = creator_size_bytes_.find(tx->creatorAccountId());
+      if (creator == creator_size_bytes_.end()) {
+        continue;
+      }
+      if (creator->second <= size) {
+        creator_size_bytes_.erase(creator);
+      } else {
+        creator->second -= size;
+      }
+    }
+  }
+
+  bool BatchesBudget::isExceeded() const {
+    return max_size_bytes_ != 0 and size_bytes_ > max_size_bytes_;
+  }
+
+  size_t BatchesBudget::sizeBytes() const {
+    return size_bytes_;
+  }
+
+  void BatchesBudget::clear() {
+    size_bytes_ = 0;
+    creator_size_bytes_.clear();
+  }
+
+}  // namespace iroha
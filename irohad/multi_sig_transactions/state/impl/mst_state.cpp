@@ -51,7 +51,7 @@ namespace iroha {
     return std::all_of(batch->transactions().begin(),
                        batch->transactions().end(),
                        [](const auto &tx) {
-                         return boost::size(tx->signatures()) >= tx->quorum();
+                         return tx->signaturesCount() >= tx->quorum();
                        });
   }
 
@@ -88,21 +88,28 @@ namespace iroha {
   }
 
   MstState MstState::operator-(const MstState &rhs) const {
-    const auto &my_batches = batches_.right | boost::adaptors::map_keys;
-    std::vector<DataType> difference;
-    difference.reserve(boost::size(batches_));
-    for (const auto &batch : my_batches) {
-      if (rhs.batches_.right.find(batch) == rhs.batches_.right.end()) {
-        difference.push_back(batch);
+    MstState difference(completer_, log_);
+    // batches are visited in order of timestamps, so each one is inserted at
+    // the end of the difference without searching for its position and
+    // without computing its timestamp again
+    for (const auto &timestamp_and_batch : batches_.left) {
+      if (rhs.batches_.right.find(timestamp_and_batch.second)
+          == rhs.batches_.right.end()) {
+        difference.batches_.left.insert(difference.batches_.left.end(),
+                                        timestamp_and_batch);
       }
     }
-    return MstState(this->completer_, difference, log_);
+    return difference;
   }
 
   bool MstState::isEmpty() const {
     return batches_.empty();
   }
 
+  size_t MstState::size() const {
+    return batches_.size();
+  }
+
   std::unordered_set<DataType,
                      iroha::model::PointerBatchHasher,
                      BatchHashEquality>
@@ -121,6 +128,20 @@ namespace iroha {
     extractExpiredImpl(current_time, boost::none);
   }
 
+  bool MstState::erase(const DataType &batch) {
+    return batches_.right.erase(batch) != 0;
+  }
+
+  boost::optional<DataType> MstState::extractOldest() {
+    if (batches_.empty()) {
+      return boost::none;
+    }
+    auto oldest = batches_.left.begin();
+    DataType batch = oldest->second;
+    batches_.left.erase(oldest);
+    return batch;
+  }
+
   // ------------------------------| private api |------------------------------
 
   /**
@@ -135,6 +156,11 @@ namespace iroha {
          boost::combine(target->transactions(), donor->transactions())) {
       const auto &target_tx = zip.get<0>();
       const auto &donor_tx = zip.get<1>();
+      // transactions with all signatures may be shared through the
+      // transaction pool, and more signatures do not complete them anyway
+      if (target_tx->signaturesCount() >= target_tx->quorum()) {
+        continue;
+      }
       inserted_new_signatures = std::accumulate(
           std::begin(donor_tx->signatures()),
           std::end(donor_tx->signatures()),
@@ -162,36 +188,40 @@ namespace iroha {
 
   void MstState::insertOne(StateUpdateResult &state_update,
                            const DataType &rhs_batch) {
-    log_->info("batch: {}", *rhs_batch);
+    log_->debug("batch: {}", *rhs_batch);
     auto corresponding = batches_.right.find(rhs_batch);
     if (corresponding == batches_.right.end()) {
       // when state does not contain transaction
-      rawInsert(rhs_batch);
-      state_update.updated_state_->rawInsert(rhs_batch);
+      auto timestamp = oldestTimestamp(rhs_batch);
+      rawInsert(timestamp, rhs_batch);
+      state_update.updated_state_->rawInsert(timestamp, rhs_batch);
       return;
     }
 
     DataType found = corresponding->first;
+    const auto timestamp = corresponding->second;
     // Append new signatures to the existing state
     auto inserted_new_signatures = mergeSignaturesInBatch(found, rhs_batch);
 
     if (completer_->isCompleted(found)) {
       // state already has completed transaction,
       // remove from state and return it
-      batches_.right.erase(found);
-      state_update.completed_state_->rawInsert(found);
+      batches_.right.erase(corresponding);
+      state_update.completed_state_->rawInsert(timestamp, found);
       return;
     }
 
     // if batch still isn't completed, return it, if new signatures were
     // inserted
     if (inserted_new_signatures) {
-      state_update.updated_state_->rawInsert(found);
+      state_update.updated_state_->rawInsert(timestamp, found);
     }
   }
 
-  void MstState::rawInsert(const DataType &rhs_batch) {
-    batches_.insert({oldestTimestamp(rhs_batch), rhs_batch});
+  void MstState::rawInsert(
+      shared_model::interface::types::TimestampType timestamp,
+      const DataType &rhs_batch) {
+    batches_.insert({timestamp, rhs_batch});
   }
 
   bool MstState::contains(const DataType &element) const {
@@ -203,7 +233,8 @@ namespace iroha {
     for (auto it = batches_.left.begin(); it != batches_.left.end()
          and completer_->isExpired(it->second, current_time);) {
       if (extracted) {
-        *extracted += it->second;
+        // expired batches are extracted in order of timestamps
+        extracted->batches_.left.insert(extracted->batches_.left.end(), *it);
       }
       it = batches_.left.erase(it);
       assert(it == batches_.left.begin());
@@ -129,7 +129,13 @@ namespace iroha {
     bool isEmpty() const;
 
     /**
-     * @return the batches from the state
+     * @return number of batches inside
+     */
+    size_t size() const;
+
+    /**
+     * @return copy of the batches from the state, use iterateBatches to visit
+     * them without copying
      */
     std::unordered_set<DataType,
                        iroha::model::PointerBatchHasher,
@@ -149,6 +155,19 @@ namespace iroha {
      */
     void eraseExpired(const TimeType &current_time);
 
+    /**
+     * Erase the batch
+     * @param batch - batch to be erased
+     * @return true, if the state contained the batch
+     */
+    bool erase(const DataType &batch);
+
+    /**
+     * Erase and return the batch with the oldest transaction
+     * @return the batch, none if the state is empty
+     */
+    boost::optional<DataType> extractOldest();
+
     /**
      * Check, if this MST state contains that element
      * @param element to be checked
@@ -202,9 +221,11 @@ namespace iroha {
 
     /**
      * Insert new value in state with keeping invariant
+     * @param timestamp - oldest timestamp of transactions of the batch
      * @param rhs_tx - data for insertion
      */
-    void rawInsert(const DataType &rhs_tx);
+    void rawInsert(shared_model::interface::types::TimestampType timestamp,
+                   const DataType &rhs_tx);
 
     /**
      * Erase expired batches, optionally returning them.
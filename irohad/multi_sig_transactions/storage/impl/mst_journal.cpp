@@ -0,0 +1,248 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "multi_sig_transactions/storage/mst_journal.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <iterator>
+#include <map>
+
+#include <boost/optional.hpp>
+
+#include "backend/protobuf/transaction.hpp"
+#include "cryptography/blob.hpp"
+#include "interfaces/iroha_internal/transaction_batch.hpp"
+#include "logger/logger.hpp"
+#include "multi_sig_transactions/state/mst_state.hpp"
+
+namespace {
+  /// starts the journal, the last byte is the version of the format
+  const std::string kHeader("IRMJ\x01", 5);
+
+  /// change, hash size and data size
+  const size_t kRecordHeaderSize = 1 + 4 + 4;
+
+  /// kinds of records
+  const uint8_t kUpdate = 1;
+  const uint8_t kErase = 2;
+
+  /// serialized transactions of pending batches by their reduced hashes
+  using PendingBatches = std::map<std::string, std::string>;
+
+  void put(std::string &out, uint64_t value, size_t bytes) {
+    for (size_t i = 0; i < bytes; ++i) {
+      out.push_back(static_cast<char>(value >> (8 * i)));
+    }
+  }
+
+  uint64_t get(const char *in, size_t bytes) {
+    uint64_t value = 0;
+    for (size_t i = 0; i < bytes; ++i) {
+      value |= uint64_t(static_cast<uint8_t>(in[i])) << (8 * i);
+    }
+    return value;
+  }
+
+  std::string makeRecord(uint8_t change,
+                         const std::string &hash,
+                         const std::string &data) {
+    std::string record;
+    record.reserve(kRecordHeaderSize + hash.size() + data.size());
+    put(record, change, 1);
+    put(record, hash.size(), 4);
+    put(record, data.size(), 4);
+    record.append(hash).append(data);
+    return record;
+  }
+
+  /**
+   * Replay the records of the journal, the incomplete last record of an
+   * interrupted write is skipped
+   * @return false if the content is not a journal
+   */
+  bool readPending(const std::string &content, PendingBatches &pending) {
+    if (content.compare(0, kHeader.size(), kHeader) != 0) {
+      return false;
+    }
+    size_t offset = kHeader.size();
+    while (content.size() - offset >= kRecordHeaderSize) {
+      const char *header = content.data() + offset;
+      auto hash_size = get(header + 1, 4);
+      auto data_size = get(header + 5, 4);
+      offset += kRecordHeaderSize;
+      if (content.size() - offset < hash_size + data_size) {
+        break;
+      }
+      auto hash = content.substr(offset, hash_size);
+      if (get(header, 1) == kUpdate) {
+        pending[std::move(hash)] =
+            content.substr(offset + hash_size, data_size);
+      } else {
+        pending.erase(hash);
+      }
+      offset += hash_size + data_size;
+    }
+    return true;
+  }
+
+  std::string readFile(const std::string &path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::string((std::istreambuf_iterator<char>(file)),
+                       std::istreambuf_iterator<char>());
+  }
+
+  /// Replace the file with one holding only the pending batches
+  bool writePending(const std::string &path, const PendingBatches &pending) {
+    const auto temporary = path + ".tmp";
+    {
+      std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+      file.write(kHeader.data(), kHeader.size());
+      for (const auto &batch : pending) {
+        auto record = makeRecord(kUpdate, batch.first, batch.second);
+        file.write(record.data(), record.size());
+      }
+      if (not file.flush()) {
+        return false;
+      }
+    }
+    return std::rename(temporary.c_str(), path.c_str()) == 0;
+  }
+
+  /// @return transactions of the serialized batch, none if it is corrupted
+  boost::optional<iroha::MstJournal::Batch> parseBatch(
+      const std::string &data) {
+    iroha::MstJournal::Batch batch;
+    size_t offset = 0;
+    while (data.size() - offset >= 4) {
+      auto size = get(data.data() + offset, 4);
+      offset += 4;
+      batch.emplace_back();
+      if (data.size() - offset < size
+          or not batch.back().ParseFromArray(data.data() + offset,
+                                             static_cast<int>(size))) {
+        return boost::none;
+      }
+      offset += size;
+    }
+    if (offset != data.size() or batch.empty()) {
+      return boost::none;
+    }
+    return batch;
+  }
+}  // namespace
+
+namespace iroha {
+
+  constexpr size_t MstJournal::kMinCompactionRecords;
+
+  expected::Result<std::unique_ptr<MstJournal>, std::string> MstJournal::open(
+      const std::string &path, logger::LoggerPtr log) {
+    PendingBatches pending;
+    auto content = readFile(path);
+    if (not content.empty() and not readPending(content, pending)) {
+      return expected::makeError("Not an MST journal: " + path);
+    }
+    if (not writePending(path, pending)) {
+      return expected::makeError("Cannot write MST journal " + path);
+    }
+    std::ofstream file(path, std::ios::binary | std::ios::app);
+    if (not file) {
+      return expected::makeError("Cannot open MST journal " + path);
+    }
+
+    std::unordered_set<std::string> hashes;
+    std::vector<Batch> restored;
+    for (const auto &batch : pending) {
+      if (auto transactions = parseBatch(batch.second)) {
+        hashes.insert(batch.first);
+        restored.push_back(std::move(*transactions));
+      } else {
+        log->warn("Skipping corrupted batch of the MST journal");
+      }
+    }
+    return expected::makeValue(std::unique_ptr<MstJournal>(
+        new MstJournal(path,
+                       std::move(file),
+                       std::move(hashes),
+                       std::move(restored),
+                       std::move(log))));
+  }
+
+  std::vector<MstJournal::Batch> MstJournal::takeRestored() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return std::move(restored_);
+  }
+
+  void MstJournal::update(ConstRefState state) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    state.iterateBatches([this](const auto &batch) {
+      this->append(kUpdate, batch);
+      pending_.insert(
+          shared_model::crypto::toBinaryString(batch->reducedHash()));
+    });
+    file_.flush();
+  }
+
+  void MstJournal::erase(ConstRefState state) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    state.iterateBatches([this](const auto &batch) {
+      if (pending_.erase(
+              shared_model::crypto::toBinaryString(batch->reducedHash()))
+          != 0) {
+        this->append(kErase, batch);
+      }
+    });
+    file_.flush();
+    if (records_ >= kMinCompactionRecords and records_ > 2 * pending_.size()) {
+      compact();
+    }
+  }
+
+  MstJournal::MstJournal(std::string path,
+                         std::ofstream file,
+                         std::unordered_set<std::string> pending,
+                         std::vector<Batch> restored,
+                         logger::LoggerPtr log)
+      : path_(std::move(path)),
+        file_(std::move(file)),
+        pending_(std::move(pending)),
+        records_(pending_.size()),
+        restored_(std::move(restored)),
+        log_(std::move(log)) {}
+
+  void MstJournal::append(uint8_t change, const DataType &batch) {
+    std::string data;
+    if (change == kUpdate) {
+      for (const auto &transaction : batch->transactions()) {
+        auto bytes =
+            static_cast<const shared_model::proto::Transaction &>(*transaction)
+                .getTransport()
+                .SerializeAsString();
+        put(data, bytes.size(), 4);
+        data.append(bytes);
+      }
+    }
+    auto record =
+        makeRecord(change,
+                   shared_model::crypto::toBinaryString(batch->reducedHash()),
+                   data);
+    file_.write(record.data(), record.size());
+    ++records_;
+  }
+
+  void MstJournal::compact() {
+    file_.close();
+    PendingBatches pending;
+    if (readPending(readFile(path_), pending)
+        and writePending(path_, pending)) {
+      records_ = pending.size();
+    } else {
+      log_->warn("Failed to compact MST journal {}", path_);
+    }
+    file_.open(path_, std::ios::binary | std::ios::app);
+  }
+
+}  // namespace iroha
@@ -41,6 +41,7 @@ namespace iroha {
   }
 
   bool MstStorage::batchInStorage(const DataType &batch) const {
+    std::lock_guard<std::mutex> lock{this->mutex_};
     return batchInStorageImpl(batch);
   }
 }  // namespace iroha
@@ -5,59 +5,157 @@
 
 #include "multi_sig_transactions/storage/mst_storage_impl.hpp"
 
+#include <algorithm>
+
+#include "logger/logger.hpp"
+
 namespace iroha {
   // ------------------------------| private API |------------------------------
 
-  auto MstStorageStateImpl::getState(
-      const shared_model::crypto::PublicKey &target_peer_key) {
-    auto target_state_iter = peer_states_.find(target_peer_key);
-    if (target_state_iter == peer_states_.end()) {
-      return peer_states_
-          .insert(
-              {target_peer_key, MstState::empty(mst_state_logger_, completer_)})
-          .first;
+  void MstStorageStateImpl::updateVersions(
+      const StateUpdateResult &state_update,
+      const boost::optional<shared_model::crypto::PublicKey> &source) {
+    state_update.updated_state_->iterateBatches([&](const auto &batch) {
+      this->eraseVersion(batch);
+      ++last_version_;
+      batches_by_version_.emplace(last_version_, VersionedBatch{batch, source});
+      batch_versions_.emplace(batch, last_version_);
+    });
+    state_update.completed_state_->iterateBatches(
+        [this](const auto &batch) { this->eraseVersion(batch); });
+  }
+
+  void MstStorageStateImpl::eraseVersion(const DataType &batch) {
+    auto version = batch_versions_.find(batch);
+    if (version != batch_versions_.end()) {
+      batches_by_version_.erase(version->second);
+      batch_versions_.erase(version);
     }
-    return target_state_iter;
   }
+
+  std::vector<DataType> MstStorageStateImpl::newBatches(
+      const StateUpdateResult &state_update) const {
+    std::vector<DataType> new_batches;
+    if (not budget_.isLimited()) {
+      return new_batches;
+    }
+    state_update.updated_state_->iterateBatches([&](const auto &batch) {
+      if (batch_versions_.count(batch) == 0) {
+        new_batches.push_back(batch);
+      }
+    });
+    return new_batches;
+  }
+
+  void MstStorageStateImpl::shedBatches(
+      const StateUpdateResult &state_update,
+      const std::vector<DataType> &new_batches) {
+    if (not budget_.isLimited()) {
+      return;
+    }
+    state_update.completed_state_->iterateBatches(
+        [this](const auto &batch) { budget_.remove(*batch); });
+    for (const auto &batch : new_batches) {
+      if (budget_.fitsCreatorQuota(*batch)) {
+        budget_.add(*batch);
+      } else {
+        own_state_.erase(batch);
+        shed(state_update, batch);
+      }
+    }
+    while (budget_.isExceeded()) {
+      auto oldest = own_state_.extractOldest();
+      if (not oldest) {
+        break;
+      }
+      budget_.remove(**oldest);
+      shed(state_update, *oldest);
+    }
+  }
+
+  void MstStorageStateImpl::shed(const StateUpdateResult &state_update,
+                                 const DataType &batch) {
+    log_->warn("Shedding batch {} exceeding the memory budget",
+               batch->reducedHash());
+    eraseVersion(batch);
+    state_update.updated_state_->erase(batch);
+    shed_state_ += batch;
+  }
+
   // -----------------------------| interface API |-----------------------------
 
   MstStorageStateImpl::MstStorageStateImpl(const CompleterType &completer,
                                            logger::LoggerPtr mst_state_logger,
-                                           logger::LoggerPtr log)
+                                           logger::LoggerPtr log,
+                                           size_t max_size_bytes,
+                                           size_t max_creator_size_bytes,
+                                           std::chrono::milliseconds
+                                               full_state_period)
       : MstStorage(log),
         completer_(completer),
         own_state_(MstState::empty(mst_state_logger, completer_)),
+        budget_(max_size_bytes, max_creator_size_bytes),
+        shed_state_(MstState::empty(mst_state_logger, completer_)),
+        full_state_period_(full_state_period.count()),
         mst_state_logger_(std::move(mst_state_logger)) {}
 
   auto MstStorageStateImpl::applyImpl(
       const shared_model::crypto::PublicKey &target_peer_key,
       const MstState &new_state)
       -> decltype(apply(target_peer_key, new_state)) {
-    auto target_state_iter = getState(target_peer_key);
-    target_state_iter->second += new_state;
-    return own_state_ += new_state;
+    auto state_update = own_state_ += new_state;
+    auto new_batches = newBatches(state_update);
+    updateVersions(state_update, target_peer_key);
+    shedBatches(state_update, new_batches);
+    return state_update;
   }
 
   auto MstStorageStateImpl::updateOwnStateImpl(const DataType &tx)
       -> decltype(updateOwnState(tx)) {
-    return own_state_ += tx;
+    auto state_update = own_state_ += tx;
+    auto new_batches = newBatches(state_update);
+    updateVersions(state_update, boost::none);
+    shedBatches(state_update, new_batches);
+    return state_update;
   }
 
   auto MstStorageStateImpl::extractExpiredTransactionsImpl(
       const TimeType &current_time)
       -> decltype(extractExpiredTransactions(current_time)) {
-    for (auto &peer_and_state : peer_states_) {
-      peer_and_state.second.eraseExpired(current_time);
-    }
-    return own_state_.extractExpired(current_time);
+    auto expired = own_state_.extractExpired(current_time);
+    expired.iterateBatches([this](const auto &batch) {
+      this->eraseVersion(batch);
+      if (budget_.isLimited()) {
+        budget_.remove(*batch);
+      }
+    });
+    // shed batches are reported as expired, since their signatures are lost
+    expired += shed_state_;
+    shed_state_ = MstState::empty(mst_state_logger_, completer_);
+    return expired;
   }
 
   auto MstStorageStateImpl::getDiffStateImpl(
       const shared_model::crypto::PublicKey &target_peer_key,
       const TimeType &current_time)
       -> decltype(getDiffState(target_peer_key, current_time)) {
-    auto target_current_state_iter = getState(target_peer_key);
-    auto new_diff_state = own_state_ - target_current_state_iter->second;
+    auto &peer_version = peer_versions_[target_peer_key];
+    if (current_time >= peer_version.full_state_time + full_state_period_) {
+      peer_version.version = 0;
+      peer_version.full_state_time = current_time;
+    }
+    auto new_diff_state = MstState::empty(mst_state_logger_, completer_);
+    // batches received from the peer are not sent back to it until they are
+    // updated by others
+    std::for_each(batches_by_version_.upper_bound(peer_version.version),
+                  batches_by_version_.end(),
+                  [&](const auto &version_and_batch) {
+                    const auto &source = version_and_batch.second.source;
+                    if (not source or *source != target_peer_key) {
+                      new_diff_state += version_and_batch.second.batch;
+                    }
+                  });
+    peer_version.version = last_version_;
     new_diff_state.eraseExpired(current_time);
     return new_diff_state;
   }
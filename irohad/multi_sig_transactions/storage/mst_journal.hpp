@@ -0,0 +1,90 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_MST_JOURNAL_HPP
+#define IROHA_MST_JOURNAL_HPP
+
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "common/result.hpp"
+#include "logger/logger_fwd.hpp"
+#include "multi_sig_transactions/mst_types.hpp"
+#include "transaction.pb.h"
+
+namespace iroha {
+
+  /**
+   * Append-only file of changes of the own MST state, so that pending
+   * batches survive a restart instead of being gossiped again by the peers.
+   * Every update of a batch appends the batch with all its signatures, and
+   * every batch leaving the state appends its erasure. The file is rewritten
+   * with the pending batches only when it is opened and when most of its
+   * records are obsolete. The file is binary: a header followed by records
+   * holding the kind of the change, the reduced hash of the batch and its
+   * transactions, integers being little-endian
+   */
+  class MstJournal {
+   public:
+    /// transactions of a pending batch
+    using Batch = std::vector<iroha::protocol::Transaction>;
+
+    /// records below which the journal is not compacted
+    static constexpr size_t kMinCompactionRecords = 1000;
+
+    /**
+     * Open the journal, reading the pending batches of an existing one
+     * @param path - path of the journal file
+     * @param log - logger
+     * @return the journal or the error message
+     */
+    static expected::Result<std::unique_ptr<MstJournal>, std::string> open(
+        const std::string &path, logger::LoggerPtr log);
+
+    /// @return pending batches read when the journal was opened
+    std::vector<Batch> takeRestored();
+
+    /// Record new versions of the batches of the state
+    void update(ConstRefState state);
+
+    /// Record that the batches of the state have left the own state
+    void erase(ConstRefState state);
+
+   private:
+    MstJournal(std::string path,
+               std::ofstream file,
+               std::unordered_set<std::string> pending,
+               std::vector<Batch> restored,
+               logger::LoggerPtr log);
+
+    /**
+     * Append a record, must be called under the lock
+     * @param change - kind of the record
+     * @param batch - updated or erased batch
+     */
+    void append(uint8_t change, const DataType &batch);
+
+    /// Rewrite the file with the pending batches, must be called under the
+    /// lock
+    void compact();
+
+    const std::string path_;
+    std::mutex mutex_;
+    std::ofstream file_;
+    /// reduced hashes of the pending batches
+    std::unordered_set<std::string> pending_;
+    /// records in the file
+    size_t records_;
+    std::vector<Batch> restored_;
+    logger::LoggerPtr log_;
+  };
+
+}  // namespace iroha
+
+#endif  // IROHA_MST_JOURNAL_HPP
@@ -51,7 +51,9 @@ namespace iroha {
     MstState extractExpiredTransactions(const TimeType &current_time);
 
     /**
-     * Make state based on diff of own and target states.
+     * Make state of own batches which are new for the target peer: those
+     * updated since the previous diff for the peer, or all of them once in a
+     * while, except the batches last updated by the peer itself.
      * All expired transactions will be removed from diff.
      * @return difference between own and target state
      * General note: implementation of method covered by lock
@@ -6,9 +6,15 @@
 #ifndef IROHA_MST_STORAGE_IMPL_HPP
 #define IROHA_MST_STORAGE_IMPL_HPP
 
+#include <chrono>
+#include <map>
 #include <unordered_map>
+#include <vector>
+
+#include <boost/optional.hpp>
 #include "logger/logger_fwd.hpp"
 #include "multi_sig_transactions/hash.hpp"
+#include "multi_sig_transactions/state/batches_budget.hpp"
 #include "multi_sig_transactions/storage/mst_storage.hpp"
 
 namespace iroha {
@@ -17,18 +23,65 @@ namespace iroha {
     // -----------------------------| private API |-----------------------------
 
     /**
-     * Return state of a peer by its public key. If state doesn't exist, create
-     * new empty state and return it.
-     * @param target_peer_key - public key of the peer for searching
-     * @return valid iterator for state of peer
+     * Give new versions to updated batches and forget versions of completed
+     * ones
+     * @param state_update - result of an update of the own state
+     * @param source - key of the peer which sent the update, none for
+     * updates of this peer
+     */
+    void updateVersions(
+        const StateUpdateResult &state_update,
+        const boost::optional<shared_model::crypto::PublicKey> &source);
+
+    /**
+     * Forget the version of a batch which has left the own state
      */
-    auto getState(const shared_model::crypto::PublicKey &target_peer_key);
+    void eraseVersion(const DataType &batch);
+
+    /**
+     * @return updated batches which were not in the own state before the
+     * update, none if the budget is not limited
+     */
+    std::vector<DataType> newBatches(
+        const StateUpdateResult &state_update) const;
+
+    /**
+     * Account the update in the budget and shed the batches which do not fit
+     * into it: new batches of creators over their quota, then the batches
+     * with the oldest transactions until the total size is within the limit
+     * @param state_update - result of an update of the own state, shed
+     * batches are erased from its updated state
+     * @param new_batches - batches added to the own state by the update
+     */
+    void shedBatches(const StateUpdateResult &state_update,
+                     const std::vector<DataType> &new_batches);
+
+    /**
+     * Erase the batch from the own state and keep it to be returned with the
+     * expired ones
+     */
+    void shed(const StateUpdateResult &state_update, const DataType &batch);
 
    public:
     // ----------------------------| interface API |----------------------------
-    MstStorageStateImpl(const CompleterType &completer,
-                        logger::LoggerPtr mst_state_logger,
-                        logger::LoggerPtr log);
+    /**
+     * @param completer - strategy of completion and expiration of batches
+     * @param mst_state_logger - logger of created states
+     * @param log - logger of the storage
+     * @param max_size_bytes - limit of the total size of the own state, 0
+     * means no limit
+     * @param max_creator_size_bytes - limit of the size of transactions of a
+     * creator account in the own state, 0 means no limit
+     * @param full_state_period - period after which the diff for a peer is
+     * the whole own state again
+     */
+    MstStorageStateImpl(
+        const CompleterType &completer,
+        logger::LoggerPtr mst_state_logger,
+        logger::LoggerPtr log,
+        size_t max_size_bytes = 0,
+        size_t max_creator_size_bytes = 0,
+        std::chrono::milliseconds full_state_period = std::chrono::minutes(1));
 
     auto applyImpl(const shared_model::crypto::PublicKey &target_peer_key,
                    const MstState &new_state)
@@ -53,12 +106,42 @@ namespace iroha {
    private:
     // ---------------------------| private fields |----------------------------
 
+    /// batch of the own state with the peer which made its last update
+    struct VersionedBatch {
+      DataType batch;
+      boost::optional<shared_model::crypto::PublicKey> source;
+    };
+
     const CompleterType completer_;
+    MstState own_state_;
+
+    BatchesBudget budget_;
+    /// batches shed since the last extraction of the expired ones
+    MstState shed_state_;
+
+    /// version is increased on every update of a batch of the own state
+    uint64_t last_version_ = 0;
+    std::map<uint64_t, VersionedBatch> batches_by_version_;
+    std::unordered_map<DataType,
+                       uint64_t,
+                       iroha::model::PointerBatchHasher,
+                       BatchHashEquality>
+        batch_versions_;
+    /// diffs made for a peer
+    struct PeerVersion {
+      /// last version of the own state included in a diff for the peer
+      uint64_t version = 0;
+      /// time of the last diff with the whole own state
+      TimeType full_state_time = 0;
+    };
+
+    /// diffs are not acknowledged by peers, so the whole own state is sent
+    /// again once in the period in case some diffs have not been delivered
+    const TimeType full_state_period_;
     std::unordered_map<shared_model::crypto::PublicKey,
-                       MstState,
+                       PeerVersion,
                        iroha::model::BlobHasher>
-        peer_states_;
-    MstState own_state_;
+        peer_versions_;
 
     logger::LoggerPtr mst_state_logger_;  ///< Logger for created MstState
                                           ///< objects.
@@ -7,14 +7,20 @@
 
 #include "multi_sig_transactions/transport/mst_transport_grpc.hpp"
 
+#include <algorithm>
+#include <iterator>
+
 #include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/transformed.hpp>
 #include "ametsuchi/tx_presence_cache.hpp"
+#include "backend/protobuf/common_objects/signature.hpp"
 #include "backend/protobuf/transaction.hpp"
+#include "cryptography/signed.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "interfaces/transaction.hpp"
 #include "logger/logger.hpp"
 #include "network/impl/grpc_channel_builder.hpp"
+#include "network/impl/grpc_compression.hpp"
 #include "validators/field_validator.hpp"
 
 using namespace iroha;
@@ -23,9 +29,12 @@ using namespace iroha::network;
 using iroha::ConstRefState;
 namespace {
   auto default_sender_factory = [](const shared_model::interface::Peer &to) {
-    return createClient<transport::MstTransportGrpc>(to.address());
+    return createPeerClient<transport::MstTransportGrpc>(to.address());
   };
-}
+
+  /// number of remembered transactions and sent signature sets
+  constexpr uint32_t kSignatureDeltasCacheSize = 10000;
+}  // namespace
 void sendStateAsyncImpl(
     const shared_model::interface::Peer &to,
     ConstRefState state,
@@ -33,6 +42,14 @@ void sendStateAsyncImpl(
     AsyncGrpcClient<google::protobuf::Empty> &async_call,
     MstTransportGrpc::SenderFactory sender_factory = default_sender_factory);
 
+transport::MstState makeProtoState(ConstRefState state,
+                                   const std::string &sender_key);
+
+void sendProtoState(const shared_model::interface::Peer &to,
+                    const transport::MstState &proto_state,
+                    AsyncGrpcClient<google::protobuf::Empty> &async_call,
+                    const MstTransportGrpc::SenderFactory &sender_factory);
+
 MstTransportGrpc::MstTransportGrpc(
     std::shared_ptr<AsyncGrpcClient<google::protobuf::Empty>> async_call,
     std::shared_ptr<TransportFactoryType> transaction_factory,
@@ -45,7 +62,9 @@ MstTransportGrpc::MstTransportGrpc(
     shared_model::crypto::PublicKey my_key,
     logger::LoggerPtr mst_state_logger,
     logger::LoggerPtr log,
-    boost::optional<SenderFactory> sender_factory)
+    boost::optional<SenderFactory> sender_factory,
+    bool send_signature_deltas,
+    std::shared_ptr<TransactionPool> transaction_pool)
     : async_call_(std::move(async_call)),
       transaction_factory_(std::move(transaction_factory)),
       batch_parser_(std::move(batch_parser)),
@@ -55,7 +74,15 @@ MstTransportGrpc::MstTransportGrpc(
       my_key_(shared_model::crypto::toBinaryString(my_key)),
       mst_state_logger_(std::move(mst_state_logger)),
       log_(std::move(log)),
-      sender_factory_(sender_factory) {}
+      sender_factory_(sender_factory),
+      send_signature_deltas_(send_signature_deltas),
+      transaction_pool_(std::move(transaction_pool)),
+      received_transactions_(
+          kSignatureDeltasCacheSize,
+          kSignatureDeltasCacheSize - kSignatureDeltasCacheSize / 4),
+      sent_signatures_(
+          kSignatureDeltasCacheSize,
+          kSignatureDeltasCacheSize - kSignatureDeltasCacheSize / 4) {}
 
 shared_model::interface::types::SharedTxsCollectionType
 MstTransportGrpc::deserializeTransactions(const transport::MstState *request) {
@@ -82,12 +109,63 @@ MstTransportGrpc::deserializeTransactions(const transport::MstState *request) {
         }));
 }
 
+shared_model::interface::types::SharedTxsCollectionType
+MstTransportGrpc::restoreTransactions(const transport::MstState *request) {
+  shared_model::interface::types::SharedTxsCollectionType result;
+  for (const auto &delta : request->signatures()) {
+    shared_model::crypto::Hash hash(delta.transaction_hash());
+    auto known = received_transactions_.findItem(hash);
+    if (not known) {
+      log_->info("Received signatures of unknown transaction {}", hash);
+      continue;
+    }
+    for (const auto &signature : delta.signatures()) {
+      // signatures may be encoded differently by peers of different versions
+      const auto public_key = shared_model::proto::publicKeyBytes(signature);
+      auto is_present = std::any_of(
+          known->signatures().begin(),
+          known->signatures().end(),
+          [&public_key](const auto &present) {
+            return shared_model::proto::publicKeyBytes(present) == public_key;
+          });
+      if (not is_present) {
+        *known->add_signatures() = signature;
+      }
+    }
+    received_transactions_.addItem(hash, *known);
+    transaction_factory_->build(*known).match(
+        [&](auto &&value) { result.push_back(std::move(value).value); },
+        [&](const auto &error) {
+          log_->info("Transaction deserialization failed: hash {}, {}",
+                     error.error.hash,
+                     error.error.error);
+        });
+  }
+  return result;
+}
+
 grpc::Status MstTransportGrpc::SendState(
     ::grpc::ServerContext *context,
     const ::iroha::network::transport::MstState *request,
     ::google::protobuf::Empty *response) {
   log_->info("MstState Received");
   auto transactions = deserializeTransactions(request);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // signatures of these transactions may be sent later without payload
+    for (const auto &tx : transactions) {
+      received_transactions_.addItem(
+          tx->hash(),
+          static_cast<const shared_model::proto::Transaction &>(*tx)
+              .getTransport());
+    }
+    auto restored = restoreTransactions(request);
+    std::move(
+        restored.begin(), restored.end(), std::back_inserter(transactions));
+  }
+  if (transaction_pool_) {
+    transaction_pool_->intern(transactions);
+  }
 
   auto batches = batch_parser_->parseBatches(transactions);
 
@@ -123,7 +201,7 @@ grpc::Status MstTransportGrpc::SendState(
         });
   }
 
-  log_->info("batches in MstState: {}", new_state.getBatches().size());
+  log_->info("batches in MstState: {}", new_state.size());
 
   shared_model::crypto::PublicKey source_key(request->source_peer_key());
   auto key_invalid_reason =
@@ -155,14 +233,114 @@ void MstTransportGrpc::subscribe(
   subscriber_ = notification;
 }
 
+void MstTransportGrpc::addBatch(
+    const shared_model::interface::Peer &to,
+    const shared_model::interface::TransactionBatch &batch,
+    transport::MstState &proto_state) {
+  const auto peer_key = shared_model::crypto::toBinaryString(to.pubkey());
+  auto sent_key = [&peer_key](const auto &tx) {
+    return peer_key + shared_model::crypto::toBinaryString(tx->hash());
+  };
+  const auto &transactions = batch.transactions();
+
+  auto is_sent =
+      std::all_of(transactions.begin(),
+                  transactions.end(),
+                  [&](const auto &tx) {
+                    return static_cast<bool>(
+                        sent_signatures_.findItem(sent_key(tx)));
+                  });
+  if (not is_sent) {
+    for (const auto &tx : transactions) {
+      std::vector<std::string> signers;
+      for (const auto &signature : tx->signatures()) {
+        signers.push_back(signature.publicKey().hex());
+      }
+      sent_signatures_.addItem(sent_key(tx), std::move(signers));
+      *proto_state.add_transactions() =
+          std::static_pointer_cast<shared_model::proto::Transaction>(tx)
+              ->getTransport();
+    }
+    return;
+  }
+
+  // every transaction of the batch is listed, so that the receiver restores
+  // the whole batch
+  std::vector<transport::TransactionSignatures> deltas;
+  bool has_new_signatures = false;
+  for (const auto &tx : transactions) {
+    auto signers = sent_signatures_.findItem(sent_key(tx)).value_or(
+        std::vector<std::string>{});
+    transport::TransactionSignatures delta;
+    delta.set_transaction_hash(
+        shared_model::crypto::toBinaryString(tx->hash()));
+    for (const auto &signature : tx->signatures()) {
+      auto signer = signature.publicKey().hex();
+      if (std::find(signers.begin(), signers.end(), signer) != signers.end()) {
+        continue;
+      }
+      shared_model::proto::setSignature(*delta.add_signatures(),
+                                        signature.signedData(),
+                                        signature.publicKey());
+      signers.push_back(std::move(signer));
+      has_new_signatures = true;
+    }
+    sent_signatures_.addItem(sent_key(tx), std::move(signers));
+    deltas.push_back(std::move(delta));
+  }
+  if (has_new_signatures) {
+    for (auto &delta : deltas) {
+      *proto_state.add_signatures() = std::move(delta);
+    }
+  }
+}
+
 void MstTransportGrpc::sendState(const shared_model::interface::Peer &to,
                                  ConstRefState providing_state) {
   log_->info("Propagate MstState to peer {}", to.address());
-  sendStateAsyncImpl(to,
-                     providing_state,
-                     my_key_,
-                     *async_call_,
-                     sender_factory_.value_or(default_sender_factory));
+  if (not send_signature_deltas_) {
+    sendStateAsyncImpl(to,
+                       providing_state,
+                       my_key_,
+                       *async_call_,
+                       sender_factory_.value_or(default_sender_factory));
+    return;
+  }
+
+  transport::MstState proto_state;
+  proto_state.set_source_peer_key(my_key_);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    providing_state.iterateBatches([&](const auto &batch) {
+      this->addBatch(to, *batch, proto_state);
+    });
+  }
+  if (proto_state.transactions().empty()
+      and proto_state.signatures().empty()) {
+    log_->info("Peer {} has already been sent the state", to.address());
+    return;
+  }
+
+  sendProtoState(to,
+                 proto_state,
+                 *async_call_,
+                 sender_factory_.value_or(default_sender_factory));
+}
+
+void MstTransportGrpc::broadcastState(
+    const std::vector<std::shared_ptr<shared_model::interface::Peer>> &to,
+    ConstRefState providing_state) {
+  if (send_signature_deltas_ or to.size() < 2) {
+    MstTransport::broadcastState(to, providing_state);
+    return;
+  }
+
+  log_->info("Propagate MstState to {} peers", to.size());
+  auto proto_state = makeProtoState(providing_state, my_key_);
+  auto sender_factory = sender_factory_.value_or(default_sender_factory);
+  for (const auto &peer : to) {
+    sendProtoState(*peer, proto_state, *async_call_, sender_factory);
+  }
 }
 
 void iroha::network::sendStateAsync(
@@ -179,7 +357,12 @@ void sendStateAsyncImpl(const shared_model::interface::Peer &to,
                         const std::string &sender_key,
                         AsyncGrpcClient<google::protobuf::Empty> &async_call,
                         MstTransportGrpc::SenderFactory sender_factory) {
-  auto client = sender_factory(to);
+  sendProtoState(
+      to, makeProtoState(state, sender_key), async_call, sender_factory);
+}
+
+transport::MstState makeProtoState(ConstRefState state,
+                                   const std::string &sender_key) {
   transport::MstState protoState;
   protoState.set_source_peer_key(sender_key);
   state.iterateTransactions([&protoState](const auto &tx) {
@@ -188,7 +371,16 @@ void sendStateAsyncImpl(const shared_model::interface::Peer &to,
         std::static_pointer_cast<shared_model::proto::Transaction>(tx)
             ->getTransport();
   });
-  async_call.Call([&](auto context, auto cq) {
-    return client->AsyncSendState(context, protoState, cq);
+  return protoState;
+}
+
+void sendProtoState(const shared_model::interface::Peer &to,
+                    const transport::MstState &proto_state,
+                    AsyncGrpcClient<google::protobuf::Empty> &async_call,
+                    const MstTransportGrpc::SenderFactory &sender_factory) {
+  auto client = sender_factory(to);
+  async_call.Call(to.address(), [&](auto context, auto cq) {
+    compressLargeMessage(*context, proto_state.ByteSizeLong());
+    return client->AsyncSendState(context, proto_state, cq);
   });
 }
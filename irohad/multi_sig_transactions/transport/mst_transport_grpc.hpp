@@ -9,6 +9,12 @@
 #include "mst.grpc.pb.h"
 #include "network/mst_transport.hpp"
 
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "cache/cache.hpp"
+#include "cryptography/hash.hpp"
 #include "cryptography/public_key.hpp"
 #include "interfaces/common_objects/common_objects_factory.hpp"
 #include "interfaces/iroha_internal/abstract_transport_factory.hpp"
@@ -17,6 +23,7 @@
 #include "logger/logger_fwd.hpp"
 #include "multi_sig_transactions/state/mst_state.hpp"
 #include "network/impl/async_grpc_client.hpp"
+#include "network/transaction_pool.hpp"
 
 namespace iroha {
 
@@ -49,7 +56,9 @@ namespace iroha {
           shared_model::crypto::PublicKey my_key,
           logger::LoggerPtr mst_state_logger,
           logger::LoggerPtr log,
-          boost::optional<SenderFactory> = boost::none);
+          boost::optional<SenderFactory> = boost::none,
+          bool send_signature_deltas = false,
+          std::shared_ptr<TransactionPool> transaction_pool = nullptr);
 
       /**
        * Server part of grpc SendState method call
@@ -69,6 +78,14 @@ namespace iroha {
       void sendState(const shared_model::interface::Peer &to,
                      ConstRefState providing_state) override;
 
+      /**
+       * Without signature deltas the message is built once for all the peers
+       */
+      void broadcastState(
+          const std::vector<std::shared_ptr<shared_model::interface::Peer>>
+              &to,
+          ConstRefState providing_state) override;
+
      private:
       /**
        * Flat map transport transactions to shared model
@@ -76,6 +93,24 @@ namespace iroha {
       shared_model::interface::types::SharedTxsCollectionType
       deserializeTransactions(const transport::MstState *request);
 
+      /**
+       * Restore transactions of signature deltas from the transactions
+       * received earlier
+       * @pre mutex_ is locked
+       */
+      shared_model::interface::types::SharedTxsCollectionType
+      restoreTransactions(const transport::MstState *request);
+
+      /**
+       * Add the batch to the message for the peer: with full payload, if it
+       * was not sent to the peer yet, and as signatures not sent to the peer
+       * otherwise
+       * @pre mutex_ is locked
+       */
+      void addBatch(const shared_model::interface::Peer &to,
+                    const shared_model::interface::TransactionBatch &batch,
+                    transport::MstState &proto_state);
+
       std::weak_ptr<MstTransportNotification> subscriber_;
       std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
           async_call_;
@@ -94,6 +129,20 @@ namespace iroha {
       logger::LoggerPtr log_;               ///< Logger for local use.
 
       boost::optional<SenderFactory> sender_factory_;
+
+      const bool send_signature_deltas_;
+      /// received transactions are replaced by their pooled instances
+      std::shared_ptr<TransactionPool> transaction_pool_;
+      std::mutex mutex_;
+      /// received transactions, used to restore transactions of deltas
+      iroha::cache::ClockCache<shared_model::crypto::Hash,
+                               iroha::protocol::Transaction,
+                               shared_model::crypto::Hash::Hasher>
+          received_transactions_;
+      /// hex public keys of signatures sent to a peer, keyed by the peer key
+      /// and the transaction hash
+      iroha::cache::ClockCache<std::string, std::vector<std::string>>
+          sent_signatures_;
     };
 
     void sendStateAsync(const shared_model::interface::Peer &to,
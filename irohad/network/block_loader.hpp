@@ -30,6 +30,22 @@ namespace iroha {
       retrieveBlocks(const shared_model::interface::types::HeightType height,
                      const shared_model::crypto::PublicKey &peer_pubkey) = 0;
 
+      /**
+       * Retrieve blocks from several peers concurrently. Heights up to
+       * target_height are split into ranges, which are loaded from different
+       * peers, blocks above it are loaded together with the last range
+       * @param height - top block height in requester's peer storage
+       * @param target_height - height which the peers are expected to have
+       * @param peer_pubkeys - peers for requesting blocks, the first one is
+       * used if ranges can not be loaded from several peers
+       * @return blocks in order of their heights
+       */
+      virtual rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+      retrieveBlocks(
+          const shared_model::interface::types::HeightType height,
+          const shared_model::interface::types::HeightType target_height,
+          const std::vector<shared_model::crypto::PublicKey> &peer_pubkeys) = 0;
+
       /**
        * Retrieve block by its block_height from given peer
        * @param peer_pubkey - peer for requesting blocks
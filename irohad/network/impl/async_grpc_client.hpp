@@ -6,53 +6,68 @@
 #ifndef IROHA_ASYNC_GRPC_CLIENT_HPP
 #define IROHA_ASYNC_GRPC_CLIENT_HPP
 
+#include <algorithm>
+#include <atomic>
 #include <ciso646>
+#include <functional>
+#include <memory>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include <google/protobuf/empty.pb.h>
 #include <grpc++/grpc++.h>
 #include <grpcpp/impl/codegen/async_unary_call.h>
 #include "logger/logger.hpp"
+#include "metrics/metrics.hpp"
 
 namespace iroha {
   namespace network {
 
     /**
-     * Asynchronous gRPC client which does no processing of server responses
+     * Asynchronous gRPC client which does no processing of server responses.
+     * Calls are completed by a pool of completion queues, each served by its
+     * own thread. Calls to the same peer are always completed by the same
+     * queue, so that a slow peer delays only the peers sharing its queue.
      * @tparam Response type of server response
      */
     template <typename Response>
     class AsyncGrpcClient {
      public:
-      explicit AsyncGrpcClient(logger::LoggerPtr log)
-          : thread_(&AsyncGrpcClient::asyncCompleteRpc, this),
-            log_(std::move(log)) {}
-
       /**
-       * Listen to gRPC server responses
+       * @param log - logger
+       * @param queues - number of completion queues and threads completing
+       * the calls
        */
-      void asyncCompleteRpc() {
-        void *got_tag;
-        auto ok = false;
-        while (cq_.Next(&got_tag, &ok)) {
-          auto call = static_cast<AsyncClientCall *>(got_tag);
-          if (not call->status.ok()) {
-            log_->warn("RPC failed: {}", call->status.error_message());
-          }
-          delete call;
+      explicit AsyncGrpcClient(logger::LoggerPtr log, size_t queues = 1)
+          : log_(std::move(log)) {
+        queues = std::max<size_t>(queues, 1);
+        queues_.reserve(queues);
+        for (size_t i = 0; i < queues; ++i) {
+          queues_.push_back(std::make_unique<Queue>(
+              metrics::registry().gauge(
+                  "iroha_grpc_client_queue_" + std::to_string(i)
+                      + "_pending_calls",
+                  "Number of outgoing gRPC calls waiting for completion in "
+                  "the completion queue")));
+        }
+        for (auto &queue : queues_) {
+          queue->thread =
+              std::thread(&AsyncGrpcClient::asyncCompleteRpc, this, queue.get());
         }
       }
 
       ~AsyncGrpcClient() {
-        cq_.Shutdown();
-        if (thread_.joinable()) {
-          thread_.join();
+        for (auto &queue : queues_) {
+          queue->cq.Shutdown();
+        }
+        for (auto &queue : queues_) {
+          if (queue->thread.joinable()) {
+            queue->thread.join();
+          }
         }
       }
 
-      grpc::CompletionQueue cq_;
-      std::thread thread_;
-
       /**
        * State and data information of gRPC call
        */
@@ -68,19 +83,68 @@ namespace iroha {
       };
 
       /**
-       * Universal method to perform all needed sends
+       * Universal method to perform all needed sends, the completion queue is
+       * chosen in turn
        * @tparam lambda which must return unique pointer to
        * ClientAsyncResponseReader<Response> object
        */
       template <typename F>
       void Call(F &&lambda) {
+        call(*queues_[next_queue_.fetch_add(1, std::memory_order_relaxed)
+                      % queues_.size()],
+             std::forward<F>(lambda));
+      }
+
+      /**
+       * Perform a send to the peer, which is completed by the completion
+       * queue of the peer
+       * @param peer - address of the peer
+       * @tparam lambda which must return unique pointer to
+       * ClientAsyncResponseReader<Response> object
+       */
+      template <typename F>
+      void Call(const std::string &peer, F &&lambda) {
+        call(*queues_[std::hash<std::string>{}(peer) % queues_.size()],
+             std::forward<F>(lambda));
+      }
+
+     private:
+      /// completion queue with the thread serving it
+      struct Queue {
+        explicit Queue(metrics::Gauge &pending) : pending(pending) {}
+
+        grpc::CompletionQueue cq;
+        std::thread thread;
+        metrics::Gauge &pending;
+      };
+
+      template <typename F>
+      void call(Queue &queue, F &&lambda) {
         auto call = new AsyncClientCall;
-        call->response_reader = lambda(&call->context, &cq_);
+        call->response_reader = lambda(&call->context, &queue.cq);
+        queue.pending.add(1);
         call->response_reader->Finish(&call->reply, &call->status, call);
       }
 
-     private:
+      /**
+       * Listen to gRPC server responses
+       */
+      void asyncCompleteRpc(Queue *queue) {
+        void *got_tag;
+        auto ok = false;
+        while (queue->cq.Next(&got_tag, &ok)) {
+          auto call = static_cast<AsyncClientCall *>(got_tag);
+          queue->pending.add(-1);
+          if (not call->status.ok()) {
+            log_->warn("RPC failed: {}", call->status.error_message());
+          }
+          delete call;
+        }
+      }
+
       logger::LoggerPtr log_;
+      std::vector<std::unique_ptr<Queue>> queues_;
+      std::atomic<size_t> next_queue_{0};
     };
   }  // namespace network
 }  // namespace iroha
@@ -6,14 +6,22 @@
 #include "network/impl/block_loader_impl.hpp"
 
 #include <grpc++/create_channel.h>
+#include <algorithm>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
 
 #include "backend/protobuf/block.hpp"
 #include "builders/protobuf/transport_builder.hpp"
 #include "common/bind.hpp"
+#include "common/thread_pool.hpp"
 #include "interfaces/common_objects/peer.hpp"
 #include "logger/logger.hpp"
 #include "network/impl/grpc_channel_builder.hpp"
+#include "network/peer_chunking.hpp"
 
 using namespace iroha::ametsuchi;
 using namespace iroha::network;
@@ -25,15 +33,302 @@ namespace {
   const char *kPeerRetrieveFail = "Failed to retrieve peers";
   const char *kPeerFindFail = "Failed to find requested peer";
   const std::chrono::seconds kBlocksRequestTimeout{5};
+  /// blocks read and validated at once by each thread of the pool
+  const size_t kBlocksPerThread = 8;
+
+  /**
+   * Read blocks on a separate thread, validate them in chunks on the pool and
+   * emit them in order on the calling thread. Validated blocks are queued up
+   * to a chunk ahead of the subscriber, so download and validation of the
+   * following blocks overlaps with processing of the emitted ones
+   */
+  template <typename Subscriber>
+  void readAndValidateAhead(
+      grpc::ClientReaderInterface<iroha::protocol::Block> &reader,
+      grpc::ClientContext &context,
+      Subscriber &subscriber,
+      shared_model::proto::ProtoBlockFactory &block_factory,
+      iroha::ThreadPool &pool,
+      const logger::LoggerPtr &log) {
+    const size_t chunk_size = kBlocksPerThread * (pool.size() + 1);
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::shared_ptr<Block>> validated;
+    bool loading_finished = false;
+    bool stopped = false;
+
+    std::thread loader([&] {
+      std::vector<iroha::protocol::Block> chunk(chunk_size);
+      std::vector<std::shared_ptr<Block>> blocks(chunk_size);
+      std::vector<std::string> errors(chunk_size);
+      bool failed = false;
+      while (not failed) {
+        size_t count = 0;
+        while (count < chunk_size and reader.Read(&chunk[count])) {
+          ++count;
+        }
+        if (count == 0) {
+          break;
+        }
+
+        pool.parallelFor(count, [&](size_t i) {
+          block_factory.createBlock(std::move(chunk[i]))
+              .match([&](auto &&result) { blocks[i] = std::move(result.value); },
+                     [&](const auto &error) {
+                       blocks[i] = nullptr;
+                       errors[i] = error.error;
+                     });
+        });
+
+        std::unique_lock<std::mutex> lock(mutex);
+        for (size_t i = 0; i < count; ++i) {
+          if (not blocks[i]) {
+            log->error("{}", errors[i]);
+            context.TryCancel();
+            failed = true;
+            break;
+          }
+          validated.push_back(std::move(blocks[i]));
+        }
+        cv.notify_all();
+        cv.wait(lock,
+                [&] { return stopped or validated.size() < chunk_size; });
+        failed = failed or stopped;
+      }
+      std::lock_guard<std::mutex> lock(mutex);
+      loading_finished = true;
+      cv.notify_all();
+    });
+
+    while (true) {
+      std::shared_ptr<Block> block;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock,
+                [&] { return loading_finished or not validated.empty(); });
+        if (validated.empty()) {
+          break;
+        }
+        block = std::move(validated.front());
+        validated.pop_front();
+      }
+      cv.notify_all();
+
+      subscriber.on_next(std::move(block));
+      if (not subscriber.is_subscribed()) {
+        {
+          std::lock_guard<std::mutex> lock(mutex);
+          stopped = true;
+        }
+        context.TryCancel();
+        cv.notify_all();
+        break;
+      }
+    }
+    loader.join();
+  }
+
+  /// heights loaded from a peer with a single request
+  const shared_model::interface::types::HeightType kBlocksPerRange = 100;
+  /// ranges loaded ahead of the emitted ones, per peer
+  const size_t kRangesAheadPerPeer = 2;
+
+  /**
+   * Load heights (height, target_height] in ranges from several peers
+   * concurrently, one thread per peer, and emit the blocks in order on the
+   * calling thread. The last range is not bounded, so blocks above
+   * target_height are loaded with it. Blocks of a range are validated in
+   * parallel on the pool, if it is given. A range which a peer fails to load
+   * is returned to the queue and the peer is not used anymore
+   */
+  template <typename Subscriber>
+  void loadRangesFromPeers(
+      const std::vector<proto::Loader::StubInterface *> &stubs,
+      shared_model::interface::types::HeightType height,
+      shared_model::interface::types::HeightType target_height,
+      Subscriber &subscriber,
+      shared_model::proto::ProtoBlockFactory &block_factory,
+      iroha::ThreadPool *pool,
+      const logger::LoggerPtr &log) {
+    using shared_model::interface::types::HeightType;
+    struct Range {
+      HeightType begin;
+      HeightType end;  ///< 0 for the unbounded last range
+    };
+    std::vector<Range> ranges;
+    for (HeightType begin = height + 1; begin <= target_height;
+         begin += kBlocksPerRange) {
+      ranges.push_back({begin, begin + kBlocksPerRange - 1});
+    }
+    ranges.back().end = 0;
+
+    const size_t window = kRangesAheadPerPeer * stubs.size();
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<size_t> pending;
+    for (size_t i = 0; i < ranges.size(); ++i) {
+      pending.push_back(i);
+    }
+    std::map<size_t, std::vector<std::shared_ptr<Block>>> loaded;
+    size_t next_to_emit = 0;
+    size_t active_loaders = stubs.size();
+    bool stopped = false;
+    std::vector<grpc::ClientContext *> contexts(stubs.size(), nullptr);
+
+    auto load_range = [&](size_t peer, const Range &range)
+        -> boost::optional<std::vector<std::shared_ptr<Block>>> {
+      grpc::ClientContext context;
+      context.set_deadline(std::chrono::system_clock::now()
+                           + kBlocksRequestTimeout);
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (stopped) {
+          return boost::none;
+        }
+        contexts[peer] = &context;
+      }
+
+      proto::BlockRequest request;
+      request.set_height(range.begin);
+      request.set_end_height(range.end);
+      std::vector<iroha::protocol::Block> received;
+      iroha::protocol::Block block;
+      bool valid = true;
+      auto reader = stubs[peer]->retrieveBlocks(&context, request);
+      while (reader->Read(&block)) {
+        auto block_height = block.block_v1().payload().height();
+        valid = block_height == range.begin + received.size();
+        received.push_back(std::move(block));
+        // peers not supporting end_height stream up to their top block
+        if (not valid or block_height == range.end) {
+          context.TryCancel();
+          break;
+        }
+      }
+      reader->Finish();
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        contexts[peer] = nullptr;
+      }
+      if (not valid) {
+        return boost::none;
+      }
+
+      std::vector<std::shared_ptr<Block>> blocks(received.size());
+      auto create_block = [&](size_t i) {
+        block_factory.createBlock(std::move(received[i]))
+            .match([&](auto &&result) { blocks[i] = std::move(result.value); },
+                   [&](const auto &error) { log->error("{}", error.error); });
+      };
+      if (pool) {
+        pool->parallelFor(received.size(), create_block);
+      } else {
+        for (size_t i = 0; i < received.size(); ++i) {
+          create_block(i);
+        }
+      }
+      valid = std::all_of(blocks.begin(),
+                          blocks.end(),
+                          [](const auto &created) { return bool(created); });
+
+      auto last_height = range.begin + blocks.size() - 1;
+      if (not valid or blocks.empty()
+          or last_height < (range.end != 0 ? range.end : target_height)) {
+        return boost::none;
+      }
+      return blocks;
+    };
+
+    std::vector<std::thread> loaders;
+    for (size_t peer = 0; peer < stubs.size(); ++peer) {
+      loaders.emplace_back([&, peer] {
+        while (true) {
+          size_t range_index;
+          {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait(lock, [&] {
+              return stopped or pending.empty()
+                  or pending.front() < next_to_emit + window;
+            });
+            if (stopped or pending.empty()) {
+              break;
+            }
+            range_index = pending.front();
+            pending.pop_front();
+          }
+
+          auto blocks = load_range(peer, ranges[range_index]);
+
+          std::lock_guard<std::mutex> lock(mutex);
+          if (not blocks) {
+            log->info(
+                "Failed to load blocks starting from {}, the peer is not used "
+                "anymore",
+                ranges[range_index].begin);
+            pending.push_front(range_index);
+            break;
+          }
+          loaded.emplace(range_index, std::move(*blocks));
+          cv.notify_all();
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        --active_loaders;
+        cv.notify_all();
+      });
+    }
+
+    auto stop = [&] {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopped = true;
+      for (auto context : contexts) {
+        if (context) {
+          context->TryCancel();
+        }
+      }
+      cv.notify_all();
+    };
+
+    while (next_to_emit < ranges.size() and subscriber.is_subscribed()) {
+      std::vector<std::shared_ptr<Block>> blocks;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&] {
+          return loaded.count(next_to_emit) != 0 or active_loaders == 0;
+        });
+        auto it = loaded.find(next_to_emit);
+        if (it == loaded.end()) {
+          break;
+        }
+        blocks = std::move(it->second);
+        loaded.erase(it);
+        ++next_to_emit;
+      }
+      cv.notify_all();
+
+      for (auto &block : blocks) {
+        if (not subscriber.is_subscribed()) {
+          break;
+        }
+        subscriber.on_next(std::move(block));
+      }
+    }
+
+    stop();
+    for (auto &loader : loaders) {
+      loader.join();
+    }
+  }
 }  // namespace
 
 BlockLoaderImpl::BlockLoaderImpl(
     std::shared_ptr<PeerQueryFactory> peer_query_factory,
     shared_model::proto::ProtoBlockFactory factory,
-    logger::LoggerPtr log)
+    logger::LoggerPtr log,
+    std::shared_ptr<iroha::ThreadPool> verification_pool)
     : peer_query_factory_(std::move(peer_query_factory)),
       block_factory_(std::move(factory)),
-      log_(std::move(log)) {}
+      log_(std::move(log)),
+      verification_pool_(std::move(verification_pool)) {}
 
 rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlocks(
     const shared_model::interface::types::HeightType height,
@@ -60,22 +355,68 @@ rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlocks(
 
         auto reader =
             this->getPeerStub(**peer).retrieveBlocks(&context, request);
-        while (subscriber.is_subscribed() and reader->Read(&block)) {
-          block_factory_.createBlock(std::move(block))
-              .match(
-                  [&subscriber](auto &&result) {
-                    subscriber.on_next(std::move(result.value));
-                  },
-                  [this, &context](const auto &error) {
-                    log_->error("{}", error.error);
-                    context.TryCancel();
-                  });
+        if (verification_pool_) {
+          readAndValidateAhead(*reader,
+                               context,
+                               subscriber,
+                               block_factory_,
+                               *verification_pool_,
+                               log_);
+        } else {
+          while (subscriber.is_subscribed() and reader->Read(&block)) {
+            block_factory_.createBlock(std::move(block))
+                .match(
+                    [&subscriber](auto &&result) {
+                      subscriber.on_next(std::move(result.value));
+                    },
+                    [this, &context](const auto &error) {
+                      log_->error("{}", error.error);
+                      context.TryCancel();
+                    });
+          }
         }
         reader->Finish();
         subscriber.on_completed();
       });
 }
 
+rxcpp::observable<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlocks(
+    const shared_model::interface::types::HeightType height,
+    const shared_model::interface::types::HeightType target_height,
+    const std::vector<PublicKey> &peer_pubkeys) {
+  return rxcpp::observable<>::create<std::shared_ptr<Block>>(
+      [this, height, target_height, peer_pubkeys](auto subscriber) {
+        std::vector<proto::Loader::StubInterface *> stubs;
+        std::vector<const PublicKey *> found_pubkeys;
+        for (const auto &peer_pubkey : peer_pubkeys) {
+          if (auto peer = this->findPeer(peer_pubkey)) {
+            stubs.push_back(&this->getPeerStub(**peer));
+            found_pubkeys.push_back(&peer_pubkey);
+          }
+        }
+
+        if (stubs.empty()) {
+          log_->error("{}", kPeerNotFound);
+          subscriber.on_completed();
+          return;
+        }
+        if (stubs.size() == 1 or target_height <= height + kBlocksPerRange) {
+          this->retrieveBlocks(height, *found_pubkeys.front())
+              .subscribe(subscriber);
+          return;
+        }
+
+        loadRangesFromPeers(stubs,
+                            height,
+                            target_height,
+                            subscriber,
+                            block_factory_,
+                            verification_pool_.get(),
+                            log_);
+        subscriber.on_completed();
+      });
+}
+
 boost::optional<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlock(
     const PublicKey &peer_pubkey, types::HeightType block_height) {
   auto peer = findPeer(peer_pubkey);
@@ -91,7 +432,32 @@ boost::optional<std::shared_ptr<Block>> BlockLoaderImpl::retrieveBlock(
   // request block with specified height
   request.set_height(block_height);
 
-  auto status = getPeerStub(**peer).retrieveBlock(&context, request, &block);
+  grpc::Status status;
+  const auto max_chunk_bytes = peerChunking().max_chunk_bytes;
+  if (max_chunk_bytes == 0) {
+    status = getPeerStub(**peer).retrieveBlock(&context, request, &block);
+  } else {
+    // every part is parsed while the next ones are transferred
+    request.set_max_chunk_bytes(max_chunk_bytes);
+    auto reader = getPeerStub(**peer).retrieveBlockChunks(&context, request);
+    auto transactions = [](protocol::Block &message) {
+      return message.mutable_block_v1()
+          ->mutable_payload()
+          ->mutable_transactions();
+    };
+    protocol::Block chunk;
+    bool received = false;
+    while (reader->Read(&chunk)) {
+      if (not received) {
+        block.Swap(&chunk);
+        received = true;
+      } else {
+        appendChunk(*transactions(chunk), *transactions(block));
+      }
+      chunk.Clear();
+    }
+    status = reader->Finish();
+  }
   if (not status.ok()) {
     log_->warn("{}", status.error_message());
     return boost::none;
@@ -137,7 +503,7 @@ proto::Loader::StubInterface &BlockLoaderImpl::getPeerStub(
     it = peer_connections_
              .insert(std::make_pair(
                  peer.address(),
-                 network::createClient<proto::Loader>(peer.address())))
+                 network::createPeerClient<proto::Loader>(peer.address())))
              .first;
   }
   return *it->second;
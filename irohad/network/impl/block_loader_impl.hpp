@@ -16,20 +16,38 @@
 #include "logger/logger_fwd.hpp"
 
 namespace iroha {
+  class ThreadPool;
+
   namespace network {
     class BlockLoaderImpl : public BlockLoader {
      public:
+      /**
+       * @param peer_query_factory - factory to find peers to load from
+       * @param factory - factory validating received blocks
+       * @param log - logger
+       * @param verification_pool - threads validating blocks received by
+       * retrieveBlocks ahead of the consumer, nullptr to validate each block
+       * on the reading thread right before it is emitted
+       */
       // TODO 30.01.2019 lebdron: IR-264 Remove PeerQueryFactory
       BlockLoaderImpl(
           std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
           shared_model::proto::ProtoBlockFactory factory,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          std::shared_ptr<ThreadPool> verification_pool = nullptr);
 
       rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
       retrieveBlocks(
           const shared_model::interface::types::HeightType height,
           const shared_model::crypto::PublicKey &peer_pubkey) override;
 
+      rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>
+      retrieveBlocks(
+          const shared_model::interface::types::HeightType height,
+          const shared_model::interface::types::HeightType target_height,
+          const std::vector<shared_model::crypto::PublicKey> &peer_pubkeys)
+          override;
+
       boost::optional<std::shared_ptr<shared_model::interface::Block>>
       retrieveBlock(
           const shared_model::crypto::PublicKey &peer_pubkey,
@@ -59,6 +77,8 @@ namespace iroha {
       shared_model::proto::ProtoBlockFactory block_factory_;
 
       logger::LoggerPtr log_;
+
+      std::shared_ptr<ThreadPool> verification_pool_;
     };
   }  // namespace network
 }  // namespace iroha
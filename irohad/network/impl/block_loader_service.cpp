@@ -5,9 +5,14 @@
 
 #include "network/impl/block_loader_service.hpp"
 
+#include <algorithm>
+
+#include <google/protobuf/unknown_field_set.h>
 #include "backend/protobuf/block.hpp"
 #include "common/bind.hpp"
 #include "logger/logger.hpp"
+#include "network/impl/grpc_compression.hpp"
+#include "network/peer_chunking.hpp"
 
 using namespace iroha;
 using namespace iroha::ametsuchi;
@@ -32,14 +37,64 @@ static grpc::Status handleGetBlockError(const BlockQuery::GetBlockError &error,
   }
 }
 
+/**
+ * Serialize the block directly as the block_v1 field of the message, instead
+ * of copying its transport object into the message and serializing the copy
+ * when the message is sent
+ */
+static void setBlockV1(const shared_model::interface::Block &block,
+                       protocol::Block &message) {
+  static_cast<const shared_model::proto::Block &>(block)
+      .getTransport()
+      .SerializeToString(
+          message.GetReflection()
+              ->MutableUnknownFields(&message)
+              ->AddLengthDelimited(protocol::Block::kBlockV1FieldNumber));
+}
+
+/**
+ * Put the block with given height into the message, as it is stored if
+ * possible, so that the block is not parsed and serialized again
+ * @return error status if the block could not be retrieved
+ */
+static boost::optional<grpc::Status> loadBlock(
+    BlockQuery &block_query,
+    shared_model::interface::types::HeightType height,
+    protocol::Block &message,
+    const logger::LoggerPtr &log) {
+  if (auto serialized_block = block_query.getSerializedBlock(height)) {
+    // the block_v1 field of the stored block is kept as an unknown field of
+    // the message, without parsing its content
+    if (message.GetReflection()
+            ->MutableUnknownFields(&message)
+            ->ParseFromString(*serialized_block)) {
+      return boost::none;
+    }
+    log->warn("Stored block {} is corrupted", height);
+    message.Clear();
+  }
+
+  auto block_result = block_query.getBlock(height);
+  if (auto e = expected::resultToOptionalError(block_result)) {
+    return handleGetBlockError(e.value(), log);
+  }
+  setBlockV1(
+      *boost::get<expected::ValueOf<decltype(block_result)>>(block_result)
+           .value,
+      message);
+  return boost::none;
+}
+
 BlockLoaderService::BlockLoaderService(
     std::shared_ptr<BlockQueryFactory> block_query_factory,
     std::shared_ptr<iroha::consensus::ConsensusResultCache>
         consensus_result_cache,
-    logger::LoggerPtr log)
+    logger::LoggerPtr log,
+    std::shared_ptr<WsvSnapshotFactory> snapshot_factory)
     : block_query_factory_(std::move(block_query_factory)),
       consensus_result_cache_(std::move(consensus_result_cache)),
-      log_(std::move(log)) {}
+      log_(std::move(log)),
+      snapshot_factory_(std::move(snapshot_factory)) {}
 
 grpc::Status BlockLoaderService::retrieveBlocks(
     ::grpc::ServerContext *context,
@@ -52,24 +107,19 @@ grpc::Status BlockLoaderService::retrieveBlocks(
   }
 
   auto top_height = (*block_query)->getTopBlockHeight();
+  if (request->end_height() != 0) {
+    top_height =
+        std::min<decltype(top_height)>(top_height, request->end_height());
+  }
+  enableStreamCompression(*context);
   for (decltype(top_height) i = request->height(); i <= top_height; ++i) {
-    auto block_result = (*block_query)->getBlock(i);
-
-    if (auto e = expected::resultToOptionalError(block_result)) {
-      return handleGetBlockError(e.value(), log_);
-    }
-
-    auto &block =
-        boost::get<
-            expected::Value<std::unique_ptr<shared_model::interface::Block>>>(
-            block_result)
-            .value;
-
     protocol::Block proto_block;
-    *proto_block.mutable_block_v1() =
-        static_cast<shared_model::proto::Block *>(block.get())->getTransport();
+    if (auto error = loadBlock(**block_query, i, proto_block, log_)) {
+      return *error;
+    }
 
-    writer->Write(proto_block);
+    writer->Write(proto_block,
+                  compressionWriteOptions(proto_block.ByteSizeLong()));
   }
 
   return grpc::Status::OK;
@@ -79,17 +129,73 @@ grpc::Status BlockLoaderService::retrieveBlock(
     ::grpc::ServerContext *context,
     const proto::BlockRequest *request,
     protocol::Block *response) {
-  const auto height = request->height();
+  if (auto error = loadRequestedBlock(request->height(), *response)) {
+    return *error;
+  }
+  compressLargeMessage(*context, response->ByteSizeLong());
+  return grpc::Status::OK;
+}
+
+grpc::Status BlockLoaderService::retrieveBlockChunks(
+    ::grpc::ServerContext *context,
+    const proto::BlockRequest *request,
+    ::grpc::ServerWriter<protocol::Block> *writer) {
+  protocol::Block loaded;
+  if (auto error = loadRequestedBlock(request->height(), loaded)) {
+    return *error;
+  }
+  // the block may be kept serialized as an unknown field
+  protocol::Block block;
+  if (not block.ParseFromString(loaded.SerializeAsString())) {
+    log_->error("Could not parse block {}", request->height());
+    return grpc::Status(grpc::StatusCode::INTERNAL, "internal error happened");
+  }
+
+  auto &transactions =
+      *block.mutable_block_v1()->mutable_payload()->mutable_transactions();
+  std::vector<size_t> sizes;
+  for (const auto &tx : transactions) {
+    sizes.push_back(tx.ByteSizeLong());
+  }
+  auto ends = chunkEnds(sizes, request->max_chunk_bytes());
+  // transactions of the parts after the first one are moved out of the block
+  // from the end, and the rest of the block is the first part
+  std::vector<protocol::Block> chunks(ends.size());
+  for (size_t i = ends.size() - 1; i > 0; --i) {
+    std::vector<protocol::Transaction *> extracted(ends[i] - ends[i - 1]);
+    transactions.ExtractSubrange(static_cast<int>(ends[i - 1]),
+                                 static_cast<int>(extracted.size()),
+                                 extracted.data());
+    auto &chunk_transactions = *chunks[i]
+                                    .mutable_block_v1()
+                                    ->mutable_payload()
+                                    ->mutable_transactions();
+    for (auto tx : extracted) {
+      chunk_transactions.AddAllocated(tx);
+    }
+  }
+  chunks.front().Swap(&block);
 
+  enableStreamCompression(*context);
+  for (const auto &chunk : chunks) {
+    if (context->IsCancelled()
+        or not writer->Write(chunk,
+                             compressionWriteOptions(chunk.ByteSizeLong()))) {
+      break;
+    }
+  }
+  return grpc::Status::OK;
+}
+
+boost::optional<grpc::Status> BlockLoaderService::loadRequestedBlock(
+    shared_model::interface::types::HeightType height,
+    protocol::Block &message) {
   // try to fetch block from the consensus cache
   auto cached_block = consensus_result_cache_->get();
   if (cached_block) {
     if (cached_block->height() == height) {
-      auto block_v1 =
-          std::static_pointer_cast<shared_model::proto::Block>(cached_block)
-              ->getTransport();
-      *response->mutable_block_v1() = block_v1;
-      return grpc::Status::OK;
+      setBlockV1(*cached_block, message);
+      return boost::none;
     } else {
       log_->info(
           "Requested to retrieve a block, but cache contains another block: "
@@ -111,17 +217,75 @@ grpc::Status BlockLoaderService::retrieveBlock(
     return grpc::Status(grpc::StatusCode::INTERNAL, "internal error happened");
   }
 
-  auto block_result = (*block_query)->getBlock(height);
+  return loadBlock(**block_query, height, message, log_);
+}
+
+grpc::Status BlockLoaderService::retrieveSnapshot(
+    ::grpc::ServerContext *context,
+    const proto::SnapshotRequest *request,
+    ::grpc::ServerWriter<proto::SnapshotPart> *writer) {
+  if (not snapshot_factory_) {
+    return grpc::Status(grpc::StatusCode::UNIMPLEMENTED,
+                        "snapshots are not supported");
+  }
+  auto exporter = snapshot_factory_->createWsvSnapshotExporter();
+  if (not exporter) {
+    log_->error("Could not create WSV snapshot exporter");
+    return grpc::Status(grpc::StatusCode::INTERNAL, "internal error happened");
+  }
+
+  enableStreamCompression(*context);
+  proto::SnapshotPart part;
+  auto result = (*exporter)->exportSnapshot([&](const auto &chunk) {
+    auto &proto_chunk = *part.mutable_chunk();
+    proto_chunk.set_table(chunk.table);
+    proto_chunk.set_rows(chunk.rows);
+    proto_chunk.set_hash(chunk.hash.blob().data(), chunk.hash.blob().size());
+    return not context->IsCancelled()
+        and writer->Write(part, compressionWriteOptions(part.ByteSizeLong()));
+  });
 
-  if (auto e = expected::resultToOptionalError(block_result)) {
-    return handleGetBlockError(e.value(), log_);
+  return result.match(
+      [&](const auto &top_block) {
+        setBlockV1(*top_block.value, *part.mutable_top_block());
+        writer->Write(part, compressionWriteOptions(part.ByteSizeLong()));
+        return grpc::Status::OK;
+      },
+      [this](const auto &error) {
+        log_->error("Could not export WSV snapshot: {}", error.error);
+        return grpc::Status(grpc::StatusCode::INTERNAL, error.error);
+      });
+}
+
+grpc::Status BlockLoaderService::retrieveSnapshotDigest(
+    ::grpc::ServerContext *context,
+    const proto::SnapshotRequest *request,
+    proto::SnapshotDigest *response) {
+  if (not snapshot_factory_) {
+    return grpc::Status(grpc::StatusCode::UNIMPLEMENTED,
+                        "snapshots are not supported");
+  }
+  auto exporter = snapshot_factory_->createWsvSnapshotExporter();
+  if (not exporter) {
+    log_->error("Could not create WSV snapshot exporter");
+    return grpc::Status(grpc::StatusCode::INTERNAL, "internal error happened");
   }
 
-  auto &block =
-      boost::get<expected::ValueOf<decltype(block_result)>>(block_result).value;
+  // the last chunk hash covers the whole snapshot
+  auto result = (*exporter)->exportSnapshot([&](const auto &chunk) {
+    response->set_hash(chunk.hash.blob().data(), chunk.hash.blob().size());
+    return not context->IsCancelled();
+  });
 
-  const auto &block_v1 =
-      static_cast<shared_model::proto::Block *>(block.get())->getTransport();
-  *response->mutable_block_v1() = block_v1;
-  return grpc::Status::OK;
+  return result.match(
+      [&](const auto &top_block) {
+        const auto &hash = top_block.value->hash();
+        response->set_height(top_block.value->height());
+        response->set_top_block_hash(hash.blob().data(), hash.blob().size());
+        return grpc::Status::OK;
+      },
+      [this](const auto &error) {
+        log_->error("Could not export WSV snapshot digest: {}", error.error);
+        return grpc::Status(grpc::StatusCode::INTERNAL, error.error);
+      });
 }
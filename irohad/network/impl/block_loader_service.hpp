@@ -6,8 +6,11 @@
 #ifndef IROHA_BLOCK_LOADER_SERVICE_HPP
 #define IROHA_BLOCK_LOADER_SERVICE_HPP
 
+#include <boost/optional.hpp>
 #include "ametsuchi/block_query_factory.hpp"
+#include "ametsuchi/wsv_snapshot_factory.hpp"
 #include "consensus/consensus_block_cache.hpp"
+#include "interfaces/common_objects/types.hpp"
 #include "loader.grpc.pb.h"
 #include "logger/logger_fwd.hpp"
 
@@ -19,7 +22,9 @@ namespace iroha {
           std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
           std::shared_ptr<iroha::consensus::ConsensusResultCache>
               consensus_result_cache,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          std::shared_ptr<ametsuchi::WsvSnapshotFactory> snapshot_factory =
+              nullptr);
 
       grpc::Status retrieveBlocks(
           ::grpc::ServerContext *context,
@@ -30,11 +35,36 @@ namespace iroha {
                                  const proto::BlockRequest *request,
                                  protocol::Block *response) override;
 
+      grpc::Status retrieveBlockChunks(
+          ::grpc::ServerContext *context,
+          const proto::BlockRequest *request,
+          ::grpc::ServerWriter<protocol::Block> *writer) override;
+
+      grpc::Status retrieveSnapshot(
+          ::grpc::ServerContext *context,
+          const proto::SnapshotRequest *request,
+          ::grpc::ServerWriter<proto::SnapshotPart> *writer) override;
+
+      grpc::Status retrieveSnapshotDigest(
+          ::grpc::ServerContext *context,
+          const proto::SnapshotRequest *request,
+          proto::SnapshotDigest *response) override;
+
      private:
+      /**
+       * Put the block with given height into the message, from the consensus
+       * cache if it is there, from the storage otherwise
+       * @return error status if the block could not be retrieved
+       */
+      boost::optional<grpc::Status> loadRequestedBlock(
+          shared_model::interface::types::HeightType height,
+          protocol::Block &message);
+
       std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory_;
       std::shared_ptr<iroha::consensus::ConsensusResultCache>
           consensus_result_cache_;
       logger::LoggerPtr log_;
+      std::shared_ptr<ametsuchi::WsvSnapshotFactory> snapshot_factory_;
     };
   }  // namespace network
 }  // namespace iroha
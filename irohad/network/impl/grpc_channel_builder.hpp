@@ -6,8 +6,13 @@
 #ifndef IROHA_GRPC_CHANNEL_BUILDER_HPP
 #define IROHA_GRPC_CHANNEL_BUILDER_HPP
 
+#include <ciso646>
 #include <limits>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <grpc++/grpc++.h>
 #include <boost/format.hpp>
@@ -20,14 +25,25 @@ namespace iroha {
       constexpr unsigned int kMaxResponseMessageBytes =
           std::numeric_limits<int>::max();
 
-      template <typename T>
-      grpc::ChannelArguments getChannelArguments() {
+      /**
+       * @param services - full names of the services called through the
+       * channel
+       * @return arguments of a channel with the retry policy and message
+       * size limits applied to every method of the services
+       */
+      inline grpc::ChannelArguments getChannelArguments(
+          const std::vector<std::string> &services) {
+        std::string names;
+        for (const auto &service : services) {
+          names += (names.empty() ? "" : ", ")
+              + (boost::format(R"({ "service": "%1%" })") % service).str();
+        }
         grpc::ChannelArguments args;
         args.SetServiceConfigJSON((boost::format(R"(
             {
               "methodConfig": [ {
                 "name": [
-                  { "service": "%1%" }
+                  %1%
                 ],
                 "retryPolicy": {
                   "maxAttempts": 5,
@@ -44,12 +60,24 @@ namespace iroha {
                 "maxRequestMessageBytes": %2%,
                 "maxResponseMessageBytes": %3%
               } ]
-            })") % T::service_full_name()
+            })") % names
                                    % kMaxRequestMessageBytes
                                    % kMaxResponseMessageBytes)
                                       .str());
         return args;
       }
+
+      template <typename T>
+      grpc::ChannelArguments getChannelArguments() {
+        return getChannelArguments({T::service_full_name()});
+      }
+
+      /// services which peers call on the internal port of each other
+      const std::vector<std::string> kPeerServices{
+          "iroha.consensus.yac.proto.Yac",
+          "iroha.ordering.proto.OnDemandOrdering",
+          "iroha.network.proto.Loader",
+          "iroha.network.transport.MstTransportGrpc"};
     }  // namespace details
 
     /**
@@ -68,6 +96,50 @@ namespace iroha {
                                     grpc::InsecureChannelCredentials(),
                                     details::getChannelArguments<T>()));
     }
+
+    /**
+     * Get the channel to the internal port of the peer, which is shared by
+     * the clients of all the peer services, so that they multiplex their
+     * calls over a single connection. The channel is created on first
+     * request and lives as long as some client uses it.
+     * @param address ip address of the peer, ipv4:port
+     * @return channel to the peer
+     */
+    inline std::shared_ptr<grpc::Channel> getPeerChannel(
+        const grpc::string &address) {
+      static std::mutex mutex;
+      static std::unordered_map<grpc::string, std::weak_ptr<grpc::Channel>>
+          channels;
+      std::lock_guard<std::mutex> lock(mutex);
+      auto &cached = channels[address];
+      auto channel = cached.lock();
+      if (not channel) {
+        for (auto it = channels.begin(); it != channels.end();) {
+          it = it->second.expired() and it->first != address
+              ? channels.erase(it)
+              : std::next(it);
+        }
+        channel = grpc::CreateCustomChannel(
+            address,
+            grpc::InsecureChannelCredentials(),
+            details::getChannelArguments(details::kPeerServices));
+        cached = channel;
+      }
+      return channel;
+    }
+
+    /**
+     * Creates client of a peer service, which calls the peer through the
+     * channel shared with the other peer services (see getPeerChannel()).
+     * @tparam T type for gRPC stub, e.g. proto::Yac
+     * @param address ip address of the peer, ipv4:port
+     * @return gRPC stub of parametrized type
+     */
+    template <typename T>
+    std::unique_ptr<typename T::StubInterface> createPeerClient(
+        const grpc::string &address) {
+      return T::NewStub(getPeerChannel(address));
+    }
   }  // namespace network
 }  // namespace iroha
 
@@ -0,0 +1,80 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_GRPC_COMPRESSION_HPP
+#define IROHA_GRPC_COMPRESSION_HPP
+
+#include <ciso646>
+
+#include <grpc++/grpc++.h>
+#include "network/peer_compression.hpp"
+
+namespace iroha {
+  namespace network {
+    namespace details {
+      inline grpc_compression_algorithm grpcAlgorithm(
+          CompressionAlgorithm algorithm) {
+        switch (algorithm) {
+          case CompressionAlgorithm::kDeflate:
+            return GRPC_COMPRESS_DEFLATE;
+          case CompressionAlgorithm::kGzip:
+            return GRPC_COMPRESS_GZIP;
+          default:
+            return GRPC_COMPRESS_NONE;
+        }
+      }
+    }  // namespace details
+
+    /**
+     * Compress the message of the call with the algorithm of
+     * peerCompression(), if the message is not smaller than its threshold
+     * @tparam Context - grpc::ClientContext for requests,
+     * grpc::ServerContext for responses
+     * @param context - context of the call, before the message is sent
+     * @param message_size - serialized size of the message
+     */
+    template <typename Context>
+    void compressLargeMessage(Context &context, size_t message_size) {
+      const auto &compression = peerCompression();
+      if (compression.algorithm != CompressionAlgorithm::kNone
+          and message_size >= compression.threshold) {
+        context.set_compression_algorithm(
+            details::grpcAlgorithm(compression.algorithm));
+      }
+    }
+
+    /**
+     * Enable compression of the messages streamed in the call with the
+     * algorithm of peerCompression(), the messages are then written with
+     * compressionWriteOptions()
+     * @tparam Context - grpc::ClientContext or grpc::ServerContext
+     * @param context - context of the call, before the first message is sent
+     */
+    template <typename Context>
+    void enableStreamCompression(Context &context) {
+      const auto &compression = peerCompression();
+      if (compression.algorithm != CompressionAlgorithm::kNone) {
+        context.set_compression_algorithm(
+            details::grpcAlgorithm(compression.algorithm));
+      }
+    }
+
+    /**
+     * @param message_size - serialized size of the streamed message
+     * @return options which skip compression of the message if it is smaller
+     * than the threshold of peerCompression()
+     */
+    inline grpc::WriteOptions compressionWriteOptions(size_t message_size) {
+      grpc::WriteOptions options;
+      if (message_size < peerCompression().threshold) {
+        options.set_no_compression();
+      }
+      return options;
+    }
+
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_GRPC_COMPRESSION_HPP
@@ -0,0 +1,122 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/transaction_pool.hpp"
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+#include "cryptography/public_key.hpp"
+#include "cryptography/signed.hpp"
+#include "interfaces/common_objects/signature.hpp"
+#include "interfaces/transaction.hpp"
+
+namespace {
+  /// pool is not purged until it has this number of entries
+  constexpr size_t kMinPurgeSize = 1024;
+
+  /// append the blob preceded by its size, so that the blobs are separated
+  void appendBlob(std::string &key, const shared_model::crypto::Blob &blob) {
+    const auto size = static_cast<uint32_t>(blob.size());
+    key.append(reinterpret_cast<const char *>(&size), sizeof(size));
+    key.append(blob.blob().begin(), blob.blob().end());
+  }
+
+  /// @return signatures of the transaction with their public keys, ordered
+  /// by the keys
+  std::string signaturesKey(const shared_model::interface::Transaction &tx) {
+    std::vector<const shared_model::interface::Signature *> signatures;
+    for (const auto &signature : tx.signatures()) {
+      signatures.push_back(&signature);
+    }
+    std::sort(signatures.begin(),
+              signatures.end(),
+              [](const auto *lhs, const auto *rhs) {
+                return std::tie(lhs->publicKey().blob(),
+                                lhs->signedData().blob())
+                    < std::tie(rhs->publicKey().blob(),
+                               rhs->signedData().blob());
+              });
+    std::string key;
+    for (const auto *signature : signatures) {
+      appendBlob(key, signature->publicKey());
+      appendBlob(key, signature->signedData());
+    }
+    return key;
+  }
+}  // namespace
+
+namespace iroha {
+  namespace network {
+
+    TransactionPool::TransactionPool()
+        : purge_size_(kMinPurgeSize),
+          shared_metric_(metrics::registry().counter(
+              "iroha_transaction_pool_shared_total",
+              "Received transactions replaced by their pooled instances")),
+          size_metric_(metrics::registry().gauge(
+              "iroha_transaction_pool_size",
+              "Entries of the pool of transactions alive in the peer")) {}
+
+    TransactionPool::TransactionPtr TransactionPool::intern(
+        TransactionPtr tx) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return internLocked(std::move(tx));
+    }
+
+    void TransactionPool::intern(
+        shared_model::interface::types::SharedTxsCollectionType &txs) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (auto &tx : txs) {
+        tx = internLocked(std::move(tx));
+      }
+    }
+
+    size_t TransactionPool::size() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return entries_.size();
+    }
+
+    TransactionPool::TransactionPtr TransactionPool::internLocked(
+        TransactionPtr tx) {
+      // signatures are still merged into incomplete transactions by MST, so
+      // their instances are not shared
+      if (tx->signaturesCount() < tx->quorum()) {
+        return tx;
+      }
+      auto signatures = signaturesKey(*tx);
+      auto &entry = entries_[tx->hash()];
+      if (entry.signatures == signatures) {
+        if (auto pooled = entry.tx.lock()) {
+          shared_metric_.increment();
+          return pooled;
+        }
+      }
+      // the latest instance replaces the one with other signatures
+      entry.signatures = std::move(signatures);
+      entry.tx = tx;
+      if (entries_.size() >= purge_size_) {
+        purge();
+      }
+      size_metric_.set(entries_.size());
+      return tx;
+    }
+
+    void TransactionPool::purge() {
+      for (auto it = entries_.begin(); it != entries_.end();) {
+        if (it->second.tx.expired()) {
+          it = entries_.erase(it);
+        } else {
+          ++it;
+        }
+      }
+      // the pool is scanned again once the number of its entries doubles, so
+      // the cost of purges is amortized over insertions
+      purge_size_ = std::max(kMinPurgeSize, entries_.size() * 2);
+    }
+
+  }  // namespace network
+}  // namespace iroha
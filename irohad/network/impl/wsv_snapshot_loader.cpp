@@ -0,0 +1,108 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/wsv_snapshot_loader.hpp"
+
+#include "backend/protobuf/block.hpp"
+#include "loader.grpc.pb.h"
+#include "logger/logger.hpp"
+#include "network/impl/grpc_channel_builder.hpp"
+
+using namespace iroha::network;
+
+WsvSnapshotLoader::WsvSnapshotLoader(
+    shared_model::proto::ProtoBlockFactory factory, logger::LoggerPtr log)
+    : block_factory_(std::move(factory)), log_(std::move(log)) {}
+
+iroha::ametsuchi::CommitResult WsvSnapshotLoader::retrieveSnapshot(
+    const shared_model::interface::types::AddressType &address,
+    const std::vector<shared_model::interface::types::AddressType>
+        &verifying_peers,
+    ametsuchi::WsvSnapshotImporter &importer) {
+  auto stub = network::createClient<proto::Loader>(address);
+  grpc::ClientContext context;
+  proto::SnapshotPart part;
+  boost::optional<iroha::protocol::Block> top_block;
+  std::string hash;
+  size_t chunks = 0;
+
+  auto reader = stub->retrieveSnapshot(&context, proto::SnapshotRequest{});
+  while (reader->Read(&part)) {
+    if (part.has_top_block()) {
+      top_block = std::move(*part.mutable_top_block());
+      break;
+    }
+    const auto &chunk = part.chunk();
+    auto applied = importer.apply(ametsuchi::WsvSnapshotChunk{
+        chunk.table(), chunk.rows(), shared_model::crypto::Hash(chunk.hash())});
+    if (auto e = iroha::expected::resultToOptionalError(applied)) {
+      context.TryCancel();
+      reader->Finish();
+      return e.value();
+    }
+    hash = chunk.hash();
+    ++chunks;
+  }
+  auto status = reader->Finish();
+  if (not status.ok()) {
+    return iroha::expected::makeError("Failed to retrieve snapshot from "
+                                      + address + ": "
+                                      + status.error_message());
+  }
+  if (not top_block) {
+    return iroha::expected::makeError("Snapshot from " + address
+                                      + " has no top block");
+  }
+  log_->info("Received {} snapshot chunks from {}", chunks, address);
+
+  return block_factory_.createBlock(std::move(*top_block))
+      .match(
+          [this, &verifying_peers, &importer, &hash](
+              auto &&block) -> ametsuchi::CommitResult {
+            // the snapshot is rejected before WSV and the block store change
+            for (const auto &peer : verifying_peers) {
+              if (auto e = iroha::expected::resultToOptionalError(
+                      this->verifySnapshot(peer, *block.value, hash))) {
+                return e.value();
+              }
+            }
+            return importer.commit(std::move(block.value));
+          },
+          [](const auto &error) -> ametsuchi::CommitResult {
+            return "Invalid snapshot top block: " + error.error;
+          });
+}
+
+iroha::expected::Result<void, std::string> WsvSnapshotLoader::verifySnapshot(
+    const shared_model::interface::types::AddressType &address,
+    const shared_model::interface::Block &top_block,
+    const std::string &hash) {
+  auto stub = network::createClient<proto::Loader>(address);
+  grpc::ClientContext context;
+  proto::SnapshotDigest digest;
+  auto status = stub->retrieveSnapshotDigest(
+      &context, proto::SnapshotRequest{}, &digest);
+  if (not status.ok()) {
+    return iroha::expected::makeError("Failed to retrieve snapshot digest from "
+                                      + address + ": "
+                                      + status.error_message());
+  }
+  if (digest.height() != top_block.height()) {
+    return iroha::expected::makeError(
+        "Snapshot is at height " + std::to_string(top_block.height())
+        + ", while " + address + " is at height "
+        + std::to_string(digest.height())
+        + ", retry when the peers are at the same height");
+  }
+  const auto &top_block_hash = top_block.hash().blob();
+  if (digest.top_block_hash()
+          != std::string(top_block_hash.begin(), top_block_hash.end())
+      or digest.hash() != hash) {
+    return iroha::expected::makeError("Snapshot does not match the one of "
+                                      + address);
+  }
+  log_->info("Snapshot is verified by {}", address);
+  return {};
+}
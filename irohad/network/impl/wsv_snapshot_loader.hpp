@@ -0,0 +1,66 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_WSV_SNAPSHOT_LOADER_HPP
+#define IROHA_WSV_SNAPSHOT_LOADER_HPP
+
+#include <string>
+#include <vector>
+
+#include "ametsuchi/wsv_snapshot.hpp"
+#include "backend/protobuf/proto_block_factory.hpp"
+#include "interfaces/common_objects/types.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace network {
+
+    /**
+     * Downloads WSV snapshot from a peer to bootstrap a new node. The chunk
+     * hashes are computed by the sending peer, so they only detect corrupted
+     * transfers; the snapshot is trusted when other peers export the same
+     * snapshot at the same height
+     */
+    class WsvSnapshotLoader {
+     public:
+      WsvSnapshotLoader(shared_model::proto::ProtoBlockFactory factory,
+                        logger::LoggerPtr log);
+
+      /**
+       * Retrieve snapshot from the peer, verify it and import it
+       * @param address - address of the peer
+       * @param verifying_peers - addresses of the peers which must agree on
+       * the top block and the last chunk hash of the snapshot
+       * @param importer - importer of the snapshot chunks, is committed with
+       * the top block of the snapshot after it is validated and verified
+       * @return ledger state after the import or error
+       */
+      ametsuchi::CommitResult retrieveSnapshot(
+          const shared_model::interface::types::AddressType &address,
+          const std::vector<shared_model::interface::types::AddressType>
+              &verifying_peers,
+          ametsuchi::WsvSnapshotImporter &importer);
+
+     private:
+      /**
+       * Compare the snapshot with the digest of the snapshot of another peer
+       * @param address - address of the other peer
+       * @param top_block - top block of the snapshot
+       * @param hash - hash of the last chunk of the snapshot
+       * @return error if the peer has another snapshot
+       */
+      expected::Result<void, std::string> verifySnapshot(
+          const shared_model::interface::types::AddressType &address,
+          const shared_model::interface::Block &top_block,
+          const std::string &hash);
+
+      shared_model::proto::ProtoBlockFactory block_factory_;
+      logger::LoggerPtr log_;
+    };
+
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_WSV_SNAPSHOT_LOADER_HPP
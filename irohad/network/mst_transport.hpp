@@ -7,6 +7,8 @@
 #define IROHA_MST_TRANSPORT_HPP
 
 #include <memory>
+#include <vector>
+
 #include "interfaces/common_objects/peer.hpp"
 #include "multi_sig_transactions/state/mst_state.hpp"
 
@@ -50,6 +52,20 @@ namespace iroha {
       virtual void sendState(const shared_model::interface::Peer &to,
                              const MstState &providing_state) = 0;
 
+      /**
+       * Share the same state with several peers
+       * @param to - peers recipients of message
+       * @param providing_state - state for transmitting
+       */
+      virtual void broadcastState(
+          const std::vector<std::shared_ptr<shared_model::interface::Peer>>
+              &to,
+          const MstState &providing_state) {
+        for (const auto &peer : to) {
+          sendState(*peer, providing_state);
+        }
+      }
+
       virtual ~MstTransport() = default;
     };
   }  // namespace network
@@ -0,0 +1,77 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PEER_CHUNKING_HPP
+#define IROHA_PEER_CHUNKING_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace iroha {
+  namespace network {
+
+    /**
+     * Transfer of proposals and blocks requested by the peer as streams of
+     * parts with consecutive transactions, so that large messages are neither
+     * buffered whole by gRPC nor parsed at once after being received
+     */
+    struct PeerChunking {
+      /// limit of the size of transactions in a part, 0 requests whole
+      /// messages
+      uint32_t max_chunk_bytes = 0;
+    };
+
+    /**
+     * @return chunking used by this peer, it is set on startup before the
+     * peer services are run
+     */
+    inline PeerChunking &peerChunking() {
+      static PeerChunking chunking;
+      return chunking;
+    }
+
+    /**
+     * Split consecutive items into chunks whose total size does not exceed
+     * the limit, an item exceeding it forms a chunk by itself
+     * @param sizes - serialized sizes of the items
+     * @param max_chunk_bytes - limit of the size of a chunk, 0 means no limit
+     * @return indices following the last items of the chunks, a single empty
+     * chunk if there are no items
+     */
+    inline std::vector<size_t> chunkEnds(const std::vector<size_t> &sizes,
+                                         size_t max_chunk_bytes) {
+      std::vector<size_t> ends;
+      size_t begin = 0;
+      size_t chunk_bytes = 0;
+      for (size_t i = 0; i < sizes.size(); ++i) {
+        if (max_chunk_bytes != 0 and i != begin
+            and chunk_bytes + sizes[i] > max_chunk_bytes) {
+          ends.push_back(i);
+          begin = i;
+          chunk_bytes = 0;
+        }
+        chunk_bytes += sizes[i];
+      }
+      ends.push_back(sizes.size());
+      return ends;
+    }
+
+    /**
+     * Move the items of a received part to the end of the reassembled ones
+     * @tparam Field - repeated protobuf message field
+     */
+    template <typename Field>
+    void appendChunk(Field &chunk, Field &reassembled) {
+      reassembled.Reserve(reassembled.size() + chunk.size());
+      for (auto &item : chunk) {
+        reassembled.Add()->Swap(&item);
+      }
+    }
+
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_PEER_CHUNKING_HPP
@@ -0,0 +1,42 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PEER_COMPRESSION_HPP
+#define IROHA_PEER_COMPRESSION_HPP
+
+#include <cstddef>
+
+namespace iroha {
+  namespace network {
+
+    /**
+     * Algorithm compressing the messages exchanged by the peers
+     */
+    enum class CompressionAlgorithm { kNone, kDeflate, kGzip };
+
+    /**
+     * Compression of proposals, transactions, blocks and MST states
+     * exchanged by the peers
+     */
+    struct PeerCompression {
+      CompressionAlgorithm algorithm = CompressionAlgorithm::kNone;
+      /// messages smaller than that many bytes, like votes, are sent
+      /// uncompressed
+      size_t threshold = 1024;
+    };
+
+    /**
+     * @return compression used by this peer, it is set on startup before the
+     * peer services are run
+     */
+    inline PeerCompression &peerCompression() {
+      static PeerCompression compression;
+      return compression;
+    }
+
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_PEER_COMPRESSION_HPP
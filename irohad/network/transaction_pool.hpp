@@ -0,0 +1,85 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_TRANSACTION_POOL_HPP
+#define IROHA_TRANSACTION_POOL_HPP
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "cryptography/hash.hpp"
+#include "interfaces/common_objects/transaction_sequence_common.hpp"
+#include "metrics/metrics.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Transaction;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+  namespace network {
+
+    /**
+     * Transactions alive in the peer, indexed by hash. Transports pass the
+     * transactions they deserialize through the pool, so a transaction
+     * received from a client, gossiped by MST and relayed to the ordering
+     * service is kept as a single instance shared by torii, MST storage,
+     * pending transactions storage and ordering instead of an instance for
+     * every path it came by. Only transactions with all signatures are
+     * pooled, since shared instances must not be changed. The pool does not
+     * own transactions, their entries are dropped once no component holds
+     * them
+     */
+    class TransactionPool {
+     public:
+      using TransactionPtr =
+          std::shared_ptr<shared_model::interface::Transaction>;
+
+      TransactionPool();
+
+      /**
+       * @return pooled instance of the transaction if there is one with the
+       * same hash and signatures, the transaction itself otherwise, which is
+       * pooled then if it has all signatures
+       */
+      TransactionPtr intern(TransactionPtr tx);
+
+      /// replace the transactions with their pooled instances
+      void intern(shared_model::interface::types::SharedTxsCollectionType &txs);
+
+      /// @return number of entries, including the ones not purged yet
+      size_t size() const;
+
+     private:
+      struct Entry {
+        /// transactions with other signatures are different instances
+        std::string signatures;
+        std::weak_ptr<shared_model::interface::Transaction> tx;
+      };
+
+      TransactionPtr internLocked(TransactionPtr tx);
+
+      /// drop entries of destroyed transactions
+      void purge();
+
+      mutable std::mutex mutex_;
+      std::unordered_map<shared_model::crypto::Hash,
+                         Entry,
+                         shared_model::crypto::Hash::Hasher>
+          entries_;
+      /// number of entries which triggers the next purge
+      size_t purge_size_;
+
+      metrics::Counter &shared_metric_;
+      metrics::Gauge &size_metric_;
+    };
+
+  }  // namespace network
+}  // namespace iroha
+
+#endif  // IROHA_TRANSACTION_POOL_HPP
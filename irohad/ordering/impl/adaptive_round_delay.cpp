@@ -0,0 +1,37 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/adaptive_round_delay.hpp"
+
+#include <algorithm>
+
+using namespace iroha::ordering;
+
+namespace {
+  /// number of idle rounds after which the delay becomes maximal
+  const int64_t kIdleRoundsToMaxDelay = 4;
+}  // namespace
+
+AdaptiveRoundDelay::AdaptiveRoundDelay(
+    RoundDelayBounds bounds,
+    size_t transaction_limit,
+    std::function<size_t()> pending_transactions)
+    : bounds_(bounds),
+      transaction_limit_(std::max<size_t>(transaction_limit, 1)),
+      pending_transactions_(std::move(pending_transactions)),
+      step_(std::max(std::chrono::milliseconds(1),
+                     (bounds.max - bounds.min) / kIdleRoundsToMaxDelay)),
+      current_(bounds.max) {}
+
+std::chrono::milliseconds AdaptiveRoundDelay::operator()(
+    const synchronizer::SynchronizationEvent &) {
+  auto pending = std::min(pending_transactions_(), transaction_limit_);
+  // the delay decreases linearly with the load of the next proposal
+  auto target = bounds_.max
+      - (bounds_.max - bounds_.min) * static_cast<int64_t>(pending)
+          / static_cast<int64_t>(transaction_limit_);
+  current_ = target < current_ ? target : std::min(target, current_ + step_);
+  return current_;
+}
@@ -0,0 +1,64 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ORDERING_ADAPTIVE_ROUND_DELAY_HPP
+#define IROHA_ORDERING_ADAPTIVE_ROUND_DELAY_HPP
+
+#include <chrono>
+#include <functional>
+
+#include "synchronizer/synchronizer_common.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Bounds of the delay before the next round starts
+     */
+    struct RoundDelayBounds {
+      std::chrono::milliseconds min;
+      std::chrono::milliseconds max;
+    };
+
+    /**
+     * Delay before the next round which depends on the number of transactions
+     * pending in the ordering service. The delay is the minimal one when
+     * there are enough transactions for a full proposal and decreases
+     * immediately when the load grows, so transactions do not wait. When the
+     * load drops, the delay grows gradually up to the maximal one, so idle
+     * rounds are not started too often
+     */
+    class AdaptiveRoundDelay {
+     public:
+      /**
+       * @param bounds - minimal and maximal delays
+       * @param transaction_limit - maximal number of transactions in a
+       * proposal
+       * @param pending_transactions - returns number of transactions waiting
+       * for a proposal
+       */
+      AdaptiveRoundDelay(RoundDelayBounds bounds,
+                         size_t transaction_limit,
+                         std::function<size_t()> pending_transactions);
+
+      /**
+       * @return delay before the round which follows the event
+       */
+      std::chrono::milliseconds operator()(
+          const synchronizer::SynchronizationEvent &event);
+
+     private:
+      RoundDelayBounds bounds_;
+      size_t transaction_limit_;
+      std::function<size_t()> pending_transactions_;
+      /// increase of the delay after a round with less load
+      std::chrono::milliseconds step_;
+      std::chrono::milliseconds current_;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_ORDERING_ADAPTIVE_ROUND_DELAY_HPP
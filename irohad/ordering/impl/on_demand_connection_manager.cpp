@@ -5,38 +5,134 @@
 
 #include "ordering/impl/on_demand_connection_manager.hpp"
 
+#include <algorithm>
+
 #include <boost/range/combine.hpp>
+#include <boost/range/size.hpp>
+#include "interfaces/common_objects/peer.hpp"
 #include "interfaces/iroha_internal/proposal.hpp"
+#include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "logger/logger.hpp"
 #include "ordering/impl/on_demand_common.hpp"
 
 using namespace iroha;
 using namespace iroha::ordering;
 
+namespace {
+  /// number of the latest request times kept for every peer
+  constexpr size_t kRequestTimesWindow = 64;
+  /// requests are not hedged until the peer has this number of request times
+  constexpr size_t kMinRequestTimes = 8;
+}  // namespace
+
 OnDemandConnectionManager::OnDemandConnectionManager(
     std::shared_ptr<transport::OdOsNotificationFactory> factory,
     rxcpp::observable<CurrentPeers> peers,
-    logger::LoggerPtr log)
+    logger::LoggerPtr log,
+    BatchCoalescingOptions coalescing,
+    bool prefetch_proposals,
+    double hedging_quantile)
     : log_(std::move(log)),
       factory_(std::move(factory)),
       subscription_(peers.subscribe(
-          [this](const auto &peers) { this->initializeConnections(peers); })) {}
+          [this](const auto &peers) { this->initializeConnections(peers); })),
+      coalescing_(coalescing),
+      prefetch_proposals_(prefetch_proposals),
+      hedging_quantile_(hedging_quantile),
+      request_times_(std::make_shared<RequestTimes>()),
+      hedged_requests_metric_(metrics::registry().counter(
+          "iroha_ordering_hedged_proposal_requests_total",
+          "Proposal requests repeated since the first one was too slow")) {
+  if (coalescing_.window.count() > 0) {
+    flush_thread_ = std::thread([this] { this->flushLoop(); });
+  }
+}
 
 OnDemandConnectionManager::OnDemandConnectionManager(
     std::shared_ptr<transport::OdOsNotificationFactory> factory,
     rxcpp::observable<CurrentPeers> peers,
     CurrentPeers initial_peers,
-    logger::LoggerPtr log)
-    : OnDemandConnectionManager(std::move(factory), peers, std::move(log)) {
+    logger::LoggerPtr log,
+    BatchCoalescingOptions coalescing,
+    bool prefetch_proposals,
+    double hedging_quantile)
+    : OnDemandConnectionManager(std::move(factory),
+                                peers,
+                                std::move(log),
+                                coalescing,
+                                prefetch_proposals,
+                                hedging_quantile) {
   // using start_with(initial_peers) results in deadlock
   initializeConnections(initial_peers);
 }
 
 OnDemandConnectionManager::~OnDemandConnectionManager() {
+  if (flush_thread_.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(buffer_mutex_);
+      stop_ = true;
+    }
+    buffer_cv_.notify_one();
+    flush_thread_.join();
+  }
   subscription_.unsubscribe();
 }
 
 void OnDemandConnectionManager::onBatches(CollectionType batches) {
+  if (not flush_thread_.joinable()) {
+    propagate(batches);
+    return;
+  }
+
+  CollectionType full_buffer;
+  {
+    std::lock_guard<std::mutex> lock(buffer_mutex_);
+    if (buffer_.empty()) {
+      buffer_deadline_ = std::chrono::steady_clock::now() + coalescing_.window;
+      buffer_cv_.notify_one();
+    }
+    for (auto &batch : batches) {
+      buffered_transactions_ += boost::size(batch->transactions());
+      buffer_.push_back(std::move(batch));
+    }
+    if (buffered_transactions_ >= coalescing_.max_transactions) {
+      full_buffer.swap(buffer_);
+      buffered_transactions_ = 0;
+    }
+  }
+  if (not full_buffer.empty()) {
+    propagate(full_buffer);
+  }
+}
+
+void OnDemandConnectionManager::flushLoop() {
+  std::unique_lock<std::mutex> lock(buffer_mutex_);
+  while (not stop_) {
+    buffer_cv_.wait(lock, [this] { return stop_ or not buffer_.empty(); });
+    auto deadline = buffer_deadline_;
+    // the buffer is sent by onBatches when it is full, then the window of
+    // the next batches is awaited
+    if (buffer_cv_.wait_until(lock,
+                              deadline,
+                              [this, deadline] {
+                                return stop_ or buffer_.empty()
+                                    or buffer_deadline_ != deadline;
+                              })
+        and not stop_) {
+      continue;
+    }
+    CollectionType batches;
+    batches.swap(buffer_);
+    buffered_transactions_ = 0;
+    if (not batches.empty()) {
+      lock.unlock();
+      propagate(batches);
+      lock.lock();
+    }
+  }
+}
+
+void OnDemandConnectionManager::propagate(const CollectionType &batches) {
   /*
    * Transactions are always sent to the round after the next round (+2)
    * There are 4 possibilities - all combinations of commits and rejects in the
@@ -50,30 +146,173 @@ void OnDemandConnectionManager::onBatches(CollectionType batches) {
    * RejectReject  CommitReject  RejectCommit  CommitCommit
    */
 
-  auto propagate = [&](auto consumer) {
-    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+  auto send = [&](auto consumer) {
+    std::shared_lock<decltype(mutex_)> lock(mutex_);
     connections_.peers[consumer]->onBatches(batches);
   };
 
-  propagate(kRejectRejectConsumer);
-  propagate(kRejectCommitConsumer);
-  propagate(kCommitRejectConsumer);
-  propagate(kCommitCommitConsumer);
+  send(kRejectRejectConsumer);
+  send(kRejectCommitConsumer);
+  send(kCommitRejectConsumer);
+  send(kCommitCommitConsumer);
 }
 
 boost::optional<std::shared_ptr<const OnDemandConnectionManager::ProposalType>>
 OnDemandConnectionManager::onRequestProposal(consensus::Round round) {
-  std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+  std::shared_lock<decltype(mutex_)> lock(mutex_);
 
   log_->debug("onRequestProposal, {}", round);
 
-  return connections_.peers[kIssuer]->onRequestProposal(round);
+  auto proposal = takePrefetched(round);
+  if (not proposal) {
+    proposal = requestProposal(round);
+  }
+  if (prefetch_proposals_) {
+    prefetchProposal(nextCommitRound(round));
+  }
+  return proposal;
+}
+
+boost::optional<std::shared_ptr<const OnDemandConnectionManager::ProposalType>>
+OnDemandConnectionManager::requestProposal(consensus::Round round) {
+  if (hedging_quantile_ <= 0) {
+    return connections_.peers[kIssuer]->onRequestProposal(round);
+  }
+
+  auto issuer = current_peers_.peers[kIssuer];
+  auto address = issuer->address();
+  auto hedging_delay = request_times_->quantile(address, hedging_quantile_);
+  if (not hedging_delay) {
+    auto start = std::chrono::steady_clock::now();
+    auto proposal = connections_.peers[kIssuer]->onRequestProposal(round);
+    request_times_->record(address, std::chrono::steady_clock::now() - start);
+    return proposal;
+  }
+
+  // replies of the requests, the first one with a proposal is taken, and the
+  // requests own their connections, since they may outlive the round
+  struct Replies {
+    std::mutex mutex;
+    std::condition_variable cv;
+    boost::optional<std::shared_ptr<const ProposalType>> proposal;
+    size_t pending = 0;
+  };
+  auto replies = std::make_shared<Replies>();
+  auto request = [&] {
+    std::shared_ptr<transport::OdOsNotification> connection =
+        factory_->create(*issuer);
+    ++replies->pending;
+    std::thread([connection,
+                 round,
+                 address,
+                 replies,
+                 request_times = request_times_] {
+      auto start = std::chrono::steady_clock::now();
+      auto proposal = connection->onRequestProposal(round);
+      request_times->record(address, std::chrono::steady_clock::now() - start);
+      {
+        std::lock_guard<std::mutex> lock(replies->mutex);
+        --replies->pending;
+        if (proposal and not replies->proposal) {
+          replies->proposal = std::move(proposal);
+        }
+      }
+      replies->cv.notify_all();
+    }).detach();
+  };
+  auto replied = [&replies] {
+    return replies->proposal or replies->pending == 0;
+  };
+
+  std::unique_lock<std::mutex> lock(replies->mutex);
+  request();
+  if (not replies->cv.wait_for(lock, *hedging_delay, replied)) {
+    log_->debug("Proposal for {} is not received in {} us, requesting again",
+                round,
+                std::chrono::duration_cast<std::chrono::microseconds>(
+                    *hedging_delay)
+                    .count());
+    hedged_requests_metric_.increment();
+    request();
+  }
+  replies->cv.wait(lock, replied);
+  return replies->proposal;
+}
+
+void OnDemandConnectionManager::RequestTimes::record(
+    const std::string &address, std::chrono::steady_clock::duration time) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto &times = times_[address];
+  times.push_back(time);
+  if (times.size() > kRequestTimesWindow) {
+    times.pop_front();
+  }
+}
+
+boost::optional<std::chrono::steady_clock::duration>
+OnDemandConnectionManager::RequestTimes::quantile(const std::string &address,
+                                                  double quantile) const {
+  std::vector<std::chrono::steady_clock::duration> times;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = times_.find(address);
+    if (it == times_.end() or it->second.size() < kMinRequestTimes) {
+      return boost::none;
+    }
+    times.assign(it->second.begin(), it->second.end());
+  }
+  auto nth = times.begin()
+      + std::min(static_cast<size_t>(quantile * times.size()),
+                 times.size() - 1);
+  std::nth_element(times.begin(), nth, times.end());
+  return *nth;
+}
+
+void OnDemandConnectionManager::prefetchProposal(consensus::Round round) {
+  auto issuer = current_peers_.peers[kRejectCommitConsumer];
+  // the connection is owned by the request, since connections_ are replaced
+  // on round switch
+  std::shared_ptr<transport::OdOsNotification> connection =
+      factory_->create(*issuer);
+  std::promise<boost::optional<std::shared_ptr<const ProposalType>>> promise;
+  auto proposal = promise.get_future().share();
+  std::thread([connection, round, promise = std::move(promise)]() mutable {
+    promise.set_value(connection->onRequestProposal(round));
+  }).detach();
+
+  std::lock_guard<std::mutex> lock(prefetch_mutex_);
+  prefetched_ =
+      PrefetchedProposal{round, std::move(issuer), std::move(proposal)};
+}
+
+boost::optional<std::shared_ptr<const OnDemandConnectionManager::ProposalType>>
+OnDemandConnectionManager::takePrefetched(consensus::Round round) {
+  boost::optional<PrefetchedProposal> prefetched;
+  {
+    std::lock_guard<std::mutex> lock(prefetch_mutex_);
+    prefetched.swap(prefetched_);
+  }
+  // the prefetched proposal is discarded if the round was not committed or the
+  // issuer changed with the peers list
+  if (not prefetched or prefetched->round != round
+      or not(*prefetched->issuer == *current_peers_.peers[kIssuer])) {
+    return boost::none;
+  }
+  auto proposal = prefetched->proposal.get();
+  log_->debug("Using prefetched proposal for {}: {}",
+              round,
+              proposal ? "received" : "none, requesting again");
+  return proposal;
 }
 
 void OnDemandConnectionManager::initializeConnections(
     const CurrentPeers &peers) {
+  {
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    current_peers_ = peers;
+  }
   auto create_assign = [this](auto &ptr, auto &peer) {
-    std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
     ptr = factory_->create(*peer);
   };
 
@@ -8,14 +8,36 @@
 
 #include "ordering/on_demand_os_transport.hpp"
 
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
 #include <shared_mutex>
+#include <thread>
+#include <unordered_map>
 
 #include <rxcpp/rx.hpp>
 #include "logger/logger_fwd.hpp"
+#include "metrics/metrics.hpp"
+#include "metrics/profiled_mutex.hpp"
 
 namespace iroha {
   namespace ordering {
 
+    /**
+     * Bounds of grouping batches from several onBatches calls into a single
+     * request to every consumer
+     */
+    struct BatchCoalescingOptions {
+      /// buffered batches are sent when this time passes since the first of
+      /// them arrived, zero sends every collection immediately
+      std::chrono::milliseconds window{0};
+      /// buffered batches are sent as soon as they contain at least this
+      /// number of transactions
+      size_t max_transactions = 0;
+    };
+
     /**
      * Proxy class which redirects requests to appropriate peers
      */
@@ -26,7 +48,9 @@ namespace iroha {
        * Transactions are sent to three ordering services:
        * reject round for current block, reject round for next block, and
        * commit for subsequent next round
-       * Proposal is requested from the current ordering service: issuer
+       * Proposal is requested from the current ordering service: issuer.
+       * Reject-commit consumer is the issuer of the round after the next
+       * commit, so proposals for that round are prefetched from it
        */
       enum PeerType {
         kRejectRejectConsumer = 0,
@@ -50,16 +74,30 @@ namespace iroha {
             peers;
       };
 
+      /**
+       * @param prefetch_proposals - whether the proposal for the round after
+       * the next commit is requested as soon as the proposal for the current
+       * round is received, to be ready if the current round is committed
+       * @param hedging_quantile - if not 0, the proposal is requested from the
+       * issuer once more over a new connection when the first request takes
+       * longer than this quantile of recent request times of the issuer
+       */
       OnDemandConnectionManager(
           std::shared_ptr<transport::OdOsNotificationFactory> factory,
           rxcpp::observable<CurrentPeers> peers,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          BatchCoalescingOptions coalescing = BatchCoalescingOptions{},
+          bool prefetch_proposals = false,
+          double hedging_quantile = 0);
 
       OnDemandConnectionManager(
           std::shared_ptr<transport::OdOsNotificationFactory> factory,
           rxcpp::observable<CurrentPeers> peers,
           CurrentPeers initial_peers,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          BatchCoalescingOptions coalescing = BatchCoalescingOptions{},
+          bool prefetch_proposals = false,
+          double hedging_quantile = 0);
 
       ~OnDemandConnectionManager() override;
 
@@ -83,13 +121,96 @@ namespace iroha {
        */
       void initializeConnections(const CurrentPeers &peers);
 
+      /**
+       * Send batches to all consumers
+       */
+      void propagate(const CollectionType &batches);
+
+      /**
+       * Send buffered batches when the coalescing window passes
+       */
+      void flushLoop();
+
+      /**
+       * Requests the proposal for the round from the issuer of the round after
+       * the next commit in background
+       * Note: mutex_ must be locked
+       */
+      void prefetchProposal(consensus::Round round);
+
+      /**
+       * Takes the prefetched proposal for the round, if it was requested from
+       * the current issuer
+       * Note: mutex_ must be locked
+       */
+      boost::optional<std::shared_ptr<const ProposalType>> takePrefetched(
+          consensus::Round round);
+
+      /**
+       * Requests the proposal for the round from the issuer, and hedges the
+       * request if it takes longer than usual for the issuer
+       * Note: mutex_ must be locked
+       */
+      boost::optional<std::shared_ptr<const ProposalType>> requestProposal(
+          consensus::Round round);
+
+      /// Times of the latest proposal requests to every peer
+      class RequestTimes {
+       public:
+        void record(const std::string &address,
+                    std::chrono::steady_clock::duration time);
+
+        /// @return the quantile of request times of the peer, none if there
+        /// are too few of them yet
+        boost::optional<std::chrono::steady_clock::duration> quantile(
+            const std::string &address, double quantile) const;
+
+       private:
+        mutable std::mutex mutex_;
+        std::unordered_map<std::string,
+                           std::deque<std::chrono::steady_clock::duration>>
+            times_;
+      };
+
+      using ProposalFutureType = std::shared_future<
+          boost::optional<std::shared_ptr<const ProposalType>>>;
+
+      /// proposal requested before its round started
+      struct PrefetchedProposal {
+        consensus::Round round;
+        std::shared_ptr<shared_model::interface::Peer> issuer;
+        ProposalFutureType proposal;
+      };
+
       logger::LoggerPtr log_;
       std::shared_ptr<transport::OdOsNotificationFactory> factory_;
       rxcpp::composite_subscription subscription_;
 
       CurrentConnections connections_;
-
-      std::shared_timed_mutex mutex_;
+      CurrentPeers current_peers_;
+
+      metrics::ProfiledMutex<std::shared_timed_mutex> mutex_{
+          "ordering_connections"};
+
+      const BatchCoalescingOptions coalescing_;
+
+      /// batches waiting to be sent and number of their transactions
+      CollectionType buffer_;
+      size_t buffered_transactions_ = 0;
+      std::chrono::steady_clock::time_point buffer_deadline_;
+      bool stop_ = false;
+      std::mutex buffer_mutex_;
+      std::condition_variable buffer_cv_;
+      std::thread flush_thread_;
+
+      const bool prefetch_proposals_;
+      boost::optional<PrefetchedProposal> prefetched_;
+      std::mutex prefetch_mutex_;
+
+      const double hedging_quantile_;
+      /// shared with requests which may outlive the manager
+      std::shared_ptr<RequestTimes> request_times_;
+      metrics::Counter &hedged_requests_metric_;
     };
 
   }  // namespace ordering
@@ -14,7 +14,6 @@
 #include "ametsuchi/tx_presence_cache.hpp"
 #include "common/visitor.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
-#include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
 #include "logger/logger.hpp"
 #include "ordering/impl/on_demand_common.hpp"
 
@@ -85,6 +84,10 @@ rxcpp::observable<network::OrderingEvent> OnDemandOrderingGate::onProposal() {
   return proposal_notifier_.get_observable();
 }
 
+void OnDemandOrderingGate::setTransactionLimit(size_t transaction_limit) {
+  transaction_limit_ = transaction_limit;
+}
+
 boost::optional<std::shared_ptr<const shared_model::interface::Proposal>>
 OnDemandOrderingGate::processProposalRequest(
     boost::optional<
@@ -108,11 +111,12 @@ void OnDemandOrderingGate::sendCachedTransactions() {
   cache_->addToBack(batches);
 
   // get only transactions which fit to next proposal
+  const size_t transaction_limit = transaction_limit_;
   auto end_iterator = batches.begin();
   auto current_number_of_transactions = 0u;
   for (; end_iterator != batches.end(); ++end_iterator) {
     auto batch_size = (*end_iterator)->transactions().size();
-    if (current_number_of_transactions + batch_size <= transaction_limit_) {
+    if (current_number_of_transactions + batch_size <= transaction_limit) {
       current_number_of_transactions += batch_size;
     } else {
       break;
@@ -147,10 +151,8 @@ OnDemandOrderingGate::removeReplays(
         });
   };
 
-  shared_model::interface::TransactionBatchParserImpl batch_parser;
-
   bool has_replays = false;
-  auto batches = batch_parser.parseBatches(proposal->transactions());
+  auto batches = proposal->batches();
   for (auto &batch : batches) {
     bool all_txs_are_new =
         std::all_of(batch.begin(), batch.end(), tx_is_not_processed);
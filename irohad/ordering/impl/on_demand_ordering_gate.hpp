@@ -8,6 +8,7 @@
 
 #include "network/ordering_gate.hpp"
 
+#include <atomic>
 #include <shared_mutex>
 
 #include <boost/variant.hpp>
@@ -66,6 +67,9 @@ namespace iroha {
 
       rxcpp::observable<network::OrderingEvent> onProposal() override;
 
+      /// Change the max number of transactions passed to one ordering service
+      void setTransactionLimit(size_t transaction_limit);
+
      private:
       /**
        * Handle an incoming proposal from ordering service
@@ -88,7 +92,7 @@ namespace iroha {
       logger::LoggerPtr log_;
 
       /// max number of transactions passed to one ordering service
-      size_t transaction_limit_;
+      std::atomic<size_t> transaction_limit_;
       std::shared_ptr<OnDemandOrderingService> ordering_service_;
       std::shared_ptr<transport::OdOsNotification> network_client_;
       rxcpp::composite_subscription processed_tx_hashes_subscription_;
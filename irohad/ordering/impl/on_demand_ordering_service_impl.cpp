@@ -5,6 +5,7 @@
 
 #include "ordering/impl/on_demand_ordering_service_impl.hpp"
 
+#include <algorithm>
 #include <unordered_set>
 
 #include <boost/optional.hpp>
@@ -21,11 +22,15 @@
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "interfaces/transaction.hpp"
 #include "logger/logger.hpp"
+#include "ordering/impl/proposal_selection_policies.hpp"
 
 using namespace iroha;
 using namespace iroha::ordering;
 using TransactionBatchType = transport::OdOsNotification::TransactionBatchType;
 
+constexpr std::chrono::milliseconds
+    OnDemandOrderingServiceImpl::kDefaultMaxTransactionAge;
+
 OnDemandOrderingServiceImpl::OnDemandOrderingServiceImpl(
     size_t transaction_limit,
     std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
@@ -33,12 +38,45 @@ OnDemandOrderingServiceImpl::OnDemandOrderingServiceImpl(
     std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
     logger::LoggerPtr log,
     size_t number_of_proposals,
-    const consensus::Round &initial_round)
+    const consensus::Round &initial_round,
+    std::shared_ptr<ProposalSelectionPolicy> selection_policy,
+    std::chrono::milliseconds max_transaction_age,
+    size_t max_pending_size_bytes,
+    size_t max_creator_size_bytes,
+    ShedBatchesHandler shed_batches_handler)
     : transaction_limit_(transaction_limit),
       number_of_proposals_(number_of_proposals),
+      max_transaction_age_(max_transaction_age),
+      budget_(max_pending_size_bytes, max_creator_size_bytes),
+      shed_batches_handler_(std::move(shed_batches_handler)),
+      selection_policy_(selection_policy
+                            ? std::move(selection_policy)
+                            : std::make_shared<FifoSelectionPolicy>()),
       proposal_factory_(std::move(proposal_factory)),
       tx_cache_(std::move(tx_cache)),
-      log_(std::move(log)) {
+      log_(std::move(log)),
+      received_batches_metric_(metrics::registry().counter(
+          "iroha_ordering_received_batches_total",
+          "Batches received by the ordering service")),
+      expired_batches_metric_(metrics::registry().counter(
+          "iroha_ordering_expired_batches_total",
+          "Pending batches dropped because their transactions are too old")),
+      shed_batches_metric_(metrics::registry().counter(
+          "iroha_ordering_shed_batches_total",
+          "Pending batches dropped to stay within the memory budget")),
+      reissued_proposals_metric_(metrics::registry().counter(
+          "iroha_ordering_reissued_proposals_total",
+          "Proposals of rejected rounds reused for the next reject round")),
+      pending_transactions_metric_(metrics::registry().gauge(
+          "iroha_ordering_pending_transactions",
+          "Transactions waiting to be included in a proposal")),
+      proposal_size_metric_(metrics::registry().histogram(
+          "iroha_ordering_proposal_transactions",
+          "Number of transactions in created proposals")),
+      packing_time_metric_(metrics::registry().histogram(
+          "iroha_ordering_packing_microseconds",
+          "Time spent creating the proposals of a round")),
+      memory_account_(metrics::registry(), "ordering") {
   onCollaborationOutcome(initial_round);
 }
 
@@ -47,6 +85,7 @@ OnDemandOrderingServiceImpl::OnDemandOrderingServiceImpl(
 void OnDemandOrderingServiceImpl::onCollaborationOutcome(
     consensus::Round round) {
   log_->info("onCollaborationOutcome => {}", round);
+  metrics::MemoryScope memory_scope(memory_account_);
 
   packNextProposals(round);
   tryErase(round);
@@ -57,17 +96,20 @@ void OnDemandOrderingServiceImpl::onCollaborationOutcome(
 void OnDemandOrderingServiceImpl::onBatches(CollectionType batches) {
   auto unprocessed_batches =
       boost::adaptors::filter(batches, [this](const auto &batch) {
-        log_->debug("check batch {} for already processed transactions",
-                    batch->reducedHash().hex());
+        log_->debug(
+            "check batch {} for already processed transactions",
+            logger::lazy([&batch] { return batch->reducedHash().hex(); }));
         return not this->batchAlreadyProcessed(*batch);
       });
   std::for_each(
       unprocessed_batches.begin(),
       unprocessed_batches.end(),
       [this](auto &obj) {
-        std::shared_lock<std::shared_timed_mutex> lock(batches_mutex_);
-        pending_batches_.insert(std::move(obj));
+        incoming_txs_quantity_ += boost::size(obj->transactions());
+        incoming_batches_.push(std::move(obj));
+        received_batches_metric_.increment();
       });
+  pending_transactions_metric_.set(pendingTransactionsQuantity());
   log_->info("onBatches => collection size = {}", batches.size());
 }
 
@@ -78,7 +120,7 @@ OnDemandOrderingServiceImpl::onRequestProposal(consensus::Round round) {
       std::shared_ptr<const OnDemandOrderingServiceImpl::ProposalType>>
       result;
   {
-    std::shared_lock<std::shared_timed_mutex> lock(proposals_mutex_);
+    std::shared_lock<decltype(proposals_mutex_)> lock(proposals_mutex_);
     auto it = proposal_map_.find(round);
     if (it != proposal_map_.end()) {
       result = it->second;
@@ -92,41 +134,135 @@ OnDemandOrderingServiceImpl::onRequestProposal(consensus::Round round) {
   return result;
 }
 
+size_t OnDemandOrderingServiceImpl::pendingTransactionsQuantity() const {
+  return incoming_txs_quantity_ + pending_txs_quantity_;
+}
+
+void OnDemandOrderingServiceImpl::setTransactionLimit(
+    size_t transaction_limit) {
+  transaction_limit_ = transaction_limit;
+}
+
 // ---------------------------------| Private |---------------------------------
 
 /**
- * Get transactions from the given batches queue. Does not break batches -
- * continues getting all the transactions from the ongoing batch until the
- * required amount is collected.
- * @param requested_tx_amount - amount of transactions to get
- * @param batch_collection - the collection to get transactions from
- * @param discarded_txs_amount - the amount of discarded txs
+ * Get transactions of the given batches
+ * @param batches - batches selected for a proposal
+ * @param total_txs_amount - the amount of pending txs
+ * @param discarded_txs_amount - the amount of pending txs not in batches
  * @return transactions
  */
 static std::vector<std::shared_ptr<shared_model::interface::Transaction>>
-getTransactions(size_t requested_tx_amount,
-                detail::BatchSetType &batch_collection,
-                boost::optional<size_t &> discarded_txs_amount) {
+getTransactions(const std::vector<TransactionBatchType> &batches,
+                size_t total_txs_amount,
+                size_t &discarded_txs_amount) {
   std::vector<std::shared_ptr<shared_model::interface::Transaction>> collection;
-
-  auto it = batch_collection.begin();
-  for (; it != batch_collection.end()
-       and collection.size() + boost::size((*it)->transactions())
-           <= requested_tx_amount;
-       ++it) {
+  for (const auto &batch : batches) {
     collection.insert(std::end(collection),
-                      std::begin((*it)->transactions()),
-                      std::end((*it)->transactions()));
+                      std::begin(batch->transactions()),
+                      std::end(batch->transactions()));
   }
 
-  if (discarded_txs_amount) {
-    *discarded_txs_amount = 0;
-    for (; it != batch_collection.end(); ++it) {
-      *discarded_txs_amount += boost::size((*it)->transactions());
+  discarded_txs_amount = total_txs_amount - collection.size();
+  return collection;
+}
+
+void OnDemandOrderingServiceImpl::takeIncomingBatches() {
+  TransactionBatchType batch;
+  while (incoming_batches_.try_pop(batch)) {
+    auto batch_size = boost::size(batch->transactions());
+    incoming_txs_quantity_ -= batch_size;
+    if (pending_batches_index_.count(batch) != 0) {
+      continue;
+    }
+    if (not budget_.fitsCreatorQuota(*batch)) {
+      notifyShedBatch(batch);
+      continue;
+    }
+    pending_batches_index_.insert(batch);
+    pending_txs_quantity_ += batch_size;
+    if (budget_.isLimited()) {
+      budget_.add(*batch);
     }
+    auto oldest = std::min_element(
+        batch->transactions().begin(),
+        batch->transactions().end(),
+        [](const auto &lhs, const auto &rhs) {
+          return lhs->createdTime() < rhs->createdTime();
+        });
+    if (oldest != batch->transactions().end()) {
+      pending_batches_by_time_.emplace((*oldest)->createdTime(), batch);
+    }
+    pending_batches_.push_back(std::move(batch));
+    pending_batches_changed_ = true;
   }
+}
 
-  return collection;
+void OnDemandOrderingServiceImpl::evictExpiredBatches(
+    shared_model::interface::types::TimestampType now) {
+  const auto max_age =
+      static_cast<shared_model::interface::types::TimestampType>(
+          max_transaction_age_.count());
+  if (now < max_age) {
+    return;
+  }
+  auto expired_end = pending_batches_by_time_.lower_bound(now - max_age);
+  if (expired_end == pending_batches_by_time_.begin()) {
+    return;
+  }
+
+  size_t expired_batches = 0;
+  for (auto it = pending_batches_by_time_.begin(); it != expired_end; ++it) {
+    pending_batches_index_.erase(it->second);
+    pending_txs_quantity_ -= boost::size(it->second->transactions());
+    if (budget_.isLimited()) {
+      budget_.remove(*it->second);
+    }
+    ++expired_batches;
+  }
+  pending_batches_by_time_.erase(pending_batches_by_time_.begin(),
+                                 expired_end);
+  erasePendingBatchesNotIndexed();
+  expired_batches_metric_.increment(expired_batches);
+  log_->info("Dropped {} pending batches with expired transactions",
+             expired_batches);
+}
+
+void OnDemandOrderingServiceImpl::shedOldestBatches() {
+  if (not budget_.isExceeded()) {
+    return;
+  }
+  auto it = pending_batches_by_time_.begin();
+  for (; it != pending_batches_by_time_.end() and budget_.isExceeded(); ++it) {
+    pending_batches_index_.erase(it->second);
+    pending_txs_quantity_ -= boost::size(it->second->transactions());
+    budget_.remove(*it->second);
+    notifyShedBatch(it->second);
+  }
+  pending_batches_by_time_.erase(pending_batches_by_time_.begin(), it);
+  erasePendingBatchesNotIndexed();
+}
+
+void OnDemandOrderingServiceImpl::erasePendingBatchesNotIndexed() {
+  // the list keeps the order of arrival, so it is filtered by the index
+  pending_batches_.erase(
+      std::remove_if(pending_batches_.begin(),
+                     pending_batches_.end(),
+                     [this](const auto &batch) {
+                       return pending_batches_index_.count(batch) == 0;
+                     }),
+      pending_batches_.end());
+  pending_batches_changed_ = true;
+}
+
+void OnDemandOrderingServiceImpl::notifyShedBatch(
+    const TransactionBatchType &batch) {
+  log_->warn("Shedding batch {} exceeding the memory budget",
+             batch->reducedHash().hex());
+  shed_batches_metric_.increment();
+  if (shed_batches_handler_) {
+    shed_batches_handler_(batch);
+  }
 }
 
 void OnDemandOrderingServiceImpl::packNextProposals(
@@ -162,6 +298,7 @@ void OnDemandOrderingServiceImpl::packNextProposals(
    * (1,0) - current round. The diagram is similar to the initial case.
    */
 
+  metrics::ScopedTimer timer(packing_time_metric_);
   size_t discarded_txs_quantity;
   auto now = iroha::time::now();
   auto generate_proposal = [this, now, &discarded_txs_quantity](
@@ -179,19 +316,55 @@ void OnDemandOrderingServiceImpl::packNextProposals(
         discarded_txs_quantity);
   };
 
+  takeIncomingBatches();
+  evictExpiredBatches(now);
+  shedOldestBatches();
+
+  // consecutive rejects with the same pending batches reuse the proposal
+  if (round.reject_round != kFirstRejectRound and not pending_batches_changed_
+      and reissueProposal(round)) {
+    return;
+  }
+
   if (not pending_batches_.empty()) {
     auto txs = getTransactions(
-        transaction_limit_, pending_batches_, discarded_txs_quantity);
+        selection_policy_->select(pending_batches_, transaction_limit_),
+        pending_txs_quantity_,
+        discarded_txs_quantity);
     if (not txs.empty()) {
+      proposal_size_metric_.record(txs.size());
       generate_proposal({round.block_round, round.reject_round + 1}, txs);
       generate_proposal({round.block_round + 1, kFirstRejectRound}, txs);
     }
   }
 
   if (round.reject_round == kFirstRejectRound) {
-    std::lock_guard<std::shared_timed_mutex> lock(batches_mutex_);
     pending_batches_.clear();
+    pending_batches_index_.clear();
+    pending_batches_by_time_.clear();
+    budget_.clear();
+    pending_txs_quantity_ = 0;
+  }
+  pending_batches_changed_ = round.reject_round == kFirstRejectRound;
+  pending_transactions_metric_.set(pendingTransactionsQuantity());
+}
+
+bool OnDemandOrderingServiceImpl::reissueProposal(
+    const consensus::Round &round) {
+  auto it = proposal_map_.find(round);
+  if (it == proposal_map_.end()) {
+    return false;
   }
+  consensus::Round next_round{round.block_round, round.reject_round + 1};
+  {
+    std::lock_guard<decltype(proposals_mutex_)> lock(proposals_mutex_);
+    proposal_map_[next_round] = it->second;
+  }
+  reissued_proposals_metric_.increment();
+  log_->debug("packNextProposal: reissued the proposal of {} for {}",
+              round,
+              next_round);
+  return true;
 }
 
 void OnDemandOrderingServiceImpl::tryErase(
@@ -214,7 +387,7 @@ void OnDemandOrderingServiceImpl::tryErase(
                                        proposal_map_.end()};
 
   {
-    std::lock_guard<std::shared_timed_mutex> lock(proposals_mutex_);
+    std::lock_guard<decltype(proposals_mutex_)> lock(proposals_mutex_);
     proposal_map_.swap(proposal_map);
   }
 
@@ -8,16 +8,26 @@
 
 #include "ordering/on_demand_ordering_service.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <functional>
 #include <map>
 #include <shared_mutex>
+#include <unordered_set>
 
-#include <tbb/concurrent_unordered_set.h>
+#include <tbb/concurrent_queue.h>
 #include "interfaces/iroha_internal/unsafe_proposal_factory.hpp"
 #include "logger/logger_fwd.hpp"
+#include "metrics/memory_accounting.hpp"
+#include "metrics/metrics.hpp"
+#include "metrics/profiled_mutex.hpp"
 #include "multi_sig_transactions/hash.hpp"
+#include "multi_sig_transactions/state/batches_budget.hpp"
 // TODO 2019-03-15 andrei: IR-403 Separate BatchHashEquality and MstState
 #include "multi_sig_transactions/state/mst_state.hpp"
 #include "ordering/impl/on_demand_common.hpp"
+#include "ordering/proposal_selection_policy.hpp"
 
 namespace iroha {
   namespace ametsuchi {
@@ -25,11 +35,21 @@ namespace iroha {
   }
   namespace ordering {
     namespace detail {
-      using BatchSetType = tbb::concurrent_unordered_set<
+      using BatchQueueType = tbb::concurrent_queue<
+          transport::OdOsNotification::TransactionBatchType>;
+
+      using BatchListType = ProposalSelectionPolicy::BatchListType;
+
+      using BatchSetType = std::unordered_set<
           transport::OdOsNotification::TransactionBatchType,
           model::PointerBatchHasher,
           BatchHashEquality>;
 
+      /// pending batches by the creation time of their oldest transaction
+      using BatchTimeIndexType =
+          std::multimap<shared_model::interface::types::TimestampType,
+                        transport::OdOsNotification::TransactionBatchType>;
+
       using ProposalMapType = std::map<
           consensus::Round,
           std::shared_ptr<const transport::OdOsNotification::ProposalType>>;
@@ -37,6 +57,14 @@ namespace iroha {
 
     class OnDemandOrderingServiceImpl : public OnDemandOrderingService {
      public:
+      /// transactions older than this do not pass stateless validation
+      static constexpr std::chrono::milliseconds kDefaultMaxTransactionAge =
+          std::chrono::hours(24);
+
+      /// called with every pending batch shed to stay within the budget
+      using ShedBatchesHandler =
+          std::function<void(const TransactionBatchType &)>;
+
       /**
        * Create on_demand ordering service with following options:
        * @param transaction_limit - number of maximum transactions in one
@@ -48,6 +76,17 @@ namespace iroha {
        * removed. Default value is 3
        * @param initial_round - first round of agreement.
        * Default value is {2, kFirstRejectRound} since genesis block height is 1
+       * @param selection_policy - selects pending batches for proposals,
+       * batches are taken in order of arrival if not provided
+       * @param max_transaction_age - pending batches with transactions
+       * created earlier than this before packing are dropped
+       * @param max_pending_size_bytes - limit of the total size of pending
+       * transactions, the batches with the oldest transactions are shed when
+       * it is exceeded. 0 means no limit
+       * @param max_creator_size_bytes - limit of the size of pending
+       * transactions of a creator account, new batches of creators over it
+       * are shed. 0 means no limit
+       * @param shed_batches_handler - notified of shed batches
        */
       OnDemandOrderingServiceImpl(
           size_t transaction_limit,
@@ -56,7 +95,13 @@ namespace iroha {
           std::shared_ptr<ametsuchi::TxPresenceCache> tx_cache,
           logger::LoggerPtr log,
           size_t number_of_proposals = 3,
-          const consensus::Round &initial_round = {2, kFirstRejectRound});
+          const consensus::Round &initial_round = {2, kFirstRejectRound},
+          std::shared_ptr<ProposalSelectionPolicy> selection_policy = nullptr,
+          std::chrono::milliseconds max_transaction_age =
+              kDefaultMaxTransactionAge,
+          size_t max_pending_size_bytes = 0,
+          size_t max_creator_size_bytes = 0,
+          ShedBatchesHandler shed_batches_handler = {});
 
       // --------------------- | OnDemandOrderingService |_---------------------
 
@@ -69,6 +114,18 @@ namespace iroha {
       boost::optional<std::shared_ptr<const ProposalType>> onRequestProposal(
           consensus::Round round) override;
 
+      /**
+       * @return number of received transactions which are not yet packed or
+       * are pending since the last commit, may be called concurrently
+       */
+      size_t pendingTransactionsQuantity() const;
+
+      /**
+       * Change the maximal number of transactions in the next proposals,
+       * may be called concurrently
+       */
+      void setTransactionLimit(size_t transaction_limit);
+
      private:
       /**
        * Packs new proposals and creates new rounds
@@ -76,6 +133,49 @@ namespace iroha {
        */
       void packNextProposals(const consensus::Round &round);
 
+      /**
+       * Reissues the proposal of the rejected round for the next reject
+       * round, so that it is neither packed nor validated by the peers again.
+       * The proposal for the next block already has the same transactions
+       * Note: method is not thread-safe
+       * @param round - rejected round
+       * @return false if there is no proposal of the round
+       */
+      bool reissueProposal(const consensus::Round &round);
+
+      /**
+       * Moves batches received since the last call to pending batches,
+       * skipping the ones which are already pending
+       * Note: method is not thread-safe
+       */
+      void takeIncomingBatches();
+
+      /**
+       * Removes pending batches with transactions which are too old to be
+       * included in a proposal created at the given time
+       * Note: method is not thread-safe
+       */
+      void evictExpiredBatches(
+          shared_model::interface::types::TimestampType now);
+
+      /**
+       * Removes pending batches with the oldest transactions while their
+       * total size exceeds the budget
+       * Note: method is not thread-safe
+       */
+      void shedOldestBatches();
+
+      /**
+       * Removes the batches which are not in the index from pending_batches_
+       * Note: method is not thread-safe
+       */
+      void erasePendingBatchesNotIndexed();
+
+      /**
+       * Notifies of the shed batch
+       */
+      void notifyShedBatch(const TransactionBatchType &batch);
+
       /**
        * Removes last elements if it is required
        * Method removes the oldest commit or chain of the oldest rejects
@@ -92,7 +192,7 @@ namespace iroha {
       /**
        * Max number of transaction in one proposal
        */
-      size_t transaction_limit_;
+      std::atomic<size_t> transaction_limit_;
 
       /**
        * Max number of available proposals in one OS
@@ -105,14 +205,61 @@ namespace iroha {
       detail::ProposalMapType proposal_map_;
 
       /**
-       * Collections of batches for current round
+       * Batches received by onBatches, which is called concurrently, and not
+       * yet taken by packNextProposals. Insertion does not wait for packing
+       */
+      detail::BatchQueueType incoming_batches_;
+
+      /**
+       * Batches for current round in order of arrival
+       */
+      detail::BatchListType pending_batches_;
+
+      /**
+       * Index of pending_batches_ for deduplication
+       */
+      detail::BatchSetType pending_batches_index_;
+
+      /**
+       * Index of pending_batches_ for expiry
+       */
+      detail::BatchTimeIndexType pending_batches_by_time_;
+
+      /**
+       * Whether pending_batches_ changed since the proposals were packed,
+       * otherwise proposals of rejected rounds are reissued
        */
-      detail::BatchSetType pending_batches_;
+      bool pending_batches_changed_ = true;
 
       /**
-       * Batches and proposal collection mutexes for public methods
+       * Maximum age of pending transactions
        */
-      std::shared_timed_mutex batches_mutex_, proposals_mutex_;
+      std::chrono::milliseconds max_transaction_age_;
+
+      /**
+       * Memory held by pending_batches_
+       */
+      BatchesBudget budget_;
+
+      ShedBatchesHandler shed_batches_handler_;
+
+      /**
+       * Number of transactions in incoming_batches_
+       */
+      std::atomic<size_t> incoming_txs_quantity_{0};
+
+      /**
+       * Number of transactions in pending_batches_
+       */
+      std::atomic<size_t> pending_txs_quantity_{0};
+
+      /**
+       * Proposal collection mutex for public methods
+       */
+      metrics::ProfiledMutex<std::shared_timed_mutex> proposals_mutex_{
+          "ordering_proposals"};
+
+      std::shared_ptr<ProposalSelectionPolicy> selection_policy_;
 
       std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
           proposal_factory_;
@@ -126,6 +273,15 @@ namespace iroha {
        * Logger instance
        */
       logger::LoggerPtr log_;
+
+      metrics::Counter &received_batches_metric_;
+      metrics::Counter &expired_batches_metric_;
+      metrics::Counter &shed_batches_metric_;
+      metrics::Counter &reissued_proposals_metric_;
+      metrics::Gauge &pending_transactions_metric_;
+      metrics::Histogram &proposal_size_metric_;
+      metrics::Histogram &packing_time_metric_;
+      metrics::MemoryAccount memory_account_;
     };
   }  // namespace ordering
 }  // namespace iroha
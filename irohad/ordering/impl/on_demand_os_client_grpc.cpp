@@ -11,6 +11,8 @@
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "logger/logger.hpp"
 #include "network/impl/grpc_channel_builder.hpp"
+#include "network/impl/grpc_compression.hpp"
+#include "network/peer_chunking.hpp"
 
 using namespace iroha;
 using namespace iroha::ordering;
@@ -23,17 +25,22 @@ OnDemandOsClientGrpc::OnDemandOsClientGrpc(
     std::shared_ptr<TransportFactoryType> proposal_factory,
     std::function<TimepointType()> time_provider,
     std::chrono::milliseconds proposal_request_timeout,
-    logger::LoggerPtr log)
+    logger::LoggerPtr log,
+    std::shared_ptr<RecentTransactionsCache> recent_transactions)
     : log_(std::move(log)),
       stub_(std::move(stub)),
       async_call_(std::move(async_call)),
       proposal_factory_(std::move(proposal_factory)),
       time_provider_(std::move(time_provider)),
-      proposal_request_timeout_(proposal_request_timeout) {}
+      proposal_request_timeout_(proposal_request_timeout),
+      recent_transactions_(std::move(recent_transactions)) {}
 
 void OnDemandOsClientGrpc::onBatches(CollectionType batches) {
   proto::BatchesRequest request;
   for (auto &batch : batches) {
+    if (recent_transactions_) {
+      recent_transactions_->add(batch->transactions());
+    }
     for (auto &transaction : batch->transactions()) {
       *request.add_transactions() = std::move(
           static_cast<shared_model::proto::Transaction *>(transaction.get())
@@ -44,38 +51,155 @@ void OnDemandOsClientGrpc::onBatches(CollectionType batches) {
   log_->debug("Propagating: '{}'", request.DebugString());
 
   async_call_->Call([&](auto context, auto cq) {
+    network::compressLargeMessage(*context, request.ByteSizeLong());
     return stub_->AsyncSendBatches(context, request, cq);
   });
 }
 
 boost::optional<std::shared_ptr<const OdOsNotification::ProposalType>>
 OnDemandOsClientGrpc::onRequestProposal(consensus::Round round) {
+  return requestProposal(round, recent_transactions_ != nullptr);
+}
+
+boost::optional<std::shared_ptr<const OdOsNotification::ProposalType>>
+OnDemandOsClientGrpc::requestProposal(consensus::Round round, bool compact) {
+  const auto max_chunk_bytes = network::peerChunking().max_chunk_bytes;
+  if (not compact and max_chunk_bytes != 0) {
+    return requestProposalChunks(round, max_chunk_bytes);
+  }
   grpc::ClientContext context;
   context.set_deadline(time_provider_() + proposal_request_timeout_);
   proto::ProposalRequest request;
   request.mutable_round()->set_block_round(round.block_round);
   request.mutable_round()->set_reject_round(round.reject_round);
+  request.set_compact(compact);
   proto::ProposalResponse response;
   auto status = stub_->RequestProposal(&context, request, &response);
   if (not status.ok()) {
     log_->warn("RPC failed: {}", status.error_message());
     return boost::none;
   }
+  if (compact and response.has_compact_proposal()) {
+    if (auto proposal =
+            reconstructProposal(round, response.compact_proposal())) {
+      return proposal;
+    }
+    return requestProposal(round, false);
+  }
   if (not response.has_proposal()) {
     return boost::none;
   }
-  return proposal_factory_->build(response.proposal())
-      .match(
-          [&](auto &&v) {
-            return boost::make_optional(
-                std::shared_ptr<const OdOsNotification::ProposalType>(
-                    std::move(v).value));
-          },
-          [this](const auto &error) {
-            log_->info("{}", error.error.error);  // error
-            return boost::optional<
-                std::shared_ptr<const OdOsNotification::ProposalType>>();
-          });
+  return buildProposal(response.proposal());
+}
+
+boost::optional<std::shared_ptr<const OdOsNotification::ProposalType>>
+OnDemandOsClientGrpc::requestProposalChunks(consensus::Round round,
+                                            uint32_t max_chunk_bytes) {
+  grpc::ClientContext context;
+  context.set_deadline(time_provider_() + proposal_request_timeout_);
+  proto::ProposalRequest request;
+  request.mutable_round()->set_block_round(round.block_round);
+  request.mutable_round()->set_reject_round(round.reject_round);
+  request.set_max_chunk_bytes(max_chunk_bytes);
+  auto reader = stub_->RequestProposalChunks(&context, request);
+  iroha::protocol::Proposal proposal;
+  iroha::protocol::Proposal chunk;
+  bool received = false;
+  while (reader->Read(&chunk)) {
+    if (not received) {
+      proposal.Swap(&chunk);
+      received = true;
+    } else {
+      network::appendChunk(*chunk.mutable_transactions(),
+                           *proposal.mutable_transactions());
+    }
+    chunk.Clear();
+  }
+  auto status = reader->Finish();
+  if (not status.ok()) {
+    log_->warn("RPC failed: {}", status.error_message());
+    return boost::none;
+  }
+  if (not received) {
+    return boost::none;
+  }
+  return buildProposal(proposal);
+}
+
+boost::optional<std::shared_ptr<const OdOsNotification::ProposalType>>
+OnDemandOsClientGrpc::reconstructProposal(
+    consensus::Round round, const proto::CompactProposal &compact) {
+  iroha::protocol::Proposal proposal;
+  proposal.set_height(compact.height());
+  proposal.set_created_time(compact.created_time());
+
+  proto::TransactionsRequest request;
+  std::vector<iroha::protocol::Transaction *> missing;
+  for (const auto &hash : compact.transaction_hashes()) {
+    auto transaction = proposal.add_transactions();
+    if (auto known =
+            recent_transactions_->find(shared_model::crypto::Hash(hash))) {
+      *transaction =
+          static_cast<const shared_model::proto::Transaction &>(*known)
+              .getTransport();
+    } else {
+      missing.push_back(transaction);
+      *request.add_transaction_hashes() = hash;
+    }
+  }
+  log_->debug("Reconstructing proposal for {}: {} of {} transactions missing",
+              round,
+              missing.size(),
+              compact.transaction_hashes_size());
+
+  if (not missing.empty()) {
+    grpc::ClientContext context;
+    context.set_deadline(time_provider_() + proposal_request_timeout_);
+    request.mutable_round()->set_block_round(round.block_round);
+    request.mutable_round()->set_reject_round(round.reject_round);
+    proto::TransactionsResponse response;
+    auto status = stub_->RequestTransactions(&context, request, &response);
+    if (not status.ok()) {
+      log_->warn("RPC failed: {}", status.error_message());
+      return boost::none;
+    }
+    // transactions are returned in order of the proposal
+    if (static_cast<size_t>(response.transactions_size()) != missing.size()) {
+      log_->warn("Got {} of {} missing transactions for {}",
+                 response.transactions_size(),
+                 missing.size(),
+                 round);
+      return boost::none;
+    }
+    for (size_t i = 0; i < missing.size(); ++i) {
+      missing[i]->Swap(response.mutable_transactions(static_cast<int>(i)));
+    }
+  }
+
+  auto result = buildProposal(proposal);
+  if (result
+      and (*result)->hash()
+          != shared_model::crypto::Hash(compact.proposal_hash())) {
+    log_->warn("Reconstructed proposal for {} differs from the original",
+               round);
+    return boost::none;
+  }
+  return result;
+}
+
+boost::optional<std::shared_ptr<const OdOsNotification::ProposalType>>
+OnDemandOsClientGrpc::buildProposal(const iroha::protocol::Proposal &proposal) {
+  return proposal_factory_->build(proposal).match(
+      [&](auto &&v) {
+        return boost::make_optional(
+            std::shared_ptr<const OdOsNotification::ProposalType>(
+                std::move(v).value));
+      },
+      [this](const auto &error) {
+        log_->info("{}", error.error.error);  // error
+        return boost::optional<
+            std::shared_ptr<const OdOsNotification::ProposalType>>();
+      });
 }
 
 OnDemandOsClientGrpcFactory::OnDemandOsClientGrpcFactory(
@@ -84,20 +208,28 @@ OnDemandOsClientGrpcFactory::OnDemandOsClientGrpcFactory(
     std::shared_ptr<TransportFactoryType> proposal_factory,
     std::function<OnDemandOsClientGrpc::TimepointType()> time_provider,
     OnDemandOsClientGrpc::TimeoutType proposal_request_timeout,
-    logger::LoggerPtr client_log)
+    logger::LoggerPtr client_log,
+    std::shared_ptr<RecentTransactionsCache> recent_transactions)
     : async_call_(std::move(async_call)),
       proposal_factory_(std::move(proposal_factory)),
       time_provider_(time_provider),
       proposal_request_timeout_(proposal_request_timeout),
-      client_log_(std::move(client_log)) {}
+      client_log_(std::move(client_log)),
+      recent_transactions_(std::move(recent_transactions)) {}
 
 std::unique_ptr<OdOsNotification> OnDemandOsClientGrpcFactory::create(
     const shared_model::interface::Peer &to) {
   return std::make_unique<OnDemandOsClientGrpc>(
-      network::createClient<proto::OnDemandOrdering>(to.address()),
+      network::createPeerClient<proto::OnDemandOrdering>(to.address()),
       async_call_,
       proposal_factory_,
       time_provider_,
-      proposal_request_timeout_,
-      client_log_);
+      proposal_request_timeout_.load(),
+      client_log_,
+      recent_transactions_);
+}
+
+void OnDemandOsClientGrpcFactory::setProposalRequestTimeout(
+    OnDemandOsClientGrpc::TimeoutType proposal_request_timeout) {
+  proposal_request_timeout_ = proposal_request_timeout;
 }
@@ -8,10 +8,13 @@
 
 #include "ordering/on_demand_os_transport.hpp"
 
+#include <atomic>
+
 #include "interfaces/iroha_internal/abstract_transport_factory.hpp"
 #include "logger/logger_fwd.hpp"
 #include "network/impl/async_grpc_client.hpp"
 #include "ordering.grpc.pb.h"
+#include "ordering/impl/recent_transactions_cache.hpp"
 
 namespace iroha {
   namespace ordering {
@@ -32,6 +35,9 @@ namespace iroha {
         /**
          * Constructor is left public because testing required passing a mock
          * stub interface
+         * @param recent_transactions - transactions known to the peer, if
+         * provided, compact proposals are requested and reconstructed from
+         * these transactions, only missing ones are downloaded
          */
         OnDemandOsClientGrpc(
             std::unique_ptr<proto::OnDemandOrdering::StubInterface> stub,
@@ -40,7 +46,9 @@ namespace iroha {
             std::shared_ptr<TransportFactoryType> proposal_factory,
             std::function<TimepointType()> time_provider,
             std::chrono::milliseconds proposal_request_timeout,
-            logger::LoggerPtr log);
+            logger::LoggerPtr log,
+            std::shared_ptr<RecentTransactionsCache> recent_transactions =
+                nullptr);
 
         void onBatches(CollectionType batches) override;
 
@@ -48,6 +56,28 @@ namespace iroha {
             consensus::Round round) override;
 
        private:
+        boost::optional<std::shared_ptr<const ProposalType>> requestProposal(
+            consensus::Round round, bool compact);
+
+        /**
+         * Requests the full proposal as a stream of parts, which are parsed
+         * while the next ones are transferred
+         * @param max_chunk_bytes - limit of the size of transactions in a part
+         */
+        boost::optional<std::shared_ptr<const ProposalType>>
+        requestProposalChunks(consensus::Round round, uint32_t max_chunk_bytes);
+
+        /**
+         * Restores the full proposal from known and downloaded transactions
+         * @return the proposal, or none if it cannot be restored exactly
+         */
+        boost::optional<std::shared_ptr<const ProposalType>>
+        reconstructProposal(consensus::Round round,
+                            const proto::CompactProposal &compact);
+
+        boost::optional<std::shared_ptr<const ProposalType>> buildProposal(
+            const iroha::protocol::Proposal &proposal);
+
         logger::LoggerPtr log_;
         std::unique_ptr<proto::OnDemandOrdering::StubInterface> stub_;
         std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
@@ -55,6 +85,7 @@ namespace iroha {
         std::shared_ptr<TransportFactoryType> proposal_factory_;
         std::function<TimepointType()> time_provider_;
         std::chrono::milliseconds proposal_request_timeout_;
+        std::shared_ptr<RecentTransactionsCache> recent_transactions_;
       };
 
       class OnDemandOsClientGrpcFactory : public OdOsNotificationFactory {
@@ -66,7 +97,9 @@ namespace iroha {
             std::shared_ptr<TransportFactoryType> proposal_factory,
             std::function<OnDemandOsClientGrpc::TimepointType()> time_provider,
             OnDemandOsClientGrpc::TimeoutType proposal_request_timeout,
-            logger::LoggerPtr client_log);
+            logger::LoggerPtr client_log,
+            std::shared_ptr<RecentTransactionsCache> recent_transactions =
+                nullptr);
 
         /**
          * Create connection with insecure gRPC channel defined by
@@ -77,13 +110,21 @@ namespace iroha {
         std::unique_ptr<OdOsNotification> create(
             const shared_model::interface::Peer &to) override;
 
+        /**
+         * Change the timeout of proposal requests of the connections created
+         * afterwards, may be called concurrently
+         */
+        void setProposalRequestTimeout(
+            OnDemandOsClientGrpc::TimeoutType proposal_request_timeout);
+
        private:
         std::shared_ptr<network::AsyncGrpcClient<google::protobuf::Empty>>
             async_call_;
         std::shared_ptr<TransportFactoryType> proposal_factory_;
         std::function<OnDemandOsClientGrpc::TimepointType()> time_provider_;
-        std::chrono::milliseconds proposal_request_timeout_;
+        std::atomic<std::chrono::milliseconds> proposal_request_timeout_;
         logger::LoggerPtr client_log_;
+        std::shared_ptr<RecentTransactionsCache> recent_transactions_;
       };
 
     }  // namespace transport
@@ -7,12 +7,19 @@
 
 #include "ordering/impl/on_demand_os_server_grpc.hpp"
 
+#include <unordered_set>
+
 #include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/transformed.hpp>
+#include <google/protobuf/unknown_field_set.h>
 #include "backend/protobuf/proposal.hpp"
+#include "backend/protobuf/transaction.hpp"
 #include "common/bind.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "logger/logger.hpp"
+#include "metrics/metrics.hpp"
+#include "network/impl/grpc_compression.hpp"
+#include "network/peer_chunking.hpp"
 
 using namespace iroha::ordering;
 using namespace iroha::ordering::transport;
@@ -24,12 +31,17 @@ OnDemandOsServerGrpc::OnDemandOsServerGrpc(
         batch_parser,
     std::shared_ptr<shared_model::interface::TransactionBatchFactory>
         transaction_batch_factory,
-    logger::LoggerPtr log)
+    logger::LoggerPtr log,
+    std::shared_ptr<RecentTransactionsCache> recent_transactions,
+    std::shared_ptr<iroha::network::TransactionPool> transaction_pool)
     : ordering_service_(ordering_service),
       transaction_factory_(std::move(transaction_factory)),
       batch_parser_(std::move(batch_parser)),
       batch_factory_(std::move(transaction_batch_factory)),
-      log_(std::move(log)) {}
+      log_(std::move(log)),
+      recent_transactions_(std::move(recent_transactions)),
+      transaction_pool_(std::move(transaction_pool)),
+      memory_account_(metrics::registry(), "ordering") {}
 
 shared_model::interface::types::SharedTxsCollectionType
 OnDemandOsServerGrpc::deserializeTransactions(
@@ -61,7 +73,16 @@ grpc::Status OnDemandOsServerGrpc::SendBatches(
     ::grpc::ServerContext *context,
     const proto::BatchesRequest *request,
     ::google::protobuf::Empty *response) {
+  // received batches are kept by the ordering service until they are
+  // proposed
+  metrics::MemoryScope memory_scope(memory_account_);
   auto transactions = deserializeTransactions(request);
+  if (transaction_pool_) {
+    transaction_pool_->intern(transactions);
+  }
+  if (recent_transactions_) {
+    recent_transactions_->add(transactions);
+  }
 
   auto batch_candidates = batch_parser_->parseBatches(std::move(transactions));
 
@@ -90,9 +111,98 @@ grpc::Status OnDemandOsServerGrpc::RequestProposal(
   ordering_service_->onRequestProposal(
       {request->round().block_round(), request->round().reject_round()})
       | [&](auto &&proposal) {
-          *response->mutable_proposal() =
-              static_cast<const shared_model::proto::Proposal *>(proposal.get())
-                  ->getTransport();
+          if (request->compact()) {
+            // the requester restores the proposal from transactions it
+            // already knows and fetches the rest with RequestTransactions
+            auto compact = response->mutable_compact_proposal();
+            compact->set_height(proposal->height());
+            compact->set_created_time(proposal->createdTime());
+            for (const auto &tx : proposal->transactions()) {
+              const auto &hash = tx.hash().blob();
+              compact->add_transaction_hashes(hash.data(), hash.size());
+            }
+            const auto &hash = proposal->hash().blob();
+            compact->set_proposal_hash(hash.data(), hash.size());
+            return;
+          }
+          // the proposal is serialized once when it is created and shared by
+          // all peers requesting the round, so its bytes are sent as the
+          // proposal field instead of copying and serializing the transport
+          // object for every request
+          const auto &bytes = proposal->blob().blob();
+          response->GetReflection()
+              ->MutableUnknownFields(response)
+              ->AddLengthDelimited(proto::ProposalResponse::kProposalFieldNumber)
+              ->assign(bytes.begin(), bytes.end());
         };
+  network::compressLargeMessage(*context, response->ByteSizeLong());
+  return ::grpc::Status::OK;
+}
+
+grpc::Status OnDemandOsServerGrpc::RequestTransactions(
+    ::grpc::ServerContext *context,
+    const proto::TransactionsRequest *request,
+    proto::TransactionsResponse *response) {
+  ordering_service_->onRequestProposal(
+      {request->round().block_round(), request->round().reject_round()})
+      | [&](auto &&proposal) {
+          std::unordered_set<shared_model::crypto::Hash,
+                             shared_model::crypto::Hash::Hasher>
+              requested;
+          for (const auto &hash : request->transaction_hashes()) {
+            requested.emplace(hash);
+          }
+          // transactions are returned in order of the proposal
+          for (const auto &tx : proposal->transactions()) {
+            if (requested.count(tx.hash()) != 0) {
+              *response->add_transactions() =
+                  static_cast<const shared_model::proto::Transaction &>(tx)
+                      .getTransport();
+            }
+          }
+        };
+  network::compressLargeMessage(*context, response->ByteSizeLong());
+  return ::grpc::Status::OK;
+}
+
+grpc::Status OnDemandOsServerGrpc::RequestProposalChunks(
+    ::grpc::ServerContext *context,
+    const proto::ProposalRequest *request,
+    ::grpc::ServerWriter<iroha::protocol::Proposal> *writer) {
+  auto proposal = ordering_service_->onRequestProposal(
+      {request->round().block_round(), request->round().reject_round()});
+  if (not proposal) {
+    return ::grpc::Status::OK;
+  }
+  const auto &transactions = (*proposal)->transactions();
+  std::vector<size_t> sizes;
+  for (const auto &tx : transactions) {
+    sizes.push_back(tx.blob().size());
+  }
+
+  network::enableStreamCompression(*context);
+  iroha::protocol::Proposal chunk;
+  chunk.set_height((*proposal)->height());
+  chunk.set_created_time((*proposal)->createdTime());
+  auto tx = transactions.begin();
+  size_t index = 0;
+  for (auto end : network::chunkEnds(sizes, request->max_chunk_bytes())) {
+    // transactions are serialized once and shared by all peers requesting
+    // the round, so their bytes are sent as the transactions field
+    auto &fields = *chunk.GetReflection()->MutableUnknownFields(&chunk);
+    for (; index < end; ++index, ++tx) {
+      const auto &bytes = (*tx).blob().blob();
+      fields
+          .AddLengthDelimited(
+              iroha::protocol::Proposal::kTransactionsFieldNumber)
+          ->assign(bytes.begin(), bytes.end());
+    }
+    if (context->IsCancelled()
+        or not writer->Write(
+            chunk, network::compressionWriteOptions(chunk.ByteSizeLong()))) {
+      break;
+    }
+    chunk.Clear();
+  }
   return ::grpc::Status::OK;
 }
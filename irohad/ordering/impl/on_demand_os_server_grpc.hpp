@@ -12,7 +12,10 @@
 #include "interfaces/iroha_internal/transaction_batch_factory.hpp"
 #include "interfaces/iroha_internal/transaction_batch_parser.hpp"
 #include "logger/logger_fwd.hpp"
+#include "metrics/memory_accounting.hpp"
 #include "ordering.grpc.pb.h"
+#include "network/transaction_pool.hpp"
+#include "ordering/impl/recent_transactions_cache.hpp"
 
 namespace iroha {
   namespace ordering {
@@ -28,6 +31,12 @@ namespace iroha {
                 shared_model::interface::Transaction,
                 iroha::protocol::Transaction>;
 
+        /**
+         * @param recent_transactions - cache which received transactions are
+         * added to, so they are not downloaded again with compact proposals
+         * @param transaction_pool - pool of transactions alive in the peer,
+         * received transactions are replaced by their pooled instances
+         */
         OnDemandOsServerGrpc(
             std::shared_ptr<OdOsNotification> ordering_service,
             std::shared_ptr<TransportFactoryType> transaction_factory,
@@ -35,7 +44,11 @@ namespace iroha {
                 batch_parser,
             std::shared_ptr<shared_model::interface::TransactionBatchFactory>
                 transaction_batch_factory,
-            logger::LoggerPtr log);
+            logger::LoggerPtr log,
+            std::shared_ptr<RecentTransactionsCache> recent_transactions =
+                nullptr,
+            std::shared_ptr<network::TransactionPool> transaction_pool =
+                nullptr);
 
         grpc::Status SendBatches(::grpc::ServerContext *context,
                                  const proto::BatchesRequest *request,
@@ -46,6 +59,16 @@ namespace iroha {
             const proto::ProposalRequest *request,
             proto::ProposalResponse *response) override;
 
+        grpc::Status RequestTransactions(
+            ::grpc::ServerContext *context,
+            const proto::TransactionsRequest *request,
+            proto::TransactionsResponse *response) override;
+
+        grpc::Status RequestProposalChunks(
+            ::grpc::ServerContext *context,
+            const proto::ProposalRequest *request,
+            ::grpc::ServerWriter<iroha::protocol::Proposal> *writer) override;
+
        private:
         /**
          * Flat map transport transactions to shared model
@@ -62,6 +85,9 @@ namespace iroha {
             batch_factory_;
 
         logger::LoggerPtr log_;
+        std::shared_ptr<RecentTransactionsCache> recent_transactions_;
+        std::shared_ptr<network::TransactionPool> transaction_pool_;
+        metrics::MemoryAccount memory_account_;
       };
 
     }  // namespace transport
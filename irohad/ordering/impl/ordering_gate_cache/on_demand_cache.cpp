@@ -10,13 +10,41 @@
 
 using namespace iroha::ordering::cache;
 
+namespace {
+  /// size of serialized transactions of the batch
+  size_t batchSize(
+      const std::shared_ptr<shared_model::interface::TransactionBatch> &batch) {
+    size_t size = 0;
+    for (const auto &tx : batch->transactions()) {
+      size += tx->blob().size();
+    }
+    return size;
+  }
+}  // namespace
+
 // TODO: IR-1864 13.11.18 kamilsa use nvi to separate business logic and locking
 // logic
 
+OnDemandCache::OnDemandCache(size_t max_size_bytes)
+    : max_size_bytes_(max_size_bytes) {}
+
 void OnDemandCache::addToBack(
     const OrderingGateCache::BatchesSetType &batches) {
   std::unique_lock<std::shared_timed_mutex> lock(mutex_);
-  circ_buffer.back().insert(batches.begin(), batches.end());
+  if (max_size_bytes_ == 0) {
+    circ_buffer.back().insert(batches.begin(), batches.end());
+    return;
+  }
+  for (const auto &batch : batches) {
+    // the limit may be exceeded by a single batch, so that any batch fits into
+    // the cache which is not full
+    if (size_bytes_ >= max_size_bytes_) {
+      break;
+    }
+    if (circ_buffer.back().insert(batch).second) {
+      size_bytes_ += batchSize(batch);
+    }
+  }
 }
 
 void OnDemandCache::remove(const OrderingGateCache::HashesSetType &hashes) {
@@ -30,6 +58,9 @@ void OnDemandCache::remove(const OrderingGateCache::HashesSetType &hashes) {
                       })) {
         // returns iterator following the last removed element
         // hence there is no increment in loop iteration_expression
+        if (max_size_bytes_ != 0) {
+          size_bytes_ -= batchSize(*it);
+        }
         it = batches.erase(it);
       } else {
         ++it;
@@ -42,6 +73,11 @@ OrderingGateCache::BatchesSetType OnDemandCache::pop() {
   std::unique_lock<std::shared_timed_mutex> lock(mutex_);
   BatchesSetType res;
   std::swap(res, circ_buffer.front());
+  if (max_size_bytes_ != 0) {
+    for (const auto &batch : res) {
+      size_bytes_ -= batchSize(batch);
+    }
+  }
   // push empty set to remove front element
   circ_buffer.push_back(BatchesSetType{});
   return res;
@@ -56,3 +92,8 @@ const OrderingGateCache::BatchesSetType &OnDemandCache::tail() const {
   std::shared_lock<std::shared_timed_mutex> lock(mutex_);
   return circ_buffer.back();
 }
+
+bool OnDemandCache::isFull() const {
+  std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+  return max_size_bytes_ != 0 and size_bytes_ >= max_size_bytes_;
+}
@@ -8,6 +8,7 @@
 
 #include "ordering/impl/ordering_gate_cache/ordering_gate_cache.hpp"
 
+#include <mutex>
 #include <shared_mutex>
 
 #include <boost/circular_buffer.hpp>
@@ -18,6 +19,12 @@ namespace iroha {
 
       class OnDemandCache : public OrderingGateCache {
        public:
+        /**
+         * @param max_size_bytes - limit of total size of cached transactions,
+         * 0 means no limit
+         */
+        explicit OnDemandCache(size_t max_size_bytes = 0);
+
         void addToBack(const BatchesSetType &batches) override;
 
         BatchesSetType pop() override;
@@ -28,7 +35,12 @@ namespace iroha {
 
         virtual const BatchesSetType &tail() const override;
 
+        bool isFull() const override;
+
        private:
+        const size_t max_size_bytes_;
+        /// total size of cached transactions, counted only with a limit
+        size_t size_bytes_ = 0;
         mutable std::shared_timed_mutex mutex_;
         using BatchesQueueType = boost::circular_buffer<BatchesSetType>;
         BatchesQueueType circ_buffer{3, BatchesSetType{}};
@@ -73,6 +73,12 @@ namespace iroha {
          */
         virtual const BatchesSetType &tail() const = 0;
 
+        /**
+         * @return true if the cache reached its size limit, new batches are
+         * not added to a full cache
+         */
+        virtual bool isFull() const = 0;
+
         virtual ~OrderingGateCache() = default;
       };
 
@@ -0,0 +1,131 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/proposal_selection_policies.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+
+#include <boost/range/adaptor/indirected.hpp>
+#include <boost/range/adaptor/map.hpp>
+#include <boost/range/size.hpp>
+#include "interfaces/iroha_internal/transaction_batch.hpp"
+#include "interfaces/transaction.hpp"
+
+using namespace iroha::ordering;
+
+namespace {
+  size_t transactionsCount(const ProposalSelectionPolicy::BatchType &batch) {
+    return boost::size(batch->transactions());
+  }
+
+  shared_model::interface::types::TimestampType oldestTime(
+      const ProposalSelectionPolicy::BatchType &batch) {
+    const auto &transactions = batch->transactions();
+    return (*std::min_element(transactions.begin(),
+                              transactions.end(),
+                              [](const auto &lhs, const auto &rhs) {
+                                return lhs->createdTime() < rhs->createdTime();
+                              }))
+        ->createdTime();
+  }
+
+  /// take batches in the given order until the next one does not fit
+  template <typename Range>
+  std::vector<ProposalSelectionPolicy::BatchType> takeWhileFits(
+      const Range &batches, size_t transactions_limit) {
+    std::vector<ProposalSelectionPolicy::BatchType> result;
+    size_t transactions = 0;
+    for (const auto &batch : batches) {
+      auto count = transactionsCount(batch);
+      if (transactions + count > transactions_limit) {
+        break;
+      }
+      transactions += count;
+      result.push_back(batch);
+    }
+    return result;
+  }
+}  // namespace
+
+std::vector<ProposalSelectionPolicy::BatchType> FifoSelectionPolicy::select(
+    const BatchListType &pending, size_t transactions_limit) const {
+  return takeWhileFits(pending, transactions_limit);
+}
+
+std::vector<ProposalSelectionPolicy::BatchType>
+OldestFirstSelectionPolicy::select(const BatchListType &pending,
+                                   size_t transactions_limit) const {
+  std::vector<std::pair<shared_model::interface::types::TimestampType,
+                        const BatchType *>>
+      order;
+  order.reserve(pending.size());
+  for (const auto &batch : pending) {
+    order.emplace_back(oldestTime(batch), &batch);
+  }
+  std::stable_sort(
+      order.begin(), order.end(), [](const auto &lhs, const auto &rhs) {
+        return lhs.first < rhs.first;
+      });
+
+  return takeWhileFits(order | boost::adaptors::map_values
+                           | boost::adaptors::indirected,
+                       transactions_limit);
+}
+
+std::vector<ProposalSelectionPolicy::BatchType>
+FairShareSelectionPolicy::select(const BatchListType &pending,
+                                 size_t transactions_limit) const {
+  // batches of every creator in order of arrival, creators in order of their
+  // first batch arrival
+  std::vector<std::vector<const BatchType *>> queues;
+  std::unordered_map<std::string, size_t> creator_queue;
+  for (const auto &batch : pending) {
+    const auto &creator = batch->transactions().front()->creatorAccountId();
+    auto it = creator_queue.emplace(creator, queues.size()).first;
+    if (it->second == queues.size()) {
+      queues.emplace_back();
+    }
+    queues[it->second].push_back(&batch);
+  }
+
+  std::vector<BatchType> result;
+  std::vector<size_t> next(queues.size(), 0);
+  std::vector<size_t> active(queues.size());
+  for (size_t i = 0; i < queues.size(); ++i) {
+    active[i] = i;
+  }
+  size_t transactions = 0;
+  while (not active.empty() and transactions < transactions_limit) {
+    std::vector<size_t> still_active;
+    for (auto queue : active) {
+      const auto &batch = *queues[queue][next[queue]];
+      auto count = transactionsCount(batch);
+      if (transactions + count > transactions_limit) {
+        continue;
+      }
+      transactions += count;
+      result.push_back(batch);
+      if (++next[queue] < queues[queue].size()) {
+        still_active.push_back(queue);
+      }
+    }
+    active.swap(still_active);
+  }
+  return result;
+}
+
+std::shared_ptr<ProposalSelectionPolicy>
+iroha::ordering::makeProposalSelectionPolicy(ProposalSelectionPolicyType type) {
+  switch (type) {
+    case ProposalSelectionPolicyType::kOldestFirst:
+      return std::make_shared<OldestFirstSelectionPolicy>();
+    case ProposalSelectionPolicyType::kFairShare:
+      return std::make_shared<FairShareSelectionPolicy>();
+    case ProposalSelectionPolicyType::kFifo:
+    default:
+      return std::make_shared<FifoSelectionPolicy>();
+  }
+}
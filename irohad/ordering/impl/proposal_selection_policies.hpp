@@ -0,0 +1,58 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PROPOSAL_SELECTION_POLICIES_HPP
+#define IROHA_PROPOSAL_SELECTION_POLICIES_HPP
+
+#include "ordering/proposal_selection_policy.hpp"
+
+#include <memory>
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Takes batches in order of arrival until the next one does not fit.
+     * Visits only the taken batches
+     */
+    class FifoSelectionPolicy : public ProposalSelectionPolicy {
+     public:
+      std::vector<BatchType> select(const BatchListType &pending,
+                                    size_t transactions_limit) const override;
+    };
+
+    /**
+     * Takes batches in order of the creation time of their oldest
+     * transaction until the next one does not fit, ties are resolved by
+     * arrival. Sorts all pending batches
+     */
+    class OldestFirstSelectionPolicy : public ProposalSelectionPolicy {
+     public:
+      std::vector<BatchType> select(const BatchListType &pending,
+                                    size_t transactions_limit) const override;
+    };
+
+    /**
+     * Creators of batches take turns, each turn takes the earliest arrived
+     * batch of the creator, so a creator with many pending batches does not
+     * delay others. A creator whose next batch does not fit is skipped.
+     * Batch creator is the creator of its first transaction
+     */
+    class FairShareSelectionPolicy : public ProposalSelectionPolicy {
+     public:
+      std::vector<BatchType> select(const BatchListType &pending,
+                                    size_t transactions_limit) const override;
+    };
+
+    /**
+     * Creates policy of the given type
+     */
+    std::shared_ptr<ProposalSelectionPolicy> makeProposalSelectionPolicy(
+        ProposalSelectionPolicyType type);
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_PROPOSAL_SELECTION_POLICIES_HPP
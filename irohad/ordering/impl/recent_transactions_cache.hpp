@@ -0,0 +1,70 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_ORDERING_RECENT_TRANSACTIONS_CACHE_HPP
+#define IROHA_ORDERING_RECENT_TRANSACTIONS_CACHE_HPP
+
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+
+#include "cache/cache.hpp"
+#include "cryptography/hash.hpp"
+#include "interfaces/common_objects/transaction_sequence_common.hpp"
+#include "interfaces/common_objects/types.hpp"
+#include "interfaces/transaction.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Transactions recently received or sent by the peer through on-demand
+     * ordering transport, used to reconstruct compact proposals without
+     * downloading transactions which are already known. Transactions are
+     * added by concurrent transport handlers while proposals are
+     * reconstructed, so access is guarded by a mutex
+     */
+    class RecentTransactionsCache {
+     public:
+      /**
+       * @param capacity - maximum number of kept transactions, older flushed
+       * transactions are forgotten first
+       */
+      explicit RecentTransactionsCache(uint32_t capacity)
+          : cache_(capacity, capacity - capacity / 4) {}
+
+      /**
+       * Remembers transactions
+       */
+      void add(
+          const shared_model::interface::types::SharedTxsCollectionType &txs) {
+        std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+        for (const auto &tx : txs) {
+          cache_.addItem(tx->hash(), tx);
+        }
+      }
+
+      /**
+       * @return transaction with the given hash, nullptr if it is not known
+       */
+      std::shared_ptr<shared_model::interface::Transaction> find(
+          const shared_model::interface::types::HashType &hash) const {
+        std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+        return cache_.findItem(hash).value_or(nullptr);
+      }
+
+     private:
+      mutable std::shared_timed_mutex mutex_;
+      iroha::cache::ClockCache<
+          shared_model::crypto::Hash,
+          std::shared_ptr<shared_model::interface::Transaction>,
+          shared_model::crypto::Hash::Hasher>
+          cache_;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_ORDERING_RECENT_TRANSACTIONS_CACHE_HPP
@@ -0,0 +1,108 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/sharded_connection_manager.hpp"
+
+#include <algorithm>
+#include <future>
+#include <unordered_set>
+
+#include <boost/range/adaptor/indirected.hpp>
+#include <boost/range/empty.hpp>
+#include "interfaces/iroha_internal/proposal.hpp"
+#include "interfaces/iroha_internal/transaction_batch.hpp"
+#include "interfaces/transaction.hpp"
+#include "logger/logger.hpp"
+
+using namespace iroha;
+using namespace iroha::ordering;
+
+ShardedConnectionManager::ShardedConnectionManager(
+    std::vector<std::shared_ptr<transport::OdOsNotification>> shards,
+    std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
+        proposal_factory,
+    logger::LoggerPtr log)
+    : shards_(std::move(shards)),
+      proposal_factory_(std::move(proposal_factory)),
+      log_(std::move(log)) {}
+
+size_t ShardedConnectionManager::shardOf(
+    const TransactionBatchType &batch) const {
+  // leading bytes of the hash in big-endian order, so all peers choose the
+  // same shard regardless of their platform
+  const auto &blob = batch->reducedHash().blob();
+  uint64_t value = 0;
+  for (size_t i = 0; i < std::min<size_t>(blob.size(), sizeof(value)); ++i) {
+    value = (value << 8) | blob[i];
+  }
+  return value % shards_.size();
+}
+
+void ShardedConnectionManager::onBatches(CollectionType batches) {
+  std::vector<CollectionType> shard_batches(shards_.size());
+  for (auto &batch : batches) {
+    shard_batches[shardOf(batch)].push_back(std::move(batch));
+  }
+  for (size_t shard = 0; shard < shards_.size(); ++shard) {
+    if (not shard_batches[shard].empty()) {
+      shards_[shard]->onBatches(std::move(shard_batches[shard]));
+    }
+  }
+}
+
+boost::optional<std::shared_ptr<const ShardedConnectionManager::ProposalType>>
+ShardedConnectionManager::onRequestProposal(consensus::Round round) {
+  // proposals of the shards are requested at once, the round waits for the
+  // slowest of them anyway
+  std::vector<std::future<boost::optional<std::shared_ptr<const ProposalType>>>>
+      requests;
+  for (size_t shard = 1; shard < shards_.size(); ++shard) {
+    requests.push_back(std::async(std::launch::async, [this, shard, round] {
+      return shards_[shard]->onRequestProposal(round);
+    }));
+  }
+  std::vector<std::shared_ptr<const ProposalType>> proposals;
+  auto add = [&proposals](auto proposal) {
+    if (proposal and not boost::empty((*proposal)->transactions())) {
+      proposals.push_back(std::move(*proposal));
+    }
+  };
+  add(shards_.front()->onRequestProposal(round));
+  for (auto &request : requests) {
+    add(request.get());
+  }
+
+  log_->debug("Received {} of {} shard proposals for {}",
+              proposals.size(),
+              shards_.size(),
+              round);
+  if (proposals.empty()) {
+    return boost::none;
+  }
+  if (proposals.size() == 1) {
+    return proposals.front();
+  }
+
+  // a batch belongs to one shard, duplicates come only from peers which
+  // disagree on the shards, and the first occurrence is kept
+  std::vector<const shared_model::interface::Transaction *> transactions;
+  std::unordered_set<shared_model::crypto::Hash,
+                     shared_model::crypto::Hash::Hasher>
+      hashes;
+  shared_model::interface::types::TimestampType created_time = 0;
+  for (const auto &proposal : proposals) {
+    created_time = std::max(created_time, proposal->createdTime());
+    for (const auto &tx : proposal->transactions()) {
+      if (hashes.insert(tx.hash()).second) {
+        transactions.push_back(&tx);
+      }
+    }
+  }
+  return std::shared_ptr<const ProposalType>(
+      proposal_factory_->unsafeCreateProposal(
+          round.block_round,
+          created_time,
+          transactions | boost::adaptors::indirected));
+}
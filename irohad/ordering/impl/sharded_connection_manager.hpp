@@ -0,0 +1,56 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARDED_CONNECTION_MANAGER_HPP
+#define IROHA_SHARDED_CONNECTION_MANAGER_HPP
+
+#include "ordering/on_demand_os_transport.hpp"
+
+#include <vector>
+
+#include "interfaces/iroha_internal/unsafe_proposal_factory.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Splits ordering between several shards, each of them with its own
+     * ordering services in every round. A batch is sent to the shard chosen
+     * by its reduced hash, so each ordering service receives a part of the
+     * transactions. The proposal of a round is merged from the proposals of
+     * all shards in the order of shards, which every peer does the same way
+     */
+    class ShardedConnectionManager : public transport::OdOsNotification {
+     public:
+      /**
+       * @param shards - connections to ordering services of the shards
+       * @param proposal_factory - creates merged proposals
+       */
+      ShardedConnectionManager(
+          std::vector<std::shared_ptr<transport::OdOsNotification>> shards,
+          std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
+              proposal_factory,
+          logger::LoggerPtr log);
+
+      void onBatches(CollectionType batches) override;
+
+      boost::optional<std::shared_ptr<const ProposalType>> onRequestProposal(
+          consensus::Round round) override;
+
+      /// @return index of the shard the batch belongs to
+      size_t shardOf(const TransactionBatchType &batch) const;
+
+     private:
+      std::vector<std::shared_ptr<transport::OdOsNotification>> shards_;
+      std::shared_ptr<shared_model::interface::UnsafeProposalFactory>
+          proposal_factory_;
+      logger::LoggerPtr log_;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_SHARDED_CONNECTION_MANAGER_HPP
@@ -0,0 +1,53 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PROPOSAL_SELECTION_POLICY_HPP
+#define IROHA_PROPOSAL_SELECTION_POLICY_HPP
+
+#include <deque>
+#include <vector>
+
+#include "ordering/on_demand_os_transport.hpp"
+
+namespace iroha {
+  namespace ordering {
+
+    /**
+     * Order in which the ordering service takes pending batches to proposals
+     */
+    enum class ProposalSelectionPolicyType {
+      /// batches are taken in order of arrival
+      kFifo,
+      /// batches with the oldest transactions are taken first
+      kOldestFirst,
+      /// creators take turns, one batch each, in order of arrival
+      kFairShare
+    };
+
+    /**
+     * Selects batches for the next proposal from the pending ones
+     */
+    class ProposalSelectionPolicy {
+     public:
+      using BatchType = transport::OdOsNotification::TransactionBatchType;
+      using BatchListType = std::deque<BatchType>;
+
+      virtual ~ProposalSelectionPolicy() = default;
+
+      /**
+       * Selects batches, batches are never split
+       * @param pending - pending batches in order of arrival
+       * @param transactions_limit - maximum number of transactions in selected
+       * batches
+       * @return selected batches in order of their appearance in the proposal
+       */
+      virtual std::vector<BatchType> select(
+          const BatchListType &pending, size_t transactions_limit) const = 0;
+    };
+
+  }  // namespace ordering
+}  // namespace iroha
+
+#endif  // IROHA_PROPOSAL_SELECTION_POLICY_HPP
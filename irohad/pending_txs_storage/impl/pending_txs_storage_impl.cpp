@@ -5,6 +5,9 @@
 
 #include "pending_txs_storage/impl/pending_txs_storage_impl.hpp"
 
+#include <algorithm>
+#include <mutex>
+
 #include "interfaces/transaction.hpp"
 #include "multi_sig_transactions/state/mst_state.hpp"
 
@@ -40,13 +43,28 @@ namespace iroha {
     prepared_transactions_subscription_.unsubscribe();
   }
 
+  constexpr size_t PendingTransactionStorageImpl::kShardsNumber;
+
+  PendingTransactionStorageImpl::Shard &PendingTransactionStorageImpl::shard(
+      const AccountIdType &account_id) {
+    return shards_[std::hash<AccountIdType>{}(account_id) % kShardsNumber];
+  }
+
+  const PendingTransactionStorageImpl::Shard &
+  PendingTransactionStorageImpl::shard(const AccountIdType &account_id) const {
+    return shards_[std::hash<AccountIdType>{}(account_id) % kShardsNumber];
+  }
+
   PendingTransactionStorageImpl::SharedTxsCollectionType
   PendingTransactionStorageImpl::getPendingTransactions(
       const AccountIdType &account_id) const {
-    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
-    auto account_batches_iterator = storage_.find(account_id);
-    if (storage_.end() != account_batches_iterator) {
+    const auto &account_shard = shard(account_id);
+    std::shared_lock<ShardMutex> lock(account_shard.mutex);
+    auto account_batches_iterator = account_shard.accounts.find(account_id);
+    if (account_shard.accounts.end() != account_batches_iterator) {
       SharedTxsCollectionType result;
+      result.reserve(
+          account_batches_iterator->second.all_transactions_quantity);
       for (const auto &batch : account_batches_iterator->second.batches) {
         auto &txs = batch->transactions();
         result.insert(result.end(), txs.begin(), txs.end());
@@ -64,9 +82,10 @@ namespace iroha {
       const boost::optional<shared_model::interface::types::HashType>
           &first_tx_hash) const {
     BOOST_ASSERT_MSG(page_size > 0, "Page size has to be positive");
-    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
-    auto account_batches_iterator = storage_.find(account_id);
-    if (storage_.end() == account_batches_iterator) {
+    const auto &account_shard = shard(account_id);
+    std::shared_lock<ShardMutex> lock(account_shard.mutex);
+    auto account_batches_iterator = account_shard.accounts.find(account_id);
+    if (account_shard.accounts.end() == account_batches_iterator) {
       if (first_tx_hash) {
         return iroha::expected::makeError(
             PendingTransactionStorage::ErrorCode::kNotFound);
@@ -90,6 +109,8 @@ namespace iroha {
 
     PendingTransactionStorage::Response response;
     response.all_transactions_size = account_batches.all_transactions_quantity;
+    response.transactions.reserve(
+        std::min<size_t>(page_size, account_batches.all_transactions_quantity));
     auto remaining_space = page_size;
     while (account_batches.batches.end() != batch_iterator
            and remaining_space
@@ -122,16 +143,17 @@ namespace iroha {
 
   void PendingTransactionStorageImpl::updatedBatchesHandler(
       const SharedState &updated_batches) {
-    // need to test performance somehow - where to put the lock
-    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
     updated_batches->iterateBatches([this](const auto &batch) {
       auto first_tx_hash = batch->transactions().front()->hash();
       auto batch_creators = batchCreators(*batch);
       auto batch_size = batch->transactions().size();
       for (const auto &creator : batch_creators) {
-        auto account_batches_iterator = storage_.find(creator);
-        if (storage_.end() == account_batches_iterator) {
-          auto insertion_result = storage_.emplace(
+        auto &creator_shard = shard(creator);
+        std::unique_lock<ShardMutex> lock(creator_shard.mutex);
+        auto &storage = creator_shard.accounts;
+        auto account_batches_iterator = storage.find(creator);
+        if (storage.end() == account_batches_iterator) {
+          auto insertion_result = storage.emplace(
               creator, PendingTransactionStorageImpl::AccountBatches{});
           BOOST_ASSERT(insertion_result.second);
           account_batches_iterator = insertion_result.first;
@@ -159,10 +181,12 @@ namespace iroha {
       const HashType &first_tx_hash,
       const std::set<AccountIdType> &batch_creators,
       uint64_t batch_size) {
-    // outer scope has to acquire unique lock over mutex_
     for (const auto &creator : batch_creators) {
-      auto account_batches_iterator = storage_.find(creator);
-      if (account_batches_iterator != storage_.end()) {
+      auto &creator_shard = shard(creator);
+      std::unique_lock<ShardMutex> lock(creator_shard.mutex);
+      auto &storage = creator_shard.accounts;
+      auto account_batches_iterator = storage.find(creator);
+      if (account_batches_iterator != storage.end()) {
         auto &account_batches = account_batches_iterator->second;
         auto index_iterator = account_batches.index.find(first_tx_hash);
         if (index_iterator != account_batches.index.end()) {
@@ -173,7 +197,7 @@ namespace iroha {
           account_batches.all_transactions_quantity -= batch_size;
         }
         if (0 == account_batches.all_transactions_quantity) {
-          storage_.erase(account_batches_iterator);
+          storage.erase(account_batches_iterator);
         }
       }
     }
@@ -183,7 +207,6 @@ namespace iroha {
     auto creators = batchCreators(*batch);
     auto first_tx_hash = batch->transactions().front()->hash();
     auto batch_size = batch->transactions().size();
-    std::unique_lock<std::shared_timed_mutex> lock(mutex_);
     removeFromStorage(first_tx_hash, creators, batch_size);
   }
 
@@ -194,9 +217,10 @@ namespace iroha {
     auto &creator_id = prepared_transaction.first;
     auto &first_transaction_hash = prepared_transaction.second;
     {
-      std::shared_lock<std::shared_timed_mutex> lock(mutex_);
-      auto account_batches_iterator = storage_.find(creator_id);
-      if (account_batches_iterator != storage_.end()) {
+      const auto &creator_shard = shard(creator_id);
+      std::shared_lock<ShardMutex> lock(creator_shard.mutex);
+      auto account_batches_iterator = creator_shard.accounts.find(creator_id);
+      if (account_batches_iterator != creator_shard.accounts.end()) {
         auto &account_batches = account_batches_iterator->second;
         auto index_iterator =
             account_batches.index.find(first_transaction_hash);
@@ -209,7 +233,6 @@ namespace iroha {
       }
     }
     if (creators and batch_size) {
-      std::unique_lock<std::shared_timed_mutex> lock(mutex_);
       removeFromStorage(first_transaction_hash, *creators, *batch_size);
     }
   }
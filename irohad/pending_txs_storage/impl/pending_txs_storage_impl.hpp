@@ -6,6 +6,7 @@
 #ifndef IROHA_PENDING_TXS_STORAGE_IMPL_HPP
 #define IROHA_PENDING_TXS_STORAGE_IMPL_HPP
 
+#include <array>
 #include <list>
 #include <set>
 #include <shared_mutex>
@@ -13,6 +14,7 @@
 
 #include <rxcpp/rx.hpp>
 #include "interfaces/iroha_internal/transaction_batch.hpp"
+#include "metrics/profiled_mutex.hpp"
 #include "pending_txs_storage/pending_txs_storage.hpp"
 
 namespace iroha {
@@ -57,6 +59,7 @@ namespace iroha {
 
     void removeBatch(const PreparedTransactionDescriptor &prepared_transaction);
 
+    /// locks shards of the creators one by one
     void removeFromStorage(const HashType &first_tx_hash,
                            const std::set<AccountIdType> &batch_creators,
                            uint64_t batch_size);
@@ -71,11 +74,6 @@ namespace iroha {
     rxcpp::composite_subscription expired_batch_subscription_;
     rxcpp::composite_subscription prepared_transactions_subscription_;
 
-    /**
-     * Mutex for single-write multiple-read storage access
-     */
-    mutable std::shared_timed_mutex mutex_;
-
     /**
      * The struct represents an indexed storage of pending transactions or
      * batches for a SINGLE account.
@@ -98,10 +96,32 @@ namespace iroha {
       uint64_t all_transactions_quantity{0};
     };
 
+    using ShardMutex = metrics::ProfiledMutex<std::shared_timed_mutex>;
+
     /**
-     * Maps account names with its storages of pending transactions or batches.
+     * Accounts are spread over shards by hash of their ids, so that queries
+     * and MST updates of different accounts do not contend for one lock
      */
-    std::unordered_map<AccountIdType, AccountBatches> storage_;
+    struct Shard {
+      /**
+       * Mutex for single-write multiple-read shard access
+       */
+      mutable ShardMutex mutex{"pending_txs_storage"};
+
+      /**
+       * Maps account names with its storages of pending transactions or
+       * batches.
+       */
+      std::unordered_map<AccountIdType, AccountBatches> accounts;
+    };
+
+    static constexpr size_t kShardsNumber = 16;
+
+    Shard &shard(const AccountIdType &account_id);
+
+    const Shard &shard(const AccountIdType &account_id) const;
+
+    std::array<Shard, kShardsNumber> shards_;
   };
 
 }  // namespace iroha
@@ -10,6 +10,7 @@
 #include "interfaces/iroha_internal/block.hpp"
 #include "interfaces/iroha_internal/proposal.hpp"
 #include "logger/logger.hpp"
+#include "tracing/transaction_tracer.hpp"
 
 namespace iroha {
   namespace simulator {
@@ -28,12 +29,23 @@ namespace iroha {
           ametsuchi_factory_(std::move(factory)),
           crypto_signer_(std::move(crypto_signer)),
           block_factory_(std::move(block_factory)),
-          log_(std::move(log)) {
+          log_(std::move(log)),
+          validation_time_metric_(metrics::registry().histogram(
+              "iroha_simulator_validation_microseconds",
+              "Time spent on stateful validation of proposals")),
+          reused_validation_metric_(metrics::registry().counter(
+              "iroha_simulator_reused_validations_total",
+              "Proposals processed again on the same ledger state, whose "
+              "validation results are reused")),
+          block_creation_time_metric_(metrics::registry().histogram(
+              "iroha_simulator_block_creation_microseconds",
+              "Time spent creating and signing blocks")) {
       ordering_gate->onProposal().subscribe(
           proposal_subscription_, [this](const network::OrderingEvent &event) {
             if (event.proposal) {
-              auto validated_proposal_and_errors =
-                  this->processProposal(*getProposalUnsafe(event));
+              auto validated_proposal_and_errors = this->processProposalOnce(
+                  *getProposalUnsafe(event),
+                  event.ledger_state->top_block_info.top_hash);
 
               if (validated_proposal_and_errors) {
                 notifier_.get_subscriber().on_next(
@@ -83,6 +95,9 @@ namespace iroha {
     Simulator::processProposal(
         const shared_model::interface::Proposal &proposal) {
       log_->info("process proposal");
+      metrics::ScopedTimer timer(validation_time_metric_);
+      tracing::tracer().markAll(proposal.transactions(),
+                                tracing::TransactionStage::kProposed);
 
       auto temporary_wsv_var = ametsuchi_factory_->createTemporaryWsv();
       if (auto e =
@@ -99,17 +114,50 @@ namespace iroha {
       std::shared_ptr<iroha::validation::VerifiedProposalAndErrors>
           validated_proposal_and_errors =
               validator_->validate(proposal, *storage);
-      ametsuchi_factory_->prepareBlock(std::move(storage));
+      tracing::tracer().markAll(
+          validated_proposal_and_errors->verified_proposal->transactions(),
+          tracing::TransactionStage::kValidated);
+      for (const auto &rejected :
+           validated_proposal_and_errors->rejected_transactions) {
+        tracing::tracer().mark(rejected.tx_hash,
+                               tracing::TransactionStage::kRejected);
+      }
+      if (validated_proposal_and_errors->wsv_has_all_effects) {
+        ametsuchi_factory_->prepareBlock(std::move(storage));
+      } else {
+        log_->debug("verified proposal state is not prepared");
+      }
 
       return validated_proposal_and_errors;
     }
 
+    boost::optional<std::shared_ptr<validation::VerifiedProposalAndErrors>>
+    Simulator::processProposalOnce(
+        const shared_model::interface::Proposal &proposal,
+        const shared_model::crypto::Hash &top_hash) {
+      if (last_validation_
+          and last_validation_->proposal_hash == proposal.hash()
+          and last_validation_->top_hash == top_hash) {
+        log_->info("reusing validation of proposal {}", proposal.hash().hex());
+        reused_validation_metric_.increment();
+        return last_validation_->result;
+      }
+
+      last_validation_ = boost::none;
+      auto result = processProposal(proposal);
+      if (result) {
+        last_validation_ = Validation{proposal.hash(), top_hash, *result};
+      }
+      return result;
+    }
+
     boost::optional<std::shared_ptr<shared_model::interface::Block>>
     Simulator::processVerifiedProposal(
         const std::shared_ptr<iroha::validation::VerifiedProposalAndErrors>
             &verified_proposal_and_errors,
         const TopBlockInfo &top_block_info) {
       log_->info("process verified proposal");
+      metrics::ScopedTimer timer(block_creation_time_metric_);
 
       const auto &proposal = verified_proposal_and_errors->verified_proposal;
       std::vector<shared_model::crypto::Hash> rejected_hashes;
@@ -124,6 +172,8 @@ namespace iroha {
                                             proposal->transactions(),
                                             rejected_hashes);
       crypto_signer_->sign(*block);
+      tracing::tracer().markAll(proposal->transactions(),
+                                tracing::TransactionStage::kBlockCreated);
 
       return block;
     }
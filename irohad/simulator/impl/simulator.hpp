@@ -14,6 +14,7 @@
 #include "cryptography/crypto_provider/abstract_crypto_model_signer.hpp"
 #include "interfaces/iroha_internal/unsafe_block_factory.hpp"
 #include "logger/logger_fwd.hpp"
+#include "metrics/metrics.hpp"
 #include "network/ordering_gate.hpp"
 #include "validation/stateful_validator.hpp"
 
@@ -52,6 +53,26 @@ namespace iroha {
       rxcpp::observable<BlockCreatorEvent> onBlock() override;
 
      private:
+      /// Validation result of a proposal on a ledger state
+      struct Validation {
+        shared_model::crypto::Hash proposal_hash;
+        shared_model::crypto::Hash top_hash;
+        std::shared_ptr<validation::VerifiedProposalAndErrors> result;
+      };
+
+      /**
+       * Process the proposal unless it is the last processed one and the
+       * ledger has not changed since then, e.g. a proposal reissued in the
+       * next reject round, then its validation result is reused. Only the
+       * last result is kept, since the prepared state of the storage is the
+       * one of the last processed proposal
+       * @param proposal - proposal to process
+       * @param top_hash - hash of the top block of the ledger
+       */
+      boost::optional<std::shared_ptr<validation::VerifiedProposalAndErrors>>
+      processProposalOnce(const shared_model::interface::Proposal &proposal,
+                          const shared_model::crypto::Hash &top_hash);
+
       // internal
       rxcpp::composite_subscription notifier_lifetime_;
       rxcpp::subjects::subject<VerifiedProposalCreatorEvent> notifier_;
@@ -68,6 +89,13 @@ namespace iroha {
           block_factory_;
 
       logger::LoggerPtr log_;
+
+      /// last processed proposal, accessed by the proposal subscription only
+      boost::optional<Validation> last_validation_;
+
+      metrics::Histogram &validation_time_metric_;
+      metrics::Counter &reused_validation_metric_;
+      metrics::Histogram &block_creation_time_metric_;
     };
   }  // namespace simulator
 }  // namespace iroha
@@ -0,0 +1,82 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CHAIN_FOLLOWER_HPP
+#define IROHA_CHAIN_FOLLOWER_HPP
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "ametsuchi/block_query_factory.hpp"
+#include "ametsuchi/mutable_factory.hpp"
+#include "ametsuchi/peer_query_factory.hpp"
+#include "logger/logger_fwd.hpp"
+#include "network/block_loader.hpp"
+#include "validation/chain_validator.hpp"
+
+namespace iroha {
+  namespace synchronizer {
+
+    /**
+     * Keeps the storage of an observer peer, which takes no part in ordering
+     * and consensus, up to date with the ledger. Blocks above the top block
+     * are periodically loaded from a ledger peer, and they are committed once
+     * the chain validator checks their signatures by the ledger peers
+     */
+    class ChainFollower {
+     public:
+      /**
+       * @param period - time between loading the blocks from ledger peers
+       * @param blocks_per_commit - loaded blocks are committed in ranges of
+       * this size
+       */
+      ChainFollower(
+          std::shared_ptr<validation::ChainValidator> validator,
+          std::shared_ptr<ametsuchi::MutableFactory> mutable_factory,
+          std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
+          std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
+          std::shared_ptr<network::BlockLoader> block_loader,
+          std::chrono::milliseconds period,
+          logger::LoggerPtr log,
+          size_t blocks_per_commit);
+
+      ~ChainFollower();
+
+      /// Load the blocks in background every period
+      void start();
+
+      /**
+       * Load the blocks above the top block from a ledger peer and commit
+       * them. Ledger peers are asked in turns, the next one is asked if a peer
+       * fails to provide valid blocks
+       * @return number of committed blocks
+       */
+      size_t follow();
+
+     private:
+      std::shared_ptr<validation::ChainValidator> validator_;
+      std::shared_ptr<ametsuchi::MutableFactory> mutable_factory_;
+      std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory_;
+      std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory_;
+      std::shared_ptr<network::BlockLoader> block_loader_;
+      const std::chrono::milliseconds period_;
+      logger::LoggerPtr log_;
+      const size_t blocks_per_commit_;
+
+      /// index of the ledger peer asked first next time
+      size_t next_peer_ = 0;
+
+      bool stop_ = false;
+      std::mutex mutex_;
+      std::condition_variable cv_;
+      std::thread thread_;
+    };
+
+  }  // namespace synchronizer
+}  // namespace iroha
+
+#endif  // IROHA_CHAIN_FOLLOWER_HPP
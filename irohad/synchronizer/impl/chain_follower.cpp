@@ -0,0 +1,142 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "synchronizer/chain_follower.hpp"
+
+#include <algorithm>
+
+#include "ametsuchi/block_query.hpp"
+#include "ametsuchi/mutable_storage.hpp"
+#include "ametsuchi/peer_query.hpp"
+#include "interfaces/common_objects/peer.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "logger/logger.hpp"
+
+namespace iroha {
+  namespace synchronizer {
+
+    ChainFollower::ChainFollower(
+        std::shared_ptr<validation::ChainValidator> validator,
+        std::shared_ptr<ametsuchi::MutableFactory> mutable_factory,
+        std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
+        std::shared_ptr<ametsuchi::PeerQueryFactory> peer_query_factory,
+        std::shared_ptr<network::BlockLoader> block_loader,
+        std::chrono::milliseconds period,
+        logger::LoggerPtr log,
+        size_t blocks_per_commit)
+        : validator_(std::move(validator)),
+          mutable_factory_(std::move(mutable_factory)),
+          block_query_factory_(std::move(block_query_factory)),
+          peer_query_factory_(std::move(peer_query_factory)),
+          block_loader_(std::move(block_loader)),
+          period_(period),
+          log_(std::move(log)),
+          blocks_per_commit_(std::max<size_t>(blocks_per_commit, 1)) {}
+
+    ChainFollower::~ChainFollower() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+      }
+      cv_.notify_one();
+      if (thread_.joinable()) {
+        thread_.join();
+      }
+    }
+
+    void ChainFollower::start() {
+      thread_ = std::thread([this] {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (not stop_) {
+          lock.unlock();
+          // the next blocks are requested at once while they keep coming
+          auto committed = follow();
+          lock.lock();
+          if (committed == 0) {
+            cv_.wait_for(lock, period_, [this] { return stop_; });
+          }
+        }
+      });
+    }
+
+    size_t ChainFollower::follow() {
+      auto block_query = block_query_factory_->createBlockQuery();
+      auto peer_query = peer_query_factory_->createPeerQuery();
+      if (not block_query or not peer_query) {
+        log_->error("Failed to create block or peer query");
+        return 0;
+      }
+      auto peers = (*peer_query)->getLedgerPeers();
+      if (not peers or peers->empty()) {
+        log_->error("Failed to get ledger peers");
+        return 0;
+      }
+      auto top_height = (*block_query)->getTopBlockHeight();
+
+      auto storage_result = mutable_factory_->createMutableStorage();
+      if (auto e = boost::get<expected::Error<std::string>>(&storage_result)) {
+        log_->error("Failed to create mutable storage: {}", e->error);
+        return 0;
+      }
+      auto storage = std::move(
+          boost::get<expected::ValueOf<decltype(storage_result)>>(
+              storage_result)
+              .value);
+
+      auto height = top_height;
+      boost::optional<std::string> commit_error;
+      for (size_t attempt = 0; attempt < peers->size(); ++attempt) {
+        const auto &peer = *peers->at(next_peer_++ % peers->size());
+        bool applied = true;
+        block_loader_->retrieveBlocks(height, peer.pubkey())
+            .take_while([&applied](const auto &) { return applied; })
+            .buffer(blocks_per_commit_)
+            .as_blocking()
+            .subscribe(
+                [&](const std::vector<
+                    std::shared_ptr<shared_model::interface::Block>> &blocks) {
+                  if (not applied) {
+                    return;
+                  }
+                  applied = validator_->validateAndApply(
+                      rxcpp::observable<>::iterate(blocks), *storage);
+                  if (not applied) {
+                    return;
+                  }
+                  // committed blocks are not loaded again from the next peer
+                  // if the next ones fail
+                  commit_error = expected::resultToOptionalError(
+                      mutable_factory_->commitIntermediate(*storage));
+                  if (commit_error) {
+                    applied = false;
+                    return;
+                  }
+                  height = blocks.back()->height();
+                },
+                [&](std::exception_ptr) { applied = false; });
+        if (commit_error) {
+          log_->error("Failed to commit blocks: {}", *commit_error);
+          return 0;
+        }
+        if (applied) {
+          break;
+        }
+        log_->warn("Failed to load blocks above {} from {}", height, peer);
+      }
+
+      if (height == top_height) {
+        return 0;
+      }
+      if (auto e = expected::resultToOptionalError(
+              mutable_factory_->commit(std::move(storage)))) {
+        log_->error("Failed to commit blocks: {}", *e);
+        return 0;
+      }
+      log_->info("Committed blocks from {} to {}", top_height + 1, height);
+      return height - top_height;
+    }
+
+  }  // namespace synchronizer
+}  // namespace iroha
@@ -5,6 +5,7 @@
 
 #include "synchronizer/impl/synchronizer_impl.hpp"
 
+#include <algorithm>
 #include <utility>
 
 #include "ametsuchi/block_query_factory.hpp"
@@ -13,21 +14,26 @@
 #include "common/visitor.hpp"
 #include "interfaces/iroha_internal/block.hpp"
 #include "logger/logger.hpp"
+#include "tracing/transaction_tracer.hpp"
 
 namespace iroha {
   namespace synchronizer {
 
+    constexpr size_t SynchronizerImpl::kDefaultBlocksPerCommit;
+
     SynchronizerImpl::SynchronizerImpl(
         std::shared_ptr<network::ConsensusGate> consensus_gate,
         std::shared_ptr<validation::ChainValidator> validator,
         std::shared_ptr<ametsuchi::MutableFactory> mutable_factory,
         std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
         std::shared_ptr<network::BlockLoader> block_loader,
-        logger::LoggerPtr log)
+        logger::LoggerPtr log,
+        size_t blocks_per_commit)
         : validator_(std::move(validator)),
           mutable_factory_(std::move(mutable_factory)),
           block_query_factory_(std::move(block_query_factory)),
           block_loader_(std::move(block_loader)),
+          blocks_per_commit_(std::max<size_t>(blocks_per_commit, 1)),
           notifier_(notifier_lifetime_),
           log_(std::move(log)) {
       consensus_gate->onOutcome().subscribe(
@@ -60,24 +66,65 @@ namespace iroha {
         const shared_model::interface::types::HeightType start_height,
         const shared_model::interface::types::HeightType target_height,
         const PublicKeysRange &public_keys) {
+      std::vector<shared_model::crypto::PublicKey> peer_pubkeys(
+          public_keys.begin(), public_keys.end());
+      // one mutable storage applies all the blocks, a failed range is rolled
+      // back by the storage and the next attempt continues from my_height
+      auto storage = getStorage().value_or(nullptr);
+      if (not storage) {
+        return iroha::expected::makeError("Could not get mutable storage.");
+      }
+      shared_model::interface::types::HeightType my_height = start_height;
       // TODO mboldyrev 21.03.2019 IR-423 Allow consensus outcome update
       while (true) {
         // TODO andrei 17.10.18 IR-1763 Add delay strategy for loading blocks
-        for (const auto &public_key : public_keys) {
-          auto storage = getStorage().value_or(nullptr);
-          if (not storage) {
-            return iroha::expected::makeError("Could not get mutable storage.");
-          }
+        for (size_t attempt = 0; attempt < peer_pubkeys.size(); ++attempt) {
+          // blocks are loaded from all the peers, every attempt prefers the
+          // next one
+          std::rotate(peer_pubkeys.begin(),
+                      std::next(peer_pubkeys.begin(), attempt == 0 ? 0 : 1),
+                      peer_pubkeys.end());
 
-          shared_model::interface::types::HeightType my_height = start_height;
-          auto network_chain =
-              block_loader_->retrieveBlocks(start_height, public_key)
-                  .tap([&my_height](
-                           const std::shared_ptr<shared_model::interface::Block>
-                               &block) { my_height = block->height(); });
+          bool applied = true;
+          boost::optional<std::string> commit_error;
+          block_loader_
+              ->retrieveBlocks(my_height, target_height, peer_pubkeys)
+              .take_while([&applied](const auto &) { return applied; })
+              .buffer(blocks_per_commit_)
+              .as_blocking()
+              .subscribe(
+                  [&](const std::vector<
+                      std::shared_ptr<shared_model::interface::Block>>
+                          &blocks) {
+                    if (not applied) {
+                      return;
+                    }
+                    applied = validator_->validateAndApply(
+                        rxcpp::observable<>::iterate(blocks), *storage);
+                    if (not applied) {
+                      return;
+                    }
+                    // committed blocks are not loaded again if the next
+                    // ones fail
+                    auto result =
+                        mutable_factory_->commitIntermediate(*storage);
+                    if (auto e = boost::get<expected::Error<std::string>>(
+                            &result)) {
+                      commit_error = std::move(e->error);
+                      applied = false;
+                      return;
+                    }
+                    my_height = blocks.back()->height();
+                  },
+                  [&](std::exception_ptr) {
+                    log_->warn("Failed to load blocks above {}", my_height);
+                    applied = false;
+                  });
 
-          if (validator_->validateAndApply(network_chain, *storage)
-              and my_height >= target_height) {
+          if (commit_error) {
+            return iroha::expected::makeError(std::move(*commit_error));
+          }
+          if (applied and my_height >= target_height) {
             return mutable_factory_->commit(std::move(storage));
           }
         }
@@ -101,9 +148,13 @@ namespace iroha {
 
     void SynchronizerImpl::processNext(const consensus::PairValid &msg) {
       log_->info("at handleNext");
+      tracing::tracer().markAll(msg.block->transactions(),
+                                tracing::TransactionStage::kAgreed);
       const auto notify =
           [this,
            &msg](std::shared_ptr<const iroha::LedgerState> &&ledger_state) {
+            tracing::tracer().markAll(msg.block->transactions(),
+                                      tracing::TransactionStage::kCommitted);
             this->notifier_.get_subscriber().on_next(
                 SynchronizationEvent{SynchronizationOutcomeType::kCommit,
                                      msg.round,
@@ -26,13 +26,21 @@ namespace iroha {
 
     class SynchronizerImpl : public Synchronizer {
      public:
+      /// default number of downloaded blocks committed at once
+      static constexpr size_t kDefaultBlocksPerCommit = 100;
+
+      /**
+       * @param blocks_per_commit - downloaded blocks are committed in ranges
+       * of this size while the storage keeps applying the next ones
+       */
       SynchronizerImpl(
           std::shared_ptr<network::ConsensusGate> consensus_gate,
           std::shared_ptr<validation::ChainValidator> validator,
           std::shared_ptr<ametsuchi::MutableFactory> mutable_factory,
           std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory,
           std::shared_ptr<network::BlockLoader> block_loader,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          size_t blocks_per_commit = kDefaultBlocksPerCommit);
 
       ~SynchronizerImpl() override;
 
@@ -77,6 +85,7 @@ namespace iroha {
       std::shared_ptr<ametsuchi::MutableFactory> mutable_factory_;
       std::shared_ptr<ametsuchi::BlockQueryFactory> block_query_factory_;
       std::shared_ptr<network::BlockLoader> block_loader_;
+      const size_t blocks_per_commit_;
 
       // internal
       rxcpp::composite_subscription notifier_lifetime_;
@@ -0,0 +1,94 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef TORII_ADMISSION_CONTROL_HPP
+#define TORII_ADMISSION_CONTROL_HPP
+
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "cache/cache.hpp"
+#include "metrics/metrics.hpp"
+
+namespace iroha {
+  namespace torii {
+
+    /**
+     * Token bucket admission control of transactions received by torii. Every
+     * client address and every creator account has a bucket, which is
+     * refilled at a fixed rate and holds at most one second of it. A
+     * transaction takes a token from the bucket of the client and from the
+     * bucket of its creator. A list is admitted as a whole or refused
+     */
+    class AdmissionControl {
+     public:
+      using Clock = std::chrono::steady_clock;
+
+      /// default maximum number of buckets of each kind kept at once
+      static constexpr uint32_t kDefaultMaxBuckets = 100000;
+
+      /**
+       * @param account_rate - transactions per second a creator account may
+       * send, 0 disables the limit
+       * @param peer_rate - transactions per second a client address may send,
+       * 0 disables the limit
+       * @param max_buckets - least recently used buckets above this number
+       * are dropped, which is the same as refilling them
+       * @param now - source of time
+       */
+      AdmissionControl(double account_rate,
+                       double peer_rate,
+                       uint32_t max_buckets = kDefaultMaxBuckets,
+                       std::function<Clock::time_point()> now = Clock::now);
+
+      /**
+       * Take the tokens of the transactions if all the buckets have enough
+       * @param peer - address of the client
+       * @param creators - creator account of every transaction of the list
+       * @return true if the transactions are admitted
+       */
+      bool admit(const std::string &peer,
+                 const std::vector<std::string> &creators);
+
+     private:
+      struct Bucket {
+        double tokens;
+        Clock::time_point updated;
+      };
+
+      using Buckets = iroha::cache::LruCache<std::string, Bucket>;
+
+      /// @return bucket of the key refilled up to the given time
+      static Bucket refilled(const Buckets &buckets,
+                             const std::string &key,
+                             double rate,
+                             Clock::time_point now);
+
+      const double account_rate_;
+      const double peer_rate_;
+      std::function<Clock::time_point()> now_;
+
+      std::mutex mutex_;
+      Buckets account_buckets_;
+      Buckets peer_buckets_;
+
+      metrics::Counter &rejected_by_account_;
+      metrics::Counter &rejected_by_peer_;
+    };
+
+    /**
+     * @param peer - address of a gRPC client, such as ipv4:127.0.0.1:50051
+     * @return the address without the port, so that connections of a client
+     * share the bucket
+     */
+    std::string clientHost(const std::string &peer);
+
+  }  // namespace torii
+}  // namespace iroha
+
+#endif  // TORII_ADMISSION_CONTROL_HPP
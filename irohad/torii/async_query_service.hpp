@@ -0,0 +1,71 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef TORII_ASYNC_QUERY_SERVICE_HPP
+#define TORII_ASYNC_QUERY_SERVICE_HPP
+
+#include "endpoint.grpc.pb.h"
+#include "endpoint.pb.h"
+
+#include <grpc++/grpc++.h>
+#include "logger/logger_fwd.hpp"
+#include "torii/block_broadcast.hpp"
+#include "torii/query_service.hpp"
+
+namespace iroha {
+  namespace torii {
+
+    /**
+     * Query service serving Find calls asynchronously, so that a gRPC thread
+     * is not held while a query is executed. FetchCommits calls are served
+     * asynchronously as well and write blocks serialized once by the block
+     * broadcast, without holding a thread per subscriber. Calls are requested
+     * and completed on a completion queue of the server, FindStream and query
+     * jobs are served synchronously by the wrapped service
+     */
+    class AsyncQueryService
+        : public iroha::protocol::QueryService_v1::WithAsyncMethod_Find<
+              iroha::protocol::QueryService_v1::WithRawMethod_FetchCommits<
+                  iroha::protocol::QueryService_v1::Service>> {
+     public:
+      AsyncQueryService(std::shared_ptr<QueryService> query_service,
+                        std::shared_ptr<BlockBroadcast> block_broadcast,
+                        logger::LoggerPtr log);
+
+      /**
+       * Serve Find and FetchCommits calls on the queue until it is shut down
+       * @param queue - completion queue of the server
+       */
+      void serve(grpc::ServerCompletionQueue &queue);
+
+      grpc::Status FindStream(
+          grpc::ServerContext *context,
+          const iroha::protocol::Query *request,
+          grpc::ServerWriter<iroha::protocol::QueryResponse> *writer) override;
+
+      grpc::Status SubmitQueryJob(
+          grpc::ServerContext *context,
+          const iroha::protocol::Query *request,
+          iroha::protocol::QueryJobResponse *response) override;
+
+      grpc::Status FetchQueryJob(
+          grpc::ServerContext *context,
+          const iroha::protocol::QueryJobRequest *request,
+          iroha::protocol::QueryJobResponse *response) override;
+
+     private:
+      class Call;
+      class FindCall;
+      class FetchCommitsCall;
+
+      std::shared_ptr<QueryService> query_service_;
+      std::shared_ptr<BlockBroadcast> block_broadcast_;
+      logger::LoggerPtr log_;
+    };
+
+  }  // namespace torii
+}  // namespace iroha
+
+#endif  // TORII_ASYNC_QUERY_SERVICE_HPP
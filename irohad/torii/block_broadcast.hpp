@@ -0,0 +1,84 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef TORII_BLOCK_BROADCAST_HPP
+#define TORII_BLOCK_BROADCAST_HPP
+
+#include <grpc++/support/byte_buffer.h>
+#include <rxcpp/rx.hpp>
+#include "common/broadcast_hub.hpp"
+#include "interfaces/iroha_internal/query_response_factory.hpp"
+#include "logger/logger_fwd.hpp"
+#include "metrics/metrics.hpp"
+
+namespace shared_model {
+  namespace interface {
+    class Block;
+  }
+}  // namespace shared_model
+
+namespace iroha {
+  namespace torii {
+
+    /**
+     * Broadcast of committed blocks to FetchCommits subscribers. Every block
+     * is converted to BlockQueryResponse and serialized once, and all the
+     * subscribers write the same bytes
+     */
+    class BlockBroadcast {
+     public:
+      /// block query response serialized for the subscribers
+      struct SerializedBlock {
+        shared_model::interface::types::HeightType height;
+        grpc::ByteBuffer bytes;
+        /// the response itself, for subscribers which filter transactions
+        std::shared_ptr<const shared_model::interface::BlockQueryResponse>
+            response;
+      };
+
+      using Hub = BroadcastHub<SerializedBlock>;
+
+      /// default number of blocks a subscriber may lag behind before it is
+      /// evicted
+      static constexpr size_t kDefaultBufferSize = 16;
+
+      /**
+       * @param commits - committed blocks
+       * @param response_factory - creates block query responses
+       * @param log - logger
+       * @param buffer_size - blocks a subscriber may lag behind
+       */
+      BlockBroadcast(
+          rxcpp::observable<
+              std::shared_ptr<const shared_model::interface::Block>> commits,
+          std::shared_ptr<shared_model::interface::QueryResponseFactory>
+              response_factory,
+          logger::LoggerPtr log,
+          size_t buffer_size = kDefaultBufferSize);
+
+      ~BlockBroadcast();
+
+      /**
+       * Subscribe to the blocks committed after the call
+       * @param notify - wakes the subscriber, see Hub::Subscriber::pop
+       */
+      std::shared_ptr<Hub::Subscriber> subscribe(Hub::Notify notify);
+
+     private:
+      void publish(std::shared_ptr<const shared_model::interface::Block> block);
+
+      std::shared_ptr<shared_model::interface::QueryResponseFactory>
+          response_factory_;
+      logger::LoggerPtr log_;
+      Hub hub_;
+      rxcpp::composite_subscription subscription_;
+
+      metrics::Counter &evicted_metric_;
+    };
+
+  }  // namespace torii
+}  // namespace iroha
+
+#endif  // TORII_BLOCK_BROADCAST_HPP
@@ -0,0 +1,54 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef TORII_BLOCK_FILTER_HPP
+#define TORII_BLOCK_FILTER_HPP
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <boost/optional.hpp>
+#include "qry_responses.pb.h"
+#include "queries.pb.h"
+
+namespace iroha {
+  namespace torii {
+
+    /**
+     * Filter of transactions streamed by FetchCommits, see BlocksFilter in
+     * queries.proto
+     */
+    class BlockFilter {
+     public:
+      explicit BlockFilter(const iroha::protocol::BlocksFilter &filter);
+
+      /// @return true if every transaction matches the filter
+      bool empty() const;
+
+      /// @return accounts of the filter, transactions of which are indexed
+      const std::vector<std::string> &accountIds() const;
+
+      /**
+       * @param block - committed block
+       * @return response with transactions of the block which match the
+       * filter, none if there are no such transactions
+       */
+      boost::optional<iroha::protocol::BlockQueryResponse> apply(
+          const iroha::protocol::Block &block) const;
+
+     private:
+      bool matches(const iroha::protocol::Transaction &tx) const;
+
+      std::vector<std::string> account_ids_;
+      std::unordered_set<std::string> accounts_;
+      std::unordered_set<std::string> assets_;
+      std::unordered_set<std::string> command_types_;
+    };
+
+  }  // namespace torii
+}  // namespace iroha
+
+#endif  // TORII_BLOCK_FILTER_HPP
@@ -8,6 +8,7 @@
 
 #include <endpoint.grpc.pb.h>
 #include <grpc++/grpc++.h>
+#include <functional>
 #include <memory>
 #include <thread>
 
@@ -46,6 +47,14 @@ namespace torii {
     grpc::Status Status(const iroha::protocol::TxStatusRequest &tx,
                         iroha::protocol::ToriiResponse &response) const;
 
+    /**
+     * @param txs - hashes of transactions
+     * @param response returns statuses of the transactions if succeeded
+     * @return grpc::Status - returns connection is success or not.
+     */
+    grpc::Status Statuses(const iroha::protocol::TxStatusesRequest &txs,
+                          iroha::protocol::TxStatusesResponse &response) const;
+
     /**
      * Acquires stream of transaction statuses from the request
      * moment until final.
@@ -56,6 +65,29 @@ namespace torii {
         const iroha::protocol::TxStatusRequest &tx,
         std::vector<iroha::protocol::ToriiResponse> &response) const;
 
+    /**
+     * Acquires stream of statuses of several transactions from the request
+     * moment until all of them are final.
+     * @param txs - hashes of transactions.
+     * @param response - vector of all statuses of the transactions in order
+     * of arrival.
+     */
+    void StatusesStream(
+        const iroha::protocol::TxStatusesRequest &txs,
+        std::vector<iroha::protocol::ToriiResponse> &response) const;
+
+    /**
+     * Acquires stream of statuses of several transactions from the request
+     * moment until all of them are final.
+     * @param txs - hashes of transactions.
+     * @param on_status - called with every status as soon as it arrives.
+     * @return grpc::Status - returns whether the stream finished normally.
+     */
+    grpc::Status StatusesStream(
+        const iroha::protocol::TxStatusesRequest &txs,
+        const std::function<void(const iroha::protocol::ToriiResponse &)>
+            &on_status) const;
+
    private:
     std::unique_ptr<iroha::protocol::CommandService_v1::StubInterface> stub_;
     logger::LoggerPtr log_;
@@ -7,6 +7,7 @@
 #define TORII_COMMAND_SERVICE_HPP
 
 #include <rxcpp/rx.hpp>
+#include "interfaces/common_objects/transaction_sequence_common.hpp"
 #include "interfaces/common_objects/types.hpp"
 
 namespace shared_model {
@@ -34,6 +35,18 @@ namespace iroha {
       virtual void handleTransactionBatch(
           std::shared_ptr<shared_model::interface::TransactionBatch> batch) = 0;
 
+      /**
+       * Handle several batches received at once, such as the batches of a
+       * single transactions list
+       * @param batches - batches we've received
+       */
+      virtual void handleTransactionBatches(
+          shared_model::interface::types::BatchesCollectionType batches) {
+        for (auto &batch : batches) {
+          handleTransactionBatch(std::move(batch));
+        }
+      }
+
       /**
        * Request to retrieve a status of any particular transaction
        * @param request - TxStatusRequest object which identifies transaction
@@ -44,6 +57,17 @@ namespace iroha {
       virtual std::shared_ptr<shared_model::interface::TransactionResponse>
       getStatus(const shared_model::crypto::Hash &request) = 0;
 
+      /**
+       * Request to retrieve statuses of several transactions. Statuses which
+       * are not cached are looked up in the ledger at once
+       * @param hashes - hashes of the transactions
+       * @return responses which contain current states of requested
+       * transactions, in the order of hashes
+       */
+      virtual std::vector<
+          std::shared_ptr<shared_model::interface::TransactionResponse>>
+      getStatuses(const std::vector<shared_model::crypto::Hash> &hashes) = 0;
+
       /**
        * Streaming call which will repeatedly send all statuses of requested
        * transaction from its status at the moment of receiving this request to
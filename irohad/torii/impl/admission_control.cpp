@@ -0,0 +1,110 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/admission_control.hpp"
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace iroha {
+  namespace torii {
+
+    constexpr uint32_t AdmissionControl::kDefaultMaxBuckets;
+
+    AdmissionControl::AdmissionControl(double account_rate,
+                                       double peer_rate,
+                                       uint32_t max_buckets,
+                                       std::function<Clock::time_point()> now)
+        : account_rate_(account_rate),
+          peer_rate_(peer_rate),
+          now_(std::move(now)),
+          account_buckets_(max_buckets, max_buckets * 3 / 4),
+          peer_buckets_(max_buckets, max_buckets * 3 / 4),
+          rejected_by_account_(metrics::registry().counter(
+              "iroha_torii_rejected_by_account_total",
+              "Transactions refused by the rate limit of creator accounts")),
+          rejected_by_peer_(metrics::registry().counter(
+              "iroha_torii_rejected_by_peer_total",
+              "Transactions refused by the rate limit of client addresses")) {
+    }
+
+    AdmissionControl::Bucket AdmissionControl::refilled(
+        const Buckets &buckets,
+        const std::string &key,
+        double rate,
+        Clock::time_point now) {
+      // a bucket holds one second of the rate, at least one token
+      const auto capacity = std::max(rate, 1.);
+      auto bucket = buckets.findItem(key);
+      if (not bucket) {
+        return Bucket{capacity, now};
+      }
+      const std::chrono::duration<double> elapsed = now - bucket->updated;
+      return Bucket{
+          std::min(capacity, bucket->tokens + rate * elapsed.count()), now};
+    }
+
+    bool AdmissionControl::admit(const std::string &peer,
+                                 const std::vector<std::string> &creators) {
+      const auto now = now_();
+      const double count = creators.size();
+
+      std::unordered_map<std::string, double> demand;
+      if (account_rate_ > 0) {
+        for (const auto &creator : creators) {
+          ++demand[creator];
+        }
+      }
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      Bucket peer_bucket{};
+      if (peer_rate_ > 0) {
+        peer_bucket = refilled(peer_buckets_, peer, peer_rate_, now);
+        if (peer_bucket.tokens < count) {
+          peer_buckets_.addItem(peer, peer_bucket);
+          rejected_by_peer_.increment(creators.size());
+          return false;
+        }
+      }
+
+      std::vector<std::pair<const std::string *, Bucket>> account_buckets;
+      account_buckets.reserve(demand.size());
+      for (const auto &account : demand) {
+        auto bucket =
+            refilled(account_buckets_, account.first, account_rate_, now);
+        if (bucket.tokens < account.second) {
+          account_buckets_.addItem(account.first, bucket);
+          rejected_by_account_.increment(creators.size());
+          return false;
+        }
+        bucket.tokens -= account.second;
+        account_buckets.emplace_back(&account.first, bucket);
+      }
+
+      // every bucket has enough tokens, they are taken at once
+      if (peer_rate_ > 0) {
+        peer_bucket.tokens -= count;
+        peer_buckets_.addItem(peer, peer_bucket);
+      }
+      for (const auto &account : account_buckets) {
+        account_buckets_.addItem(*account.first, account.second);
+      }
+      return true;
+    }
+
+    std::string clientHost(const std::string &peer) {
+      auto port = peer.rfind(':');
+      auto bracket = peer.rfind(']');
+      // ipv6 addresses contain colons, the port follows the bracket
+      if (port == std::string::npos
+          or (bracket != std::string::npos and port < bracket)
+          or port == peer.find(':')) {
+        return peer;
+      }
+      return peer.substr(0, port);
+    }
+
+  }  // namespace torii
+}  // namespace iroha
@@ -0,0 +1,356 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/async_query_service.hpp"
+
+#include <grpc++/alarm.h>
+#include <grpc++/impl/codegen/proto_utils.h>
+#include "backend/protobuf/query_responses/proto_block_query_response.hpp"
+#include "logger/logger.hpp"
+
+namespace iroha {
+  namespace torii {
+
+    namespace {
+      grpc::ByteBuffer serialize(
+          const iroha::protocol::BlockQueryResponse &response) {
+        grpc::ByteBuffer buffer;
+        bool own_buffer;
+        grpc::SerializationTraits<iroha::protocol::BlockQueryResponse>::
+            Serialize(response, &buffer, &own_buffer);
+        return buffer;
+      }
+    }  // namespace
+
+    /// tag of events on the queue
+    class AsyncQueryService::Call {
+     public:
+      virtual ~Call() = default;
+
+      /**
+       * Handle the event
+       * @param ok - false if the queue is shutting down or the operation
+       * failed
+       */
+      virtual void proceed(bool ok) = 0;
+
+     protected:
+      void *tag() {
+        return this;
+      }
+    };
+
+    /**
+     * State of a single Find call, it is the tag of its events on the queue.
+     * A call is requested, then the query is executed and the response is
+     * sent, then the call is deleted
+     */
+    class AsyncQueryService::FindCall : public Call {
+     public:
+      FindCall(AsyncQueryService &service, grpc::ServerCompletionQueue &queue)
+          : service_(service), queue_(queue), responder_(&context_) {
+        service_.RequestFind(
+            &context_, &request_, &responder_, &queue_, &queue_, tag());
+      }
+
+      void proceed(bool ok) override {
+        if (state_ == State::kFinishing or not ok) {
+          delete this;
+          return;
+        }
+
+        // the next call is accepted while this one is executed
+        new FindCall(service_, queue_);
+        state_ = State::kFinishing;
+        service_.query_service_->FindAsync(
+            request_,
+            [this](grpc::Status status,
+                   const iroha::protocol::QueryResponse &response) {
+              responder_.Finish(response, status, tag());
+            });
+      }
+
+     private:
+      enum class State { kRequested, kFinishing };
+
+      AsyncQueryService &service_;
+      grpc::ServerCompletionQueue &queue_;
+      grpc::ServerContext context_;
+      iroha::protocol::Query request_;
+      grpc::ServerAsyncResponseWriter<iroha::protocol::QueryResponse>
+          responder_;
+      State state_{State::kRequested};
+    };
+
+    /**
+     * State of a single FetchCommits call, it is the tag of its operations on
+     * the queue. The call writes one block at a time, and waits for an alarm
+     * set by the block broadcast when there is no block to write. gRPC
+     * reports separately that the call is done or cancelled, the call is
+     * deleted once both the chain of its operations has ended and it is done
+     */
+    class AsyncQueryService::FetchCommitsCall : public Call {
+     public:
+      FetchCommitsCall(AsyncQueryService &service,
+                       grpc::ServerCompletionQueue &queue)
+          : service_(service),
+            queue_(queue),
+            writer_(&context_),
+            done_event_(*this) {
+        context_.AsyncNotifyWhenDone(done_event_.tag());
+        service_.RequestFetchCommits(
+            &context_, &request_, &writer_, &queue_, &queue_, tag());
+      }
+
+      void proceed(bool ok) override {
+        switch (state_) {
+          case State::kRequested:
+            // the done event is not delivered for a call which never started
+            if (not ok) {
+              delete this;
+              return;
+            }
+            // the next call is accepted while this one is served
+            new FetchCommitsCall(service_, queue_);
+            start();
+            return;
+          case State::kWriting:
+          case State::kWaiting:
+            if (not ok) {
+              end();
+              return;
+            }
+            next();
+            return;
+          default:
+            end();
+            return;
+        }
+      }
+
+     private:
+      enum class State { kRequested, kWriting, kWaiting, kFinishing, kEnded };
+
+      class DoneEvent : public Call {
+       public:
+        explicit DoneEvent(FetchCommitsCall &call) : call_(call) {}
+
+        void proceed(bool) override {
+          call_.done();
+        }
+
+        using Call::tag;
+
+       private:
+        FetchCommitsCall &call_;
+      };
+
+      void start() {
+        iroha::protocol::BlocksQuery request;
+        auto status = grpc::SerializationTraits<
+            iroha::protocol::BlocksQuery>::Deserialize(&request_, &request);
+        if (not status.ok()) {
+          finish(status);
+          return;
+        }
+        if (auto error = service_.query_service_->checkBlocksQuery(request)) {
+          state_ = State::kFinishing;
+          writer_.WriteAndFinish(serialize(*error),
+                                 grpc::WriteOptions(),
+                                 grpc::Status::OK,
+                                 tag());
+          return;
+        }
+
+        filter_.emplace(request.filter());
+        service_.log_->debug("{} subscribed to blocks from {}",
+                             request.meta().creator_account_id(),
+                             context_.peer());
+        if (request.opt_start_height_case()
+            == iroha::protocol::BlocksQuery::kStartHeight) {
+          next_height_ = request.start_height();
+          replaying_ = true;
+        } else {
+          subscribe();
+        }
+        next();
+      }
+
+      void subscribe() {
+        // the call waits for nothing else while the notification is armed
+        subscriber_ = service_.block_broadcast_->subscribe([this] {
+          alarm_.Set(&queue_, gpr_now(GPR_CLOCK_MONOTONIC), tag());
+        });
+      }
+
+      /**
+       * Write the next committed block from the block store. The call
+       * subscribes to new blocks once there is none, and writes the blocks
+       * committed meanwhile before switching to new ones
+       * @return true if a block is written
+       */
+      bool replay() {
+        if (auto response = service_.query_service_->nextCommittedBlock(
+                next_height_, *filter_)) {
+          state_ = State::kWriting;
+          writer_.Write(serialize(*response), tag());
+          return true;
+        }
+        if (not subscriber_) {
+          subscribe();
+          return replay();
+        }
+        replaying_ = false;
+        return false;
+      }
+
+      /// write the next block, or wait for it
+      void next() {
+        if (done_) {
+          end();
+          return;
+        }
+        if (replaying_ and replay()) {
+          return;
+        }
+        BlockBroadcast::Hub::MessagePtr block;
+        boost::optional<iroha::protocol::BlockQueryResponse> filtered;
+        auto status = subscriber_->pop(block);
+        // new blocks below the height have been replayed, and blocks without
+        // matching transactions are skipped
+        while (status == BlockBroadcast::Hub::Subscriber::Status::kMessage
+               and (block->height < next_height_
+                    or (not filter_->empty()
+                        and not (filtered = filter(*block))))) {
+          status = subscriber_->pop(block);
+        }
+        switch (status) {
+          case BlockBroadcast::Hub::Subscriber::Status::kMessage:
+            state_ = State::kWriting;
+            if (filter_->empty()) {
+              writer_.Write(block->bytes, tag());
+            } else {
+              writer_.Write(serialize(*filtered), tag());
+            }
+            return;
+          case BlockBroadcast::Hub::Subscriber::Status::kEmpty:
+            state_ = State::kWaiting;
+            return;
+          case BlockBroadcast::Hub::Subscriber::Status::kEvicted:
+            service_.log_->warn("{} does not read blocks in time",
+                                context_.peer());
+            finish(grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                                "Blocks are not read in time"));
+            return;
+          case BlockBroadcast::Hub::Subscriber::Status::kClosed:
+            finish(grpc::Status::OK);
+            return;
+        }
+      }
+
+      /**
+       * @return response with matching transactions of the new block, none
+       * if the block has no such transactions
+       */
+      boost::optional<iroha::protocol::BlockQueryResponse> filter(
+          const BlockBroadcast::SerializedBlock &block) const {
+        const auto &transport =
+            static_cast<const shared_model::proto::BlockQueryResponse &>(
+                *block.response)
+                .getTransport();
+        if (not transport.has_block_response()) {
+          return transport;
+        }
+        return filter_->apply(transport.block_response().block());
+      }
+
+      void finish(const grpc::Status &status) {
+        state_ = State::kFinishing;
+        writer_.Finish(status, tag());
+      }
+
+      /// no operation of the call is on the queue anymore
+      void end() {
+        state_ = State::kEnded;
+        if (subscriber_) {
+          subscriber_->cancel();
+        }
+        if (done_) {
+          delete this;
+        }
+      }
+
+      void done() {
+        done_ = true;
+        if (state_ == State::kEnded) {
+          delete this;
+        } else if (state_ == State::kWaiting and subscriber_->cancel()) {
+          // the alarm is not set and will not be
+          delete this;
+        }
+        // otherwise the call ends with its pending operation
+      }
+
+      AsyncQueryService &service_;
+      grpc::ServerCompletionQueue &queue_;
+      grpc::ServerContext context_;
+      grpc::ByteBuffer request_;
+      grpc::ServerAsyncWriter<grpc::ByteBuffer> writer_;
+      DoneEvent done_event_;
+      grpc::Alarm alarm_;
+      std::shared_ptr<BlockBroadcast::Hub::Subscriber> subscriber_;
+      State state_{State::kRequested};
+      bool done_{false};
+
+      /// transactions to write, set once the request is parsed
+      boost::optional<BlockFilter> filter_;
+
+      /// committed blocks are written from the block store
+      bool replaying_{false};
+      shared_model::interface::types::HeightType next_height_{0};
+    };
+
+    AsyncQueryService::AsyncQueryService(
+        std::shared_ptr<QueryService> query_service,
+        std::shared_ptr<BlockBroadcast> block_broadcast,
+        logger::LoggerPtr log)
+        : query_service_(std::move(query_service)),
+          block_broadcast_(std::move(block_broadcast)),
+          log_(std::move(log)) {}
+
+    void AsyncQueryService::serve(grpc::ServerCompletionQueue &queue) {
+      new FindCall(*this, queue);
+      new FetchCommitsCall(*this, queue);
+      void *tag;
+      bool ok;
+      while (queue.Next(&tag, &ok)) {
+        static_cast<Call *>(tag)->proceed(ok);
+      }
+      log_->debug("Queries are not served anymore");
+    }
+
+    grpc::Status AsyncQueryService::FindStream(
+        grpc::ServerContext *context,
+        const iroha::protocol::Query *request,
+        grpc::ServerWriter<iroha::protocol::QueryResponse> *writer) {
+      return query_service_->FindStream(context, request, writer);
+    }
+
+    grpc::Status AsyncQueryService::SubmitQueryJob(
+        grpc::ServerContext *context,
+        const iroha::protocol::Query *request,
+        iroha::protocol::QueryJobResponse *response) {
+      return query_service_->SubmitQueryJob(context, request, response);
+    }
+
+    grpc::Status AsyncQueryService::FetchQueryJob(
+        grpc::ServerContext *context,
+        const iroha::protocol::QueryJobRequest *request,
+        iroha::protocol::QueryJobResponse *response) {
+      return query_service_->FetchQueryJob(context, request, response);
+    }
+
+  }  // namespace torii
+}  // namespace iroha
@@ -0,0 +1,79 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/block_broadcast.hpp"
+
+#include <grpc++/impl/codegen/proto_utils.h>
+#include "backend/protobuf/query_responses/proto_block_query_response.hpp"
+#include "interfaces/iroha_internal/block.hpp"
+#include "logger/logger.hpp"
+
+namespace iroha {
+  namespace torii {
+
+    constexpr size_t BlockBroadcast::kDefaultBufferSize;
+
+    BlockBroadcast::BlockBroadcast(
+        rxcpp::observable<std::shared_ptr<const shared_model::interface::Block>>
+            commits,
+        std::shared_ptr<shared_model::interface::QueryResponseFactory>
+            response_factory,
+        logger::LoggerPtr log,
+        size_t buffer_size)
+        : response_factory_(std::move(response_factory)),
+          log_(std::move(log)),
+          hub_(buffer_size),
+          evicted_metric_(metrics::registry().counter(
+              "iroha_torii_block_subscribers_evicted_total",
+              "FetchCommits subscribers dropped for lagging behind")) {
+      commits.subscribe(subscription_, [this](auto block) {
+        this->publish(std::move(block));
+      });
+    }
+
+    BlockBroadcast::~BlockBroadcast() {
+      subscription_.unsubscribe();
+      hub_.close();
+    }
+
+    std::shared_ptr<BlockBroadcast::Hub::Subscriber> BlockBroadcast::subscribe(
+        Hub::Notify notify) {
+      return hub_.subscribe(std::move(notify));
+    }
+
+    void BlockBroadcast::publish(
+        std::shared_ptr<const shared_model::interface::Block> block) {
+      if (hub_.empty()) {
+        return;
+      }
+      auto response = response_factory_->createBlockQueryResponse(block);
+      const auto &transport =
+          static_cast<const shared_model::proto::BlockQueryResponse &>(
+              *response)
+              .getTransport();
+
+      auto message = std::make_shared<SerializedBlock>();
+      message->height = block->height();
+      message->response = response;
+      bool own_buffer;
+      auto status =
+          grpc::SerializationTraits<iroha::protocol::BlockQueryResponse>::
+              Serialize(transport, &message->bytes, &own_buffer);
+      if (not status.ok()) {
+        log_->error("Failed to serialize block {}: {}",
+                    block->height(),
+                    status.error_message());
+        return;
+      }
+
+      if (auto evicted = hub_.publish(std::move(message))) {
+        log_->warn("{} block subscribers are evicted for lagging behind",
+                   evicted);
+        evicted_metric_.increment(evicted);
+      }
+    }
+
+  }  // namespace torii
+}  // namespace iroha
@@ -0,0 +1,99 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/block_filter.hpp"
+
+#include <algorithm>
+
+namespace iroha {
+  namespace torii {
+
+    namespace {
+      /// @return asset the command adds, subtracts or transfers, if any
+      const std::string *assetOf(const iroha::protocol::Command &command) {
+        switch (command.command_case()) {
+          case iroha::protocol::Command::kAddAssetQuantity:
+            return &command.add_asset_quantity().asset_id();
+          case iroha::protocol::Command::kSubtractAssetQuantity:
+            return &command.subtract_asset_quantity().asset_id();
+          case iroha::protocol::Command::kTransferAsset:
+            return &command.transfer_asset().asset_id();
+          default:
+            return nullptr;
+        }
+      }
+    }  // namespace
+
+    BlockFilter::BlockFilter(const iroha::protocol::BlocksFilter &filter)
+        : account_ids_(filter.account_ids().begin(),
+                       filter.account_ids().end()),
+          accounts_(filter.account_ids().begin(), filter.account_ids().end()),
+          assets_(filter.asset_ids().begin(), filter.asset_ids().end()),
+          command_types_(filter.command_types().begin(),
+                         filter.command_types().end()) {}
+
+    bool BlockFilter::empty() const {
+      return accounts_.empty() and assets_.empty() and command_types_.empty();
+    }
+
+    const std::vector<std::string> &BlockFilter::accountIds() const {
+      return account_ids_;
+    }
+
+    bool BlockFilter::matches(const iroha::protocol::Transaction &tx) const {
+      const auto &payload = tx.payload().reduced_payload();
+      const auto &commands = payload.commands();
+
+      if (not accounts_.empty()
+          and accounts_.count(payload.creator_account_id()) == 0
+          and std::none_of(
+                  commands.begin(), commands.end(), [this](const auto &cmd) {
+                    return cmd.has_transfer_asset()
+                        and (accounts_.count(
+                                 cmd.transfer_asset().src_account_id())
+                             or accounts_.count(
+                                    cmd.transfer_asset().dest_account_id()));
+                  })) {
+        return false;
+      }
+
+      if (not assets_.empty()
+          and std::none_of(
+                  commands.begin(), commands.end(), [this](const auto &cmd) {
+                    auto asset = assetOf(cmd);
+                    return asset and assets_.count(*asset);
+                  })) {
+        return false;
+      }
+
+      return command_types_.empty()
+          or std::any_of(
+                 commands.begin(), commands.end(), [this](const auto &cmd) {
+                   auto field = cmd.GetDescriptor()->FindFieldByNumber(
+                       cmd.command_case());
+                   return field and command_types_.count(field->name());
+                 });
+    }
+
+    boost::optional<iroha::protocol::BlockQueryResponse> BlockFilter::apply(
+        const iroha::protocol::Block &block) const {
+      const auto &payload = block.block_v1().payload();
+      iroha::protocol::BlockQueryResponse response;
+      auto filtered = response.mutable_filtered_block_response();
+      filtered->set_height(payload.height());
+      for (int i = 0; i < payload.transactions_size(); ++i) {
+        if (matches(payload.transactions(i))) {
+          filtered->add_tx_indices(i);
+          *filtered->add_transactions() = payload.transactions(i);
+        }
+      }
+      if (filtered->transactions_size() == 0) {
+        return boost::none;
+      }
+      return response;
+    }
+
+  }  // namespace torii
+}  // namespace iroha
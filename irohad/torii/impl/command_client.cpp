@@ -42,6 +42,13 @@ namespace torii {
     return stub_->Status(&context, request, &response);
   }
 
+  grpc::Status CommandSyncClient::Statuses(
+      const iroha::protocol::TxStatusesRequest &request,
+      iroha::protocol::TxStatusesResponse &response) const {
+    grpc::ClientContext context;
+    return stub_->Statuses(&context, request, &response);
+  }
+
   void CommandSyncClient::StatusStream(
       const iroha::protocol::TxStatusRequest &tx,
       std::vector<iroha::protocol::ToriiResponse> &response) const {
@@ -57,4 +64,27 @@ namespace torii {
     reader->Finish();
   }
 
+  void CommandSyncClient::StatusesStream(
+      const iroha::protocol::TxStatusesRequest &txs,
+      std::vector<iroha::protocol::ToriiResponse> &response) const {
+    StatusesStream(
+        txs, [&response](const auto &resp) { response.push_back(resp); });
+  }
+
+  grpc::Status CommandSyncClient::StatusesStream(
+      const iroha::protocol::TxStatusesRequest &txs,
+      const std::function<void(const iroha::protocol::ToriiResponse &)>
+          &on_status) const {
+    grpc::ClientContext context;
+    ToriiResponse resp;
+    auto reader = stub_->StatusesStream(&context, txs);
+    while (reader->Read(&resp)) {
+      log_->debug("received new status: {}, hash {}",
+                  resp.tx_status(),
+                  iroha::bytestringToHexstring(resp.tx_hash()));
+      on_status(resp);
+    }
+    return reader->Finish();
+  }
+
 }  // namespace torii
@@ -7,7 +7,6 @@
 
 #include "ametsuchi/block_query.hpp"
 #include "common/byteutils.hpp"
-#include "common/is_any.hpp"
 #include "common/visitor.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "interfaces/transaction.hpp"
@@ -58,7 +57,50 @@ namespace iroha {
 
     void CommandServiceImpl::handleTransactionBatch(
         std::shared_ptr<shared_model::interface::TransactionBatch> batch) {
-      processBatch(batch);
+      if (isCachedReplay(*batch)) {
+        return;
+      }
+      auto presence = tx_presence_cache_->check(*batch);
+      if (not presence) {
+        // TODO andrei 30.11.18 IR-51 Handle database error
+        log_->warn("Check tx presence database error. {}", *batch);
+        return;
+      }
+      processBatch(std::move(batch), *presence);
+    }
+
+    void CommandServiceImpl::handleTransactionBatches(
+        shared_model::interface::types::BatchesCollectionType batches) {
+      shared_model::interface::types::BatchesCollectionType fresh;
+      std::vector<shared_model::crypto::Hash> hashes;
+      for (auto &batch : batches) {
+        if (isCachedReplay(*batch)) {
+          continue;
+        }
+        for (const auto &tx : batch->transactions()) {
+          hashes.push_back(tx->hash());
+        }
+        fresh.push_back(std::move(batch));
+      }
+      if (fresh.empty()) {
+        return;
+      }
+
+      auto presence = tx_presence_cache_->check(hashes);
+      if (not presence or presence->size() != hashes.size()) {
+        // TODO andrei 30.11.18 IR-51 Handle database error
+        log_->warn("Check {} txs presence database error.", hashes.size());
+        return;
+      }
+      auto begin = presence->begin();
+      for (auto &batch : fresh) {
+        auto end = begin + batch->transactions().size();
+        processBatch(
+            std::move(batch),
+            iroha::ametsuchi::TxPresenceCache::BatchStatusCollectionType(begin,
+                                                                         end));
+        begin = end;
+      }
     }
 
     std::shared_ptr<shared_model::interface::TransactionResponse>
@@ -98,30 +140,58 @@ namespace iroha {
           });
     }
 
-    /**
-     * Statuses considered final for streaming. Observable stops value emission
-     * after receiving a value of one of the following types
-     * @tparam T concrete response type
-     *
-     * StatefulFailedTxResponse and MstExpiredResponse were removed from the
-     * list of final statuses.
-     *
-     * StatefulFailedTxResponse is not a final status because the node might be
-     * in non-synchronized state and the transaction may be stateful valid from
-     * the viewpoint of up to date nodes.
-     *
-     * MstExpiredResponse is not a final status in general case because it will
-     * depend on MST expiration timeout. The transaction might expire in MST,
-     * but remain valid in terms of Iroha validation rules. Thus, it may be
-     * resent and committed successfully. As the result the final status may
-     * differ from MstExpiredResponse.
-     */
-    template <typename T>
-    constexpr bool FinalStatusValue =
-        iroha::is_any<std::decay_t<T>,
-                      shared_model::interface::StatelessFailedTxResponse,
-                      shared_model::interface::CommittedTxResponse,
-                      shared_model::interface::RejectedTxResponse>::value;
+    std::vector<std::shared_ptr<shared_model::interface::TransactionResponse>>
+    CommandServiceImpl::getStatuses(
+        const std::vector<shared_model::crypto::Hash> &hashes) {
+      std::vector<std::shared_ptr<shared_model::interface::TransactionResponse>>
+          responses;
+      responses.reserve(hashes.size());
+
+      // positions of statuses which are not in cache_
+      std::vector<size_t> missed_positions;
+      std::vector<shared_model::crypto::Hash> missed_hashes;
+      for (const auto &hash : hashes) {
+        if (auto cached = cache_->findItem(hash)) {
+          responses.push_back(std::move(*cached));
+        } else {
+          missed_positions.push_back(responses.size());
+          missed_hashes.push_back(hash);
+          responses.push_back(status_factory_->makeNotReceived(hash));
+        }
+      }
+      if (missed_hashes.empty()) {
+        return responses;
+      }
+
+      auto statuses = tx_presence_cache_->check(missed_hashes);
+      if (not statuses or statuses->size() != missed_hashes.size()) {
+        // TODO andrei 30.11.18 IR-51 Handle database error
+        log_->warn("Check {} txs presence database error.",
+                   missed_hashes.size());
+        return responses;
+      }
+
+      for (size_t i = 0; i < missed_hashes.size(); ++i) {
+        const auto &hash = missed_hashes[i];
+        iroha::visit_in_place(
+            (*statuses)[i],
+            [](const iroha::ametsuchi::tx_cache_status_responses::Missing &) {
+            },
+            [&](const iroha::ametsuchi::tx_cache_status_responses::Committed
+                    &) {
+              responses[missed_positions[i]] =
+                  status_factory_->makeCommitted(hash);
+              cache_->addItem(hash, responses[missed_positions[i]]);
+            },
+            [&](const iroha::ametsuchi::tx_cache_status_responses::Rejected
+                    &) {
+              responses[missed_positions[i]] =
+                  status_factory_->makeRejected(hash);
+              cache_->addItem(hash, responses[missed_positions[i]]);
+            });
+      }
+      return responses;
+    }
 
     rxcpp::observable<
         std::shared_ptr<shared_model::interface::TransactionResponse>>
@@ -155,13 +225,10 @@ namespace iroha {
             });
       }());
       return status_bus_
-          ->statuses()
+          // select statuses with requested hash
+          ->transactionStatuses(hash)
           // prepend initial status
           .start_with(initial_status)
-          // select statuses with requested hash
-          .filter([hash](auto response) {
-            return response->transactionHash() == hash;
-          })
           // successfully complete the observable if final status is received.
           // final status is included in the observable
           .template lift<ResponsePtrType>(
@@ -191,14 +258,11 @@ namespace iroha {
       status_bus_->publish(response);
     }
 
-    void CommandServiceImpl::processBatch(
-        std::shared_ptr<shared_model::interface::TransactionBatch> batch) {
-      const auto status_issuer = "ToriiBatchProcessor";
-      const auto &txs = batch->transactions();
-
+    bool CommandServiceImpl::isCachedReplay(
+        const shared_model::interface::TransactionBatch &batch) const {
       bool has_final_status{false};
 
-      for (auto tx : txs) {
+      for (const auto &tx : batch.transactions()) {
         const auto &tx_hash = tx->hash();
         if (auto found = cache_->findItem(tx_hash)) {
           log_->debug("Found in cache: {}", **found);
@@ -223,19 +287,19 @@ namespace iroha {
         // presence of the transaction or batch in the cache with final status
         // guarantees that the transaction was passed to consensus before
         log_->warn("Replayed batch would not be served - present in cache. {}",
-                   *batch);
-        return;
+                   batch);
       }
+      return has_final_status;
+    }
 
-      auto cache_presence = tx_presence_cache_->check(*batch);
-      if (not cache_presence) {
-        // TODO andrei 30.11.18 IR-51 Handle database error
-        log_->warn("Check tx presence database error. {}", *batch);
-        return;
-      }
+    void CommandServiceImpl::processBatch(
+        std::shared_ptr<shared_model::interface::TransactionBatch> batch,
+        const iroha::ametsuchi::TxPresenceCache::BatchStatusCollectionType
+            &presence) {
+      const auto status_issuer = "ToriiBatchProcessor";
       auto is_replay = std::any_of(
-          cache_presence->begin(),
-          cache_presence->end(),
+          presence.begin(),
+          presence.end(),
           [this, &status_issuer](const auto &tx_status) {
             return iroha::visit_in_place(
                 tx_status,
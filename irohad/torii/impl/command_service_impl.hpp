@@ -10,12 +10,12 @@
 
 #include "ametsuchi/storage.hpp"
 #include "ametsuchi/tx_presence_cache.hpp"
-#include "cache/cache.hpp"
 #include "cryptography/hash.hpp"
 #include "interfaces/iroha_internal/tx_status_factory.hpp"
 #include "logger/logger_fwd.hpp"
 #include "torii/processor/transaction_processor.hpp"
 #include "torii/status_bus.hpp"
+#include "torii/status_cache.hpp"
 
 namespace iroha {
   namespace torii {
@@ -24,11 +24,7 @@ namespace iroha {
      */
     class CommandServiceImpl : public CommandService {
      public:
-      // TODO: 2019-03-13 @muratovv fix with abstract cache type IR-397
-      using CacheType = iroha::cache::Cache<
-          shared_model::crypto::Hash,
-          std::shared_ptr<shared_model::interface::TransactionResponse>,
-          shared_model::crypto::Hash::Hasher>;
+      using CacheType = StatusCache;
 
       /**
        * Creates a new instance of CommandService
@@ -63,8 +59,19 @@ namespace iroha {
           std::shared_ptr<shared_model::interface::TransactionBatch> batch)
           override;
 
+      /**
+       * Replays are found by a single lookup of all transactions of the
+       * batches in the ledger, before they reach the processor
+       */
+      void handleTransactionBatches(
+          shared_model::interface::types::BatchesCollectionType batches)
+          override;
+
       std::shared_ptr<shared_model::interface::TransactionResponse> getStatus(
           const shared_model::crypto::Hash &request) override;
+      std::vector<std::shared_ptr<shared_model::interface::TransactionResponse>>
+      getStatuses(
+          const std::vector<shared_model::crypto::Hash> &hashes) override;
       rxcpp::observable<
           std::shared_ptr<shared_model::interface::TransactionResponse>>
       getStatusStream(const shared_model::crypto::Hash &hash) override;
@@ -89,13 +96,23 @@ namespace iroha {
           std::shared_ptr<shared_model::interface::TransactionResponse>
               response);
 
+      /**
+       * @return true if a transaction of the batch has a final status in the
+       * cache, so the batch was passed to consensus before
+       */
+      bool isCachedReplay(
+          const shared_model::interface::TransactionBatch &batch) const;
+
       /**
        * Forward batch to transaction processor and set statuses of all
-       * transactions inside it
+       * transactions inside it, unless some of them are already in the ledger
        * @param batch to be processed
+       * @param presence - ledger statuses of the transactions of the batch
        */
       void processBatch(
-          std::shared_ptr<shared_model::interface::TransactionBatch> batch);
+          std::shared_ptr<shared_model::interface::TransactionBatch> batch,
+          const iroha::ametsuchi::TxPresenceCache::BatchStatusCollectionType
+              &presence);
 
       std::shared_ptr<iroha::torii::TransactionProcessor> tx_processor_;
       std::shared_ptr<iroha::ametsuchi::Storage> storage_;
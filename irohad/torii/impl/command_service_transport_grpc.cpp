@@ -7,23 +7,29 @@
 
 #include "torii/impl/command_service_transport_grpc.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
 #include <iterator>
 
 #include <boost/format.hpp>
+#include <boost/optional.hpp>
 #include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/transformed.hpp>
 #include "backend/protobuf/transaction_responses/proto_tx_response.hpp"
 #include "common/combine_latest_until_first_completed.hpp"
 #include "common/run_loop_handler.hpp"
+#include "common/thread_pool.hpp"
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "interfaces/iroha_internal/transaction_batch_factory.hpp"
 #include "interfaces/iroha_internal/transaction_batch_parser.hpp"
 #include "interfaces/iroha_internal/tx_status_factory.hpp"
 #include "interfaces/transaction.hpp"
 #include "logger/logger.hpp"
+#include "network/transaction_pool.hpp"
+#include "torii/admission_control.hpp"
 #include "torii/status_bus.hpp"
+#include "torii/traffic_capture.hpp"
 
 namespace iroha {
   namespace torii {
@@ -40,7 +46,12 @@ namespace iroha {
             transaction_batch_factory,
         rxcpp::observable<ConsensusGateEvent> consensus_gate_objects,
         int maximum_rounds_without_update,
-        logger::LoggerPtr log)
+        logger::LoggerPtr log,
+        std::shared_ptr<iroha::ThreadPool> validation_pool,
+        std::function<bool()> overloaded,
+        std::shared_ptr<AdmissionControl> admission_control,
+        std::shared_ptr<iroha::network::TransactionPool> transaction_pool,
+        std::shared_ptr<TrafficCapture> traffic_capture)
         : command_service_(std::move(command_service)),
           status_bus_(std::move(status_bus)),
           status_factory_(std::move(status_factory)),
@@ -48,6 +59,11 @@ namespace iroha {
           batch_parser_(std::move(batch_parser)),
           batch_factory_(std::move(transaction_batch_factory)),
           log_(std::move(log)),
+          validation_pool_(std::move(validation_pool)),
+          overloaded_(std::move(overloaded)),
+          admission_control_(std::move(admission_control)),
+          transaction_pool_(std::move(transaction_pool)),
+          traffic_capture_(std::move(traffic_capture)),
           consensus_gate_objects_(std::move(consensus_gate_objects)),
           maximum_rounds_without_update_(maximum_rounds_without_update) {}
 
@@ -96,10 +112,30 @@ namespace iroha {
 
     shared_model::interface::types::SharedTxsCollectionType
     CommandServiceTransportGrpc::deserializeTransactions(
-        const iroha::protocol::TxList *request) {
+        iroha::protocol::TxList &request) {
+      auto &transactions = *request.mutable_transactions();
+      const size_t count = transactions.size();
+      std::vector<boost::optional<iroha::expected::Result<
+          std::unique_ptr<shared_model::interface::Transaction>,
+          TransportFactoryType::Error>>>
+          results(count);
+      auto build = [this, &transactions, &results](size_t i) {
+        results[i] = transaction_factory_->build(
+            std::move(*transactions.Mutable(static_cast<int>(i))));
+      };
+      // signatures verification dominates stateless validation of large
+      // lists, so transactions are built in parallel and handled in order
+      if (validation_pool_ and count > 1) {
+        validation_pool_->parallelFor(count, build);
+      } else {
+        for (size_t i = 0; i < count; ++i) {
+          build(i);
+        }
+      }
+
       shared_model::interface::types::SharedTxsCollectionType tx_collection;
-      for (const auto &tx : request->transactions()) {
-        transaction_factory_->build(tx).match(
+      for (auto &result : results) {
+        std::move(*result).match(
             [&tx_collection](auto &&v) {
               tx_collection.emplace_back(std::move(v).value);
             },
@@ -110,6 +146,9 @@ namespace iroha {
                       error.error.error, 0, 0}));
             });
       }
+      if (transaction_pool_) {
+        transaction_pool_->intern(tx_collection);
+      }
       return tx_collection;
     }
 
@@ -117,15 +156,49 @@ namespace iroha {
         grpc::ServerContext *context,
         const iroha::protocol::TxList *request,
         google::protobuf::Empty *response) {
-      auto transactions = deserializeTransactions(request);
+      TrafficCapture::Scope capture(traffic_capture_.get(),
+                                    TrafficCapture::Call::kTransactions,
+                                    *request);
+      if (overloaded_ and overloaded_()) {
+        // checked before deserialization, so the flood is refused cheaply
+        log_->warn("Refusing {} transactions: peer is overloaded",
+                   request->transactions_size());
+        return grpc::Status(grpc::StatusCode::UNAVAILABLE,
+                            "Peer is overloaded, retry later");
+      }
+
+      if (admission_control_) {
+        std::vector<std::string> creators;
+        creators.reserve(request->transactions_size());
+        for (const auto &tx : request->transactions()) {
+          creators.push_back(
+              tx.payload().reduced_payload().creator_account_id());
+        }
+        auto client = clientHost(context->peer());
+        if (not admission_control_->admit(client, creators)) {
+          log_->warn("Refusing {} transactions of {}: rate limit exceeded",
+                     creators.size(),
+                     client);
+          return grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                              "Rate limit exceeded, retry later");
+        }
+      }
+
+      // the request is owned by the call and is not read after it is
+      // deserialized, so its transactions are moved to the model objects
+      // instead of being copied one by one
+      auto transactions = deserializeTransactions(
+          const_cast<iroha::protocol::TxList &>(*request));
 
       auto batches = batch_parser_->parseBatches(transactions);
 
+      // batches of the list are checked for replays at once
+      shared_model::interface::types::BatchesCollectionType valid_batches;
+      valid_batches.reserve(batches.size());
       for (auto &batch : batches) {
         batch_factory_->createTransactionBatch(batch).match(
             [&](auto &&value) {
-              this->command_service_->handleTransactionBatch(
-                  std::move(value).value);
+              valid_batches.push_back(std::move(value).value);
             },
             [&](const auto &error) {
               std::vector<shared_model::crypto::Hash> hashes;
@@ -146,6 +219,9 @@ namespace iroha {
                   });
             });
       }
+      if (not valid_batches.empty()) {
+        command_service_->handleTransactionBatches(std::move(valid_batches));
+      }
 
       return grpc::Status::OK;
     }
@@ -163,10 +239,60 @@ namespace iroha {
       return grpc::Status::OK;
     }
 
+    grpc::Status CommandServiceTransportGrpc::Statuses(
+        grpc::ServerContext *context,
+        const iroha::protocol::TxStatusesRequest *request,
+        iroha::protocol::TxStatusesResponse *response) {
+      std::vector<shared_model::crypto::Hash> hashes;
+      hashes.reserve(request->tx_hashes_size());
+      for (const auto &tx_hash : request->tx_hashes()) {
+        hashes.push_back(shared_model::crypto::Hash::fromHexString(tx_hash));
+      }
+      for (const auto &status : command_service_->getStatuses(hashes)) {
+        *response->add_responses() =
+            std::static_pointer_cast<shared_model::proto::TransactionResponse>(
+                status)
+                ->getTransport();
+      }
+      return grpc::Status::OK;
+    }
+
     grpc::Status CommandServiceTransportGrpc::StatusStream(
         grpc::ServerContext *context,
         const iroha::protocol::TxStatusRequest *request,
         grpc::ServerWriter<iroha::protocol::ToriiResponse> *response_writer) {
+      auto hash = shared_model::crypto::Hash::fromHexString(request->tx_hash());
+
+      auto client_id_format = boost::format("Peer: '%s', %s");
+      std::string client_id =
+          (client_id_format % context->peer() % hash.toString()).str();
+      return streamStatuses(context, {hash}, client_id, response_writer);
+    }
+
+    grpc::Status CommandServiceTransportGrpc::StatusesStream(
+        grpc::ServerContext *context,
+        const iroha::protocol::TxStatusesRequest *request,
+        grpc::ServerWriter<iroha::protocol::ToriiResponse> *response_writer) {
+      std::vector<shared_model::crypto::Hash> hashes;
+      hashes.reserve(request->tx_hashes_size());
+      for (const auto &tx_hash : request->tx_hashes()) {
+        auto hash = shared_model::crypto::Hash::fromHexString(tx_hash);
+        if (std::find(hashes.begin(), hashes.end(), hash) == hashes.end()) {
+          hashes.push_back(std::move(hash));
+        }
+      }
+
+      auto client_id_format = boost::format("Peer: '%s', %d transactions");
+      std::string client_id =
+          (client_id_format % context->peer() % hashes.size()).str();
+      return streamStatuses(context, hashes, client_id, response_writer);
+    }
+
+    grpc::Status CommandServiceTransportGrpc::streamStatuses(
+        grpc::ServerContext *context,
+        const std::vector<shared_model::crypto::Hash> &hashes,
+        const std::string &client_id,
+        grpc::ServerWriter<iroha::protocol::ToriiResponse> *response_writer) {
       rxcpp::schedulers::run_loop rl;
 
       auto current_thread = rxcpp::synchronize_in_one_worker(
@@ -174,29 +300,64 @@ namespace iroha {
 
       rxcpp::composite_subscription subscription;
 
-      auto hash = shared_model::crypto::Hash::fromHexString(request->tx_hash());
-
-      auto client_id_format = boost::format("Peer: '%s', %s");
-      std::string client_id =
-          (client_id_format % context->peer() % hash.toString()).str();
-      auto status_bus = command_service_->getStatusStream(hash);
       auto consensus_gate_observable =
           consensus_gate_objects_
               // a dummy start_with lets us don't wait for the consensus event
               // on further combine_latest
               .start_with(ConsensusGateEvent{});
 
-      boost::optional<iroha::protocol::TxStatus> last_tx_status;
-      auto rounds_counter{0};
-      makeCombineLatestUntilFirstCompleted(
-          status_bus,
-          current_thread,
-          [](auto status, auto) { return status; },
-          consensus_gate_observable)
-          // complete the observable if client is disconnected or too many
-          // rounds have passed without tx status change
-          .take_while([=, &rounds_counter, &last_tx_status](
-                          const auto &response) {
+      struct StreamState {
+        boost::optional<iroha::protocol::TxStatus> last_tx_status;
+        int rounds_counter{0};
+        bool status_changed{false};
+      };
+      std::vector<StreamState> states(hashes.size());
+
+      using ResponsePtrType =
+          std::shared_ptr<shared_model::interface::TransactionResponse>;
+      std::vector<rxcpp::observable<ResponsePtrType>> streams;
+      streams.reserve(hashes.size());
+      for (size_t i = 0; i < hashes.size(); ++i) {
+        streams.push_back(
+            makeCombineLatestUntilFirstCompleted(
+                command_service_->getStatusStream(hashes[i]),
+                current_thread,
+                [](auto status, auto) { return status; },
+                consensus_gate_observable)
+                // complete the observable if too many rounds have passed
+                // without tx status change
+                .take_while([this, &state = states[i]](const auto &response) {
+                  // increment round counter when the same status arrived
+                  // again.
+                  auto status =
+                      std::static_pointer_cast<
+                          shared_model::proto::TransactionResponse>(response)
+                          ->getTransport()
+                          .tx_status();
+                  state.status_changed = not state.last_tx_status
+                      or status != *state.last_tx_status;
+                  if (not state.status_changed) {
+                    ++state.rounds_counter;
+                    // we stop the stream when round counter is greater than
+                    // allowed.
+                    return state.rounds_counter
+                        < maximum_rounds_without_update_;
+                  }
+                  state.rounds_counter = 0;
+                  state.last_tx_status = status;
+                  return true;
+                })
+                // omit the repeated status, but do not stop the stream
+                .filter([&state = states[i]](const auto &) {
+                  return state.status_changed;
+                })
+                .as_dynamic());
+      }
+
+      rxcpp::observable<>::iterate(streams, current_thread)
+          .merge(current_thread)
+          // complete the observable if client is disconnected
+          .take_while([=](const auto &response) {
             const auto &proto_response =
                 std::static_pointer_cast<
                     shared_model::proto::TransactionResponse>(response)
@@ -207,23 +368,6 @@ namespace iroha {
               return false;
             }
 
-            // increment round counter when the same status arrived again.
-            auto status = proto_response.tx_status();
-            auto status_is_same =
-                last_tx_status and (status == *last_tx_status);
-            if (status_is_same) {
-              ++rounds_counter;
-              if (rounds_counter >= maximum_rounds_without_update_) {
-                // we stop the stream when round counter is greater than
-                // allowed.
-                return false;
-              }
-              // omit the received status, but do not stop the stream
-              return true;
-            }
-            rounds_counter = 0;
-            last_tx_status = status;
-
             // write a new status to the stream
             if (not response_writer->Write(proto_response)) {
               log_->error("write to stream has failed to client {}", client_id);
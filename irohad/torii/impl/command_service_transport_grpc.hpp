@@ -8,6 +8,8 @@
 
 #include "torii/command_service.hpp"
 
+#include <functional>
+
 #include "endpoint.grpc.pb.h"
 #include "endpoint.pb.h"
 #include "interfaces/common_objects/transaction_sequence_common.hpp"
@@ -15,8 +17,14 @@
 #include "logger/logger_fwd.hpp"
 
 namespace iroha {
+  class ThreadPool;
+  namespace network {
+    class TransactionPool;
+  }
   namespace torii {
+    class AdmissionControl;
     class StatusBus;
+    class TrafficCapture;
   }
 }  // namespace iroha
 
@@ -52,6 +60,20 @@ namespace iroha {
        * @param maximum_rounds_without_update - defines how long tx status
        * stream is kept alive when no new tx statuses appear
        * @param log to print progress
+       * @param validation_pool - threads which deserialize and statelessly
+       * validate transactions of a list, including signatures verification,
+       * in parallel. If null, transactions are validated sequentially on the
+       * calling thread
+       * @param overloaded - returns true when the peer cannot take more
+       * transactions, then they are refused with a retryable status. If not
+       * provided, transactions are always accepted
+       * @param admission_control - rate limits of clients and creator
+       * accounts, checked before deserialization. If null, there are no
+       * limits
+       * @param transaction_pool - pool of transactions alive in the peer,
+       * received transactions are replaced by their pooled instances
+       * @param traffic_capture - log recording the received lists of
+       * transactions. If null, they are not recorded
        */
       CommandServiceTransportGrpc(
           std::shared_ptr<CommandService> command_service,
@@ -65,7 +87,13 @@ namespace iroha {
               transaction_batch_factory,
           rxcpp::observable<ConsensusGateEvent> consensus_gate_objects,
           int maximum_rounds_without_update,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          std::shared_ptr<iroha::ThreadPool> validation_pool = nullptr,
+          std::function<bool()> overloaded = nullptr,
+          std::shared_ptr<AdmissionControl> admission_control = nullptr,
+          std::shared_ptr<iroha::network::TransactionPool> transaction_pool =
+              nullptr,
+          std::shared_ptr<TrafficCapture> traffic_capture = nullptr);
 
       /**
        * Torii call via grpc
@@ -102,6 +130,20 @@ namespace iroha {
                           const iroha::protocol::TxStatusRequest *request,
                           iroha::protocol::ToriiResponse *response) override;
 
+      /**
+       * Statuses call via grpc
+       * @param context - call context
+       * @param request - TxStatusesRequest object which identifies several
+       * transactions
+       * @param response - TxStatusesResponse which contains current states of
+       * requested transactions in the order of request
+       * @return status
+       */
+      grpc::Status Statuses(grpc::ServerContext *context,
+                            const iroha::protocol::TxStatusesRequest *request,
+                            iroha::protocol::TxStatusesResponse *response)
+          override;
+
       /**
        * StatusStream call via grpc
        * @param context - call context
@@ -117,12 +159,40 @@ namespace iroha {
           grpc::ServerWriter<iroha::protocol::ToriiResponse> *response_writer)
           override;
 
+      /**
+       * StatusesStream call via grpc
+       * @param context - call context
+       * @param request - TxStatusesRequest object which identifies several
+       * transactions
+       * @param response_writer - grpc::ServerWriter which can repeatedly send
+       * statuses of the transactions back to the client
+       * @return status
+       */
+      grpc::Status StatusesStream(
+          grpc::ServerContext *context,
+          const iroha::protocol::TxStatusesRequest *request,
+          grpc::ServerWriter<iroha::protocol::ToriiResponse> *response_writer)
+          override;
+
      private:
+      /**
+       * Writes statuses of the transactions to the stream until all of them
+       * are final or kept unchanged for too many rounds, or the client is
+       * disconnected. Statuses of all transactions are handled by a single
+       * run loop on the calling thread
+       */
+      grpc::Status streamStatuses(
+          grpc::ServerContext *context,
+          const std::vector<shared_model::crypto::Hash> &hashes,
+          const std::string &client_id,
+          grpc::ServerWriter<iroha::protocol::ToriiResponse> *response_writer);
+
       /**
        * Flat map transport transactions to shared model
+       * @param request - list of transactions, which are moved out of it
        */
       shared_model::interface::types::SharedTxsCollectionType
-      deserializeTransactions(const iroha::protocol::TxList *request);
+      deserializeTransactions(iroha::protocol::TxList &request);
 
       std::shared_ptr<CommandService> command_service_;
       std::shared_ptr<iroha::torii::StatusBus> status_bus_;
@@ -133,6 +203,11 @@ namespace iroha {
       std::shared_ptr<shared_model::interface::TransactionBatchFactory>
           batch_factory_;
       logger::LoggerPtr log_;
+      std::shared_ptr<iroha::ThreadPool> validation_pool_;
+      std::function<bool()> overloaded_;
+      std::shared_ptr<AdmissionControl> admission_control_;
+      std::shared_ptr<iroha::network::TransactionPool> transaction_pool_;
+      std::shared_ptr<TrafficCapture> traffic_capture_;
 
       rxcpp::observable<ConsensusGateEvent> consensus_gate_objects_;
       const int maximum_rounds_without_update_;
@@ -49,6 +49,19 @@ namespace torii_utils {
     return stub_->Find(&context, query, &response);
   }
 
+  std::vector<QueryResponse> QuerySyncClient::FindStream(
+      const iroha::protocol::Query &query) const {
+    grpc::ClientContext context;
+    auto reader = stub_->FindStream(&context, query);
+    std::vector<QueryResponse> responses;
+    QueryResponse resp;
+    while (reader->Read(&resp)) {
+      responses.push_back(resp);
+    }
+    reader->Finish();
+    return responses;
+  }
+
   std::vector<iroha::protocol::BlockQueryResponse>
   QuerySyncClient::FetchCommits(
       const iroha::protocol::BlocksQuery &blocks_query) const {
@@ -63,6 +76,22 @@ namespace torii_utils {
     return responses;
   }
 
+  grpc::Status QuerySyncClient::SubmitQueryJob(
+      const iroha::protocol::Query &query,
+      iroha::protocol::QueryJobResponse &response) const {
+    grpc::ClientContext context;
+    return stub_->SubmitQueryJob(&context, query, &response);
+  }
+
+  grpc::Status QuerySyncClient::FetchQueryJob(
+      const std::string &job_id,
+      iroha::protocol::QueryJobResponse &response) const {
+    grpc::ClientContext context;
+    iroha::protocol::QueryJobRequest request;
+    request.set_job_id(job_id);
+    return stub_->FetchQueryJob(&context, request, &response);
+  }
+
   void QuerySyncClient::swap(QuerySyncClient &lhs, QuerySyncClient &rhs) {
     using std::swap;
     swap(lhs.ip_, rhs.ip_);
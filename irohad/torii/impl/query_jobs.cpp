@@ -0,0 +1,150 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/query_jobs.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+#include "common/hexutils.hpp"
+#include "common/timer_wheel.hpp"
+#include "logger/logger.hpp"
+
+namespace iroha {
+  namespace torii {
+
+    constexpr size_t QueryJobs::kMaxBufferedPages;
+    constexpr std::chrono::minutes QueryJobs::kRetention;
+    constexpr std::chrono::milliseconds QueryJobs::kYieldDelay;
+
+    QueryJobs::QueryJobs(
+        size_t max_jobs,
+        WorkStealingExecutor &executor,
+        std::shared_ptr<WorkStealingExecutor::Lane> interactive_lane,
+        std::shared_ptr<TimerWheel> timer_wheel,
+        logger::LoggerPtr log)
+        : max_jobs_(max_jobs),
+          lane_(executor.makeLane(1)),
+          interactive_lane_(std::move(interactive_lane)),
+          timer_wheel_(std::move(timer_wheel)),
+          log_(std::move(log)) {}
+
+    boost::optional<std::string> QueryJobs::submit(NextPage next_page) {
+      auto job = std::make_shared<Job>(std::move(next_page));
+      std::string id;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        dropExpired();
+        if (jobs_.size() >= max_jobs_) {
+          return boost::none;
+        }
+        id = makeId();
+        jobs_.emplace(id, job);
+      }
+      post(std::move(job));
+      return id;
+    }
+
+    boost::optional<QueryJobs::Fetched> QueryJobs::fetch(
+        const std::string &job_id) {
+      std::shared_ptr<Job> resumed;
+      Fetched fetched;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = jobs_.find(job_id);
+        if (it == jobs_.end()) {
+          return boost::none;
+        }
+        auto job = it->second;
+        fetched.responses.reserve(job->responses.size());
+        std::move(job->responses.begin(),
+                  job->responses.end(),
+                  std::back_inserter(fetched.responses));
+        job->responses.clear();
+        job->fetched = Clock::now();
+        fetched.finished = job->finished;
+        if (job->finished) {
+          jobs_.erase(it);
+        } else if (not job->running) {
+          job->running = true;
+          resumed = std::move(job);
+        }
+      }
+      if (resumed) {
+        post(std::move(resumed));
+      }
+      return fetched;
+    }
+
+    void QueryJobs::post(std::shared_ptr<Job> job) {
+      // the jobs may be destroyed while a page waits in the lane
+      std::weak_ptr<QueryJobs> weak_this = shared_from_this();
+      lane_->post([weak_this, job = std::move(job)] {
+        if (auto self = weak_this.lock()) {
+          self->runPage(job);
+        }
+      });
+    }
+
+    void QueryJobs::runPage(const std::shared_ptr<Job> &job) {
+      if (interactive_lane_ and interactive_lane_->pending() != 0) {
+        std::weak_ptr<QueryJobs> weak_this = shared_from_this();
+        timer_wheel_->schedule(kYieldDelay, [weak_this, job] {
+          if (auto self = weak_this.lock()) {
+            self->post(job);
+          }
+        });
+        return;
+      }
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (job->dropped) {
+          return;
+        }
+      }
+
+      auto response = job->next_page();
+
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (response) {
+          job->responses.push_back(std::move(*response));
+        } else {
+          job->finished = true;
+        }
+        if (job->finished or job->dropped
+            or job->responses.size() >= kMaxBufferedPages) {
+          // a paused job is resumed when its responses are fetched
+          job->running = false;
+          return;
+        }
+      }
+      post(job);
+    }
+
+    void QueryJobs::dropExpired() {
+      const auto expired = Clock::now() - kRetention;
+      for (auto it = jobs_.begin(); it != jobs_.end();) {
+        if (it->second->fetched < expired) {
+          log_->info("Dropping query job which is not fetched in time");
+          it->second->dropped = true;
+          it = jobs_.erase(it);
+        } else {
+          ++it;
+        }
+      }
+    }
+
+    std::string QueryJobs::makeId() {
+      std::string bytes;
+      for (size_t i = 0; i < 4; ++i) {
+        auto value = random_();
+        bytes.append(reinterpret_cast<const char *>(&value), sizeof(value));
+      }
+      return iroha::bytestringToHexstring(bytes);
+    }
+
+  }  // namespace torii
+}  // namespace iroha
@@ -8,9 +8,11 @@
 #include "backend/protobuf/query_responses/proto_block_query_response.hpp"
 #include "backend/protobuf/query_responses/proto_query_response.hpp"
 #include "common/run_loop_handler.hpp"
+#include "interfaces/iroha_internal/block.hpp"
 #include "cryptography/default_hash_provider.hpp"
 #include "interfaces/iroha_internal/abstract_transport_factory.hpp"
 #include "logger/logger.hpp"
+#include "torii/query_jobs.hpp"
 #include "validators/default_validator.hpp"
 
 namespace iroha {
@@ -20,51 +22,314 @@ namespace iroha {
         std::shared_ptr<iroha::torii::QueryProcessor> query_processor,
         std::shared_ptr<QueryFactoryType> query_factory,
         std::shared_ptr<BlocksQueryFactoryType> blocks_query_factory,
-        logger::LoggerPtr log)
+        logger::LoggerPtr log,
+        std::shared_ptr<TrafficCapture> traffic_capture,
+        std::shared_ptr<QueryJobs> query_jobs)
         : query_processor_{std::move(query_processor)},
           query_factory_{std::move(query_factory)},
           blocks_query_factory_{std::move(blocks_query_factory)},
-          log_{std::move(log)} {}
+          log_{std::move(log)},
+          traffic_capture_{std::move(traffic_capture)},
+          query_jobs_{std::move(query_jobs)} {}
 
-    void QueryService::Find(iroha::protocol::Query const &request,
-                            iroha::protocol::QueryResponse &response) {
-      shared_model::crypto::Hash hash;
-      auto blobPayload = shared_model::proto::makeBlob(request.payload());
-      hash = shared_model::crypto::DefaultHashProvider::makeHash(blobPayload);
+    namespace {
+      /**
+       * Queries with the same payload are answered once, so that a captured
+       * signed query can not be replayed. Replays are rejected before their
+       * signatures are verified
+       */
+      const char *kReplayedQueryMessage = "Query was already processed";
+
+      /**
+       * Moves the cursor of a paginated query to the page following response
+       * @return true if there is a next page
+       */
+      bool nextPage(iroha::protocol::Query &query,
+                    const iroha::protocol::QueryResponse &response) {
+        auto &payload = *query.mutable_payload();
+        if (payload.has_get_account_assets()
+            and response.has_account_assets_response()
+            and response.account_assets_response().opt_next_asset_id_case()
+                == iroha::protocol::AccountAssetResponse::kNextAssetId) {
+          payload.mutable_get_account_assets()
+              ->mutable_pagination_meta()
+              ->set_first_asset_id(
+                  response.account_assets_response().next_asset_id());
+          return true;
+        }
+        if (payload.has_get_account_detail()
+            and response.has_account_detail_response()
+            and response.account_detail_response().has_next_record_id()) {
+          *payload.mutable_get_account_detail()
+               ->mutable_pagination_meta()
+               ->mutable_first_record_id() =
+              response.account_detail_response().next_record_id();
+          return true;
+        }
+        if (response.has_transactions_page_response()
+            and response.transactions_page_response().next_page_tag_case()
+                == iroha::protocol::TransactionsPageResponse::kNextTxHash) {
+          const auto &next_hash =
+              response.transactions_page_response().next_tx_hash();
+          if (payload.has_get_account_transactions()) {
+            payload.mutable_get_account_transactions()
+                ->mutable_pagination_meta()
+                ->set_first_tx_hash(next_hash);
+            return true;
+          }
+          if (payload.has_get_account_asset_transactions()) {
+            payload.mutable_get_account_asset_transactions()
+                ->mutable_pagination_meta()
+                ->set_first_tx_hash(next_hash);
+            return true;
+          }
+        }
+        return false;
+      }
+
+      /**
+       * @return copy of the query to be executed page by page, queries
+       * without pagination get the default page size
+       */
+      iroha::protocol::Query pagedQuery(const iroha::protocol::Query &request) {
+        // signatures were validated once for the original query, pages are
+        // requested by moving the cursor in its copy
+        auto page_request = request;
+        auto &payload = *page_request.mutable_payload();
+        if (payload.has_get_account_assets()
+            and not payload.get_account_assets().has_pagination_meta()) {
+          payload.mutable_get_account_assets()
+              ->mutable_pagination_meta()
+              ->set_page_size(QueryService::kDefaultStreamPageSize);
+        }
+        if (payload.has_get_account_detail()
+            and not payload.get_account_detail().has_pagination_meta()) {
+          payload.mutable_get_account_detail()
+              ->mutable_pagination_meta()
+              ->set_page_size(QueryService::kDefaultStreamPageSize);
+        }
+        return page_request;
+      }
+
+      /// @return response to a page of the query with the given hash
+      iroha::protocol::QueryResponse executePage(
+          QueryProcessor &query_processor,
+          const iroha::protocol::Query &page_request,
+          const std::string &hash) {
+        auto response = static_cast<shared_model::proto::QueryResponse &>(
+                            *query_processor.queryHandle(
+                                shared_model::proto::Query{page_request}))
+                            .getTransport();
+        response.set_query_hash(hash);
+        return response;
+      }
+
+      /// @return height of the block in the response, if it has one
+      boost::optional<shared_model::interface::types::HeightType> blockHeight(
+          const shared_model::interface::BlockQueryResponse &response) {
+        return iroha::visit_in_place(
+            response.get(),
+            [](const shared_model::interface::BlockResponse &block_response)
+                -> boost::optional<shared_model::interface::types::HeightType> {
+              return block_response.block().height();
+            },
+            [](const shared_model::interface::BlockErrorResponse &)
+                -> boost::optional<shared_model::interface::types::HeightType> {
+              return boost::none;
+            });
+      }
+    }  // namespace
 
+    void QueryService::statelessInvalid(
+        const shared_model::crypto::Hash &hash,
+        std::string message,
+        iroha::protocol::QueryResponse &response) {
+      response.set_query_hash(hash.hex());
+      response.mutable_error_response()->set_reason(
+          iroha::protocol::ErrorResponse::STATELESS_INVALID);
+      response.mutable_error_response()->set_message(std::move(message));
+    }
+
+    std::unique_ptr<shared_model::interface::Query> QueryService::accepted(
+        const iroha::protocol::Query &request,
+        const shared_model::crypto::Hash &hash,
+        iroha::protocol::QueryResponse &response) {
       if (cache_.findItem(hash)) {
-        // Query was already processed
-        response.mutable_error_response()->set_reason(
-            iroha::protocol::ErrorResponse::STATELESS_INVALID);
-        return;
+        statelessInvalid(hash, kReplayedQueryMessage, response);
+        return nullptr;
       }
 
-      query_factory_->build(request).match(
-          [this, &hash, &response](const auto &query) {
-            // Send query to iroha
-            response = static_cast<shared_model::proto::QueryResponse &>(
-                           *query_processor_->queryHandle(*query.value))
-                           .getTransport();
+      return query_factory_->build(request).match(
+          [this, &hash](auto &&query) {
             // TODO 18.02.2019 lebdron: IR-336 Replace cache
             // 0 is used as a dummy value
             cache_.addItem(hash, 0);
+            return std::move(query.value);
           },
-          [&hash, &response](auto &&error) {
-            response.set_query_hash(hash.hex());
-            response.mutable_error_response()->set_reason(
-                iroha::protocol::ErrorResponse::STATELESS_INVALID);
-            response.mutable_error_response()->set_message(
-                std::move(error.error.error));
+          [&hash, &response](auto &&error)
+              -> std::unique_ptr<shared_model::interface::Query> {
+            statelessInvalid(hash, std::move(error.error.error), response);
+            return nullptr;
           });
     }
 
+    void QueryService::Find(iroha::protocol::Query const &request,
+                            iroha::protocol::QueryResponse &response) {
+      auto hash = shared_model::crypto::DefaultHashProvider::makeHash(
+          shared_model::proto::makeBlob(request.payload()));
+
+      if (auto query = accepted(request, hash, response)) {
+        // Send query to iroha
+        response = static_cast<shared_model::proto::QueryResponse &>(
+                       *query_processor_->queryHandle(*query))
+                       .getTransport();
+      }
+    }
+
     grpc::Status QueryService::Find(grpc::ServerContext *context,
                                     const iroha::protocol::Query *request,
                                     iroha::protocol::QueryResponse *response) {
+      TrafficCapture::Scope capture(
+          traffic_capture_.get(), TrafficCapture::Call::kQuery, *request);
       Find(*request, *response);
       return grpc::Status::OK;
     }
 
+    void QueryService::FindAsync(iroha::protocol::Query const &request,
+                                 FindCallback respond) {
+      if (traffic_capture_) {
+        // the call is recorded when it is responded
+        auto capture = std::make_shared<TrafficCapture::Scope>(
+            traffic_capture_.get(), TrafficCapture::Call::kQuery, request);
+        respond = [capture = std::move(capture), next = std::move(respond)](
+                      grpc::Status status,
+                      const iroha::protocol::QueryResponse &response) {
+          next(std::move(status), response);
+          capture->complete();
+        };
+      }
+
+      auto hash = shared_model::crypto::DefaultHashProvider::makeHash(
+          shared_model::proto::makeBlob(request.payload()));
+
+      iroha::protocol::QueryResponse response;
+      auto query = accepted(request, hash, response);
+      if (not query) {
+        respond(grpc::Status::OK, response);
+        return;
+      }
+
+      query_processor_->queryHandleAsync(
+          std::move(query),
+          [respond = std::move(respond)](auto response) {
+            if (not response) {
+              respond(grpc::Status(grpc::StatusCode::UNAVAILABLE,
+                                   "Query was not executed"),
+                      iroha::protocol::QueryResponse{});
+              return;
+            }
+            respond(grpc::Status::OK,
+                    static_cast<shared_model::proto::QueryResponse &>(*response)
+                        .getTransport());
+          });
+    }
+
+    void QueryService::FindStream(iroha::protocol::Query const &request,
+                                  const ResponseWriter &write) {
+      auto hash = shared_model::crypto::DefaultHashProvider::makeHash(
+          shared_model::proto::makeBlob(request.payload()));
+
+      iroha::protocol::QueryResponse error;
+      if (not accepted(request, hash, error)) {
+        write(error);
+        return;
+      }
+
+      auto page_request = pagedQuery(request);
+      const auto hex_hash = hash.hex();
+      iroha::protocol::QueryResponse response;
+      do {
+        response = executePage(*query_processor_, page_request, hex_hash);
+        if (not write(response)) {
+          log_->debug("Query stream was interrupted by client");
+          return;
+        }
+      } while (nextPage(page_request, response));
+    }
+
+    grpc::Status QueryService::FindStream(
+        grpc::ServerContext *context,
+        const iroha::protocol::Query *request,
+        grpc::ServerWriter<iroha::protocol::QueryResponse> *writer) {
+      TrafficCapture::Scope capture(
+          traffic_capture_.get(), TrafficCapture::Call::kQueryStream, *request);
+      FindStream(*request,
+                 [context, writer](const iroha::protocol::QueryResponse &r) {
+                   return not context->IsCancelled() and writer->Write(r);
+                 });
+      return grpc::Status::OK;
+    }
+
+    grpc::Status QueryService::SubmitQueryJob(
+        grpc::ServerContext *context,
+        const iroha::protocol::Query *request,
+        iroha::protocol::QueryJobResponse *response) {
+      if (not query_jobs_) {
+        return grpc::Status(grpc::StatusCode::UNIMPLEMENTED,
+                            "Query jobs are disabled");
+      }
+      auto hash = shared_model::crypto::DefaultHashProvider::makeHash(
+          shared_model::proto::makeBlob(request->payload()));
+      iroha::protocol::QueryResponse error;
+      if (not accepted(*request, hash, error)) {
+        *response->add_responses() = std::move(error);
+        response->set_finished(true);
+        return grpc::Status::OK;
+      }
+
+      auto job_id = query_jobs_->submit(
+          [query_processor = query_processor_,
+           page_request = pagedQuery(*request),
+           hash = hash.hex(),
+           done = false]() mutable
+          -> boost::optional<iroha::protocol::QueryResponse> {
+            if (done) {
+              return boost::none;
+            }
+            auto response = executePage(*query_processor, page_request, hash);
+            done = not nextPage(page_request, response);
+            return response;
+          });
+      if (not job_id) {
+        return grpc::Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                            "Too many query jobs, retry later");
+      }
+      log_->debug("Query job {} is submitted by {}",
+                  *job_id,
+                  request->payload().meta().creator_account_id());
+      response->set_job_id(std::move(*job_id));
+      return grpc::Status::OK;
+    }
+
+    grpc::Status QueryService::FetchQueryJob(
+        grpc::ServerContext *context,
+        const iroha::protocol::QueryJobRequest *request,
+        iroha::protocol::QueryJobResponse *response) {
+      boost::optional<QueryJobs::Fetched> fetched;
+      if (query_jobs_) {
+        fetched = query_jobs_->fetch(request->job_id());
+      }
+      if (not fetched) {
+        return grpc::Status(grpc::StatusCode::NOT_FOUND, "Unknown query job");
+      }
+      response->set_job_id(request->job_id());
+      for (auto &page : fetched->responses) {
+        *response->add_responses() = std::move(page);
+      }
+      response->set_finished(fetched->finished);
+      return grpc::Status::OK;
+    }
+
     grpc::Status QueryService::FetchCommits(
         grpc::ServerContext *context,
         const iroha::protocol::BlocksQuery *request,
@@ -78,12 +343,26 @@ namespace iroha {
       blocks_query_factory_->build(*request).match(
           [this, context, request, writer, &current_thread, &run_loop](
               const auto &query) {
+            const auto start_height = query.value->startHeight();
+            if (start_height) {
+              // committed blocks are not written to an invalid query
+              if (auto error = this->checkBlocksQuery(*request)) {
+                writer->WriteLast(*error, grpc::WriteOptions());
+                return;
+              }
+            }
+
+            // height of the next block to write, new blocks below it have
+            // already been written from the block store
+            shared_model::interface::types::HeightType next_height = 0;
+            const BlockFilter filter(request->filter());
             rxcpp::composite_subscription subscription;
             std::string client_id =
                 (boost::format("Peer: '%s'") % context->peer()).str();
             query_processor_->blocksQueryHandle(*query.value)
                 .observe_on(current_thread)
-                .take_while([this, context, request, writer, client_id](
+                .take_while([this, context, request, writer, client_id,
+                             &next_height, &filter](
                                 const std::shared_ptr<
                                     shared_model::interface::BlockQueryResponse>
                                     response) {
@@ -92,6 +371,11 @@ namespace iroha {
                     return false;
                   }
 
+                  auto height = blockHeight(*response);
+                  if (height and *height < next_height) {
+                    return true;
+                  }
+
                   log_->debug("{} receives {}",
                               request->meta().creator_account_id(),
                               *response);
@@ -101,7 +385,18 @@ namespace iroha {
                           shared_model::proto::BlockQueryResponse>(response)
                           ->getTransport();
 
-                  if (not writer->Write(proto_response)) {
+                  boost::optional<iroha::protocol::BlockQueryResponse> filtered;
+                  if (not filter.empty()
+                      and proto_response.has_block_response()) {
+                    filtered =
+                        filter.apply(proto_response.block_response().block());
+                    if (not filtered) {
+                      return true;
+                    }
+                  }
+
+                  if (not writer->Write(filtered ? *filtered
+                                                 : proto_response)) {
                     log_->error("write to stream has failed to client {}",
                                 client_id);
                     return false;
@@ -127,6 +422,23 @@ namespace iroha {
                     },
                     [&] { log_->debug("block stream done, {}", client_id); });
 
+            // new blocks wait on the run loop while committed ones are written
+            if (start_height) {
+              next_height = *start_height;
+              while (not context->IsCancelled()) {
+                auto response = this->nextCommittedBlock(next_height, filter);
+                if (not response) {
+                  break;
+                }
+                if (not writer->Write(*response)) {
+                  log_->error("write to stream has failed to client {}",
+                              client_id);
+                  subscription.unsubscribe();
+                  return;
+                }
+              }
+            }
+
             iroha::schedulers::handleEvents(subscription, run_loop);
           },
           [this, writer](auto &&error) {
@@ -140,5 +452,69 @@ namespace iroha {
       return grpc::Status::OK;
     }
 
+    boost::optional<iroha::protocol::BlockQueryResponse>
+    QueryService::committedBlock(
+        shared_model::interface::types::HeightType height) {
+      auto response = query_processor_->committedBlock(height);
+      if (not response) {
+        return boost::none;
+      }
+      return std::static_pointer_cast<shared_model::proto::BlockQueryResponse>(
+                 response)
+          ->getTransport();
+    }
+
+    boost::optional<iroha::protocol::BlockQueryResponse>
+    QueryService::nextCommittedBlock(
+        shared_model::interface::types::HeightType &height,
+        const BlockFilter &filter) {
+      while (true) {
+        if (not filter.accountIds().empty()) {
+          // an unknown index is not trusted, blocks are read one by one then
+          if (auto heights = query_processor_->accountsBlockHeights(
+                  filter.accountIds(), height, 1)) {
+            if (heights->empty()) {
+              return boost::none;
+            }
+            height = std::max(height, heights->front());
+          }
+        }
+        auto response = committedBlock(height);
+        if (not response) {
+          return boost::none;
+        }
+        ++height;
+        if (filter.empty() or not response->has_block_response()) {
+          return response;
+        }
+        if (auto filtered = filter.apply(response->block_response().block())) {
+          return filtered;
+        }
+      }
+    }
+
+    boost::optional<iroha::protocol::BlockQueryResponse>
+    QueryService::checkBlocksQuery(
+        const iroha::protocol::BlocksQuery &request) {
+      using ResultType = boost::optional<iroha::protocol::BlockQueryResponse>;
+      return blocks_query_factory_->build(request).match(
+          [this](const auto &query) -> ResultType {
+            auto response = query_processor_->blocksQueryError(*query.value);
+            if (not response) {
+              return boost::none;
+            }
+            return std::static_pointer_cast<
+                       shared_model::proto::BlockQueryResponse>(response)
+                ->getTransport();
+          },
+          [this](auto &&error) -> ResultType {
+            log_->debug("Stateless invalid: {}", error.error.error);
+            iroha::protocol::BlockQueryResponse response;
+            response.mutable_block_error_response()->set_message(
+                std::move(error.error.error));
+            return response;
+          });
+    }
+
   }  // namespace torii
 }  // namespace iroha
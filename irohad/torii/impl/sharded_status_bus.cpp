@@ -0,0 +1,59 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/impl/sharded_status_bus.hpp"
+
+#include <boost/assert.hpp>
+#include "torii/impl/status_bus_impl.hpp"
+
+namespace iroha {
+  namespace torii {
+    ShardedStatusBus::ShardedStatusBus(
+        std::vector<std::shared_ptr<StatusBus>> shards)
+        : shards_(std::move(shards)) {
+      BOOST_ASSERT_MSG(not shards_.empty(), "At least one shard is required");
+    }
+
+    std::shared_ptr<ShardedStatusBus> ShardedStatusBus::create(
+        size_t shards_number,
+        const std::function<rxcpp::observe_on_one_worker(size_t)>
+            &make_worker) {
+      std::vector<std::shared_ptr<StatusBus>> shards;
+      shards.reserve(shards_number);
+      for (size_t i = 0; i < shards_number; ++i) {
+        shards.push_back(std::make_shared<StatusBusImpl>(make_worker(i)));
+      }
+      return std::make_shared<ShardedStatusBus>(std::move(shards));
+    }
+
+    void ShardedStatusBus::publish(StatusBus::Objects resp) {
+      shard(resp->transactionHash()).publish(resp);
+    }
+
+    rxcpp::observable<StatusBus::Objects> ShardedStatusBus::statuses() {
+      if (shards_.size() == 1) {
+        return shards_.front()->statuses();
+      }
+      std::vector<rxcpp::observable<StatusBus::Objects>> observables;
+      observables.reserve(shards_.size());
+      for (auto &shard : shards_) {
+        observables.push_back(shard->statuses());
+      }
+      return rxcpp::observable<>::iterate(observables)
+          .merge(rxcpp::serialize_new_thread());
+    }
+
+    rxcpp::observable<StatusBus::Objects> ShardedStatusBus::transactionStatuses(
+        const shared_model::interface::types::HashType &hash) {
+      return shard(hash).transactionStatuses(hash);
+    }
+
+    StatusBus &ShardedStatusBus::shard(
+        const shared_model::interface::types::HashType &hash) {
+      return *shards_[shared_model::crypto::Hash::Hasher{}(hash)
+                      % shards_.size()];
+    }
+  }  // namespace torii
+}  // namespace iroha
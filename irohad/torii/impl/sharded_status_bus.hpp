@@ -0,0 +1,59 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef TORII_SHARDED_STATUS_BUS
+#define TORII_SHARDED_STATUS_BUS
+
+#include "torii/status_bus.hpp"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace iroha {
+  namespace torii {
+    /**
+     * StatusBus which delivers statuses on several workers. Every status is
+     * routed to a shard by its transaction hash, so statuses of the same
+     * transaction are delivered in the order of publishing
+     */
+    class ShardedStatusBus : public StatusBus {
+     public:
+      /**
+       * @param shards - buses to route statuses to, every one is expected to
+       * deliver statuses on its own worker
+       */
+      explicit ShardedStatusBus(std::vector<std::shared_ptr<StatusBus>> shards);
+
+      /**
+       * Creates a bus with the given number of StatusBusImpl shards, each
+       * with its own thread
+       * @param shards_number - number of shards, at least 1
+       * @param make_worker - creates the worker of the given shard
+       */
+      static std::shared_ptr<ShardedStatusBus> create(
+          size_t shards_number,
+          const std::function<rxcpp::observe_on_one_worker(size_t)>
+              &make_worker = [](size_t) {
+                return rxcpp::observe_on_new_thread();
+              });
+
+      void publish(StatusBus::Objects) override;
+      /// Statuses of different shards are merged, subscribers are called
+      /// sequentially
+      rxcpp::observable<StatusBus::Objects> statuses() override;
+      /// Only the shard of the transaction is observed
+      rxcpp::observable<StatusBus::Objects> transactionStatuses(
+          const shared_model::interface::types::HashType &hash) override;
+
+     private:
+      StatusBus &shard(const shared_model::interface::types::HashType &hash);
+
+      std::vector<std::shared_ptr<StatusBus>> shards_;
+    };
+  }  // namespace torii
+}  // namespace iroha
+
+#endif  // TORII_SHARDED_STATUS_BUS
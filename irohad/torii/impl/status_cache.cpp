@@ -0,0 +1,105 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/status_cache.hpp"
+
+#include <mutex>
+
+#include "common/visitor.hpp"
+#include "interfaces/transaction_responses/tx_response_variant.hpp"
+
+namespace iroha {
+  namespace torii {
+
+    constexpr uint64_t StatusCache::kDefaultFinalBytes;
+    constexpr uint64_t StatusCache::kDefaultIntermediateBytes;
+    constexpr uint64_t StatusCache::kEntryOverhead;
+
+    StatusCache::StatusCache(uint64_t final_bytes, uint64_t intermediate_bytes)
+        : tiers_{TierCache(final_bytes), TierCache(intermediate_bytes)},
+          hits_(metrics::registry().counter(
+              "iroha_torii_status_cache_hits_total",
+              "Transaction statuses found in the status cache")),
+          misses_(metrics::registry().counter(
+              "iroha_torii_status_cache_misses_total",
+              "Transaction statuses missing in the status cache")),
+          evicted_(metrics::registry().counter(
+              "iroha_torii_status_cache_evicted_total",
+              "Transaction statuses evicted from the status cache")),
+          size_(metrics::registry().gauge(
+              "iroha_torii_status_cache_bytes",
+              "Estimated memory of statuses in the status cache")) {}
+
+    StatusCache::~StatusCache() {
+      size_.add(-static_cast<int64_t>(cacheBytes()));
+    }
+
+    void StatusCache::addItem(const shared_model::crypto::Hash &hash,
+                              const Response &response) {
+      const auto tier = tierOf(*response);
+      const auto bytes = bytesOf(*response);
+
+      std::lock_guard<std::shared_timed_mutex> lock(mutex_);
+      const auto before = cacheBytes();
+      for (size_t other = 0; other < kTiers; ++other) {
+        if (other != tier) {
+          tiers_[other].removeItem(hash);
+        }
+      }
+      evicted_.increment(tiers_[tier].addItem(hash, response, bytes));
+      size_.add(static_cast<int64_t>(cacheBytes())
+                - static_cast<int64_t>(before));
+    }
+
+    boost::optional<StatusCache::Response> StatusCache::findItem(
+        const shared_model::crypto::Hash &hash) const {
+      std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+      for (const auto &tier : tiers_) {
+        if (auto response = tier.findItem(hash)) {
+          hits_.increment();
+          return response;
+        }
+      }
+      misses_.increment();
+      return boost::none;
+    }
+
+    uint32_t StatusCache::getCacheItemCount() const {
+      std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+      return tiers_[kFinal].getCacheItemCount()
+          + tiers_[kIntermediate].getCacheItemCount();
+    }
+
+    uint64_t StatusCache::getCacheBytes() const {
+      std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+      return cacheBytes();
+    }
+
+    StatusCache::Tier StatusCache::tierOf(
+        const shared_model::interface::TransactionResponse &response) {
+      return iroha::visit_in_place(
+          response.get(),
+          [](const auto &status)
+              -> std::enable_if_t<FinalStatusValue<decltype(status)>, Tier> {
+            return kFinal;
+          },
+          [](const auto &status)
+              -> std::enable_if_t<not FinalStatusValue<decltype(status)>,
+                                  Tier> { return kIntermediate; });
+    }
+
+    uint64_t StatusCache::bytesOf(
+        const shared_model::interface::TransactionResponse &response) {
+      return kEntryOverhead + response.transactionHash().size()
+          + response.statelessErrorOrCommandName().size();
+    }
+
+    uint64_t StatusCache::cacheBytes() const {
+      return tiers_[kFinal].getCacheBytes()
+          + tiers_[kIntermediate].getCacheBytes();
+    }
+
+  }  // namespace torii
+}  // namespace iroha
@@ -0,0 +1,130 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/traffic_capture.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+
+#include <google/protobuf/message_lite.h>
+
+namespace {
+  /// starts the log, the last byte is the version of the format
+  const std::string kHeader("IRTC\x01", 5);
+
+  /// call, received time, duration and request size
+  const size_t kRecordHeaderSize = 1 + 8 + 4 + 4;
+
+  void put(std::string &out, uint64_t value, size_t bytes) {
+    for (size_t i = 0; i < bytes; ++i) {
+      out.push_back(static_cast<char>(value >> (8 * i)));
+    }
+  }
+
+  uint64_t get(const char *in, size_t bytes) {
+    uint64_t value = 0;
+    for (size_t i = 0; i < bytes; ++i) {
+      value |= uint64_t(static_cast<uint8_t>(in[i])) << (8 * i);
+    }
+    return value;
+  }
+}  // namespace
+
+namespace iroha {
+  namespace torii {
+
+    TrafficCapture::Scope::Scope(TrafficCapture *capture,
+                                 Call call,
+                                 const google::protobuf::MessageLite &request)
+        : capture_(capture), call_(call) {
+      if (capture_) {
+        received_ = Clock::now();
+        request_ = request.SerializeAsString();
+      }
+    }
+
+    TrafficCapture::Scope::~Scope() {
+      complete();
+    }
+
+    void TrafficCapture::Scope::complete() {
+      if (capture_) {
+        capture_->record(call_, received_, Clock::now(), request_);
+        capture_ = nullptr;
+      }
+    }
+
+    expected::Result<std::shared_ptr<TrafficCapture>, std::string>
+    TrafficCapture::create(const std::string &path) {
+      std::ofstream file(path, std::ios::binary | std::ios::trunc);
+      if (not file.write(kHeader.data(), kHeader.size())) {
+        return expected::makeError("Cannot create traffic capture " + path);
+      }
+      return expected::makeValue(std::shared_ptr<TrafficCapture>(
+          new TrafficCapture(std::move(file))));
+    }
+
+    expected::Result<std::vector<TrafficCapture::Record>, std::string>
+    TrafficCapture::read(const std::string &path) {
+      std::ifstream file(path, std::ios::binary);
+      std::string content((std::istreambuf_iterator<char>(file)),
+                          std::istreambuf_iterator<char>());
+      if (content.compare(0, kHeader.size(), kHeader) != 0) {
+        return expected::makeError("Not a traffic capture: " + path);
+      }
+
+      std::vector<Record> records;
+      size_t offset = kHeader.size();
+      // the last record is incomplete if the capture was interrupted
+      while (content.size() - offset >= kRecordHeaderSize) {
+        const char *header = content.data() + offset;
+        auto size = get(header + 13, 4);
+        offset += kRecordHeaderSize;
+        if (content.size() - offset < size) {
+          break;
+        }
+        auto call = get(header, 1);
+        // calls unknown to this version are skipped
+        if (call >= static_cast<uint8_t>(Call::kTransactions)
+            and call <= static_cast<uint8_t>(Call::kQueryStream)) {
+          records.push_back(
+              Record{static_cast<Call>(call),
+                     std::chrono::microseconds(get(header + 1, 8)),
+                     std::chrono::microseconds(get(header + 9, 4)),
+                     content.substr(offset, size)});
+        }
+        offset += size;
+      }
+      return expected::makeValue(std::move(records));
+    }
+
+    void TrafficCapture::record(Call call,
+                                Clock::time_point received,
+                                Clock::time_point completed,
+                                const std::string &request) {
+      using std::chrono::duration_cast;
+      using std::chrono::microseconds;
+      std::string header;
+      header.reserve(kRecordHeaderSize);
+      put(header, static_cast<uint8_t>(call), 1);
+      put(header, duration_cast<microseconds>(received - start_).count(), 8);
+      put(header,
+          std::min<uint64_t>(
+              duration_cast<microseconds>(completed - received).count(),
+              UINT32_MAX),
+          4);
+      put(header, request.size(), 4);
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      file_.write(header.data(), header.size());
+      file_.write(request.data(), request.size());
+    }
+
+    TrafficCapture::TrafficCapture(std::ofstream file)
+        : start_(Clock::now()), file_(std::move(file)) {}
+
+  }  // namespace torii
+}  // namespace iroha
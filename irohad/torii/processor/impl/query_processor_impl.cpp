@@ -5,8 +5,13 @@
 
 #include "torii/processor/query_processor_impl.hpp"
 
+#include <algorithm>
+
 #include <boost/range/size.hpp>
+#include "backend/protobuf/queries/proto_query.hpp"
+#include "backend/protobuf/query_responses/proto_query_response.hpp"
 #include "common/bind.hpp"
+#include "interfaces/iroha_internal/block.hpp"
 #include "interfaces/queries/blocks_query.hpp"
 #include "interfaces/queries/query.hpp"
 #include "interfaces/query_responses/block_query_response.hpp"
@@ -24,14 +29,24 @@ namespace iroha {
         std::shared_ptr<iroha::PendingTransactionStorage> pending_transactions,
         std::shared_ptr<shared_model::interface::QueryResponseFactory>
             response_factory,
-        logger::LoggerPtr log)
+        logger::LoggerPtr log,
+        uint64_t query_cache_bytes,
+        std::shared_ptr<WorkStealingExecutor::Lane> query_lane)
         : storage_{std::move(storage)},
           qry_exec_{std::move(qry_exec)},
           pending_transactions_{std::move(pending_transactions)},
           response_factory_{std::move(response_factory)},
-          log_{std::move(log)} {
+          query_lane_{std::move(query_lane)},
+          query_cache_(query_cache_bytes),
+          log_{std::move(log)},
+          query_time_metric_(metrics::registry().histogram(
+              "iroha_query_processing_microseconds",
+              "Time spent answering queries")),
+          memory_account_(metrics::registry(), "query") {
       storage_->on_commit().subscribe(
           [this](std::shared_ptr<const shared_model::interface::Block> block) {
+            // responses cached for previous heights are not hit anymore
+            height_ = block->height();
             auto block_response =
                 response_factory_->createBlockQueryResponse(block);
             blocks_query_subject_.get_subscriber().on_next(
@@ -39,8 +54,49 @@ namespace iroha {
           });
     }
 
+    boost::optional<std::string> QueryProcessorImpl::cacheKey(
+        const shared_model::interface::Query &qry) const {
+      auto payload =
+          static_cast<const shared_model::proto::Query &>(qry).getTransport()
+              .payload();
+      // pending transactions change without commits
+      if (payload.has_get_pending_transactions()) {
+        return boost::none;
+      }
+      payload.mutable_meta()->clear_created_time();
+      payload.mutable_meta()->clear_query_counter();
+
+      std::vector<std::string> signers;
+      for (const auto &signature : qry.signatures()) {
+        signers.push_back(signature.publicKey().hex());
+      }
+      std::sort(signers.begin(), signers.end());
+
+      auto key = std::to_string(height_.load());
+      for (const auto &signer : signers) {
+        key.append(" ").append(signer);
+      }
+      return key.append(" ").append(payload.SerializeAsString());
+    }
+
     std::unique_ptr<shared_model::interface::QueryResponse>
-    QueryProcessorImpl::queryHandle(const shared_model::interface::Query &qry) {
+    QueryProcessorImpl::fromCache(const shared_model::interface::Query &qry,
+                                  const boost::optional<std::string> &key) {
+      if (not key) {
+        return nullptr;
+      }
+      auto cached = query_cache_.findItem(*key);
+      if (not cached) {
+        return nullptr;
+      }
+      cached->set_query_hash(qry.hash().hex());
+      return std::make_unique<shared_model::proto::QueryResponse>(
+          std::move(*cached));
+    }
+
+    std::unique_ptr<shared_model::interface::QueryResponse>
+    QueryProcessorImpl::execute(const shared_model::interface::Query &qry,
+                                const boost::optional<std::string> &key) {
       auto executor = qry_exec_->createQueryExecutor(pending_transactions_,
                                                      response_factory_);
       if (not executor) {
@@ -48,23 +104,118 @@ namespace iroha {
         return nullptr;
       }
 
-      return executor.value()->validateAndExecute(qry, true);
+      auto response = executor.value()->validateAndExecute(qry, true);
+      if (key and response) {
+        const auto &transport =
+            static_cast<const shared_model::proto::QueryResponse &>(*response)
+                .getTransport();
+        // errors may be caused by the query signatures or be transient
+        if (not transport.has_error_response()) {
+          query_cache_.addItem(*key, transport);
+        }
+      }
+      return response;
+    }
+
+    std::unique_ptr<shared_model::interface::QueryResponse>
+    QueryProcessorImpl::queryHandle(const shared_model::interface::Query &qry) {
+      metrics::ScopedTimer timer(query_time_metric_);
+      metrics::MemoryScope memory_scope(memory_account_);
+      auto key = cacheKey(qry);
+      if (auto cached = fromCache(qry, key)) {
+        return cached;
+      }
+      return execute(qry, key);
+    }
+
+    void QueryProcessorImpl::queryHandleAsync(
+        std::shared_ptr<const shared_model::interface::Query> qry,
+        ResponseCallback callback) {
+      if (not query_lane_) {
+        callback(queryHandle(*qry));
+        return;
+      }
+      auto key = cacheKey(*qry);
+      if (auto cached = fromCache(*qry, key)) {
+        callback(std::move(cached));
+        return;
+      }
+      // the processor may be destroyed while the query waits in the lane
+      std::weak_ptr<QueryProcessorImpl> weak_this = shared_from_this();
+      query_lane_->post([weak_this,
+                         qry = std::move(qry),
+                         key = std::move(key),
+                         callback = std::move(callback)] {
+        auto self = weak_this.lock();
+        if (not self) {
+          callback(nullptr);
+          return;
+        }
+        metrics::ScopedTimer timer(self->query_time_metric_);
+        metrics::MemoryScope memory_scope(self->memory_account_);
+        callback(self->execute(*qry, key));
+      });
     }
 
     rxcpp::observable<
         std::shared_ptr<shared_model::interface::BlockQueryResponse>>
     QueryProcessorImpl::blocksQueryHandle(
         const shared_model::interface::BlocksQuery &qry) {
+      if (auto response = blocksQueryError(qry)) {
+        return rxcpp::observable<>::just(std::move(response));
+      }
+      return blocks_query_subject_.get_observable();
+    }
+
+    std::shared_ptr<shared_model::interface::BlockQueryResponse>
+    QueryProcessorImpl::blocksQueryError(
+        const shared_model::interface::BlocksQuery &qry) {
       auto exec = qry_exec_->createQueryExecutor(pending_transactions_,
                                                  response_factory_);
       if (not exec or not(exec | [&qry](const auto &executor) {
             return executor->validate(qry, true);
           })) {
-        std::shared_ptr<shared_model::interface::BlockQueryResponse> response =
-            response_factory_->createBlockQueryResponse("stateful invalid");
-        return rxcpp::observable<>::just(std::move(response));
+        return response_factory_->createBlockQueryResponse("stateful invalid");
       }
-      return blocks_query_subject_.get_observable();
+      return nullptr;
+    }
+
+    std::shared_ptr<shared_model::interface::BlockQueryResponse>
+    QueryProcessorImpl::committedBlock(
+        shared_model::interface::types::HeightType height) {
+      auto block_query = storage_->getBlockQuery();
+      if (not block_query) {
+        return nullptr;
+      }
+      return block_query->getBlock(height).match(
+          [this](auto &&block)
+              -> std::shared_ptr<shared_model::interface::BlockQueryResponse> {
+            return response_factory_->createBlockQueryResponse(
+                std::move(block.value));
+          },
+          [this, height](const auto &error)
+              -> std::shared_ptr<shared_model::interface::BlockQueryResponse> {
+            if (error.error.code
+                != ametsuchi::BlockQuery::GetBlockError::Code::kNoBlock) {
+              log_->error("Failed to read block {}: {}",
+                          height,
+                          error.error.message);
+            }
+            return nullptr;
+          });
+    }
+
+    boost::optional<std::vector<shared_model::interface::types::HeightType>>
+    QueryProcessorImpl::accountsBlockHeights(
+        const std::vector<shared_model::interface::types::AccountIdType>
+            &account_ids,
+        shared_model::interface::types::HeightType from,
+        size_t limit) {
+      auto block_query = storage_->getBlockQuery();
+      if (not block_query) {
+        return boost::none;
+      }
+      return block_query->getAccountsBlockHeights(account_ids, from, limit);
     }
 
   }  // namespace torii
@@ -0,0 +1,75 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/processor/query_response_cache.hpp"
+
+namespace iroha {
+  namespace torii {
+
+    constexpr uint64_t QueryResponseCache::kDefaultBytes;
+    constexpr uint64_t QueryResponseCache::kEntryOverhead;
+
+    QueryResponseCache::QueryResponseCache(uint64_t bytes)
+        : cache_(bytes),
+          hits_(metrics::registry().counter(
+              "iroha_query_cache_hits_total",
+              "Queries answered from the response cache")),
+          misses_(metrics::registry().counter(
+              "iroha_query_cache_misses_total",
+              "Queries missing in the response cache")),
+          evicted_(metrics::registry().counter(
+              "iroha_query_cache_evicted_total",
+              "Query responses evicted from the response cache")),
+          size_(metrics::registry().gauge(
+              "iroha_query_cache_bytes",
+              "Estimated memory of responses in the response cache")) {}
+
+    QueryResponseCache::~QueryResponseCache() {
+      size_.add(-static_cast<int64_t>(cache_.getCacheBytes()));
+    }
+
+    void QueryResponseCache::addItem(
+        const std::string &key,
+        const iroha::protocol::QueryResponse &response) {
+      const auto bytes = bytesOf(key, response);
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      const auto before = cache_.getCacheBytes();
+      evicted_.increment(cache_.addItem(key, response, bytes));
+      size_.add(static_cast<int64_t>(cache_.getCacheBytes())
+                - static_cast<int64_t>(before));
+    }
+
+    boost::optional<iroha::protocol::QueryResponse>
+    QueryResponseCache::findItem(const std::string &key) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto response = cache_.findItem(key);
+      if (not response) {
+        misses_.increment();
+        return boost::none;
+      }
+      hits_.increment();
+      cache_.touch(key);
+      return response;
+    }
+
+    uint32_t QueryResponseCache::getCacheItemCount() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return cache_.getCacheItemCount();
+    }
+
+    uint64_t QueryResponseCache::getCacheBytes() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return cache_.getCacheBytes();
+    }
+
+    uint64_t QueryResponseCache::bytesOf(
+        const std::string &key,
+        const iroha::protocol::QueryResponse &response) {
+      return kEntryOverhead + key.size() + response.ByteSizeLong();
+    }
+
+  }  // namespace torii
+}  // namespace iroha
@@ -5,6 +5,8 @@
 
 #include "torii/processor/transaction_processor_impl.hpp"
 
+#include <algorithm>
+
 #include <boost/format.hpp>
 
 #include "interfaces/iroha_internal/block.hpp"
@@ -12,6 +14,7 @@
 #include "interfaces/iroha_internal/transaction_batch.hpp"
 #include "interfaces/iroha_internal/transaction_sequence.hpp"
 #include "logger/logger.hpp"
+#include "tracing/transaction_tracer.hpp"
 #include "validation/stateful_validator_common.hpp"
 
 namespace iroha {
@@ -41,6 +44,18 @@ namespace iroha {
                 % cmd_error.error_code % cmd_error.error_extra)
             .str();
       }
+
+      /**
+       * Transactions with quorum 1 are complete once they pass stateless
+       * validation, so a batch of them is never kept in MST storage
+       */
+      bool hasSingleQuorum(
+          const shared_model::interface::TransactionBatch &batch) {
+        const auto &txs = batch.transactions();
+        return std::all_of(txs.begin(), txs.end(), [](const auto &tx) {
+          return tx->quorum() == 1;
+        });
+      }
     }  // namespace
 
     TransactionProcessorImpl::TransactionProcessorImpl(
@@ -51,14 +66,16 @@ namespace iroha {
             status_factory,
         rxcpp::observable<std::shared_ptr<const shared_model::interface::Block>>
             commits,
-        logger::LoggerPtr log)
+        logger::LoggerPtr log,
+        boost::optional<rxcpp::observe_on_one_worker>
+            notifications_coordination)
         : pcs_(std::move(pcs)),
           mst_processor_(std::move(mst_processor)),
           status_bus_(std::move(status_bus)),
           status_factory_(std::move(status_factory)),
           log_(std::move(log)) {
       // process stateful validation results
-      pcs_->onVerifiedProposal().subscribe(
+      auto on_verified_proposal =
           [this](const simulator::VerifiedProposalCreatorEvent &event) {
             if (not event.verified_proposal_result) {
               return;
@@ -77,28 +94,42 @@ namespace iroha {
             // notify about success txs
             for (const auto &successful_tx :
                  proposal_and_errors->verified_proposal->transactions()) {
-              log_->info("VerifiedProposalCreatorEvent StatefulValid: {}",
-                         successful_tx.hash().hex());
+              log_->info(
+                  "VerifiedProposalCreatorEvent StatefulValid: {}",
+                  logger::lazy([&] { return successful_tx.hash().hex(); }));
               this->publishStatus(TxStatusType::kStatefulValid,
                                   successful_tx.hash());
             }
-          });
+          };
 
       // commit transactions
-      commits.subscribe(
-          // on next
-          [this](auto block) {
-            for (const auto &tx : block->transactions()) {
-              const auto &hash = tx.hash();
-              log_->debug("Committed transaction: {}", hash.hex());
-              this->publishStatus(TxStatusType::kCommitted, hash);
-            }
-            for (const auto &rejected_tx_hash :
-                 block->rejected_transactions_hashes()) {
-              log_->debug("Rejected transaction: {}", rejected_tx_hash.hex());
-              this->publishStatus(TxStatusType::kRejected, rejected_tx_hash);
-            }
-          });
+      auto on_commit = [this](auto block) {
+        for (const auto &tx : block->transactions()) {
+          const auto &hash = tx.hash();
+          log_->debug("Committed transaction: {}",
+                      logger::lazy([&hash] { return hash.hex(); }));
+          this->publishStatus(TxStatusType::kCommitted, hash);
+        }
+        for (const auto &rejected_tx_hash :
+             block->rejected_transactions_hashes()) {
+          log_->debug("Rejected transaction: {}", logger::lazy([&] {
+                        return rejected_tx_hash.hex();
+                      }));
+          this->publishStatus(TxStatusType::kRejected, rejected_tx_hash);
+        }
+      };
+
+      // both streams are observed on the same worker, so statuses of a
+      // transaction keep their order
+      if (notifications_coordination) {
+        pcs_->onVerifiedProposal()
+            .observe_on(*notifications_coordination)
+            .subscribe(on_verified_proposal);
+        commits.observe_on(*notifications_coordination).subscribe(on_commit);
+      } else {
+        pcs_->onVerifiedProposal().subscribe(on_verified_proposal);
+        commits.subscribe(on_commit);
+      }
 
       mst_processor_->onStateUpdate().subscribe([this](auto &&state) {
         log_->info("MST state updated");
@@ -123,8 +154,11 @@ namespace iroha {
         std::shared_ptr<shared_model::interface::TransactionBatch>
             transaction_batch) const {
       log_->info("handle batch");
+      tracing::tracer().markAll(transaction_batch->transactions(),
+                                tracing::TransactionStage::kReceived);
       if (transaction_batch->hasAllSignatures()
-          and not mst_processor_->batchInStorage(transaction_batch)) {
+          and (hasSingleQuorum(*transaction_batch)
+               or not mst_processor_->batchInStorage(transaction_batch))) {
         log_->info("propagating batch to PCS");
         this->publishEnoughSignaturesStatus(transaction_batch->transactions());
         pcs_->propagate_batch(transaction_batch);
@@ -8,7 +8,13 @@
 
 #include <rxcpp/rx.hpp>
 
+#include <functional>
 #include <memory>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "interfaces/common_objects/types.hpp"
 
 namespace shared_model {
   namespace interface {
@@ -34,6 +40,23 @@ namespace iroha {
        */
       virtual std::unique_ptr<shared_model::interface::QueryResponse>
       queryHandle(const shared_model::interface::Query &qry) = 0;
+
+      /// receives the response to a query, nullptr if it was not executed
+      using ResponseCallback = std::function<void(
+          std::unique_ptr<shared_model::interface::QueryResponse>)>;
+
+      /**
+       * Perform client query without blocking the caller on its execution.
+       * The callback may be called on another thread or before return
+       * @param qry - client intent
+       * @param callback - receives resulted response
+       */
+      virtual void queryHandleAsync(
+          std::shared_ptr<const shared_model::interface::Query> qry,
+          ResponseCallback callback) {
+        callback(queryHandle(*qry));
+      }
+
       /**
        * Register client blocks query
        * @param query - client intent
@@ -43,6 +66,38 @@ namespace iroha {
           std::shared_ptr<shared_model::interface::BlockQueryResponse>>
       blocksQueryHandle(const shared_model::interface::BlocksQuery &qry) = 0;
 
+      /**
+       * Perform stateful validation of client blocks query
+       * @param qry - client intent
+       * @return error response if the query is invalid, nullptr otherwise
+       */
+      virtual std::shared_ptr<shared_model::interface::BlockQueryResponse>
+      blocksQueryError(const shared_model::interface::BlocksQuery &qry) = 0;
+
+      /**
+       * Get a committed block for a blocks query subscriber which catches up
+       * with the ledger
+       * @param height - height of the block
+       * @return response with the block, nullptr if there is no such block
+       */
+      virtual std::shared_ptr<shared_model::interface::BlockQueryResponse>
+      committedBlock(shared_model::interface::types::HeightType height) = 0;
+
+      /**
+       * Get heights of committed blocks with transactions of the accounts
+       * @param account_ids - accounts
+       * @param from - the least height
+       * @param limit - maximum number of heights
+       * @return heights in ascending order, none if they are not known
+       */
+      virtual boost::optional<
+          std::vector<shared_model::interface::types::HeightType>>
+      accountsBlockHeights(
+          const std::vector<shared_model::interface::types::AccountIdType>
+              &account_ids,
+          shared_model::interface::types::HeightType from,
+          size_t limit) = 0;
+
       virtual ~QueryProcessor(){};
     };
   }  // namespace torii
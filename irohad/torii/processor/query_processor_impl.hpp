@@ -6,18 +6,32 @@
 #ifndef IROHA_QUERY_PROCESSOR_IMPL_HPP
 #define IROHA_QUERY_PROCESSOR_IMPL_HPP
 
+#include <atomic>
+
 #include "ametsuchi/storage.hpp"
+#include "common/work_stealing_executor.hpp"
+#include "interfaces/common_objects/types.hpp"
 #include "interfaces/iroha_internal/query_response_factory.hpp"
 #include "logger/logger_fwd.hpp"
+#include "metrics/memory_accounting.hpp"
+#include "metrics/metrics.hpp"
 #include "torii/processor/query_processor.hpp"
+#include "torii/processor/query_response_cache.hpp"
 
 namespace iroha {
   namespace torii {
 
     /**
-     * QueryProcessorImpl provides implementation of QueryProcessor
+     * QueryProcessorImpl provides implementation of QueryProcessor.
+     * Responses to queries are cached until the next commit, so identical
+     * queries of the same creator signed by the same keys are executed once
+     * per ledger height, as long as the responses fit the memory budget of
+     * the cache. Asynchronous queries missing the cache are executed
+     * on the query lane, if it is given
      */
-    class QueryProcessorImpl : public QueryProcessor {
+    class QueryProcessorImpl
+        : public QueryProcessor,
+          public std::enable_shared_from_this<QueryProcessorImpl> {
      public:
       QueryProcessorImpl(
           std::shared_ptr<ametsuchi::Storage> storage,
@@ -26,17 +40,56 @@ namespace iroha {
               pending_transactions,
           std::shared_ptr<shared_model::interface::QueryResponseFactory>
               response_factory,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          uint64_t query_cache_bytes = QueryResponseCache::kDefaultBytes,
+          std::shared_ptr<WorkStealingExecutor::Lane> query_lane = nullptr);
 
       std::unique_ptr<shared_model::interface::QueryResponse> queryHandle(
           const shared_model::interface::Query &qry) override;
 
+      void queryHandleAsync(
+          std::shared_ptr<const shared_model::interface::Query> qry,
+          ResponseCallback callback) override;
+
       rxcpp::observable<
           std::shared_ptr<shared_model::interface::BlockQueryResponse>>
       blocksQueryHandle(
           const shared_model::interface::BlocksQuery &qry) override;
 
+      std::shared_ptr<shared_model::interface::BlockQueryResponse>
+      blocksQueryError(
+          const shared_model::interface::BlocksQuery &qry) override;
+
+      std::shared_ptr<shared_model::interface::BlockQueryResponse>
+      committedBlock(
+          shared_model::interface::types::HeightType height) override;
+
+      boost::optional<std::vector<shared_model::interface::types::HeightType>>
+      accountsBlockHeights(
+          const std::vector<shared_model::interface::types::AccountIdType>
+              &account_ids,
+          shared_model::interface::types::HeightType from,
+          size_t limit) override;
+
      private:
+      /**
+       * @return key of query response in cache, which consists of ledger
+       * height, query signers and query payload without fields that do not
+       * affect the result, none if response to query must not be cached
+       */
+      boost::optional<std::string> cacheKey(
+          const shared_model::interface::Query &qry) const;
+
+      /// @return cached response to the query with the given key, if any
+      std::unique_ptr<shared_model::interface::QueryResponse> fromCache(
+          const shared_model::interface::Query &qry,
+          const boost::optional<std::string> &key);
+
+      /// execute the query and cache the response with the given key
+      std::unique_ptr<shared_model::interface::QueryResponse> execute(
+          const shared_model::interface::Query &qry,
+          const boost::optional<std::string> &key);
+
       rxcpp::subjects::subject<
           std::shared_ptr<shared_model::interface::BlockQueryResponse>>
           blocks_query_subject_;
@@ -45,8 +98,19 @@ namespace iroha {
       std::shared_ptr<iroha::PendingTransactionStorage> pending_transactions_;
       std::shared_ptr<shared_model::interface::QueryResponseFactory>
           response_factory_;
+      std::shared_ptr<WorkStealingExecutor::Lane> query_lane_;
+
+      /// height of the last committed block
+      std::atomic<shared_model::interface::types::HeightType> height_{0};
+
+      /// responses are stored in transport form to be returned with hash of
+      /// the query which hits the cache
+      QueryResponseCache query_cache_;
 
       logger::LoggerPtr log_;
+
+      metrics::Histogram &query_time_metric_;
+      metrics::MemoryAccount memory_account_;
     };
 
   }  // namespace torii
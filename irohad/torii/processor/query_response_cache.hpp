@@ -0,0 +1,81 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_QUERY_RESPONSE_CACHE_HPP
+#define IROHA_QUERY_RESPONSE_CACHE_HPP
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+#include <boost/optional.hpp>
+#include "cache/byte_bounded_cache.hpp"
+#include "metrics/metrics.hpp"
+#include "qry_responses.pb.h"
+
+namespace iroha {
+  namespace torii {
+
+    /**
+     * Cache of query responses, bounded by the estimated memory of the
+     * responses rather than their number, since a response to a single query
+     * may hold a page of transactions or the whole details of an account.
+     * Least recently used responses are evicted first, and a response
+     * larger than the whole budget is not cached
+     */
+    class QueryResponseCache {
+     public:
+      /// default budget of responses in bytes
+      static constexpr uint64_t kDefaultBytes = 32ull << 20;
+
+      /// estimated memory of a response apart from its key and serialized
+      /// message, including the cache bookkeeping
+      static constexpr uint64_t kEntryOverhead = 256;
+
+      /// @param bytes - budget of responses in bytes
+      explicit QueryResponseCache(uint64_t bytes = kDefaultBytes);
+
+      ~QueryResponseCache();
+
+      /**
+       * Put the response, replacing the previous one with the same key
+       * @param key - key of the query
+       * @param response - response to the query
+       */
+      void addItem(const std::string &key,
+                   const iroha::protocol::QueryResponse &response);
+
+      /**
+       * @param key - key of the query
+       * @return copy of the response, none if it is not cached
+       */
+      boost::optional<iroha::protocol::QueryResponse> findItem(
+          const std::string &key);
+
+      /// @return number of cached responses
+      uint32_t getCacheItemCount() const;
+
+      /// @return estimated memory of cached responses in bytes
+      uint64_t getCacheBytes() const;
+
+     private:
+      /// @return estimated memory of the response
+      static uint64_t bytesOf(const std::string &key,
+                              const iroha::protocol::QueryResponse &response);
+
+      mutable std::mutex mutex_;
+      cache::ByteBoundedCache<std::string, iroha::protocol::QueryResponse>
+          cache_;
+
+      metrics::Counter &hits_;
+      metrics::Counter &misses_;
+      metrics::Counter &evicted_;
+      metrics::Gauge &size_;
+    };
+
+  }  // namespace torii
+}  // namespace iroha
+
+#endif  // IROHA_QUERY_RESPONSE_CACHE_HPP
@@ -10,6 +10,7 @@
 
 #include <mutex>
 
+#include <boost/optional.hpp>
 #include <rxcpp/rx.hpp>
 #include "interfaces/common_objects/transaction_sequence_common.hpp"
 #include "interfaces/iroha_internal/tx_status_factory.hpp"
@@ -30,6 +31,9 @@ namespace iroha {
        * @param status_factory creates transaction statuses
        * @param commits - an observable on committed blocks
        * @param log to print the progress
+       * @param notifications_coordination - if set, statuses of verified
+       * proposals and commits are published on its worker instead of the
+       * thread which emits them, so consensus does not wait for publishing
        */
       TransactionProcessorImpl(
           std::shared_ptr<network::PeerCommunicationService> pcs,
@@ -39,7 +43,9 @@ namespace iroha {
               status_factory,
           rxcpp::observable<
               std::shared_ptr<const shared_model::interface::Block>> commits,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          boost::optional<rxcpp::observe_on_one_worker>
+              notifications_coordination = boost::none);
 
       void batchHandle(
           std::shared_ptr<shared_model::interface::TransactionBatch>
@@ -35,9 +35,38 @@ namespace torii_utils {
     grpc::Status Find(const iroha::protocol::Query &query,
                       iroha::protocol::QueryResponse &response) const;
 
+    /**
+     * requests query to a torii server and returns responses for all pages
+     * of the query result (blocking, sync)
+     * @param query - contains Query what clients request.
+     * @return responses in the order they were received
+     */
+    std::vector<iroha::protocol::QueryResponse> FindStream(
+        const iroha::protocol::Query &query) const;
+
     std::vector<iroha::protocol::BlockQueryResponse> FetchCommits(
         const iroha::protocol::BlocksQuery &blocks_query) const;
 
+    /**
+     * submits query to be executed in the background by a torii server
+     * @param query - contains Query what clients request.
+     * @param response - identifier of the job, or the error response
+     * @return grpc::Status
+     */
+    grpc::Status SubmitQueryJob(
+        const iroha::protocol::Query &query,
+        iroha::protocol::QueryJobResponse &response) const;
+
+    /**
+     * takes responses of a submitted query executed so far
+     * @param job_id - identifier returned by SubmitQueryJob
+     * @param response - responses of the executed pages
+     * @return grpc::Status
+     */
+    grpc::Status FetchQueryJob(
+        const std::string &job_id,
+        iroha::protocol::QueryJobResponse &response) const;
+
    private:
     void swap(QuerySyncClient &lhs, QuerySyncClient &rhs);
 
@@ -0,0 +1,136 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef TORII_QUERY_JOBS_HPP
+#define TORII_QUERY_JOBS_HPP
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/optional.hpp>
+#include "common/work_stealing_executor.hpp"
+#include "logger/logger_fwd.hpp"
+#include "qry_responses.pb.h"
+
+namespace iroha {
+
+  class TimerWheel;
+
+  namespace torii {
+
+    /**
+     * Heavy queries executed in the background, so that a client reading
+     * years of history holds neither a gRPC thread nor a database session
+     * while it waits. A submitted job is known by an identifier, executes its
+     * query page by page and buffers the responses until the client fetches
+     * them, pausing while the buffer is full. Jobs execute one page at a time
+     * on a lane of their own, and a page is postponed while interactive
+     * queries wait for execution, so jobs only take the capacity interactive
+     * queries leave
+     */
+    class QueryJobs : public std::enable_shared_from_this<QueryJobs> {
+     public:
+      using Clock = std::chrono::steady_clock;
+
+      /// executes the next page of a job, none once the query is done
+      using NextPage =
+          std::function<boost::optional<iroha::protocol::QueryResponse>()>;
+
+      /// responses a job buffers before it pauses until they are fetched
+      static constexpr size_t kMaxBufferedPages = 16;
+
+      /// jobs which are not fetched for this time are dropped
+      static constexpr std::chrono::minutes kRetention{10};
+
+      /// delay of a page postponed for interactive queries
+      static constexpr std::chrono::milliseconds kYieldDelay{10};
+
+      /// responses taken from a job
+      struct Fetched {
+        std::vector<iroha::protocol::QueryResponse> responses;
+        /// the job is done and all its responses are taken
+        bool finished;
+      };
+
+      /**
+       * @param max_jobs - maximal number of jobs held at once, running or
+       * waiting for their responses to be fetched
+       * @param executor - executor of the pages
+       * @param interactive_lane - lane of interactive queries which take
+       * precedence over the jobs, may be null
+       * @param timer_wheel - timer of postponed pages
+       * @param log - logger
+       */
+      QueryJobs(size_t max_jobs,
+                WorkStealingExecutor &executor,
+                std::shared_ptr<WorkStealingExecutor::Lane> interactive_lane,
+                std::shared_ptr<TimerWheel> timer_wheel,
+                logger::LoggerPtr log);
+
+      /**
+       * Start a job
+       * @param next_page - executes the pages of the query one by one
+       * @return identifier of the job, none if max_jobs jobs are held
+       */
+      boost::optional<std::string> submit(NextPage next_page);
+
+      /**
+       * Take the responses buffered by a job, a finished job is forgotten
+       * once they are taken
+       * @param job_id - identifier returned by submit
+       * @return the responses, none if there is no such job
+       */
+      boost::optional<Fetched> fetch(const std::string &job_id);
+
+     private:
+      struct Job {
+        explicit Job(NextPage next_page) : next_page(std::move(next_page)) {}
+
+        /// called by a single page task at a time
+        NextPage next_page;
+        std::deque<iroha::protocol::QueryResponse> responses;
+        /// a page is executed, queued or postponed
+        bool running{true};
+        bool finished{false};
+        /// the job is forgotten, its pages are not executed anymore
+        bool dropped{false};
+        Clock::time_point fetched{Clock::now()};
+      };
+
+      /// queue the next page of the job
+      void post(std::shared_ptr<Job> job);
+
+      /// execute the next page of the job, or postpone it
+      void runPage(const std::shared_ptr<Job> &job);
+
+      /// forget the jobs which are not fetched in time, must be called
+      /// under the lock
+      void dropExpired();
+
+      /// @return identifier which is not guessed by other clients
+      std::string makeId();
+
+      const size_t max_jobs_;
+      std::shared_ptr<WorkStealingExecutor::Lane> lane_;
+      std::shared_ptr<WorkStealingExecutor::Lane> interactive_lane_;
+      std::shared_ptr<TimerWheel> timer_wheel_;
+      logger::LoggerPtr log_;
+
+      std::mutex mutex_;
+      std::unordered_map<std::string, std::shared_ptr<Job>> jobs_;
+      std::random_device random_;
+    };
+
+  }  // namespace torii
+}  // namespace iroha
+
+#endif  // TORII_QUERY_JOBS_HPP
@@ -16,7 +16,9 @@
 #include "builders/protobuf/transport_builder.hpp"
 #include "cache/cache.hpp"
 #include "logger/logger_fwd.hpp"
+#include "torii/block_filter.hpp"
 #include "torii/processor/query_processor.hpp"
+#include "torii/traffic_capture.hpp"
 
 namespace shared_model {
   namespace interface {
@@ -27,6 +29,8 @@ namespace shared_model {
 
 namespace iroha {
   namespace torii {
+    class QueryJobs;
+
     /**
      * Actual implementation of async QueryService.
      * ToriiServiceHandler::(SomeMethod)Handler calls a corresponding method in
@@ -47,7 +51,9 @@ namespace iroha {
           std::shared_ptr<iroha::torii::QueryProcessor> query_processor,
           std::shared_ptr<QueryFactoryType> query_factory,
           std::shared_ptr<BlocksQueryFactoryType> blocks_query_factory,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          std::shared_ptr<TrafficCapture> traffic_capture = nullptr,
+          std::shared_ptr<QueryJobs> query_jobs = nullptr);
 
       QueryService(const QueryService &) = delete;
       QueryService &operator=(const QueryService &) = delete;
@@ -64,13 +70,122 @@ namespace iroha {
                         const iroha::protocol::Query *request,
                         iroha::protocol::QueryResponse *response) override;
 
+      /// receives the status of the call and the response to a query
+      using FindCallback = std::function<void(
+          grpc::Status, const iroha::protocol::QueryResponse &)>;
+
+      /**
+       * Find which does not block the caller while the query is executed
+       * @param request - Query
+       * @param respond - receives the response, may be called on another
+       * thread or before return
+       */
+      void FindAsync(iroha::protocol::Query const &request,
+                     FindCallback respond);
+
+      /// sends a response to client, returns false if stream must be stopped
+      using ResponseWriter =
+          std::function<bool(const iroha::protocol::QueryResponse &)>;
+
+      /// page size for paginated queries without pagination in FindStream
+      static constexpr uint32_t kDefaultStreamPageSize = 100;
+
+      /**
+       * actual implementation of FindStream in QueryService. Paginated
+       * queries are executed page by page, every next page starts from the
+       * cursor returned with the previous one. Other queries produce a single
+       * response
+       * @param request - Query
+       * @param write - function sending responses
+       */
+      void FindStream(iroha::protocol::Query const &request,
+                      const ResponseWriter &write);
+
+      grpc::Status FindStream(
+          grpc::ServerContext *context,
+          const iroha::protocol::Query *request,
+          grpc::ServerWriter<iroha::protocol::QueryResponse> *writer) override;
+
       grpc::Status FetchCommits(
           grpc::ServerContext *context,
           const iroha::protocol::BlocksQuery *request,
           grpc::ServerWriter<::iroha::protocol::BlockQueryResponse> *writer)
           override;
 
+      /**
+       * Start a job executing the query in the background page by page, the
+       * way FindStream does
+       * @param context - call context
+       * @param request - Query
+       * @param response - identifier of the job, or the error response to a
+       * query which is not executed
+       * @return status, UNIMPLEMENTED if jobs are disabled and
+       * RESOURCE_EXHAUSTED if too many jobs are held
+       */
+      grpc::Status SubmitQueryJob(
+          grpc::ServerContext *context,
+          const iroha::protocol::Query *request,
+          iroha::protocol::QueryJobResponse *response) override;
+
+      /**
+       * Take the responses of a job executed so far
+       * @param context - call context
+       * @param request - identifier of the job
+       * @param response - responses to the executed pages
+       * @return status, NOT_FOUND if there is no such job
+       */
+      grpc::Status FetchQueryJob(
+          grpc::ServerContext *context,
+          const iroha::protocol::QueryJobRequest *request,
+          iroha::protocol::QueryJobResponse *response) override;
+
+      /**
+       * Validate blocks query before its creator is subscribed to blocks
+       * @param request - BlocksQuery
+       * @return error response if the query is invalid, none otherwise
+       */
+      boost::optional<iroha::protocol::BlockQueryResponse> checkBlocksQuery(
+          const iroha::protocol::BlocksQuery &request);
+
+      /**
+       * Get a committed block for a FetchCommits subscriber which catches up
+       * with the ledger
+       * @param height - height of the block
+       * @return response with the block, none if there is no such block
+       */
+      boost::optional<iroha::protocol::BlockQueryResponse> committedBlock(
+          shared_model::interface::types::HeightType height);
+
+      /**
+       * Get the next committed block with transactions matching the filter,
+       * the whole block if the filter is empty.
+       * Blocks are looked up in the index of accounts when the filter has
+       * them, and read one by one otherwise
+       * @param height - height to start from, set past the returned block
+       * @param filter - filter of transactions
+       * @return filtered block response, none if there is no such block
+       */
+      boost::optional<iroha::protocol::BlockQueryResponse> nextCommittedBlock(
+          shared_model::interface::types::HeightType &height,
+          const BlockFilter &filter);
+
      private:
+      /// fills response with stateless validation error for query with hash
+      static void statelessInvalid(const shared_model::crypto::Hash &hash,
+                                   std::string message,
+                                   iroha::protocol::QueryResponse &response);
+
+      /**
+       * Check that the query is neither replayed nor stateless invalid, and
+       * remember it as processed
+       * @param response - filled with the error if the query is rejected
+       * @return built query to be executed, nullptr if it is rejected
+       */
+      std::unique_ptr<shared_model::interface::Query> accepted(
+          const iroha::protocol::Query &request,
+          const shared_model::crypto::Hash &hash,
+          iroha::protocol::QueryResponse &response);
+
       std::shared_ptr<iroha::torii::QueryProcessor> query_processor_;
       std::shared_ptr<QueryFactoryType> query_factory_;
       std::shared_ptr<BlocksQueryFactoryType> blocks_query_factory_;
@@ -82,6 +197,8 @@ namespace iroha {
           cache_;
 
       logger::LoggerPtr log_;
+      std::shared_ptr<TrafficCapture> traffic_capture_;
+      std::shared_ptr<QueryJobs> query_jobs_;
     };
   }  // namespace torii
 }  // namespace iroha
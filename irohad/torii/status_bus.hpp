@@ -7,6 +7,7 @@
 #define TORII_STATUS_BUS
 
 #include <rxcpp/rx.hpp>
+#include "cryptography/hash.hpp"
 #include "interfaces/transaction_responses/tx_response.hpp"
 
 namespace iroha {
@@ -33,6 +34,17 @@ namespace iroha {
        * @return observable over objects in bus
        */
       virtual rxcpp::observable<Objects> statuses() = 0;
+
+      /**
+       * @param hash - hash of the transaction
+       * @return observable over objects in bus related to the transaction
+       */
+      virtual rxcpp::observable<Objects> transactionStatuses(
+          const shared_model::interface::types::HashType &hash) {
+        return statuses().filter([hash](const auto &response) {
+          return response->transactionHash() == hash;
+        });
+      }
     };
   }  // namespace torii
 }  // namespace iroha
@@ -0,0 +1,138 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef TORII_STATUS_CACHE_HPP
+#define TORII_STATUS_CACHE_HPP
+
+#include <cstdint>
+#include <memory>
+#include <shared_mutex>
+#include <type_traits>
+
+#include <boost/optional.hpp>
+#include "cache/byte_bounded_cache.hpp"
+#include "common/is_any.hpp"
+#include "cryptography/hash.hpp"
+#include "interfaces/transaction_responses/tx_response.hpp"
+#include "metrics/metrics.hpp"
+
+namespace iroha {
+  namespace torii {
+
+    /**
+     * Statuses considered final for streaming. Observable stops value emission
+     * after receiving a value of one of the following types
+     * @tparam T concrete response type
+     *
+     * StatefulFailedTxResponse and MstExpiredResponse were removed from the
+     * list of final statuses.
+     *
+     * StatefulFailedTxResponse is not a final status because the node might be
+     * in non-synchronized state and the transaction may be stateful valid from
+     * the viewpoint of up to date nodes.
+     *
+     * MstExpiredResponse is not a final status in general case because it will
+     * depend on MST expiration timeout. The transaction might expire in MST,
+     * but remain valid in terms of Iroha validation rules. Thus, it may be
+     * resent and committed successfully. As the result the final status may
+     * differ from MstExpiredResponse.
+     */
+    template <typename T>
+    constexpr bool FinalStatusValue =
+        iroha::is_any<std::decay_t<T>,
+                      shared_model::interface::StatelessFailedTxResponse,
+                      shared_model::interface::CommittedTxResponse,
+                      shared_model::interface::RejectedTxResponse>::value;
+
+    /**
+     * Cache of the last statuses of transactions, bounded by the estimated
+     * memory of the statuses rather than their number, since rejection
+     * messages may be arbitrarily long. Final and intermediate statuses are
+     * kept in separate tiers with budgets of their own, so a burst of
+     * transactions in flight does not evict the final statuses clients poll
+     * for, which would otherwise be looked up in the ledger. Every tier
+     * evicts its oldest statuses first, and a status moves to the final tier
+     * when the transaction gets a final one. A status larger than the budget
+     * of its tier is not cached
+     */
+    class StatusCache {
+     public:
+      using Response =
+          std::shared_ptr<shared_model::interface::TransactionResponse>;
+
+      /// default budget of final statuses in bytes
+      static constexpr uint64_t kDefaultFinalBytes = 48ull << 20;
+
+      /// default budget of intermediate statuses in bytes
+      static constexpr uint64_t kDefaultIntermediateBytes = 16ull << 20;
+
+      /// estimated memory of a status apart from its error message,
+      /// including the hash and the cache bookkeeping
+      static constexpr uint64_t kEntryOverhead = 256;
+
+      /**
+       * @param final_bytes - budget of final statuses in bytes
+       * @param intermediate_bytes - budget of intermediate statuses in bytes
+       */
+      explicit StatusCache(
+          uint64_t final_bytes = kDefaultFinalBytes,
+          uint64_t intermediate_bytes = kDefaultIntermediateBytes);
+
+      ~StatusCache();
+
+      /**
+       * Put the status of the transaction, replacing the previous one
+       * @param hash - hash of the transaction
+       * @param response - its status
+       */
+      void addItem(const shared_model::crypto::Hash &hash,
+                   const Response &response);
+
+      /**
+       * @param hash - hash of the transaction
+       * @return its last status, none if it is not cached
+       */
+      boost::optional<Response> findItem(
+          const shared_model::crypto::Hash &hash) const;
+
+      /// @return number of cached statuses
+      uint32_t getCacheItemCount() const;
+
+      /// @return estimated memory of cached statuses in bytes
+      uint64_t getCacheBytes() const;
+
+     private:
+      enum Tier { kFinal, kIntermediate, kTiers };
+
+      using TierCache =
+          cache::ByteBoundedCache<shared_model::crypto::Hash,
+                                  Response,
+                                  shared_model::crypto::Hash::Hasher>;
+
+      /// @return tier of the status
+      static Tier tierOf(const shared_model::interface::TransactionResponse
+                             &response);
+
+      /// @return estimated memory of the status
+      static uint64_t bytesOf(const shared_model::interface::TransactionResponse
+                                  &response);
+
+      /// @return estimated memory of statuses of all tiers
+      uint64_t cacheBytes() const;
+
+      mutable std::shared_timed_mutex mutex_;
+      /// statuses of every tier, a status is cached in one tier at most
+      TierCache tiers_[kTiers];
+
+      metrics::Counter &hits_;
+      metrics::Counter &misses_;
+      metrics::Counter &evicted_;
+      metrics::Gauge &size_;
+    };
+
+  }  // namespace torii
+}  // namespace iroha
+
+#endif  // TORII_STATUS_CACHE_HPP
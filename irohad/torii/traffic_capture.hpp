@@ -0,0 +1,118 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef TORII_TRAFFIC_CAPTURE_HPP
+#define TORII_TRAFFIC_CAPTURE_HPP
+
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/result.hpp"
+
+namespace google {
+  namespace protobuf {
+    class MessageLite;
+  }
+}  // namespace google
+
+namespace iroha {
+  namespace torii {
+
+    /**
+     * Log of requests received by torii, which may be replayed against a
+     * test network. The log is binary: a header followed by a record per
+     * call, each holding the kind of the call, the time it was received
+     * since the start of the capture, the time it was handled and the
+     * serialized request, integers being little-endian
+     */
+    class TrafficCapture {
+     public:
+      using Clock = std::chrono::steady_clock;
+
+      /// calls of torii which are captured
+      enum class Call : uint8_t {
+        /// ListTorii, Torii calls are recorded as lists of one transaction
+        kTransactions = 1,
+        /// Find
+        kQuery = 2,
+        /// FindStream
+        kQueryStream = 3,
+      };
+
+      struct Record {
+        Call call;
+        /// time since the start of the capture
+        std::chrono::microseconds received;
+        /// time torii took to handle the call
+        std::chrono::microseconds duration;
+        /// serialized request
+        std::string request;
+      };
+
+      /**
+       * Records the call when it is completed or destroyed, does nothing if
+       * there is no capture
+       */
+      class Scope {
+       public:
+        Scope(TrafficCapture *capture,
+              Call call,
+              const google::protobuf::MessageLite &request);
+
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+        ~Scope();
+
+        /// Record the call, if it has not been recorded yet
+        void complete();
+
+       private:
+        TrafficCapture *capture_;
+        Call call_;
+        Clock::time_point received_;
+        std::string request_;
+      };
+
+      /**
+       * Create a log, an existing file is overwritten
+       * @param path - path of the log file
+       * @return the capture or the error message
+       */
+      static expected::Result<std::shared_ptr<TrafficCapture>, std::string>
+      create(const std::string &path);
+
+      /**
+       * Read the records of a log, the incomplete last record of an
+       * interrupted capture is skipped
+       * @param path - path of the log file
+       * @return the records in the order they were completed or the error
+       * message
+       */
+      static expected::Result<std::vector<Record>, std::string> read(
+          const std::string &path);
+
+      /// Append a record of the call to the log
+      void record(Call call,
+                  Clock::time_point received,
+                  Clock::time_point completed,
+                  const std::string &request);
+
+     private:
+      explicit TrafficCapture(std::ofstream file);
+
+      const Clock::time_point start_;
+      std::mutex mutex_;
+      std::ofstream file_;
+    };
+
+  }  // namespace torii
+}  // namespace iroha
+
+#endif  // TORII_TRAFFIC_CAPTURE_HPP
@@ -0,0 +1,221 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "tracing/transaction_tracer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+
+#include "common/hexutils.hpp"
+#include "logger/logger.hpp"
+#include "metrics/metrics.hpp"
+
+namespace {
+  using iroha::tracing::TransactionStage;
+
+  /// more unfinished traces are not started
+  constexpr size_t kMaxTraces = 10000;
+  /// unfinished traces older than that are dropped when there are too many
+  constexpr uint64_t kTraceTimeoutNs = 10ull * 60 * 1000 * 1000 * 1000;
+
+  /// names of the spans ending at every stage
+  constexpr const char *kSpanNames[] = {nullptr,
+                                        "ordering",
+                                        "validation",
+                                        "block_creation",
+                                        "consensus",
+                                        "commit",
+                                        "validation"};
+
+  uint64_t nowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+  }
+
+  /// @return first 8 bytes of the hash
+  uint64_t hashPrefix(const shared_model::crypto::Hash &hash) {
+    const auto &bytes = hash.blob();
+    uint64_t prefix = 0;
+    for (size_t i = 0; i < sizeof(prefix) and i < bytes.size(); ++i) {
+      prefix = prefix << 8 | bytes[i];
+    }
+    return prefix;
+  }
+
+  std::string hex(uint64_t value) {
+    std::string bytes(sizeof(value), '\0');
+    for (size_t i = 0; i < sizeof(value); ++i) {
+      bytes[i] = static_cast<char>(value >> (8 * (sizeof(value) - 1 - i)));
+    }
+    return iroha::bytestringToHexstring(bytes);
+  }
+
+  void appendSpan(std::string &json,
+                  const std::string &trace_id,
+                  const std::string &span_id,
+                  const std::string &parent_span_id,
+                  const char *name,
+                  uint64_t start,
+                  uint64_t end,
+                  bool ok) {
+    if (not json.empty() and json.back() == '}') {
+      json += ',';
+    }
+    json += R"({"traceId":")" + trace_id + R"(","spanId":")" + span_id + '"';
+    if (not parent_span_id.empty()) {
+      json += R"(,"parentSpanId":")" + parent_span_id + '"';
+    }
+    json += R"(,"name":")" + std::string(name)
+        + R"(","kind":1,"startTimeUnixNano":")" + std::to_string(start)
+        + R"(","endTimeUnixNano":")" + std::to_string(end)
+        + R"(","status":{"code":)" + (ok ? "1" : "2") + "}}";
+  }
+}  // namespace
+
+namespace iroha {
+  namespace tracing {
+
+    constexpr size_t TransactionTracer::kStages;
+
+    TransactionTracer::TransactionTracer()
+        : sample_interval_(0), span_salt_(std::random_device{}()) {}
+
+    void TransactionTracer::configure(uint32_t sample_interval,
+                                      const std::string &output_path,
+                                      logger::LoggerPtr log) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      log_ = std::move(log);
+      traces_.clear();
+      if (output_.is_open()) {
+        output_.close();
+      }
+      if (sample_interval != 0 and not output_path.empty()) {
+        output_.open(output_path, std::ios::app);
+        if (not output_) {
+          log_->error("Cannot open '{}', traces are not written", output_path);
+        }
+      }
+      sample_interval_ = sample_interval;
+    }
+
+    bool TransactionTracer::sampled(
+        const shared_model::crypto::Hash &hash) const {
+      auto interval = sample_interval_.load(std::memory_order_relaxed);
+      return interval != 0 and hashPrefix(hash) % interval == 0;
+    }
+
+    void TransactionTracer::mark(const shared_model::crypto::Hash &hash,
+                                 TransactionStage stage) {
+      if (not sampled(hash)) {
+        return;
+      }
+      auto now = nowNs();
+      auto finished = stage == TransactionStage::kCommitted
+          or stage == TransactionStage::kRejected;
+
+      Trace trace;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = traces_.find(hash);
+        if (it == traces_.end()) {
+          // only the stages seen by this peer are reported
+          if (finished) {
+            return;
+          }
+          if (traces_.size() >= kMaxTraces) {
+            for (auto stale = traces_.begin(); stale != traces_.end();) {
+              auto last = *std::max_element(stale->second.times.begin(),
+                                            stale->second.times.end());
+              stale = last + kTraceTimeoutNs < now ? traces_.erase(stale)
+                                                   : std::next(stale);
+            }
+            if (traces_.size() >= kMaxTraces) {
+              return;
+            }
+          }
+          it = traces_.emplace(hash, Trace{}).first;
+        }
+        it->second.times[static_cast<size_t>(stage)] = now;
+        if (not finished) {
+          return;
+        }
+        trace = it->second;
+        traces_.erase(it);
+      }
+      finish(hash, trace);
+    }
+
+    void TransactionTracer::finish(const shared_model::crypto::Hash &hash,
+                                   const Trace &trace) {
+      constexpr auto kRejected = static_cast<size_t>(TransactionStage::kRejected);
+      auto ok = trace.times[kRejected] == 0;
+      auto trace_id = hash.hex().substr(0, 32);
+      auto root_span_id = hex(hashPrefix(hash) ^ span_salt_);
+
+      std::string spans;
+      uint64_t start = 0, end = 0, previous = 0;
+      for (size_t stage = 0; stage < kStages; ++stage) {
+        auto time = trace.times[stage];
+        if (time == 0) {
+          continue;
+        }
+        if (start == 0) {
+          start = time;
+        }
+        end = std::max(end, time);
+        if (previous != 0 and time >= previous) {
+          const auto name = kSpanNames[stage];
+          metrics::registry()
+              .histogram(std::string("iroha_transaction_") + name
+                             + "_microseconds",
+                         std::string("Time transactions spend in ") + name)
+              .record((time - previous) / 1000);
+          appendSpan(spans,
+                     trace_id,
+                     hex(hashPrefix(hash) ^ (span_salt_ + stage + 1)),
+                     root_span_id,
+                     name,
+                     previous,
+                     time,
+                     stage != kRejected);
+        }
+        previous = time;
+      }
+      if (ok) {
+        metrics::registry()
+            .histogram("iroha_transaction_total_microseconds",
+                       "Time committed transactions spend in the pipeline")
+            .record((end - start) / 1000);
+      }
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (not output_.is_open()) {
+        return;
+      }
+      std::string json =
+          R"({"resourceSpans":[{"resource":{"attributes":[{"key":)"
+          R"("service.name","value":{"stringValue":"irohad"}}]},)"
+          R"("scopeSpans":[{"scope":{"name":"iroha.transaction"},"spans":[)";
+      appendSpan(
+          json, trace_id, root_span_id, "", "transaction", start, end, ok);
+      if (not spans.empty()) {
+        json += ',' + spans;
+      }
+      json += "]}]}]}\n";
+      output_ << json << std::flush;
+      if (not output_) {
+        log_->error("Failed to write trace of {}", hash.hex());
+      }
+    }
+
+    TransactionTracer &tracer() {
+      static TransactionTracer tracer;
+      return tracer;
+    }
+
+  }  // namespace tracing
+}  // namespace iroha
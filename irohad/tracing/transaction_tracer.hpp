@@ -0,0 +1,128 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_TRANSACTION_TRACER_HPP
+#define IROHA_TRANSACTION_TRACER_HPP
+
+#include <array>
+#include <atomic>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "cryptography/hash.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace tracing {
+
+    /// points of the transaction pipeline where the time is recorded
+    enum class TransactionStage {
+      /// the transaction is received by torii
+      kReceived,
+      /// a proposal with the transaction is received by the simulator
+      kProposed,
+      /// the proposal passed stateful validation
+      kValidated,
+      /// the block with the transaction is created
+      kBlockCreated,
+      /// the peers agreed on the block with the transaction
+      kAgreed,
+      /// the block with the transaction is committed, the trace is finished
+      kCommitted,
+      /// the transaction failed stateful validation, the trace is finished
+      kRejected,
+    };
+
+    /**
+     * Records the time when sampled transactions pass the pipeline stages.
+     * Transactions are sampled by their hash, so all peers trace the same
+     * transactions. When a trace is finished, the time between stages is
+     * reported to the metrics registry and the trace is appended to the
+     * output file as an OTLP JSON line: a span for the whole transaction
+     * with a child span for every stage, ready to be loaded into an
+     * OpenTelemetry collector. The trace id is derived from the transaction
+     * hash, so the spans of different peers join into one trace.
+     *
+     * Marking a transaction which is not sampled does not take a lock.
+     */
+    class TransactionTracer {
+     public:
+      TransactionTracer();
+
+      /**
+       * Start tracing
+       * @param sample_interval - one of that many transactions is traced, 0
+       * disables tracing
+       * @param output_path - file to append finished traces to, traces are
+       * only reported to the metrics if empty
+       * @param log - logger
+       */
+      void configure(uint32_t sample_interval,
+                     const std::string &output_path,
+                     logger::LoggerPtr log);
+
+      /// @return true if the transaction with the given hash is traced
+      bool sampled(const shared_model::crypto::Hash &hash) const;
+
+      /// record that the transaction has reached the stage now
+      void mark(const shared_model::crypto::Hash &hash, TransactionStage stage);
+
+      /// record that all the given transactions have reached the stage now
+      template <typename Transactions>
+      void markAll(const Transactions &transactions, TransactionStage stage) {
+        if (sample_interval_.load(std::memory_order_relaxed) == 0) {
+          return;
+        }
+        for (const auto &transaction : transactions) {
+          mark(hashOf(transaction), stage);
+        }
+      }
+
+     private:
+      template <typename Transaction>
+      static const shared_model::crypto::Hash &hashOf(
+          const Transaction &transaction) {
+        return transaction.hash();
+      }
+
+      template <typename Transaction>
+      static const shared_model::crypto::Hash &hashOf(
+          const std::shared_ptr<Transaction> &transaction) {
+        return transaction->hash();
+      }
+
+      static constexpr size_t kStages =
+          static_cast<size_t>(TransactionStage::kRejected) + 1;
+
+      struct Trace {
+        /// unix time in nanoseconds of every stage, 0 if not reached
+        std::array<uint64_t, kStages> times{};
+      };
+
+      void finish(const shared_model::crypto::Hash &hash, const Trace &trace);
+
+      std::atomic<uint32_t> sample_interval_;
+      /// distinguishes the spans of this peer from the spans of other peers
+      const uint64_t span_salt_;
+
+      std::mutex mutex_;
+      std::unordered_map<shared_model::crypto::Hash,
+                         Trace,
+                         shared_model::crypto::Hash::Hasher>
+          traces_;
+      std::ofstream output_;
+      logger::LoggerPtr log_;
+    };
+
+    /// @return tracer of the process
+    TransactionTracer &tracer();
+
+  }  // namespace tracing
+}  // namespace iroha
+
+#endif  // IROHA_TRANSACTION_TRACER_HPP
@@ -0,0 +1,190 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "validation/impl/batches_partition.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <unordered_map>
+
+#include "common/visitor.hpp"
+#include "cryptography/public_key.hpp"
+#include "interfaces/commands/add_asset_quantity.hpp"
+#include "interfaces/commands/add_signatory.hpp"
+#include "interfaces/commands/command_variant.hpp"
+#include "interfaces/commands/compare_and_set_account_detail.hpp"
+#include "interfaces/commands/create_account.hpp"
+#include "interfaces/commands/create_asset.hpp"
+#include "interfaces/commands/create_domain.hpp"
+#include "interfaces/commands/grant_permission.hpp"
+#include "interfaces/commands/remove_signatory.hpp"
+#include "interfaces/commands/revoke_permission.hpp"
+#include "interfaces/commands/set_account_detail.hpp"
+#include "interfaces/commands/set_quorum.hpp"
+#include "interfaces/commands/subtract_asset_quantity.hpp"
+#include "interfaces/commands/transfer_asset.hpp"
+#include "interfaces/transaction.hpp"
+
+namespace iroha {
+  namespace validation {
+
+    namespace {
+
+      /// collects names of the state parts touched by transactions
+      class TouchedState {
+       public:
+        void account(const std::string &account_id) {
+          keys_.push_back("a:" + account_id);
+        }
+
+        void asset(const std::string &asset_id) {
+          keys_.push_back("s:" + asset_id);
+        }
+
+        void domain(const std::string &domain_id) {
+          keys_.push_back("d:" + domain_id);
+        }
+
+        void signatory(const shared_model::interface::types::PubkeyType &key) {
+          keys_.push_back("k:" + key.hex());
+        }
+
+        /// @return false if the transaction changes roles or peers
+        bool add(const shared_model::interface::Transaction &tx) {
+          account(tx.creatorAccountId());
+          for (const auto &command : tx.commands()) {
+            if (not add(command)) {
+              return false;
+            }
+          }
+          return true;
+        }
+
+        const std::vector<std::string> &keys() const {
+          return keys_;
+        }
+
+       private:
+        bool add(const shared_model::interface::Command &command) {
+          namespace interface = shared_model::interface;
+          return visit_in_place(
+              command.get(),
+              [this](const interface::AddAssetQuantity &c) {
+                asset(c.assetId());
+                return true;
+              },
+              [this](const interface::SubtractAssetQuantity &c) {
+                asset(c.assetId());
+                return true;
+              },
+              [this](const interface::TransferAsset &c) {
+                account(c.srcAccountId());
+                account(c.destAccountId());
+                asset(c.assetId());
+                return true;
+              },
+              [this](const interface::AddSignatory &c) {
+                account(c.accountId());
+                signatory(c.pubkey());
+                return true;
+              },
+              [this](const interface::RemoveSignatory &c) {
+                account(c.accountId());
+                signatory(c.pubkey());
+                return true;
+              },
+              [this](const interface::CreateAccount &c) {
+                account(c.accountName() + "@" + c.domainId());
+                domain(c.domainId());
+                signatory(c.pubkey());
+                return true;
+              },
+              [this](const interface::CreateAsset &c) {
+                asset(c.assetName() + "#" + c.domainId());
+                domain(c.domainId());
+                return true;
+              },
+              [this](const interface::CreateDomain &c) {
+                domain(c.domainId());
+                return true;
+              },
+              [this](const interface::GrantPermission &c) {
+                account(c.accountId());
+                return true;
+              },
+              [this](const interface::RevokePermission &c) {
+                account(c.accountId());
+                return true;
+              },
+              [this](const interface::SetAccountDetail &c) {
+                account(c.accountId());
+                return true;
+              },
+              [this](const interface::CompareAndSetAccountDetail &c) {
+                account(c.accountId());
+                return true;
+              },
+              [this](const interface::SetQuorum &c) {
+                account(c.accountId());
+                return true;
+              },
+              // peers and roles are read by every transaction
+              [](const auto &) { return false; });
+        }
+
+        std::vector<std::string> keys_;
+      };
+
+      size_t findRoot(std::vector<size_t> &parents, size_t i) {
+        while (parents[i] != i) {
+          parents[i] = parents[parents[i]];
+          i = parents[i];
+        }
+        return i;
+      }
+
+    }  // namespace
+
+    boost::optional<std::vector<BatchesGroup>> partitionBatches(
+        const std::vector<shared_model::interface::types::
+                              TransactionsCollectionType> &batches) {
+      std::vector<size_t> parents(batches.size());
+      std::iota(parents.begin(), parents.end(), 0);
+      // first batch which touched the key
+      std::unordered_map<std::string, size_t> owners;
+
+      for (size_t i = 0; i < batches.size(); ++i) {
+        TouchedState state;
+        for (const auto &tx : batches[i]) {
+          if (not state.add(tx)) {
+            return boost::none;
+          }
+        }
+        for (const auto &key : state.keys()) {
+          auto owner = owners.emplace(key, i).first->second;
+          auto owner_root = findRoot(parents, owner);
+          auto root = findRoot(parents, i);
+          // the smallest index is the root, so roots keep the order of groups
+          parents[std::max(owner_root, root)] = std::min(owner_root, root);
+        }
+      }
+
+      std::vector<BatchesGroup> groups;
+      // index of group of every root batch
+      std::unordered_map<size_t, size_t> group_indices;
+      for (size_t i = 0; i < batches.size(); ++i) {
+        auto root = findRoot(parents, i);
+        auto group = group_indices.emplace(root, groups.size());
+        if (group.second) {
+          groups.emplace_back();
+        }
+        groups[group.first->second].push_back(i);
+      }
+      return groups;
+    }
+
+  }  // namespace validation
+}  // namespace iroha
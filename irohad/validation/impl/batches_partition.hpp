@@ -0,0 +1,36 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_VALIDATION_BATCHES_PARTITION_HPP
+#define IROHA_VALIDATION_BATCHES_PARTITION_HPP
+
+#include <vector>
+
+#include <boost/optional.hpp>
+#include "interfaces/common_objects/range_types.hpp"
+
+namespace iroha {
+  namespace validation {
+
+    /// indices of batches, in ascending order
+    using BatchesGroup = std::vector<size_t>;
+
+    /**
+     * Splits batches into groups which do not touch the same accounts,
+     * assets, domains and signatories, so the groups can be validated
+     * independently of each other
+     * @param batches - batches in the order of validation
+     * @return groups ordered by their first batch, or boost::none if some
+     * batch changes the state shared by all transactions, i.e. roles or
+     * peers, and the batches can only be validated sequentially
+     */
+    boost::optional<std::vector<BatchesGroup>> partitionBatches(
+        const std::vector<shared_model::interface::types::
+                              TransactionsCollectionType> &batches);
+
+  }  // namespace validation
+}  // namespace iroha
+
+#endif  // IROHA_VALIDATION_BATCHES_PARTITION_HPP
@@ -102,7 +102,7 @@ namespace iroha {
         const iroha::LedgerState &ledger_state) const {
       log_->debug("validate block: height {}, hash {}",
                   block->height(),
-                  block->hash().hex());
+                  logger::lazy([&block] { return block->hash().hex(); }));
 
       return validatePreviousHash(*block, ledger_state.top_block_info.top_hash)
           and validateHeight(*block, ledger_state.top_block_info.height)
@@ -5,6 +5,8 @@
 
 #include "validation/impl/stateful_validator_impl.hpp"
 
+#include <algorithm>
+#include <iterator>
 #include <string>
 
 #include <boost/algorithm/cxx11/all_of.hpp>
@@ -12,9 +14,12 @@
 #include <boost/range/adaptor/filtered.hpp>
 #include <boost/range/adaptor/indexed.hpp>
 #include <boost/range/adaptor/transformed.hpp>
+#include "ametsuchi/temporary_factory.hpp"
 #include "common/result.hpp"
+#include "common/thread_pool.hpp"
 #include "interfaces/iroha_internal/batch_meta.hpp"
 #include "logger/logger.hpp"
+#include "validation/impl/batches_partition.hpp"
 #include "validation/utils.hpp"
 
 namespace iroha {
@@ -40,85 +45,149 @@ namespace iroha {
           });
     };
 
+    struct StatefulValidatorImpl::BatchValidation {
+      /// whether every transaction of the batch passed validation
+      std::vector<bool> results;
+      /// errors of failed transactions
+      validation::TransactionsErrors errors;
+    };
+
     /**
-     * Validate all transactions supplied; includes special rules, such as batch
-     * validation etc
-     * @param txs to be validated
+     * Validate transactions of the batch; includes special rules, such as
+     * atomic batch validation
+     * @param batch to be validated
      * @param temporary_wsv to apply transactions on
+     * @param validation_results to append results of transactions to
      * @param transactions_errors_log to write errors to
-     * @param batch_parser to parse batches from transaction range
-     * @return range of transactions, which passed stateful validation
      */
-    static auto validateTransactions(
-        const shared_model::interface::types::TransactionsCollectionType &txs,
+    static void validateBatch(
+        const shared_model::interface::types::TransactionsCollectionType
+            &batch,
         ametsuchi::TemporaryWsv &temporary_wsv,
-        validation::TransactionsErrors &transactions_errors_log,
-        const shared_model::interface::TransactionBatchParser &batch_parser) {
-      std::vector<bool> validation_results;
-      validation_results.reserve(boost::size(txs));
+        std::vector<bool> &validation_results,
+        validation::TransactionsErrors &transactions_errors_log) {
+      auto validation = [&](auto &tx) {
+        return checkTransactions(temporary_wsv, transactions_errors_log, tx);
+      };
+      if (batch.front().batchMeta()
+          and batch.front().batchMeta()->get()->type()
+              == shared_model::interface::types::BatchType::ATOMIC) {
+        // check all batch's transactions for validness
+        auto savepoint = temporary_wsv.createSavepoint(
+            "batch_" + batch.front().hash().hex());
+        bool validation_result = false;
 
-      for (auto batch : batch_parser.parseBatches(txs)) {
-        auto validation = [&](auto &tx) {
-          return checkTransactions(temporary_wsv, transactions_errors_log, tx);
-        };
-        if (batch.front().batchMeta()
-            and batch.front().batchMeta()->get()->type()
-                == shared_model::interface::types::BatchType::ATOMIC) {
-          // check all batch's transactions for validness
-          auto savepoint = temporary_wsv.createSavepoint(
-              "batch_" + batch.front().hash().hex());
-          bool validation_result = false;
-
-          if (boost::algorithm::all_of(batch, validation)) {
-            // batch is successful; release savepoint
-            validation_result = true;
-            savepoint->release();
-          } else {
-            auto failed_tx_hash = transactions_errors_log.back().tx_hash;
-            for (const auto &tx : batch) {
-              if (tx.hash() != failed_tx_hash) {
-                transactions_errors_log.emplace_back(
-                    validation::TransactionError{
-                        tx.hash(),
-                        // TODO igor-egorov 22.01.2019 IR-245 add a separate
-                        // error code for failed batch case
-                        validation::CommandError{
-                            "",
-                            1,  // internal error code
-                            "Another transaction failed the batch",
-                            true,
-                            std::numeric_limits<size_t>::max()}});
-              }
-            }
-          }
-
-          validation_results.insert(
-              validation_results.end(), boost::size(batch), validation_result);
+        if (boost::algorithm::all_of(batch, validation)) {
+          // batch is successful; release savepoint
+          validation_result = true;
+          savepoint->release();
         } else {
+          auto failed_tx_hash = transactions_errors_log.back().tx_hash;
           for (const auto &tx : batch) {
-            validation_results.push_back(validation(tx));
+            if (tx.hash() != failed_tx_hash) {
+              transactions_errors_log.emplace_back(
+                  validation::TransactionError{
+                      tx.hash(),
+                      // TODO igor-egorov 22.01.2019 IR-245 add a separate
+                      // error code for failed batch case
+                      validation::CommandError{
+                          "",
+                          1,  // internal error code
+                          "Another transaction failed the batch",
+                          true,
+                          std::numeric_limits<size_t>::max()}});
+            }
           }
         }
-      }
 
-      return txs | boost::adaptors::indexed()
-          | boost::adaptors::filtered(
-                 [validation_results =
-                      std::move(validation_results)](const auto &el) {
-                   return validation_results.at(el.index());
-                 })
-          | boost::adaptors::transformed(
-                 [](const auto &el) -> decltype(auto) { return el.value(); });
+        validation_results.insert(
+            validation_results.end(), boost::size(batch), validation_result);
+      } else {
+        for (const auto &tx : batch) {
+          validation_results.push_back(validation(tx));
+        }
+      }
     }
 
     StatefulValidatorImpl::StatefulValidatorImpl(
         std::unique_ptr<shared_model::interface::UnsafeProposalFactory> factory,
-        std::shared_ptr<shared_model::interface::TransactionBatchParser>
-            batch_parser,
-        logger::LoggerPtr log)
+        logger::LoggerPtr log,
+        std::shared_ptr<ametsuchi::TemporaryFactory> temporary_factory,
+        std::shared_ptr<iroha::ThreadPool> validation_pool)
         : factory_(std::move(factory)),
-          batch_parser_(std::move(batch_parser)),
-          log_(std::move(log)) {}
+          log_(std::move(log)),
+          temporary_factory_(std::move(temporary_factory)),
+          validation_pool_(std::move(validation_pool)) {}
+
+    bool StatefulValidatorImpl::validateInParallel(
+        const std::vector<
+            shared_model::interface::types::TransactionsCollectionType>
+            &batches,
+        ametsuchi::TemporaryWsv &temporary_wsv,
+        std::vector<BatchValidation> &batch_validations) {
+      if (not temporary_factory_ or not validation_pool_
+          or batches.size() < 2) {
+        return false;
+      }
+      auto groups = partitionBatches(batches);
+      if (not groups or groups->size() < 2) {
+        return false;
+      }
+
+      std::vector<std::unique_ptr<ametsuchi::TemporaryWsv>> additional_wsvs;
+      auto wsvs_number =
+          std::min(groups->size(), validation_pool_->size() + 1);
+      while (additional_wsvs.size() + 1 < wsvs_number) {
+        auto wsv = temporary_factory_->createTemporaryWsv();
+        if (auto e = boost::get<expected::Error<std::string>>(&wsv)) {
+          log_->warn("could not create temporary storage: {}", e->error);
+          break;
+        }
+        additional_wsvs.push_back(std::move(
+            boost::get<
+                expected::Value<std::unique_ptr<ametsuchi::TemporaryWsv>>>(
+                wsv)
+                .value));
+      }
+      if (additional_wsvs.empty()) {
+        return false;
+      }
+      std::vector<ametsuchi::TemporaryWsv *> wsvs{&temporary_wsv};
+      for (auto &wsv : additional_wsvs) {
+        wsvs.push_back(wsv.get());
+      }
+
+      // groups are assigned to the least loaded WSV in order of their first
+      // batches, so the assignment is the same on every peer
+      std::vector<std::vector<size_t>> wsv_batches(wsvs.size());
+      std::vector<size_t> wsv_load(wsvs.size(), 0);
+      for (const auto &group : *groups) {
+        auto wsv_index =
+            std::distance(wsv_load.begin(),
+                          std::min_element(wsv_load.begin(), wsv_load.end()));
+        for (auto batch_index : group) {
+          wsv_batches[wsv_index].push_back(batch_index);
+          wsv_load[wsv_index] += boost::size(batches[batch_index]);
+        }
+      }
+      for (auto &indices : wsv_batches) {
+        std::sort(indices.begin(), indices.end());
+      }
+
+      log_->debug("validating {} independent groups of batches on {} WSVs",
+                  groups->size(),
+                  wsvs.size());
+      validation_pool_->parallelFor(wsvs.size(), [&](size_t wsv_index) {
+        for (auto batch_index : wsv_batches[wsv_index]) {
+          auto &batch_validation = batch_validations[batch_index];
+          validateBatch(batches[batch_index],
+                        *wsvs[wsv_index],
+                        batch_validation.results,
+                        batch_validation.errors);
+        }
+      });
+      return true;
+    }
 
     std::unique_ptr<validation::VerifiedProposalAndErrors>
     StatefulValidatorImpl::validate(
@@ -128,11 +197,44 @@ namespace iroha {
                  proposal.transactions().size());
 
       auto validation_result = std::make_unique<VerifiedProposalAndErrors>();
-      auto valid_txs =
-          validateTransactions(proposal.transactions(),
-                               temporaryWsv,
-                               validation_result->rejected_transactions,
-                               *batch_parser_);
+      const auto &txs = proposal.transactions();
+      auto batches = proposal.batches();
+
+      std::vector<BatchValidation> batch_validations(batches.size());
+      if (validateInParallel(batches, temporaryWsv, batch_validations)) {
+        validation_result->wsv_has_all_effects = false;
+      } else {
+        for (size_t i = 0; i < batches.size(); ++i) {
+          validateBatch(batches[i],
+                        temporaryWsv,
+                        batch_validations[i].results,
+                        batch_validations[i].errors);
+        }
+      }
+
+      // results are merged in the order of batches regardless of the WSVs
+      std::vector<bool> validation_results;
+      validation_results.reserve(boost::size(txs));
+      auto &transactions_errors_log = validation_result->rejected_transactions;
+      for (auto &batch_validation : batch_validations) {
+        validation_results.insert(validation_results.end(),
+                                  batch_validation.results.begin(),
+                                  batch_validation.results.end());
+        std::move(batch_validation.errors.begin(),
+                  batch_validation.errors.end(),
+                  std::back_inserter(transactions_errors_log));
+      }
+
+      auto valid_txs = txs | boost::adaptors::indexed()
+          | boost::adaptors::filtered(
+                           [validation_results =
+                                std::move(validation_results)](const auto &el) {
+                             return validation_results.at(el.index());
+                           })
+          | boost::adaptors::transformed(
+                           [](const auto &el) -> decltype(auto) {
+                             return el.value();
+                           });
 
       // Since proposal came from ordering gate it was already validated.
       // All transactions are validated as well
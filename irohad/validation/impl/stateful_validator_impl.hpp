@@ -8,10 +8,16 @@
 
 #include "validation/stateful_validator.hpp"
 
-#include "interfaces/iroha_internal/transaction_batch_parser.hpp"
 #include "interfaces/iroha_internal/unsafe_proposal_factory.hpp"
 #include "logger/logger_fwd.hpp"
 
+namespace iroha {
+  class ThreadPool;
+  namespace ametsuchi {
+    class TemporaryFactory;
+  }
+}  // namespace iroha
+
 namespace iroha {
   namespace validation {
 
@@ -20,22 +26,53 @@ namespace iroha {
      */
     class StatefulValidatorImpl : public StatefulValidator {
      public:
+      /**
+       * @param factory - factory of verified proposals
+       * @param log - logger
+       * @param temporary_factory - source of additional temporary WSVs, so
+       * batches which do not touch the same accounts, assets, domains and
+       * signatories are validated in parallel on separate WSVs. Such
+       * validation leaves the given WSV without effects of some valid
+       * transactions, what is reported in the result
+       * @param validation_pool - threads validating the separate WSVs, the
+       * number of WSVs is one more than the number of threads. Batches are
+       * validated sequentially on the given WSV if null
+       */
       StatefulValidatorImpl(
           std::unique_ptr<shared_model::interface::UnsafeProposalFactory>
               factory,
-          std::shared_ptr<shared_model::interface::TransactionBatchParser>
-              batch_parser,
-          logger::LoggerPtr log);
+          logger::LoggerPtr log,
+          std::shared_ptr<ametsuchi::TemporaryFactory> temporary_factory =
+              nullptr,
+          std::shared_ptr<iroha::ThreadPool> validation_pool = nullptr);
 
       std::unique_ptr<validation::VerifiedProposalAndErrors> validate(
           const shared_model::interface::Proposal &proposal,
           ametsuchi::TemporaryWsv &temporaryWsv) override;
 
      private:
+      struct BatchValidation;
+
+      /**
+       * Validates groups of independent batches in parallel, the group of the
+       * first batch is validated on the given WSV
+       * @param batches - batches of the proposal
+       * @param temporary_wsv - WSV of the proposal
+       * @param batch_validations - results of every batch
+       * @return false if batches were not validated, because they are not
+       * independent or additional WSVs are not available
+       */
+      bool validateInParallel(
+          const std::vector<
+              shared_model::interface::types::TransactionsCollectionType>
+              &batches,
+          ametsuchi::TemporaryWsv &temporary_wsv,
+          std::vector<BatchValidation> &batch_validations);
+
       std::unique_ptr<shared_model::interface::UnsafeProposalFactory> factory_;
-      std::shared_ptr<shared_model::interface::TransactionBatchParser>
-          batch_parser_;
       logger::LoggerPtr log_;
+      std::shared_ptr<ametsuchi::TemporaryFactory> temporary_factory_;
+      std::shared_ptr<iroha::ThreadPool> validation_pool_;
     };
 
   }  // namespace validation
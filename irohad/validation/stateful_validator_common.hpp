@@ -12,6 +12,7 @@
 
 #include <unordered_map>
 
+#include "common/result.hpp"
 #include "cryptography/hash.hpp"
 #include "interfaces/common_objects/types.hpp"
 
@@ -34,8 +35,9 @@ namespace iroha {
       /// Error code, with which the command failed
       uint32_t error_code;
 
-      /// Extra information about error for developers to be placed into the log
-      std::string error_extra;
+      /// Extra information about error for developers to be placed into the
+      /// log, rendered only when it is read
+      expected::LazyMessage error_extra;
 
       /// Shows, if transaction has passed initial validation
       bool tx_passed_initial_validation;
@@ -61,6 +63,9 @@ namespace iroha {
       std::shared_ptr<const shared_model::interface::Proposal>
           verified_proposal;
       TransactionsErrors rejected_transactions;
+      /// whether the WSV used for validation contains effects of all verified
+      /// transactions, so it can be prepared as the state of the block
+      bool wsv_has_all_effects = true;
     };
 
   }  // namespace validation
@@ -7,17 +7,18 @@
 #define IROHA_ABSTRACT_CACHE_HPP
 
 #include <boost/optional.hpp>
-#include <list>
 #include <shared_mutex>
 #include <string>
+#include <type_traits>
 
 namespace iroha {
   namespace cache {
     /**
      * Cache for any key-value types.
-     * Internally it uses a map to cache ItemTypes and linked list
-     * based index of KeyTypes to remove oldest items when getIndexSizeHigh() is
-     * reached. Implemented as a CRTP pattern.
+     * Internally it uses a map to cache ItemTypes and an eviction policy
+     * to remove items when getIndexSizeHigh() is reached. Implemented as a
+     * CRTP pattern. Implementation defines kExclusiveLookup if lookups modify
+     * its state and have to be performed under exclusive lock.
      * @tparam KeyType - type of cache keys
      * @tparam ValueType - type of cache values
      * @tparam T - type of implementation
@@ -74,11 +75,29 @@ namespace iroha {
        * @return Optional of ValueType
        */
       boost::optional<ValueType> findItem(const KeyType &key) const {
+        return findItem(key,
+                        std::integral_constant<bool, T::kExclusiveLookup>{});
+      }
+
+     private:
+      /**
+       * Lookup which does not modify the cache, performed under shared lock
+       */
+      boost::optional<ValueType> findItem(const KeyType &key,
+                                          std::false_type) const {
         std::shared_lock<std::shared_timed_mutex> lock(access_mutex_);
         return constUnderlying().findItemImpl(key);
       }
 
-     private:
+      /**
+       * Lookup which updates eviction order, performed under exclusive lock
+       */
+      boost::optional<ValueType> findItem(const KeyType &key,
+                                          std::true_type) const {
+        std::lock_guard<std::shared_timed_mutex> lock(access_mutex_);
+        return constUnderlying().findItemImpl(key);
+      }
+
       const T &constUnderlying() const {
         return static_cast<const T &>(*this);
       }
@@ -0,0 +1,149 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_BYTE_BOUNDED_CACHE_HPP
+#define IROHA_BYTE_BOUNDED_CACHE_HPP
+
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <unordered_map>
+
+#include <boost/optional.hpp>
+
+namespace iroha {
+  namespace cache {
+
+    /**
+     * Cache bounded by the estimated memory of its items rather than their
+     * number, for values which size varies a lot. Items are evicted oldest
+     * first, an item is renewed when it is replaced or touched. An item
+     * larger than the whole budget is not cached at all, so that a single
+     * huge value does not flush every other item.
+     * The cache is not synchronized, its owner guards it
+     * @tparam KeyType type of key objects
+     * @tparam ValueType type of value objects
+     * @tparam KeyHash hasher for keys
+     */
+    template <typename KeyType,
+              typename ValueType,
+              typename KeyHash = std::hash<KeyType>>
+    class ByteBoundedCache {
+     public:
+      /// @param budget - maximal estimated memory of the items in bytes
+      explicit ByteBoundedCache(uint64_t budget) : budget_(budget) {}
+
+      /**
+       * Put the value, replacing the previous one with the same key. The
+       * previous value is removed even if the new one is too large to cache
+       * @param key - key of the value
+       * @param value - value to cache
+       * @param bytes - estimated memory of the item with its key
+       * @return number of items evicted to fit the value
+       */
+      size_t addItem(const KeyType &key,
+                     const ValueType &value,
+                     uint64_t bytes) {
+        if (bytes > budget_) {
+          removeItem(key);
+          return 0;
+        }
+        auto it = items_.find(key);
+        if (it == items_.end()) {
+          order_.push_back(key);
+          it = items_.emplace(key, Item{value, 0, std::prev(order_.end())})
+                   .first;
+        } else {
+          bytes_ -= it->second.bytes;
+          order_.splice(order_.end(), order_, it->second.position);
+          it->second.value = value;
+        }
+        it->second.bytes = bytes;
+        bytes_ += bytes;
+        return evict();
+      }
+
+      /**
+       * @param key - key of the value
+       * @return copy of the value, none if it is not cached
+       */
+      boost::optional<ValueType> findItem(const KeyType &key) const {
+        auto it = items_.find(key);
+        if (it == items_.end()) {
+          return boost::none;
+        }
+        return it->second.value;
+      }
+
+      /**
+       * Mark the item as the newest one, for least recently used eviction
+       * @param key - key of the value
+       */
+      void touch(const KeyType &key) {
+        auto it = items_.find(key);
+        if (it != items_.end()) {
+          order_.splice(order_.end(), order_, it->second.position);
+        }
+      }
+
+      /**
+       * @param key - key of the value
+       * @return true if the item was cached
+       */
+      bool removeItem(const KeyType &key) {
+        auto it = items_.find(key);
+        if (it == items_.end()) {
+          return false;
+        }
+        bytes_ -= it->second.bytes;
+        order_.erase(it->second.position);
+        items_.erase(it);
+        return true;
+      }
+
+      /// @return number of cached items
+      uint32_t getCacheItemCount() const {
+        return static_cast<uint32_t>(items_.size());
+      }
+
+      /// @return estimated memory of the cached items in bytes
+      uint64_t getCacheBytes() const {
+        return bytes_;
+      }
+
+     private:
+      using Order = std::list<KeyType>;
+
+      struct Item {
+        ValueType value;
+        uint64_t bytes;
+        typename Order::iterator position;
+      };
+
+      /// remove the oldest items until the cache fits its budget
+      size_t evict() {
+        size_t evicted = 0;
+        while (bytes_ > budget_) {
+          auto it = items_.find(order_.front());
+          bytes_ -= it->second.bytes;
+          items_.erase(it);
+          order_.pop_front();
+          ++evicted;
+        }
+        return evicted;
+      }
+
+      std::unordered_map<KeyType, Item, KeyHash> items_;
+      /// keys of the items, oldest first
+      Order order_;
+      const uint64_t budget_;
+      uint64_t bytes_ = 0;
+    };
+
+  }  // namespace cache
+}  // namespace iroha
+
+#endif  // IROHA_BYTE_BOUNDED_CACHE_HPP
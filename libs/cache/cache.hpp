@@ -9,6 +9,7 @@
 #include "cache/abstract_cache.hpp"
 
 #include <unordered_map>
+#include "cache/eviction_policy.hpp"
 
 namespace iroha {
   namespace cache {
@@ -18,18 +19,30 @@ namespace iroha {
      * @tparam KeyType type of key objects
      * @tparam ValueType type of value objects
      * @tparam KeyHash hasher for keys
+     * @tparam EvictionPolicy policy which selects items to remove when cache
+     * is full, @see eviction_policy.hpp
      */
     template <typename KeyType,
               typename ValueType,
-              typename KeyHash = std::hash<KeyType>>
-    class Cache : public AbstractCache<KeyType,
-                                       ValueType,
-                                       Cache<KeyType, ValueType, KeyHash>> {
+              typename KeyHash = std::hash<KeyType>,
+              template <typename> class EvictionPolicy = FifoEviction>
+    class Cache
+        : public AbstractCache<
+              KeyType,
+              ValueType,
+              Cache<KeyType, ValueType, KeyHash, EvictionPolicy>> {
+      using Policy = EvictionPolicy<KeyType>;
+
      public:
+      static constexpr bool kExclusiveLookup = Policy::kExclusiveTouch;
+
       Cache(uint32_t max_handler_map_size_high = 20000,
             uint32_t max_handler_map_size_low = 10000)
-          : max_handler_map_size_high_(max_handler_map_size_high),
-            max_handler_map_size_low_(max_handler_map_size_low) {}
+          : eviction_(max_handler_map_size_high + 1),
+            max_handler_map_size_high_(max_handler_map_size_high),
+            max_handler_map_size_low_(max_handler_map_size_low) {
+        handler_map_.reserve(max_handler_map_size_high + 1);
+      }
 
       uint32_t getIndexSizeHighImpl() const {
         return max_handler_map_size_high_;
@@ -45,12 +58,16 @@ namespace iroha {
 
       void addItemImpl(const KeyType &key, const ValueType &value) {
         // elements with the same hash should be replaced
-        handler_map_[key] = value;
-        handler_map_index_.push_back(key);
+        auto found = handler_map_.find(key);
+        if (found != handler_map_.end()) {
+          found->second.value = value;
+          eviction_.touch(found->second.handle);
+          return;
+        }
+        handler_map_.emplace(key, Item{value, eviction_.insert(key)});
         if (handler_map_.size() > getIndexSizeHighImpl()) {
           while (handler_map_.size() > getIndexSizeLowImpl()) {
-            handler_map_.erase(handler_map_index_.front());
-            handler_map_index_.pop_front();
+            handler_map_.erase(eviction_.evict());
           }
         }
       }
@@ -59,14 +76,19 @@ namespace iroha {
         auto found = handler_map_.find(key);
         if (found == handler_map_.end()) {
           return boost::none;
-        } else {
-          return handler_map_.at(key);
         }
+        eviction_.touch(found->second.handle);
+        return found->second.value;
       }
 
      private:
-      std::unordered_map<KeyType, ValueType, KeyHash> handler_map_;
-      std::list<KeyType> handler_map_index_;
+      struct Item {
+        ValueType value;
+        typename Policy::Handle handle;
+      };
+
+      std::unordered_map<KeyType, Item, KeyHash> handler_map_;
+      Policy eviction_;
 
       /**
        * Protection from handler map overflow.
@@ -76,6 +98,26 @@ namespace iroha {
       const uint32_t max_handler_map_size_high_;
       const uint32_t max_handler_map_size_low_;
     };
+
+    template <typename KeyType,
+              typename ValueType,
+              typename KeyHash,
+              template <typename> class EvictionPolicy>
+    constexpr bool
+        Cache<KeyType, ValueType, KeyHash, EvictionPolicy>::kExclusiveLookup;
+
+    /// cache which keeps recently accessed items, lookups are exclusive
+    template <typename KeyType,
+              typename ValueType,
+              typename KeyHash = std::hash<KeyType>>
+    using LruCache = Cache<KeyType, ValueType, KeyHash, LruEviction>;
+
+    /// cache which approximates LRU, lookups may be concurrent
+    template <typename KeyType,
+              typename ValueType,
+              typename KeyHash = std::hash<KeyType>>
+    using ClockCache = Cache<KeyType, ValueType, KeyHash, ClockEviction>;
+
   }  // namespace cache
 }  // namespace iroha
 
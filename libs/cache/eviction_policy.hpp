@@ -0,0 +1,216 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CACHE_EVICTION_POLICY_HPP
+#define IROHA_CACHE_EVICTION_POLICY_HPP
+
+#include <atomic>
+#include <cassert>
+#include <memory>
+#include <vector>
+
+namespace iroha {
+  namespace cache {
+
+    /**
+     * Eviction policies for Cache. Every policy tracks at most capacity keys
+     * in preallocated slots, so insertions and evictions do not allocate.
+     * Policy interface:
+     * - Handle insert(const KeyType &) registers a new key;
+     * - void touch(Handle) const marks key as accessed;
+     * - KeyType evict() forgets and returns the key which should be removed;
+     * - kExclusiveTouch is true if touch() modifies shared state and must not
+     *   be called concurrently.
+     */
+
+    /**
+     * Evicts keys in order of insertion, access does not matter
+     * @tparam KeyType type of cache keys
+     */
+    template <typename KeyType>
+    class FifoEviction {
+     public:
+      using Handle = size_t;
+      static constexpr bool kExclusiveTouch = false;
+
+      explicit FifoEviction(size_t capacity)
+          : keys_(capacity), head_(0), size_(0) {}
+
+      Handle insert(const KeyType &key) {
+        assert(size_ < keys_.size());
+        auto slot = (head_ + size_++) % keys_.size();
+        keys_[slot] = key;
+        return slot;
+      }
+
+      void touch(Handle) const {}
+
+      KeyType evict() {
+        assert(size_ > 0);
+        auto key = std::move(keys_[head_]);
+        head_ = (head_ + 1) % keys_.size();
+        --size_;
+        return key;
+      }
+
+     private:
+      /// ring buffer of keys, oldest key is at head_
+      std::vector<KeyType> keys_;
+      size_t head_;
+      size_t size_;
+    };
+
+    /**
+     * Evicts least recently used keys. Access reorders keys, so lookups must
+     * be performed exclusively
+     * @tparam KeyType type of cache keys
+     */
+    template <typename KeyType>
+    class LruEviction {
+     public:
+      using Handle = size_t;
+      static constexpr bool kExclusiveTouch = true;
+
+      explicit LruEviction(size_t capacity)
+          : nodes_(capacity), head_(kNone), tail_(kNone) {
+        free_.reserve(capacity);
+        for (auto slot = capacity; slot > 0; --slot) {
+          free_.push_back(slot - 1);
+        }
+      }
+
+      Handle insert(const KeyType &key) {
+        assert(not free_.empty());
+        auto slot = free_.back();
+        free_.pop_back();
+        nodes_[slot].key = key;
+        link(slot);
+        return slot;
+      }
+
+      void touch(Handle slot) const {
+        if (slot != head_) {
+          unlink(slot);
+          link(slot);
+        }
+      }
+
+      KeyType evict() {
+        assert(tail_ != kNone);
+        auto slot = tail_;
+        unlink(slot);
+        free_.push_back(slot);
+        return std::move(nodes_[slot].key);
+      }
+
+     private:
+      static constexpr size_t kNone = static_cast<size_t>(-1);
+
+      struct Node {
+        KeyType key;
+        size_t prev = kNone;
+        size_t next = kNone;
+      };
+
+      /// insert slot to the head of the recency list
+      void link(size_t slot) const {
+        nodes_[slot].prev = kNone;
+        nodes_[slot].next = head_;
+        if (head_ != kNone) {
+          nodes_[head_].prev = slot;
+        }
+        head_ = slot;
+        if (tail_ == kNone) {
+          tail_ = slot;
+        }
+      }
+
+      /// remove slot from the recency list
+      void unlink(size_t slot) const {
+        auto &node = nodes_[slot];
+        (node.prev != kNone ? nodes_[node.prev].next : head_) = node.next;
+        (node.next != kNone ? nodes_[node.next].prev : tail_) = node.prev;
+      }
+
+      /// doubly linked recency list over preallocated slots, most recently
+      /// used key is at head_
+      mutable std::vector<Node> nodes_;
+      mutable size_t head_;
+      mutable size_t tail_;
+      std::vector<size_t> free_;
+    };
+
+    template <typename KeyType>
+    constexpr size_t LruEviction<KeyType>::kNone;
+
+    /**
+     * Approximates LRU with the CLOCK algorithm: accessed keys get a second
+     * chance when the clock hand passes over them. Access only sets an
+     * atomic flag, so lookups may be performed concurrently
+     * @tparam KeyType type of cache keys
+     */
+    template <typename KeyType>
+    class ClockEviction {
+     public:
+      using Handle = size_t;
+      static constexpr bool kExclusiveTouch = false;
+
+      explicit ClockEviction(size_t capacity)
+          : keys_(capacity),
+            used_(capacity, false),
+            referenced_(new std::atomic<bool>[capacity]),
+            hand_(0) {
+        free_.reserve(capacity);
+        for (auto slot = capacity; slot > 0; --slot) {
+          free_.push_back(slot - 1);
+          referenced_[slot - 1].store(false, std::memory_order_relaxed);
+        }
+      }
+
+      Handle insert(const KeyType &key) {
+        assert(not free_.empty());
+        auto slot = free_.back();
+        free_.pop_back();
+        keys_[slot] = key;
+        used_[slot] = true;
+        referenced_[slot].store(false, std::memory_order_relaxed);
+        return slot;
+      }
+
+      void touch(Handle slot) const {
+        referenced_[slot].store(true, std::memory_order_relaxed);
+      }
+
+      KeyType evict() {
+        assert(free_.size() < keys_.size());
+        while (not used_[hand_]
+               or referenced_[hand_].exchange(false,
+                                              std::memory_order_relaxed)) {
+          advance();
+        }
+        auto slot = hand_;
+        advance();
+        used_[slot] = false;
+        free_.push_back(slot);
+        return std::move(keys_[slot]);
+      }
+
+     private:
+      void advance() {
+        hand_ = (hand_ + 1) % keys_.size();
+      }
+
+      /// ring buffer of keys swept by the clock hand
+      std::vector<KeyType> keys_;
+      std::vector<bool> used_;
+      std::unique_ptr<std::atomic<bool>[]> referenced_;
+      size_t hand_;
+      std::vector<size_t> free_;
+    };
+
+  }  // namespace cache
+}  // namespace iroha
+
+#endif  // IROHA_CACHE_EVICTION_POLICY_HPP
@@ -0,0 +1,80 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARDED_CACHE_HPP
+#define IROHA_SHARDED_CACHE_HPP
+
+#include <algorithm>
+#include <array>
+#include <memory>
+
+#include "cache/cache.hpp"
+
+namespace iroha {
+  namespace cache {
+
+    /**
+     * Cache shared by threads, split into shards selected by key hash. Every
+     * shard is a ClockCache guarded by its own shared_timed_mutex, taken
+     * shared by findItem and exclusively by addItem, so concurrent lookups
+     * never block each other and insertions only block lookups of the same
+     * shard
+     * @tparam KeyType type of key objects
+     * @tparam ValueType type of value objects
+     * @tparam KeyHash hasher for keys
+     * @tparam kShards number of shards
+     */
+    template <typename KeyType,
+              typename ValueType,
+              typename KeyHash = std::hash<KeyType>,
+              size_t kShards = 16>
+    class ShardedCache {
+      using Shard = ClockCache<KeyType, ValueType, KeyHash>;
+
+     public:
+      /**
+       * @param size_high - number of items after which the oldest items are
+       * evicted, split between the shards
+       * @param size_low - number of items left after eviction, split
+       * between the shards
+       */
+      ShardedCache(uint32_t size_high, uint32_t size_low) {
+        const auto shard_high = std::max<uint32_t>(size_high / kShards, 2);
+        const auto shard_low =
+            std::min(std::max<uint32_t>(size_low / kShards, 1), shard_high);
+        for (auto &shard : shards_) {
+          shard = std::make_unique<Shard>(shard_high, shard_low);
+        }
+      }
+
+      void addItem(const KeyType &key, const ValueType &value) {
+        shard(key).addItem(key, value);
+      }
+
+      boost::optional<ValueType> findItem(const KeyType &key) const {
+        return shard(key).findItem(key);
+      }
+
+      /// @return number of items in all shards
+      uint32_t getCacheItemCount() const {
+        uint32_t count = 0;
+        for (const auto &shard : shards_) {
+          count += shard->getCacheItemCount();
+        }
+        return count;
+      }
+
+     private:
+      Shard &shard(const KeyType &key) const {
+        return *shards_[KeyHash{}(key) % kShards];
+      }
+
+      std::array<std::unique_ptr<Shard>, kShards> shards_;
+    };
+
+  }  // namespace cache
+}  // namespace iroha
+
+#endif  // IROHA_SHARDED_CACHE_HPP
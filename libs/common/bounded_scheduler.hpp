@@ -0,0 +1,229 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_BOUNDED_SCHEDULER_HPP
+#define IROHA_BOUNDED_SCHEDULER_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <rxcpp/rx.hpp>
+#include "metrics/metrics.hpp"
+
+namespace iroha {
+  namespace schedulers {
+
+    /**
+     * Scheduler of a pipeline stage with one explicit thread and a bounded
+     * queue of actions. Producers block while the queue is full, so a slow
+     * stage holds back the previous ones instead of growing an unbounded
+     * queue. Actions scheduled from the thread of the stage itself never
+     * block, since nobody else would drain the queue. All workers created
+     * by the scheduler share the thread, so actions keep their order.
+     * Actions scheduled for a later time wait in a separate queue, this is
+     * rare on the pipeline
+     */
+    class BoundedScheduler : public rxcpp::schedulers::scheduler_interface {
+      using clock_type = rxcpp::schedulers::scheduler_interface::clock_type;
+
+      struct Action {
+        clock_type::time_point when;
+        rxcpp::schedulers::schedulable what;
+        clock_type::time_point queued;
+      };
+
+      /// queues of the stage, shared by its thread and its workers
+      class State {
+       public:
+        State(const std::string &name, size_t capacity)
+            : capacity_(std::max<size_t>(capacity, 1)),
+              queue_size_(metrics::registry().gauge(
+                  "iroha_pipeline_" + name + "_queue_size",
+                  "Actions waiting in the queue of the pipeline stage")),
+              wait_time_(metrics::registry().histogram(
+                  "iroha_pipeline_" + name + "_wait_microseconds",
+                  "Time actions wait in the queue of the pipeline stage")) {}
+
+        void schedule(clock_type::time_point when,
+                      const rxcpp::schedulers::schedulable &what) {
+          auto now = clock_type::now();
+          std::unique_lock<std::mutex> lock(mutex_);
+          if (stop_) {
+            return;
+          }
+          if (when > now) {
+            delayed_.push_back(Action{when, what, now});
+            std::push_heap(delayed_.begin(), delayed_.end(), later);
+          } else {
+            if (std::this_thread::get_id() != thread_id_) {
+              space_.wait(lock, [this] {
+                return stop_ or queue_.size() < capacity_;
+              });
+            }
+            queue_.push_back(Action{when, what, now});
+            queue_size_.set(queue_.size());
+          }
+          lock.unlock();
+          ready_.notify_one();
+        }
+
+        void stop() {
+          {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+          }
+          ready_.notify_all();
+          space_.notify_all();
+        }
+
+        void run() {
+          rxcpp::schedulers::recursion recursion;
+          std::unique_lock<std::mutex> lock(mutex_);
+          thread_id_ = std::this_thread::get_id();
+          while (not stop_) {
+            auto now = clock_type::now();
+            while (not delayed_.empty() and delayed_.front().when <= now) {
+              std::pop_heap(delayed_.begin(), delayed_.end(), later);
+              queue_.push_back(std::move(delayed_.back()));
+              delayed_.pop_back();
+            }
+            if (queue_.empty()) {
+              if (delayed_.empty()) {
+                ready_.wait(lock);
+              } else {
+                ready_.wait_until(lock, delayed_.front().when);
+              }
+              continue;
+            }
+
+            {
+              auto action = std::move(queue_.front());
+              queue_.pop_front();
+              queue_size_.set(queue_.size());
+              lock.unlock();
+              space_.notify_one();
+
+              wait_time_.record(
+                  std::chrono::duration_cast<std::chrono::microseconds>(
+                      now - action.queued)
+                      .count());
+              if (action.what.is_subscribed()) {
+                // recursive actions are queued again to let others run
+                recursion.reset(false);
+                action.what(recursion.get_recurse());
+              }
+            }
+            lock.lock();
+          }
+          queue_.clear();
+          delayed_.clear();
+        }
+
+       private:
+        static bool later(const Action &lhs, const Action &rhs) {
+          return lhs.when > rhs.when;
+        }
+
+        const size_t capacity_;
+        metrics::Gauge &queue_size_;
+        metrics::Histogram &wait_time_;
+        std::deque<Action> queue_;
+        /// heap of actions scheduled for a later time
+        std::vector<Action> delayed_;
+        std::thread::id thread_id_;
+        bool stop_{false};
+        std::mutex mutex_;
+        std::condition_variable ready_;
+        std::condition_variable space_;
+      };
+
+      /// queued actions refer to their worker, so it must not own the state
+      class Worker : public rxcpp::schedulers::worker_interface {
+       public:
+        explicit Worker(std::weak_ptr<State> state)
+            : state_(std::move(state)) {}
+
+        clock_type::time_point now() const override {
+          return clock_type::now();
+        }
+
+        void schedule(
+            const rxcpp::schedulers::schedulable &scbl) const override {
+          schedule(now(), scbl);
+        }
+
+        void schedule(
+            clock_type::time_point when,
+            const rxcpp::schedulers::schedulable &scbl) const override {
+          if (auto state = state_.lock()) {
+            state->schedule(when, scbl);
+          }
+        }
+
+       private:
+        std::weak_ptr<State> state_;
+      };
+
+     public:
+      /**
+       * @param name - name of the stage in the metrics
+       * @param capacity - maximal number of queued actions
+       */
+      BoundedScheduler(const std::string &name, size_t capacity)
+          : state_(std::make_shared<State>(name, capacity)),
+            thread_([state = state_] { state->run(); }) {}
+
+      BoundedScheduler(const BoundedScheduler &) = delete;
+      BoundedScheduler &operator=(const BoundedScheduler &) = delete;
+
+      /// Pending actions are dropped
+      ~BoundedScheduler() override {
+        state_->stop();
+        if (std::this_thread::get_id() == thread_.get_id()) {
+          // the last reference is dropped by an action of the stage, the
+          // thread owns the state and finishes after the action
+          thread_.detach();
+        } else {
+          thread_.join();
+        }
+      }
+
+      clock_type::time_point now() const override {
+        return clock_type::now();
+      }
+
+      rxcpp::schedulers::worker create_worker(
+          rxcpp::composite_subscription cs) const override {
+        return rxcpp::schedulers::worker(std::move(cs),
+                                         std::make_shared<Worker>(state_));
+      }
+
+     private:
+      std::shared_ptr<State> state_;
+      std::thread thread_;
+    };
+
+    /**
+     * Create a coordination which runs the observers of a pipeline stage on
+     * a dedicated thread with a bounded queue
+     * @param name - name of the stage in the metrics
+     * @param capacity - maximal number of queued actions
+     */
+    inline rxcpp::observe_on_one_worker makeBoundedStage(
+        const std::string &name, size_t capacity) {
+      return rxcpp::observe_on_one_worker(
+          rxcpp::schedulers::make_scheduler<BoundedScheduler>(name, capacity));
+    }
+
+  }  // namespace schedulers
+}  // namespace iroha
+
+#endif  // IROHA_BOUNDED_SCHEDULER_HPP
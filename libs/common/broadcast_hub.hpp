@@ -0,0 +1,216 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_BROADCAST_HUB_HPP
+#define IROHA_BROADCAST_HUB_HPP
+
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace iroha {
+
+  /**
+   * Fan-out of messages to subscribers, which share every published message
+   * instead of receiving a copy. Every subscriber has a bounded buffer, and a
+   * subscriber with a full buffer is evicted on the next message, so a slow
+   * consumer neither holds back the publisher nor grows its buffer. A
+   * subscriber does not block waiting for messages: when its buffer is
+   * empty, it is notified once the next message arrives
+   * @tparam Message - type of published messages
+   */
+  template <typename Message>
+  class BroadcastHub {
+   public:
+    using MessagePtr = std::shared_ptr<const Message>;
+
+    /// called under the lock of the subscriber, must not call it back
+    using Notify = std::function<void()>;
+
+    class Subscriber {
+     public:
+      enum class Status { kMessage, kEmpty, kEvicted, kClosed };
+
+      /**
+       * Take the next message from the buffer. If the buffer is empty, the
+       * notification is armed: it is called once, when the next message
+       * arrives, the subscriber is evicted or the hub is closed
+       * @param message - receives the message if status is kMessage
+       * @return kMessage if a message is taken, kEmpty if the buffer is
+       * empty, kEvicted if the buffer has overflowed, kClosed if the hub is
+       * closed and all messages are taken
+       */
+      Status pop(MessagePtr &message) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (evicted_) {
+          return Status::kEvicted;
+        }
+        if (not buffer_.empty()) {
+          message = std::move(buffer_.front());
+          buffer_.pop_front();
+          return Status::kMessage;
+        }
+        if (closed_) {
+          return Status::kClosed;
+        }
+        waiting_ = true;
+        return Status::kEmpty;
+      }
+
+      /**
+       * Stop receiving messages, the notification is not called after return
+       * @return true if the notification was armed and will not be called
+       */
+      bool cancel() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        buffer_.clear();
+        auto was_waiting = waiting_;
+        waiting_ = false;
+        return was_waiting;
+      }
+
+     private:
+      friend class BroadcastHub;
+
+      Subscriber(size_t capacity, Notify notify)
+          : capacity_(std::max<size_t>(capacity, 1)),
+            notify_(std::move(notify)) {}
+
+      enum class Push { kBuffered, kEvicted, kDropped };
+
+      /// kDropped means the subscriber does not receive messages anymore
+      Push push(const MessagePtr &message) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (closed_ or evicted_) {
+          return Push::kDropped;
+        }
+        if (buffer_.size() >= capacity_) {
+          evicted_ = true;
+          buffer_.clear();
+          wake();
+          return Push::kEvicted;
+        }
+        buffer_.push_back(message);
+        wake();
+        return Push::kBuffered;
+      }
+
+      void close() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        wake();
+      }
+
+      void wake() {
+        if (waiting_) {
+          waiting_ = false;
+          notify_();
+        }
+      }
+
+      const size_t capacity_;
+      Notify notify_;
+
+      std::mutex mutex_;
+      std::deque<MessagePtr> buffer_;
+      bool waiting_{false};
+      bool evicted_{false};
+      bool closed_{false};
+    };
+
+    /**
+     * @param capacity - number of messages a subscriber may have in its
+     * buffer before it is evicted
+     */
+    explicit BroadcastHub(size_t capacity) : capacity_(capacity) {}
+
+    ~BroadcastHub() {
+      close();
+    }
+
+    /**
+     * Subscribe to messages published after the call. The subscriber is
+     * removed from the hub once it is destroyed
+     * @param notify - wakes the subscriber, see Subscriber::pop
+     * @return the subscriber
+     */
+    std::shared_ptr<Subscriber> subscribe(Notify notify) {
+      std::shared_ptr<Subscriber> subscriber(
+          new Subscriber(capacity_, std::move(notify)));
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (closed_) {
+        subscriber->closed_ = true;
+      } else {
+        subscribers_.push_back(subscriber);
+      }
+      return subscriber;
+    }
+
+    /**
+     * Put the message to buffers of all subscribers
+     * @return number of subscribers evicted by the message
+     */
+    size_t publish(MessagePtr message) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      size_t evicted = 0;
+      auto removed = std::remove_if(
+          subscribers_.begin(),
+          subscribers_.end(),
+          [&message, &evicted](const std::weak_ptr<Subscriber> &weak) {
+            auto subscriber = weak.lock();
+            if (not subscriber) {
+              return true;
+            }
+            switch (subscriber->push(message)) {
+              case Subscriber::Push::kBuffered:
+                return false;
+              case Subscriber::Push::kEvicted:
+                ++evicted;
+                return true;
+              default:
+                return true;
+            }
+          });
+      subscribers_.erase(removed, subscribers_.end());
+      return evicted;
+    }
+
+    /// @return true if there is no subscriber to publish messages to
+    bool empty() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return std::none_of(subscribers_.begin(),
+                          subscribers_.end(),
+                          [](const std::weak_ptr<Subscriber> &weak) {
+                            return not weak.expired();
+                          });
+    }
+
+    /// Close all subscribers, they receive the messages left in buffers
+    void close() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+      for (const auto &weak : subscribers_) {
+        if (auto subscriber = weak.lock()) {
+          subscriber->close();
+        }
+      }
+      subscribers_.clear();
+    }
+
+   private:
+    const size_t capacity_;
+
+    mutable std::mutex mutex_;
+    std::vector<std::weak_ptr<Subscriber>> subscribers_;
+    bool closed_{false};
+  };
+
+}  // namespace iroha
+
+#endif  // IROHA_BROADCAST_HUB_HPP
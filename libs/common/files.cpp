@@ -5,6 +5,9 @@
 
 #include "common/files.hpp"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
 #include <ciso646>
 
 #include <boost/filesystem.hpp>
@@ -40,3 +43,29 @@ void iroha::remove_dir_contents(const std::string &dir,
       log->error("{}", error_code.message());
   }
 }
+
+std::shared_ptr<const uint8_t> iroha::map_file_region(int fd,
+                                                      uint64_t offset,
+                                                      size_t size) {
+  static const uint64_t page_size = ::sysconf(_SC_PAGESIZE);
+  const uint64_t aligned_offset = offset - offset % page_size;
+  const size_t length = size + (offset - aligned_offset);
+  void *base =
+      ::mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, aligned_offset);
+  if (base == MAP_FAILED) {
+    return nullptr;
+  }
+  return std::shared_ptr<const uint8_t>(
+      static_cast<const uint8_t *>(base) + (offset - aligned_offset),
+      [base, length](const uint8_t *) { ::munmap(base, length); });
+}
+
+bool iroha::sync_path(const std::string &path, bool data_only) {
+  int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  auto synced = (data_only ? ::fdatasync(fd) : ::fsync(fd)) == 0;
+  ::close(fd);
+  return synced;
+}
@@ -6,6 +6,8 @@
 #ifndef IROHA_FILES_HPP
 #define IROHA_FILES_HPP
 
+#include <cstdint>
+#include <memory>
 #include <string>
 
 #include "logger/logger_fwd.hpp"
@@ -23,5 +25,28 @@ namespace iroha {
    */
   void remove_dir_contents(const std::string &dir,
                            const logger::LoggerPtr &log);
+
+  /**
+   * Map a region of an open file into memory for reading.
+   * The offset does not need to be aligned to the page size.
+   * @param fd - descriptor of the file opened for reading, it may be closed
+   * right after the call
+   * @param offset - offset of the region in the file
+   * @param size - size of the region, must be non-zero
+   * @return pointer to the first byte of the region which unmaps the memory
+   * when the last copy is released, nullptr on failure
+   */
+  std::shared_ptr<const uint8_t> map_file_region(int fd,
+                                                 uint64_t offset,
+                                                 size_t size);
+
+  /**
+   * Flush written data of a file or entries of a directory to disk
+   * @param path - path of the file or directory
+   * @param data_only - flush only data of the file and the metadata needed
+   * to read it, see fdatasync
+   * @return true if the data is on disk
+   */
+  bool sync_path(const std::string &path, bool data_only);
 }  // namespace iroha
 #endif  // IROHA_FILES_HPP
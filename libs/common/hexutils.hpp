@@ -6,30 +6,92 @@
 #define IROHA_HEXUTILS_HPP
 
 #include <ciso646>
+#include <cstdint>
 #include <iomanip>
 #include <sstream>
 #include <string>
 
 #include <boost/optional.hpp>
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 namespace iroha {
 
+  namespace detail {
+    /// values of hex digits of both cases, kNotHex for other characters
+    struct HexDigitValues {
+      static constexpr uint8_t kNotHex = 0xff;
+
+      constexpr HexDigitValues() : values() {
+        for (auto &value : values) {
+          value = kNotHex;
+        }
+        for (uint8_t i = 0; i < 10; ++i) {
+          values['0' + i] = i;
+        }
+        for (uint8_t i = 0; i < 6; ++i) {
+          values['a' + i] = values['A' + i] = 10 + i;
+        }
+      }
+
+      uint8_t values[256];
+    };
+  }  // namespace detail
+
+  /**
+   * Convert raw bytes to printable hex string. Blocks of 16 bytes are
+   * converted with SSE2 where it is available
+   * @param data - bytes to convert
+   * @param size - number of bytes
+   * @return - converted hex string
+   */
+  inline std::string bytesToHexstring(const uint8_t *data, size_t size) {
+    static const char kDigits[] = "0123456789abcdef";
+    std::string result(size * 2, 0);
+    size_t i = 0;
+#ifdef __SSE2__
+    const auto mask = _mm_set1_epi8(0x0f);
+    const auto nine = _mm_set1_epi8(9);
+    const auto zero = _mm_set1_epi8('0');
+    const auto letters = _mm_set1_epi8('a' - '0' - 10);
+    auto digits = [&](__m128i nibbles) {
+      auto letters_gap =
+          _mm_and_si128(_mm_cmpgt_epi8(nibbles, nine), letters);
+      return _mm_add_epi8(_mm_add_epi8(nibbles, zero), letters_gap);
+    };
+    for (; i + 16 <= size; i += 16) {
+      auto bytes =
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+      auto high = digits(_mm_and_si128(_mm_srli_epi16(bytes, 4), mask));
+      auto low = digits(_mm_and_si128(bytes, mask));
+      auto dst = reinterpret_cast<__m128i *>(&result[2 * i]);
+      _mm_storeu_si128(dst, _mm_unpacklo_epi8(high, low));
+      _mm_storeu_si128(dst + 1, _mm_unpackhi_epi8(high, low));
+    }
+#endif
+    for (; i < size; ++i) {
+      result[2 * i] = kDigits[data[i] >> 4];
+      result[2 * i + 1] = kDigits[data[i] & 0xf];
+    }
+    return result;
+  }
+
   /**
    * Convert string of raw bytes to printable hex string
    * @param str - raw bytes string to convert
    * @return - converted hex string
    */
   inline std::string bytestringToHexstring(const std::string &str) {
-    std::stringstream ss;
-    ss << std::hex << std::setfill('0');
-    for (const auto &c : str) {
-      ss << std::setw(2) << (static_cast<int>(c) & 0xff);
-    }
-    return ss.str();
+    return bytesToHexstring(reinterpret_cast<const uint8_t *>(str.data()),
+                            str.size());
   }
 
   /**
-   * Convert printable hex string to string of raw bytes
+   * Convert printable hex string to string of raw bytes. Digits of both
+   * cases are accepted, blocks of 16 digits are converted with SSE2 where it
+   * is available
    * @param str - hex string to convert
    * @return - raw bytes converted string or boost::noneif provided string
    * was not a correct hex string
@@ -40,20 +102,48 @@ namespace iroha {
       return boost::none;
     }
     std::string result(str.size() / 2, 0);
-    for (size_t i = 0; i < result.length(); ++i) {
-      std::string byte = str.substr(i * 2, 2);
-      size_t pos = 0;  // processed characters count
-      try {
-        result.at(i) =
-            static_cast<std::string::value_type>(std::stoul(byte, &pos, 16));
-      } catch (const std::invalid_argument &) {
-        return boost::none;
-      } catch (const std::out_of_range &) {
+    size_t i = 0;
+#ifdef __SSE2__
+    const auto before_zero = _mm_set1_epi8('0' - 1);
+    const auto after_nine = _mm_set1_epi8('9' + 1);
+    const auto before_a = _mm_set1_epi8('a' - 1);
+    const auto after_f = _mm_set1_epi8('f' + 1);
+    const auto lower_case = _mm_set1_epi8(0x20);
+    const auto zero = _mm_set1_epi8('0');
+    const auto a = _mm_set1_epi8('a' - 10);
+    const auto low_byte = _mm_set1_epi16(0x00ff);
+    for (; i + 16 <= str.size(); i += 16) {
+      auto chars =
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(&str[i]));
+      // characters above 0x7f are negative and match no range
+      auto is_digit = _mm_and_si128(_mm_cmpgt_epi8(chars, before_zero),
+                                    _mm_cmplt_epi8(chars, after_nine));
+      auto lower = _mm_or_si128(chars, lower_case);
+      auto is_letter = _mm_and_si128(_mm_cmpgt_epi8(lower, before_a),
+                                     _mm_cmplt_epi8(lower, after_f));
+      if (_mm_movemask_epi8(_mm_or_si128(is_digit, is_letter)) != 0xffff) {
         return boost::none;
       }
-      if (pos != byte.size()) {
+      auto values =
+          _mm_or_si128(_mm_and_si128(is_digit, _mm_sub_epi8(chars, zero)),
+                       _mm_and_si128(is_letter, _mm_sub_epi8(lower, a)));
+      // the first digit of a pair is the low byte of a 16-bit lane
+      auto bytes =
+          _mm_or_si128(_mm_slli_epi16(_mm_and_si128(values, low_byte), 4),
+                       _mm_srli_epi16(values, 8));
+      _mm_storel_epi64(reinterpret_cast<__m128i *>(&result[i / 2]),
+                       _mm_packus_epi16(bytes, bytes));
+    }
+#endif
+    static constexpr detail::HexDigitValues kValues{};
+    for (; i < str.size(); i += 2) {
+      const auto high = kValues.values[static_cast<uint8_t>(str[i])];
+      const auto low = kValues.values[static_cast<uint8_t>(str[i + 1])];
+      if (high == detail::HexDigitValues::kNotHex
+          or low == detail::HexDigitValues::kNotHex) {
         return boost::none;
       }
+      result[i / 2] = static_cast<char>(high << 4 | low);
     }
     return result;
   }
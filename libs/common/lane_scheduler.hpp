@@ -0,0 +1,111 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_LANE_SCHEDULER_HPP
+#define IROHA_LANE_SCHEDULER_HPP
+
+#include <chrono>
+#include <memory>
+
+#include <rxcpp/rx.hpp>
+#include "common/timer_wheel.hpp"
+#include "common/work_stealing_executor.hpp"
+
+namespace iroha {
+  namespace schedulers {
+
+    /**
+     * Scheduler running actions on a lane of the shared executor instead of
+     * a thread of its own. All workers created by the scheduler post to the
+     * same lane, so actions keep their order when the lane has concurrency 1.
+     * Actions scheduled for a later time are posted by the timer wheel
+     */
+    class LaneScheduler : public rxcpp::schedulers::scheduler_interface {
+      using clock_type = rxcpp::schedulers::scheduler_interface::clock_type;
+      using Lane = WorkStealingExecutor::Lane;
+
+      class Worker : public rxcpp::schedulers::worker_interface {
+       public:
+        Worker(std::shared_ptr<Lane> lane, std::shared_ptr<TimerWheel> wheel)
+            : lane_(std::move(lane)), wheel_(std::move(wheel)) {}
+
+        clock_type::time_point now() const override {
+          return clock_type::now();
+        }
+
+        void schedule(
+            const rxcpp::schedulers::schedulable &scbl) const override {
+          lane_->post([scbl] {
+            if (scbl.is_subscribed()) {
+              // recursive actions are posted again to let others run
+              rxcpp::schedulers::recursion recursion(false);
+              scbl(recursion.get_recurse());
+            }
+          });
+        }
+
+        void schedule(
+            clock_type::time_point when,
+            const rxcpp::schedulers::schedulable &scbl) const override {
+          auto delay = std::chrono::duration_cast<std::chrono::milliseconds>(
+              when - now());
+          if (delay.count() <= 0) {
+            schedule(scbl);
+            return;
+          }
+          std::weak_ptr<Lane> lane = lane_;
+          wheel_->schedule(delay, [lane, wheel = wheel_, scbl] {
+            if (auto alive = lane.lock()) {
+              Worker(std::move(alive), wheel).schedule(scbl);
+            }
+          });
+        }
+
+       private:
+        std::shared_ptr<Lane> lane_;
+        std::shared_ptr<TimerWheel> wheel_;
+      };
+
+     public:
+      /**
+       * @param lane - lane of the executor running the actions
+       * @param wheel - timer wheel posting delayed actions
+       */
+      LaneScheduler(std::shared_ptr<Lane> lane,
+                    std::shared_ptr<TimerWheel> wheel)
+          : lane_(std::move(lane)), wheel_(std::move(wheel)) {}
+
+      clock_type::time_point now() const override {
+        return clock_type::now();
+      }
+
+      rxcpp::schedulers::worker create_worker(
+          rxcpp::composite_subscription cs) const override {
+        return rxcpp::schedulers::worker(
+            std::move(cs), std::make_shared<Worker>(lane_, wheel_));
+      }
+
+     private:
+      std::shared_ptr<Lane> lane_;
+      std::shared_ptr<TimerWheel> wheel_;
+    };
+
+    /**
+     * Create a coordination which runs the observers of a pipeline stage one
+     * after another on the shared executor
+     * @param executor - executor of the process
+     * @param wheel - timer wheel posting delayed actions
+     */
+    inline rxcpp::observe_on_one_worker makeLaneStage(
+        WorkStealingExecutor &executor, std::shared_ptr<TimerWheel> wheel) {
+      return rxcpp::observe_on_one_worker(
+          rxcpp::schedulers::make_scheduler<LaneScheduler>(executor.makeLane(1),
+                                                           std::move(wheel)));
+    }
+
+  }  // namespace schedulers
+}  // namespace iroha
+
+#endif  // IROHA_LANE_SCHEDULER_HPP
@@ -7,6 +7,10 @@
 #define IROHA_RESULT_HPP
 
 #include <ciso646>
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <string>
 
 #include <boost/optional.hpp>
 #include <boost/variant.hpp>
@@ -416,6 +420,58 @@ namespace iroha {
       }
       return {};
     }
+
+    /**
+     * Message of an error which is rendered only when it is read, so that
+     * errors handled by their codes cost no formatting. The renderer must own
+     * everything it uses, since the message may be read after the objects
+     * which have caused the error are gone. The message is rendered once and
+     * kept; it must not be read concurrently before that
+     */
+    class LazyMessage {
+     public:
+      LazyMessage() = default;
+
+      LazyMessage(std::string message) : message_(std::move(message)) {}
+
+      LazyMessage(const char *message) : message_(message) {}
+
+      template <typename Render,
+                typename = std::enable_if_t<std::is_convertible<
+                    decltype(std::declval<Render>()()),
+                    std::string>::value>>
+      LazyMessage(Render &&render) : render_(std::forward<Render>(render)) {}
+
+      /// @return the message, rendered on the first call
+      const std::string &str() const {
+        if (render_) {
+          message_ = render_();
+          render_ = nullptr;
+        }
+        return message_;
+      }
+
+      operator const std::string &() const {
+        return str();
+      }
+
+     private:
+      mutable std::function<std::string()> render_;
+      mutable std::string message_;
+    };
+
+    inline bool operator==(const LazyMessage &lhs, const std::string &rhs) {
+      return lhs.str() == rhs;
+    }
+
+    inline bool operator==(const std::string &lhs, const LazyMessage &rhs) {
+      return lhs == rhs.str();
+    }
+
+    inline std::ostream &operator<<(std::ostream &os,
+                                    const LazyMessage &message) {
+      return os << message.str();
+    }
   }  // namespace expected
 }  // namespace iroha
 #endif  // IROHA_RESULT_HPP
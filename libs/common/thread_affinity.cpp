@@ -0,0 +1,90 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/thread_affinity.hpp"
+
+#include <cstring>
+
+#include <boost/algorithm/string/split.hpp>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace {
+  /// @return the number, none if the string is not a decimal number
+  boost::optional<unsigned> parseCpu(const std::string &cpu) {
+    if (cpu.empty() or cpu.size() > 6
+        or cpu.find_first_not_of("0123456789") != std::string::npos) {
+      return boost::none;
+    }
+    return static_cast<unsigned>(std::stoul(cpu));
+  }
+}  // namespace
+
+namespace iroha {
+
+  boost::optional<CpuSet> parseCpuSet(const std::string &list) {
+    std::vector<std::string> items;
+    boost::split(items, list, [](char c) { return c == ','; });
+    CpuSet cpus;
+    for (const auto &item : items) {
+      auto dash = item.find('-');
+      auto first = parseCpu(item.substr(0, dash));
+      auto last = dash == std::string::npos ? first
+                                            : parseCpu(item.substr(dash + 1));
+      if (not first or not last or *first > *last) {
+        return boost::none;
+      }
+      for (auto cpu = *first; cpu <= *last; ++cpu) {
+        cpus.push_back(cpu);
+      }
+    }
+    return cpus;
+  }
+
+#ifdef __linux__
+  ScopedCpuAffinity::ScopedCpuAffinity(const CpuSet &cpus) {
+    if (cpus.empty()) {
+      return;
+    }
+    cpu_set_t previous, pinned;
+    CPU_ZERO(&pinned);
+    for (auto cpu : cpus) {
+      if (cpu < CPU_SETSIZE) {
+        CPU_SET(cpu, &pinned);
+      }
+    }
+    ok_ = pthread_getaffinity_np(pthread_self(), sizeof(previous), &previous)
+            == 0
+        and pthread_setaffinity_np(pthread_self(), sizeof(pinned), &pinned)
+            == 0;
+    if (ok_) {
+      pinned_ = true;
+      previous_.resize(sizeof(previous));
+      std::memcpy(previous_.data(), &previous, sizeof(previous));
+    }
+  }
+
+  ScopedCpuAffinity::~ScopedCpuAffinity() {
+    if (pinned_) {
+      cpu_set_t previous;
+      std::memcpy(&previous, previous_.data(), sizeof(previous));
+      pthread_setaffinity_np(pthread_self(), sizeof(previous), &previous);
+    }
+  }
+#else
+  ScopedCpuAffinity::ScopedCpuAffinity(const CpuSet &cpus)
+      : ok_(cpus.empty()) {}
+
+  ScopedCpuAffinity::~ScopedCpuAffinity() = default;
+#endif
+
+  bool ScopedCpuAffinity::ok() const {
+    return ok_;
+  }
+
+}  // namespace iroha
@@ -0,0 +1,64 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_COMMON_THREAD_AFFINITY_HPP
+#define IROHA_COMMON_THREAD_AFFINITY_HPP
+
+#include <string>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+namespace iroha {
+
+  /// indexes of CPUs, empty set leaves threads unpinned
+  using CpuSet = std::vector<unsigned>;
+
+  /**
+   * Parse a list of CPUs in the format of taskset and cpusets, like "0-3,8"
+   * @param list - comma separated CPUs and inclusive ranges of CPUs
+   * @return the CPUs, none if the list is malformed or empty
+   */
+  boost::optional<CpuSet> parseCpuSet(const std::string &list);
+
+  /// CPUs of the groups of threads of the daemon
+  struct ThreadAffinity {
+    CpuSet consensus;
+    CpuSet ordering;
+    CpuSet torii;
+    CpuSet network_client;
+    CpuSet status_bus;
+  };
+
+  /**
+   * Pins the calling thread to the CPUs for the lifetime of the object and
+   * restores the previous affinity after. Threads started meanwhile inherit
+   * the affinity, and the kernel places memory first touched by a thread on
+   * the NUMA node of the CPU it runs on, so components created in the scope
+   * run and allocate on the node of the CPUs. Pinning is supported on Linux
+   * only
+   */
+  class ScopedCpuAffinity {
+   public:
+    explicit ScopedCpuAffinity(const CpuSet &cpus);
+
+    ScopedCpuAffinity(const ScopedCpuAffinity &) = delete;
+    ScopedCpuAffinity &operator=(const ScopedCpuAffinity &) = delete;
+
+    ~ScopedCpuAffinity();
+
+    /// @return false if the CPUs were set but the thread was not pinned
+    bool ok() const;
+
+   private:
+    bool pinned_{false};
+    bool ok_{true};
+    /// affinity mask to restore
+    std::vector<unsigned char> previous_;
+  };
+
+}  // namespace iroha
+
+#endif  // IROHA_COMMON_THREAD_AFFINITY_HPP
@@ -0,0 +1,148 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_COMMON_THREAD_POOL_HPP
+#define IROHA_COMMON_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace iroha {
+
+  /**
+   * Fixed set of worker threads executing data-parallel loops. Several loops
+   * may run concurrently, their items are interleaved on the workers
+   */
+  class ThreadPool {
+   public:
+    /**
+     * @param threads - number of worker threads, 0 means one per hardware
+     * thread
+     */
+    explicit ThreadPool(size_t threads) {
+      if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+      }
+      workers_.reserve(threads);
+      for (size_t i = 0; i < threads; ++i) {
+        workers_.emplace_back([this] { work(); });
+      }
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    ~ThreadPool() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+      }
+      cv_.notify_all();
+      for (auto &worker : workers_) {
+        worker.join();
+      }
+    }
+
+    /// @return number of worker threads
+    size_t size() const {
+      return workers_.size();
+    }
+
+    /**
+     * Calls task(i) for every i in [0, count) using the workers and the
+     * calling thread, and returns when all calls are finished
+     * @param count - number of items
+     * @param task - callable, must not throw
+     */
+    template <typename Task>
+    void parallelFor(size_t count, Task &&task) {
+      if (count == 0) {
+        return;
+      }
+      auto loop = std::make_shared<Loop>(count, std::ref(task));
+      auto helpers = std::min(workers_.size(), count - 1);
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (size_t i = 0; i < helpers; ++i) {
+          loops_.push_back(loop);
+        }
+      }
+      if (helpers == 1) {
+        cv_.notify_one();
+      } else if (helpers > 1) {
+        cv_.notify_all();
+      }
+
+      loop->run();
+
+      std::unique_lock<std::mutex> lock(loop->mutex);
+      loop->finished.wait(lock, [&loop] { return loop->done == loop->count; });
+    }
+
+   private:
+    /// state of a single parallelFor call shared with the workers
+    struct Loop {
+      Loop(size_t count, std::function<void(size_t)> task)
+          : count(count), task(std::move(task)) {}
+
+      /// process items until none are left, the task is not touched after the
+      /// last item is taken, so it may be destroyed by then
+      void run() {
+        size_t processed = 0;
+        for (auto i = next++; i < count; i = next++) {
+          task(i);
+          ++processed;
+        }
+        if (processed != 0) {
+          std::lock_guard<std::mutex> lock(mutex);
+          done += processed;
+          if (done == count) {
+            finished.notify_one();
+          }
+        }
+      }
+
+      const size_t count;
+      std::function<void(size_t)> task;
+      std::atomic<size_t> next{0};
+      size_t done = 0;
+      std::mutex mutex;
+      std::condition_variable finished;
+    };
+
+    void work() {
+      while (true) {
+        std::shared_ptr<Loop> loop;
+        {
+          std::unique_lock<std::mutex> lock(mutex_);
+          cv_.wait(lock, [this] { return stop_ or not loops_.empty(); });
+          if (loops_.empty()) {
+            return;
+          }
+          loop = std::move(loops_.front());
+          loops_.pop_front();
+        }
+        loop->run();
+      }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    /// loops waiting for helpers, one entry per helper
+    std::deque<std::shared_ptr<Loop>> loops_;
+    bool stop_ = false;
+    std::vector<std::thread> workers_;
+  };
+
+}  // namespace iroha
+
+#endif  // IROHA_COMMON_THREAD_POOL_HPP
@@ -0,0 +1,201 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_COMMON_TIMER_WHEEL_HPP
+#define IROHA_COMMON_TIMER_WHEEL_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace iroha {
+
+  /**
+   * Hashed timer wheel running delayed tasks on a single thread. A task is
+   * put into the slot of the ring where its deadline falls, together with
+   * the number of full turns left, so that scheduling and cancellation take
+   * constant time regardless of the number of pending tasks. The thread
+   * sleeps while there are no pending tasks.
+   * A task runs not earlier than its delay and at most one tick later. Tasks
+   * run on the thread of the wheel one after another, so they must be short
+   * and must not block
+   */
+  class TimerWheel {
+   public:
+    /// identifier of a scheduled task, 0 is never returned by schedule
+    using TaskId = uint64_t;
+
+    /**
+     * @param tick - resolution of the wheel
+     * @param slots - number of slots in the ring, delays longer than
+     * tick * slots take several turns
+     */
+    explicit TimerWheel(
+        std::chrono::milliseconds tick = std::chrono::milliseconds(10),
+        size_t slots = 512)
+        : tick_(std::max(tick, std::chrono::milliseconds(1))),
+          slots_(std::max<size_t>(slots, 1)),
+          thread_([this] { work(); }) {}
+
+    TimerWheel(const TimerWheel &) = delete;
+    TimerWheel &operator=(const TimerWheel &) = delete;
+
+    /// Pending tasks are dropped
+    ~TimerWheel() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+      }
+      cv_.notify_all();
+      thread_.join();
+    }
+
+    /**
+     * Run the task after the delay
+     * @param delay - time to wait before running
+     * @param task - callable, must not throw
+     * @return identifier which cancels the task
+     */
+    TaskId schedule(std::chrono::milliseconds delay,
+                    std::function<void()> task) {
+      // the current tick is partially elapsed, so one more is waited for
+      auto ticks = static_cast<size_t>(
+          std::max<std::chrono::milliseconds::rep>(
+              (delay.count() + tick_.count() - 1) / tick_.count(), 0)
+          + 1);
+      bool was_idle;
+      TaskId id;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        was_idle = tasks_.empty();
+        if (was_idle) {
+          // the cursor does not move while idle, restart the ticks from now
+          next_tick_ = std::chrono::steady_clock::now() + tick_;
+        }
+        id = next_id_++;
+        auto &list = slots_[(cursor_ + ticks) % slots_.size()];
+        list.push_back(Task{id, (ticks - 1) / slots_.size(), std::move(task)});
+        tasks_.emplace(id, Position{&list, std::prev(list.end())});
+      }
+      if (was_idle) {
+        cv_.notify_all();
+      }
+      return id;
+    }
+
+    /**
+     * Remove the task if it has not started yet. The task may be running
+     * concurrently when false is returned, use wait to synchronize with it
+     * @param id - identifier returned by schedule
+     * @return true if the task was pending and will not run
+     */
+    bool cancel(TaskId id) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = tasks_.find(id);
+      if (it == tasks_.end()) {
+        return false;
+      }
+      it->second.list->erase(it->second.task);
+      tasks_.erase(it);
+      return true;
+    }
+
+    /**
+     * Wait until the task is not running. Returns immediately when called
+     * from a task, since tasks run one after another
+     * @param id - identifier returned by schedule
+     */
+    void wait(TaskId id) {
+      if (std::this_thread::get_id() == thread_.get_id()) {
+        return;
+      }
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [this, id] { return running_ != id; });
+    }
+
+    /// @return number of pending tasks
+    size_t size() const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      return tasks_.size();
+    }
+
+   private:
+    struct Task {
+      TaskId id;
+      /// full turns of the ring left before the task is due
+      size_t rounds;
+      std::function<void()> run;
+    };
+
+    /// list holding the task, either a slot or the due tasks
+    struct Position {
+      std::list<Task> *list;
+      std::list<Task>::iterator task;
+    };
+
+    void work() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (not stop_) {
+        if (tasks_.empty()) {
+          cv_.wait(lock, [this] { return stop_ or not tasks_.empty(); });
+          continue;
+        }
+        if (cv_.wait_until(lock, next_tick_, [this] { return stop_; })) {
+          break;
+        }
+        next_tick_ += tick_;
+        cursor_ = (cursor_ + 1) % slots_.size();
+
+        auto &list = slots_[cursor_];
+        for (auto it = list.begin(); it != list.end();) {
+          auto task = it++;
+          if (task->rounds > 0) {
+            --task->rounds;
+          } else {
+            due_.splice(due_.end(), list, task);
+            tasks_[task->id].list = &due_;
+          }
+        }
+
+        // due tasks stay cancellable until they are started
+        while (not due_.empty()) {
+          auto task = std::move(due_.front());
+          due_.pop_front();
+          tasks_.erase(task.id);
+
+          running_ = task.id;
+          lock.unlock();
+          task.run();
+          lock.lock();
+          running_ = 0;
+          cv_.notify_all();
+        }
+      }
+    }
+
+    const std::chrono::milliseconds tick_;
+    std::vector<std::list<Task>> slots_;
+    std::list<Task> due_;
+    std::unordered_map<TaskId, Position> tasks_;
+    size_t cursor_{0};
+    TaskId next_id_{1};
+    TaskId running_{0};
+    std::chrono::steady_clock::time_point next_tick_;
+    bool stop_{false};
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::thread thread_;
+  };
+
+}  // namespace iroha
+
+#endif  // IROHA_COMMON_TIMER_WHEEL_HPP
@@ -0,0 +1,234 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_COMMON_WORK_STEALING_EXECUTOR_HPP
+#define IROHA_COMMON_WORK_STEALING_EXECUTOR_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace iroha {
+
+  /**
+   * Fixed set of worker threads shared by several subsystems. Every worker
+   * has its own queue, tasks posted from a worker go to its queue and tasks
+   * posted from other threads are spread between the queues. A worker takes
+   * the newest task of its own queue and steals the oldest tasks of the
+   * other queues when its own is empty.
+   * Subsystems post through lanes, which limit the number of their tasks
+   * running at once, so that a busy subsystem does not occupy all workers.
+   * The executor must outlive its lanes
+   */
+  class WorkStealingExecutor {
+   public:
+    using Task = std::function<void()>;
+
+    /**
+     * Tasks of a single subsystem. Tasks of a lane start in the order they
+     * are posted, a lane with concurrency 1 runs them one after another
+     */
+    class Lane : public std::enable_shared_from_this<Lane> {
+     public:
+      Lane(WorkStealingExecutor &executor, size_t concurrency)
+          : executor_(executor),
+            concurrency_(std::max<size_t>(concurrency, 1)) {}
+
+      /**
+       * Run the task on the executor, or queue it while the lane runs as many
+       * tasks as it may
+       * @param task - callable, must not throw
+       */
+      void post(Task task) {
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          if (running_ >= concurrency_) {
+            queue_.push_back(std::move(task));
+            return;
+          }
+          ++running_;
+        }
+        submit(std::move(task));
+      }
+
+      /// @return number of queued tasks which have not started yet
+      size_t pending() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return queue_.size();
+      }
+
+     private:
+      void submit(Task task) {
+        executor_.post([self = shared_from_this(), task = std::move(task)] {
+          task();
+          self->finished();
+        });
+      }
+
+      /// next task is posted anew instead of run in place to let others run
+      void finished() {
+        Task next;
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          if (queue_.empty()) {
+            --running_;
+            return;
+          }
+          next = std::move(queue_.front());
+          queue_.pop_front();
+        }
+        submit(std::move(next));
+      }
+
+      WorkStealingExecutor &executor_;
+      const size_t concurrency_;
+      size_t running_{0};
+      std::deque<Task> queue_;
+      mutable std::mutex mutex_;
+    };
+
+    /**
+     * @param threads - number of worker threads, 0 means one per hardware
+     * thread
+     */
+    explicit WorkStealingExecutor(size_t threads) {
+      if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+      }
+      queues_.reserve(threads);
+      for (size_t i = 0; i < threads; ++i) {
+        queues_.push_back(std::make_unique<Queue>());
+      }
+      workers_.reserve(threads);
+      for (size_t i = 0; i < threads; ++i) {
+        workers_.emplace_back([this, i] { work(i); });
+      }
+    }
+
+    WorkStealingExecutor(const WorkStealingExecutor &) = delete;
+    WorkStealingExecutor &operator=(const WorkStealingExecutor &) = delete;
+
+    /// Running tasks are waited for, pending tasks are dropped
+    ~WorkStealingExecutor() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_.store(true);
+      }
+      cv_.notify_all();
+      for (auto &worker : workers_) {
+        worker.join();
+      }
+    }
+
+    /// @return number of worker threads
+    size_t size() const {
+      return workers_.size();
+    }
+
+    /**
+     * @param concurrency - maximal number of tasks of the lane running at
+     * once
+     * @return new lane of the executor
+     */
+    std::shared_ptr<Lane> makeLane(size_t concurrency) {
+      return std::make_shared<Lane>(*this, concurrency);
+    }
+
+    /**
+     * Run the task on one of the workers
+     * @param task - callable, must not throw
+     */
+    void post(Task task) {
+      auto &current = currentWorker();
+      auto index = current.executor == this
+          ? current.index
+          : next_queue_.fetch_add(1, std::memory_order_relaxed)
+              % queues_.size();
+      // counted before the push, so that a worker which pops the task right
+      // away does not decrement the counter below zero
+      pending_.fetch_add(1);
+      {
+        auto &queue = *queues_[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks.push_back(std::move(task));
+      }
+      // an idle worker checks pending tasks under the lock before sleeping
+      { std::lock_guard<std::mutex> lock(mutex_); }
+      cv_.notify_one();
+    }
+
+   private:
+    struct Queue {
+      std::mutex mutex;
+      std::deque<Task> tasks;
+    };
+
+    /// executor and queue of the worker running on the current thread
+    struct WorkerId {
+      const WorkStealingExecutor *executor;
+      size_t index;
+    };
+
+    static WorkerId &currentWorker() {
+      static thread_local WorkerId id{nullptr, 0};
+      return id;
+    }
+
+    /// take the newest own task, or steal the oldest task of another worker
+    bool pop(size_t index, Task &task) {
+      {
+        auto &queue = *queues_[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (not queue.tasks.empty()) {
+          task = std::move(queue.tasks.back());
+          queue.tasks.pop_back();
+          return true;
+        }
+      }
+      for (size_t i = 1; i < queues_.size(); ++i) {
+        auto &queue = *queues_[(index + i) % queues_.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (not queue.tasks.empty()) {
+          task = std::move(queue.tasks.front());
+          queue.tasks.pop_front();
+          return true;
+        }
+      }
+      return false;
+    }
+
+    void work(size_t index) {
+      currentWorker() = WorkerId{this, index};
+      while (not stop_.load()) {
+        Task task;
+        if (pop(index, task)) {
+          pending_.fetch_sub(1);
+          task();
+          continue;
+        }
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this] { return stop_.load() or pending_.load() > 0; });
+      }
+    }
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::atomic<size_t> next_queue_{0};
+    /// number of tasks in all queues, including the ones being pushed
+    std::atomic<size_t> pending_{0};
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::atomic<bool> stop_{false};
+    std::vector<std::thread> workers_;
+  };
+
+}  // namespace iroha
+
+#endif  // IROHA_COMMON_WORK_STEALING_EXECUTOR_HPP
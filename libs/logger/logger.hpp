@@ -51,38 +51,43 @@ namespace logger {
     // --- Logging functions ---
 
     template <typename... Args>
-    void trace(const std::string &format, const Args &... args) const {
+    void trace(fmt::string_view format, const Args &... args) const {
       log(LogLevel::kTrace, format, args...);
     }
 
     template <typename... Args>
-    void debug(const std::string &format, const Args &... args) const {
+    void debug(fmt::string_view format, const Args &... args) const {
       log(LogLevel::kDebug, format, args...);
     }
 
     template <typename... Args>
-    void info(const std::string &format, const Args &... args) const {
+    void info(fmt::string_view format, const Args &... args) const {
       log(LogLevel::kInfo, format, args...);
     }
 
     template <typename... Args>
-    void warn(const std::string &format, const Args &... args) const {
+    void warn(fmt::string_view format, const Args &... args) const {
       log(LogLevel::kWarn, format, args...);
     }
 
     template <typename... Args>
-    void error(const std::string &format, const Args &... args) const {
+    void error(fmt::string_view format, const Args &... args) const {
       log(LogLevel::kError, format, args...);
     }
 
     template <typename... Args>
-    void critical(const std::string &format, const Args &... args) const {
+    void critical(fmt::string_view format, const Args &... args) const {
       log(LogLevel::kCritical, format, args...);
     }
 
+    /**
+     * Format and write the message if the level is enabled. The format is
+     * taken as a view, so calls with a disabled level neither allocate nor
+     * format anything
+     */
     template <typename... Args>
     void log(Level level,
-             const std::string &format,
+             fmt::string_view format,
              const Args &... args) const {
       if (shouldLog(level)) {
         try {
@@ -163,6 +168,35 @@ namespace logger {
     return opt ? null_value : transform(*opt);
   }
 
+  /**
+   * Argument of a logging call, which is rendered only when the message is
+   * written, so that disabled levels cost no string building
+   * @tparam Render - callable returning the string representation
+   */
+  template <typename Render>
+  class LazyArgument {
+   public:
+    explicit LazyArgument(Render render) : render_(std::move(render)) {}
+
+    std::string toString() const {
+      return render_();
+    }
+
+   private:
+    Render render_;
+  };
+
+  /**
+   * Make a lazily rendered logging argument, e.g.
+   * log.debug("{}", logger::lazy([&] { return hash.hex(); }))
+   * @param render - callable returning the string representation, it is
+   * called within the logging call, so it may capture by reference
+   */
+  template <typename Render>
+  LazyArgument<Render> lazy(Render render) {
+    return LazyArgument<Render>(std::move(render));
+  }
+
 }  // namespace logger
 
 #endif  // IROHA_LOGGER_LOGGER_HPP
@@ -11,6 +11,7 @@
 
 #define SPDLOG_FMT_EXTERNAL
 
+#include <spdlog/async.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 #include <spdlog/spdlog.h>
 #include <boost/assert.hpp>
@@ -37,10 +38,31 @@ namespace {
     }
   }
 
-  std::shared_ptr<spdlog::logger> getOrCreateLogger(const std::string tag) {
+  std::shared_ptr<spdlog::logger> createLogger(
+      const std::string &tag,
+      const boost::optional<logger::AsyncLogConfig> &async) {
+    if (not async) {
+      return spdlog::stdout_color_mt(tag);
+    }
+    static std::once_flag thread_pool_initialized;
+    std::call_once(thread_pool_initialized, [&async] {
+      spdlog::init_thread_pool(async->queue_size, 1);
+    });
+    switch (async->overflow_policy) {
+      case logger::LogOverflowPolicy::kDropOldest:
+        return spdlog::stdout_color_mt<spdlog::async_factory_nonblock>(tag);
+      case logger::LogOverflowPolicy::kBlock:
+      default:
+        return spdlog::stdout_color_mt<spdlog::async_factory>(tag);
+    }
+  }
+
+  std::shared_ptr<spdlog::logger> getOrCreateLogger(
+      const std::string tag,
+      const boost::optional<logger::AsyncLogConfig> &async) {
     std::shared_ptr<spdlog::logger> logger;
     try {
-      logger = spdlog::stdout_color_mt(tag);
+      logger = createLogger(tag, async);
     } catch (const spdlog::spdlog_ex &) {
       logger = spdlog::get(tag);
     }
@@ -91,7 +113,9 @@ namespace logger {
   }
 
   LoggerSpdlog::LoggerSpdlog(std::string tag, ConstLoggerConfigPtr config)
-      : tag_(tag), config_(std::move(config)), logger_(getOrCreateLogger(tag)) {
+      : tag_(tag),
+        config_(std::move(config)),
+        logger_(getOrCreateLogger(tag, config_->async)) {
     setupLogger();
   }
 
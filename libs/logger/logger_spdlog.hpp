@@ -12,6 +12,8 @@
 #include <memory>
 #include <string>
 
+#include <boost/optional.hpp>
+
 namespace spdlog {
   class logger;
 }
@@ -45,10 +47,30 @@ namespace logger {
     std::map<LogLevel, std::string> patterns_;
   };
 
+  /// What asynchronous logging does when its queue is full
+  enum class LogOverflowPolicy {
+    /// wait until the writer thread frees space in the queue
+    kBlock,
+    /// replace the oldest queued message
+    kDropOldest,
+  };
+
+  /// Parameters of logging in a background thread
+  struct AsyncLogConfig {
+    /// number of messages the queue holds
+    size_t queue_size;
+    LogOverflowPolicy overflow_policy;
+  };
+
   // TODO mboldyrev 29.12.2018 IR-188 Add sink options (console, file, syslog)
   struct LoggerConfig {
     LogLevel log_level;
     LogPatterns patterns;
+    /// messages are formatted in the calling thread and written by a single
+    /// background thread, which is shared by all the loggers and created
+    /// with the parameters of the first asynchronous one; synchronous
+    /// writing if not set
+    boost::optional<AsyncLogConfig> async = boost::none;
   };
 
   class LoggerSpdlog : public Logger {
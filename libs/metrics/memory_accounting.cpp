@@ -0,0 +1,173 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "metrics/memory_accounting.hpp"
+
+#include <malloc.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <fstream>
+
+#include "metrics/metrics.hpp"
+
+// the allocators are detected at run time, so that the library is built
+// without their headers whichever of them irohad is linked with
+extern "C" {
+int mallctl(const char *name,
+            void *oldp,
+            size_t *oldlenp,
+            void *newp,
+            size_t newlen) __attribute__((weak));
+void mi_process_info(size_t *elapsed_msecs,
+                     size_t *user_msecs,
+                     size_t *system_msecs,
+                     size_t *current_rss,
+                     size_t *peak_rss,
+                     size_t *current_commit,
+                     size_t *peak_commit,
+                     size_t *page_faults) __attribute__((weak));
+}
+
+namespace {
+  /// counters of bytes allocated and freed by the thread kept by jemalloc
+  struct ThreadCounters {
+    uint64_t *allocated = nullptr;
+    uint64_t *deallocated = nullptr;
+  };
+
+  const ThreadCounters &threadCounters() {
+    thread_local ThreadCounters counters = [] {
+      ThreadCounters counters;
+      if (mallctl == nullptr) {
+        return counters;
+      }
+      size_t size = sizeof(uint64_t *);
+      auto get = [&size](const char *name, uint64_t **counter) {
+        return mallctl(name, counter, &size, nullptr, 0) == 0;
+      };
+      if (not get("thread.allocatedp", &counters.allocated)
+          or not get("thread.deallocatedp", &counters.deallocated)) {
+        return ThreadCounters{};
+      }
+      return counters;
+    }();
+    return counters;
+  }
+
+  /// whether the thread is in a memory scope
+  thread_local bool in_scope = false;
+
+  /// @return value of the jemalloc statistic, 0 if it is not available
+  size_t jemallocStatistic(const char *name) {
+    size_t value = 0;
+    size_t size = sizeof(value);
+    if (mallctl(name, &value, &size, nullptr, 0) != 0) {
+      return 0;
+    }
+    return value;
+  }
+
+  /// @return resident set size of the process in bytes, 0 if unknown
+  size_t residentMemory() {
+    std::ifstream statm("/proc/self/statm");
+    size_t size = 0, resident = 0;
+    if (not(statm >> size >> resident)) {
+      return 0;
+    }
+    return resident * sysconf(_SC_PAGESIZE);
+  }
+}  // namespace
+
+namespace iroha {
+  namespace metrics {
+
+    MemoryAccount::MemoryAccount(Registry &registry,
+                                 const std::string &subsystem)
+        : allocated_(registry.counter(
+              "iroha_memory_" + subsystem + "_allocated_bytes_total",
+              "Bytes allocated by the " + subsystem + " subsystem")),
+          owned_(registry.gauge(
+              "iroha_memory_" + subsystem + "_bytes",
+              "Bytes allocated and not freed by the " + subsystem
+                  + " subsystem")) {}
+
+    void MemoryAccount::add(uint64_t allocated, uint64_t deallocated) {
+      allocated_.increment(allocated);
+      owned_.add(static_cast<int64_t>(allocated)
+                 - static_cast<int64_t>(deallocated));
+    }
+
+    MemoryScope::MemoryScope(MemoryAccount &account)
+        : account_(nullptr), allocated_(0), deallocated_(0) {
+      const auto &counters = threadCounters();
+      if (in_scope or counters.allocated == nullptr) {
+        return;
+      }
+      in_scope = true;
+      account_ = &account;
+      allocated_ = *counters.allocated;
+      deallocated_ = *counters.deallocated;
+    }
+
+    MemoryScope::~MemoryScope() {
+      if (account_ == nullptr) {
+        return;
+      }
+      const auto &counters = threadCounters();
+      account_->add(*counters.allocated - allocated_,
+                    *counters.deallocated - deallocated_);
+      in_scope = false;
+    }
+
+    const char *allocatorName() {
+      if (mallctl != nullptr) {
+        return "jemalloc";
+      }
+      if (mi_process_info != nullptr) {
+        return "mimalloc";
+      }
+      return "system";
+    }
+
+    void registerAllocatorMetrics(Registry &registry) {
+      auto &allocated = registry.gauge(
+          "iroha_memory_allocated_bytes",
+          "Bytes allocated by the application from the heap");
+      auto &resident = registry.gauge(
+          "iroha_memory_resident_bytes",
+          "Bytes of physical memory held by the allocator or the process");
+      registry.addCollector([&allocated, &resident] {
+        if (mallctl != nullptr) {
+          // statistics of jemalloc are refreshed by writing the epoch
+          uint64_t epoch = 1;
+          size_t size = sizeof(epoch);
+          mallctl("epoch", &epoch, &size, &epoch, size);
+          allocated.set(jemallocStatistic("stats.allocated"));
+          resident.set(jemallocStatistic("stats.resident"));
+        } else if (mi_process_info != nullptr) {
+          size_t elapsed, user, system, current_rss, peak_rss, current_commit,
+              peak_commit, page_faults;
+          mi_process_info(&elapsed,
+                          &user,
+                          &system,
+                          &current_rss,
+                          &peak_rss,
+                          &current_commit,
+                          &peak_commit,
+                          &page_faults);
+          allocated.set(current_commit);
+          resident.set(current_rss);
+        } else {
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+          allocated.set(mallinfo2().uordblks);
+#endif
+          resident.set(residentMemory());
+        }
+      });
+    }
+
+  }  // namespace metrics
+}  // namespace iroha
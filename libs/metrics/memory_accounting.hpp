@@ -0,0 +1,77 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_MEMORY_ACCOUNTING_HPP
+#define IROHA_MEMORY_ACCOUNTING_HPP
+
+#include <cstdint>
+#include <string>
+
+namespace iroha {
+  namespace metrics {
+
+    class Counter;
+    class Gauge;
+    class Registry;
+
+    /**
+     * Heap memory of a subsystem, exposed with the metrics
+     * iroha_memory_<subsystem>_allocated_bytes_total and
+     * iroha_memory_<subsystem>_bytes, the latter being the bytes allocated
+     * and not freed in the scopes of the subsystem. Allocations are counted
+     * per thread by jemalloc, so the accounting works only when irohad is
+     * linked with it, and the metrics stay zero otherwise
+     */
+    class MemoryAccount {
+     public:
+      /**
+       * @param registry - registry of the metrics
+       * @param subsystem - name of the subsystem, a valid part of a metric
+       * name
+       */
+      MemoryAccount(Registry &registry, const std::string &subsystem);
+
+      /// Add the bytes allocated and freed by a scope of the subsystem
+      void add(uint64_t allocated, uint64_t deallocated);
+
+     private:
+      Counter &allocated_;
+      Gauge &owned_;
+    };
+
+    /**
+     * Accounts the memory allocated and freed by the thread during its
+     * lifetime to the subsystem. Scopes nested into a scope on the same
+     * thread are accounted to the outer one
+     */
+    class MemoryScope {
+     public:
+      explicit MemoryScope(MemoryAccount &account);
+
+      MemoryScope(const MemoryScope &) = delete;
+      MemoryScope &operator=(const MemoryScope &) = delete;
+
+      ~MemoryScope();
+
+     private:
+      MemoryAccount *account_;
+      uint64_t allocated_;
+      uint64_t deallocated_;
+    };
+
+    /// @return name of the allocator irohad runs with
+    const char *allocatorName();
+
+    /**
+     * Expose the statistics of the allocator with the gauges
+     * iroha_memory_allocated_bytes and iroha_memory_resident_bytes, which
+     * are updated when the metrics are collected
+     */
+    void registerAllocatorMetrics(Registry &registry);
+
+  }  // namespace metrics
+}  // namespace iroha
+
+#endif  // IROHA_MEMORY_ACCOUNTING_HPP
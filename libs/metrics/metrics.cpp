@@ -0,0 +1,180 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "metrics/metrics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+
+namespace iroha {
+  namespace metrics {
+
+    constexpr unsigned Histogram::kSubBucketBits;
+    constexpr uint64_t Histogram::kSubBuckets;
+    constexpr size_t Histogram::kBuckets;
+
+    size_t Histogram::bucketIndex(uint64_t value) {
+      if (value < kSubBuckets) {
+        return static_cast<size_t>(value);
+      }
+      unsigned highest_bit = 63 - __builtin_clzll(value);
+      unsigned shift = highest_bit - kSubBucketBits;
+      // the value shifted is in [kSubBuckets, 2 * kSubBuckets)
+      return static_cast<size_t>(kSubBuckets * (shift + 1)
+                                 + ((value >> shift) - kSubBuckets));
+    }
+
+    uint64_t Histogram::bucketUpperBound(size_t index) {
+      if (index < kSubBuckets) {
+        return index;
+      }
+      auto shift = index / kSubBuckets - 1;
+      auto sub_bucket = index % kSubBuckets;
+      // wraps to the maximum value for the last bucket
+      return ((kSubBuckets + sub_bucket + 1) << shift) - 1;
+    }
+
+    void Histogram::record(uint64_t value) {
+      buckets_[bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+      sum_.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    Histogram::Snapshot Histogram::snapshot() const {
+      std::array<uint64_t, kBuckets> counts;
+      size_t last = 0;
+      for (size_t i = 0; i < kBuckets; ++i) {
+        counts[i] = buckets_[i].load(std::memory_order_relaxed);
+        if (counts[i] != 0) {
+          last = i;
+        }
+      }
+
+      Snapshot snapshot{{}, 0, sum_.load(std::memory_order_relaxed)};
+      for (size_t i = 0; i < kBuckets; ++i) {
+        snapshot.count += counts[i];
+        auto upper_bound = bucketUpperBound(i);
+        // only bounds of the power of two ranges are reported
+        if ((upper_bound & (upper_bound + 1)) == 0) {
+          snapshot.cumulative.emplace_back(upper_bound, snapshot.count);
+          if (i >= last) {
+            break;
+          }
+        }
+      }
+      return snapshot;
+    }
+
+    uint64_t Histogram::quantile(double quantile) const {
+      std::array<uint64_t, kBuckets> counts;
+      uint64_t total = 0;
+      for (size_t i = 0; i < kBuckets; ++i) {
+        counts[i] = buckets_[i].load(std::memory_order_relaxed);
+        total += counts[i];
+      }
+      if (total == 0) {
+        return 0;
+      }
+      auto rank = static_cast<uint64_t>(
+          std::ceil(std::min(std::max(quantile, 0.), 1.) * total));
+      uint64_t seen = 0;
+      for (size_t i = 0; i < kBuckets; ++i) {
+        seen += counts[i];
+        if (seen >= std::max<uint64_t>(rank, 1)) {
+          return bucketUpperBound(i);
+        }
+      }
+      return bucketUpperBound(kBuckets - 1);
+    }
+
+    void Histogram::reset() {
+      for (auto &bucket : buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+      }
+      sum_.store(0, std::memory_order_relaxed);
+    }
+
+    template <typename Metric>
+    Metric &Registry::get(std::map<std::string, Entry<Metric>> &metrics,
+                          const std::string &name,
+                          const std::string &help) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto &entry = metrics[name];
+      if (not entry.metric) {
+        entry.help = help;
+        entry.metric = std::make_unique<Metric>();
+      }
+      return *entry.metric;
+    }
+
+    Counter &Registry::counter(const std::string &name,
+                               const std::string &help) {
+      return get(counters_, name, help);
+    }
+
+    Gauge &Registry::gauge(const std::string &name, const std::string &help) {
+      return get(gauges_, name, help);
+    }
+
+    Histogram &Registry::histogram(const std::string &name,
+                                   const std::string &help) {
+      return get(histograms_, name, help);
+    }
+
+    void Registry::addCollector(std::function<void()> collector) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      collectors_.push_back(std::move(collector));
+    }
+
+    std::string Registry::serialize() const {
+      // collectors update metrics, which they may look up under the lock
+      std::vector<std::function<void()>> collectors;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        collectors = collectors_;
+      }
+      for (const auto &collector : collectors) {
+        collector();
+      }
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      std::ostringstream out;
+      auto header = [&](const std::string &name,
+                        const std::string &help,
+                        const char *type) {
+        out << "# HELP " << name << ' ' << help << "\n# TYPE " << name << ' '
+            << type << '\n';
+      };
+
+      for (const auto &counter : counters_) {
+        header(counter.first, counter.second.help, "counter");
+        out << counter.first << ' ' << counter.second.metric->value() << '\n';
+      }
+      for (const auto &gauge : gauges_) {
+        header(gauge.first, gauge.second.help, "gauge");
+        out << gauge.first << ' ' << gauge.second.metric->value() << '\n';
+      }
+      for (const auto &histogram : histograms_) {
+        const auto &name = histogram.first;
+        header(name, histogram.second.help, "histogram");
+        auto snapshot = histogram.second.metric->snapshot();
+        for (const auto &bucket : snapshot.cumulative) {
+          out << name << "_bucket{le=\"" << bucket.first << "\"} "
+              << bucket.second << '\n';
+        }
+        out << name << "_bucket{le=\"+Inf\"} " << snapshot.count << '\n'
+            << name << "_sum " << snapshot.sum << '\n'
+            << name << "_count " << snapshot.count << '\n';
+      }
+      return out.str();
+    }
+
+    Registry &registry() {
+      static Registry registry;
+      return registry;
+    }
+
+  }  // namespace metrics
+}  // namespace iroha
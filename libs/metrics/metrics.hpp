@@ -0,0 +1,177 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_METRICS_HPP
+#define IROHA_METRICS_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace iroha {
+  namespace metrics {
+
+    /// Monotonically increasing value
+    class Counter {
+     public:
+      void increment(uint64_t value = 1) {
+        value_.fetch_add(value, std::memory_order_relaxed);
+      }
+
+      uint64_t value() const {
+        return value_.load(std::memory_order_relaxed);
+      }
+
+     private:
+      std::atomic<uint64_t> value_{0};
+    };
+
+    /// Value which can go up and down
+    class Gauge {
+     public:
+      void set(int64_t value) {
+        value_.store(value, std::memory_order_relaxed);
+      }
+
+      void add(int64_t value) {
+        value_.fetch_add(value, std::memory_order_relaxed);
+      }
+
+      int64_t value() const {
+        return value_.load(std::memory_order_relaxed);
+      }
+
+     private:
+      std::atomic<int64_t> value_{0};
+    };
+
+    /**
+     * Distribution of non-negative integer values. As in HDR histograms,
+     * every power of two range is split into kSubBuckets linear buckets, so
+     * the recorded values are known with relative error below
+     * 1 / kSubBuckets for the whole 64 bit range. Recording is wait-free
+     */
+    class Histogram {
+     public:
+      static constexpr unsigned kSubBucketBits = 3;
+      static constexpr uint64_t kSubBuckets = 1u << kSubBucketBits;
+      static constexpr size_t kBuckets =
+          kSubBuckets * (64 - kSubBucketBits + 1);
+
+      /// state of the histogram at some moment
+      struct Snapshot {
+        /// upper bound of the bucket and number of values up to it
+        std::vector<std::pair<uint64_t, uint64_t>> cumulative;
+        uint64_t count;
+        uint64_t sum;
+      };
+
+      void record(uint64_t value);
+
+      /**
+       * @return counts of values up to 2^k - 1 for every k up to the
+       * largest recorded value
+       */
+      Snapshot snapshot() const;
+
+      /**
+       * @param quantile - from 0 to 1
+       * @return upper bound of the bucket holding the quantile of recorded
+       * values, 0 if nothing is recorded
+       */
+      uint64_t quantile(double quantile) const;
+
+      /// forget the recorded values, values recorded concurrently may be lost
+      void reset();
+
+      /// @return index of the bucket holding the value
+      static size_t bucketIndex(uint64_t value);
+
+      /// @return largest value of the bucket
+      static uint64_t bucketUpperBound(size_t index);
+
+     private:
+      std::array<std::atomic<uint64_t>, kBuckets> buckets_{};
+      std::atomic<uint64_t> sum_{0};
+    };
+
+    /// Records microseconds passed from its construction to its destruction
+    class ScopedTimer {
+     public:
+      explicit ScopedTimer(Histogram &histogram)
+          : histogram_(histogram), start_(std::chrono::steady_clock::now()) {}
+
+      ScopedTimer(const ScopedTimer &) = delete;
+      ScopedTimer &operator=(const ScopedTimer &) = delete;
+
+      ~ScopedTimer() {
+        histogram_.record(std::chrono::duration_cast<std::chrono::microseconds>(
+                              std::chrono::steady_clock::now() - start_)
+                              .count());
+      }
+
+     private:
+      Histogram &histogram_;
+      std::chrono::steady_clock::time_point start_;
+    };
+
+    /**
+     * Named metrics exposed together. Looking a metric up takes a lock, so
+     * components look their metrics up once and keep the references, which
+     * stay valid for the lifetime of the registry. Metrics with the same
+     * name are shared
+     */
+    class Registry {
+     public:
+      Counter &counter(const std::string &name, const std::string &help);
+
+      Gauge &gauge(const std::string &name, const std::string &help);
+
+      Histogram &histogram(const std::string &name, const std::string &help);
+
+      /**
+       * Add a function updating metrics whose values are read from outside,
+       * such as statistics of the allocator. Collectors are called before
+       * the metrics are serialized
+       */
+      void addCollector(std::function<void()> collector);
+
+      /// @return all metrics in Prometheus text exposition format
+      std::string serialize() const;
+
+     private:
+      template <typename Metric>
+      struct Entry {
+        std::string help;
+        std::unique_ptr<Metric> metric;
+      };
+
+      template <typename Metric>
+      Metric &get(std::map<std::string, Entry<Metric>> &metrics,
+                  const std::string &name,
+                  const std::string &help);
+
+      mutable std::mutex mutex_;
+      std::vector<std::function<void()>> collectors_;
+      std::map<std::string, Entry<Counter>> counters_;
+      std::map<std::string, Entry<Gauge>> gauges_;
+      std::map<std::string, Entry<Histogram>> histograms_;
+    };
+
+    /// @return registry of the process
+    Registry &registry();
+
+  }  // namespace metrics
+}  // namespace iroha
+
+#endif  // IROHA_METRICS_HPP
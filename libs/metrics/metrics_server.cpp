@@ -0,0 +1,167 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "metrics/metrics_server.hpp"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+#include "logger/logger.hpp"
+#include "metrics/metrics.hpp"
+
+namespace {
+  /// how often the serving thread checks whether it should stop
+  constexpr int kPollTimeoutMs = 200;
+  /// longest request head which is read
+  constexpr size_t kMaxRequestSize = 8192;
+  /// time given to a client to send the request
+  constexpr time_t kReceiveTimeoutSec = 1;
+
+  bool sendAll(int connection, const std::string &data) {
+    size_t sent = 0;
+    while (sent < data.size()) {
+      auto result = ::send(
+          connection, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+      if (result < 0 and errno == EINTR) {
+        continue;
+      }
+      if (result <= 0) {
+        return false;
+      }
+      sent += static_cast<size_t>(result);
+    }
+    return true;
+  }
+
+  std::string response(const char *status,
+                       const char *content_type,
+                       const std::string &body) {
+    return std::string("HTTP/1.1 ") + status + "\r\nContent-Type: "
+        + content_type + "\r\nContent-Length: " + std::to_string(body.size())
+        + "\r\nConnection: close\r\n\r\n" + body;
+  }
+}  // namespace
+
+namespace iroha {
+  namespace metrics {
+
+    MetricsServer::MetricsServer(const Registry &registry,
+                                 logger::LoggerPtr log)
+        : registry_(registry),
+          log_(std::move(log)),
+          socket_(-1),
+          stop_(false) {}
+
+    MetricsServer::~MetricsServer() {
+      stop_ = true;
+      if (thread_.joinable()) {
+        thread_.join();
+      }
+      if (socket_ >= 0) {
+        ::close(socket_);
+      }
+    }
+
+    expected::Result<uint16_t, std::string> MetricsServer::run(
+        const std::string &address, uint16_t port) {
+      sockaddr_in socket_address{};
+      socket_address.sin_family = AF_INET;
+      socket_address.sin_port = htons(port);
+      if (::inet_pton(AF_INET, address.c_str(), &socket_address.sin_addr)
+          != 1) {
+        return expected::makeError("Invalid address " + address);
+      }
+
+      socket_ = ::socket(AF_INET, SOCK_STREAM, 0);
+      if (socket_ < 0) {
+        return expected::makeError(std::string("Cannot create socket: ")
+                                   + std::strerror(errno));
+      }
+      int reuse = 1;
+      ::setsockopt(socket_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+      socklen_t length = sizeof(socket_address);
+      if (::bind(socket_,
+                 reinterpret_cast<sockaddr *>(&socket_address),
+                 sizeof(socket_address))
+              != 0
+          or ::listen(socket_, SOMAXCONN) != 0
+          or ::getsockname(socket_,
+                           reinterpret_cast<sockaddr *>(&socket_address),
+                           &length)
+              != 0) {
+        return expected::makeError("Cannot listen on " + address + ":"
+                                   + std::to_string(port) + ": "
+                                   + std::strerror(errno));
+      }
+
+      thread_ = std::thread([this] { serve(); });
+      return expected::makeValue(uint16_t{ntohs(socket_address.sin_port)});
+    }
+
+    void MetricsServer::serve() {
+      pollfd listening{socket_, POLLIN, 0};
+      while (not stop_) {
+        listening.revents = 0;
+        auto ready = ::poll(&listening, 1, kPollTimeoutMs);
+        if (ready <= 0) {
+          continue;
+        }
+        auto connection = ::accept(socket_, nullptr, nullptr);
+        if (connection < 0) {
+          continue;
+        }
+        handle(connection);
+        ::close(connection);
+      }
+    }
+
+    void MetricsServer::handle(int connection) {
+      timeval timeout{kReceiveTimeoutSec, 0};
+      ::setsockopt(
+          connection, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+      std::string request;
+      char buffer[1024];
+      while (request.find("\r\n\r\n") == std::string::npos
+             and request.size() < kMaxRequestSize) {
+        auto received = ::recv(connection, buffer, sizeof(buffer), 0);
+        if (received < 0 and errno == EINTR) {
+          continue;
+        }
+        if (received <= 0) {
+          break;
+        }
+        request.append(buffer, static_cast<size_t>(received));
+      }
+
+      auto line_end = request.find("\r\n");
+      if (line_end == std::string::npos) {
+        return;
+      }
+      auto request_line = request.substr(0, line_end);
+      std::string reply;
+      if (request_line.compare(0, 13, "GET /metrics ") == 0) {
+        reply = response("200 OK",
+                         "text/plain; version=0.0.4; charset=utf-8",
+                         registry_.serialize());
+      } else if (request_line.compare(0, 4, "GET ") == 0) {
+        reply = response("404 Not Found", "text/plain", "Not Found\n");
+      } else {
+        reply = response(
+            "405 Method Not Allowed", "text/plain", "Method Not Allowed\n");
+      }
+      if (not sendAll(connection, reply)) {
+        log_->warn("Failed to send metrics: {}", std::strerror(errno));
+      }
+    }
+
+  }  // namespace metrics
+}  // namespace iroha
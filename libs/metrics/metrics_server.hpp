@@ -0,0 +1,65 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_METRICS_SERVER_HPP
+#define IROHA_METRICS_SERVER_HPP
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "common/result.hpp"
+#include "logger/logger_fwd.hpp"
+
+namespace iroha {
+  namespace metrics {
+
+    class Registry;
+
+    /**
+     * Minimal HTTP server answering GET /metrics with the metrics of the
+     * registry in Prometheus text format. Requests are served one by one on
+     * a single thread, which is enough for periodic scraping
+     */
+    class MetricsServer {
+     public:
+      /**
+       * @param registry - metrics to expose, must outlive the server
+       * @param log - logger
+       */
+      MetricsServer(const Registry &registry, logger::LoggerPtr log);
+
+      MetricsServer(const MetricsServer &) = delete;
+      MetricsServer &operator=(const MetricsServer &) = delete;
+
+      /// stops serving and waits for the serving thread
+      ~MetricsServer();
+
+      /**
+       * Start serving on the given address
+       * @param address - IPv4 address to listen on
+       * @param port - port to listen on, 0 to choose any free port
+       * @return port the server listens on or error description
+       */
+      expected::Result<uint16_t, std::string> run(const std::string &address,
+                                                  uint16_t port);
+
+     private:
+      void serve();
+
+      void handle(int connection);
+
+      const Registry &registry_;
+      logger::LoggerPtr log_;
+      int socket_;
+      std::atomic<bool> stop_;
+      std::thread thread_;
+    };
+
+  }  // namespace metrics
+}  // namespace iroha
+
+#endif  // IROHA_METRICS_SERVER_HPP
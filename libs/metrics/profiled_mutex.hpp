@@ -0,0 +1,146 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PROFILED_MUTEX_HPP
+#define IROHA_PROFILED_MUTEX_HPP
+
+#include <chrono>
+#include <string>
+
+#ifdef IROHA_PROFILE_LOCKS
+#include "metrics/metrics.hpp"
+#endif
+
+namespace iroha {
+  namespace metrics {
+
+#ifdef IROHA_PROFILE_LOCKS
+    /**
+     * Histograms of a named lock: iroha_<name>_lock_wait_microseconds of
+     * waiting for the lock in any mode and iroha_<name>_lock_hold_microseconds
+     * of exclusive ownership. Locks with the same name share histograms
+     */
+    class LockProfile {
+     public:
+      using TimePoint = std::chrono::steady_clock::time_point;
+
+      explicit LockProfile(const std::string &name)
+          : wait_time_(registry().histogram(
+                "iroha_" + name + "_lock_wait_microseconds",
+                "Time spent waiting for the " + name + " lock")),
+            hold_time_(registry().histogram(
+                "iroha_" + name + "_lock_hold_microseconds",
+                "Time the " + name + " lock is held exclusively")) {}
+
+      static TimePoint now() {
+        return std::chrono::steady_clock::now();
+      }
+
+      /// record waiting since start, the lock is acquired exclusively
+      void acquired(TimePoint start) {
+        acquired_ = now();
+        wait_time_.record(microseconds(acquired_ - start));
+      }
+
+      /// record waiting since start, the lock is acquired shared
+      void acquiredShared(TimePoint start) {
+        wait_time_.record(microseconds(now() - start));
+      }
+
+      /// record exclusive ownership, before the lock is released
+      void released() {
+        hold_time_.record(microseconds(now() - acquired_));
+      }
+
+     private:
+      static uint64_t microseconds(std::chrono::steady_clock::duration d) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(d)
+            .count();
+      }
+
+      Histogram &wait_time_;
+      Histogram &hold_time_;
+      /// written and read by the exclusive owner only
+      TimePoint acquired_;
+    };
+#else
+    /// Lock profile which records nothing, locks are not profiled
+    class LockProfile {
+     public:
+      struct TimePoint {};
+
+      explicit LockProfile(const std::string &) {}
+
+      static TimePoint now() {
+        return {};
+      }
+
+      void acquired(TimePoint) {}
+
+      void acquiredShared(TimePoint) {}
+
+      void released() {}
+    };
+#endif
+
+    /**
+     * Mutex which records time spent waiting for it and holding it, to find
+     * the locks limiting scaling. Recording is compiled in by the
+     * PROFILE_LOCKS build option, otherwise the wrapper costs nothing. Time
+     * of shared ownership is not recorded, since shared owners overlap
+     * @tparam Mutex - std::mutex, std::shared_timed_mutex or alike
+     */
+    template <typename Mutex>
+    class ProfiledMutex {
+     public:
+      /// @param name - name of the lock, a valid part of a metric name
+      explicit ProfiledMutex(const std::string &name) : profile_(name) {}
+
+      ProfiledMutex(const ProfiledMutex &) = delete;
+      ProfiledMutex &operator=(const ProfiledMutex &) = delete;
+
+      void lock() {
+        auto start = LockProfile::now();
+        mutex_.lock();
+        profile_.acquired(start);
+      }
+
+      bool try_lock() {
+        auto start = LockProfile::now();
+        if (not mutex_.try_lock()) {
+          return false;
+        }
+        profile_.acquired(start);
+        return true;
+      }
+
+      void unlock() {
+        profile_.released();
+        mutex_.unlock();
+      }
+
+      void lock_shared() {
+        auto start = LockProfile::now();
+        mutex_.lock_shared();
+        profile_.acquiredShared(start);
+      }
+
+      bool try_lock_shared() {
+        return mutex_.try_lock_shared();
+      }
+
+      void unlock_shared() {
+        mutex_.unlock_shared();
+      }
+
+     private:
+      Mutex mutex_;
+      LockProfile profile_;
+    };
+
+  }  // namespace metrics
+}  // namespace iroha
+
+#endif  // IROHA_PROFILED_MUTEX_HPP
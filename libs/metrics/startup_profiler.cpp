@@ -0,0 +1,69 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "metrics/startup_profiler.hpp"
+
+#include <unistd.h>
+
+#include <fstream>
+#include <sstream>
+
+#include "metrics/metrics.hpp"
+
+namespace iroha {
+  namespace metrics {
+
+    StartupProfiler::StartupProfiler(Registry &registry)
+        : registry_(registry) {}
+
+    void StartupProfiler::record(const std::string &name,
+                                 std::chrono::milliseconds duration,
+                                 int64_t rss_growth) {
+      phases_.push_back({name, duration, rss_growth});
+      registry_
+          .gauge("iroha_startup_" + name + "_milliseconds",
+                 "Wall time of the " + name + " startup phase")
+          .set(duration.count());
+      registry_
+          .gauge("iroha_startup_" + name + "_rss_bytes",
+                 "Growth of resident memory in the " + name
+                     + " startup phase")
+          .set(rss_growth);
+      registry_
+          .gauge("iroha_startup_milliseconds",
+                 "Wall time of the recorded startup phases")
+          .add(duration.count());
+    }
+
+    const std::vector<StartupProfiler::Phase> &StartupProfiler::phases()
+        const {
+      return phases_;
+    }
+
+    std::string StartupProfiler::summary() const {
+      std::ostringstream stream;
+      std::chrono::milliseconds total{0};
+      for (const auto &phase : phases_) {
+        stream << phase.name << " " << phase.duration.count() << " ms "
+               << phase.rss_growth / 1024 << " KiB, ";
+        total += phase.duration;
+      }
+      stream << "total " << total.count() << " ms "
+             << residentMemory() / 1024 << " KiB resident";
+      return stream.str();
+    }
+
+    int64_t StartupProfiler::residentMemory() {
+      // the second field is the number of resident pages
+      std::ifstream statm("/proc/self/statm");
+      int64_t size = 0, resident = 0;
+      if (not(statm >> size >> resident)) {
+        return 0;
+      }
+      return resident * sysconf(_SC_PAGESIZE);
+    }
+
+  }  // namespace metrics
+}  // namespace iroha
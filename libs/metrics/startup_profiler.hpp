@@ -0,0 +1,76 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_STARTUP_PROFILER_HPP
+#define IROHA_STARTUP_PROFILER_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace iroha {
+  namespace metrics {
+
+    class Registry;
+
+    /**
+     * Records wall time and growth of resident memory of the phases of the
+     * startup. Every phase is exposed with gauges
+     * iroha_startup_<phase>_milliseconds and iroha_startup_<phase>_rss_bytes,
+     * and the whole startup with iroha_startup_milliseconds
+     */
+    class StartupProfiler {
+     public:
+      struct Phase {
+        std::string name;
+        std::chrono::milliseconds duration;
+        int64_t rss_growth;
+      };
+
+      explicit StartupProfiler(Registry &registry);
+
+      /**
+       * Run the phase and record it
+       * @param name - name of the phase, a valid part of a metric name
+       * @param phase - function running the phase
+       * @return result of the phase
+       */
+      template <typename Function>
+      auto profile(const std::string &name, Function &&phase) {
+        auto start = std::chrono::steady_clock::now();
+        auto rss = residentMemory();
+        auto result = std::forward<Function>(phase)();
+        record(name,
+               std::chrono::duration_cast<std::chrono::milliseconds>(
+                   std::chrono::steady_clock::now() - start),
+               residentMemory() - rss);
+        return result;
+      }
+
+      /// Record the phase which has taken the given time and memory
+      void record(const std::string &name,
+                  std::chrono::milliseconds duration,
+                  int64_t rss_growth);
+
+      /// @return recorded phases in order of their recording
+      const std::vector<Phase> &phases() const;
+
+      /// @return recorded phases and their total as a line for the log
+      std::string summary() const;
+
+      /// @return resident set size of the process in bytes, 0 if unknown
+      static int64_t residentMemory();
+
+     private:
+      Registry &registry_;
+      std::vector<Phase> phases_;
+    };
+
+  }  // namespace metrics
+}  // namespace iroha
+
+#endif  // IROHA_STARTUP_PROFILER_HPP
@@ -22,6 +22,14 @@ namespace shared_model {
       explicit Block(const TransportType &ref);
       explicit Block(TransportType &&ref);
 
+      /**
+       * Creates block referencing a message allocated on the given arena, so
+       * all its parts are freed at once with the block
+       * @param arena - arena owning ref
+       * @param ref - transport object allocated on arena
+       */
+      Block(std::unique_ptr<google::protobuf::Arena> arena, TransportType &ref);
+
       interface::types::TransactionsCollectionType transactions()
           const override;
 
@@ -160,8 +160,7 @@ namespace shared_model {
           const interface::types::PubkeyType &key,
           const interface::Signature::SignedType &signed_data) override {
         iroha::protocol::Signature signature;
-        signature.set_public_key(key.hex());
-        signature.set_signature(signed_data.hex());
+        setSignature(signature, signed_data, key);
 
         auto proto_singature =
             std::make_unique<Signature>(std::move(signature));
@@ -7,6 +7,7 @@
 #define IROHA_PROTO_SIGNATURE_HPP
 
 #include "backend/protobuf/common_objects/trivial_proto.hpp"
+#include "common/byteutils.hpp"
 #include "cryptography/public_key.hpp"
 #include "cryptography/signed.hpp"
 #include "interfaces/common_objects/signature.hpp"
@@ -14,6 +15,45 @@
 
 namespace shared_model {
   namespace proto {
+
+    /**
+     * @return raw public key of the signature, decoded from hex if it was
+     * written so, empty if the hex is not valid
+     */
+    inline std::string publicKeyBytes(
+        const iroha::protocol::Signature &signature) {
+      if (signature.public_key_encoding_case()
+          == iroha::protocol::Signature::kPublicKeyBytes) {
+        return signature.public_key_bytes();
+      }
+      return iroha::hexstringToBytestring(signature.public_key())
+          .value_or(std::string{});
+    }
+
+    /**
+     * @return raw signed data of the signature, decoded from hex if it was
+     * written so, empty if the hex is not valid
+     */
+    inline std::string signedBytes(
+        const iroha::protocol::Signature &signature) {
+      if (signature.signature_encoding_case()
+          == iroha::protocol::Signature::kSignatureBytes) {
+        return signature.signature_bytes();
+      }
+      return iroha::hexstringToBytestring(signature.signature())
+          .value_or(std::string{});
+    }
+
+    /**
+     * Write public key and signed data to the signature as raw bytes
+     */
+    inline void setSignature(iroha::protocol::Signature &signature,
+                             const crypto::Signed &signed_blob,
+                             const crypto::PublicKey &public_key) {
+      signature.set_signature_bytes(crypto::toBinaryString(signed_blob));
+      signature.set_public_key_bytes(crypto::toBinaryString(public_key));
+    }
+
     class Signature final : public CopyableProto<interface::Signature,
                                                  iroha::protocol::Signature,
                                                  Signature> {
@@ -35,10 +75,9 @@ namespace shared_model {
       }
 
      private:
-      const PublicKeyType public_key_{
-          PublicKeyType::fromHexString(proto_->public_key())};
+      const PublicKeyType public_key_{publicKeyBytes(*proto_)};
 
-      const SignedType signed_{SignedType::fromHexString(proto_->signature())};
+      const SignedType signed_{signedBytes(*proto_)};
     };
   }  // namespace proto
 }  // namespace shared_model
@@ -0,0 +1,52 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_PROTO_COMPACT_BLOCK_HPP
+#define IROHA_PROTO_COMPACT_BLOCK_HPP
+
+#include <string>
+
+#include <boost/optional.hpp>
+#include "block.pb.h"
+
+namespace shared_model {
+  namespace proto {
+
+    /**
+     * Compact serialization of blocks. Blocks repeat the same creator
+     * account ids, asset ids and public keys across their transactions, so
+     * every string value occurring more than once in a block is written once
+     * to a dictionary of the block, and the fields holding it are serialized
+     * with a short reference to the dictionary instead.
+     *
+     * The form is a version byte, the number of dictionary entries and the
+     * length-prefixed entries, all counts being varints, followed by the
+     * serialized block with the replaced values. A reference is a zero byte
+     * followed by the entry index in base 127, every digit increased by one,
+     * so that string fields stay valid UTF-8 unlike with varint bytes. A
+     * value which starts with a zero byte itself is written with one more
+     * zero byte in front
+     */
+    class CompactBlock {
+     public:
+      /// first byte of the compact form, neither binary nor JSON blocks
+      /// start with it
+      static constexpr char kVersion = 1;
+
+      /// check whether the data is a block in the compact form
+      static bool isCompact(const char *data, size_t size);
+
+      /// @return compact form of the block
+      static std::string encode(const iroha::protocol::Block_v1 &block);
+
+      /// @return block decoded from the compact form, none if it is corrupted
+      static boost::optional<iroha::protocol::Block_v1> decode(const char *data,
+                                                               size_t size);
+    };
+
+  }  // namespace proto
+}  // namespace shared_model
+
+#endif  // IROHA_PROTO_COMPACT_BLOCK_HPP
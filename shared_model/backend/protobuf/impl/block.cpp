@@ -10,6 +10,8 @@
 #include "backend/protobuf/transaction.hpp"
 #include "backend/protobuf/util.hpp"
 #include "common/byteutils.hpp"
+#include "utils/memoized.hpp"
+#include "utils/reference_holder.hpp"
 
 namespace shared_model {
   namespace proto {
@@ -17,27 +19,30 @@ namespace shared_model {
     struct Block::Impl {
       explicit Impl(TransportType &&ref) : proto_(std::move(ref)) {}
       explicit Impl(const TransportType &ref) : proto_(ref) {}
+      Impl(std::unique_ptr<google::protobuf::Arena> arena, TransportType &ref)
+          : arena_(std::move(arena)), proto_(ref) {}
       Impl(Impl &&o) noexcept = delete;
       Impl &operator=(Impl &&o) noexcept = delete;
 
-      TransportType proto_;
-      iroha::protocol::Block_v1::Payload &payload_{*proto_.mutable_payload()};
+      // declared first to outlive the messages allocated on it
+      std::unique_ptr<google::protobuf::Arena> arena_;
+      detail::ReferenceHolder<TransportType> proto_;
+      iroha::protocol::Block_v1::Payload &payload_{*proto_->mutable_payload()};
 
-      std::vector<proto::Transaction> transactions_{[this] {
-        return std::vector<proto::Transaction>(
-            payload_.mutable_transactions()->begin(),
-            payload_.mutable_transactions()->end());
-      }()};
+      std::vector<proto::Transaction> transactions_{
+          proto::Transaction::fromTransport(*payload_.mutable_transactions())};
 
-      interface::types::BlobType blob_{[this] { return makeBlob(proto_); }()};
+      // serialization with signatures is computed on the first access and
+      // reused by consensus and block stores until a signature is added
+      detail::Memoized<interface::types::BlobType> blob_;
 
       interface::types::HashType prev_hash_{[this] {
         return interface::types::HashType(
-            crypto::Hash::fromHexString(proto_.payload().prev_block_hash()));
+            crypto::Hash::fromHexString(proto_->payload().prev_block_hash()));
       }()};
 
       SignatureSetType<proto::Signature> signatures_{[this] {
-        auto signatures = *proto_.mutable_signatures()
+        auto signatures = *proto_->mutable_signatures()
             | boost::adaptors::transformed(
                   [](auto &x) { return proto::Signature(x); });
         return SignatureSetType<proto::Signature>(signatures.begin(),
@@ -71,6 +76,11 @@ namespace shared_model {
       impl_ = std::make_unique<Block::Impl>(std::move(ref));
     }
 
+    Block::Block(std::unique_ptr<google::protobuf::Arena> arena,
+                 TransportType &ref) {
+      impl_ = std::make_unique<Block::Impl>(std::move(arena), ref);
+    }
+
     interface::types::TransactionsCollectionType Block::transactions() const {
       return impl_->transactions_;
     }
@@ -84,7 +94,7 @@ namespace shared_model {
     }
 
     const interface::types::BlobType &Block::blob() const {
-      return impl_->blob_;
+      return impl_->blob_.get([this] { return makeBlob(*impl_->proto_); });
     }
 
     interface::types::SignatureRangeType Block::signatures() const {
@@ -103,12 +113,11 @@ namespace shared_model {
         return false;
       }
 
-      auto sig = impl_->proto_.add_signatures();
-      sig->set_signature(signed_blob.hex());
-      sig->set_public_key(public_key.hex());
+      setSignature(*impl_->proto_->add_signatures(), signed_blob, public_key);
+      impl_->blob_.reset();
 
       impl_->signatures_ = [this] {
-        auto signatures = *impl_->proto_.mutable_signatures()
+        auto signatures = *impl_->proto_->mutable_signatures()
             | boost::adaptors::transformed(
                   [](auto &x) { return proto::Signature(x); });
         return SignatureSetType<proto::Signature>(signatures.begin(),
@@ -139,11 +148,11 @@ namespace shared_model {
     }
 
     const iroha::protocol::Block_v1 &Block::getTransport() const {
-      return impl_->proto_;
+      return *impl_->proto_;
     }
 
     Block::ModelType *Block::clone() const {
-      return new Block(impl_->proto_);
+      return new Block(*impl_->proto_);
     }
 
     Block::~Block() = default;
@@ -0,0 +1,223 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "backend/protobuf/compact_block.hpp"
+
+#include <unordered_map>
+#include <vector>
+
+using google::protobuf::FieldDescriptor;
+using google::protobuf::Message;
+
+namespace {
+  /// first byte of references and of escaped values
+  constexpr char kMarker = 0;
+
+  /// shorter values are not referenced, a reference takes two bytes or more
+  constexpr size_t kMinReferencedSize = 3;
+
+  /// digits of references, which are kept valid UTF-8 for string fields
+  constexpr size_t kDigits = 127;
+
+  /// longest reference in digits, enough for any block
+  constexpr size_t kMaxReferenceDigits = 4;
+
+  void putVarint(std::string &out, uint64_t value) {
+    while (value >= 0x80) {
+      out.push_back(static_cast<char>(value | 0x80));
+      value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+  }
+
+  bool getVarint(const char *data,
+                 size_t size,
+                 size_t &offset,
+                 uint64_t &value) {
+    value = 0;
+    for (size_t shift = 0; shift < 64 and offset < size; shift += 7) {
+      auto byte = static_cast<uint8_t>(data[offset++]);
+      value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// @return reference to the dictionary entry, the digits are never zero
+  std::string makeReference(size_t index) {
+    std::string digits;
+    do {
+      digits.push_back(static_cast<char>(index % kDigits + 1));
+      index /= kDigits;
+    } while (index != 0);
+    return kMarker + std::string(digits.rbegin(), digits.rend());
+  }
+
+  /// @return index of the referenced entry, none if it is not a reference
+  boost::optional<size_t> readReference(const std::string &value) {
+    if (value.size() < 2 or value.size() > kMaxReferenceDigits + 1) {
+      return boost::none;
+    }
+    size_t index = 0;
+    for (size_t i = 1; i < value.size(); ++i) {
+      auto digit = static_cast<uint8_t>(value[i]);
+      if (digit == 0 or digit > kDigits) {
+        return boost::none;
+      }
+      index = index * kDigits + digit - 1;
+    }
+    return index;
+  }
+
+  /**
+   * Call visit for every string and bytes value of the message and its
+   * nested messages, in the order of serialization
+   * @param visit - takes the value and may change it, returns false to stop
+   * @return false if visit has stopped
+   */
+  template <typename Visit>
+  bool visitStrings(Message &message, Visit &visit) {
+    const auto *reflection = message.GetReflection();
+    std::vector<const FieldDescriptor *> fields;
+    reflection->ListFields(message, &fields);
+    for (const auto *field : fields) {
+      if (field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE) {
+        if (not field->is_repeated()) {
+          if (not visitStrings(*reflection->MutableMessage(&message, field),
+                               visit)) {
+            return false;
+          }
+          continue;
+        }
+        for (int i = 0; i < reflection->FieldSize(message, field); ++i) {
+          if (not visitStrings(
+                  *reflection->MutableRepeatedMessage(&message, field, i),
+                  visit)) {
+            return false;
+          }
+        }
+      } else if (field->cpp_type() == FieldDescriptor::CPPTYPE_STRING) {
+        if (not field->is_repeated()) {
+          auto value = reflection->GetString(message, field);
+          if (not visit(value)) {
+            return false;
+          }
+          reflection->SetString(&message, field, std::move(value));
+          continue;
+        }
+        for (int i = 0; i < reflection->FieldSize(message, field); ++i) {
+          auto value = reflection->GetRepeatedString(message, field, i);
+          if (not visit(value)) {
+            return false;
+          }
+          reflection->SetRepeatedString(&message, field, i, std::move(value));
+        }
+      }
+    }
+    return true;
+  }
+}  // namespace
+
+namespace shared_model {
+  namespace proto {
+
+    constexpr char CompactBlock::kVersion;
+
+    bool CompactBlock::isCompact(const char *data, size_t size) {
+      return size > 0 and data[0] == kVersion;
+    }
+
+    std::string CompactBlock::encode(const iroha::protocol::Block_v1 &block) {
+      auto compact = block;
+
+      // values repeated in the block, in the order of their first occurrence
+      std::unordered_map<std::string, size_t> occurrences;
+      std::vector<std::string> dictionary;
+      auto count = [&occurrences, &dictionary](std::string &value) {
+        if (value.size() >= kMinReferencedSize
+            and ++occurrences[value] == 2) {
+          dictionary.push_back(value);
+        }
+        return true;
+      };
+      visitStrings(compact, count);
+
+      std::unordered_map<std::string, std::string> references;
+      references.reserve(dictionary.size());
+      for (size_t i = 0; i < dictionary.size(); ++i) {
+        references.emplace(dictionary[i], makeReference(i));
+      }
+      auto replace = [&references](std::string &value) {
+        auto it = references.find(value);
+        if (it != references.end()) {
+          value = it->second;
+        } else if (not value.empty() and value[0] == kMarker) {
+          value.insert(value.begin(), kMarker);
+        }
+        return true;
+      };
+      visitStrings(compact, replace);
+
+      std::string result(1, kVersion);
+      putVarint(result, dictionary.size());
+      for (const auto &entry : dictionary) {
+        putVarint(result, entry.size());
+        result.append(entry);
+      }
+      compact.AppendToString(&result);
+      return result;
+    }
+
+    boost::optional<iroha::protocol::Block_v1> CompactBlock::decode(
+        const char *data, size_t size) {
+      if (not isCompact(data, size)) {
+        return boost::none;
+      }
+      size_t offset = 1;
+      uint64_t entries;
+      if (not getVarint(data, size, offset, entries)) {
+        return boost::none;
+      }
+      std::vector<std::string> dictionary;
+      for (uint64_t i = 0; i < entries; ++i) {
+        uint64_t entry_size;
+        if (not getVarint(data, size, offset, entry_size)
+            or size - offset < entry_size) {
+          return boost::none;
+        }
+        dictionary.emplace_back(data + offset, entry_size);
+        offset += entry_size;
+      }
+
+      iroha::protocol::Block_v1 block;
+      if (not block.ParseFromArray(data + offset,
+                                   static_cast<int>(size - offset))) {
+        return boost::none;
+      }
+      auto restore = [&dictionary](std::string &value) {
+        if (value.empty() or value[0] != kMarker) {
+          return true;
+        }
+        if (value.size() > 1 and value[1] == kMarker) {
+          value.erase(value.begin());
+          return true;
+        }
+        auto index = readReference(value);
+        if (not index or *index >= dictionary.size()) {
+          return false;
+        }
+        value = dictionary[*index];
+        return true;
+      };
+      if (not visitStrings(block, restore)) {
+        return boost::none;
+      }
+      return block;
+    }
+
+  }  // namespace proto
+}  // namespace shared_model
@@ -29,7 +29,12 @@ ProtoBlockFactory::unsafeCreateBlock(
     interface::types::TimestampType created_time,
     const interface::types::TransactionsCollectionType &txs,
     const interface::types::HashCollectionType &rejected_hashes) {
-  iroha::protocol::Block_v1 block;
+  // the block and all its transactions share one arena freed with the block
+  auto arena = std::make_unique<google::protobuf::Arena>();
+  auto &proto_block_container =
+      *google::protobuf::Arena::CreateMessage<iroha::protocol::Block>(
+          arena.get());
+  auto &block = *proto_block_container.mutable_block_v1();
   auto *block_payload = block.mutable_payload();
   block_payload->set_height(height);
   block_payload->set_prev_block_hash(prev_hash.hex());
@@ -51,14 +56,11 @@ ProtoBlockFactory::unsafeCreateBlock(
                   (*next_hash) = hash.hex();
                 });
 
-  iroha::protocol::Block proto_block_container;
-  proto_block_container.set_allocated_block_v1(&block);
   auto proto_block_validation_result =
       proto_validator_->validate(proto_block_container);
-  proto_block_container.release_block_v1();
 
   auto model_proto_block =
-      std::make_unique<shared_model::proto::Block>(std::move(block));
+      std::make_unique<shared_model::proto::Block>(std::move(arena), block);
   auto interface_block_validation_result =
       interface_validator_->validate(*model_proto_block);
 
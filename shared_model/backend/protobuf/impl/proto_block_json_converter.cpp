@@ -5,21 +5,60 @@
 
 #include "backend/protobuf/proto_block_json_converter.hpp"
 
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
 #include <google/protobuf/util/json_util.h>
 #include <string>
 
 #include "backend/protobuf/block.hpp"
+#include "backend/protobuf/compact_block.hpp"
 
 using namespace shared_model;
 using namespace shared_model::proto;
 
+namespace {
+  /// key of the block_v1 field, the only field of a serialized block
+  constexpr char kBlockV1Tag = (iroha::protocol::Block::kBlockV1FieldNumber
+                                << 3)
+      | 2;
+}  // namespace
+
+ProtoBlockJsonConverter::ProtoBlockJsonConverter(bool binary, bool compact)
+    : binary_(binary), compact_(compact) {}
+
+bool ProtoBlockJsonConverter::isBinary(const char *data, size_t size) {
+  // JSON of a block starts with '{'
+  return size > 0 and data[0] == kBlockV1Tag;
+}
+
 iroha::expected::Result<interface::types::JsonType, std::string>
 ProtoBlockJsonConverter::serialize(const interface::Block &block) const
     noexcept {
+  std::string result;
+  if (compact_) {
+    return iroha::expected::makeValue(CompactBlock::encode(
+        static_cast<const Block &>(block).getTransport()));
+  }
+  if (binary_) {
+    // the serialized block_v1 field is written around the serialization
+    // cached by the block, so the block is neither copied nor serialized
+    // again
+    const auto &bytes = block.blob().blob();
+    {
+      google::protobuf::io::StringOutputStream string_stream(&result);
+      google::protobuf::io::CodedOutputStream stream(&string_stream);
+      stream.WriteTag(static_cast<uint8_t>(kBlockV1Tag));
+      stream.WriteVarint32(static_cast<uint32_t>(bytes.size()));
+      stream.WriteRaw(bytes.data(), static_cast<int>(bytes.size()));
+      if (stream.HadError()) {
+        return iroha::expected::makeError("Failed to serialize block");
+      }
+    }
+    return iroha::expected::makeValue(std::move(result));
+  }
   const auto &proto_block_v1 = static_cast<const Block &>(block).getTransport();
   iroha::protocol::Block proto_block;
   *proto_block.mutable_block_v1() = proto_block_v1;
-  std::string result;
   auto status =
       google::protobuf::util::MessageToJsonString(proto_block, &result);
 
@@ -32,12 +71,36 @@ ProtoBlockJsonConverter::serialize(const interface::Block &block) const
 iroha::expected::Result<std::unique_ptr<interface::Block>, std::string>
 ProtoBlockJsonConverter::deserialize(
     const interface::types::JsonType &json) const noexcept {
+  return deserialize(json.data(), json.size());
+}
+
+iroha::expected::Result<std::unique_ptr<interface::Block>, std::string>
+ProtoBlockJsonConverter::deserialize(const char *data, size_t size) const
+    noexcept {
+  if (CompactBlock::isCompact(data, size)) {
+    auto block = CompactBlock::decode(data, size);
+    if (not block) {
+      return iroha::expected::makeError("Failed to decode compact block");
+    }
+    std::unique_ptr<interface::Block> result =
+        std::make_unique<Block>(std::move(*block));
+    return iroha::expected::makeValue(std::move(result));
+  }
   iroha::protocol::Block block;
-  auto status = google::protobuf::util::JsonStringToMessage(json, &block);
+  if (isBinary(data, size)) {
+    if (not block.ParseFromArray(data, static_cast<int>(size))) {
+      return iroha::expected::makeError("Failed to parse binary block");
+    }
+    std::unique_ptr<interface::Block> result =
+        std::make_unique<Block>(std::move(*block.mutable_block_v1()));
+    return iroha::expected::makeValue(std::move(result));
+  }
+  auto status = google::protobuf::util::JsonStringToMessage(
+      google::protobuf::StringPiece(data, size), &block);
   if (not status.ok()) {
     return iroha::expected::makeError(status.error_message());
   }
   std::unique_ptr<interface::Block> result =
-      std::make_unique<Block>(std::move(block.block_v1()));
+      std::make_unique<Block>(std::move(*block.mutable_block_v1()));
   return iroha::expected::makeValue(std::move(result));
 }
@@ -84,6 +84,36 @@ shared_model::proto::ProtoQueryResponseFactory::createAccountAssetResponse(
       query_hash);
 }
 
+std::unique_ptr<shared_model::interface::QueryResponse>
+shared_model::proto::ProtoQueryResponseFactory::createAccountAssetResponse(
+    std::vector<std::tuple<interface::types::AccountIdType,
+                           interface::types::AssetIdType,
+                           std::string>> assets,
+    size_t total_assets_number,
+    boost::optional<shared_model::interface::types::AssetIdType> next_asset_id,
+    const crypto::Hash &query_hash) const {
+  return createQueryResponse(
+      [&assets, total_assets_number, &next_asset_id](
+          iroha::protocol::QueryResponse &protocol_query_response) {
+        iroha::protocol::AccountAssetResponse *protocol_specific_response =
+            protocol_query_response.mutable_account_assets_response();
+        protocol_specific_response->mutable_account_assets()->Reserve(
+            static_cast<int>(assets.size()));
+        for (auto &account_asset : assets) {
+          auto *asset = protocol_specific_response->add_account_assets();
+          asset->set_account_id(std::move(std::get<0>(account_asset)));
+          asset->set_asset_id(std::move(std::get<1>(account_asset)));
+          asset->set_balance(std::move(std::get<2>(account_asset)));
+        }
+        protocol_specific_response->set_total_number(total_assets_number);
+        if (next_asset_id) {
+          protocol_specific_response->set_next_asset_id(
+              std::move(*next_asset_id));
+        }
+      },
+      query_hash);
+}
+
 std::unique_ptr<shared_model::interface::QueryResponse>
 shared_model::proto::ProtoQueryResponseFactory::createAccountDetailResponse(
     shared_model::interface::types::DetailType account_detail,
@@ -96,7 +126,7 @@ shared_model::proto::ProtoQueryResponseFactory::createAccountDetailResponse(
           iroha::protocol::QueryResponse &protocol_query_response) {
         iroha::protocol::AccountDetailResponse *protocol_specific_response =
             protocol_query_response.mutable_account_detail_response();
-        protocol_specific_response->set_detail(account_detail);
+        protocol_specific_response->set_detail(std::move(account_detail));
         protocol_specific_response->set_total_number(total_number);
         if (next_record_id) {
           auto protocol_next_record_id =
@@ -154,6 +184,25 @@ shared_model::proto::ProtoQueryResponseFactory::createBlockResponse(
       query_hash);
 }
 
+std::unique_ptr<shared_model::interface::QueryResponse>
+shared_model::proto::ProtoQueryResponseFactory::createSerializedBlockResponse(
+    std::string serialized_block, const crypto::Hash &query_hash) const {
+  return createQueryResponse(
+      [&serialized_block](
+          iroha::protocol::QueryResponse &protocol_query_response) {
+        // the block follows the empty block field of the serialized response,
+        // so the client merges it into that field
+        auto &block_response =
+            *protocol_query_response.mutable_block_response();
+        block_response.GetReflection()
+            ->MutableUnknownFields(&block_response)
+            ->AddLengthDelimited(
+                iroha::protocol::BlockResponse::kBlockFieldNumber,
+                serialized_block);
+      },
+      query_hash);
+}
+
 std::unique_ptr<shared_model::interface::QueryResponse>
 shared_model::proto::ProtoQueryResponseFactory::createErrorQueryResponse(
     ErrorQueryType error_type,
@@ -10,6 +10,8 @@
 #include "backend/protobuf/commands/proto_command.hpp"
 #include "backend/protobuf/common_objects/signature.hpp"
 #include "backend/protobuf/util.hpp"
+#include "cryptography/default_hash_provider.hpp"
+#include "utils/memoized.hpp"
 #include "utils/reference_holder.hpp"
 
 namespace shared_model {
@@ -22,6 +24,26 @@ namespace shared_model {
 
       explicit Impl(TransportType &ref) : proto_{ref} {}
 
+      Impl(TransportType &&ref, interface::types::BlobType payload_blob)
+          : proto_{std::move(ref)} {
+        if (auto reduced_payload_blob = fieldBlob(
+                payload_blob.blob(),
+                iroha::protocol::Transaction::Payload::
+                    kReducedPayloadFieldNumber)) {
+          reduced_payload_blob_ = detail::Memoized<interface::types::BlobType>(
+              std::move(*reduced_payload_blob));
+        }
+        payload_blob_ = detail::Memoized<interface::types::BlobType>(
+            std::move(payload_blob));
+      }
+
+      Impl(TransportType &ref, Digests digests)
+          : proto_{ref},
+            payload_blob_{std::move(digests.payload_blob)},
+            reduced_payload_blob_{std::move(digests.reduced_payload_blob)},
+            reduced_hash_{std::move(digests.reduced_hash)},
+            hash_{std::move(digests.hash)} {}
+
       detail::ReferenceHolder<TransportType> proto_;
 
       iroha::protocol::Transaction::Payload &payload_{
@@ -30,19 +52,18 @@ namespace shared_model {
       iroha::protocol::Transaction::Payload::ReducedPayload &reduced_payload_{
           *proto_->mutable_payload()->mutable_reduced_payload()};
 
-      interface::types::BlobType blob_{[this] { return makeBlob(*proto_); }()};
+      // serializations, hashes and command wrappers are computed on the first
+      // access, since most of the pipeline stages need only some of them
+
+      detail::Memoized<interface::types::BlobType> blob_;
 
-      interface::types::BlobType payload_blob_{
-          [this] { return makeBlob(payload_); }()};
+      detail::Memoized<interface::types::BlobType> payload_blob_;
 
-      interface::types::BlobType reduced_payload_blob_{
-          [this] { return makeBlob(reduced_payload_); }()};
+      detail::Memoized<interface::types::BlobType> reduced_payload_blob_;
 
-      interface::types::HashType reduced_hash_{makeHash(reduced_payload_blob_)};
+      detail::Memoized<interface::types::HashType> reduced_hash_;
 
-      std::vector<proto::Command> commands_{
-          reduced_payload_.mutable_commands()->begin(),
-          reduced_payload_.mutable_commands()->end()};
+      detail::Memoized<std::vector<proto::Command>> commands_;
 
       boost::optional<std::shared_ptr<interface::BatchMeta>> meta_{
           [this]() -> boost::optional<std::shared_ptr<interface::BatchMeta>> {
@@ -62,7 +83,37 @@ namespace shared_model {
                                                   signatures.end());
       }()};
 
-      interface::types::HashType hash_{makeHash(payload_blob_)};
+      detail::Memoized<interface::types::HashType> hash_;
+
+      const interface::types::BlobType &blob() {
+        return blob_.get([this] { return makeBlob(*proto_); });
+      }
+
+      const interface::types::BlobType &payloadBlob() {
+        return payload_blob_.get([this] { return makeBlob(payload_); });
+      }
+
+      const interface::types::BlobType &reducedPayloadBlob() {
+        return reduced_payload_blob_.get(
+            [this] { return makeBlob(reduced_payload_); });
+      }
+
+      const interface::types::HashType &reducedHash() {
+        return reduced_hash_.get(
+            [this] { return makeHash(reducedPayloadBlob()); });
+      }
+
+      const interface::types::HashType &hash() {
+        return hash_.get([this] { return makeHash(payloadBlob()); });
+      }
+
+      const std::vector<proto::Command> &commands() {
+        return commands_.get([this] {
+          return std::vector<proto::Command>{
+              reduced_payload_.mutable_commands()->begin(),
+              reduced_payload_.mutable_commands()->end()};
+        });
+      }
     };  // namespace proto
 
     Transaction::Transaction(const TransportType &transaction) {
@@ -77,6 +128,47 @@ namespace shared_model {
       impl_ = std::make_unique<Transaction::Impl>(transaction);
     }
 
+    Transaction::Transaction(TransportType &&transaction,
+                             interface::types::BlobType payload_blob) {
+      impl_ = std::make_unique<Transaction::Impl>(std::move(transaction),
+                                                  std::move(payload_blob));
+    }
+
+    Transaction::Transaction(TransportType &transaction, Digests digests) {
+      impl_ =
+          std::make_unique<Transaction::Impl>(transaction, std::move(digests));
+    }
+
+    std::vector<Transaction> Transaction::fromTransport(
+        google::protobuf::RepeatedPtrField<TransportType> &transactions) {
+      const auto count = static_cast<size_t>(transactions.size());
+      std::vector<interface::types::BlobType> blobs;
+      blobs.reserve(count * 2);
+      for (const auto &transaction : transactions) {
+        blobs.push_back(makeBlob(transaction.payload()));
+        blobs.push_back(makeBlob(transaction.payload().reduced_payload()));
+      }
+
+      std::vector<const interface::types::BlobType *> blob_ptrs;
+      blob_ptrs.reserve(blobs.size());
+      for (const auto &blob : blobs) {
+        blob_ptrs.push_back(&blob);
+      }
+      auto hashes = crypto::DefaultHashProvider::makeHashes(blob_ptrs);
+
+      std::vector<Transaction> result;
+      result.reserve(count);
+      for (size_t i = 0; i < count; ++i) {
+        result.push_back(
+            Transaction(*transactions.Mutable(static_cast<int>(i)),
+                        Digests{std::move(blobs[2 * i]),
+                                std::move(blobs[2 * i + 1]),
+                                std::move(hashes[2 * i]),
+                                std::move(hashes[2 * i + 1])}));
+      }
+      return result;
+    }
+
     // TODO [IR-1866] Akvinikym 13.11.18: remove the copy ctor and fix fallen
     // tests
     Transaction::Transaction(const Transaction &transaction)
@@ -93,58 +185,55 @@ namespace shared_model {
     }
 
     Transaction::CommandsType Transaction::commands() const {
-      return impl_->commands_;
+      return impl_->commands();
     }
 
     const interface::types::BlobType &Transaction::blob() const {
-      return impl_->blob_;
+      return impl_->blob();
     }
 
     const interface::types::BlobType &Transaction::payload() const {
-      return impl_->payload_blob_;
+      return impl_->payloadBlob();
     }
 
     const interface::types::BlobType &Transaction::reducedPayload() const {
-      return impl_->reduced_payload_blob_;
+      return impl_->reducedPayloadBlob();
     }
 
     interface::types::SignatureRangeType Transaction::signatures() const {
       return impl_->signatures_;
     }
 
+    size_t Transaction::signaturesCount() const {
+      return impl_->signatures_.size();
+    }
+
     const interface::types::HashType &Transaction::reducedHash() const {
-      return impl_->reduced_hash_;
+      return impl_->reducedHash();
     }
 
     bool Transaction::addSignature(const crypto::Signed &signed_blob,
                                    const crypto::PublicKey &public_key) {
-      // if already has such signature
-      if (std::find_if(impl_->signatures_.begin(),
-                       impl_->signatures_.end(),
-                       [&public_key](const auto &signature) {
-                         return signature.publicKey() == public_key;
-                       })
-          != impl_->signatures_.end()) {
+      iroha::protocol::Signature signature;
+      setSignature(signature, signed_blob, public_key);
+      // if already has such signature, the set is keyed by public keys
+      if (impl_->signatures_.count(proto::Signature(signature)) != 0) {
         return false;
       }
 
-      auto sig = impl_->proto_->add_signatures();
-      sig->set_signature(signed_blob.hex());
-      sig->set_public_key(public_key.hex());
+      auto &added = *impl_->proto_->add_signatures();
+      added = std::move(signature);
+      impl_->blob_.reset();
 
-      impl_->signatures_ = [this] {
-        auto signatures = *impl_->proto_->mutable_signatures()
-            | boost::adaptors::transformed(
-                  [](auto &x) { return proto::Signature(x); });
-        return SignatureSetType<proto::Signature>(signatures.begin(),
-                                                  signatures.end());
-      }();
+      // elements of the repeated field keep their addresses, so the set is
+      // extended instead of being rebuilt
+      impl_->signatures_.emplace(added);
 
       return true;
     }
 
     const interface::types::HashType &Transaction::hash() const {
-      return impl_->hash_;
+      return impl_->hash();
     }
 
     const Transaction::TransportType &Transaction::getTransport() const {
@@ -22,9 +22,22 @@ namespace shared_model {
       explicit Proposal(const TransportType &ref);
       explicit Proposal(TransportType &&ref);
 
+      /**
+       * Creates proposal referencing a message allocated on the given arena,
+       * so the proposal and its transactions are freed at once
+       * @param arena - arena owning ref
+       * @param ref - transport object allocated on arena
+       */
+      Proposal(std::unique_ptr<google::protobuf::Arena> arena,
+               TransportType &ref);
+
       interface::types::TransactionsCollectionType transactions()
           const override;
 
+      /// batches are parsed once and reused by all the consumers
+      std::vector<interface::types::TransactionsCollectionType> batches()
+          const override;
+
       interface::types::TimestampType createdTime() const override;
 
       interface::types::HeightType height() const override;
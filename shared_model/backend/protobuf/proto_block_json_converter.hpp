@@ -15,14 +15,40 @@ namespace shared_model {
   }
 
   namespace proto {
+    /**
+     * Converts blocks to JSON of iroha.protocol.Block, or to its binary
+     * serialization or CompactBlock if requested. All forms are read
+     * regardless of the form which is written
+     */
     class ProtoBlockJsonConverter : public interface::BlockJsonConverter {
      public:
+      /**
+       * @param binary - whether blocks are serialized to binary protobuf
+       * @param compact - whether blocks are serialized to CompactBlock,
+       * takes precedence over binary
+       */
+      explicit ProtoBlockJsonConverter(bool binary = false,
+                                       bool compact = false);
+
+      /**
+       * Check whether the data is a binary serialized iroha.protocol.Block,
+       * which may be sent to peers and clients as is
+       */
+      static bool isBinary(const char *data, size_t size);
+
       iroha::expected::Result<interface::types::JsonType, std::string>
       serialize(const interface::Block &block) const noexcept override;
 
       iroha::expected::Result<std::unique_ptr<interface::Block>, std::string>
       deserialize(const interface::types::JsonType &json) const
           noexcept override;
+
+      iroha::expected::Result<std::unique_ptr<interface::Block>, std::string>
+      deserialize(const char *data, size_t size) const noexcept override;
+
+     private:
+      bool binary_;
+      bool compact_;
     };
   }  // namespace proto
 }  // namespace shared_model
@@ -32,8 +32,8 @@ namespace shared_model {
           interface::types::HeightType height,
           interface::types::TimestampType created_time,
           TransactionsCollectionType transactions) override {
-        return createProposal(
-            createProtoProposal(height, created_time, transactions));
+        return validate(
+            createArenaProposal(height, created_time, transactions));
       }
 
       // TODO mboldyrev 13.02.2019 IR-323
@@ -42,8 +42,7 @@ namespace shared_model {
           interface::types::HeightType height,
           interface::types::TimestampType created_time,
           UnsafeTransactionsCollectionType transactions) override {
-        return std::make_unique<Proposal>(
-            createProtoProposal(height, created_time, transactions));
+        return createArenaProposal(height, created_time, transactions);
       }
 
       /**
@@ -55,11 +54,18 @@ namespace shared_model {
       }
 
      private:
-      iroha::protocol::Proposal createProtoProposal(
+      /**
+       * Create proposal with the transport object and copies of transactions
+       * allocated on a single arena, which is freed with the proposal
+       */
+      std::unique_ptr<Proposal> createArenaProposal(
           interface::types::HeightType height,
           interface::types::TimestampType created_time,
           UnsafeTransactionsCollectionType transactions) {
-        iroha::protocol::Proposal proposal;
+        auto arena = std::make_unique<google::protobuf::Arena>();
+        auto &proposal =
+            *google::protobuf::Arena::CreateMessage<iroha::protocol::Proposal>(
+                arena.get());
 
         proposal.set_height(height);
         proposal.set_created_time(created_time);
@@ -70,7 +76,7 @@ namespace shared_model {
                   .getTransport();
         }
 
-        return proposal;
+        return std::make_unique<Proposal>(std::move(arena), proposal);
       }
 
       FactoryResult<std::unique_ptr<interface::Proposal>> validate(
@@ -22,6 +22,15 @@ namespace shared_model {
               next_asset_id,
           const crypto::Hash &query_hash) const override;
 
+      std::unique_ptr<interface::QueryResponse> createAccountAssetResponse(
+          std::vector<std::tuple<interface::types::AccountIdType,
+                                 interface::types::AssetIdType,
+                                 std::string>> assets,
+          size_t total_assets_number,
+          boost::optional<shared_model::interface::types::AssetIdType>
+              next_asset_id,
+          const crypto::Hash &query_hash) const override;
+
       std::unique_ptr<interface::QueryResponse> createAccountDetailResponse(
           interface::types::DetailType account_detail,
           size_t total_number,
@@ -41,6 +50,10 @@ namespace shared_model {
           std::unique_ptr<interface::Block> block,
           const crypto::Hash &query_hash) const override;
 
+      std::unique_ptr<interface::QueryResponse> createSerializedBlockResponse(
+          std::string serialized_block,
+          const crypto::Hash &query_hash) const override;
+
       std::unique_ptr<interface::QueryResponse> createErrorQueryResponse(
           ErrorQueryType error_type,
           interface::ErrorQueryResponse::ErrorMessageType error_msg,
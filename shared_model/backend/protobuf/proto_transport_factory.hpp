@@ -8,6 +8,9 @@
 
 #include "interfaces/iroha_internal/abstract_transport_factory.hpp"
 
+#include <type_traits>
+
+#include <boost/optional.hpp>
 #include "backend/protobuf/util.hpp"
 #include "cryptography/hash_providers/sha3_256.hpp"
 #include "validators/abstract_validator.hpp"
@@ -41,11 +44,82 @@ namespace shared_model {
 
       iroha::expected::Result<std::unique_ptr<Interface>, Error> build(
           typename Proto::TransportType m) const override {
+        return buildValidated(std::move(m), boost::none);
+      }
+
+      iroha::expected::Result<std::unique_ptr<Interface>, Error> build(
+          const interface::types::BlobType &bytes) const override {
+        typename Proto::TransportType m;
+        const auto &data = bytes.blob();
+        if (not m.ParseFromArray(data.data(), static_cast<int>(data.size()))) {
+          return iroha::expected::makeError(
+              Error{shared_model::crypto::Hash{},
+                    "could not parse transport object"});
+        }
+
+        boost::optional<interface::types::BlobType> payload_blob;
+        if (auto payload_field_descriptor = payloadFieldDescriptor(m)) {
+          payload_blob =
+              fieldBlob(data, payload_field_descriptor->number());
+          // received bytes are reused only if they are the canonical
+          // serialization, otherwise the hash would differ from the one
+          // computed by other peers
+          if (payload_blob
+              and payload_blob->blob().size()
+                  != m.GetReflection()
+                         ->GetMessage(m, payload_field_descriptor)
+                         .ByteSizeLong()) {
+            payload_blob = boost::none;
+          }
+        }
+        return buildValidated(std::move(m), std::move(payload_blob));
+      }
+
+     private:
+      using HashProvider = shared_model::crypto::Sha3_256;
+      using PayloadBlobConstructible =
+          std::is_constructible<Proto,
+                                typename Proto::TransportType &&,
+                                interface::types::BlobType>;
+
+      static const google::protobuf::FieldDescriptor *payloadFieldDescriptor(
+          const typename Proto::TransportType &m) {
+        return m.GetDescriptor()->FindFieldByLowercaseName("payload");
+      }
+
+      static std::unique_ptr<Interface> makeProto(
+          typename Proto::TransportType &&m,
+          boost::optional<interface::types::BlobType> payload_blob,
+          std::true_type) {
+        if (payload_blob) {
+          return std::make_unique<Proto>(std::move(m),
+                                         std::move(*payload_blob));
+        }
+        return std::make_unique<Proto>(std::move(m));
+      }
+
+      static std::unique_ptr<Interface> makeProto(
+          typename Proto::TransportType &&m,
+          boost::optional<interface::types::BlobType>,
+          std::false_type) {
+        return std::make_unique<Proto>(std::move(m));
+      }
+
+      /**
+       * Validates the transport object and builds the model object from it
+       * @param m - transport object
+       * @param payload_blob - serialized payload of m, if known in advance
+       */
+      iroha::expected::Result<std::unique_ptr<Interface>, Error>
+      buildValidated(
+          typename Proto::TransportType m,
+          boost::optional<interface::types::BlobType> payload_blob) const {
         if (auto answer = proto_validator_->validate(m)) {
-          auto payload_field_descriptor =
-              m.GetDescriptor()->FindFieldByLowercaseName("payload");
           shared_model::crypto::Hash hash;
-          if (payload_field_descriptor) {
+          if (payload_blob) {
+            hash = HashProvider::makeHash(*payload_blob);
+          } else if (auto payload_field_descriptor =
+                         payloadFieldDescriptor(m)) {
             const auto &payload =
                 m.GetReflection()->GetMessage(m, payload_field_descriptor);
             // TODO: 2019-03-21 @muratovv refactor with template parameter
@@ -55,8 +129,8 @@ namespace shared_model {
           return iroha::expected::makeError(Error{hash, answer.reason()});
         }
 
-        std::unique_ptr<Interface> result =
-            std::make_unique<Proto>(std::move(m));
+        std::unique_ptr<Interface> result = makeProto(
+            std::move(m), std::move(payload_blob), PayloadBlobConstructible{});
         if (auto answer = interface_validator_->validate(*result)) {
           return iroha::expected::makeError(
               Error{result->hash(), answer.reason()});
@@ -65,9 +139,6 @@ namespace shared_model {
         return iroha::expected::makeValue(std::move(result));
       }
 
-     private:
-      using HashProvider = shared_model::crypto::Sha3_256;
-
       ValidatorType interface_validator_;
       ProtoValidatorType proto_validator_;
     };
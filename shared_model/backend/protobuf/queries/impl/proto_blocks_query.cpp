@@ -6,6 +6,27 @@
 #include "backend/protobuf/queries/proto_blocks_query.hpp"
 #include "backend/protobuf/util.hpp"
 
+namespace {
+  /**
+   * Queries of all new blocks are signed by their meta, as they were before
+   * the start height and the filter were added, and the other ones by the
+   * whole query without its signature
+   * @return signed part of the query
+   */
+  shared_model::interface::types::BlobType makePayload(
+      const iroha::protocol::BlocksQuery &query) {
+    if (query.opt_start_height_case()
+            == iroha::protocol::BlocksQuery::OptStartHeightCase::
+                   OPT_START_HEIGHT_NOT_SET
+        and not query.has_filter()) {
+      return shared_model::proto::makeBlob(query.meta());
+    }
+    auto payload = query;
+    payload.clear_signature();
+    return shared_model::proto::makeBlob(payload);
+  }
+}  // namespace
+
 namespace shared_model {
   namespace proto {
 
@@ -13,7 +34,19 @@ namespace shared_model {
     BlocksQuery::BlocksQuery(BlocksQueryType &&query)
         : CopyableProto(std::forward<BlocksQueryType>(query)),
           blob_{makeBlob(*proto_)},
-          payload_{makeBlob(proto_->meta())},
+          payload_{makePayload(*proto_)},
+          filter_{[this]() -> boost::optional<Filter> {
+            if (not proto_->has_filter()) {
+              return boost::none;
+            }
+            const auto &filter = proto_->filter();
+            return Filter{{filter.account_ids().begin(),
+                           filter.account_ids().end()},
+                          {filter.asset_ids().begin(),
+                           filter.asset_ids().end()},
+                          {filter.command_types().begin(),
+                           filter.command_types().end()}};
+          }()},
           signatures_{[this] {
             SignatureSetType<proto::Signature> set;
             if (proto_->has_signature()) {
@@ -41,6 +74,19 @@ namespace shared_model {
       return proto_->meta().query_counter();
     }
 
+    boost::optional<interface::types::HeightType> BlocksQuery::startHeight()
+        const {
+      if (proto_->opt_start_height_case()
+          == TransportType::OptStartHeightCase::OPT_START_HEIGHT_NOT_SET) {
+        return boost::none;
+      }
+      return proto_->start_height();
+    }
+
+    const boost::optional<BlocksQuery::Filter> &BlocksQuery::filter() const {
+      return filter_;
+    }
+
     const interface::types::BlobType &BlocksQuery::blob() const {
       return blob_;
     }
@@ -59,9 +105,7 @@ namespace shared_model {
         return false;
       }
 
-      auto sig = proto_->mutable_signature();
-      sig->set_signature(signed_blob.hex());
-      sig->set_public_key(public_key.hex());
+      setSignature(*proto_->mutable_signature(), signed_blob, public_key);
       // TODO: nickaleks IR-120 12.12.2018 remove set
       signatures_.emplace(proto_->signature());
       return true;
@@ -28,6 +28,11 @@ namespace shared_model {
 
       interface::types::CounterType queryCounter() const override;
 
+      boost::optional<interface::types::HeightType> startHeight()
+          const override;
+
+      const boost::optional<Filter> &filter() const override;
+
       const interface::types::BlobType &blob() const override;
 
       const interface::types::BlobType &payload() const override;
@@ -48,6 +53,8 @@ namespace shared_model {
 
       const interface::types::BlobType payload_;
 
+      const boost::optional<Filter> filter_;
+
       SignatureSetType<proto::Signature> signatures_;
 
       interface::types::HashType hash_;
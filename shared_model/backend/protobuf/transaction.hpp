@@ -21,12 +21,31 @@ namespace shared_model {
 
       explicit Transaction(TransportType &transaction);
 
+      /**
+       * Creates transaction with the payload serialized in advance, e.g. the
+       * bytes received on the wire, so it is not serialized again for hashing
+       * @param transaction - transport object
+       * @param payload_blob - serialized payload of the transport object
+       */
+      Transaction(TransportType &&transaction,
+                  interface::types::BlobType payload_blob);
+
       Transaction(const Transaction &transaction);
 
       Transaction(Transaction &&o) noexcept;
 
       ~Transaction() override;
 
+      /**
+       * Creates transactions referencing the given transport objects. Hashes
+       * of all transactions are computed at once, which is faster than
+       * hashing every transaction separately
+       * @param transactions - transport objects, must outlive the result
+       * @return transactions in the order of transport objects
+       */
+      static std::vector<Transaction> fromTransport(
+          google::protobuf::RepeatedPtrField<TransportType> &transactions);
+
       const interface::types::AccountIdType &creatorAccountId() const override;
 
       Transaction::CommandsType commands() const override;
@@ -39,6 +58,8 @@ namespace shared_model {
 
       interface::types::SignatureRangeType signatures() const override;
 
+      size_t signaturesCount() const override;
+
       const interface::types::HashType &reducedHash() const override;
 
       bool addSignature(const crypto::Signed &signed_blob,
@@ -59,6 +80,16 @@ namespace shared_model {
       Transaction::ModelType *clone() const override;
 
      private:
+      /// serialized payloads with their hashes, computed in advance
+      struct Digests {
+        interface::types::BlobType payload_blob;
+        interface::types::BlobType reduced_payload_blob;
+        interface::types::HashType hash;
+        interface::types::HashType reduced_hash;
+      };
+
+      Transaction(TransportType &transaction, Digests digests);
+
       struct Impl;
       std::unique_ptr<Impl> impl_;
     };
@@ -6,7 +6,10 @@
 #ifndef IROHA_SHARED_MODEL_PROTO_UTIL_HPP
 #define IROHA_SHARED_MODEL_PROTO_UTIL_HPP
 
+#include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/message.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <boost/optional.hpp>
 #include <vector>
 #include "cryptography/blob.hpp"
 
@@ -21,6 +24,46 @@ namespace shared_model {
       return crypto::Blob(std::move(data));
     }
 
+    /**
+     * Extracts bytes of a length-delimited field, such as an embedded message,
+     * from a serialized message without parsing the field itself
+     * @param message - serialized message
+     * @param field_number - number of the field
+     * @return field bytes, none if the field is absent, occurs more than once
+     * or the message is malformed
+     */
+    inline boost::optional<crypto::Blob> fieldBlob(
+        const crypto::Blob::Bytes &message, int field_number) {
+      using google::protobuf::internal::WireFormatLite;
+      google::protobuf::io::CodedInputStream input(
+          message.data(), static_cast<int>(message.size()));
+      boost::optional<crypto::Blob> result;
+      while (auto tag = input.ReadTag()) {
+        if (WireFormatLite::GetTagFieldNumber(tag) != field_number) {
+          if (not WireFormatLite::SkipField(&input, tag)) {
+            return boost::none;
+          }
+          continue;
+        }
+        uint32_t length;
+        if (result
+            or WireFormatLite::GetTagWireType(tag)
+                != WireFormatLite::WIRETYPE_LENGTH_DELIMITED
+            or not input.ReadVarint32(&length)) {
+          return boost::none;
+        }
+        auto begin = message.begin() + input.CurrentPosition();
+        if (not input.Skip(static_cast<int>(length))) {
+          return boost::none;
+        }
+        result = crypto::Blob(crypto::Blob::Bytes(begin, begin + length));
+      }
+      if (not input.ConsumedEntireMessage()) {
+        return boost::none;
+      }
+      return result;
+    }
+
   }  // namespace proto
 }  // namespace shared_model
 
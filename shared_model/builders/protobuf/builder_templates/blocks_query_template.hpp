@@ -96,6 +96,11 @@ namespace shared_model {
         });
       }
 
+      auto startHeight(interface::types::HeightType height) const {
+        return transform<0>(
+            [&](auto &qry) { qry.set_start_height(height); });
+      }
+
       auto build() const {
         static_assert(S == (1 << TOTAL) - 1, "Required fields are not set");
         auto result = BlocksQuery(iroha::protocol::BlocksQuery(query_));
@@ -9,6 +9,7 @@
 #include "backend/protobuf/common_objects/signature.hpp"
 #include "backend/protobuf/transaction.hpp"
 #include "cryptography/crypto_provider/crypto_signer.hpp"
+#include "cryptography/ed25519_sha3_impl/keypair_signer.hpp"
 #include "cryptography/keypair.hpp"
 #include "interfaces/common_objects/types.hpp"
 
@@ -67,6 +68,22 @@ namespace shared_model {
         return *this;
       }
 
+      /**
+       * Add signature of a signer with cached keys
+       * @param signer - signer to sign with
+       * @return signed object
+       */
+      UnsignedWrapper &signAndAddSignature(
+          const crypto::KeypairSigner &signer) {
+        auto signedBlob =
+            signer.sign(shared_model::crypto::Blob(object_.payload()));
+        if (object_finalized_) {
+          throw std::runtime_error("object has already been finalized");
+        }
+        object_.addSignature(signedBlob, signer.publicKey());
+        return *this;
+      }
+
       /**
        * Finishes object building
        * @return built signed object
@@ -55,9 +55,10 @@ namespace shared_model {
 
       /**
        * @return provides human-readable representation of blob without leading
-       * 0x
+       * 0x, computed on every call, so that hashes and keys which are never
+       * printed do not carry it
        */
-      virtual const std::string &hex() const;
+      virtual std::string hex() const;
 
       /**
        * @return size of raw representation of blob
@@ -73,7 +74,6 @@ namespace shared_model {
 
      private:
       Bytes blob_;
-      std::string hex_;
     };
 
   }  // namespace crypto
@@ -7,25 +7,25 @@
 #define IROHA_CRYPTO_MODEL_SIGNER_HPP_
 
 #include "cryptography/crypto_provider/abstract_crypto_model_signer.hpp"
-#include "cryptography/crypto_provider/crypto_signer.hpp"
+#include "cryptography/ed25519_sha3_impl/keypair_signer.hpp"
 
 #include "interfaces/iroha_internal/block.hpp"
 
 namespace shared_model {
 
   namespace crypto {
-    template <typename Algorithm = CryptoSigner<>>
     class CryptoModelSigner
         : public AbstractCryptoModelSigner<interface::Block> {
      public:
-      explicit CryptoModelSigner(const shared_model::crypto::Keypair &keypair);
+      explicit CryptoModelSigner(const shared_model::crypto::Keypair &keypair)
+          : signer_(keypair) {}
 
       virtual ~CryptoModelSigner() = default;
 
       template <typename T>
       inline void sign(T &signable) const noexcept {
-        auto signedBlob = Algorithm::sign(signable.payload(), keypair_);
-        signable.addSignature(signedBlob, keypair_.publicKey());
+        auto signedBlob = signer_.sign(signable.payload());
+        signable.addSignature(signedBlob, signer_.publicKey());
       }
 
       void sign(interface::Block &m) const override {
@@ -33,14 +33,9 @@ namespace shared_model {
       }
 
      private:
-      shared_model::crypto::Keypair keypair_;
+      KeypairSigner signer_;
     };
 
-    template <typename Algorithm>
-    CryptoModelSigner<Algorithm>::CryptoModelSigner(
-        const shared_model::crypto::Keypair &keypair)
-        : keypair_(keypair) {}
-
   }  // namespace crypto
 }  // namespace shared_model
 
@@ -0,0 +1,175 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_CRYPTO_PROVIDER_REGISTRY_HPP
+#define IROHA_CRYPTO_PROVIDER_REGISTRY_HPP
+
+#include <atomic>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "cryptography/keypair.hpp"
+#include "cryptography/signed.hpp"
+#include "cryptography/verification_entry.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    /**
+     * Implementation of signing and verification which can be selected at
+     * runtime. Providers must produce keys and signatures in the format of
+     * DefaultCryptoAlgorithmType, since their lengths are checked by
+     * validators, e.g. they may be other ed25519 implementations or signers
+     * backed by a hardware module
+     */
+    struct CryptoProvider {
+      std::function<Signed(const Blob &, const Keypair &)> sign;
+      std::function<bool(const Signed &, const Blob &, const PublicKey &)>
+          verify;
+      std::function<bool(const std::vector<VerificationEntry> &)> verify_batch;
+
+      /// @return provider calling static methods of Algorithm
+      template <typename Algorithm>
+      static CryptoProvider from() {
+        return CryptoProvider{
+            [](const Blob &blob, const Keypair &keypair) {
+              return Algorithm::sign(blob, keypair);
+            },
+            [](const Signed &signed_data,
+               const Blob &source,
+               const PublicKey &public_key) {
+              return Algorithm::verify(signed_data, source, public_key);
+            },
+            [](const std::vector<VerificationEntry> &entries) {
+              return Algorithm::verifyBatch(entries);
+            }};
+      }
+    };
+
+    /**
+     * Process-wide set of crypto providers. The provider used by CryptoSigner
+     * and CryptoVerifier by default is selected by name, initially it is
+     * DefaultCryptoAlgorithmType registered as kDefaultProvider. Selection is
+     * expected to be done at startup, before signing and verification begin
+     */
+    class CryptoProviderRegistry {
+     public:
+      static constexpr const char *kDefaultProvider = "ed25519_sha3";
+
+      /**
+       * Adds a provider
+       * @param name - name to select the provider by
+       * @param provider - provider to add
+       * @return false if a provider with this name is already registered
+       */
+      static bool registerProvider(const std::string &name,
+                                   CryptoProvider provider) {
+        auto &state = getState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        return state.providers
+            .emplace(name,
+                     std::make_unique<CryptoProvider>(std::move(provider)))
+            .second;
+      }
+
+      /**
+       * Makes the provider used by default
+       * @param name - name of a registered provider
+       * @return false if there is no provider with this name
+       */
+      static bool select(const std::string &name) {
+        auto &state = getState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        auto it = state.providers.find(name);
+        if (it == state.providers.end()) {
+          return false;
+        }
+        state.selected_name = name;
+        state.selected.store(it->second.get(), std::memory_order_release);
+        return true;
+      }
+
+      /// @return provider used by default
+      static const CryptoProvider &selected() {
+        return *getState().selected.load(std::memory_order_acquire);
+      }
+
+      /// @return name of the provider used by default
+      static std::string selectedName() {
+        auto &state = getState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        return state.selected_name;
+      }
+
+      /// @return names of registered providers in alphabetical order
+      static std::vector<std::string> names() {
+        auto &state = getState();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        std::vector<std::string> result;
+        for (const auto &provider : state.providers) {
+          result.push_back(provider.first);
+        }
+        return result;
+      }
+
+      /// close constructor for forbidding instantiation
+      CryptoProviderRegistry() = delete;
+
+     private:
+      struct State {
+        State() : selected_name(kDefaultProvider) {
+          auto provider = std::make_unique<CryptoProvider>(
+              CryptoProvider::from<DefaultCryptoAlgorithmType>());
+          selected.store(provider.get(), std::memory_order_relaxed);
+          providers.emplace(selected_name, std::move(provider));
+        }
+
+        std::mutex mutex;
+        /// providers are never removed, so pointers to them stay valid
+        std::map<std::string, std::unique_ptr<CryptoProvider>> providers;
+        std::string selected_name;
+        std::atomic<const CryptoProvider *> selected;
+      };
+
+      static State &getState() {
+        static State state;
+        return state;
+      }
+    };
+
+    /**
+     * Algorithm for CryptoSigner and CryptoVerifier which forwards calls to
+     * the provider selected in CryptoProviderRegistry
+     */
+    class SelectedCryptoProvider {
+     public:
+      static Signed sign(const Blob &blob, const Keypair &keypair) {
+        return CryptoProviderRegistry::selected().sign(blob, keypair);
+      }
+
+      static bool verify(const Signed &signed_data,
+                         const Blob &source,
+                         const PublicKey &public_key) {
+        return CryptoProviderRegistry::selected().verify(
+            signed_data, source, public_key);
+      }
+
+      static bool verifyBatch(const std::vector<VerificationEntry> &entries) {
+        return CryptoProviderRegistry::selected().verify_batch(entries);
+      }
+
+      /// close constructor for forbidding instantiation
+      SelectedCryptoProvider() = delete;
+    };
+
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // IROHA_CRYPTO_PROVIDER_REGISTRY_HPP
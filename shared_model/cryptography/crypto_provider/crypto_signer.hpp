@@ -7,7 +7,7 @@
 #define IROHA_CRYPTO_SIGNER_HPP
 
 #include "cryptography/blob.hpp"
-#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "cryptography/crypto_provider/crypto_provider_registry.hpp"
 #include "cryptography/keypair.hpp"
 #include "cryptography/signed.hpp"
 
@@ -18,7 +18,7 @@ namespace shared_model {
      * cryptographic algorithms
      * @tparam Algorithm - cryptographic algorithm for singing
      */
-    template <typename Algorithm = DefaultCryptoAlgorithmType>
+    template <typename Algorithm = SelectedCryptoProvider>
     class CryptoSigner {
      public:
       /**
@@ -6,7 +6,10 @@
 #ifndef IROHA_CRYPTO_VERIFIER_HPP
 #define IROHA_CRYPTO_VERIFIER_HPP
 
-#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include <vector>
+
+#include "cryptography/crypto_provider/crypto_provider_registry.hpp"
+#include "cryptography/verification_entry.hpp"
 
 namespace shared_model {
   namespace crypto {
@@ -20,7 +23,7 @@ namespace shared_model {
      * signatures
      * @tparam Algorithm - cryptographic algorithm for verification
      */
-    template <typename Algorithm = DefaultCryptoAlgorithmType>
+    template <typename Algorithm = SelectedCryptoProvider>
     class CryptoVerifier {
      public:
       /**
@@ -36,6 +39,16 @@ namespace shared_model {
         return Algorithm::verify(signedData, source, pubKey);
       }
 
+      /**
+       * Verify several signatures at once
+       * @param entries - signatures with data that was signed and public keys
+       * of signatories
+       * @return true if all signatures are correct
+       */
+      static bool verifyBatch(const std::vector<VerificationEntry> &entries) {
+        return Algorithm::verifyBatch(entries);
+      }
+
       /// close constructor for forbidding instantiation
       CryptoVerifier() = delete;
     };
@@ -22,6 +22,11 @@ namespace shared_model {
       return Verifier::verify(signedData, orig, publicKey);
     }
 
+    bool CryptoProviderEd25519Sha3::verifyBatch(
+        const std::vector<VerificationEntry> &entries) {
+      return Verifier::verifyBatch(entries);
+    }
+
     Seed CryptoProviderEd25519Sha3::generateSeed() {
       return Seed(iroha::create_seed().to_string());
     }
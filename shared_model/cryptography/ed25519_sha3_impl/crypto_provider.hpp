@@ -6,9 +6,12 @@
 #ifndef IROHA_CRYPTOPROVIDER_HPP
 #define IROHA_CRYPTOPROVIDER_HPP
 
+#include <vector>
+
 #include "cryptography/keypair.hpp"
 #include "cryptography/seed.hpp"
 #include "cryptography/signed.hpp"
+#include "cryptography/verification_entry.hpp"
 
 namespace shared_model {
   namespace crypto {
@@ -35,6 +38,14 @@ namespace shared_model {
       static bool verify(const Signed &signedData,
                          const Blob &orig,
                          const PublicKey &publicKey);
+
+      /**
+       * Verifies several signatures.
+       * @param entries - signatures with their messages and public keys
+       * @return true if all signatures are valid
+       */
+      static bool verifyBatch(const std::vector<VerificationEntry> &entries);
+
       /**
        * Generates new seed
        * @return Seed generated
@@ -0,0 +1,277 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "cryptography/ed25519_sha3_impl/internal/sha3_multi_buffer.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <vector>
+
+#include "cryptography/ed25519_sha3_impl/internal/sha3_hash.hpp"
+
+namespace iroha {
+
+  namespace {
+
+    /// hash every message separately
+    void hashSeparately(const uint8_t *const *inputs,
+                        const size_t *sizes,
+                        uint8_t *const *outputs,
+                        size_t count) {
+      for (size_t i = 0; i < count; ++i) {
+        sha3_256(outputs[i], inputs[i], sizes[i]);
+      }
+    }
+
+  }  // namespace
+
+}  // namespace iroha
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define IROHA_SHA3_MULTI_BUFFER_SIMD
+#endif
+
+#ifdef IROHA_SHA3_MULTI_BUFFER_SIMD
+
+// Keccak loops are unrolled, so rotation amounts and lane indices become
+// immediates
+#if defined(__clang__)
+#define IROHA_UNROLL _Pragma("unroll")
+#else
+#define IROHA_UNROLL _Pragma("GCC unroll 25")
+#endif
+
+namespace iroha {
+
+  namespace {
+
+    /// SHA3-256 rate in bytes
+    constexpr size_t kRate = 136;
+    constexpr size_t kRateWords = kRate / 8;
+    constexpr size_t kHashWords = 4;
+
+    constexpr uint64_t kRoundConstants[24] = {
+        0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL,
+        0x8000000080008000ULL, 0x000000000000808bULL, 0x0000000080000001ULL,
+        0x8000000080008081ULL, 0x8000000000008009ULL, 0x000000000000008aULL,
+        0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+        0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL,
+        0x8000000000008003ULL, 0x8000000000008002ULL, 0x8000000000000080ULL,
+        0x000000000000800aULL, 0x800000008000000aULL, 0x8000000080008081ULL,
+        0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL};
+
+    constexpr unsigned kRotations[24] = {1,  3,  6,  10, 15, 21, 28, 36,
+                                         45, 55, 2,  14, 27, 41, 56, 8,
+                                         25, 43, 62, 18, 39, 61, 20, 44};
+
+    constexpr unsigned kPiLanes[24] = {10, 7,  11, 17, 18, 3,  5,  16,
+                                       8,  21, 24, 4,  15, 23, 19, 13,
+                                       12, 2,  20, 14, 22, 9,  6,  1};
+
+    /// 4 and 8 independent Keccak lanes in AVX2 and AVX-512 registers
+    typedef uint64_t Lanes4 __attribute__((vector_size(32)));
+    typedef uint64_t Lanes8 __attribute__((vector_size(64)));
+
+    /**
+     * Keccak-f[1600] applied to every lane of the state. Always inlined so
+     * that it is compiled for the instruction set of the calling kernel
+     */
+    template <typename V>
+    inline __attribute__((always_inline)) void keccakF(V *state) {
+      V c[5], t;
+      for (size_t round = 0; round < 24; ++round) {
+        IROHA_UNROLL
+        for (size_t i = 0; i < 5; ++i) {
+          c[i] = state[i] ^ state[i + 5] ^ state[i + 10] ^ state[i + 15]
+              ^ state[i + 20];
+        }
+        IROHA_UNROLL
+        for (size_t i = 0; i < 5; ++i) {
+          const auto &next = c[(i + 1) % 5];
+          t = c[(i + 4) % 5] ^ ((next << 1) | (next >> 63));
+          IROHA_UNROLL
+          for (size_t j = 0; j < 25; j += 5) {
+            state[j + i] ^= t;
+          }
+        }
+
+        t = state[1];
+        IROHA_UNROLL
+        for (size_t i = 0; i < 24; ++i) {
+          auto lane = kPiLanes[i];
+          auto current = state[lane];
+          state[lane] = (t << kRotations[i]) | (t >> (64 - kRotations[i]));
+          t = current;
+        }
+
+        IROHA_UNROLL
+        for (size_t j = 0; j < 25; j += 5) {
+          IROHA_UNROLL
+          for (size_t i = 0; i < 5; ++i) {
+            c[i] = state[j + i];
+          }
+          IROHA_UNROLL
+          for (size_t i = 0; i < 5; ++i) {
+            state[j + i] ^= ~c[(i + 1) % 5] & c[(i + 2) % 5];
+          }
+        }
+
+        state[0] ^= kRoundConstants[round];
+      }
+    }
+
+    inline uint64_t loadWord(const uint8_t *bytes) {
+      uint64_t word;
+      std::memcpy(&word, bytes, sizeof(word));
+      return word;
+    }
+
+    /**
+     * Hashes kLanes messages which consist of the same number of blocks
+     */
+    template <typename V, size_t kLanes>
+    inline __attribute__((always_inline)) void hashLanes(
+        const uint8_t *const *inputs,
+        const size_t *sizes,
+        uint8_t *const *outputs) {
+      const size_t blocks = sizes[0] / kRate + 1;
+
+      // the last block of every message with SHA3 padding
+      uint8_t last[kLanes][kRate];
+      for (size_t lane = 0; lane < kLanes; ++lane) {
+        auto tail = sizes[lane] % kRate;
+        std::memset(last[lane], 0, kRate);
+        std::memcpy(last[lane], inputs[lane] + (blocks - 1) * kRate, tail);
+        last[lane][tail] ^= 0x06;
+        last[lane][kRate - 1] ^= 0x80;
+      }
+
+      V state[25] = {};
+      for (size_t block = 0; block < blocks; ++block) {
+        const uint8_t *data[kLanes];
+        for (size_t lane = 0; lane < kLanes; ++lane) {
+          data[lane] =
+              block + 1 < blocks ? inputs[lane] + block * kRate : last[lane];
+        }
+        for (size_t word = 0; word < kRateWords; ++word) {
+          V value;
+          for (size_t lane = 0; lane < kLanes; ++lane) {
+            value[lane] = loadWord(data[lane] + word * 8);
+          }
+          state[word] ^= value;
+        }
+        keccakF(state);
+      }
+
+      for (size_t lane = 0; lane < kLanes; ++lane) {
+        for (size_t word = 0; word < kHashWords; ++word) {
+          uint64_t value = state[word][lane];
+          std::memcpy(outputs[lane] + word * 8, &value, sizeof(value));
+        }
+      }
+    }
+
+    __attribute__((target("avx2"))) void hash4(const uint8_t *const *inputs,
+                                               const size_t *sizes,
+                                               uint8_t *const *outputs) {
+      hashLanes<Lanes4, 4>(inputs, sizes, outputs);
+    }
+
+    __attribute__((target("avx512f"))) void hash8(
+        const uint8_t *const *inputs,
+        const size_t *sizes,
+        uint8_t *const *outputs) {
+      hashLanes<Lanes8, 8>(inputs, sizes, outputs);
+    }
+
+    using Kernel = void (*)(const uint8_t *const *,
+                            const size_t *,
+                            uint8_t *const *);
+
+    /**
+     * Hashes messages with kernel which processes lanes messages at once.
+     * Messages are grouped by number of blocks, incomplete groups are filled
+     * with copies of their first message
+     */
+    void hashGrouped(const uint8_t *const *inputs,
+                     const size_t *sizes,
+                     uint8_t *const *outputs,
+                     size_t count,
+                     Kernel kernel,
+                     size_t lanes) {
+      auto blocks = [sizes](size_t i) { return sizes[i] / kRate + 1; };
+      std::vector<size_t> order(count);
+      std::iota(order.begin(), order.end(), 0);
+      std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+        return blocks(a) < blocks(b);
+      });
+
+      std::vector<const uint8_t *> group_inputs(lanes);
+      std::vector<size_t> group_sizes(lanes);
+      std::vector<uint8_t *> group_outputs(lanes);
+      std::vector<uint8_t> scratch(lanes * kHashWords * 8);
+
+      for (size_t begin = 0; begin < count;) {
+        auto end = begin + 1;
+        while (end < count and end - begin < lanes
+               and blocks(order[end]) == blocks(order[begin])) {
+          ++end;
+        }
+        if (end - begin == 1) {
+          hashSeparately(inputs + order[begin],
+                         sizes + order[begin],
+                         outputs + order[begin],
+                         1);
+        } else {
+          for (size_t lane = 0; lane < lanes; ++lane) {
+            auto used = begin + lane < end;
+            auto index = order[used ? begin + lane : begin];
+            group_inputs[lane] = inputs[index];
+            group_sizes[lane] = sizes[index];
+            group_outputs[lane] =
+                used ? outputs[index] : scratch.data() + lane * kHashWords * 8;
+          }
+          kernel(group_inputs.data(), group_sizes.data(), group_outputs.data());
+        }
+        begin = end;
+      }
+    }
+
+  }  // namespace
+
+  void sha3_256_multi(const uint8_t *const *inputs,
+                      const size_t *sizes,
+                      uint8_t *const *outputs,
+                      size_t count) {
+    static const bool kHasAvx512 = __builtin_cpu_supports("avx512f");
+    static const bool kHasAvx2 = __builtin_cpu_supports("avx2");
+    if (count < 2) {
+      hashSeparately(inputs, sizes, outputs, count);
+    } else if (kHasAvx512) {
+      hashGrouped(inputs, sizes, outputs, count, hash8, 8);
+    } else if (kHasAvx2) {
+      hashGrouped(inputs, sizes, outputs, count, hash4, 4);
+    } else {
+      hashSeparately(inputs, sizes, outputs, count);
+    }
+  }
+
+}  // namespace iroha
+
+#else
+
+namespace iroha {
+
+  void sha3_256_multi(const uint8_t *const *inputs,
+                      const size_t *sizes,
+                      uint8_t *const *outputs,
+                      size_t count) {
+    hashSeparately(inputs, sizes, outputs, count);
+  }
+
+}  // namespace iroha
+
+#endif  // IROHA_SHA3_MULTI_BUFFER_SIMD
@@ -0,0 +1,31 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHA3_MULTI_BUFFER_HPP
+#define IROHA_SHA3_MULTI_BUFFER_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace iroha {
+
+  /**
+   * Computes SHA3-256 of several messages. Messages with the same number of
+   * Keccak blocks are hashed together in SIMD lanes (8 with AVX-512, 4 with
+   * AVX2, selected at runtime); without SIMD support every message is hashed
+   * separately.
+   * @param inputs - pointers to messages
+   * @param sizes - sizes of messages
+   * @param outputs - pointers to 32-byte buffers for hashes
+   * @param count - number of messages
+   */
+  void sha3_256_multi(const uint8_t *const *inputs,
+                      const size_t *sizes,
+                      uint8_t *const *outputs,
+                      size_t count);
+
+}  // namespace iroha
+
+#endif  // IROHA_SHA3_MULTI_BUFFER_HPP
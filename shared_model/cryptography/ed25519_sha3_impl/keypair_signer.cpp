@@ -0,0 +1,92 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "cryptography/ed25519_sha3_impl/keypair_signer.hpp"
+
+#include <sys/mman.h>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "cryptography/crypto_provider/crypto_provider_registry.hpp"
+#include "cryptography/ed25519_sha3_impl/internal/ed25519_impl.hpp"
+#include "cryptography/ed25519_sha3_impl/internal/sha3_hash.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    struct KeypairSigner::Keys {
+      /// @param decode - whether to decode the keys for signing by them
+      Keys(const Keypair &keypair, bool decode)
+          : keypair(keypair), decoded(decode) {
+        if (decoded) {
+          public_key = iroha::pubkey_t::from_string(
+              toBinaryString(keypair.publicKey()));
+          private_key = iroha::privkey_t::from_string(
+              toBinaryString(keypair.privateKey()));
+        }
+        for (const auto &buffer : privateKeyBuffers()) {
+          // failure to lock, e.g. due to RLIMIT_MEMLOCK, leaves the key
+          // swappable but usable
+          ::mlock(buffer.first, buffer.second);
+        }
+      }
+
+      ~Keys() {
+        for (const auto &buffer : privateKeyBuffers()) {
+          std::memset(buffer.first, 0, buffer.second);
+          ::munlock(buffer.first, buffer.second);
+        }
+      }
+
+      /**
+       * @return buffers holding the private key: the decoded key and the
+       * bytes owned by the keypair, which is never copied, so they are
+       * locked and wiped in place
+       */
+      std::vector<std::pair<void *, size_t>> privateKeyBuffers() {
+        auto &bytes = const_cast<Blob::Bytes &>(keypair.privateKey().blob());
+        return {{bytes.data(), bytes.size()},
+                {private_key.data(), private_key.size()}};
+      }
+
+      Keypair keypair;
+      /// whether the keys below are used instead of the selected provider
+      const bool decoded;
+      iroha::pubkey_t public_key;
+      iroha::privkey_t private_key;
+    };
+
+    KeypairSigner::KeypairSigner(const Keypair &keypair)
+        // the provider is selected at startup, before signing begins
+        : keys_(std::make_unique<Keys>(
+              keypair,
+              CryptoProviderRegistry::selectedName()
+                  == CryptoProviderRegistry::kDefaultProvider)) {}
+
+    KeypairSigner::KeypairSigner(KeypairSigner &&) = default;
+
+    KeypairSigner &KeypairSigner::operator=(KeypairSigner &&) = default;
+
+    KeypairSigner::~KeypairSigner() = default;
+
+    Signed KeypairSigner::sign(const Blob &blob) const {
+      if (not keys_->decoded) {
+        return SelectedCryptoProvider::sign(blob, keys_->keypair);
+      }
+      auto hash = iroha::sha3_256(blob.blob().data(), blob.size());
+      return Signed(iroha::sign(hash.data(),
+                                hash.size(),
+                                keys_->public_key,
+                                keys_->private_key)
+                        .to_string());
+    }
+
+    const PublicKey &KeypairSigner::publicKey() const {
+      return keys_->keypair.publicKey();
+    }
+
+  }  // namespace crypto
+}  // namespace shared_model
@@ -0,0 +1,53 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARED_MODEL_KEYPAIR_SIGNER_HPP
+#define IROHA_SHARED_MODEL_KEYPAIR_SIGNER_HPP
+
+#include <memory>
+
+#include "cryptography/blob.hpp"
+#include "cryptography/keypair.hpp"
+#include "cryptography/signed.hpp"
+
+namespace shared_model {
+  namespace crypto {
+
+    /**
+     * Signer of many messages with one keypair, e.g. the keypair of the node
+     * signing votes and blocks. The keys are decoded once and kept in memory
+     * locked against swapping, which is wiped on destruction. When the
+     * default provider is not selected at construction, messages are signed
+     * by the selected one with the keypair
+     */
+    class KeypairSigner {
+     public:
+      explicit KeypairSigner(const Keypair &keypair);
+
+      KeypairSigner(KeypairSigner &&);
+      KeypairSigner &operator=(KeypairSigner &&);
+
+      ~KeypairSigner();
+
+      /**
+       * Signs provided blob
+       * @param blob - to sign
+       * @return Signed object with signed data
+       */
+      Signed sign(const Blob &blob) const;
+
+      /// @return public key of the keypair
+      const PublicKey &publicKey() const;
+
+     private:
+      struct Keys;
+
+      std::unique_ptr<Keys> keys_;
+    };
+
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // IROHA_SHARED_MODEL_KEYPAIR_SIGNER_HPP
@@ -4,18 +4,94 @@
  */
 
 #include "verifier.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "cache/sharded_cache.hpp"
 #include "cryptography/ed25519_sha3_impl/internal/ed25519_impl.hpp"
 #include "cryptography/ed25519_sha3_impl/internal/sha3_hash.hpp"
 
 namespace shared_model {
   namespace crypto {
+
+    namespace {
+      /// maximum number of remembered valid signatures
+      constexpr uint32_t kVerifiedCacheSize = 65536;
+
+      /**
+       * Valid signatures identified by message hash, public key and
+       * signature. The same signature is checked by torii, MST, ordering and
+       * block validation, so only the first check computes ed25519. Invalid
+       * signatures are not stored, so they cannot evict valid ones for free.
+       * Signatures are verified by many threads at once, so the cache is
+       * sharded, and every shard is locked for its lookups and insertions
+       */
+      iroha::cache::ShardedCache<std::string, bool> &verifiedCache() {
+        static iroha::cache::ShardedCache<std::string, bool> cache(
+            kVerifiedCacheSize, kVerifiedCacheSize * 3 / 4);
+        return cache;
+      }
+
+      bool verifyHash(const std::string &hash,
+                      const PublicKey &public_key,
+                      const Signed &signed_data) {
+        auto public_key_bin = toBinaryString(public_key);
+        auto signed_data_bin = toBinaryString(signed_data);
+        auto check = [&] {
+          return iroha::verify(hash,
+                               iroha::pubkey_t::from_string(public_key_bin),
+                               iroha::sig_t::from_string(signed_data_bin));
+        };
+        // concatenated key is unambiguous only for well-sized parts
+        if (public_key_bin.size() != iroha::pubkey_t::size()
+            or signed_data_bin.size() != iroha::sig_t::size()) {
+          return check();
+        }
+
+        auto key = hash + public_key_bin + signed_data_bin;
+        if (verifiedCache().findItem(key)) {
+          return true;
+        }
+        if (not check()) {
+          return false;
+        }
+        verifiedCache().addItem(key, true);
+        return true;
+      }
+    }  // namespace
+
     bool Verifier::verify(const Signed &signedData,
                           const Blob &orig,
                           const PublicKey &publicKey) {
-      return iroha::verify(
+      return verifyHash(
           iroha::sha3_256(crypto::toBinaryString(orig)).to_string(),
-          iroha::pubkey_t::from_string(toBinaryString(publicKey)),
-          iroha::sig_t::from_string(toBinaryString(signedData)));
+          publicKey,
+          signedData);
+    }
+
+    bool Verifier::verifyBatch(const std::vector<VerificationEntry> &entries) {
+      // signatures of a transaction, a block or a round of votes are mostly
+      // made over the same message
+      std::vector<std::pair<const Blob *, std::string>> hashes;
+      for (const auto &entry : entries) {
+        auto hash = std::find_if(
+            hashes.begin(), hashes.end(), [&entry](const auto &hash) {
+              return hash.first == &entry.source or *hash.first == entry.source;
+            });
+        if (hash == hashes.end()) {
+          hashes.emplace_back(
+              &entry.source,
+              iroha::sha3_256(crypto::toBinaryString(entry.source))
+                  .to_string());
+          hash = std::prev(hashes.end());
+        }
+        if (not verifyHash(
+                hash->second, entry.public_key, entry.signed_data)) {
+          return false;
+        }
+      }
+      return true;
     }
   }  // namespace crypto
 }  // namespace shared_model
@@ -6,8 +6,11 @@
 #ifndef IROHA_SHARED_MODEL_VERIFIER_HPP
 #define IROHA_SHARED_MODEL_VERIFIER_HPP
 
+#include <vector>
+
 #include "cryptography/public_key.hpp"
 #include "cryptography/signed.hpp"
+#include "cryptography/verification_entry.hpp"
 
 namespace shared_model {
   namespace crypto {
@@ -19,6 +22,13 @@ namespace shared_model {
       static bool verify(const Signed &signedData,
                          const Blob &orig,
                          const PublicKey &publicKey);
+
+      /**
+       * Verifies several signatures at once. Message of every distinct
+       * source is hashed once for all signatures of this source
+       * @return true if all signatures are valid
+       */
+      static bool verifyBatch(const std::vector<VerificationEntry> &entries);
     };
 
   }  // namespace crypto
@@ -18,7 +18,8 @@ namespace shared_model {
     class Hash : public Blob {
      public:
       /**
-       * To calculate hash used by some standard containers
+       * To calculate hash used by some standard containers, takes the leading
+       * bytes of the hash as they are
        */
       struct Hasher {
         std::size_t operator()(const Hash &h) const;
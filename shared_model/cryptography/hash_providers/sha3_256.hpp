@@ -6,8 +6,11 @@
 #ifndef IROHA_SHARED_MODEL_SHA3_256_HPP
 #define IROHA_SHARED_MODEL_SHA3_256_HPP
 
+#include <vector>
+
 #include "crypto/hash_types.hpp"
 #include "cryptography/ed25519_sha3_impl/internal/sha3_hash.hpp"
+#include "cryptography/ed25519_sha3_impl/internal/sha3_multi_buffer.hpp"
 #include "cryptography/hash.hpp"
 
 namespace shared_model {
@@ -17,6 +20,36 @@ namespace shared_model {
       static Hash makeHash(const Blob &blob) {
         return Hash(iroha::sha3_256(blob.blob()).to_string());
       }
+
+      /**
+       * Hashes several blobs at once using SIMD lanes when available
+       * @param blobs - blobs to hash, must not be null
+       * @return hashes in the order of blobs
+       */
+      static std::vector<Hash> makeHashes(
+          const std::vector<const Blob *> &blobs) {
+        std::vector<const uint8_t *> inputs;
+        std::vector<size_t> sizes;
+        std::vector<iroha::hash256_t> digests(blobs.size());
+        std::vector<uint8_t *> outputs;
+        inputs.reserve(blobs.size());
+        sizes.reserve(blobs.size());
+        outputs.reserve(blobs.size());
+        for (size_t i = 0; i < blobs.size(); ++i) {
+          inputs.push_back(blobs[i]->blob().data());
+          sizes.push_back(blobs[i]->blob().size());
+          outputs.push_back(digests[i].data());
+        }
+        iroha::sha3_256_multi(
+            inputs.data(), sizes.data(), outputs.data(), blobs.size());
+
+        std::vector<Hash> hashes;
+        hashes.reserve(digests.size());
+        for (const auto &digest : digests) {
+          hashes.emplace_back(digest.to_string());
+        }
+        return hashes;
+      }
     };
   }  // namespace crypto
 }  // namespace shared_model
@@ -19,9 +19,7 @@ namespace shared_model {
 
     Blob::Blob(const Bytes &blob) : Blob(Bytes(blob)) {}
 
-    Blob::Blob(Bytes &&blob) noexcept : blob_(std::move(blob)) {
-      hex_ = iroha::bytestringToHexstring(toBinaryString(*this));
-    }
+    Blob::Blob(Bytes &&blob) noexcept : blob_(std::move(blob)) {}
 
     Blob *Blob::clone() const {
       return new Blob(blob());
@@ -42,8 +40,8 @@ namespace shared_model {
       return blob_;
     }
 
-    const std::string &Blob::hex() const {
-      return hex_;
+    std::string Blob::hex() const {
+      return iroha::bytesToHexstring(blob_.data(), blob_.size());
     }
 
     size_t Blob::size() const {
@@ -5,6 +5,8 @@
 
 #include "cryptography/hash.hpp"
 
+#include <cstring>
+
 #include <boost/functional/hash.hpp>
 
 #include "common/byteutils.hpp"
@@ -29,13 +31,14 @@ namespace shared_model {
     }
 
     std::size_t Hash::Hasher::operator()(const Hash &h) const {
-      using boost::hash_combine;
-      using boost::hash_value;
-
-      std::size_t seed = 0;
-      hash_combine(seed, hash_value(h.blob()));
-
-      return seed;
+      const auto &bytes = h.blob();
+      // bytes of a hash are uniformly distributed already
+      if (bytes.size() >= sizeof(std::size_t)) {
+        std::size_t seed;
+        std::memcpy(&seed, bytes.data(), sizeof(seed));
+        return seed;
+      }
+      return boost::hash_range(bytes.begin(), bytes.end());
     }
   }  // namespace crypto
 }  // namespace shared_model
@@ -0,0 +1,29 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_SHARED_MODEL_VERIFICATION_ENTRY_HPP
+#define IROHA_SHARED_MODEL_VERIFICATION_ENTRY_HPP
+
+namespace shared_model {
+  namespace crypto {
+
+    class Signed;
+    class Blob;
+    class PublicKey;
+
+    /**
+     * Signature to be verified as a part of a batch. Referenced objects must
+     * outlive the verification
+     */
+    struct VerificationEntry {
+      const Signed &signed_data;
+      const Blob &source;
+      const PublicKey &public_key;
+    };
+
+  }  // namespace crypto
+}  // namespace shared_model
+
+#endif  // IROHA_SHARED_MODEL_VERIFICATION_ENTRY_HPP
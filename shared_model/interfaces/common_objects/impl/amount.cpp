@@ -5,7 +5,7 @@
 
 #include "interfaces/common_objects/amount.hpp"
 
-#include <regex>
+#include <algorithm>
 
 #include "utils/string_builder.hpp"
 
@@ -16,32 +16,57 @@ namespace shared_model {
         : amount_(std::move(amount)),
           precision_(0),
           multiprecision_repr_([this] {
-            static const std::regex r("([0-9]+)(\\.([0-9]+))?");
-            // 123.456 will have the following groups:
-            //   [0] -> 123.456, [1] -> 123
-            //   [2] -> .456,    [3] -> 456
-            std::smatch match;
-            if (std::regex_match(this->amount_, match, r)
-                && match.size() == 4) {
-              this->precision_ = match[3].length();
-              auto str = match[0].str();
-              size_t pos = match[1].length();
-              // remove dot if it exist
-              if (pos < str.size()) {
-                str.erase(str.begin() + pos);
+            // the amount has the form [0-9]+(\.[0-9]+)?, 123.456 has the
+            // value 123456 and the precision 3
+            const auto &str = this->amount_;
+            auto is_digit = [](char c) { return c >= '0' and c <= '9'; };
+            const auto dot = str.find('.');
+            const auto integer_end =
+                dot == std::string::npos ? str.size() : dot;
+            if (integer_end == 0 or integer_end + 1 == str.size()
+                or not std::all_of(
+                       str.begin(), str.begin() + integer_end, is_digit)
+                or not std::all_of(
+                       str.begin() + std::min(integer_end + 1, str.size()),
+                       str.end(),
+                       is_digit)) {
+              return std::numeric_limits<
+                  boost::multiprecision::uint256_t>::min();
+            }
+            if (dot != std::string::npos) {
+              this->precision_ = str.size() - dot - 1;
+            }
+
+            // digits are accumulated in 64-bit chunks, so that amounts of
+            // usual size take a single multiprecision operation
+            constexpr uint64_t kChunkScale = 10000000000000000000ull;
+            boost::multiprecision::uint256_t value = 0;
+            uint64_t chunk = 0;
+            uint64_t scale = 1;
+            for (auto c : str) {
+              if (c == '.') {
+                continue;
+              }
+              chunk = chunk * 10 + static_cast<uint64_t>(c - '0');
+              scale *= 10;
+              if (scale == kChunkScale) {
+                value = value * scale + chunk;
+                chunk = 0;
+                scale = 1;
               }
-              // remove leading zeroes
-              str.erase(0,
-                        std::min(str.find_first_not_of('0'), str.size() - 1));
-              return boost::multiprecision::uint256_t(str);
             }
-            return std::numeric_limits<boost::multiprecision::uint256_t>::min();
+            return boost::multiprecision::uint256_t(value * scale + chunk);
           }()) {}
 
-    Amount::Amount(const Amount &o) : Amount(std::string(o.amount_)) {}
+    Amount::Amount(const Amount &o)
+        : amount_(o.amount_),
+          precision_(o.precision_),
+          multiprecision_repr_(o.multiprecision_repr_) {}
 
     Amount::Amount(Amount &&o) noexcept
-        : Amount(std::move(const_cast<std::string &>(o.amount_))) {}
+        : amount_(std::move(const_cast<std::string &>(o.amount_))),
+          precision_(o.precision_),
+          multiprecision_repr_(o.multiprecision_repr_) {}
 
     const boost::multiprecision::uint256_t &Amount::intValue() const {
       return multiprecision_repr_;
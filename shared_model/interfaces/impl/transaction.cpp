@@ -5,6 +5,7 @@
 
 #include "interfaces/transaction.hpp"
 
+#include <boost/range/size.hpp>
 #include "interfaces/commands/command.hpp"
 #include "interfaces/iroha_internal/batch_meta.hpp"
 #include "utils/string_builder.hpp"
@@ -12,6 +13,10 @@
 namespace shared_model {
   namespace interface {
 
+    size_t Transaction::signaturesCount() const {
+      return boost::size(signatures());
+    }
+
     std::string Transaction::toString() const {
       return detail::PrettyStringBuilder()
           .init("Transaction")
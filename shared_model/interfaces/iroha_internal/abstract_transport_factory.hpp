@@ -26,6 +26,14 @@ namespace shared_model {
       virtual iroha::expected::Result<std::unique_ptr<Interface>, Error> build(
           Transport transport) const = 0;
 
+      /**
+       * Builds the object from its serialized transport form, reusing the
+       * received bytes where the object is hashed or signed over them
+       * @param bytes - serialized transport object
+       */
+      virtual iroha::expected::Result<std::unique_ptr<Interface>, Error> build(
+          const types::BlobType &bytes) const = 0;
+
       virtual ~AbstractTransportFactory() = default;
     };
 
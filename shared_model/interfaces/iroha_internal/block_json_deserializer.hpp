@@ -28,6 +28,18 @@ namespace shared_model {
       virtual iroha::expected::Result<std::unique_ptr<Block>, std::string>
       deserialize(const types::JsonType &json) const = 0;
 
+      /**
+       * Try to parse json held in a memory range into a block object. Allows
+       * parsing memory-mapped storage without copying it into a string
+       * @param data - pointer to the first character of json
+       * @param size - length of json
+       * @return pointer to a block if json was valid or an error
+       */
+      virtual iroha::expected::Result<std::unique_ptr<Block>, std::string>
+      deserialize(const char *data, size_t size) const {
+        return deserialize(types::JsonType(data, size));
+      }
+
       virtual ~BlockJsonDeserializer() = default;
     };
   }  // namespace interface
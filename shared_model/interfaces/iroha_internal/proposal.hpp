@@ -9,6 +9,7 @@
 #include "cryptography/default_hash_provider.hpp"
 #include "interfaces/base/model_primitive.hpp"
 #include "interfaces/common_objects/types.hpp"
+#include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
 #include "interfaces/transaction.hpp"
 
 namespace shared_model {
@@ -21,6 +22,13 @@ namespace shared_model {
        */
       virtual types::TransactionsCollectionType transactions() const = 0;
 
+      /**
+       * @return transactions split into batches
+       */
+      virtual std::vector<types::TransactionsCollectionType> batches() const {
+        return TransactionBatchParserImpl().parseBatches(transactions());
+      }
+
       /**
        * @return the height
        */
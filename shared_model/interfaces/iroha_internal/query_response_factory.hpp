@@ -58,6 +58,27 @@ namespace shared_model {
               next_asset_id,
           const crypto::Hash &query_hash) const = 0;
 
+      /**
+       * Create response for account asset query with balances as they are
+       * stored, so that they are written to the response without being
+       * parsed into amounts and printed back
+       * @param assets - account ids, asset ids and balances of the assets
+       * @param total_assets_number the number of all assets as opposed to the
+       * page size
+       * @param next_asset_id if there are more assets ofter the provided ones,
+       * this specifies the id of the first following asset; otherwise none
+       * @param query_hash - hash of the query, for which response is created
+       * @return account asset response
+       */
+      virtual std::unique_ptr<QueryResponse> createAccountAssetResponse(
+          std::vector<std::tuple<types::AccountIdType,
+                                 types::AssetIdType,
+                                 std::string>> assets,
+          size_t total_assets_number,
+          boost::optional<shared_model::interface::types::AssetIdType>
+              next_asset_id,
+          const crypto::Hash &query_hash) const = 0;
+
       /**
        * Create response for account detail query
        * @param account_detail to be inserted into the response
@@ -102,6 +123,17 @@ namespace shared_model {
           std::unique_ptr<Block> block,
           const crypto::Hash &query_hash) const = 0;
 
+      /**
+       * Create response for get block query with a block which is not parsed.
+       * The block is only sent to the client, block() of the response is empty
+       * @param serialized_block - binary serialized iroha.protocol.Block
+       * @param query_hash - hash of the query, for which response is created
+       * @return block response
+       */
+      virtual std::unique_ptr<QueryResponse> createSerializedBlockResponse(
+          std::string serialized_block,
+          const crypto::Hash &query_hash) const = 0;
+
       /**
        * Describes type of error to be placed inside the error query response
        */
@@ -6,7 +6,7 @@
 #ifndef IROHA_TRANSACTION_BATCH_HELPERS_HPP
 #define IROHA_TRANSACTION_BATCH_HELPERS_HPP
 
-#include <sstream>
+#include <utility>
 
 #include "cryptography/hash.hpp"
 
@@ -28,11 +28,15 @@ namespace shared_model {
       template <typename Collection>
       static types::HashType calculateReducedBatchHash(
           const Collection &reduced_hashes) {
-        std::stringstream concatenated_hash;
+        // bytes are concatenated directly, a hex round trip would allocate
+        // for every hash
+        crypto::Blob::Bytes concatenated_hash;
         for (const auto &hash : reduced_hashes) {
-          concatenated_hash << hash.hex();
+          const auto &bytes = hash.blob();
+          concatenated_hash.insert(
+              concatenated_hash.end(), bytes.begin(), bytes.end());
         }
-        return types::HashType::fromHexString(concatenated_hash.str());
+        return types::HashType(crypto::Blob(std::move(concatenated_hash)));
       }
     };
   }  // namespace interface
@@ -26,6 +26,12 @@ namespace shared_model {
           }));
     }
 
+    TransactionBatchImpl::TransactionBatchImpl(
+        types::SharedTxsCollectionType transactions,
+        types::HashType reduced_hash)
+        : transactions_(std::move(transactions)),
+          reduced_hash_(std::move(reduced_hash)) {}
+
     const types::SharedTxsCollectionType &TransactionBatchImpl::transactions()
         const {
       return transactions_;
@@ -86,7 +92,7 @@ namespace shared_model {
                             acc.push_back(::clone(*tx));
                             return acc;
                           });
-      return new TransactionBatchImpl(std::move(copy_txs));
+      return new TransactionBatchImpl(std::move(copy_txs), reduced_hash_);
     }
 
   }  // namespace interface
@@ -38,6 +38,10 @@ namespace shared_model {
       TransactionBatch *clone() const override;
 
      private:
+      /// used by clone, the reduced hash of the copied transactions is known
+      TransactionBatchImpl(types::SharedTxsCollectionType transactions,
+                           types::HashType reduced_hash);
+
       types::SharedTxsCollectionType transactions_;
 
       types::HashType reduced_hash_;
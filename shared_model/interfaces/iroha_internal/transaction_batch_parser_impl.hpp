@@ -8,6 +8,11 @@
 
 #include "interfaces/iroha_internal/transaction_batch_parser.hpp"
 
+#include <memory>
+
+#include "interfaces/iroha_internal/batch_meta.hpp"
+#include "interfaces/transaction.hpp"
+
 namespace shared_model {
   namespace interface {
 
@@ -21,7 +26,44 @@ namespace shared_model {
 
       std::vector<types::SharedTxsCollectionType> parseBatches(
           const types::SharedTxsCollectionType &txs) const noexcept override;
+
+      /**
+       * Splits transactions into batches in a single pass without allocations
+       * @param begin, end - transactions or pointers to them
+       * @param visitor - called with the iterators delimiting every batch
+       */
+      template <typename Iterator, typename Visitor>
+      static void forEachBatch(Iterator begin, Iterator end, Visitor &&visitor);
+
+     private:
+      static const Transaction &transaction(const Transaction &tx) {
+        return tx;
+      }
+
+      static const Transaction &transaction(
+          const std::shared_ptr<Transaction> &tx) {
+        return *tx;
+      }
     };
+
+    template <typename Iterator, typename Visitor>
+    void TransactionBatchParserImpl::forEachBatch(Iterator begin,
+                                                  Iterator end,
+                                                  Visitor &&visitor) {
+      while (begin != end) {
+        const auto beginning_tx_meta_opt = transaction(*begin).batchMeta();
+        auto next = std::next(begin);
+        for (; next != end; ++next) {
+          const auto current_tx_meta_opt = transaction(*next).batchMeta();
+          if (not(current_tx_meta_opt and beginning_tx_meta_opt)
+              or (**current_tx_meta_opt != **beginning_tx_meta_opt)) {
+            break;
+          }
+        }
+        visitor(begin, next);
+        begin = next;
+      }
+    }
   }  // namespace interface
 }  // namespace shared_model
 
@@ -6,6 +6,10 @@
 #ifndef IROHA_SHARED_MODEL_BLOCKS_QUERY_HPP
 #define IROHA_SHARED_MODEL_BLOCKS_QUERY_HPP
 
+#include <string>
+#include <vector>
+
+#include <boost/optional.hpp>
 #include "interfaces/base/signable.hpp"
 #include "interfaces/common_objects/types.hpp"
 
@@ -31,6 +35,34 @@ namespace shared_model {
        */
       virtual types::CounterType queryCounter() const = 0;
 
+      /**
+       * @return height of the first block to stream, if committed blocks are
+       * requested before the new ones
+       */
+      virtual boost::optional<types::HeightType> startHeight() const = 0;
+
+      /// transactions to stream, a transaction matches if it matches every
+      /// non-empty list
+      struct Filter {
+        /// creators of transactions, or accounts transferring assets
+        std::vector<types::AccountIdType> account_ids;
+        /// assets added, subtracted or transferred by transactions
+        std::vector<types::AssetIdType> asset_ids;
+        /// names of Command fields of commands of transactions
+        std::vector<std::string> command_types;
+
+        bool operator==(const Filter &rhs) const {
+          return account_ids == rhs.account_ids and asset_ids == rhs.asset_ids
+              and command_types == rhs.command_types;
+        }
+      };
+
+      /**
+       * @return filter of streamed transactions, none if all of them are
+       * streamed
+       */
+      virtual const boost::optional<Filter> &filter() const = 0;
+
       // ------------------------| Primitive override |-------------------------
 
       std::string toString() const override;
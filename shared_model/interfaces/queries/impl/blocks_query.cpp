@@ -10,18 +10,30 @@ namespace shared_model {
   namespace interface {
 
     std::string BlocksQuery::toString() const {
-      return detail::PrettyStringBuilder()
-          .init("BlocksQuery")
-          .append("creatorId", creatorAccountId())
-          .append("queryCounter", std::to_string(queryCounter()))
-          .append(Signable::toString())
-          .finalize();
+      auto pretty_builder =
+          detail::PrettyStringBuilder()
+              .init("BlocksQuery")
+              .append("creatorId", creatorAccountId())
+              .append("queryCounter", std::to_string(queryCounter()));
+      if (auto start_height = startHeight()) {
+        pretty_builder.append("startHeight", std::to_string(*start_height));
+      }
+      if (const auto &blocks_filter = filter()) {
+        auto identity = [](const auto &value) { return value; };
+        pretty_builder
+            .appendAll("accountIds", blocks_filter->account_ids, identity)
+            .appendAll("assetIds", blocks_filter->asset_ids, identity)
+            .appendAll("commandTypes", blocks_filter->command_types, identity);
+      }
+      return pretty_builder.append(Signable::toString()).finalize();
     }
 
     bool BlocksQuery::operator==(const ModelType &rhs) const {
       return creatorAccountId() == rhs.creatorAccountId()
           and queryCounter() == rhs.queryCounter()
           and createdTime() == rhs.createdTime()
+          and startHeight() == rhs.startHeight()
+          and filter() == rhs.filter()
           and signatures() == rhs.signatures();
     }
 
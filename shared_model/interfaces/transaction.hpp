@@ -57,6 +57,12 @@ namespace shared_model {
        */
       virtual boost::optional<std::shared_ptr<BatchMeta>> batchMeta() const = 0;
 
+      /**
+       * @return number of attached signatures, without iterating them when
+       * the implementation keeps it
+       */
+      virtual size_t signaturesCount() const;
+
       std::string toString() const override;
     };
 
@@ -0,0 +1,55 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_MEMOIZED_HPP
+#define IROHA_MEMOIZED_HPP
+
+#include <memory>
+#include <mutex>
+
+#include <boost/optional.hpp>
+
+namespace shared_model {
+  namespace detail {
+    /**
+     * Value computed on the first access and reused afterwards. Concurrent
+     * first accesses are safe, the value is computed exactly once
+     * @tparam T type of stored value
+     */
+    template <typename T>
+    class Memoized {
+     public:
+      Memoized() : flag_(std::make_unique<std::once_flag>()) {}
+
+      /// create with a value computed in advance
+      explicit Memoized(T value) : Memoized() {
+        std::call_once(*flag_, [&] { value_ = std::move(value); });
+      }
+
+      /**
+       * @param compute - function producing the value, called only if the
+       * value has not been computed yet
+       * @return stored value
+       */
+      template <typename F>
+      const T &get(F &&compute) const {
+        std::call_once(*flag_, [&] { value_ = std::forward<F>(compute)(); });
+        return *value_;
+      }
+
+      /// forget the value, must not be called concurrently with get
+      void reset() {
+        flag_ = std::make_unique<std::once_flag>();
+        value_ = boost::none;
+      }
+
+     private:
+      std::unique_ptr<std::once_flag> flag_;
+      mutable boost::optional<T> value_;
+    };
+  }  // namespace detail
+}  // namespace shared_model
+
+#endif  // IROHA_MEMOIZED_HPP
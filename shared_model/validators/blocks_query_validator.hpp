@@ -39,6 +39,9 @@ namespace shared_model {
                                                   qry.creatorAccountId());
         field_validator_.validateCreatedTime(qry_reason, qry.createdTime());
         field_validator_.validateCounter(qry_reason, qry.queryCounter());
+        if (auto start_height = qry.startHeight()) {
+          field_validator_.validateHeight(qry_reason, *start_height);
+        }
 
         if (not qry_reason.second.empty()) {
           answer.addReason(std::move(qry_reason));
@@ -5,9 +5,11 @@
 
 #include "validators/field_validator.hpp"
 
+#include <algorithm>
 #include <limits>
 
-#include <boost/algorithm/string_regex.hpp>
+#include <boost/utility/string_ref.hpp>
+
 #include <boost/format.hpp>
 #include "common/bind.hpp"
 #include "cryptography/crypto_provider/crypto_defaults.hpp"
@@ -24,6 +26,113 @@
 
 using iroha::operator|;
 
+namespace {
+  // Hand-written equivalents of the field patterns, std::regex is too slow to
+  // run several times for every transaction. Patterns are kept for messages.
+
+  constexpr bool isDigit(char c) {
+    return c >= '0' and c <= '9';
+  }
+
+  constexpr bool isAlpha(char c) {
+    return (c >= 'a' and c <= 'z') or (c >= 'A' and c <= 'Z');
+  }
+
+  constexpr bool isAlnum(char c) {
+    return isAlpha(c) or isDigit(c);
+  }
+
+  /// [a-z_0-9]
+  constexpr bool isNameChar(char c) {
+    return (c >= 'a' and c <= 'z') or isDigit(c) or c == '_';
+  }
+
+  /// [A-Za-z0-9_]
+  constexpr bool isDetailKeyChar(char c) {
+    return isAlnum(c) or c == '_';
+  }
+
+  template <typename Predicate>
+  bool matchAll(boost::string_ref s,
+                size_t min_size,
+                size_t max_size,
+                Predicate predicate) {
+    return s.size() >= min_size and s.size() <= max_size
+        and std::all_of(s.begin(), s.end(), predicate);
+  }
+
+  /// [a-z_0-9]{1,32}
+  bool matchName(boost::string_ref s) {
+    return matchAll(s, 1, 32, isNameChar);
+  }
+
+  /// [a-zA-Z]([a-zA-Z0-9\-]{0,61}[a-zA-Z0-9])?
+  bool matchDomainLabel(boost::string_ref s) {
+    return not s.empty() and s.size() <= 63 and isAlpha(s.front())
+        and isAlnum(s.back()) and std::all_of(s.begin(), s.end(), [](char c) {
+             return isAlnum(c) or c == '-';
+           });
+  }
+
+  /// labels separated by dots
+  bool matchDomain(boost::string_ref s) {
+    while (true) {
+      auto dot = s.find('.');
+      if (not matchDomainLabel(s.substr(0, dot))) {
+        return false;
+      }
+      if (dot == boost::string_ref::npos) {
+        return true;
+      }
+      s.remove_prefix(dot + 1);
+    }
+  }
+
+  /// decimal number in [0, max_value] without leading zeros
+  bool matchNumber(boost::string_ref s, size_t max_digits, unsigned max_value) {
+    if (s.empty() or s.size() > max_digits or (s.size() > 1 and s[0] == '0')
+        or not std::all_of(s.begin(), s.end(), isDigit)) {
+      return false;
+    }
+    unsigned value = 0;
+    for (auto c : s) {
+      value = value * 10 + (c - '0');
+    }
+    return value <= max_value;
+  }
+
+  /// four decimal octets separated by dots
+  bool matchIpV4(boost::string_ref s) {
+    for (int i = 0; i < 3; ++i) {
+      auto dot = s.find('.');
+      if (dot == boost::string_ref::npos
+          or not matchNumber(s.substr(0, dot), 3, 255)) {
+        return false;
+      }
+      s.remove_prefix(dot + 1);
+    }
+    return matchNumber(s, 3, 255);
+  }
+
+  /// name, separator and domain, neither of which contains the separator
+  bool matchNameAtDomain(boost::string_ref s, char separator) {
+    auto pos = s.find(separator);
+    return pos != boost::string_ref::npos and matchName(s.substr(0, pos))
+        and matchDomain(s.substr(pos + 1));
+  }
+
+  /// host, which is IPv4 address or domain, and port separated by a colon
+  bool matchPeerAddress(boost::string_ref s) {
+    auto pos = s.find(':');
+    if (pos == boost::string_ref::npos) {
+      return false;
+    }
+    auto host = s.substr(0, pos);
+    return (matchIpV4(host) or matchDomain(host))
+        and matchNumber(s.substr(pos + 1), 5, 65535);
+  }
+}  // namespace
+
 namespace shared_model {
   namespace validation {
 
@@ -57,16 +166,6 @@ namespace shared_model {
     const size_t FieldValidator::value_size = 4 * 1024 * 1024;
     const size_t FieldValidator::description_size = 64;
 
-    const std::regex FieldValidator::account_name_regex_(account_name_pattern_);
-    const std::regex FieldValidator::asset_name_regex_(asset_name_pattern_);
-    const std::regex FieldValidator::domain_regex_(domain_pattern_);
-    const std::regex FieldValidator::ip_v4_regex_(ip_v4_pattern_);
-    const std::regex FieldValidator::peer_address_regex_(peer_address_pattern_);
-    const std::regex FieldValidator::account_id_regex_(account_id_pattern_);
-    const std::regex FieldValidator::asset_id_regex_(asset_id_pattern_);
-    const std::regex FieldValidator::detail_key_regex_(detail_key_pattern_);
-    const std::regex FieldValidator::role_id_regex_(role_id_pattern_);
-
     FieldValidator::FieldValidator(std::shared_ptr<ValidatorsConfig> config,
                                    time_t future_gap,
                                    TimeFunction time_provider)
@@ -75,7 +174,7 @@ namespace shared_model {
     void FieldValidator::validateAccountId(
         ReasonsGroupType &reason,
         const interface::types::AccountIdType &account_id) const {
-      if (not std::regex_match(account_id, account_id_regex_)) {
+      if (not matchNameAtDomain(account_id, '@')) {
         auto message =
             (boost::format("Wrongly formed account_id, passed value: '%s'. "
                            "Field should match regex '%s'")
@@ -88,7 +187,7 @@ namespace shared_model {
     void FieldValidator::validateAssetId(
         ReasonsGroupType &reason,
         const interface::types::AssetIdType &asset_id) const {
-      if (not std::regex_match(asset_id, asset_id_regex_)) {
+      if (not matchNameAtDomain(asset_id, '#')) {
         auto message = (boost::format("Wrongly formed asset_id, passed value: "
                                       "'%s'. Field should match regex '%s'")
                         % asset_id % asset_id_pattern_)
@@ -126,7 +225,7 @@ namespace shared_model {
     void FieldValidator::validatePeerAddress(
         ReasonsGroupType &reason,
         const interface::types::AddressType &address) const {
-      if (not std::regex_match(address, peer_address_regex_)) {
+      if (not matchPeerAddress(address)) {
         auto message =
             (boost::format("Wrongly formed peer address, passed value: '%s'. "
                            "Field should have a valid 'host:port' format where "
@@ -141,7 +240,7 @@ namespace shared_model {
     void FieldValidator::validateRoleId(
         ReasonsGroupType &reason,
         const interface::types::RoleIdType &role_id) const {
-      if (not std::regex_match(role_id, role_id_regex_)) {
+      if (not matchName(role_id)) {
         auto message = (boost::format("Wrongly formed role_id, passed value: "
                                       "'%s'. Field should match regex '%s'")
                         % role_id % role_id_pattern_)
@@ -153,7 +252,7 @@ namespace shared_model {
     void FieldValidator::validateAccountName(
         ReasonsGroupType &reason,
         const interface::types::AccountNameType &account_name) const {
-      if (not std::regex_match(account_name, account_name_regex_)) {
+      if (not matchName(account_name)) {
         auto message =
             (boost::format("Wrongly formed account_name, passed value: '%s'. "
                            "Field should match regex '%s'")
@@ -166,7 +265,7 @@ namespace shared_model {
     void FieldValidator::validateDomainId(
         ReasonsGroupType &reason,
         const interface::types::DomainIdType &domain_id) const {
-      if (not std::regex_match(domain_id, domain_regex_)) {
+      if (not matchDomain(domain_id)) {
         auto message = (boost::format("Wrongly formed domain_id, passed value: "
                                       "'%s'. Field should match regex '%s'")
                         % domain_id % domain_pattern_)
@@ -178,7 +277,7 @@ namespace shared_model {
     void FieldValidator::validateAssetName(
         ReasonsGroupType &reason,
         const interface::types::AssetNameType &asset_name) const {
-      if (not std::regex_match(asset_name, asset_name_regex_)) {
+      if (not matchName(asset_name)) {
         auto message =
             (boost::format("Wrongly formed asset_name, passed value: '%s'. "
                            "Field should match regex '%s'")
@@ -191,7 +290,7 @@ namespace shared_model {
     void FieldValidator::validateAccountDetailKey(
         ReasonsGroupType &reason,
         const interface::types::AccountDetailKeyType &key) const {
-      if (not std::regex_match(key, detail_key_regex_)) {
+      if (not matchAll(key, 1, 64, isDetailKeyChar)) {
         auto message = (boost::format("Wrongly formed key, passed value: '%s'. "
                                       "Field should match regex '%s'")
                         % key % detail_key_pattern_)
@@ -268,7 +367,7 @@ namespace shared_model {
     void FieldValidator::validateCreatorAccountId(
         ReasonsGroupType &reason,
         const interface::types::AccountIdType &account_id) const {
-      if (not std::regex_match(account_id, account_id_regex_)) {
+      if (not matchNameAtDomain(account_id, '@')) {
         auto message =
             (boost::format("Wrongly formed creator_account_id, passed value: "
                            "'%s'. Field should match regex '%s'")
@@ -323,6 +422,7 @@ namespace shared_model {
       if (boost::empty(signatures)) {
         reason.second.emplace_back("Signatures cannot be empty");
       }
+      std::vector<crypto::VerificationEntry> entries;
       for (const auto &signature : signatures) {
         const auto &sign = signature.signedData();
         const auto &pkey = signature.publicKey();
@@ -340,11 +440,21 @@ namespace shared_model {
           is_valid = false;
         }
 
-        if (is_valid
-            && not shared_model::crypto::CryptoVerifier<>::verify(
-                   sign, source, pkey)) {
+        if (is_valid) {
+          entries.push_back({sign, source, pkey});
+        }
+      }
+
+      if (shared_model::crypto::CryptoVerifier<>::verifyBatch(entries)) {
+        return;
+      }
+      // find out which signatures are wrong
+      for (const auto &entry : entries) {
+        if (not shared_model::crypto::CryptoVerifier<>::verify(
+                entry.signed_data, entry.source, entry.public_key)) {
           reason.second.push_back((boost::format("Wrong signature [%s;%s]")
-                                   % sign.hex() % pkey.hex())
+                                   % entry.signed_data.hex()
+                                   % entry.public_key.hex())
                                       .str());
         }
       }
@@ -4,12 +4,19 @@
  */
 #include "validators/protobuf/proto_proposal_validator.hpp"
 
+#include <vector>
+
+#include "common/thread_pool.hpp"
+#include "validators/validators_common.hpp"
+
 namespace shared_model {
   namespace validation {
 
     ProtoProposalValidator::ProtoProposalValidator(
-        ProtoValidatorType transaction_validator)
-        : transaction_validator_(std::move(transaction_validator)) {}
+        ProtoValidatorType transaction_validator,
+        std::shared_ptr<iroha::ThreadPool> validation_pool)
+        : transaction_validator_(std::move(transaction_validator)),
+          validation_pool_(std::move(validation_pool)) {}
 
     Answer ProtoProposalValidator::validate(
         const iroha::protocol::Proposal &proposal) const {
@@ -17,9 +24,26 @@ namespace shared_model {
       std::string tx_reason_name = "Protobuf Proposal";
       ReasonsGroupType reason{tx_reason_name, GroupedReasons()};
 
-      for (const auto &tx : proposal.transactions()) {
-        if (auto tx_answer = transaction_validator_->validate(tx)) {
-          reason.second.emplace_back(tx_answer.reason());
+      const auto &transactions = proposal.transactions();
+      if (validation_pool_
+          and static_cast<size_t>(transactions.size())
+              >= kParallelValidationSize) {
+        // answers are kept by positions, so that reasons keep the order of
+        // the transactions whichever threads validate them
+        std::vector<Answer> answers(transactions.size());
+        validation_pool_->parallelFor(answers.size(), [&](size_t i) {
+          answers[i] = transaction_validator_->validate(transactions.Get(i));
+        });
+        for (const auto &tx_answer : answers) {
+          if (tx_answer) {
+            reason.second.emplace_back(tx_answer.reason());
+          }
+        }
+      } else {
+        for (const auto &tx : transactions) {
+          if (auto tx_answer = transaction_validator_->validate(tx)) {
+            reason.second.emplace_back(tx_answer.reason());
+          }
         }
       }
 
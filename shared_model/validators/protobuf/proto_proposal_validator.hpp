@@ -8,6 +8,10 @@
 #include "proposal.pb.h"
 #include "validators/abstract_validator.hpp"
 
+namespace iroha {
+  class ThreadPool;
+}
+
 namespace shared_model {
   namespace validation {
     class ProtoProposalValidator
@@ -17,12 +21,20 @@ namespace shared_model {
           std::shared_ptr<shared_model::validation::AbstractValidator<
               typename iroha::protocol::Transaction>>;
 
-      ProtoProposalValidator(ProtoValidatorType transaction_validator);
+      /**
+       * @param transaction_validator - validator of transactions
+       * @param validation_pool - threads validating transactions of large
+       * proposals, validation is sequential if not set
+       */
+      ProtoProposalValidator(
+          ProtoValidatorType transaction_validator,
+          std::shared_ptr<iroha::ThreadPool> validation_pool = nullptr);
 
       Answer validate(const iroha::protocol::Proposal &proposal) const override;
 
      private:
       ProtoValidatorType transaction_validator_;
+      std::shared_ptr<iroha::ThreadPool> validation_pool_;
     };
   }  // namespace validation
 }  // namespace shared_model
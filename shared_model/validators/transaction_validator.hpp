@@ -9,6 +9,8 @@
 #include <boost/format.hpp>
 #include <boost/variant.hpp>
 
+#include "cache/sharded_cache.hpp"
+#include "cryptography/blob.hpp"
 #include "interfaces/commands/add_asset_quantity.hpp"
 #include "interfaces/commands/add_peer.hpp"
 #include "interfaces/commands/add_signatory.hpp"
@@ -55,10 +57,26 @@ namespace shared_model {
       CommandValidatorVisitor(std::shared_ptr<ValidatorsConfig> config)
           : CommandValidatorVisitor(FieldValidator{std::move(config)}) {}
 
+      /**
+       * Validate the next command of a transaction
+       * @param command - command to validate
+       * @return reason named by the position and the type of the command if
+       * it is invalid, empty reason otherwise
+       */
+      ReasonsGroupType validate(const interface::Command &command) const {
+        auto reason = boost::apply_visitor(*this, command.get());
+        if (not reason.second.empty()) {
+          reason.first =
+              (boost::format("%d %s") % (command_counter - 1) % command_name_)
+                  .str();
+        }
+        return reason;
+      }
+
       ReasonsGroupType operator()(
           const interface::AddAssetQuantity &aaq) const {
         ReasonsGroupType reason;
-        addInvalidCommand(reason, "AddAssetQuantity");
+        addInvalidCommand("AddAssetQuantity");
 
         validator_.validateAssetId(reason, aaq.assetId());
         validator_.validateAmount(reason, aaq.amount());
@@ -68,7 +86,7 @@ namespace shared_model {
 
       ReasonsGroupType operator()(const interface::AddPeer &ap) const {
         ReasonsGroupType reason;
-        addInvalidCommand(reason, "AddPeer");
+        addInvalidCommand("AddPeer");
 
         validator_.validatePeer(reason, ap.peer());
 
@@ -77,7 +95,7 @@ namespace shared_model {
 
       ReasonsGroupType operator()(const interface::AddSignatory &as) const {
         ReasonsGroupType reason;
-        addInvalidCommand(reason, "AddSignatory");
+        addInvalidCommand("AddSignatory");
 
         validator_.validateAccountId(reason, as.accountId());
         validator_.validatePubkey(reason, as.pubkey());
@@ -87,7 +105,7 @@ namespace shared_model {
 
       ReasonsGroupType operator()(const interface::AppendRole &ar) const {
         ReasonsGroupType reason;
-        addInvalidCommand(reason, "AppendRole");
+        addInvalidCommand("AppendRole");
 
         validator_.validateAccountId(reason, ar.accountId());
         validator_.validateRoleId(reason, ar.roleName());
@@ -97,7 +115,7 @@ namespace shared_model {
 
       ReasonsGroupType operator()(const interface::CreateAccount &ca) const {
         ReasonsGroupType reason;
-        addInvalidCommand(reason, "CreateAccount");
+        addInvalidCommand("CreateAccount");
 
         validator_.validatePubkey(reason, ca.pubkey());
         validator_.validateAccountName(reason, ca.accountName());
@@ -108,7 +126,7 @@ namespace shared_model {
 
       ReasonsGroupType operator()(const interface::CreateAsset &ca) const {
         ReasonsGroupType reason;
-        addInvalidCommand(reason, "CreateAsset");
+        addInvalidCommand("CreateAsset");
 
         validator_.validateAssetName(reason, ca.assetName());
         validator_.validateDomainId(reason, ca.domainId());
@@ -119,7 +137,7 @@ namespace shared_model {
 
       ReasonsGroupType operator()(const interface::CreateDomain &cd) const {
         ReasonsGroupType reason;
-        addInvalidCommand(reason, "CreateDomain");
+        addInvalidCommand("CreateDomain");
 
         validator_.validateDomainId(reason, cd.domainId());
         validator_.validateRoleId(reason, cd.userDefaultRole());
@@ -129,7 +147,7 @@ namespace shared_model {
 
       ReasonsGroupType operator()(const interface::CreateRole &cr) const {
         ReasonsGroupType reason;
-        addInvalidCommand(reason, "CreateRole");
+        addInvalidCommand("CreateRole");
 
         validator_.validateRoleId(reason, cr.roleName());
         cr.rolePermissions().iterate([&reason, this](auto i) {
@@ -141,7 +159,7 @@ namespace shared_model {
 
       ReasonsGroupType operator()(const interface::DetachRole &dr) const {
         ReasonsGroupType reason;
-        addInvalidCommand(reason, "DetachRole");
+        addInvalidCommand("DetachRole");
 
         validator_.validateAccountId(reason, dr.accountId());
         validator_.validateRoleId(reason, dr.roleName());
@@ -151,7 +169,7 @@ namespace shared_model {
 
       ReasonsGroupType operator()(const interface::GrantPermission &gp) const {
         ReasonsGroupType reason;
-        addInvalidCommand(reason, "GrantPermission");
+        addInvalidCommand("GrantPermission");
 
         validator_.validateAccountId(reason, gp.accountId());
         validator_.validateGrantablePermission(reason, gp.permissionName());
@@ -161,7 +179,7 @@ namespace shared_model {
 
       ReasonsGroupType operator()(const interface::RemovePeer &rp) const {
         ReasonsGroupType reason;
-        addInvalidCommand(reason, "RemovePeer");
+        addInvalidCommand("RemovePeer");
 
         validator_.validatePubkey(reason, rp.pubkey());
 
@@ -170,7 +188,7 @@ namespace shared_model {
 
       ReasonsGroupType operator()(const interface::RemoveSignatory &rs) const {
         ReasonsGroupType reason;
-        addInvalidCommand(reason, "RemoveSignatory");
+        addInvalidCommand("RemoveSignatory");
 
         validator_.validateAccountId(reason, rs.accountId());
         validator_.validatePubkey(reason, rs.pubkey());
@@ -179,7 +197,7 @@ namespace shared_model {
       }
       ReasonsGroupType operator()(const interface::RevokePermission &rp) const {
         ReasonsGroupType reason;
-        addInvalidCommand(reason, "RevokePermission");
+        addInvalidCommand("RevokePermission");
 
         validator_.validateAccountId(reason, rp.accountId());
         validator_.validateGrantablePermission(reason, rp.permissionName());
@@ -190,7 +208,7 @@ namespace shared_model {
       ReasonsGroupType operator()(
           const interface::SetAccountDetail &sad) const {
         ReasonsGroupType reason;
-        addInvalidCommand(reason, "SetAccountDetail");
+        addInvalidCommand("SetAccountDetail");
 
         validator_.validateAccountId(reason, sad.accountId());
         validator_.validateAccountDetailKey(reason, sad.key());
@@ -201,7 +219,7 @@ namespace shared_model {
 
       ReasonsGroupType operator()(const interface::SetQuorum &sq) const {
         ReasonsGroupType reason;
-        addInvalidCommand(reason, "SetQuorum");
+        addInvalidCommand("SetQuorum");
 
         validator_.validateAccountId(reason, sq.accountId());
         validator_.validateQuorum(reason, sq.newQuorum());
@@ -212,7 +230,7 @@ namespace shared_model {
       ReasonsGroupType operator()(
           const interface::SubtractAssetQuantity &saq) const {
         ReasonsGroupType reason;
-        addInvalidCommand(reason, "SubtractAssetQuantity");
+        addInvalidCommand("SubtractAssetQuantity");
 
         validator_.validateAssetId(reason, saq.assetId());
         validator_.validateAmount(reason, saq.amount());
@@ -222,7 +240,7 @@ namespace shared_model {
 
       ReasonsGroupType operator()(const interface::TransferAsset &ta) const {
         ReasonsGroupType reason;
-        addInvalidCommand(reason, "TransferAsset");
+        addInvalidCommand("TransferAsset");
 
         if (ta.srcAccountId() == ta.destAccountId()) {
           reason.second.emplace_back(
@@ -241,7 +259,7 @@ namespace shared_model {
       ReasonsGroupType operator()(
           const interface::CompareAndSetAccountDetail &casad) const {
         ReasonsGroupType reason;
-        addInvalidCommand(reason, "CompareAndSetAccountDetail");
+        addInvalidCommand("CompareAndSetAccountDetail");
 
         using iroha::operator|;
 
@@ -258,12 +276,12 @@ namespace shared_model {
      private:
       FieldValidator validator_;
       mutable int command_counter{0};
+      mutable const char *command_name_{nullptr};
 
-      // adds command to a reason, appends and increments counter
-      void addInvalidCommand(ReasonsGroupType &reason,
-                             const std::string &command_name) const {
-        reason.first =
-            (boost::format("%d %s") % command_counter % command_name).str();
+      // remembers the command being validated and increments counter, the
+      // reason is named only if the command is invalid
+      void addInvalidCommand(const char *command_name) const {
+        command_name_ = command_name;
         command_counter++;
       }
     };
@@ -277,6 +295,24 @@ namespace shared_model {
     class TransactionValidator
         : public AbstractValidator<interface::Transaction> {
      private:
+      /// maximum number of remembered valid transactions
+      static constexpr uint32_t kValidatedCacheSize = 65536;
+
+      /**
+       * Hashes of transactions which passed this validator. A transaction is
+       * validated by torii, ordering and block validation of the same node,
+       * so only its first validation checks the fields. The cache is per
+       * validator type, since the field validator defines the result.
+       * Transactions are validated by torii threads and the validation pool
+       * at once, so the cache is sharded, and every shard is locked for its
+       * lookups and insertions
+       */
+      static iroha::cache::ShardedCache<std::string, bool> &validatedCache() {
+        static iroha::cache::ShardedCache<std::string, bool> cache(
+            kValidatedCacheSize, kValidatedCacheSize * 3 / 4);
+        return cache;
+      }
+
       template <typename CreatedTimeValidator>
       Answer validateImpl(const interface::Transaction &tx,
                           CreatedTimeValidator &&validator) const {
@@ -284,6 +320,18 @@ namespace shared_model {
         std::string tx_reason_name = "Transaction";
         ReasonsGroupType tx_reason(tx_reason_name, GroupedReasons());
 
+        // the hash covers all validated fields, but created time is checked
+        // against the current time, which differs between validations
+        auto key = crypto::toBinaryString(tx.hash());
+        if (validatedCache().findItem(key)) {
+          std::forward<CreatedTimeValidator>(validator)(tx_reason,
+                                                        tx.createdTime());
+          if (not tx_reason.second.empty()) {
+            answer.addReason(std::move(tx_reason));
+          }
+          return answer;
+        }
+
         if (tx.commands().empty()) {
           tx_reason.second.push_back(
               "Transaction should contain at least one command");
@@ -301,14 +349,17 @@ namespace shared_model {
           answer.addReason(std::move(tx_reason));
         }
 
+        CommandValidator command_validator(validators_config_);
         for (const auto &command : tx.commands()) {
-          auto reason = boost::apply_visitor(
-              CommandValidator(validators_config_), command.get());
+          auto reason = command_validator.validate(command);
           if (not reason.second.empty()) {
             answer.addReason(std::move(reason));
           }
         }
 
+        if (not answer.hasErrors()) {
+          validatedCache().addItem(key, true);
+        }
         return answer;
       }
 
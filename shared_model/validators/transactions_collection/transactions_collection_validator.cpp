@@ -6,9 +6,12 @@
 #include "validators/transactions_collection/transactions_collection_validator.hpp"
 
 #include <algorithm>
+#include <vector>
 
 #include <boost/format.hpp>
 #include <boost/range/adaptor/indirected.hpp>
+#include <boost/range/distance.hpp>
+#include "common/thread_pool.hpp"
 #include "interfaces/common_objects/transaction_sequence_common.hpp"
 #include "interfaces/iroha_internal/transaction_batch_impl.hpp"
 #include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
@@ -28,7 +31,8 @@ namespace shared_model {
             std::shared_ptr<ValidatorsConfig> config,
             TransactionValidator transactions_validator)
         : transaction_validator_(std::move(transactions_validator)),
-          batch_validator_(std::make_shared<BatchValidator>(config)) {}
+          batch_validator_(std::make_shared<BatchValidator>(config)),
+          validation_pool_(config->validation_pool) {}
 
     template <typename TransactionValidator, bool CollectionCanBeEmpty>
     template <typename Validator>
@@ -51,13 +55,38 @@ namespace shared_model {
         return res;
       }
 
-      for (const auto &tx : transactions) {
-        auto answer = std::forward<Validator>(validator)(tx);
-        if (answer.hasErrors()) {
-          auto message =
-              (boost::format("Tx %s : %s") % tx.hash().hex() % answer.reason())
-                  .str();
-          reason.second.push_back(message);
+      auto add_reason = [&reason](const interface::Transaction &tx,
+                                  const Answer &answer) {
+        auto message =
+            (boost::format("Tx %s : %s") % tx.hash().hex() % answer.reason())
+                .str();
+        reason.second.push_back(message);
+      };
+
+      if (validation_pool_
+          and static_cast<size_t>(boost::distance(transactions))
+              >= kParallelValidationSize) {
+        // answers are kept by positions, so that reasons keep the order of
+        // the transactions whichever threads validate them
+        std::vector<const interface::Transaction *> txs;
+        for (const auto &tx : transactions) {
+          txs.push_back(&tx);
+        }
+        std::vector<Answer> answers(txs.size());
+        validation_pool_->parallelFor(txs.size(), [&](size_t i) {
+          answers[i] = validator(*txs[i]);
+        });
+        for (size_t i = 0; i < txs.size(); ++i) {
+          if (answers[i].hasErrors()) {
+            add_reason(*txs[i], answers[i]);
+          }
+        }
+      } else {
+        for (const auto &tx : transactions) {
+          auto answer = std::forward<Validator>(validator)(tx);
+          if (answer.hasErrors()) {
+            add_reason(tx, answer);
+          }
         }
       }
 
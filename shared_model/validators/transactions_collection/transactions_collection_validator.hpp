@@ -24,6 +24,7 @@ namespace shared_model {
       TransactionValidator transaction_validator_;
       std::shared_ptr<AbstractValidator<interface::TransactionBatch>>
           batch_validator_;
+      std::shared_ptr<iroha::ThreadPool> validation_pool_;
 
      private:
       template <typename Validator>
@@ -10,11 +10,13 @@
 namespace shared_model {
   namespace validation {
 
-    ValidatorsConfig::ValidatorsConfig(uint64_t max_batch_size,
-                                       bool partial_ordered_batches_are_valid)
+    ValidatorsConfig::ValidatorsConfig(
+        uint64_t max_batch_size,
+        bool partial_ordered_batches_are_valid,
+        std::shared_ptr<iroha::ThreadPool> validation_pool)
         : max_batch_size(max_batch_size),
-          partial_ordered_batches_are_valid(partial_ordered_batches_are_valid) {
-    }
+          partial_ordered_batches_are_valid(partial_ordered_batches_are_valid),
+          validation_pool(std::move(validation_pool)) {}
 
     bool validateHexString(const std::string &str) {
       static const std::regex hex_regex{R"([0-9a-fA-F]*)"};
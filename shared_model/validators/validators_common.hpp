@@ -6,8 +6,13 @@
 #ifndef IROHA_VALIDATORS_COMMON_HPP
 #define IROHA_VALIDATORS_COMMON_HPP
 
+#include <memory>
 #include <string>
 
+namespace iroha {
+  class ThreadPool;
+}
+
 namespace shared_model {
   namespace validation {
 
@@ -16,16 +21,26 @@ namespace shared_model {
      * A validator may read only specific fields.
      */
     struct ValidatorsConfig {
-      ValidatorsConfig(uint64_t max_batch_size,
-                       bool partial_ordered_batches_are_valid = false);
+      ValidatorsConfig(
+          uint64_t max_batch_size,
+          bool partial_ordered_batches_are_valid = false,
+          std::shared_ptr<iroha::ThreadPool> validation_pool = nullptr);
       /// Maximum allowed amount of transactions within a batch
       const uint64_t max_batch_size;
 
       /// Batch meta can contain more hashes of batch transactions than it
       /// actually has. Used for block validation
       const bool partial_ordered_batches_are_valid;
+
+      /// Threads validating transactions of large collections, such as
+      /// proposals and blocks, validation is sequential if not set
+      const std::shared_ptr<iroha::ThreadPool> validation_pool;
     };
 
+    /// Number of transactions starting from which a collection is validated
+    /// by the validation pool
+    constexpr size_t kParallelValidationSize = 256;
+
     /**
      * Check if given string has hex format
      * @param str string to check
@@ -0,0 +1,66 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+#include <soci/soci.h>
+#include "ametsuchi/impl/postgres_indexer.hpp"
+#include "cryptography/hash.hpp"
+#include "framework/test_db_manager.hpp"
+#include "framework/test_logger.hpp"
+
+using namespace iroha::ametsuchi;
+
+/**
+ * This benchmark indexes a block with the number of transactions given by the
+ * benchmark argument in order to measure block commit latency spent on
+ * indices. Every transaction is indexed like a transfer, so it has a hash
+ * position, a status, a creator position and three account asset positions.
+ */
+static void BM_IndexBlock(benchmark::State &state) {
+  auto db_manager =
+      iroha::integration_framework::TestDbManager::createWithRandomDbName(
+          1, getTestLoggerManager())
+          .match([](auto &&manager) { return std::move(manager.value); },
+                 [](const auto &error)
+                     -> std::unique_ptr<
+                         iroha::integration_framework::TestDbManager> {
+                   throw std::runtime_error(error.error);
+                 });
+  auto sql = db_manager->getSession();
+
+  const auto txs_number = static_cast<size_t>(state.range(0));
+  std::vector<shared_model::crypto::Hash> hashes;
+  for (size_t i = 0; i < txs_number; ++i) {
+    hashes.emplace_back("tx_hash_" + std::to_string(i));
+  }
+
+  shared_model::interface::types::HeightType height = 1;
+  while (state.KeepRunning()) {
+    *sql << "BEGIN";
+    PostgresIndexer indexer(*sql);
+    for (size_t i = 0; i < txs_number; ++i) {
+      const Indexer::TxPosition position{height, i};
+      indexer.txHashPosition(hashes[i], position);
+      indexer.committedTxHash(hashes[i]);
+      indexer.txPositionByCreator("creator@test", position);
+      for (const auto &account :
+           {"creator@test", "source@test", "destination@test"}) {
+        indexer.accountAssetTxPosition(account, "coin#test", position);
+      }
+    }
+    if (auto error = iroha::expected::resultToOptionalError(indexer.flush())) {
+      state.SkipWithError(error->c_str());
+    }
+    *sql << "ROLLBACK";
+    ++height;
+  }
+  state.SetItemsProcessed(state.iterations() * txs_number);
+}
+BENCHMARK(BM_IndexBlock)
+    ->RangeMultiplier(10)
+    ->Range(1, 10000)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
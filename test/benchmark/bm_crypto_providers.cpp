@@ -0,0 +1,119 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+#include <map>
+
+#include "cryptography/crypto_provider/crypto_provider_registry.hpp"
+
+using namespace shared_model::crypto;
+
+/**
+ * These benchmarks compare sign and verify throughput of every provider
+ * registered in CryptoProviderRegistry. Payloads have the size of a typical
+ * transfer transaction. Verification cycles over more signatures than the
+ * verified signatures cache keeps, so it measures actual verification.
+ * Batch verification is measured for the number of signatures given by the
+ * benchmark argument.
+ */
+
+namespace {
+  constexpr size_t kPayloadSize = 256;
+  constexpr size_t kSignaturesCount = 1 << 17;
+
+  struct SignedPayloads {
+    std::vector<Keypair> keypairs;
+    std::vector<Blob> payloads;
+    std::vector<Signed> signatures;
+  };
+
+  /// signatures made by provider, created once per provider
+  const SignedPayloads &signedPayloads(const CryptoProvider *provider) {
+    static std::map<const CryptoProvider *, SignedPayloads> cache;
+    auto it = cache.find(provider);
+    if (it != cache.end()) {
+      return it->second;
+    }
+    auto &result = cache[provider];
+    for (size_t i = 0; i < 16; ++i) {
+      result.keypairs.push_back(DefaultCryptoAlgorithmType::generateKeypair());
+    }
+    for (size_t i = 0; i < kSignaturesCount; ++i) {
+      Blob::Bytes bytes(kPayloadSize);
+      for (size_t j = 0; j < sizeof(i); ++j) {
+        bytes[j] = static_cast<uint8_t>(i >> (8 * j));
+      }
+      result.payloads.emplace_back(bytes);
+      result.signatures.push_back(provider->sign(
+          result.payloads.back(), result.keypairs[i % result.keypairs.size()]));
+    }
+    return result;
+  }
+
+  void signBenchmark(benchmark::State &state, const CryptoProvider *provider) {
+    auto keypair = DefaultCryptoAlgorithmType::generateKeypair();
+    Blob payload{Blob::Bytes(kPayloadSize)};
+    while (state.KeepRunning()) {
+      benchmark::DoNotOptimize(provider->sign(payload, keypair));
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  void verifyBenchmark(benchmark::State &state,
+                       const CryptoProvider *provider) {
+    const auto &data = signedPayloads(provider);
+    size_t i = 0;
+    while (state.KeepRunning()) {
+      benchmark::DoNotOptimize(
+          provider->verify(data.signatures[i],
+                           data.payloads[i],
+                           data.keypairs[i % data.keypairs.size()].publicKey()));
+      i = (i + 1) % kSignaturesCount;
+    }
+    state.SetItemsProcessed(state.iterations());
+  }
+
+  void verifyBatchBenchmark(benchmark::State &state,
+                            const CryptoProvider *provider) {
+    const auto &data = signedPayloads(provider);
+    const auto count = static_cast<size_t>(state.range(0));
+    size_t begin = 0;
+    std::vector<VerificationEntry> entries;
+    while (state.KeepRunning()) {
+      state.PauseTiming();
+      entries.clear();
+      for (size_t i = begin; i < begin + count; ++i) {
+        auto index = i % kSignaturesCount;
+        entries.push_back(
+            {data.signatures[index],
+             data.payloads[index],
+             data.keypairs[index % data.keypairs.size()].publicKey()});
+      }
+      begin = (begin + count) % kSignaturesCount;
+      state.ResumeTiming();
+      benchmark::DoNotOptimize(provider->verify_batch(entries));
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+  }
+}  // namespace
+
+int main(int argc, char **argv) {
+  for (const auto &name : CryptoProviderRegistry::names()) {
+    CryptoProviderRegistry::select(name);
+    const auto *provider = &CryptoProviderRegistry::selected();
+    benchmark::RegisterBenchmark(
+        ("BM_Sign/" + name).c_str(), signBenchmark, provider);
+    benchmark::RegisterBenchmark(
+        ("BM_Verify/" + name).c_str(), verifyBenchmark, provider);
+    benchmark::RegisterBenchmark(
+        ("BM_VerifyBatch/" + name).c_str(), verifyBatchBenchmark, provider)
+        ->RangeMultiplier(10)
+        ->Range(1, 1000);
+  }
+  CryptoProviderRegistry::select(CryptoProviderRegistry::kDefaultProvider);
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+}
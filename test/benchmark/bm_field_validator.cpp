@@ -0,0 +1,83 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+
+#include "validators/field_validator.hpp"
+
+using namespace shared_model::validation;
+
+/**
+ * These benchmarks measure validation of the identifier fields, which is run
+ * several times for every transaction
+ */
+
+namespace {
+  const FieldValidator &validator() {
+    static const FieldValidator validator{
+        std::make_shared<ValidatorsConfig>(100)};
+    return validator;
+  }
+
+  template <typename Validate>
+  void validateBenchmark(benchmark::State &state, Validate validate) {
+    while (state.KeepRunning()) {
+      ReasonsGroupType reason;
+      validate(reason);
+      benchmark::DoNotOptimize(reason);
+    }
+  }
+}  // namespace
+
+static void BM_ValidateAccountId(benchmark::State &state) {
+  const std::string value = "admin_account@soramitsu.co.jp";
+  validateBenchmark(state, [&value](auto &reason) {
+    validator().validateAccountId(reason, value);
+  });
+}
+BENCHMARK(BM_ValidateAccountId);
+
+static void BM_ValidateAssetId(benchmark::State &state) {
+  const std::string value = "coin#soramitsu.co.jp";
+  validateBenchmark(state, [&value](auto &reason) {
+    validator().validateAssetId(reason, value);
+  });
+}
+BENCHMARK(BM_ValidateAssetId);
+
+static void BM_ValidatePeerAddress(benchmark::State &state) {
+  const std::string value = "192.168.100.200:10001";
+  validateBenchmark(state, [&value](auto &reason) {
+    validator().validatePeerAddress(reason, value);
+  });
+}
+BENCHMARK(BM_ValidatePeerAddress);
+
+static void BM_ValidateRoleId(benchmark::State &state) {
+  const std::string value = "user";
+  validateBenchmark(state, [&value](auto &reason) {
+    validator().validateRoleId(reason, value);
+  });
+}
+BENCHMARK(BM_ValidateRoleId);
+
+static void BM_ValidateAccountDetailKey(benchmark::State &state) {
+  const std::string value = "Passport_Number_1";
+  validateBenchmark(state, [&value](auto &reason) {
+    validator().validateAccountDetailKey(reason, value);
+  });
+}
+BENCHMARK(BM_ValidateAccountDetailKey);
+
+static void BM_ValidateInvalidAccountId(benchmark::State &state) {
+  const std::string value = "Admin@soramitsu..co.jp";
+  validateBenchmark(state, [&value](auto &reason) {
+    validator().validateAccountId(reason, value);
+  });
+}
+BENCHMARK(BM_ValidateInvalidAccountId);
+
+BENCHMARK_MAIN();
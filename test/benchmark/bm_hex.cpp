@@ -0,0 +1,43 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+#include "common/hexutils.hpp"
+
+/**
+ * These benchmarks measure hex conversions of strings with the size given by
+ * the benchmark argument: 32 bytes is a hash or a public key, 64 bytes is a
+ * signature, larger sizes are serialized blocks stored as hex.
+ */
+
+namespace {
+  std::string bytes(size_t size) {
+    std::string result(size, 0);
+    for (size_t i = 0; i < size; ++i) {
+      result[i] = static_cast<char>(i * 131 + 7);
+    }
+    return result;
+  }
+}  // namespace
+
+static void BM_BytesToHex(benchmark::State &state) {
+  const auto data = bytes(state.range(0));
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(iroha::bytestringToHexstring(data));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_BytesToHex)->Arg(32)->Arg(64)->Arg(4096);
+
+static void BM_HexToBytes(benchmark::State &state) {
+  const auto hex = iroha::bytestringToHexstring(bytes(state.range(0)));
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(iroha::hexstringToBytestring(hex));
+  }
+  state.SetBytesProcessed(state.iterations() * hex.size());
+}
+BENCHMARK(BM_HexToBytes)->Arg(32)->Arg(64)->Arg(4096);
+
+BENCHMARK_MAIN();
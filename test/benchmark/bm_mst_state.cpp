@@ -0,0 +1,62 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+#include "module/irohad/multi_sig_transactions/mst_test_helpers.hpp"
+
+/**
+ * These benchmarks measure merging of MST states with the number of pending
+ * batches given by the benchmark argument, and creation of a batch, which
+ * computes its reduced hash used by all the batch containers.
+ */
+
+namespace {
+  /// state of pending batches of two transactions each
+  iroha::MstState makeState(size_t batches,
+                            const iroha::CompleterType &completer) {
+    auto state = iroha::MstState::empty(getTestLogger("MstState"), completer);
+    const auto time = iroha::time::now();
+    for (size_t i = 0; i < batches; ++i) {
+      state +=
+          makeTestBatch(txBuilder(2 * i, time), txBuilder(2 * i + 1, time));
+    }
+    return state;
+  }
+}  // namespace
+
+static void BM_MstStateMerge(benchmark::State &state) {
+  auto completer = std::make_shared<iroha::TestCompleter>();
+  const auto pending = makeState(state.range(0), completer);
+  auto log = getTestLogger("MstState");
+  while (state.KeepRunning()) {
+    auto merged = iroha::MstState::empty(log, completer);
+    benchmark::DoNotOptimize(merged += pending);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MstStateMerge)->Arg(100)->Arg(1000)->Arg(10000);
+
+static void BM_MstStateMergeKnown(benchmark::State &state) {
+  auto completer = std::make_shared<iroha::TestCompleter>();
+  const auto pending = makeState(state.range(0), completer);
+  auto merged = makeState(state.range(0), completer);
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(merged += pending);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MstStateMergeKnown)->Arg(100)->Arg(1000)->Arg(10000);
+
+static void BM_BatchCreation(benchmark::State &state) {
+  const auto transactions = framework::batch::makeTestBatchTransactions(
+      txBuilder(1), txBuilder(2), txBuilder(3));
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(
+        shared_model::interface::TransactionBatchImpl(transactions));
+  }
+}
+BENCHMARK(BM_BatchCreation);
+
+BENCHMARK_MAIN();
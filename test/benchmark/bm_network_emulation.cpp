@@ -0,0 +1,122 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "backend/protobuf/transaction.hpp"
+#include "benchmark/bm_utils.hpp"
+#include "datetime/time.hpp"
+#include "framework/integration_framework/fake_peer/fake_peer.hpp"
+#include "framework/integration_framework/integration_test_framework.hpp"
+#include "framework/test_logger.hpp"
+#include "metrics/metrics.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "tracing/transaction_tracer.hpp"
+
+using namespace benchmark::utils;
+using namespace common_constants;
+
+namespace {
+  const size_t kProposalSize = 1000;
+  /// offered transactions per second
+  const size_t kTps = 100;
+  /// how long the load is offered
+  const auto kLoadDuration = std::chrono::seconds(10);
+  /// how long the network is given to commit the offered load
+  const auto kDrainTimeout = std::chrono::seconds(60);
+
+  iroha::metrics::Histogram &stageHistogram(const std::string &stage) {
+    return iroha::metrics::registry().histogram(
+        "iroha_transaction_" + stage + "_microseconds", "");
+  }
+}  // namespace
+
+/**
+ * This benchmark runs the pipeline of a peer in a network of fake honest
+ * peers, which are connected to it with emulated links, and offers it a
+ * constant load of transactions. Fake peers talk only to the real peer, so
+ * every vote crosses the emulated link twice. The consensus round time
+ * percentiles and the committed throughput are reported.
+ * @param state - range(0) is the number of peers, range(1) is the delay of
+ * a link in milliseconds, its jitter being a fifth of it, range(2) is the
+ * loss of a link in permille
+ */
+static void BM_NetworkEmulation(benchmark::State &state) {
+  const auto peers = static_cast<size_t>(state.range(0));
+  integration_framework::fake_peer::LinkConditions conditions;
+  conditions.delay = std::chrono::milliseconds(state.range(1));
+  conditions.jitter = conditions.delay / 5;
+  conditions.loss = state.range(2) / 1000.;
+  const auto total = kTps * kLoadDuration.count();
+
+  integration_framework::IntegrationTestFramework itf(kProposalSize);
+  itf.initPipeline(kAdminKeypair);
+  auto fake_peers = itf.addFakePeers(peers - 1);
+  for (auto &fake_peer : fake_peers) {
+    fake_peer->setLinkConditions(conditions);
+  }
+  itf.setGenesisBlock(itf.defaultBlock()).subscribeQueuesAndRun();
+
+  iroha::tracing::tracer().configure(1, "", getTestLogger("Tracer"));
+  stageHistogram("consensus").reset();
+  stageHistogram("total").reset();
+
+  for (auto _ : state) {
+    auto created_time = iroha::time::now() - total;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < total; ++i) {
+      std::this_thread::sleep_until(
+          start + std::chrono::microseconds(1000000 * i / kTps));
+      itf.sendTxWithoutValidation(
+          TestUnsignedTransactionBuilder()
+              .creatorAccountId(kAdminId)
+              .createdTime(created_time + i)
+              .addAssetQuantity(kAssetId, "1.0")
+              .quorum(1)
+              .build()
+              .signAndAddSignature(kAdminKeypair)
+              .finish());
+    }
+    auto sent = std::chrono::steady_clock::now();
+
+    auto &committed = stageHistogram("total");
+    while (committed.snapshot().count < total
+           and std::chrono::steady_clock::now() < sent + kDrainTimeout) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    auto finished = std::chrono::steady_clock::now();
+
+    auto &consensus = stageHistogram("consensus");
+    state.counters["round_p50_ms"] = consensus.quantile(0.5) / 1000.;
+    state.counters["round_p99_ms"] = consensus.quantile(0.99) / 1000.;
+    state.counters["committed_tps"] = committed.snapshot().count
+        / std::chrono::duration<double>(finished - start).count();
+    size_t lost = 0;
+    for (const auto &fake_peer : fake_peers) {
+      lost += fake_peer->getLostMessages();
+    }
+    state.counters["lost_messages"] = lost;
+  }
+
+  iroha::tracing::tracer().configure(0, "", getTestLogger("Tracer"));
+  itf.done();
+}
+
+BENCHMARK(BM_NetworkEmulation)
+    ->ArgNames({"peers", "delay_ms", "loss_permille"})
+    ->Args({4, 0, 0})
+    ->Args({4, 50, 0})
+    ->Args({4, 50, 10})
+    ->Args({16, 50, 0})
+    ->Args({32, 50, 10})
+    ->Args({100, 50, 0})
+    ->Iterations(1)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
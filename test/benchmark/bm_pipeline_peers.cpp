@@ -0,0 +1,165 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <string>
+#include <thread>
+
+#include "backend/protobuf/transaction.hpp"
+#include "benchmark/bm_utils.hpp"
+#include "datetime/time.hpp"
+#include "framework/integration_framework/integration_test_framework.hpp"
+#include "framework/test_logger.hpp"
+#include "metrics/metrics.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+#include "tracing/transaction_tracer.hpp"
+
+using namespace benchmark::utils;
+using namespace common_constants;
+
+namespace {
+  const size_t kProposalSize = 1000;
+  /// how long the load is offered
+  const auto kLoadDuration = std::chrono::seconds(10);
+  /// how long the pipeline is given to commit the offered load
+  const auto kDrainTimeout = std::chrono::seconds(60);
+  const std::string kAmount = "1.0";
+
+  /// stages of the pipeline as reported by the transaction tracer
+  const std::vector<std::string> kStages = {"ordering",
+                                            "validation",
+                                            "block_creation",
+                                            "consensus",
+                                            "commit",
+                                            "total"};
+
+  iroha::metrics::Histogram &stageHistogram(const std::string &stage) {
+    return iroha::metrics::registry().histogram(
+        "iroha_transaction_" + stage + "_microseconds", "");
+  }
+
+  /**
+   * Make the i-th transaction of the load, the commands are mixed so that
+   * every kind of state change is exercised, the balance of the admin
+   * decreases slowly. Created time is unique for every transaction, so that
+   * their hashes differ.
+   */
+  shared_model::proto::Transaction makeTransaction(size_t i,
+                                                   uint64_t created_time) {
+    auto tx =
+        TestUnsignedTransactionBuilder().creatorAccountId(kAdminId).createdTime(
+            created_time);
+    switch (i % 4) {
+      case 0:
+        tx = tx.addAssetQuantity(kAssetId, kAmount);
+        break;
+      case 1:
+        tx = tx.transferAsset(kAdminId, kUserId, kAssetId, "bench", kAmount);
+        break;
+      case 2:
+        tx = tx.setAccountDetail(kAdminId, "key", std::to_string(i));
+        break;
+      default:
+        tx = tx.subtractAssetQuantity(kAssetId, kAmount);
+        break;
+    }
+    return tx.quorum(1).build().signAndAddSignature(kAdminKeypair).finish();
+  }
+}  // namespace
+
+/**
+ * This benchmark runs the whole pipeline of a network of peers, where the
+ * other peers are fake honest peers, and offers it an open-loop load of
+ * transactions with mixed commands: transactions are sent at the given rate
+ * regardless of how fast they are committed. Every transaction is traced,
+ * and the throughput and latency percentiles of every stage are reported.
+ * @param state - range(0) is the number of peers, range(1) is the offered
+ * transactions per second
+ */
+static void BM_PipelinePeers(benchmark::State &state) {
+  const auto peers = static_cast<size_t>(state.range(0));
+  const auto tps = static_cast<size_t>(state.range(1));
+  const auto total = tps * kLoadDuration.count();
+
+  integration_framework::IntegrationTestFramework itf(kProposalSize);
+  itf.initPipeline(kAdminKeypair);
+  itf.addFakePeers(peers - 1);
+  itf.setGenesisBlock(itf.defaultBlock()).subscribeQueuesAndRun();
+  itf.sendTxAwait(
+         createUserWithPerms(
+             kUser,
+             kUserKeypair.publicKey(),
+             kRole,
+             {shared_model::interface::permissions::Role::kReceive})
+             .build()
+             .signAndAddSignature(kAdminKeypair)
+             .finish())
+      .sendTxAwait(TestUnsignedTransactionBuilder()
+                       .creatorAccountId(kAdminId)
+                       .createdTime(iroha::time::now())
+                       .addAssetQuantity(kAssetId, "1000000.0")
+                       .quorum(1)
+                       .build()
+                       .signAndAddSignature(kAdminKeypair)
+                       .finish());
+
+  iroha::tracing::tracer().configure(1, "", getTestLogger("Tracer"));
+  for (const auto &stage : kStages) {
+    stageHistogram(stage).reset();
+  }
+
+  for (auto _ : state) {
+    auto created_time = iroha::time::now() - total;
+    auto start = std::chrono::steady_clock::now();
+    size_t late = 0;
+    for (size_t i = 0; i < total; ++i) {
+      auto tx = makeTransaction(i, created_time + i);
+      auto scheduled = start + std::chrono::microseconds(1000000 * i / tps);
+      if (std::chrono::steady_clock::now() > scheduled) {
+        ++late;
+      } else {
+        std::this_thread::sleep_until(scheduled);
+      }
+      itf.sendTxWithoutValidation(tx);
+    }
+    auto sent = std::chrono::steady_clock::now();
+
+    auto &committed = stageHistogram("total");
+    while (committed.snapshot().count < total
+           and std::chrono::steady_clock::now() < sent + kDrainTimeout) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+    auto finished = std::chrono::steady_clock::now();
+
+    auto seconds = [start](auto end) {
+      return std::chrono::duration<double>(end - start).count();
+    };
+    state.counters["offered_tps"] = total / seconds(sent);
+    state.counters["committed_tps"] =
+        committed.snapshot().count / seconds(finished);
+    state.counters["late_sends"] = late;
+    for (const auto &stage : kStages) {
+      auto &histogram = stageHistogram(stage);
+      state.counters[stage + "_p50_ms"] = histogram.quantile(0.5) / 1000.;
+      state.counters[stage + "_p99_ms"] = histogram.quantile(0.99) / 1000.;
+    }
+  }
+
+  iroha::tracing::tracer().configure(0, "", getTestLogger("Tracer"));
+  itf.done();
+}
+
+BENCHMARK(BM_PipelinePeers)
+    ->ArgNames({"peers", "tps"})
+    ->Args({1, 100})
+    ->Args({1, 500})
+    ->Args({4, 100})
+    ->Args({4, 500})
+    ->Iterations(1)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
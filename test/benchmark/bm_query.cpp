@@ -15,38 +15,47 @@
 using namespace benchmark::utils;
 using namespace common_constants;
 
+const std::string kAmount = "1.0";
+const auto kPageSize = 10u;
+
 /**
- * This benchmark executes get account query in order to measure query execution
- * performance
+ * Prepare ledger with user which has query permissions and several
+ * transactions, then measure execution of queries made by make_query
+ * @param make_query - creates query of the user
+ * @param check - checks response of the query
  */
-static void BM_QueryAccount(benchmark::State &state) {
+template <typename QueryFactory, typename ResponseCheck>
+static void runQueryBenchmark(benchmark::State &state,
+                              QueryFactory &&make_query,
+                              ResponseCheck &&check) {
   integration_framework::IntegrationTestFramework itf(1);
   itf.setInitialState(kAdminKeypair);
-  itf.sendTx(createUserWithPerms(
-                 kUser,
-                 kUserKeypair.publicKey(),
-                 kRole,
-                 {shared_model::interface::permissions::Role::kGetAllAccounts})
-                 .build()
-                 .signAndAddSignature(kAdminKeypair)
-                 .finish());
-
+  itf.sendTx(
+      createUserWithPerms(
+          kUser,
+          kUserKeypair.publicKey(),
+          kRole,
+          {shared_model::interface::permissions::Role::kGetAllAccounts,
+           shared_model::interface::permissions::Role::kGetAllAccAst,
+           shared_model::interface::permissions::Role::kGetAllAccTxs,
+           shared_model::interface::permissions::Role::kGetRoles,
+           shared_model::interface::permissions::Role::kAddAssetQty})
+          .build()
+          .signAndAddSignature(kAdminKeypair)
+          .finish());
   itf.skipBlock().skipProposal();
 
-  auto make_query = []() {
-    return TestUnsignedQueryBuilder()
-        .createdTime(iroha::time::now())
-        .creatorAccountId(kUserId)
-        .queryCounter(1)
-        .getAccount(kUserId)
-        .build()
-        .signAndAddSignature(kUserKeypair)
-        .finish();
-  };
-
-  auto check = [](auto &status) {
-    boost::get<const shared_model::interface::AccountResponse &>(status.get());
-  };
+  for (auto i = 0u; i < kPageSize; ++i) {
+    itf.sendTx(TestUnsignedTransactionBuilder()
+                   .creatorAccountId(kUserId)
+                   .createdTime(iroha::time::now())
+                   .quorum(1)
+                   .addAssetQuantity(kAssetId, kAmount)
+                   .build()
+                   .signAndAddSignature(kUserKeypair)
+                   .finish());
+    itf.skipBlock().skipProposal();
+  }
 
   itf.sendQuery(make_query(), check);
 
@@ -55,6 +64,96 @@ static void BM_QueryAccount(benchmark::State &state) {
   }
   itf.done();
 }
+
+auto baseQuery() {
+  return TestUnsignedQueryBuilder()
+      .createdTime(iroha::time::now())
+      .creatorAccountId(kUserId)
+      .queryCounter(1);
+}
+
+/**
+ * This benchmark executes get account query in order to measure query execution
+ * performance
+ */
+static void BM_QueryAccount(benchmark::State &state) {
+  runQueryBenchmark(
+      state,
+      [] {
+        return baseQuery()
+            .getAccount(kUserId)
+            .build()
+            .signAndAddSignature(kUserKeypair)
+            .finish();
+      },
+      [](auto &status) {
+        boost::get<const shared_model::interface::AccountResponse &>(
+            status.get());
+      });
+}
 BENCHMARK(BM_QueryAccount)->Unit(benchmark::kMicrosecond);
 
+/**
+ * This benchmark executes get account assets query in order to measure query
+ * execution performance
+ */
+static void BM_QueryAccountAssets(benchmark::State &state) {
+  runQueryBenchmark(
+      state,
+      [] {
+        return baseQuery()
+            .getAccountAssets(kUserId, kPageSize, boost::none)
+            .build()
+            .signAndAddSignature(kUserKeypair)
+            .finish();
+      },
+      [](auto &status) {
+        boost::get<const shared_model::interface::AccountAssetResponse &>(
+            status.get());
+      });
+}
+BENCHMARK(BM_QueryAccountAssets)->Unit(benchmark::kMicrosecond);
+
+/**
+ * This benchmark executes get account transactions query in order to measure
+ * query execution performance
+ */
+static void BM_QueryAccountTransactions(benchmark::State &state) {
+  runQueryBenchmark(
+      state,
+      [] {
+        return baseQuery()
+            .getAccountTransactions(kUserId, kPageSize)
+            .build()
+            .signAndAddSignature(kUserKeypair)
+            .finish();
+      },
+      [](auto &status) {
+        boost::get<const shared_model::interface::TransactionsPageResponse &>(
+            status.get());
+      });
+}
+BENCHMARK(BM_QueryAccountTransactions)->Unit(benchmark::kMicrosecond);
+
+/**
+ * This benchmark executes get roles query in order to measure query execution
+ * performance
+ */
+static void BM_QueryRoles(benchmark::State &state) {
+  runQueryBenchmark(
+      state,
+      [] {
+        return baseQuery()
+            .getRoles()
+            .build()
+            .signAndAddSignature(kUserKeypair)
+            .finish();
+      },
+      [](auto &status) {
+        boost::get<const shared_model::interface::RolesResponse &>(
+            status.get());
+      });
+}
+BENCHMARK(BM_QueryRoles)->Unit(benchmark::kMicrosecond);
+
 BENCHMARK_MAIN();
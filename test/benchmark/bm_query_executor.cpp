@@ -0,0 +1,243 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <cstdlib>
+#include <functional>
+
+#include <benchmark/benchmark.h>
+#include <soci/soci.h>
+#include <boost/filesystem.hpp>
+#include "ametsuchi/impl/flat_file/flat_file.hpp"
+#include "ametsuchi/impl/postgres_specific_query_executor.hpp"
+#include "backend/protobuf/proto_permission_to_string.hpp"
+#include "backend/protobuf/proto_query_response_factory.hpp"
+#include "benchmark/ledger_generator.hpp"
+#include "framework/test_db_manager.hpp"
+#include "framework/test_logger.hpp"
+#include "interfaces/query_responses/error_query_response.hpp"
+#include "logger/logger_manager.hpp"
+#include "module/irohad/pending_txs_storage/pending_txs_storage_mock.hpp"
+#include "module/shared_model/builders/protobuf/test_query_builder.hpp"
+
+using namespace benchmark::utils;
+using namespace iroha::ametsuchi;
+
+namespace {
+  /**
+   * @return value of the environment variable, or the default value if it is
+   * not set
+   */
+  size_t sizeFromEnv(const char *name, size_t default_value) {
+    const char *value = std::getenv(name);
+    return value ? std::stoul(value) : default_value;
+  }
+
+  /// the size of the ledger can be changed with environment variables
+  LedgerSize ledgerSize() {
+    return LedgerSize{sizeFromEnv("BM_DOMAINS", 100),
+                      sizeFromEnv("BM_ACCOUNTS", 1000000),
+                      sizeFromEnv("BM_ASSETS", 10000),
+                      sizeFromEnv("BM_ASSETS_PER_ACCOUNT", 10),
+                      sizeFromEnv("BM_DETAILS_PER_ACCOUNT", 10),
+                      sizeFromEnv("BM_BLOCKS", 1000),
+                      sizeFromEnv("BM_TRANSACTIONS_PER_BLOCK", 1000),
+                      sizeFromEnv("BM_ACTIVE_ACCOUNTS", 100)};
+  }
+
+  /// the generated ledger and the executor of queries against it
+  struct Ledger {
+    LedgerSize size;
+    std::unique_ptr<iroha::integration_framework::TestDbManager> db_manager;
+    std::unique_ptr<soci::session> sql;
+    boost::filesystem::path block_store_path;
+    std::unique_ptr<FlatFile> block_store;
+    std::unique_ptr<PostgresSpecificQueryExecutor> executor;
+
+    ~Ledger() {
+      executor.reset();
+      block_store.reset();
+      sql.reset();
+      boost::filesystem::remove_all(block_store_path);
+    }
+  };
+
+  using QueryFactory = std::function<shared_model::proto::Query(
+      const LedgerSize &size, size_t page_size)>;
+
+  auto baseQuery(const LedgerSize &size) {
+    return TestQueryBuilder()
+        .createdTime(iroha::time::now())
+        .creatorAccountId(ledgerAccount(size, 0))
+        .queryCounter(1);
+  }
+
+  /**
+   * Execute the query in order to measure query execution on a ledger of
+   * realistic size
+   * @param ledger - generated ledger
+   * @param make_query - creates the query for the page size given by the
+   * benchmark argument
+   */
+  void runQuery(benchmark::State &state,
+                Ledger &ledger,
+                const QueryFactory &make_query) {
+    const auto query =
+        make_query(ledger.size, static_cast<size_t>(state.range(0)));
+    while (state.KeepRunning()) {
+      auto response = ledger.executor->execute(query);
+      if (auto error =
+              boost::get<const shared_model::interface::ErrorQueryResponse &>(
+                  &response->get())) {
+        state.SkipWithError(error->toString().c_str());
+        break;
+      }
+    }
+  }
+}  // namespace
+
+/**
+ * This benchmark generates a ledger with millions of accounts, balances and
+ * transactions, then executes every kind of query against it, paginated
+ * queries with several page sizes, in order to size hardware and catch
+ * regressions of SQL plans
+ */
+int main(int argc, char **argv) {
+  benchmark::Initialize(&argc, argv);
+  auto log_manager = getTestLoggerManager(logger::LogLevel::kWarn);
+
+  Ledger ledger;
+  ledger.size = ledgerSize();
+  ledger.db_manager =
+      iroha::integration_framework::TestDbManager::createWithRandomDbName(
+          1, log_manager)
+          .match([](auto &&manager) { return std::move(manager.value); },
+                 [](const auto &error)
+                     -> std::unique_ptr<
+                         iroha::integration_framework::TestDbManager> {
+                   throw std::runtime_error(error.error);
+                 });
+  ledger.sql = ledger.db_manager->getSession();
+  ledger.block_store_path = boost::filesystem::temp_directory_path()
+      / boost::filesystem::unique_path();
+  ledger.block_store =
+      FlatFile::create(ledger.block_store_path.string(),
+                       log_manager->getChild("FlatFile")->getLogger())
+          .value();
+
+  generateWsv(*ledger.sql, ledger.size);
+  if (auto error =
+          generateBlocks(*ledger.sql, *ledger.block_store, ledger.size)) {
+    throw std::runtime_error(*error);
+  }
+
+  auto response_factory =
+      std::make_shared<shared_model::proto::ProtoQueryResponseFactory>();
+  ledger.executor = std::make_unique<PostgresSpecificQueryExecutor>(
+      *ledger.sql,
+      *ledger.block_store,
+      nullptr,
+      std::make_shared<iroha::MockPendingTransactionStorage>(),
+      std::make_shared<shared_model::proto::ProtoBlockJsonConverter>(),
+      response_factory,
+      std::make_shared<shared_model::proto::ProtoPermissionToString>(),
+      log_manager->getChild("QueryExecutor")->getLogger());
+
+  const auto busy_account = [](const auto &size) {
+    return ledgerAccount(size, 1);
+  };
+  const std::vector<std::pair<std::string, QueryFactory>> single_queries{
+      {"GetAccount",
+       [&](const auto &size, auto) {
+         return baseQuery(size).getAccount(busy_account(size)).build();
+       }},
+      {"GetSignatories",
+       [&](const auto &size, auto) {
+         return baseQuery(size).getSignatories(busy_account(size)).build();
+       }},
+      {"GetBlock",
+       [](const auto &size, auto) {
+         return baseQuery(size).getBlock(size.blocks / 2 + 1).build();
+       }},
+      {"GetRoles",
+       [](const auto &size, auto) {
+         return baseQuery(size).getRoles().build();
+       }},
+      {"GetRolePermissions",
+       [](const auto &size, auto) {
+         return baseQuery(size).getRolePermissions(kLedgerRole).build();
+       }},
+      {"GetTransactions",
+       [&](const auto &size, auto) {
+         std::vector<std::string> hexes(10);
+         *ledger.sql
+             << "SELECT encode(hash, 'hex') FROM position_by_hash LIMIT 10",
+             soci::into(hexes);
+         std::vector<shared_model::crypto::Hash> hashes;
+         for (const auto &hex : hexes) {
+           hashes.push_back(shared_model::crypto::Hash::fromHexString(hex));
+         }
+         return baseQuery(size).getTransactions(hashes).build();
+       }},
+      {"GetAssetInfo",
+       [](const auto &size, auto) {
+         return baseQuery(size).getAssetInfo(kLedgerAsset).build();
+       }},
+      {"GetPeers",
+       [](const auto &size, auto) {
+         return baseQuery(size).getPeers().build();
+       }},
+  };
+  const std::vector<std::pair<std::string, QueryFactory>> paginated_queries{
+      {"GetAccountAssets",
+       [&](const auto &size, auto page_size) {
+         return baseQuery(size)
+             .getAccountAssets(busy_account(size), page_size, boost::none)
+             .build();
+       }},
+      {"GetAccountDetail",
+       [&](const auto &size, auto page_size) {
+         return baseQuery(size)
+             .getAccountDetail(page_size, busy_account(size))
+             .build();
+       }},
+      {"GetAccountTransactions",
+       [&](const auto &size, auto page_size) {
+         return baseQuery(size)
+             .getAccountTransactions(busy_account(size), page_size)
+             .build();
+       }},
+      {"GetAccountAssetTransactions",
+       [&](const auto &size, auto page_size) {
+         return baseQuery(size)
+             .getAccountAssetTransactions(
+                 busy_account(size), kLedgerAsset, page_size)
+             .build();
+       }},
+  };
+
+  for (const auto &query : single_queries) {
+    benchmark::RegisterBenchmark(
+        ("BM_" + query.first).c_str(),
+        runQuery,
+        std::ref(ledger),
+        query.second)
+        ->Arg(0)
+        ->Unit(benchmark::kMicrosecond);
+  }
+  for (const auto &query : paginated_queries) {
+    benchmark::RegisterBenchmark(
+        ("BM_" + query.first).c_str(),
+        runQuery,
+        std::ref(ledger),
+        query.second)
+        ->ArgName("page_size")
+        ->Arg(10)
+        ->Arg(100)
+        ->Arg(1000)
+        ->Unit(benchmark::kMicrosecond);
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+}
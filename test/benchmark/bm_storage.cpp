@@ -0,0 +1,174 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+#include <soci/postgresql/soci-postgresql.h>
+#include <soci/soci.h>
+#include <boost/filesystem.hpp>
+#include <boost/uuid/uuid_generators.hpp>
+#include <boost/uuid/uuid_io.hpp>
+#include "ametsuchi/impl/in_memory_block_storage_factory.hpp"
+#include "ametsuchi/impl/k_times_reconnection_strategy.hpp"
+#include "ametsuchi/impl/storage_impl.hpp"
+#include "ametsuchi/mutable_storage.hpp"
+#include "backend/protobuf/proto_block_json_converter.hpp"
+#include "backend/protobuf/proto_permission_to_string.hpp"
+#include "benchmark/ledger_generator.hpp"
+#include "framework/config_helper.hpp"
+#include "framework/test_logger.hpp"
+#include "logger/logger_manager.hpp"
+#include "main/impl/pg_connection_init.hpp"
+#include "metrics/metrics.hpp"
+
+using namespace benchmark::utils;
+using namespace iroha::ametsuchi;
+
+namespace {
+  /// phases of a block commit as reported by the storage metrics
+  const std::vector<std::string> kPhases = {
+      "execution", "indexing", "database_commit", "block_store"};
+
+  iroha::metrics::Histogram &phaseHistogram(const std::string &phase) {
+    return iroha::metrics::registry().histogram(
+        "iroha_storage_" + phase + "_microseconds", "");
+  }
+
+  template <typename T>
+  T valueOrThrow(iroha::expected::Result<T, std::string> result) {
+    return std::move(result).match(
+        [](auto &&value) { return std::move(value.value); },
+        [](const auto &error) -> T { throw std::runtime_error(error.error); });
+  }
+
+  /**
+   * Make a block of transfers between the accounts of the generated ledger,
+   * every account i holds asset i % assets, so that the transfers touch the
+   * whole world state view
+   */
+  std::shared_ptr<const shared_model::interface::Block> makeBlock(
+      const LedgerSize &size,
+      size_t transactions,
+      shared_model::interface::types::HeightType height,
+      const shared_model::crypto::Hash &prev_hash) {
+    static size_t n = 0;
+    std::vector<shared_model::proto::Transaction> block_transactions;
+    block_transactions.reserve(transactions);
+    for (size_t i = 0; i < transactions; ++i, ++n) {
+      auto source = 1 + n % (size.accounts - 1);
+      block_transactions.push_back(
+          TestTransactionBuilder()
+              .creatorAccountId(ledgerAccount(size, source))
+              .createdTime(iroha::time::now() - transactions + i)
+              .quorum(1)
+              .transferAsset(ledgerAccount(size, source),
+                             ledgerAccount(size, source + 1),
+                             ledgerAsset(size, source % size.assets),
+                             "",
+                             "0.01")
+              .build());
+    }
+    return clone(TestBlockBuilder()
+                     .transactions(block_transactions)
+                     .height(height)
+                     .prevHash(prev_hash)
+                     .createdTime(iroha::time::now())
+                     .build());
+  }
+}  // namespace
+
+/**
+ * This benchmark applies blocks of transfers to the mutable storage and
+ * commits them, isolated from consensus, in order to measure the commit
+ * latency for the given sizes of blocks and of the world state view. The
+ * mean time of every commit phase is reported from the storage metrics: the
+ * execution of commands, indexing, the commit of the database transaction,
+ * which waits for the write-ahead log to be flushed, and the block store
+ * write.
+ * @param state - range(0) is the number of accounts, range(1) is the number
+ * of transactions in a block
+ */
+static void BM_StorageCommit(benchmark::State &state) {
+  auto log_manager = getTestLoggerManager(logger::LogLevel::kWarn);
+  LedgerSize size{};
+  size.domains = 100;
+  size.accounts = static_cast<size_t>(state.range(0));
+  size.assets = 1000;
+  size.assets_per_account = 1;
+  const auto transactions = static_cast<size_t>(state.range(1));
+
+  const auto block_store_path = (boost::filesystem::temp_directory_path()
+                                 / boost::filesystem::unique_path())
+                                    .string();
+  const auto dbname = "d"
+      + boost::uuids::to_string(boost::uuids::random_generator()())
+            .substr(0, 8);
+  auto options = std::make_unique<PostgresOptions>(
+      "dbname=" + dbname + " "
+          + iroha::integration_framework::getPostgresCredsOrDefault(),
+      dbname,
+      log_manager->getChild("PostgresOptions")->getLogger());
+  valueOrThrow(PgConnectionInit::createDatabaseIfNotExist(*options));
+  auto pool_wrapper = valueOrThrow(PgConnectionInit::prepareConnectionPool(
+      KTimesReconnectionStrategyFactory(0),
+      *options,
+      2,
+      log_manager->getChild("DbConnectionPool")));
+  {
+    soci::session sql(*soci::factory_postgresql(),
+                      options->workingConnectionString());
+    generateWsv(sql, size);
+    sql << "ANALYZE";
+  }
+  auto storage = valueOrThrow(StorageImpl::create(
+      block_store_path,
+      std::move(options),
+      std::move(pool_wrapper),
+      std::make_shared<shared_model::proto::ProtoBlockJsonConverter>(),
+      std::make_shared<shared_model::proto::ProtoPermissionToString>(),
+      std::make_unique<InMemoryBlockStorageFactory>(),
+      log_manager->getChild("Storage"),
+      2));
+
+  for (const auto &phase : kPhases) {
+    phaseHistogram(phase).reset();
+  }
+  shared_model::interface::types::HeightType height = 1;
+  shared_model::crypto::Hash prev_hash(std::string(32, '\0'));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto block = makeBlock(size, transactions, height++, prev_hash);
+    prev_hash = block->hash();
+    state.ResumeTiming();
+
+    auto mutable_storage = valueOrThrow(storage->createMutableStorage());
+    if (not mutable_storage->apply(block)) {
+      state.SkipWithError("Block is not applied");
+      break;
+    }
+    valueOrThrow(storage->commit(std::move(mutable_storage)));
+  }
+
+  state.SetItemsProcessed(state.iterations() * transactions);
+  for (const auto &phase : kPhases) {
+    auto snapshot = phaseHistogram(phase).snapshot();
+    state.counters[phase + "_ms"] =
+        snapshot.count == 0 ? 0. : snapshot.sum / 1000. / snapshot.count;
+  }
+  storage->dropStorage();
+  boost::filesystem::remove_all(block_store_path);
+}
+BENCHMARK(BM_StorageCommit)
+    ->ArgNames({"accounts", "txs"})
+    ->Apply([](benchmark::internal::Benchmark *benchmark) {
+      for (auto accounts : {10000, 1000000}) {
+        for (auto transactions : {10, 100, 1000, 10000}) {
+          benchmark->Args({accounts, transactions});
+        }
+      }
+    })
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,157 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "consensus/yac/cluster_order.hpp"
+#include "consensus/yac/storage/yac_block_storage.hpp"
+#include "consensus/yac/storage/yac_proposal_storage.hpp"
+#include "consensus/yac/supermajority_checker.hpp"
+#include "framework/test_logger.hpp"
+#include "logger/logger_manager.hpp"
+#include "module/irohad/consensus/yac/yac_test_util.hpp"
+
+using namespace iroha::consensus;
+using namespace iroha::consensus::yac;
+
+namespace {
+  /// votes are logged for every insertion, which is not what is measured
+  logger::LoggerManagerTreePtr logManager() {
+    return getTestLoggerManager(logger::LogLevel::kCritical)->getChild("Yac");
+  }
+
+  /**
+   * Make a vote of every peer, the peers vote for the given number of
+   * different blocks in turn
+   */
+  std::vector<VoteMessage> makeVotes(const Round &round,
+                                     PeersNumberType peers,
+                                     size_t blocks) {
+    std::vector<VoteMessage> votes;
+    votes.reserve(peers);
+    for (PeersNumberType i = 0; i < peers; ++i) {
+      votes.push_back(createVote(
+          YacHash(round, "proposal", "block" + std::to_string(i % blocks)),
+          std::to_string(i)));
+    }
+    return votes;
+  }
+
+  void setPeersArgs(benchmark::internal::Benchmark *benchmark) {
+    for (auto peers : {4, 16, 64, 200}) {
+      benchmark->Arg(peers);
+    }
+  }
+
+  void proposalStorageInsert(benchmark::State &state, size_t blocks) {
+    const auto peers = static_cast<PeersNumberType>(state.range(0));
+    const Round round{1, 1};
+    const auto votes = makeVotes(round, peers, blocks);
+    std::shared_ptr<SupermajorityChecker> checker =
+        getSupermajorityChecker(ConsistencyModel::kBft);
+    auto log_manager = logManager();
+
+    while (state.KeepRunning()) {
+      YacProposalStorage storage(round, peers, checker, log_manager);
+      for (const auto &vote : votes) {
+        benchmark::DoNotOptimize(storage.insert(vote));
+      }
+    }
+    state.SetItemsProcessed(state.iterations() * peers);
+  }
+}  // namespace
+
+/**
+ * This benchmark inserts the votes of all peers for the same block into a
+ * proposal storage, so that a commit is found, in order to measure vote
+ * ingestion with the answer computed after every vote
+ * @param state - range(0) is the number of peers
+ */
+static void BM_YacProposalStorageCommit(benchmark::State &state) {
+  proposalStorageInsert(state, 1);
+}
+BENCHMARK(BM_YacProposalStorageCommit)->Apply(setPeersArgs);
+
+/**
+ * This benchmark inserts the votes of all peers split between two blocks
+ * into a proposal storage, so that a reject proof is searched after every
+ * vote
+ * @param state - range(0) is the number of peers
+ */
+static void BM_YacProposalStorageReject(benchmark::State &state) {
+  proposalStorageInsert(state, 2);
+}
+BENCHMARK(BM_YacProposalStorageReject)->Apply(setPeersArgs);
+
+/**
+ * This benchmark inserts the votes of all peers into a block storage
+ * @param state - range(0) is the number of peers
+ */
+static void BM_YacBlockStorageInsert(benchmark::State &state) {
+  const auto peers = static_cast<PeersNumberType>(state.range(0));
+  const auto votes = makeVotes(Round{1, 1}, peers, 1);
+  std::shared_ptr<SupermajorityChecker> checker =
+      getSupermajorityChecker(ConsistencyModel::kBft);
+  auto log = logManager()->getChild("BlockStorage")->getLogger();
+
+  while (state.KeepRunning()) {
+    YacBlockStorage storage(votes.front().hash, peers, checker, log);
+    for (const auto &vote : votes) {
+      benchmark::DoNotOptimize(storage.insert(vote));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * peers);
+}
+BENCHMARK(BM_YacBlockStorageInsert)->Apply(setPeersArgs);
+
+/**
+ * This benchmark checks every possible number of votes for supermajority and
+ * whether supermajority is still possible when votes are split between two
+ * blocks
+ * @param state - range(0) is the number of peers
+ */
+template <ConsistencyModel kModel>
+static void BM_SupermajorityChecker(benchmark::State &state) {
+  const auto peers = static_cast<PeersNumberType>(state.range(0));
+  auto checker = getSupermajorityChecker(kModel);
+
+  while (state.KeepRunning()) {
+    for (PeersNumberType voted = 0; voted <= peers; ++voted) {
+      benchmark::DoNotOptimize(checker->hasSupermajority(voted, peers));
+      std::vector<PeersNumberType> groups{voted / 2, voted - voted / 2};
+      benchmark::DoNotOptimize(checker->canHaveSupermajority(groups, peers));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * (peers + 1));
+}
+BENCHMARK_TEMPLATE(BM_SupermajorityChecker, ConsistencyModel::kBft)
+    ->Apply(setPeersArgs);
+BENCHMARK_TEMPLATE(BM_SupermajorityChecker, ConsistencyModel::kCft)
+    ->Apply(setPeersArgs);
+
+/**
+ * This benchmark creates the cluster ordering of a round and switches the
+ * leader through all the peers, as it is done when votes are propagated
+ * @param state - range(0) is the number of peers
+ */
+static void BM_ClusterOrdering(benchmark::State &state) {
+  const auto peers = static_cast<size_t>(state.range(0));
+  std::vector<std::shared_ptr<shared_model::interface::Peer>> order;
+  for (size_t i = 0; i < peers; ++i) {
+    order.push_back(makePeer(std::to_string(i)));
+  }
+
+  while (state.KeepRunning()) {
+    auto ordering = ClusterOrdering::create(order);
+    while (ordering->hasNext()) {
+      benchmark::DoNotOptimize(&ordering->currentLeader());
+      ordering->switchToNext();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * peers);
+}
+BENCHMARK(BM_ClusterOrdering)->Apply(setPeersArgs);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,197 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef IROHA_BM_LEDGER_GENERATOR_HPP
+#define IROHA_BM_LEDGER_GENERATOR_HPP
+
+#include <soci/soci.h>
+
+#include "ametsuchi/impl/postgres_indexer.hpp"
+#include "ametsuchi/key_value_storage.hpp"
+#include "backend/protobuf/proto_block_json_converter.hpp"
+#include "common/byteutils.hpp"
+#include "datetime/time.hpp"
+#include "generator/generator.hpp"
+#include "interfaces/permissions.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+namespace benchmark {
+  namespace utils {
+
+    /// sizes of the generated ledger
+    struct LedgerSize {
+      size_t domains;
+      size_t accounts;
+      size_t assets;
+      /// number of assets every account holds
+      size_t assets_per_account;
+      /// number of details every account has
+      size_t details_per_account;
+      size_t blocks;
+      size_t transactions_per_block;
+      /// number of accounts which create the transactions
+      size_t active_accounts;
+    };
+
+    /// role of every generated account, it has all the permissions
+    const std::string kLedgerRole = "user";
+    /// asset transferred by the generated transactions
+    const std::string kLedgerAsset = "asset0#domain0";
+
+    inline std::string ledgerDomain(size_t i) {
+      return "domain" + std::to_string(i);
+    }
+
+    inline std::string ledgerAccount(const LedgerSize &size, size_t i) {
+      return "account" + std::to_string(i) + "@"
+          + ledgerDomain(i % size.domains);
+    }
+
+    inline std::string ledgerAsset(const LedgerSize &size, size_t i) {
+      return "asset" + std::to_string(i) + "#" + ledgerDomain(i % size.domains);
+    }
+
+    /**
+     * Fill the world state view of an empty database with the given number of
+     * domains, accounts, assets, balances and account details. Rows are
+     * generated by Postgres itself, so that millions of them take seconds.
+     * Account i is named account<i>@domain<i % domains> and holds
+     * assets_per_account consecutive assets starting from asset<i % assets>.
+     * @param sql - session of the database with the schema created
+     * @param size - sizes of the ledger
+     */
+    inline void generateWsv(soci::session &sql, const LedgerSize &size) {
+      const auto domains = std::to_string(size.domains);
+      const auto accounts = std::to_string(size.accounts);
+      const auto assets = std::to_string(size.assets);
+      const auto permissions = std::to_string(
+          shared_model::interface::RolePermissionSet::size());
+      const auto account_id = "'account' || i || '@domain' || (i % " + domains
+          + ")";
+      const auto public_key =
+          "decode(md5(i::text) || md5((-i - 1)::text), 'hex')";
+      const auto asset_index = "((i + k) % " + assets + ")";
+
+      sql << "INSERT INTO role VALUES ('" + kLedgerRole + "')";
+      sql << "INSERT INTO role_has_permissions VALUES ('" + kLedgerRole
+              + "', repeat('1', " + permissions + ")::bit(" + permissions
+              + "))";
+      sql << "INSERT INTO domain SELECT 'domain' || i, '" + kLedgerRole
+              + "' FROM generate_series(0, " + domains + " - 1) i";
+      sql << "INSERT INTO account SELECT " + account_id + ", 'domain' || (i % "
+              + domains + "), 1 FROM generate_series(0, " + accounts
+              + " - 1) i";
+      sql << "INSERT INTO account_has_detail SELECT " + account_id + ", '"
+              + ledgerAccount(size, 0) + "', 'key' || k, '\""
+              + generator::randomString(32) + "\"' FROM generate_series(0, "
+              + accounts + " - 1) i, generate_series(0, "
+              + std::to_string(size.details_per_account) + " - 1) k";
+      sql << "INSERT INTO signatory SELECT " + public_key
+              + " FROM generate_series(0, " + accounts + " - 1) i";
+      sql << "INSERT INTO account_has_signatory SELECT " + account_id + ", "
+              + public_key + " FROM generate_series(0, " + accounts
+              + " - 1) i";
+      sql << "INSERT INTO account_has_roles SELECT " + account_id + ", '"
+              + kLedgerRole + "' FROM generate_series(0, " + accounts
+              + " - 1) i";
+      sql << "INSERT INTO asset SELECT 'asset' || i || '#domain' || (i % "
+              + domains + "), 'domain' || (i % " + domains
+              + "), 2, NULL FROM generate_series(0, " + assets + " - 1) i";
+      sql << "INSERT INTO account_has_asset SELECT " + account_id
+              + ", 'asset' || " + asset_index + " || '#domain' || ("
+              + asset_index + " % " + domains
+              + "), (i + k) || '.00' FROM generate_series(0, " + accounts
+              + " - 1) i, generate_series(0, "
+              + std::to_string(size.assets_per_account) + " - 1) k";
+      sql << "INSERT INTO peer VALUES (decode(md5('peer') || md5('peer'), "
+             "'hex'), '127.0.0.1:10001')";
+    }
+
+    /**
+     * Generate the blocks of transfers of kLedgerAsset between the active
+     * accounts, store them to the block store and index them. Transactions
+     * are not signed, as signatures are not checked by queries.
+     * @param sql - session of the database with the world state view
+     * generated by generateWsv
+     * @param block_store - empty block store
+     * @param size - sizes of the ledger
+     * @return error message if indexing or storing failed
+     */
+    inline boost::optional<std::string> generateBlocks(
+        soci::session &sql,
+        iroha::ametsuchi::KeyValueStorage &block_store,
+        const LedgerSize &size) {
+      shared_model::proto::ProtoBlockJsonConverter converter;
+      auto created_time = iroha::time::now()
+          - size.blocks * size.transactions_per_block;
+      shared_model::crypto::Hash prev_hash(std::string(32, '\0'));
+      for (size_t height = 1; height <= size.blocks; ++height) {
+        std::vector<shared_model::proto::Transaction> transactions;
+        std::vector<std::pair<std::string, std::string>> transfers;
+        transactions.reserve(size.transactions_per_block);
+        for (size_t i = 0; i < size.transactions_per_block; ++i) {
+          auto n = (height - 1) * size.transactions_per_block + i;
+          transfers.emplace_back(
+              ledgerAccount(size, n % size.active_accounts),
+              ledgerAccount(size, (n + 1) % size.active_accounts));
+          transactions.push_back(TestTransactionBuilder()
+                                     .creatorAccountId(transfers.back().first)
+                                     .createdTime(created_time++)
+                                     .quorum(1)
+                                     .transferAsset(transfers.back().first,
+                                                    transfers.back().second,
+                                                    kLedgerAsset,
+                                                    "",
+                                                    "1.00")
+                                     .build());
+        }
+        auto block = TestBlockBuilder()
+                         .transactions(transactions)
+                         .height(height)
+                         .prevHash(prev_hash)
+                         .createdTime(created_time)
+                         .build();
+
+        iroha::ametsuchi::PostgresIndexer indexer(sql);
+        for (size_t i = 0; i < transactions.size(); ++i) {
+          const auto &hash = transactions[i].hash();
+          const iroha::ametsuchi::Indexer::TxPosition position{height, i};
+          indexer.txHashPosition(hash, position);
+          indexer.committedTxHash(hash);
+          indexer.txPositionByCreator(transfers[i].first, position);
+          indexer.accountAssetTxPosition(
+              transfers[i].first, kLedgerAsset, position);
+          indexer.accountAssetTxPosition(
+              transfers[i].second, kLedgerAsset, position);
+        }
+        indexer.topBlock(height, block.hash());
+        if (auto error =
+                iroha::expected::resultToOptionalError(indexer.flush())) {
+          return error;
+        }
+
+        auto json = converter.serialize(block);
+        if (auto error = boost::get<iroha::expected::Error<std::string>>(
+                &json)) {
+          return error->error;
+        }
+        const auto &block_json =
+            boost::get<iroha::expected::Value<
+                shared_model::interface::types::JsonType>>(json)
+                .value;
+        if (not block_store.add(height, iroha::stringToBytes(block_json))) {
+          return "Failed to store block " + std::to_string(height);
+        }
+        prev_hash = block.hash();
+      }
+      sql << "ANALYZE";
+      return boost::none;
+    }
+
+  }  // namespace utils
+}  // namespace benchmark
+
+#endif  // IROHA_BM_LEDGER_GENERATOR_HPP
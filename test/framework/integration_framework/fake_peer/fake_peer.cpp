@@ -302,13 +302,42 @@ namespace integration_framework {
       return yac_crypto_->getVote(my_yac_hash);
     }
 
+    FakePeer &FakePeer::setLinkConditions(const LinkConditions &conditions) {
+      if (link_to_real_) {
+        link_to_real_->setConditions(conditions);
+        link_from_real_->setConditions(conditions);
+      } else {
+        link_to_real_ = std::make_shared<LinkEmulator>(conditions);
+        link_from_real_ = std::make_shared<LinkEmulator>(conditions);
+        yac_network_notifier_->setLink(link_from_real_);
+      }
+      return *this;
+    }
+
+    size_t FakePeer::getLostMessages() const {
+      if (not link_to_real_) {
+        return 0;
+      }
+      return link_to_real_->lost() + link_from_real_->lost();
+    }
+
     void FakePeer::sendMstState(const iroha::MstState &state) {
-      mst_transport_->sendState(*real_peer_, state);
+      size_t size = 0;
+      state.iterateBatches([&size](const auto &batch) {
+        for (const auto &tx : batch->transactions()) {
+          size += tx->blob().size();
+        }
+      });
+      sendToRealPeer(size, [this, state] {
+        mst_transport_->sendState(*real_peer_, state);
+      });
     }
 
     void FakePeer::sendYacState(
         const std::vector<iroha::consensus::yac::VoteMessage> &state) {
-      yac_transport_->sendState(*real_peer_, state);
+      sendToRealPeer(state.size() * kVoteSizeBytes, [this, state] {
+        yac_transport_->sendState(*real_peer_, state);
+      });
     }
 
     void FakePeer::voteForTheSame(
@@ -371,11 +400,14 @@ namespace integration_framework {
                 ->getTransport();
       }
 
-      auto client = iroha::network::createClient<
-          iroha::ordering::proto::OnDemandOrdering>(real_peer_->address());
-      grpc::ClientContext context;
-      google::protobuf::Empty result;
-      client->SendBatches(&context, request, &result);
+      auto size = request.ByteSizeLong();
+      sendToRealPeer(size, [this, request = std::move(request)] {
+        auto client = iroha::network::createClient<
+            iroha::ordering::proto::OnDemandOrdering>(real_peer_->address());
+        grpc::ClientContext context;
+        google::protobuf::Empty result;
+        client->SendBatches(&context, request, &result);
+      });
     }
 
     boost::optional<std::shared_ptr<const shared_model::interface::Proposal>>
@@ -396,5 +428,13 @@ namespace integration_framework {
       BOOST_VERIFY_MSG(initialized_, "Instance not initialized!");
     }
 
+    void FakePeer::sendToRealPeer(size_t size, std::function<void()> send) {
+      if (link_to_real_) {
+        link_to_real_->send(size, std::move(send));
+      } else {
+        send();
+      }
+    }
+
   }  // namespace fake_peer
 }  // namespace integration_framework
@@ -11,6 +11,7 @@
 
 #include <boost/core/noncopyable.hpp>
 #include <rxcpp/rx.hpp>
+#include "framework/integration_framework/fake_peer/network/link_emulator.hpp"
 #include "framework/integration_framework/fake_peer/network/mst_message.hpp"
 #include "framework/integration_framework/fake_peer/proposal_storage.hpp"
 #include "framework/integration_framework/fake_peer/types.hpp"
@@ -94,6 +95,18 @@ namespace integration_framework {
 
       ProposalStorage &getProposalStorage();
 
+      /**
+       * Emulate the links between this peer and the real one. The messages
+       * this peer sends and the YAC states it receives are delayed, lost and
+       * limited in bandwidth according to the conditions, and the sending
+       * methods no longer block. The links are created by the first call,
+       * which must precede run(), the later calls change their conditions.
+       */
+      FakePeer &setLinkConditions(const LinkConditions &conditions);
+
+      /// Get the number of messages lost by the links, in both directions.
+      size_t getLostMessages() const;
+
       /// Start the fake peer.
       std::unique_ptr<ServerRunner> run();
 
@@ -206,6 +219,9 @@ namespace integration_framework {
       /// Ensure the initialize() method was called.
       void ensureInitialized();
 
+      /// Send a message of the given size to the real peer over the link.
+      void sendToRealPeer(size_t size, std::function<void()> send);
+
       bool initialized_{false};
 
       logger::LoggerPtr log_;
@@ -252,6 +268,11 @@ namespace integration_framework {
       std::shared_ptr<Behaviour> behaviour_;
       std::shared_ptr<BlockStorage> block_storage_;
       ProposalStorage proposal_storage_;
+
+      // the links are destroyed first, so that no message is delivered
+      // to a destroyed transport
+      std::shared_ptr<LinkEmulator> link_to_real_;
+      std::shared_ptr<LinkEmulator> link_from_real_;
     };
 
   }  // namespace fake_peer
@@ -0,0 +1,88 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "framework/integration_framework/fake_peer/network/link_emulator.hpp"
+
+#include <algorithm>
+
+namespace integration_framework {
+  namespace fake_peer {
+
+    LinkEmulator::LinkEmulator(LinkConditions conditions, uint32_t seed)
+        : conditions_(conditions),
+          random_(seed),
+          free_at_(Clock::now()),
+          thread_([this] { work(); }) {}
+
+    LinkEmulator::~LinkEmulator() {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+      }
+      cv_.notify_all();
+      thread_.join();
+    }
+
+    void LinkEmulator::setConditions(LinkConditions conditions) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      conditions_ = conditions;
+    }
+
+    bool LinkEmulator::send(size_t size, std::function<void()> deliver) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (std::bernoulli_distribution(conditions_.loss)(random_)) {
+          ++lost_;
+          return false;
+        }
+
+        free_at_ = std::max(free_at_, Clock::now());
+        if (conditions_.bandwidth != 0) {
+          free_at_ += std::chrono::microseconds(
+              size * 1000000 / conditions_.bandwidth);
+        }
+
+        std::uniform_int_distribution<std::chrono::milliseconds::rep> jitter(
+            -conditions_.jitter.count(), conditions_.jitter.count());
+        auto delay = std::max(
+            conditions_.delay + std::chrono::milliseconds(jitter(random_)),
+            std::chrono::milliseconds(0));
+        in_flight_.emplace(free_at_ + delay, std::move(deliver));
+      }
+      cv_.notify_all();
+      return true;
+    }
+
+    size_t LinkEmulator::lost() const {
+      return lost_;
+    }
+
+    size_t LinkEmulator::delivered() const {
+      return delivered_;
+    }
+
+    void LinkEmulator::work() {
+      std::unique_lock<std::mutex> lock(mutex_);
+      while (not stop_) {
+        if (in_flight_.empty()) {
+          cv_.wait(lock);
+          continue;
+        }
+        auto next = in_flight_.begin();
+        if (next->first > Clock::now()) {
+          cv_.wait_until(lock, next->first);
+          continue;
+        }
+        auto deliver = std::move(next->second);
+        in_flight_.erase(next);
+        lock.unlock();
+        deliver();
+        ++delivered_;
+        lock.lock();
+      }
+    }
+
+  }  // namespace fake_peer
+}  // namespace integration_framework
@@ -0,0 +1,100 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef FAKE_PEER_LINK_EMULATOR_HPP_
+#define FAKE_PEER_LINK_EMULATOR_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <random>
+#include <thread>
+
+namespace integration_framework {
+  namespace fake_peer {
+
+    /// approximate size of a serialized YAC vote: the round, two hashes and
+    /// two signatures with public keys
+    constexpr size_t kVoteSizeBytes = 300;
+
+    /// Properties of a network link in one direction
+    struct LinkConditions {
+      /// propagation delay of every message
+      std::chrono::milliseconds delay{0};
+      /// maximal deviation from the delay, distributed uniformly
+      std::chrono::milliseconds jitter{0};
+      /// probability of a message to be lost, from 0 to 1
+      double loss = 0;
+      /// bytes transmitted per second, 0 means unlimited
+      size_t bandwidth = 0;
+    };
+
+    /**
+     * Emulates a link in one direction: messages are delivered on the thread
+     * of the link after the delay, randomly deviated by the jitter, and after
+     * the messages sent before them are transmitted with the bandwidth.
+     * Messages may be reordered by the jitter, as on a real network, and are
+     * lost randomly. Delivery functions run one after another, so a blocking
+     * one holds the link like a slow receiver does
+     */
+    class LinkEmulator {
+     public:
+      /**
+       * @param conditions - properties of the link
+       * @param seed - seed of the losses and the jitter, so that runs may be
+       * reproduced
+       */
+      explicit LinkEmulator(LinkConditions conditions,
+                            uint32_t seed = std::random_device{}());
+
+      LinkEmulator(const LinkEmulator &) = delete;
+      LinkEmulator &operator=(const LinkEmulator &) = delete;
+
+      /// Messages in flight are dropped
+      ~LinkEmulator();
+
+      /// Change the properties for the messages sent afterwards
+      void setConditions(LinkConditions conditions);
+
+      /**
+       * Send a message over the link
+       * @param size - size of the message in bytes
+       * @param deliver - function delivering the message, must not throw
+       * @return false if the message is lost
+       */
+      bool send(size_t size, std::function<void()> deliver);
+
+      /// @return number of messages lost by the link
+      size_t lost() const;
+
+      /// @return number of messages delivered by the link
+      size_t delivered() const;
+
+     private:
+      using Clock = std::chrono::steady_clock;
+
+      void work();
+
+      std::mutex mutex_;
+      std::condition_variable cv_;
+      LinkConditions conditions_;
+      std::mt19937 random_;
+      /// when the messages sent before are transmitted
+      Clock::time_point free_at_;
+      /// messages in flight by the delivery time, equal times keep the order
+      std::multimap<Clock::time_point, std::function<void()>> in_flight_;
+      std::atomic<size_t> lost_{0};
+      std::atomic<size_t> delivered_{0};
+      bool stop_ = false;
+      std::thread thread_;
+    };
+
+  }  // namespace fake_peer
+}  // namespace integration_framework
+
+#endif /* FAKE_PEER_LINK_EMULATOR_HPP_ */
@@ -14,8 +14,25 @@ namespace integration_framework {
 
     void YacNetworkNotifier::onState(YacNetworkNotifier::StateMessage state) {
       auto state_ptr = std::make_shared<const StateMessage>(std::move(state));
-      std::lock_guard<std::mutex> guard(votes_subject_mutex_);
-      votes_subject_.get_subscriber().on_next(state_ptr);
+      auto publish = [this, state_ptr] {
+        std::lock_guard<std::mutex> guard(votes_subject_mutex_);
+        votes_subject_.get_subscriber().on_next(state_ptr);
+      };
+      std::shared_ptr<LinkEmulator> link;
+      {
+        std::lock_guard<std::mutex> guard(link_mutex_);
+        link = link_;
+      }
+      if (link) {
+        link->send(state_ptr->size() * kVoteSizeBytes, std::move(publish));
+      } else {
+        publish();
+      }
+    }
+
+    void YacNetworkNotifier::setLink(std::shared_ptr<LinkEmulator> link) {
+      std::lock_guard<std::mutex> guard(link_mutex_);
+      link_ = std::move(link);
     }
 
     rxcpp::observable<std::shared_ptr<const YacMessage>>
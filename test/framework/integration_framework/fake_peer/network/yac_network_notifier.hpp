@@ -11,6 +11,7 @@
 #include <mutex>
 
 #include <rxcpp/rx.hpp>
+#include "framework/integration_framework/fake_peer/network/link_emulator.hpp"
 #include "framework/integration_framework/fake_peer/types.hpp"
 
 namespace integration_framework {
@@ -23,12 +24,21 @@ namespace integration_framework {
 
       void onState(StateMessage state) override;
 
+      /**
+       * Deliver the states received afterwards over the link
+       * @param link - emulated link from the real peer, nullptr delivers
+       * the states immediately
+       */
+      void setLink(std::shared_ptr<LinkEmulator> link);
+
       rxcpp::observable<std::shared_ptr<const YacMessage>> getObservable();
 
      private:
       rxcpp::subjects::subject<std::shared_ptr<const YacMessage>>
           votes_subject_;
       std::mutex votes_subject_mutex_;
+      std::shared_ptr<LinkEmulator> link_;
+      std::mutex link_mutex_;
     };
 
   }  // namespace fake_peer
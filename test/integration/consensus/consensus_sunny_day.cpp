@@ -107,8 +107,9 @@ class ConsensusSunnyDayTest : public ::testing::Test {
         },
         getTestLogger("YacNetwork"));
     crypto = std::make_shared<FixedCryptoProvider>(my_pub_key);
-    timer = std::make_shared<TimerImpl>(std::chrono::milliseconds(delay),
-                                        rxcpp::observe_on_new_thread());
+    timer = std::make_shared<TimerImpl>(
+        std::chrono::milliseconds(delay),
+        std::make_shared<iroha::TimerWheel>());
     auto order = ClusterOrdering::create(default_peers);
     ASSERT_TRUE(order);
 
@@ -79,6 +79,9 @@ namespace iroha {
 
         pool_wrapper_ =
             std::move(boost::get<expected::Value<PoolWrapper>>(pool).value);
+        if (not prepared_transactions_) {
+          pool_wrapper_.enable_prepared_transactions_ = false;
+        }
 
         StorageImpl::create(block_store_path,
                             std::move(options),
@@ -135,6 +138,10 @@ namespace iroha {
 
       static const int pool_size_ = 10;
 
+      /// use prepared transactions of the database if it supports them,
+      /// otherwise the storage keeps prepared state in an open transaction
+      static bool prepared_transactions_;
+
       // generate random valid dbname
       static std::string dbname_;
 
@@ -158,23 +165,29 @@ CREATE TABLE IF NOT EXISTS domain (
     PRIMARY KEY (domain_id)
 );
 CREATE TABLE IF NOT EXISTS signatory (
-    public_key varchar NOT NULL,
+    public_key bytea NOT NULL,
     PRIMARY KEY (public_key)
 );
 CREATE TABLE IF NOT EXISTS account (
     account_id character varying(288),
     domain_id character varying(255) NOT NULL REFERENCES domain,
     quorum int NOT NULL,
-    data JSONB,
     PRIMARY KEY (account_id)
 );
+CREATE TABLE IF NOT EXISTS account_has_detail (
+    account_id character varying(288) NOT NULL REFERENCES account,
+    writer character varying(288) NOT NULL,
+    key character varying(64) NOT NULL,
+    value jsonb NOT NULL,
+    PRIMARY KEY (account_id, writer, key)
+);
 CREATE TABLE IF NOT EXISTS account_has_signatory (
     account_id character varying(288) NOT NULL REFERENCES account,
-    public_key varchar NOT NULL REFERENCES signatory,
+    public_key bytea NOT NULL REFERENCES signatory,
     PRIMARY KEY (account_id, public_key)
 );
 CREATE TABLE IF NOT EXISTS peer (
-    public_key varchar NOT NULL,
+    public_key bytea NOT NULL,
     address character varying(261) NOT NULL UNIQUE,
     PRIMARY KEY (public_key)
 );
@@ -208,19 +221,19 @@ CREATE TABLE IF NOT EXISTS account_has_grantable_permissions (
     PRIMARY KEY (permittee_account_id, account_id, permission_id)
 );
 CREATE TABLE IF NOT EXISTS position_by_hash (
-    hash varchar,
+    hash bytea,
     height bigint,
     index bigint
 );
 
 CREATE TABLE IF NOT EXISTS tx_status_by_hash (
-    hash varchar,
+    hash bytea,
     status boolean
 );
 CREATE INDEX IF NOT EXISTS tx_status_by_hash_hash_index ON tx_status_by_hash USING hash (hash);
 
 CREATE TABLE IF NOT EXISTS tx_position_by_creator (
-    creator_id text,
+    creator_id integer,
     height bigint,
     index bigint
 );
@@ -248,6 +261,7 @@ CREATE TABLE IF NOT EXISTS index_by_id_height_asset (
 
     iroha::ametsuchi::PoolWrapper AmetsuchiTest::pool_wrapper_ =
         iroha::ametsuchi::PoolWrapper(nullptr, nullptr, false);
+    bool AmetsuchiTest::prepared_transactions_ = true;
 
     std::shared_ptr<shared_model::interface::PermissionToString>
         AmetsuchiTest::perm_converter_ = nullptr;
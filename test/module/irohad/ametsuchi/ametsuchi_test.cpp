@@ -103,7 +103,7 @@ TEST_F(AmetsuchiTest, GetBlocksCompletedWhenCalled) {
   apply(storage, block);
 
   ASSERT_EQ(*boost::get<iroha::expected::Value<
-                 std::unique_ptr<shared_model::interface::Block>>>(
+                 std::shared_ptr<const shared_model::interface::Block>>>(
                  blocks->getBlock(1))
                  .value,
             *block);
@@ -158,7 +158,7 @@ TEST_F(AmetsuchiTest, SampleTest) {
   for (size_t i = 0; i < hashes.size(); i++) {
     EXPECT_EQ(*(hashes.begin() + i),
               boost::get<iroha::expected::Value<
-                  std::unique_ptr<shared_model::interface::Block>>>(
+                  std::shared_ptr<const shared_model::interface::Block>>>(
                   blocks->getBlock(i + 1))
                   .value->hash());
   }
@@ -184,6 +184,29 @@ TEST_F(AmetsuchiTest, PeerTest) {
   ASSERT_EQ(peers->at(0)->pubkey(), fake_pubkey);
 }
 
+/**
+ * @given storage with a committed block adding a peer
+ * @when peers are reset outside of blocks
+ * @then peer queries return the peers of the last change
+ */
+TEST_F(AmetsuchiTest, PeerQueryFollowsLedgerPeers) {
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(TestTransactionBuilder()
+                    .addPeer("192.168.9.1:50051", fake_pubkey)
+                    .build());
+  apply(storage, createBlock(txs, 1, fake_hash));
+
+  auto peers = storage->createPeerQuery().value()->getLedgerPeers();
+  ASSERT_TRUE(peers);
+  ASSERT_EQ(peers->size(), 1);
+  ASSERT_EQ(peers->at(0)->address(), "192.168.9.1:50051");
+
+  storage->resetPeers();
+  peers = storage->createPeerQuery().value()->getLedgerPeers();
+  ASSERT_TRUE(peers);
+  ASSERT_TRUE(peers->empty());
+}
+
 TEST_F(AmetsuchiTest, AddSignatoryTest) {
   ASSERT_TRUE(storage);
   auto wsv = storage->getWsvQuery();
@@ -462,7 +485,8 @@ TEST_F(AmetsuchiTest, TestRestoreWSV) {
   EXPECT_FALSE(res);
 
   // recover storage and check it is recovered
-  WsvRestorerImpl wsvRestorer;
+  WsvRestorerImpl wsvRestorer(WsvRestoreOptions{},
+                              getTestLogger("WsvRestorer"));
   wsvRestorer.restoreWsv(*storage).match(
       [](const auto &) {},
       [&](const auto &error) { FAIL() << "Failed to recover WSV"; });
@@ -471,6 +495,217 @@ TEST_F(AmetsuchiTest, TestRestoreWSV) {
   EXPECT_TRUE(res);
 }
 
+/**
+ * @given WSV with applied genesis block
+ * @when WSV is restored incrementally
+ * @then nothing is reapplied while WSV top block is in the block store,
+ * otherwise WSV is rebuilt
+ */
+TEST_F(AmetsuchiTest, TestIncrementalRestoreWSV) {
+  std::vector<shared_model::proto::Transaction> genesis_tx;
+  genesis_tx.push_back(
+      shared_model::proto::TransactionBuilder()
+          .creatorAccountId("admin@test")
+          .createdTime(iroha::time::now())
+          .quorum(1)
+          .createRole("admin", {Role::kCreateDomain})
+          .createDomain("test", "admin")
+          .build()
+          .signAndAddSignature(
+              shared_model::crypto::DefaultCryptoAlgorithmType::
+                  generateKeypair())
+          .finish());
+  auto genesis_block = createBlock(genesis_tx);
+  apply(storage, genesis_block);
+
+  WsvRestoreOptions options;
+  options.incremental = true;
+  WsvRestorerImpl wsvRestorer(options, getTestLogger("WsvRestorer"));
+
+  // WSV is up to date, so changes made to it are kept
+  *sql << "DELETE FROM domain";
+  wsvRestorer.restoreWsv(*storage).match(
+      [](const auto &ledger_state) {
+        EXPECT_EQ(ledger_state.value->top_block_info.height, 1);
+      },
+      [&](const auto &error) { FAIL() << "Failed to recover WSV"; });
+  EXPECT_FALSE(sql_query->getDomain("test"));
+
+  // WSV without top block info is rebuilt
+  *sql << "DELETE FROM top_block_info";
+  wsvRestorer.restoreWsv(*storage).match(
+      [](const auto &) {},
+      [&](const auto &error) { FAIL() << "Failed to recover WSV"; });
+  EXPECT_TRUE(sql_query->getDomain("test"));
+}
+
+/**
+ * @given WSV with applied genesis block
+ * @when WSV is rebuilt in bulk mode
+ * @then WSV is restored and the foreign keys are enforced again
+ */
+TEST_F(AmetsuchiTest, TestBulkRestoreWSV) {
+  std::vector<shared_model::proto::Transaction> genesis_tx;
+  genesis_tx.push_back(
+      shared_model::proto::TransactionBuilder()
+          .creatorAccountId("admin@test")
+          .createdTime(iroha::time::now())
+          .quorum(1)
+          .createRole("admin", {Role::kCreateDomain})
+          .createDomain("test", "admin")
+          .build()
+          .signAndAddSignature(
+              shared_model::crypto::DefaultCryptoAlgorithmType::
+                  generateKeypair())
+          .finish());
+  auto genesis_block = createBlock(genesis_tx);
+  apply(storage, genesis_block);
+
+  WsvRestoreOptions options;
+  options.bulk = true;
+  WsvRestorerImpl wsvRestorer(options, getTestLogger("WsvRestorer"));
+  wsvRestorer.restoreWsv(*storage).match(
+      [](const auto &ledger_state) {
+        EXPECT_EQ(ledger_state.value->top_block_info.height, 1);
+      },
+      [&](const auto &error) { FAIL() << "Failed to recover WSV"; });
+  EXPECT_TRUE(sql_query->getDomain("test"));
+
+  EXPECT_THROW(*sql << "INSERT INTO domain VALUES ('other', 'missing')",
+               std::exception);
+}
+
+/**
+ * @given storage with applied genesis block
+ * @when WSV snapshot is exported and imported back into changed WSV
+ * @then WSV and ledger state correspond to the snapshot, and a corrupted
+ * chunk is rejected
+ */
+TEST_F(AmetsuchiTest, WsvSnapshotExportImport) {
+  std::vector<shared_model::proto::Transaction> genesis_tx;
+  genesis_tx.push_back(
+      shared_model::proto::TransactionBuilder()
+          .creatorAccountId("admin@test")
+          .createdTime(iroha::time::now())
+          .quorum(1)
+          .createRole("admin", {Role::kCreateDomain})
+          .createDomain("test", "admin")
+          .build()
+          .signAndAddSignature(
+              shared_model::crypto::DefaultCryptoAlgorithmType::
+                  generateKeypair())
+          .finish());
+  auto genesis_block = createBlock(genesis_tx);
+  apply(storage, genesis_block);
+
+  auto exporter = storage->createWsvSnapshotExporter();
+  ASSERT_TRUE(exporter);
+  std::vector<WsvSnapshotChunk> chunks;
+  auto top_block = val((*exporter)->exportSnapshot([&](const auto &chunk) {
+    chunks.push_back(chunk);
+    return true;
+  }));
+  ASSERT_TRUE(top_block);
+  ASSERT_EQ(top_block->value->hash(), genesis_block->hash());
+  ASSERT_FALSE(chunks.empty());
+
+  *sql << "DELETE FROM domain";
+
+  {
+    auto importer = storage->createWsvSnapshotImporter();
+    ASSERT_TRUE(importer);
+    auto corrupted = chunks.front();
+    corrupted.rows.replace(corrupted.rows.size() - 1, 1, " ]");
+    ASSERT_TRUE(err((*importer)->apply(corrupted)));
+  }
+
+  auto importer = storage->createWsvSnapshotImporter();
+  ASSERT_TRUE(importer);
+  for (const auto &chunk : chunks) {
+    ASSERT_FALSE(err((*importer)->apply(chunk)));
+  }
+  auto ledger_state = val((*importer)->commit(std::move(top_block->value)));
+  ASSERT_TRUE(ledger_state);
+  ASSERT_EQ(ledger_state->value->top_block_info.height, 1);
+  ASSERT_TRUE(sql_query->getDomain("test"));
+  ASSERT_EQ(storage->getBlockQuery()->getTopBlockHeight(), 1);
+}
+
+/// @return true if the history tables are partitioned by height, which
+/// needs Postgres 11 or later
+bool historyPartitioned(soci::session &sql) {
+  int partitioned = 0;
+  sql << "SELECT count(*) FROM pg_class "
+         "WHERE oid = 'position_by_hash'::regclass AND relkind = 'p'",
+      soci::into(partitioned);
+  return partitioned != 0;
+}
+
+/**
+ * @given storage with partitioned history tables
+ * @when a block is committed
+ * @then its transactions are indexed in the partition of its height
+ */
+TEST_F(AmetsuchiTest, HistoryIndexedInHeightPartition) {
+  if (not historyPartitioned(*sql)) {
+    return;
+  }
+  std::vector<shared_model::proto::Transaction> genesis_tx;
+  genesis_tx.push_back(
+      shared_model::proto::TransactionBuilder()
+          .creatorAccountId("admin@test")
+          .createdTime(iroha::time::now())
+          .quorum(1)
+          .createRole("admin", {Role::kCreateDomain})
+          .createDomain("test", "admin")
+          .build()
+          .signAndAddSignature(
+              shared_model::crypto::DefaultCryptoAlgorithmType::
+                  generateKeypair())
+          .finish());
+  apply(storage, createBlock(genesis_tx));
+
+  int rows = 0;
+  *sql << "SELECT count(*) FROM position_by_hash_0 WHERE height = 1",
+      soci::into(rows);
+  EXPECT_EQ(rows, 1);
+  *sql << "SELECT count(*) FROM tx_position_by_creator_0 WHERE height = 1",
+      soci::into(rows);
+  EXPECT_EQ(rows, 1);
+}
+
+/**
+ * @given storage with partitioned history tables
+ * @when partitions are created for a height of a later range
+ * @then the partitions of its range and the next one exist @and rows of that
+ * height are stored in them and found through the parent table
+ */
+TEST_F(AmetsuchiTest, HistoryPartitionsCreatedForHeight) {
+  if (not historyPartitioned(*sql)) {
+    return;
+  }
+  *sql << "SELECT create_height_partitions(250000)";
+
+  int partitions = 0;
+  *sql << "SELECT count(*) FROM pg_class WHERE relname IN "
+          "('position_by_hash_2', 'position_by_hash_3', "
+          "'tx_position_by_creator_2', 'tx_position_by_creator_3', "
+          "'position_by_account_asset_2', 'position_by_account_asset_3')",
+      soci::into(partitions);
+  EXPECT_EQ(partitions, 6);
+
+  *sql << "INSERT INTO position_by_hash(hash, height, index) "
+          "VALUES ('\\x01', 250000, 0)";
+  int rows = 0;
+  *sql << "SELECT count(*) FROM position_by_hash_2 WHERE height = 250000",
+      soci::into(rows);
+  EXPECT_EQ(rows, 1);
+  *sql << "SELECT count(*) FROM position_by_hash WHERE height = 250000",
+      soci::into(rows);
+  EXPECT_EQ(rows, 1);
+  *sql << "DELETE FROM position_by_hash WHERE height = 250000";
+}
+
 /**
  * @given created storage
  *        @and a subscribed observer on on_commit() event
@@ -698,3 +933,93 @@ TEST_F(PreparedBlockTest, TemporaryWsvUnlocks) {
   ASSERT_TRUE(val(result));
   storage->prepareBlock(std::move(temp_wsv));
 }
+
+/**
+ * Prepared block tests with prepared transactions of the database disabled,
+ * when the storage keeps the prepared state in an open transaction of the
+ * temporary WSV
+ */
+class KeptStateBlockTest : public PreparedBlockTest {
+ public:
+  static void SetUpTestCase() {
+    prepared_transactions_ = false;
+    PreparedBlockTest::SetUpTestCase();
+  }
+
+  static void TearDownTestCase() {
+    PreparedBlockTest::TearDownTestCase();
+    prepared_transactions_ = true;
+  }
+};
+
+/**
+ * @given Storage with kept state
+ * @when the block of the kept state is committed
+ * @then state of the ledger is changed @and the block is stored
+ */
+TEST_F(KeptStateBlockTest, CommitKeptState) {
+  auto block = createBlock({*initial_tx}, 2);
+
+  auto result = temp_wsv->apply(*initial_tx);
+  ASSERT_TRUE(val(result));
+  storage->prepareBlock(std::move(temp_wsv));
+
+  // balance remains unchanged until the commit
+  validateAccountAsset(sql_query, "admin@test", "coin#test", base_balance);
+
+  auto commited = storage->commitPrepared(block);
+  ASSERT_TRUE(val(commited))
+      << "Error in commitPrepared: " << err(commited)->error;
+
+  validateAccountAsset(sql_query,
+                       "admin@test",
+                       "coin#test",
+                       shared_model::interface::Amount("10.00"));
+  EXPECT_EQ(val(commited)->value->top_block_info.height, 2);
+}
+
+/**
+ * @given Storage with kept state
+ * @when a different block is applied
+ * @then the kept state is rolled back @and commitPrepared fails
+ */
+TEST_F(KeptStateBlockTest, KeptStateRolledBackByOtherBlock) {
+  auto other_tx = createAddAsset("10.00");
+  auto block = createBlock({other_tx}, 2);
+
+  auto result = temp_wsv->apply(*initial_tx);
+  ASSERT_TRUE(val(result));
+  storage->prepareBlock(std::move(temp_wsv));
+
+  apply(storage, block);
+
+  EXPECT_TRUE(err(storage->commitPrepared(block)));
+
+  shared_model::interface::Amount resultingBalance{"15.00"};
+  validateAccountAsset(sql_query, "admin@test", "coin#test", resultingBalance);
+}
+
+/**
+ * @given Storage with kept state dropped by a new temporary WSV
+ * @when commitPrepared fails @and the block is applied normally
+ * @then state of the ledger is changed by the block only once
+ */
+TEST_F(KeptStateBlockTest, FallbackToApply) {
+  auto block = createBlock({*initial_tx}, 2);
+
+  auto result = temp_wsv->apply(*initial_tx);
+  ASSERT_TRUE(val(result));
+  storage->prepareBlock(std::move(temp_wsv));
+
+  // validation of the next proposal drops the kept state
+  temp_wsv = std::move(val(storage->createTemporaryWsv())->value);
+  temp_wsv.reset();
+
+  ASSERT_TRUE(err(storage->commitPrepared(block)));
+  apply(storage, block);
+
+  validateAccountAsset(sql_query,
+                       "admin@test",
+                       "coin#test",
+                       shared_model::interface::Amount("10.00"));
+}
@@ -0,0 +1,113 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/archived_key_value_storage.hpp"
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include "ametsuchi/impl/flat_file/flat_file.hpp"
+#include "framework/test_logger.hpp"
+
+using namespace iroha::ametsuchi;
+namespace fs = boost::filesystem;
+
+class ArchivedKeyValueStorageTest : public ::testing::Test {
+ protected:
+  void TearDown() override {
+    fs::remove_all(local_path);
+    fs::remove_all(archive_path);
+  }
+
+  /// creates the archived storage, local and archive point to its parts
+  std::unique_ptr<ArchivedKeyValueStorage> createStorage(
+      KeyValueStorage::Identifier retained) {
+    auto local_file = FlatFile::create(local_path, log_);
+    auto archive_file = FlatFile::create(archive_path, log_);
+    EXPECT_TRUE(local_file);
+    EXPECT_TRUE(archive_file);
+    local = local_file->get();
+    archive = archive_file->get();
+    return std::make_unique<ArchivedKeyValueStorage>(
+        std::move(*local_file), std::move(*archive_file), retained, log_);
+  }
+
+  /// returns a distinct blob for every id
+  static KeyValueStorage::Bytes blob(KeyValueStorage::Identifier id) {
+    return KeyValueStorage::Bytes(10, static_cast<uint8_t>(id));
+  }
+
+  std::string local_path =
+      (fs::temp_directory_path() / fs::unique_path()).string();
+  std::string archive_path =
+      (fs::temp_directory_path() / fs::unique_path()).string();
+  FlatFile *local;
+  FlatFile *archive;
+  logger::LoggerPtr log_ = getTestLogger("ArchivedKeyValueStorage");
+};
+
+/**
+ * @given storage retaining 2 entries
+ * @when 5 entries are added
+ * @then the last 2 entries are kept locally, the others are moved to the
+ * archive, and all the entries are readable
+ */
+TEST_F(ArchivedKeyValueStorageTest, OldEntriesAreArchived) {
+  auto storage = createStorage(2);
+  for (auto id = 1u; id <= 5; ++id) {
+    ASSERT_TRUE(storage->add(id, blob(id)));
+  }
+
+  ASSERT_EQ(local->blockIdentifiers(), FlatFile::BlockIdCollectionType({4, 5}));
+  ASSERT_EQ(archive->blockIdentifiers(),
+            FlatFile::BlockIdCollectionType({1, 2, 3}));
+  for (auto id = 1u; id <= 5; ++id) {
+    ASSERT_EQ(*storage->get(id), blob(id));
+    auto view = storage->getView(id);
+    ASSERT_TRUE(view);
+    ASSERT_EQ(KeyValueStorage::Bytes(view->data(), view->data() + view->size()),
+              blob(id));
+  }
+  ASSERT_EQ(storage->last_id(), 5);
+}
+
+/**
+ * @given storage of entries added without archiving
+ * @when archiving is enabled and another entry is added
+ * @then the entries which are not retained are moved to the archive
+ */
+TEST_F(ArchivedKeyValueStorageTest, ExistingEntriesAreArchived) {
+  {
+    auto local_file = FlatFile::create(local_path, log_);
+    ASSERT_TRUE(local_file);
+    for (auto id = 1u; id <= 4; ++id) {
+      ASSERT_TRUE((*local_file)->add(id, blob(id)));
+    }
+  }
+
+  auto storage = createStorage(1);
+  ASSERT_TRUE(storage->add(5, blob(5)));
+  ASSERT_EQ(local->blockIdentifiers(), FlatFile::BlockIdCollectionType({5}));
+  ASSERT_EQ(archive->last_id(), 4);
+  ASSERT_EQ(*storage->get(1), blob(1));
+}
+
+/**
+ * @given storage with archived entries
+ * @when it is dropped
+ * @then both local and archived entries are removed
+ */
+TEST_F(ArchivedKeyValueStorageTest, DropAllDropsArchive) {
+  auto storage = createStorage(1);
+  for (auto id = 1u; id <= 3; ++id) {
+    ASSERT_TRUE(storage->add(id, blob(id)));
+  }
+  storage->dropAll();
+  ASSERT_EQ(storage->last_id(), 0);
+  ASSERT_FALSE(storage->get(1));
+  ASSERT_TRUE(fs::is_empty(archive_path));
+
+  ASSERT_TRUE(storage->add(1, blob(1)));
+  ASSERT_EQ(*storage->get(1), blob(1));
+}
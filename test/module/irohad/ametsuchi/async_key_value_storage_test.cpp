@@ -0,0 +1,135 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/async_key_value_storage.hpp"
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include "ametsuchi/impl/flat_file/flat_file.hpp"
+#include "framework/test_logger.hpp"
+#include "logger/logger.hpp"
+
+using namespace iroha::ametsuchi;
+namespace fs = boost::filesystem;
+
+class AsyncKeyValueStorageTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    fs::create_directory(block_store_path);
+  }
+  void TearDown() override {
+    fs::remove_all(block_store_path);
+  }
+
+  std::unique_ptr<AsyncKeyValueStorage> createStorage() {
+    auto flat_file =
+        FlatFile::create(block_store_path, getTestLogger("FlatFile"));
+    EXPECT_TRUE(flat_file);
+    return std::make_unique<AsyncKeyValueStorage>(
+        std::move(*flat_file), getTestLogger("AsyncKeyValueStorage"));
+  }
+
+  static KeyValueStorage::Bytes blob(KeyValueStorage::Identifier id) {
+    return KeyValueStorage::Bytes(100, static_cast<uint8_t>(id));
+  }
+
+  std::string block_store_path =
+      (fs::temp_directory_path() / fs::unique_path()).string();
+};
+
+/**
+ * @given async storage
+ * @when entries are added
+ * @then they are readable immediately and written after flush
+ */
+TEST_F(AsyncKeyValueStorageTest, AddGetFlush) {
+  auto storage = createStorage();
+  for (auto id = 1u; id <= 10; ++id) {
+    ASSERT_TRUE(storage->add(id, blob(id)));
+    ASSERT_EQ(*storage->get(id), blob(id));
+    auto view = storage->getView(id);
+    ASSERT_TRUE(view);
+    ASSERT_EQ(KeyValueStorage::Bytes(view->data(), view->data() + view->size()),
+              blob(id));
+  }
+  ASSERT_EQ(storage->last_id(), 10);
+
+  ASSERT_TRUE(storage->flush());
+  ASSERT_EQ(storage->durableId(), 10);
+}
+
+/**
+ * @given async storage with added entries
+ * @when the storage is destroyed and another one is created on the same
+ * directory
+ * @then all entries were written
+ */
+TEST_F(AsyncKeyValueStorageTest, WrittenOnDestruction) {
+  {
+    auto storage = createStorage();
+    for (auto id = 1u; id <= 10; ++id) {
+      ASSERT_TRUE(storage->add(id, blob(id)));
+    }
+  }
+  auto storage = createStorage();
+  ASSERT_EQ(storage->durableId(), 10);
+  for (auto id = 1u; id <= 10; ++id) {
+    ASSERT_EQ(*storage->get(id), blob(id));
+  }
+}
+
+/**
+ * @given async storage with an entry
+ * @when entry with the same id is added
+ * @then add fails
+ */
+TEST_F(AsyncKeyValueStorageTest, AddExistingId) {
+  auto storage = createStorage();
+  ASSERT_TRUE(storage->add(1, blob(1)));
+  ASSERT_FALSE(storage->add(1, blob(2)));
+  ASSERT_TRUE(storage->flush());
+  ASSERT_FALSE(storage->add(1, blob(2)));
+  ASSERT_EQ(*storage->get(1), blob(1));
+}
+
+/**
+ * @given async storage which directory was removed
+ * @when entry is added
+ * @then the write fails, entry is still readable and next entries are
+ * rejected until the storage is dropped
+ */
+TEST_F(AsyncKeyValueStorageTest, WriteFailure) {
+  auto storage = createStorage();
+  fs::remove_all(block_store_path);
+  ASSERT_TRUE(storage->add(1, blob(1)));
+  ASSERT_FALSE(storage->flush());
+  ASSERT_EQ(*storage->get(1), blob(1));
+  ASSERT_FALSE(storage->add(2, blob(2)));
+
+  fs::create_directory(block_store_path);
+  storage->dropAll();
+  ASSERT_FALSE(storage->get(1));
+  ASSERT_TRUE(storage->add(2, blob(2)));
+  ASSERT_TRUE(storage->flush());
+}
+
+/**
+ * @given entries written by a previous async storage on the same directory
+ * @when an entry with one of their ids is added
+ * @then add fails @and the written entry is kept
+ */
+TEST_F(AsyncKeyValueStorageTest, AddWrittenId) {
+  {
+    auto storage = createStorage();
+    ASSERT_TRUE(storage->add(1, blob(1)));
+    ASSERT_TRUE(storage->add(2, blob(2)));
+  }
+  auto storage = createStorage();
+  ASSERT_FALSE(storage->add(1, blob(3)));
+  ASSERT_EQ(storage->last_id(), 2);
+  ASSERT_TRUE(storage->add(3, blob(3)));
+  ASSERT_TRUE(storage->flush());
+  ASSERT_EQ(*storage->get(1), blob(1));
+}
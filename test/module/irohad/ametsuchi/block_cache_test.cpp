@@ -0,0 +1,117 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/block_cache.hpp"
+
+#include <gtest/gtest.h>
+#include "module/shared_model/interface_mocks.hpp"
+
+using namespace iroha::ametsuchi;
+using testing::Return;
+
+class BlockCacheTest : public ::testing::Test {
+ protected:
+  static std::shared_ptr<MockBlock> makeBlock(
+      shared_model::interface::types::HeightType height) {
+    auto block = std::make_shared<MockBlock>();
+    ON_CALL(*block, height()).WillByDefault(Return(height));
+    return block;
+  }
+
+  /// cache fits 3 blocks of kBlockSize
+  static constexpr size_t kBlockSize = 100;
+  BlockCache cache{3 * kBlockSize};
+};
+
+constexpr size_t BlockCacheTest::kBlockSize;
+
+/**
+ * @given empty cache
+ * @when block is inserted and looked up
+ * @then the same block is returned and counters are updated
+ */
+TEST_F(BlockCacheTest, InsertAndFind) {
+  auto block = makeBlock(1);
+  cache.insert(block, kBlockSize);
+
+  ASSERT_EQ(cache.find(1), block);
+  ASSERT_EQ(cache.find(2), nullptr);
+  ASSERT_EQ(cache.hits(), 1);
+  ASSERT_EQ(cache.misses(), 1);
+  ASSERT_EQ(cache.count(), 1);
+  ASSERT_EQ(cache.weight(), kBlockSize);
+}
+
+/**
+ * @given full cache
+ * @when the oldest block is accessed and a new block is inserted
+ * @then the least recently used block is evicted
+ */
+TEST_F(BlockCacheTest, EvictsLeastRecentlyUsed) {
+  for (auto height = 1u; height <= 3; ++height) {
+    cache.insert(makeBlock(height), kBlockSize);
+  }
+  ASSERT_TRUE(cache.find(1));
+
+  cache.insert(makeBlock(4), kBlockSize);
+
+  ASSERT_TRUE(cache.find(1));
+  ASSERT_FALSE(cache.find(2));
+  ASSERT_TRUE(cache.find(3));
+  ASSERT_TRUE(cache.find(4));
+  ASSERT_EQ(cache.weight(), 3 * kBlockSize);
+}
+
+/**
+ * @given cache with a block
+ * @when block with the same height is inserted
+ * @then the block is replaced and weight is not accumulated
+ */
+TEST_F(BlockCacheTest, ReplaceSameHeight) {
+  cache.insert(makeBlock(1), kBlockSize);
+  auto block = makeBlock(1);
+  cache.insert(block, 2 * kBlockSize);
+
+  ASSERT_EQ(cache.find(1), block);
+  ASSERT_EQ(cache.count(), 1);
+  ASSERT_EQ(cache.weight(), 2 * kBlockSize);
+}
+
+/**
+ * @given cache
+ * @when block larger than capacity is inserted
+ * @then it is not cached and other blocks are kept
+ */
+TEST_F(BlockCacheTest, OversizedBlock) {
+  cache.insert(makeBlock(1), kBlockSize);
+  cache.insert(makeBlock(2), 4 * kBlockSize);
+
+  ASSERT_TRUE(cache.find(1));
+  ASSERT_FALSE(cache.find(2));
+}
+
+/**
+ * @given cache with zero capacity
+ * @when block is inserted
+ * @then it is not cached
+ */
+TEST_F(BlockCacheTest, Disabled) {
+  BlockCache disabled{0};
+  disabled.insert(makeBlock(1), kBlockSize);
+  ASSERT_FALSE(disabled.find(1));
+  ASSERT_EQ(disabled.count(), 0);
+}
+
+/**
+ * @given cache with blocks
+ * @when it is cleared
+ * @then no blocks are found
+ */
+TEST_F(BlockCacheTest, Clear) {
+  cache.insert(makeBlock(1), kBlockSize);
+  cache.clear();
+  ASSERT_FALSE(cache.find(1));
+  ASSERT_EQ(cache.weight(), 0);
+}
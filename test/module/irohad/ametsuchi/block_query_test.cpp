@@ -301,3 +301,64 @@ TEST_F(BlockQueryTest, GetTopBlockFail) {
   ASSERT_EQ(top_block_error.value().code,
             BlockQuery::GetBlockError::Code::kNoBlock);
 }
+
+/**
+ * @given block query with a block cache containing a block
+ * @when getBlock is invoked for the height of the cached block
+ * @then the cached block is shared without reading the block store
+ */
+TEST_F(BlockQueryTest, GetBlockFromCache) {
+  auto cache = std::make_shared<BlockCache>(1024 * 1024);
+  auto block = std::make_shared<const shared_model::proto::Block>(
+      TestBlockBuilder()
+          .height(3)
+          .prevHash(shared_model::crypto::Hash(zero_string))
+          .build());
+  cache->insert(block, 1);
+  PostgresBlockQuery cached_blocks(
+      *sql,
+      *mock_file,
+      std::make_shared<shared_model::proto::ProtoBlockJsonConverter>(),
+      getTestLogger("PostgresBlockQueryCached"),
+      cache);
+  EXPECT_CALL(*mock_file, get(3)).Times(0);
+
+  auto result = framework::expected::val(cached_blocks.getBlock(3));
+  ASSERT_TRUE(result);
+  ASSERT_EQ(result.value().value, block);
+  ASSERT_EQ(cache->hits(), 1);
+}
+
+/**
+ * @given block store with blocks stored as JSON
+ * @when getSerializedBlock is invoked
+ * @then nothing is returned, so the block has to be parsed by getBlock
+ */
+TEST_F(BlockQueryTest, JsonBlockIsNotServedSerialized) {
+  ASSERT_FALSE(blocks->getSerializedBlock(1));
+  ASSERT_FALSE(blocks->getSerializedBlock(1000));
+}
+
+/**
+ * @given block store with a block stored as binary protobuf
+ * @when getSerializedBlock is invoked for its height
+ * @then the stored bytes are returned and the block is also read by getBlock
+ */
+TEST_F(BlockQueryTest, BinaryBlockIsServedSerialized) {
+  shared_model::proto::ProtoBlockJsonConverter binary_converter(true);
+  auto block = TestBlockBuilder()
+                   .height(3)
+                   .prevHash(shared_model::crypto::Hash(zero_string))
+                   .build();
+  auto serialized =
+      framework::expected::val(binary_converter.serialize(block));
+  ASSERT_TRUE(serialized);
+  file->add(3, iroha::stringToBytes(serialized->value));
+
+  auto stored = blocks->getSerializedBlock(3);
+  ASSERT_TRUE(stored);
+  ASSERT_EQ(*stored, serialized->value);
+  auto result = framework::expected::val(blocks->getBlock(3));
+  ASSERT_TRUE(result);
+  ASSERT_EQ(result->value->hash(), block.hash());
+}
@@ -0,0 +1,149 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/block_store_verifier.hpp"
+
+#include <gtest/gtest.h>
+#include <boost/algorithm/string/split.hpp>
+#include <boost/filesystem.hpp>
+#include "ametsuchi/impl/flat_file/flat_file.hpp"
+#include "common/byteutils.hpp"
+#include "common/thread_pool.hpp"
+#include "framework/test_logger.hpp"
+#include "module/shared_model/interface_mocks.hpp"
+
+using namespace iroha::ametsuchi;
+namespace fs = boost::filesystem;
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+using ::testing::ReturnRefOfCopy;
+
+/**
+ * Stored entries are "height hash prev_hash" strings, which the converter
+ * turns into mock blocks
+ */
+class BlockStoreVerifierTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    fs::create_directory(block_store_path);
+    auto flat_file =
+        FlatFile::create(block_store_path, getTestLogger("FlatFile"));
+    ASSERT_TRUE(flat_file);
+    store = std::move(*flat_file);
+
+    ON_CALL(converter, deserialize(_))
+        .WillByDefault(Invoke([](const std::string &json) -> DeserializeResult {
+          std::vector<std::string> fields;
+          boost::split(fields, json, [](char c) { return c == ' '; });
+          if (fields.size() != 3) {
+            return iroha::expected::makeError(std::string("malformed"));
+          }
+          auto block = std::make_unique<NiceMock<MockBlock>>();
+          ON_CALL(*block, height())
+              .WillByDefault(Return(std::stoul(fields[0])));
+          ON_CALL(*block, hash())
+              .WillByDefault(ReturnRefOfCopy(
+                  shared_model::interface::types::HashType(fields[1])));
+          ON_CALL(*block, prevHash())
+              .WillByDefault(ReturnRefOfCopy(
+                  shared_model::interface::types::HashType(fields[2])));
+          return iroha::expected::makeValue<
+              std::unique_ptr<shared_model::interface::Block>>(
+              std::move(block));
+        }));
+  }
+
+  void TearDown() override {
+    fs::remove_all(block_store_path);
+  }
+
+  void add(FlatFile::Identifier id, const std::string &entry) {
+    ASSERT_TRUE(store->add(id, iroha::stringToBytes(entry)));
+  }
+
+  /// add blocks with ids from first to last linked to each other
+  void addChain(FlatFile::Identifier first, FlatFile::Identifier last) {
+    for (auto id = first; id <= last; ++id) {
+      add(id,
+          std::to_string(id) + " hash" + std::to_string(id) + " hash"
+              + std::to_string(id - 1));
+    }
+  }
+
+  FlatFile::Identifier verify(FlatFile::Identifier first_id) {
+    return verifyBlockStore(
+        *store, first_id, converter, pool, getTestLogger("Verifier"));
+  }
+
+  using DeserializeResult = iroha::expected::
+      Result<std::unique_ptr<shared_model::interface::Block>, std::string>;
+
+  std::string block_store_path =
+      (fs::temp_directory_path() / fs::unique_path()).string();
+  std::unique_ptr<FlatFile> store;
+  NiceMock<MockBlockJsonConverter> converter;
+  iroha::ThreadPool pool{2};
+};
+
+/**
+ * @given block store with a valid chain
+ * @when it is verified
+ * @then the last id is returned
+ */
+TEST_F(BlockStoreVerifierTest, ValidChain) {
+  addChain(1, 10);
+  ASSERT_EQ(verify(1), 10);
+}
+
+/**
+ * @given block store with a chain starting above the first height
+ * @when it is verified from the first stored id
+ * @then the last id is returned
+ */
+TEST_F(BlockStoreVerifierTest, ChainFromSnapshot) {
+  addChain(5, 10);
+  ASSERT_EQ(verify(5), 10);
+}
+
+/**
+ * @given block store which block does not refer to the previous one
+ * @when it is verified
+ * @then the id before that block is returned
+ */
+TEST_F(BlockStoreVerifierTest, BrokenLink) {
+  addChain(1, 3);
+  add(4, "4 hash4 other");
+  addChain(5, 6);
+  ASSERT_EQ(verify(1), 3);
+}
+
+/**
+ * @given block store with a truncated block and a missing block
+ * @when it is verified
+ * @then the id before the first of them is returned
+ */
+TEST_F(BlockStoreVerifierTest, CorruptedAndMissingBlocks) {
+  addChain(1, 2);
+  add(3, "3 hash3");
+  ASSERT_EQ(verify(1), 2);
+
+  ASSERT_TRUE(store->truncate(2));
+  addChain(4, 5);
+  ASSERT_EQ(verify(1), 2);
+}
+
+/**
+ * @given block store which block height does not match its id
+ * @when it is verified
+ * @then the id before that block is returned
+ */
+TEST_F(BlockStoreVerifierTest, WrongHeight) {
+  addChain(1, 2);
+  add(3, "7 hash3 hash2");
+  ASSERT_EQ(verify(1), 2);
+}
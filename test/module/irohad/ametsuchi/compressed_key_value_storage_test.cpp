@@ -0,0 +1,127 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/compressed_key_value_storage.hpp"
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include "ametsuchi/impl/flat_file/flat_file.hpp"
+#include "framework/test_logger.hpp"
+#include "logger/logger.hpp"
+
+using namespace iroha::ametsuchi;
+namespace fs = boost::filesystem;
+
+class CompressedKeyValueStorageTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    fs::create_directory(block_store_path);
+  }
+  void TearDown() override {
+    fs::remove_all(block_store_path);
+  }
+
+  std::unique_ptr<KeyValueStorage> createFlatFile() {
+    auto flat_file =
+        FlatFile::create(block_store_path, getTestLogger("FlatFile"));
+    EXPECT_TRUE(flat_file);
+    return std::move(*flat_file);
+  }
+
+  std::unique_ptr<CompressedKeyValueStorage> createStorage() {
+    return std::make_unique<CompressedKeyValueStorage>(
+        createFlatFile(), getTestLogger("CompressedKeyValueStorage"));
+  }
+
+  /// @return JSON-like entry repeating the ids of the genesis entry
+  static KeyValueStorage::Bytes blob(KeyValueStorage::Identifier id) {
+    std::string json;
+    for (auto i = 0u; i < 50; ++i) {
+      json += R"({"accountId":"user)" + std::to_string(i * id)
+          + R"(@domain","assetId":"coin#domain"})";
+    }
+    return KeyValueStorage::Bytes(json.begin(), json.end());
+  }
+
+  static KeyValueStorage::Bytes bytes(
+      const boost::optional<KeyValueStorage::BytesView> &view) {
+    EXPECT_TRUE(view);
+    return KeyValueStorage::Bytes(view->data(), view->data() + view->size());
+  }
+
+  std::string block_store_path =
+      (fs::temp_directory_path() / fs::unique_path()).string();
+};
+
+/**
+ * @given compressed storage
+ * @when entries are added
+ * @then they are stored compressed and read back unchanged
+ */
+TEST_F(CompressedKeyValueStorageTest, AddGet) {
+  auto storage = createStorage();
+  for (auto id = 1u; id <= 10; ++id) {
+    ASSERT_TRUE(storage->add(id, blob(id)));
+  }
+  ASSERT_EQ(storage->last_id(), 10);
+
+  auto flat_file = createFlatFile();
+  for (auto id = 1u; id <= 10; ++id) {
+    ASSERT_EQ(*storage->get(id), blob(id));
+    ASSERT_EQ(bytes(storage->getView(id)), blob(id));
+    ASSERT_LT(flat_file->get(id)->size(), blob(id).size() / 4);
+  }
+}
+
+/**
+ * @given storage with entries added without compression
+ * @when compressed storage is created on the same directory
+ * @then the entries are read unchanged and new entries can be added
+ */
+TEST_F(CompressedKeyValueStorageTest, ReadUncompressed) {
+  {
+    auto flat_file = createFlatFile();
+    for (auto id = 1u; id <= 5; ++id) {
+      ASSERT_TRUE(flat_file->add(id, blob(id)));
+    }
+  }
+  auto storage = createStorage();
+  ASSERT_TRUE(storage->add(6, blob(6)));
+  for (auto id = 1u; id <= 6; ++id) {
+    ASSERT_EQ(*storage->get(id), blob(id));
+  }
+}
+
+/**
+ * @given compressed storage
+ * @when entries which do not compress or start with a zero byte are added
+ * @then they are read unchanged
+ */
+TEST_F(CompressedKeyValueStorageTest, IncompressibleEntries) {
+  auto storage = createStorage();
+  KeyValueStorage::Bytes short_entry{'x'};
+  KeyValueStorage::Bytes zero_entry{0, 1, 2};
+  ASSERT_TRUE(storage->add(1, short_entry));
+  ASSERT_TRUE(storage->add(2, zero_entry));
+  ASSERT_EQ(*storage->get(1), short_entry);
+  ASSERT_EQ(*storage->get(2), zero_entry);
+}
+
+/**
+ * @given compressed storage with entries
+ * @when the storage is dropped and new entries are added
+ * @then the dictionary is taken from the new first entry
+ */
+TEST_F(CompressedKeyValueStorageTest, DropAll) {
+  auto storage = createStorage();
+  ASSERT_TRUE(storage->add(1, blob(1)));
+  ASSERT_TRUE(storage->add(2, blob(2)));
+  storage->dropAll();
+  ASSERT_FALSE(storage->get(1));
+
+  ASSERT_TRUE(storage->add(1, blob(3)));
+  ASSERT_TRUE(storage->add(2, blob(2)));
+  ASSERT_EQ(*createStorage()->get(2), blob(2));
+}
@@ -259,3 +259,63 @@ TEST_F(BlStore_Test, RemoveAndCreateNew) {
   ASSERT_TRUE(bl_store->get(7));
   ASSERT_FALSE(bl_store->get(1));
 }
+
+/**
+ * @given initialized FlatFile storage with a block
+ * @when block is read through a memory-mapped view
+ * @then view contents equal the stored block and absent id returns none
+ */
+TEST_F(BlStore_Test, GetView) {
+  auto store = FlatFile::create(block_store_path, flat_file_log_);
+  ASSERT_TRUE(store);
+  auto bl_store = std::move(*store);
+  ASSERT_TRUE(bl_store->add(1u, block));
+
+  auto view = bl_store->getView(1u);
+  ASSERT_TRUE(view);
+  ASSERT_EQ(FlatFile::Bytes(view->data(), view->data() + view->size()),
+            block);
+  ASSERT_FALSE(bl_store->getView(2u));
+}
+
+/**
+ * @given initialized FlatFile storage with blocks
+ * @when storage is truncated to an id
+ * @then blocks with greater ids are removed, also after restart
+ */
+TEST_F(BlStore_Test, Truncate) {
+  {
+    auto store = FlatFile::create(block_store_path, flat_file_log_);
+    ASSERT_TRUE(store);
+    auto bl_store = std::move(*store);
+    for (Identifier id = 1; id <= 5; ++id) {
+      ASSERT_TRUE(bl_store->add(id, block));
+    }
+
+    ASSERT_TRUE(bl_store->truncate(3));
+    ASSERT_EQ(bl_store->last_id(), 3);
+    ASSERT_TRUE(bl_store->get(3));
+    ASSERT_FALSE(bl_store->get(4));
+  }
+
+  auto store = FlatFile::create(block_store_path, flat_file_log_);
+  ASSERT_TRUE(store);
+  ASSERT_EQ((*store)->last_id(), 3);
+  ASSERT_FALSE((*store)->get(5));
+}
+
+/**
+ * @given initialized FlatFile storage with blocks
+ * @when a range of the blocks, including ids which are not stored, is synced
+ * @then the sync succeeds
+ */
+TEST_F(BlStore_Test, Sync) {
+  auto store = FlatFile::create(block_store_path, flat_file_log_);
+  ASSERT_TRUE(store);
+  auto bl_store = std::move(*store);
+  for (Identifier id = 1; id <= 3; ++id) {
+    ASSERT_TRUE(bl_store->add(id, block));
+  }
+
+  ASSERT_TRUE(bl_store->sync(2, 5));
+}
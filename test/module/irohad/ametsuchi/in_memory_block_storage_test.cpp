@@ -120,3 +120,30 @@ TEST_F(InMemoryBlockStorageTest, ForEach) {
 
   ASSERT_EQ(1, count);
 }
+
+/**
+ * @given initialized block storage
+ * @when blocks are inserted at heights 3, 1 and 5
+ * @then heights between them are not found, and blocks are visited in order
+ * of heights
+ */
+TEST_F(InMemoryBlockStorageTest, NonConsecutiveHeights) {
+  std::vector<std::shared_ptr<MockBlock>> blocks;
+  for (auto height : {3, 1, 5}) {
+    blocks.push_back(std::make_shared<NiceMock<MockBlock>>());
+    ON_CALL(*blocks.back(), height()).WillByDefault(Return(height));
+    ASSERT_TRUE(block_storage_.insert(blocks.back()));
+  }
+
+  ASSERT_EQ(3, block_storage_.size());
+  ASSERT_FALSE(block_storage_.fetch(2));
+  ASSERT_FALSE(block_storage_.fetch(6));
+  ASSERT_EQ(blocks[1], *block_storage_.fetch(1));
+  ASSERT_FALSE(block_storage_.insert(blocks[0]));
+
+  std::vector<shared_model::interface::types::HeightType> heights;
+  block_storage_.forEach(
+      [&heights](const auto &block) { heights.push_back(block->height()); });
+  ASSERT_EQ(heights,
+            (std::vector<shared_model::interface::types::HeightType>{1, 3, 5}));
+}
@@ -18,11 +18,25 @@ namespace iroha {
       MOCK_METHOD1(
           getBlock,
           BlockQuery::BlockResult(shared_model::interface::types::HeightType));
+      MOCK_METHOD1(getSerializedBlock,
+                   boost::optional<std::string>(
+                       shared_model::interface::types::HeightType));
       MOCK_METHOD1(checkTxPresence,
                    boost::optional<TxCacheStatusType>(
                        const shared_model::crypto::Hash &));
+      MOCK_METHOD1(checkTxsPresence,
+                   boost::optional<std::vector<TxCacheStatusType>>(
+                       const std::vector<shared_model::crypto::Hash> &));
       MOCK_METHOD0(getTopBlockHeight,
                    shared_model::interface::types::HeightType());
+      MOCK_METHOD3(
+          getAccountsBlockHeights,
+          boost::optional<
+              std::vector<shared_model::interface::types::HeightType>>(
+              const std::vector<shared_model::interface::types::AccountIdType>
+                  &,
+              shared_model::interface::types::HeightType,
+              size_t));
     };
 
   }  // namespace ametsuchi
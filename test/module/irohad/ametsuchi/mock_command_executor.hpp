@@ -20,6 +20,10 @@ namespace iroha {
 
       MOCK_METHOD1(doValidation, void(bool));
 
+      MOCK_METHOD1(deferExecution, void(bool));
+
+      MOCK_METHOD0(flush, CommandResult());
+
       CommandResult operator()(
           const shared_model::interface::AddAssetQuantity &command) override {
         return doAddAssetQuantity(command);
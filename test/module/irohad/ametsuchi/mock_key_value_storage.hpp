@@ -20,6 +20,7 @@ namespace iroha {
       MOCK_CONST_METHOD0(directory, std::string(void));
       MOCK_CONST_METHOD0(last_id, Identifier(void));
       MOCK_METHOD0(dropAll, void(void));
+      MOCK_METHOD2(sync, bool(Identifier, Identifier));
     };
 
   }  // namespace ametsuchi
@@ -25,6 +25,7 @@ namespace iroha {
         return commit_(mutableStorage);
       }
 
+      MOCK_METHOD1(commitIntermediate, CommitResult(MutableStorage &));
       MOCK_CONST_METHOD0(preparedCommitEnabled, bool());
       MOCK_METHOD1(
           commitPrepared,
@@ -30,12 +30,18 @@ namespace iroha {
                          boost::optional<std::shared_ptr<PeerQuery>>());
       MOCK_CONST_METHOD0(createBlockQuery,
                          boost::optional<std::shared_ptr<BlockQuery>>());
+      MOCK_CONST_METHOD0(
+          createWsvSnapshotExporter,
+          boost::optional<std::unique_ptr<WsvSnapshotExporter>>());
+      MOCK_METHOD0(createWsvSnapshotImporter,
+                   boost::optional<std::unique_ptr<WsvSnapshotImporter>>());
       MOCK_CONST_METHOD2(
           createQueryExecutor,
           boost::optional<std::shared_ptr<QueryExecutor>>(
               std::shared_ptr<PendingTransactionStorage>,
               std::shared_ptr<shared_model::interface::QueryResponseFactory>));
       MOCK_METHOD1(doCommit, CommitResult(MutableStorage *storage));
+      MOCK_METHOD1(commitIntermediate, CommitResult(MutableStorage &));
       MOCK_CONST_METHOD0(preparedCommitEnabled, bool());
       MOCK_METHOD1(
           commitPrepared,
@@ -51,6 +57,9 @@ namespace iroha {
                        const shared_model::interface::Peer &));
       MOCK_METHOD0(reset, void(void));
       MOCK_METHOD0(resetWsv, expected::Result<void, std::string>());
+      MOCK_METHOD0(dropConstraints, expected::Result<void, std::string>());
+      MOCK_METHOD1(restoreConstraints,
+                   expected::Result<void, std::string>(size_t));
       MOCK_METHOD0(resetPeers, void(void));
       MOCK_METHOD0(dropStorage, void(void));
       MOCK_METHOD0(freeConnections, void(void));
@@ -23,6 +23,7 @@ namespace iroha {
           getPeers,
           boost::optional<
               std::vector<std::shared_ptr<shared_model::interface::Peer>>>());
+      MOCK_METHOD0(getTopBlockInfo, boost::optional<TopBlockInfo>());
     };
 
   }  // namespace ametsuchi
@@ -100,7 +100,7 @@ namespace iroha {
   auto error = err(cmd_result);                      \
   ASSERT_TRUE(error);                                \
   EXPECT_EQ(error->error.error_code, expected_code); \
-  auto str_error = error->error.error_extra;         \
+  auto str_error = error->error.error_extra.str();   \
   for (auto substring : expected_substrings) {       \
     EXPECT_THAT(str_error, HasSubstr(substring));    \
   }
@@ -349,6 +349,44 @@ namespace iroha {
       CHECK_ERROR_CODE_AND_MESSAGE(cmd_result, 3, query_args);
     }
 
+    /**
+     * @given command executor with deferred execution
+     * @when commands are executed without validation
+     * @then they are applied only when flushed, in order
+     */
+    TEST_F(AddAccountAssetTest, DeferredExecution) {
+      addAsset();
+      executor->deferExecution(true);
+
+      auto add_asset = mock_command_factory->constructAddAssetQuantity(
+          asset_id, asset_amount_one_zero);
+      CHECK_SUCCESSFUL_RESULT(execute(*add_asset, true));
+      CHECK_SUCCESSFUL_RESULT(execute(*add_asset, true));
+      ASSERT_FALSE(sql_query->getAccountAsset(account_id, asset_id));
+
+      CHECK_SUCCESSFUL_RESULT(executor->flush());
+      auto account_asset = sql_query->getAccountAsset(account_id, asset_id);
+      ASSERT_TRUE(account_asset);
+      ASSERT_EQ("2.0", account_asset.get()->balance().toStringRepr());
+    }
+
+    /**
+     * @given command executor with deferred execution
+     * @when a deferred command fails
+     * @then its error is returned by flush
+     */
+    TEST_F(AddAccountAssetTest, DeferredExecutionError) {
+      executor->deferExecution(true);
+
+      CHECK_SUCCESSFUL_RESULT(
+          execute(*mock_command_factory->constructAddAssetQuantity(
+                      asset_id, asset_amount_one_zero),
+                  true));
+
+      std::vector<std::string> query_args{account_id, asset_id};
+      CHECK_ERROR_CODE_AND_MESSAGE(executor->flush(), 3, query_args);
+    }
+
     /**
      * @given a user with all required permissions having the maximum allowed
      * quantity of an asset with precision 1
@@ -431,6 +469,20 @@ namespace iroha {
       CHECK_ERROR_CODE_AND_MESSAGE(cmd_result, 2, query_args);
     }
 
+    /**
+     * @given command failed because of missing perms
+     * @when perms are appended to the creator and the command is executed
+     * again by the same executor
+     * @then peer is successfully added
+     */
+    TEST_F(AddPeer, ValidAfterPermsAppended) {
+      ASSERT_TRUE(err(execute(*mock_command_factory->constructAddPeer(*peer))));
+
+      addOnePerm(shared_model::interface::permissions::Role::kAddPeer);
+      CHECK_SUCCESSFUL_RESULT(
+          execute(*mock_command_factory->constructAddPeer(*peer)));
+    }
+
     class RemovePeer : public CommandExecutorTest {
      public:
       void SetUp() override {
@@ -2138,6 +2190,64 @@ namespace iroha {
       CHECK_ERROR_CODE_AND_MESSAGE(cmd_result, 6, query_args);
     }
 
+    /**
+     * @given command executor aggregating asset quantities of deferred
+     * commands
+     * @when assets are added and transferred back and forth
+     * @then balances are changed only when flushed, by the net quantities
+     */
+    TEST_F(TransferAccountAssetTest, AggregatedQuantities) {
+      addAsset();
+      executor->deferExecution(true);
+      executor->aggregateAssetQuantities(true);
+
+      CHECK_SUCCESSFUL_RESULT(
+          execute(*mock_command_factory->constructAddAssetQuantity(
+                      asset_id, Amount{"2.0"}),
+                  true));
+      auto transfer = [this](const auto &from, const auto &to) {
+        return execute(*mock_command_factory->constructTransferAsset(
+                           from, to, asset_id, "desc", asset_amount_one_zero),
+                       true);
+      };
+      CHECK_SUCCESSFUL_RESULT(transfer(account_id, account2_id));
+      CHECK_SUCCESSFUL_RESULT(transfer(account_id, account2_id));
+      CHECK_SUCCESSFUL_RESULT(transfer(account2_id, account_id));
+      ASSERT_FALSE(sql_query->getAccountAsset(account_id, asset_id));
+
+      CHECK_SUCCESSFUL_RESULT(executor->flush());
+      auto account_asset = sql_query->getAccountAsset(account_id, asset_id);
+      ASSERT_TRUE(account_asset);
+      ASSERT_EQ("1.0", account_asset.get()->balance().toStringRepr());
+      account_asset = sql_query->getAccountAsset(account2_id, asset_id);
+      ASSERT_TRUE(account_asset);
+      ASSERT_EQ("1.0", account_asset.get()->balance().toStringRepr());
+    }
+
+    /**
+     * @given command executor aggregating asset quantities of deferred
+     * commands
+     * @when more asset is transferred than the account has in total
+     * @then flush returns the insufficient balance error
+     */
+    TEST_F(TransferAccountAssetTest, AggregatedQuantitiesOverdraft) {
+      addAsset();
+      executor->deferExecution(true);
+      executor->aggregateAssetQuantities(true);
+
+      CHECK_SUCCESSFUL_RESULT(
+          execute(*mock_command_factory->constructAddAssetQuantity(
+                      asset_id, asset_amount_one_zero),
+                  true));
+      CHECK_SUCCESSFUL_RESULT(
+          execute(*mock_command_factory->constructTransferAsset(
+                      account_id, account2_id, asset_id, "desc", Amount{"2.0"}),
+                  true));
+
+      std::vector<std::string> query_args{account_id, account2_id, asset_id};
+      CHECK_ERROR_CODE_AND_MESSAGE(executor->flush(), 6, query_args);
+    }
+
     /**
      * @given two users with all required permissions, one having the maximum
      * allowed quantity of an asset with precision 1
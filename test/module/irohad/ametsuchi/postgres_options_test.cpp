@@ -164,3 +164,55 @@ TEST(PostgresOptionsTest, SeparateParams) {
               default_working_dbname,
               "maintenance_dbname");
 }
+
+/**
+ * @given PostgresOptions initialized with read replicas
+ * @when replica connection string is requested
+ * @then it contains replica address, primary credentials and working database
+ */
+TEST(PostgresOptionsTest, ReplicaConnectionString) {
+  auto pg_opt = PostgresOptions("down",
+                                1991,
+                                "whales",
+                                "donald",
+                                default_working_dbname,
+                                "maintenance_dbname",
+                                test_log,
+                                {{"replica1", 1992}, {"replica2", 1993}});
+  ASSERT_EQ(pg_opt.replicas().size(), 2);
+  EXPECT_EQ(pg_opt.replicaConnectionString(pg_opt.replicas().at(1)),
+            "host=replica2 port=1993 user=whales password=donald dbname="
+                + default_working_dbname);
+}
+
+/**
+ * @given PostgresOptions initialized with and without lazy statement
+ * preparation
+ * @when the option is requested
+ * @then it matches initialization @and statements are prepared eagerly by
+ * default
+ */
+TEST(PostgresOptionsTest, LazyStatementPreparation) {
+  auto eager = PostgresOptions("down",
+                               1991,
+                               "whales",
+                               "donald",
+                               default_working_dbname,
+                               "maintenance_dbname",
+                               test_log);
+  EXPECT_FALSE(eager.lazyStatementPreparation());
+
+  auto lazy = PostgresOptions("down",
+                              1991,
+                              "whales",
+                              "donald",
+                              default_working_dbname,
+                              "maintenance_dbname",
+                              test_log,
+                              {},
+                              {},
+                              false,
+                              boost::none,
+                              true);
+  EXPECT_TRUE(lazy.lazyStatementPreparation());
+}
@@ -2299,6 +2299,33 @@ namespace iroha {
           });
     }
 
+    /**
+     * @given initialized storage with transactions in several blocks @and
+     * global permission
+     * @when get transactions with hashes in an order other than of the ledger
+     * @then transactions are returned in the order of the hashes
+     */
+    TEST_F(GetTransactionsHashExecutorTest, RequestOrderIsKept) {
+      addPerms({shared_model::interface::permissions::Role::kGetAllTxs});
+
+      commitBlocks();
+
+      std::vector<decltype(hash1)> hashes{hash3, hash1, hash2};
+
+      auto query = TestQueryBuilder()
+                       .creatorAccountId(account_id)
+                       .getTransactions(hashes)
+                       .build();
+      auto result = executeQuery(query);
+      checkSuccessfulResult<shared_model::interface::TransactionsResponse>(
+          std::move(result), [&hashes](const auto &cast_resp) {
+            ASSERT_EQ(cast_resp.transactions().size(), hashes.size());
+            for (size_t i = 0; i < hashes.size(); ++i) {
+              EXPECT_EQ(cast_resp.transactions()[i].hash(), hashes[i]);
+            }
+          });
+    }
+
     /**
      * @given initialized storage @and global permission
      * @when get transactions with two valid @and one invalid hashes in query
@@ -0,0 +1,307 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/segmented_block_log/segmented_block_log.hpp"
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include "framework/test_logger.hpp"
+#include "logger/logger.hpp"
+
+using namespace iroha::ametsuchi;
+namespace fs = boost::filesystem;
+
+class SegmentedBlockLogTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    fs::create_directory(block_store_path);
+  }
+  void TearDown() override {
+    fs::remove_all(block_store_path);
+  }
+
+  std::unique_ptr<SegmentedBlockLog> createLog(
+      SegmentWriteOptions write_options = {}) {
+    auto log = SegmentedBlockLog::create(
+        block_store_path, log_, kSegmentSize, write_options);
+    EXPECT_TRUE(log);
+    return log ? std::move(*log) : nullptr;
+  }
+
+  /// returns a distinct blob for every id
+  static KeyValueStorage::Bytes blob(KeyValueStorage::Identifier id) {
+    return KeyValueStorage::Bytes(kBlobSize, static_cast<uint8_t>(id));
+  }
+
+  static constexpr size_t kBlobSize = 1000;
+  /// every segment holds 4 blobs
+  static constexpr uint64_t kSegmentSize = 4 * kBlobSize;
+
+  std::string block_store_path =
+      (fs::temp_directory_path() / fs::unique_path()).string();
+  logger::LoggerPtr log_ = getTestLogger("SegmentedBlockLog");
+};
+
+constexpr size_t SegmentedBlockLogTest::kBlobSize;
+constexpr uint64_t SegmentedBlockLogTest::kSegmentSize;
+
+/**
+ * @given empty block log
+ * @when several entries are added
+ * @then every entry can be read back and last id is the maximum one
+ */
+TEST_F(SegmentedBlockLogTest, ReadWrite) {
+  auto log = createLog();
+  for (auto id = 1u; id <= 10; ++id) {
+    ASSERT_TRUE(log->add(id, blob(id)));
+  }
+  for (auto id = 1u; id <= 10; ++id) {
+    auto res = log->get(id);
+    ASSERT_TRUE(res);
+    ASSERT_EQ(*res, blob(id));
+  }
+  ASSERT_EQ(log->last_id(), 10);
+  ASSERT_EQ(log->size(), 10);
+  ASSERT_EQ(log->segmentsCount(), 3);
+}
+
+/**
+ * @given block log with sealed and unsealed segments
+ * @when the log is reopened on the same directory
+ * @then all entries are available
+ */
+TEST_F(SegmentedBlockLogTest, Reopen) {
+  {
+    auto log = createLog();
+    for (auto id = 1u; id <= 10; ++id) {
+      ASSERT_TRUE(log->add(id, blob(id)));
+    }
+  }
+  auto log = createLog();
+  ASSERT_EQ(log->last_id(), 10);
+  ASSERT_EQ(log->size(), 10);
+  for (auto id = 1u; id <= 10; ++id) {
+    auto res = log->get(id);
+    ASSERT_TRUE(res);
+    ASSERT_EQ(*res, blob(id));
+  }
+
+  // the active segment keeps being appended after reopening
+  ASSERT_TRUE(log->add(11, blob(11)));
+  ASSERT_EQ(log->segmentsCount(), 3);
+  ASSERT_EQ(*log->get(11), blob(11));
+}
+
+/**
+ * @given block log which last record was partially written
+ * @when the log is reopened
+ * @then the incomplete record is dropped and new records can be added
+ */
+TEST_F(SegmentedBlockLogTest, TruncatedTail) {
+  std::string last_segment;
+  {
+    auto log = createLog();
+    for (auto id = 1u; id <= 6; ++id) {
+      ASSERT_TRUE(log->add(id, blob(id)));
+    }
+  }
+  for (auto it = fs::directory_iterator{block_store_path};
+       it != fs::directory_iterator{};
+       ++it) {
+    last_segment = std::max(last_segment, it->path().string());
+  }
+  fs::resize_file(last_segment, fs::file_size(last_segment) - 10);
+
+  auto log = createLog();
+  ASSERT_EQ(log->last_id(), 5);
+  ASSERT_FALSE(log->get(6));
+  ASSERT_TRUE(log->add(6, blob(6)));
+  ASSERT_EQ(*log->get(6), blob(6));
+}
+
+/**
+ * @given block log with one entry
+ * @when entry with an existing id is added
+ * @then add() fails and the entry is not changed
+ */
+TEST_F(SegmentedBlockLogTest, AddExistingId) {
+  auto log = createLog();
+  ASSERT_TRUE(log->add(1, blob(1)));
+  ASSERT_FALSE(log->add(1, blob(2)));
+  ASSERT_EQ(*log->get(1), blob(1));
+}
+
+/**
+ * @given block log
+ * @when entries with non-consecutive ids are added
+ * @then only added entries are available
+ */
+TEST_F(SegmentedBlockLogTest, RandomNumbers) {
+  {
+    auto log = createLog();
+    ASSERT_TRUE(log->add(5, blob(5)));
+    ASSERT_TRUE(log->add(22, blob(22)));
+    ASSERT_TRUE(log->add(11, blob(11)));
+  }
+  auto log = createLog();
+  ASSERT_EQ(*log->get(5), blob(5));
+  ASSERT_EQ(*log->get(22), blob(22));
+  ASSERT_EQ(*log->get(11), blob(11));
+  ASSERT_FALSE(log->get(1));
+  ASSERT_EQ(log->last_id(), 22);
+}
+
+/**
+ * @given block log with several segments
+ * @when dropAll is called
+ * @then the log is empty and segment files are removed
+ */
+TEST_F(SegmentedBlockLogTest, DropAll) {
+  auto log = createLog();
+  for (auto id = 1u; id <= 10; ++id) {
+    ASSERT_TRUE(log->add(id, blob(id)));
+  }
+  log->dropAll();
+  ASSERT_EQ(log->last_id(), 0);
+  ASSERT_FALSE(log->get(1));
+  ASSERT_TRUE(fs::is_empty(block_store_path));
+
+  ASSERT_TRUE(log->add(1, blob(1)));
+  ASSERT_EQ(*log->get(1), blob(1));
+}
+
+/**
+ * @given block log with two sealed segments and an unsealed one
+ * @when entries up to an id in the middle of the second segment are removed
+ * @then only the first segment is removed, the other entries are readable
+ * and writable before and after the log is reopened
+ */
+TEST_F(SegmentedBlockLogTest, RemoveUpTo) {
+  auto log = createLog();
+  for (auto id = 1u; id <= 10; ++id) {
+    ASSERT_TRUE(log->add(id, blob(id)));
+  }
+  ASSERT_TRUE(log->removeUpTo(6));
+  ASSERT_EQ(log->size(), 6);
+  ASSERT_EQ(log->segmentsCount(), 2);
+  ASSERT_FALSE(log->get(4));
+  for (auto id = 5u; id <= 10; ++id) {
+    auto view = log->getView(id);
+    ASSERT_TRUE(view);
+    ASSERT_EQ(KeyValueStorage::Bytes(view->data(), view->data() + view->size()),
+              blob(id));
+  }
+  ASSERT_TRUE(log->add(11, blob(11)));
+
+  log.reset();
+  log = createLog();
+  ASSERT_EQ(log->size(), 7);
+  ASSERT_FALSE(log->get(4));
+  for (auto id = 5u; id <= 11; ++id) {
+    ASSERT_EQ(*log->get(id), blob(id));
+  }
+}
+
+/**
+ * @given empty path
+ * @when tries to create block log
+ * @then creation fails
+ */
+TEST_F(SegmentedBlockLogTest, WriteEmptyFolder) {
+  ASSERT_FALSE(SegmentedBlockLog::create("", log_, kSegmentSize));
+}
+
+/**
+ * @given block log which directory was removed
+ * @when tries to add an entry
+ * @then add() fails
+ */
+TEST_F(SegmentedBlockLogTest, WriteDeniedFolder) {
+  auto log = createLog();
+  fs::remove_all(block_store_path);
+  ASSERT_FALSE(log->add(1, blob(1)));
+}
+
+/**
+ * @given block log with sealed and active segments
+ * @when entries are read through memory-mapped views, also after reopening
+ * @then views contents equal the stored entries
+ */
+TEST_F(SegmentedBlockLogTest, GetView) {
+  auto check_views = [](const SegmentedBlockLog &log) {
+    for (auto id = 1u; id <= 10; ++id) {
+      auto view = log.getView(id);
+      ASSERT_TRUE(view);
+      ASSERT_EQ(KeyValueStorage::Bytes(view->data(),
+                                       view->data() + view->size()),
+                blob(id));
+    }
+    ASSERT_FALSE(log.getView(11));
+  };
+  {
+    auto log = createLog();
+    for (auto id = 1u; id <= 10; ++id) {
+      ASSERT_TRUE(log->add(id, blob(id)));
+    }
+    check_views(*log);
+  }
+  auto log = createLog();
+  check_views(*log);
+}
+
+/**
+ * @given block log with an entry read through a view
+ * @when the log is dropped
+ * @then the view remains valid
+ */
+TEST_F(SegmentedBlockLogTest, ViewOutlivesDropAll) {
+  auto log = createLog();
+  for (auto id = 1u; id <= 5; ++id) {
+    ASSERT_TRUE(log->add(id, blob(id)));
+  }
+  auto view = log->getView(1);
+  ASSERT_TRUE(view);
+  log->dropAll();
+  ASSERT_EQ(KeyValueStorage::Bytes(view->data(), view->data() + view->size()),
+            blob(1));
+}
+
+/**
+ * @given block log written with preallocation and direct writes
+ * @when it is reopened with and without direct writes and appended
+ * @then the padding of direct writes is not taken for records and all
+ * entries are available
+ */
+TEST_F(SegmentedBlockLogTest, DirectWrites) {
+  SegmentWriteOptions write_options;
+  write_options.preallocate = true;
+  write_options.direct_io = true;
+  {
+    auto log = createLog(write_options);
+    for (auto id = 1u; id <= 6; ++id) {
+      ASSERT_TRUE(log->add(id, blob(id)));
+    }
+    ASSERT_EQ(*log->get(6), blob(6));
+  }
+  {
+    auto log = createLog(write_options);
+    ASSERT_EQ(log->last_id(), 6);
+    ASSERT_TRUE(log->add(7, blob(7)));
+  }
+  {
+    auto log = createLog();
+    ASSERT_EQ(log->last_id(), 7);
+    ASSERT_TRUE(log->add(8, blob(8)));
+  }
+  auto log = createLog(write_options);
+  ASSERT_EQ(log->size(), 8);
+  ASSERT_EQ(log->segmentsCount(), 2);
+  for (auto id = 1u; id <= 8; ++id) {
+    auto res = log->get(id);
+    ASSERT_TRUE(res);
+    ASSERT_EQ(*res, blob(id));
+  }
+}
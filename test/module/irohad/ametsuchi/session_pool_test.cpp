@@ -0,0 +1,59 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/session_pool.hpp"
+
+#include <gtest/gtest.h>
+#include <soci/postgresql/soci-postgresql.h>
+#include <soci/soci.h>
+#include "framework/config_helper.hpp"
+#include "metrics/metrics.hpp"
+
+using namespace iroha::ametsuchi;
+using namespace iroha::expected;
+
+class SessionPoolTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    pool_ = std::make_shared<soci::connection_pool>(1);
+    pool_->at(0).open(*soci::factory_postgresql(),
+                      integration_framework::getPostgresCredsOrDefault());
+  }
+
+ protected:
+  std::shared_ptr<soci::connection_pool> pool_;
+};
+
+/**
+ * @given session pool with a single connection and a timeout
+ * @when a session is leased while the connection is taken
+ * @then leasing fails after the timeout and the timeout is counted, and
+ * succeeds when the connection is given back
+ */
+TEST_F(SessionPoolTest, Timeout) {
+  SessionPool sessions(pool_, "test", std::chrono::milliseconds(10));
+  auto &timeouts = iroha::metrics::registry().counter(
+      "iroha_db_test_session_timeouts_total", "");
+  const auto timeouts_before = timeouts.value();
+
+  {
+    auto taken = sessions.session();
+    ASSERT_TRUE(hasValue(taken));
+    ASSERT_TRUE(hasError(sessions.session()));
+    ASSERT_EQ(timeouts.value(), timeouts_before + 1);
+  }
+  ASSERT_TRUE(hasValue(sessions.session()));
+}
+
+/**
+ * @given session pool
+ * @when it is closed
+ * @then sessions are not leased anymore
+ */
+TEST_F(SessionPoolTest, Close) {
+  SessionPool sessions(pool_, "test", std::chrono::milliseconds::zero());
+  sessions.close(1);
+  ASSERT_TRUE(hasError(sessions.session()));
+}
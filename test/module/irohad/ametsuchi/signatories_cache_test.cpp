@@ -0,0 +1,81 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/signatories_cache.hpp"
+
+#include <gtest/gtest.h>
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
+
+using namespace iroha::ametsuchi;
+
+class SignatoriesCacheTest : public ::testing::Test {
+ protected:
+  void insert(const std::string &account_id) {
+    cache.insert(account_id,
+                 std::make_shared<const SignatoriesCache::AccountSignatories>(
+                     SignatoriesCache::AccountSignatories{1, {"key"}}),
+                 cache.version());
+  }
+
+  SignatoriesCache cache;
+  const std::string kAlice = "alice@test";
+  const std::string kBob = "bob@test";
+};
+
+/**
+ * @given cache with signatories of two accounts
+ * @when a block setting quorum of one of them is committed
+ * @then only signatories of the other account stay cached
+ */
+TEST_F(SignatoriesCacheTest, ChangedAccountIsInvalidated) {
+  insert(kAlice);
+  insert(kBob);
+  ASSERT_EQ(cache.find(kAlice)->quorum, 1);
+
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(TestTransactionBuilder()
+                    .creatorAccountId(kAlice)
+                    .setAccountQuorum(kAlice, 2)
+                    .build());
+  cache.invalidate(TestBlockBuilder().height(2).transactions(txs).build());
+
+  EXPECT_FALSE(cache.find(kAlice));
+  EXPECT_TRUE(cache.find(kBob));
+}
+
+/**
+ * @given signatories read before a commit
+ * @when they are inserted after the commit
+ * @then they are not cached
+ */
+TEST_F(SignatoriesCacheTest, StaleReadIsNotCached) {
+  auto version = cache.version();
+  cache.invalidate(TestBlockBuilder().height(2).build());
+  cache.insert(kAlice,
+               std::make_shared<const SignatoriesCache::AccountSignatories>(),
+               version);
+  EXPECT_FALSE(cache.find(kAlice));
+}
+
+/**
+ * @given cache which is full
+ * @when another account is inserted
+ * @then the cache is emptied before the insertion
+ */
+TEST_F(SignatoriesCacheTest, FullCacheIsEmptied) {
+  SignatoriesCache small_cache(1);
+  small_cache.insert(
+      kAlice,
+      std::make_shared<const SignatoriesCache::AccountSignatories>(),
+      small_cache.version());
+  ASSERT_TRUE(small_cache.find(kAlice));
+  small_cache.insert(
+      kBob,
+      std::make_shared<const SignatoriesCache::AccountSignatories>(),
+      small_cache.version());
+  EXPECT_FALSE(small_cache.find(kAlice));
+  EXPECT_TRUE(small_cache.find(kBob));
+}
@@ -0,0 +1,71 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/soci_utils.hpp"
+
+#include <iterator>
+#include <sstream>
+
+#include <gtest/gtest.h>
+
+using namespace iroha::ametsuchi;
+
+/// @return number of values recorded by the histogram of the metric
+uint64_t recorded(const std::string &metric) {
+  return iroha::metrics::registry().histogram(metric, "").snapshot().count;
+}
+
+/**
+ * @given statement tagged with a name
+ * @when it is executed twice, the second time with counted rows
+ * @then its time is recorded for both executions @and its rows once
+ */
+TEST(TimedStatementTest, TimeAndRowsRecorded) {
+  {
+    TimedStatement statement("timedStatementTest");
+  }
+  {
+    TimedStatement statement("timedStatementTest");
+    statement.addRows(2);
+    statement.addRows(3);
+  }
+
+  EXPECT_EQ(recorded("iroha_sql_timedStatementTest_microseconds"), 2);
+  auto rows = iroha::metrics::registry()
+                  .histogram("iroha_sql_timedStatementTest_rows", "")
+                  .snapshot();
+  EXPECT_EQ(rows.count, 1);
+  EXPECT_EQ(rows.sum, 5);
+}
+
+/**
+ * @given statement tagged with a name @and iterators over its rows which
+ * count the rows
+ * @when all rows are iterated
+ * @then every row is iterated once @and the number of rows is recorded
+ */
+TEST(TimedStatementTest, IteratedRowsCounted) {
+  std::istringstream rows("1 2 3");
+  using Iterator = CountingRowIterator<std::istream_iterator<int>>;
+  std::vector<int> values;
+  {
+    TimedStatement statement("countedRowsTest");
+    auto begin = std::istream_iterator<int>(rows);
+    statement.addRows(begin != std::istream_iterator<int>{} ? 1 : 0);
+    for (auto it = Iterator(begin, &statement),
+              end = Iterator(std::istream_iterator<int>{}, &statement);
+         it != end;
+         ++it) {
+      values.push_back(*it);
+    }
+  }
+
+  EXPECT_EQ(values, (std::vector<int>{1, 2, 3}));
+  auto recorded_rows = iroha::metrics::registry()
+                           .histogram("iroha_sql_countedRowsTest_rows", "")
+                           .snapshot();
+  EXPECT_EQ(recorded_rows.count, 1);
+  EXPECT_EQ(recorded_rows.sum, 3);
+}
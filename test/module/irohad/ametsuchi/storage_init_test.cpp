@@ -5,6 +5,9 @@
 
 #include "ametsuchi/impl/storage_impl.hpp"
 
+#include <map>
+#include <sstream>
+
 #include <gtest/gtest.h>
 #include <soci/postgresql/soci-postgresql.h>
 #include <soci/soci.h>
@@ -13,14 +16,19 @@
 #include <boost/uuid/uuid_io.hpp>
 #include "ametsuchi/impl/in_memory_block_storage_factory.hpp"
 #include "ametsuchi/impl/k_times_reconnection_strategy.hpp"
+#include "ametsuchi/mutable_storage.hpp"
 #include "backend/protobuf/proto_block_json_converter.hpp"
 #include "backend/protobuf/proto_permission_to_string.hpp"
+#include "builders/protobuf/transaction.hpp"
 #include "common/result.hpp"
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "datetime/time.hpp"
 #include "framework/config_helper.hpp"
 #include "framework/test_logger.hpp"
 #include "logger/logger_manager.hpp"
 #include "main/impl/pg_connection_init.hpp"
 #include "module/irohad/common/validators_config.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
 #include "validators/field_validator.hpp"
 
 using namespace iroha::ametsuchi;
@@ -77,6 +85,30 @@ class StorageInitTest : public ::testing::Test {
     boost::filesystem::remove_all(block_store_path);
   }
 
+  /// @return options of the test database with lazy statement preparation
+  std::unique_ptr<PostgresOptions> lazyPreparationOptions() {
+    std::map<std::string, std::string> params;
+    std::istringstream stream(pg_opt_without_dbname_);
+    std::string param;
+    while (stream >> param) {
+      auto separator = param.find('=');
+      params[param.substr(0, separator)] = param.substr(separator + 1);
+    }
+    return std::make_unique<PostgresOptions>(
+        params["host"],
+        static_cast<uint16_t>(std::stoi(params["port"])),
+        params["user"],
+        params["password"],
+        dbname_,
+        "postgres",
+        storage_log_manager_->getLogger(),
+        std::vector<PostgresOptions::Replica>{},
+        PostgresOptions::PoolReservation{},
+        false,
+        boost::none,
+        true);
+  }
+
   logger::LoggerManagerTreePtr storage_log_manager_{
       getTestLoggerManager()->getChild("Storage")};
 };
@@ -160,3 +192,73 @@ TEST_F(StorageInitTest, CreateStorageWithInvalidPgOpt) {
   pool.match([](const auto &) { FAIL() << "storage created, but should not"; },
              [](const auto &) { SUCCEED(); });
 }
+
+/**
+ * @given Postgres options with lazy statement preparation
+ * @when storage is created @and a block is applied through a mutable storage
+ * @then connections of the pool have no statements prepared @and the block
+ * is committed with the statements prepared on first use
+ */
+TEST_F(StorageInitTest, LazyStatementPreparation) {
+  auto options = lazyPreparationOptions();
+  ASSERT_TRUE(options->lazyStatementPreparation());
+
+  PgConnectionInit::createDatabaseIfNotExist(*options).match(
+      [](auto &&val) {}, [&](auto &&error) { FAIL() << error.error; });
+  auto pool = PgConnectionInit::prepareConnectionPool(
+      *reconnection_strategy_factory_,
+      *options,
+      pool_size_,
+      getTestLoggerManager()->getChild("Storage"));
+
+  if (auto e = boost::get<iroha::expected::Error<std::string>>(&pool)) {
+    FAIL() << e->error;
+  }
+
+  auto pool_wrapper =
+      std::move(boost::get<iroha::expected::Value<PoolWrapper>>(pool).value);
+  {
+    soci::session sql(*pool_wrapper.connection_pool_);
+    int statements = -1;
+    sql << "SELECT count(*) FROM pg_prepared_statements",
+        soci::into(statements);
+    EXPECT_EQ(statements, 0);
+  }
+
+  std::shared_ptr<StorageImpl> storage;
+  StorageImpl::create(block_store_path,
+                      std::move(options),
+                      std::move(pool_wrapper),
+                      converter,
+                      perm_converter_,
+                      std::move(block_storage_factory_),
+                      storage_log_manager_)
+      .match([&storage](const auto &value) { storage = value.value; },
+             [](const auto &error) { FAIL() << error.error; });
+  ASSERT_TRUE(storage);
+
+  std::vector<shared_model::proto::Transaction> genesis_tx;
+  genesis_tx.push_back(
+      shared_model::proto::TransactionBuilder()
+          .creatorAccountId("admin@test")
+          .createdTime(iroha::time::now())
+          .quorum(1)
+          .createRole("admin",
+                      {shared_model::interface::permissions::Role::
+                           kCreateDomain})
+          .createDomain("test", "admin")
+          .build()
+          .signAndAddSignature(
+              shared_model::crypto::DefaultCryptoAlgorithmType::
+                  generateKeypair())
+          .finish());
+  auto mutable_storage = storage->createMutableStorage();
+  ASSERT_TRUE(hasValue(mutable_storage));
+  auto &ms = boost::get<Value<std::unique_ptr<MutableStorage>>>(
+                 mutable_storage)
+                 .value;
+  ASSERT_TRUE(ms->apply(createBlock(genesis_tx)));
+  ASSERT_TRUE(hasValue(storage->commit(std::move(ms))));
+
+  storage->dropStorage();
+}
@@ -0,0 +1,90 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/synced_key_value_storage.hpp"
+
+#include <future>
+
+#include <gtest/gtest.h>
+#include "framework/test_logger.hpp"
+#include "module/irohad/ametsuchi/mock_key_value_storage.hpp"
+
+using namespace iroha::ametsuchi;
+using namespace std::chrono_literals;
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::Return;
+
+class SyncedKeyValueStorageTest : public ::testing::Test {
+ protected:
+  std::unique_ptr<SyncedKeyValueStorage> createStorage(
+      std::chrono::milliseconds interval) {
+    auto storage = std::make_unique<MockKeyValueStorage>();
+    mock_storage = storage.get();
+    ON_CALL(*mock_storage, add(_, _)).WillByDefault(Return(true));
+    return std::make_unique<SyncedKeyValueStorage>(
+        std::move(storage), interval, getTestLogger("SyncedKeyValueStorage"));
+  }
+
+  MockKeyValueStorage *mock_storage;
+  const KeyValueStorage::Bytes blob = KeyValueStorage::Bytes(10, 1);
+};
+
+/**
+ * @given storage syncing every entry
+ * @when entries are added
+ * @then every entry is synced when it is added, and the add fails if the
+ * sync fails
+ */
+TEST_F(SyncedKeyValueStorageTest, EveryEntryIsSynced) {
+  auto storage = createStorage(0ms);
+  EXPECT_CALL(*mock_storage, add(1, _));
+  EXPECT_CALL(*mock_storage, sync(1, 1)).WillOnce(Return(true));
+  ASSERT_TRUE(storage->add(1, blob));
+
+  EXPECT_CALL(*mock_storage, add(2, _));
+  EXPECT_CALL(*mock_storage, sync(2, 2)).WillOnce(Return(false));
+  ASSERT_FALSE(storage->add(2, blob));
+
+  // the unsynced entry is synced with the next one
+  EXPECT_CALL(*mock_storage, add(3, _));
+  EXPECT_CALL(*mock_storage, sync(2, 3)).WillOnce(Return(true));
+  ASSERT_TRUE(storage->add(3, blob));
+}
+
+/**
+ * @given storage syncing entries in groups with a long interval
+ * @when entries are added and the storage is destroyed
+ * @then the entries are synced together on destruction
+ */
+TEST_F(SyncedKeyValueStorageTest, GroupIsSyncedOnDestruction) {
+  auto storage = createStorage(1h);
+  EXPECT_CALL(*mock_storage, sync(_, _)).Times(0);
+  for (KeyValueStorage::Identifier id = 1; id <= 3; ++id) {
+    ASSERT_TRUE(storage->add(id, blob));
+  }
+  ::testing::Mock::VerifyAndClearExpectations(mock_storage);
+
+  EXPECT_CALL(*mock_storage, sync(1, 3)).WillOnce(Return(true));
+  storage.reset();
+}
+
+/**
+ * @given storage syncing entries in groups with a short interval
+ * @when an entry is added
+ * @then it is synced by the background thread
+ */
+TEST_F(SyncedKeyValueStorageTest, GroupIsSyncedInBackground) {
+  auto storage = createStorage(1ms);
+  std::promise<void> synced;
+  EXPECT_CALL(*mock_storage, sync(1, 1))
+      .WillOnce(Invoke([&synced](KeyValueStorage::Identifier,
+                                 KeyValueStorage::Identifier) {
+        synced.set_value();
+        return true;
+      }));
+  ASSERT_TRUE(storage->add(1, blob));
+  ASSERT_EQ(synced.get_future().wait_for(10s), std::future_status::ready);
+}
@@ -0,0 +1,77 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ametsuchi/impl/tx_hash_filter.hpp"
+
+#include <gtest/gtest.h>
+#include "cryptography/hash.hpp"
+
+using namespace iroha::ametsuchi;
+using shared_model::crypto::Hash;
+
+class TxHashFilterTest : public ::testing::Test {
+ protected:
+  /// returns distinct 32-byte hashes for distinct numbers
+  static Hash makeHash(size_t i) {
+    std::string bytes(32, 'h');
+    for (size_t j = 0; j < sizeof(i); ++j) {
+      bytes[j] = static_cast<char>((i >> (8 * j)) & 0xff);
+    }
+    return Hash(bytes);
+  }
+
+  static constexpr size_t kHashesCount = TxHashFilter::kMinCapacity;
+  TxHashFilter filter{kHashesCount};
+};
+
+constexpr size_t TxHashFilterTest::kHashesCount;
+
+/**
+ * @given filter filled up to its capacity
+ * @when inserted and other hashes are checked
+ * @then all inserted hashes may be contained, and false positive rate for
+ * other hashes is close to the configured one
+ */
+TEST_F(TxHashFilterTest, NoFalseNegatives) {
+  for (size_t i = 0; i < kHashesCount; ++i) {
+    filter.insert(makeHash(i));
+  }
+  ASSERT_EQ(filter.count(), kHashesCount);
+
+  for (size_t i = 0; i < kHashesCount; ++i) {
+    ASSERT_TRUE(filter.mayContain(makeHash(i)));
+  }
+
+  size_t false_positives = 0;
+  const size_t kChecks = 100000;
+  for (size_t i = kHashesCount; i < kHashesCount + kChecks; ++i) {
+    false_positives += filter.mayContain(makeHash(i));
+  }
+  ASSERT_LT(false_positives, kChecks * 2 / 100);
+}
+
+/**
+ * @given filter with hashes
+ * @when it is cleared
+ * @then hashes are not contained anymore
+ */
+TEST_F(TxHashFilterTest, Clear) {
+  filter.insert(makeHash(1));
+  ASSERT_TRUE(filter.mayContain(makeHash(1)));
+  filter.clear();
+  ASSERT_FALSE(filter.mayContain(makeHash(1)));
+  ASSERT_EQ(filter.count(), 0);
+}
+
+/**
+ * @given empty filter
+ * @when short hash of arbitrary length is inserted
+ * @then it may be contained
+ */
+TEST_F(TxHashFilterTest, ArbitraryLength) {
+  ASSERT_FALSE(filter.mayContain(Hash("1")));
+  filter.insert(Hash("1"));
+  ASSERT_TRUE(filter.mayContain(Hash("1")));
+}
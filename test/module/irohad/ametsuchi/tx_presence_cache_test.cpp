@@ -104,7 +104,7 @@ TEST_F(TxPresenceCacheTest, MissingThenCommittedHashTest) {
  * @given batch with 3 transactions: Rejected, Committed and Missing
  * @when cache asked for batch status
  * @then cache returns BatchStatusCollectionType with Rejected, Committed and
- * Missing statuses accordingly
+ * Missing statuses accordingly, all statuses are requested with one query
  */
 TEST_F(TxPresenceCacheTest, BatchHashTest) {
   shared_model::crypto::Hash hash1("1");
@@ -116,15 +116,13 @@ TEST_F(TxPresenceCacheTest, BatchHashTest) {
   shared_model::crypto::Hash hash3("3");
   shared_model::crypto::Hash reduced_hash_3("r3");
 
-  EXPECT_CALL(*mock_block_query, checkTxPresence(hash1))
-      .WillOnce(Return(boost::make_optional<TxCacheStatusType>(
-          tx_cache_status_responses::Rejected(hash1))));
-  EXPECT_CALL(*mock_block_query, checkTxPresence(hash2))
-      .WillOnce(Return(boost::make_optional<TxCacheStatusType>(
-          tx_cache_status_responses::Committed(hash2))));
-  EXPECT_CALL(*mock_block_query, checkTxPresence(hash3))
-      .WillOnce(Return(boost::make_optional<TxCacheStatusType>(
-          tx_cache_status_responses::Missing(hash3))));
+  EXPECT_CALL(*mock_block_query,
+              checkTxsPresence(std::vector<shared_model::crypto::Hash>{
+                  hash1, hash2, hash3}))
+      .WillOnce(Return(std::vector<TxCacheStatusType>{
+          tx_cache_status_responses::Rejected(hash1),
+          tx_cache_status_responses::Committed(hash2),
+          tx_cache_status_responses::Missing(hash3)}));
   auto tx1 = std::make_shared<MockTransaction>();
   EXPECT_CALL(*tx1, hash()).WillOnce(ReturnRefOfCopy(hash1));
   EXPECT_CALL(*tx1, reducedHash()).WillOnce(ReturnRefOfCopy(reduced_hash_1));
@@ -172,3 +170,44 @@ TEST_F(TxPresenceCacheTest, BatchHashTest) {
       },
       [&](const auto &error) { FAIL() << error.error; });
 }
+
+/**
+ * @given batch with 2 transactions, status of the first one is cached
+ * @when cache asked for batch status
+ * @then only the second status is requested from storage
+ */
+TEST_F(TxPresenceCacheTest, BatchPartiallyCachedTest) {
+  shared_model::crypto::Hash hash1("1");
+  shared_model::crypto::Hash hash2("2");
+
+  EXPECT_CALL(*mock_block_query, checkTxPresence(hash1))
+      .WillOnce(Return(boost::make_optional<TxCacheStatusType>(
+          tx_cache_status_responses::Committed(hash1))));
+  EXPECT_CALL(*mock_block_query,
+              checkTxsPresence(std::vector<shared_model::crypto::Hash>{hash2}))
+      .WillOnce(Return(std::vector<TxCacheStatusType>{
+          tx_cache_status_responses::Rejected(hash2)}));
+
+  TxPresenceCacheImpl cache(mock_storage);
+  ASSERT_TRUE(cache.check(hash1));
+
+  auto tx1 = std::make_shared<MockTransaction>();
+  EXPECT_CALL(*tx1, hash()).WillRepeatedly(ReturnRefOfCopy(hash1));
+  EXPECT_CALL(*tx1, reducedHash()).WillRepeatedly(ReturnRefOfCopy(hash1));
+  auto tx2 = std::make_shared<MockTransaction>();
+  EXPECT_CALL(*tx2, hash()).WillRepeatedly(ReturnRefOfCopy(hash2));
+  EXPECT_CALL(*tx2, reducedHash()).WillRepeatedly(ReturnRefOfCopy(hash2));
+  shared_model::interface::TransactionBatchImpl batch(
+      shared_model::interface::types::SharedTxsCollectionType{tx1, tx2});
+
+  auto batch_statuses = cache.check(batch);
+  ASSERT_TRUE(batch_statuses);
+  ASSERT_EQ(2, batch_statuses->size());
+  ASSERT_NO_THROW(
+      boost::get<tx_cache_status_responses::Committed>(batch_statuses->at(0)));
+  ASSERT_NO_THROW(
+      boost::get<tx_cache_status_responses::Rejected>(batch_statuses->at(1)));
+
+  // both statuses are cached now
+  ASSERT_TRUE(cache.check(batch));
+}
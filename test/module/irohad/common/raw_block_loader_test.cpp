@@ -5,10 +5,15 @@
 
 #include "main/raw_block_loader.hpp"
 
+#include <sstream>
+
 #include <gtest/gtest.h>
+#include "common/thread_pool.hpp"
 #include "framework/test_logger.hpp"
 #include "interfaces/iroha_internal/block.hpp"
 #include "interfaces/transaction.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
 
 using iroha::main::BlockLoader;
 
@@ -44,3 +49,39 @@ TEST(BlockLoaderTest, BlockLoaderJsonParsing) {
   ASSERT_EQ(b->prevHash().hex(),
             "0101010101010101010101010101010101010101010101010101010101010101");
 }
+
+/**
+ * @given block with transactions
+ * @when it is written as json and streamed back using raw block loader
+ * @then the loaded block is the same as the written one
+ */
+TEST(BlockLoaderTest, BlockLoaderJsonStreaming) {
+  BlockLoader loader(getTestLogger("BlockLoader"),
+                     std::make_shared<iroha::ThreadPool>(2));
+  std::vector<shared_model::proto::Transaction> txs;
+  for (int i = 0; i < 3; ++i) {
+    txs.push_back(TestTransactionBuilder()
+                      .creatorAccountId("admin@test")
+                      .createdTime(i)
+                      .quorum(1)
+                      .setAccountDetail("admin@test", "key", "\"[value]}")
+                      .build());
+  }
+  std::vector<shared_model::crypto::Hash> rejected_hashes{
+      shared_model::crypto::Hash(std::string(32, '2'))};
+  auto block = TestBlockBuilder()
+                   .height(2)
+                   .createdTime(1)
+                   .prevHash(shared_model::crypto::Hash(std::string(32, '1')))
+                   .rejectedTransactions(rejected_hashes)
+                   .transactions(txs)
+                   .build();
+
+  std::stringstream stream;
+  ASSERT_TRUE(loader.writeBlock(block, stream));
+  auto loaded = loader.parseBlock(stream);
+
+  ASSERT_TRUE(loaded);
+  ASSERT_EQ(*loaded.value(), block);
+  ASSERT_EQ(loaded.value()->transactions().size(), txs.size());
+}
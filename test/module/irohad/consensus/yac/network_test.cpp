@@ -5,8 +5,11 @@
 
 #include "consensus/yac/transport/impl/network_impl.hpp"
 
+#include <future>
+
 #include <grpc++/grpc++.h>
 
+#include "common/timer_wheel.hpp"
 #include "consensus/yac/transport/yac_pb_converters.hpp"
 #include "framework/mock_stream.h"
 #include "framework/test_logger.hpp"
@@ -17,6 +20,7 @@
 
 using ::testing::_;
 using ::testing::DoAll;
+using ::testing::Invoke;
 using ::testing::InvokeWithoutArgs;
 using ::testing::Return;
 using ::testing::SaveArg;
@@ -111,6 +115,154 @@ namespace iroha {
         auto response = network->SendState(&context, &request, nullptr);
         ASSERT_EQ(response.error_code(), grpc::StatusCode::CANCELLED);
       }
+
+      /**
+       * @given network which sends compact states
+       * @when two votes with equal hashes are sent
+       * @then round and hashes are sent once for the state
+       * @when the sent state is received
+       * @then votes with restored round and hashes are handled
+       */
+      TEST_F(YacNetworkTest, CompactStateSentAndReceived) {
+        network = std::make_shared<NetworkImpl>(
+            async_call,
+            [this](const shared_model::interface::Peer &) {
+              return std::unique_ptr<proto::Yac::StubInterface>(stub);
+            },
+            getTestLogger("YacNetwork"),
+            true);
+        network->subscribe(notifications);
+        message.hash.vote_round = {1, 2};
+        auto other_message = message;
+        other_message.signature = createSig("other");
+
+        proto::State request;
+        auto r = std::make_unique<grpc::testing::MockClientAsyncResponseReader<
+            google::protobuf::Empty>>();
+        EXPECT_CALL(*stub, AsyncSendStateRaw(_, _, _))
+            .WillOnce(DoAll(SaveArg<1>(&request), Return(r.get())));
+
+        network->sendState(*peer, {message, other_message});
+
+        ASSERT_EQ(request.votes_size(), 2);
+        for (const auto &pb_vote : request.votes()) {
+          ASSERT_FALSE(pb_vote.hash().has_vote_round());
+          ASSERT_FALSE(pb_vote.hash().has_vote_hashes());
+          ASSERT_TRUE(pb_vote.hash().has_block_signature());
+        }
+        ASSERT_EQ(request.vote_round().block_round(), 1);
+        ASSERT_EQ(request.vote_hashes().block(), "block");
+
+        std::vector<VoteMessage> state;
+        EXPECT_CALL(*notifications, onState(_))
+            .WillOnce(SaveArg<0>(&state));
+        grpc::ServerContext context;
+        auto response = network->SendState(&context, &request, nullptr);
+
+        ASSERT_EQ(response.error_code(), grpc::StatusCode::OK);
+        ASSERT_EQ(state.size(), 2);
+        ASSERT_EQ(state[0].hash, message.hash);
+        ASSERT_EQ(state[1].hash, message.hash);
+      }
+
+      /**
+       * @given network which streams states
+       * @when a state is sent
+       * @then it is written to the stream to the peer instead of a call
+       * @when the network is destroyed
+       * @then the stream is closed
+       */
+      TEST_F(YacNetworkTest, StateWrittenToStream) {
+        network = std::make_shared<NetworkImpl>(
+            async_call,
+            [this](const shared_model::interface::Peer &) {
+              return std::unique_ptr<proto::Yac::StubInterface>(stub);
+            },
+            getTestLogger("YacNetwork"),
+            false,
+            true);
+        // writer will be deleted by the stream
+        auto writer = new grpc::testing::MockClientWriter<proto::State>();
+        std::promise<proto::State> written;
+        EXPECT_CALL(*stub, SendStatesRaw(_, _)).WillOnce(Return(writer));
+        EXPECT_CALL(*stub, AsyncSendStateRaw(_, _, _)).Times(0);
+        EXPECT_CALL(*writer, Write(_, _))
+            .WillOnce(DoAll(Invoke([&written](const proto::State &state,
+                                              grpc::WriteOptions) {
+                              written.set_value(state);
+                            }),
+                            Return(true)));
+        EXPECT_CALL(*writer, WritesDone()).WillOnce(Return(true));
+        EXPECT_CALL(*writer, Finish()).WillOnce(Return(grpc::Status::OK));
+
+        network->sendState(*peer, {message});
+
+        auto state = written.get_future();
+        ASSERT_EQ(state.wait_for(std::chrono::seconds(5)),
+                  std::future_status::ready);
+        ASSERT_EQ(state.get().votes_size(), 1);
+
+        network.reset();
+      }
+
+      /**
+       * @given network which batches states
+       * @when states of two rounds are sent to a peer within the window
+       * @then they are sent in one message
+       * @when the message is received
+       * @then the state of every round is handled
+       */
+      TEST_F(YacNetworkTest, BatchedStatesSentAndReceived) {
+        auto timer_wheel = std::make_shared<TimerWheel>();
+        network = std::make_shared<NetworkImpl>(
+            async_call,
+            [this](const shared_model::interface::Peer &) {
+              return std::unique_ptr<proto::Yac::StubInterface>(stub);
+            },
+            getTestLogger("YacNetwork"),
+            false,
+            false,
+            std::chrono::milliseconds(20),
+            timer_wheel);
+        network->subscribe(notifications);
+        auto other_message = message;
+        other_message.hash.vote_round = {1, 1};
+
+        std::promise<proto::State> sent;
+        auto r = std::make_unique<grpc::testing::MockClientAsyncResponseReader<
+            google::protobuf::Empty>>();
+        EXPECT_CALL(*stub, AsyncSendStateRaw(_, _, _))
+            .WillOnce(DoAll(Invoke([&sent](grpc::ClientContext *,
+                                           const proto::State &state,
+                                           grpc::CompletionQueue *) {
+                              sent.set_value(state);
+                            }),
+                            Return(r.get())));
+
+        network->sendState(*peer, {message});
+        network->sendState(*peer, {other_message});
+
+        auto future = sent.get_future();
+        ASSERT_EQ(future.wait_for(std::chrono::seconds(5)),
+                  std::future_status::ready);
+        auto request = future.get();
+        ASSERT_EQ(request.votes_size(), 1);
+        ASSERT_EQ(request.batched_size(), 1);
+        ASSERT_EQ(request.batched(0).votes_size(), 1);
+
+        std::vector<VoteMessage> first, second;
+        EXPECT_CALL(*notifications, onState(_))
+            .WillOnce(SaveArg<0>(&first))
+            .WillOnce(SaveArg<0>(&second));
+        grpc::ServerContext context;
+        auto response = network->SendState(&context, &request, nullptr);
+
+        ASSERT_EQ(response.error_code(), grpc::StatusCode::OK);
+        ASSERT_EQ(first.size(), 1);
+        ASSERT_EQ(first[0].hash, message.hash);
+        ASSERT_EQ(second.size(), 1);
+        ASSERT_EQ(second[0].hash, other_message.hash);
+      }
     }  // namespace yac
   }    // namespace consensus
 }  // namespace iroha
@@ -6,6 +6,7 @@
 #include "consensus/yac/impl/peer_orderer_impl.hpp"
 
 #include <iostream>
+#include <random>
 #include <unordered_map>
 
 #include <boost/accumulators/accumulators.hpp>
@@ -74,6 +75,25 @@ TEST_F(YacPeerOrdererTest, PeerOrdererOrderingWhenInvokeNormalCase) {
   ASSERT_EQ(order.value().getPeers().size(), peers.size());
 }
 
+/**
+ * @given ledger peers
+ * @when orderings are requested for several hashes
+ * @then every ordering is the same as shuffling the peers with the hash as
+ * the seed, so that peers agree on the order regardless of caching
+ */
+TEST_F(YacPeerOrdererTest, OrderingIsSeededShuffle) {
+  for (const std::string hash : {"1", "2", "3"}) {
+    auto expected = s_peers;
+    std::seed_seq seed(hash.begin(), hash.end());
+    std::default_random_engine gen(seed);
+    std::shuffle(expected.begin(), expected.end(), gen);
+
+    auto order = orderer.getOrdering(
+        YacHash(iroha::consensus::Round{1, 1}, hash, hash), s_peers);
+    ASSERT_EQ(order.value().getPeers(), expected);
+  }
+}
+
 TEST_F(YacPeerOrdererTest, PeerOrdererOrderingWhenEmptyPeerList) {
   auto order = orderer.getOrdering(YacHash(), {});
   ASSERT_EQ(order, boost::none);
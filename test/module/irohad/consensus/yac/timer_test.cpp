@@ -5,56 +5,67 @@
 
 #include "consensus/yac/impl/timer_impl.hpp"
 
+#include <atomic>
+#include <future>
+
 #include <gtest/gtest.h>
-#include <rxcpp/rx-test.hpp>
 
 using namespace iroha::consensus::yac;
 
 class TimerTest : public ::testing::Test {
  protected:
   void SetUp() override {
-    timer = std::make_shared<TimerImpl>(delay, coordination);
+    timer = std::make_shared<TimerImpl>(delay, wheel);
   }
 
   void TearDown() override {
     timer.reset();
   }
 
+  /// wait for the handler which sets the promise
   void invokeTimer() {
-    worker.start();
+    ASSERT_EQ(invoked.get_future().wait_for(std::chrono::seconds(10)),
+              std::future_status::ready);
   }
 
  public:
-  std::chrono::milliseconds delay{0};
-  rxcpp::schedulers::test::test_worker worker =
-      rxcpp::schedulers::make_test().create_worker();
-  rxcpp::observe_on_one_worker coordination{
-      rxcpp::schedulers::make_same_worker(worker)};
+  std::chrono::milliseconds delay{10};
+  std::shared_ptr<iroha::TimerWheel> wheel =
+      std::make_shared<iroha::TimerWheel>(std::chrono::milliseconds(1));
   std::shared_ptr<Timer> timer;
+  std::promise<void> invoked;
 };
 
 TEST_F(TimerTest, NothingInvokedWhenDenied) {
-  int status = 0;
+  std::atomic<int> status{0};
 
   timer->invokeAfterDelay([&status] { status = 1; });
   timer->deny();
-  invokeTimer();
+  // the handler is removed from the wheel, so it never runs
+  ASSERT_EQ(wheel->size(), 0);
   ASSERT_EQ(status, 0);
 }
 
 TEST_F(TimerTest, FirstInvokedWhenOneSubmitted) {
-  int status = 0;
+  std::atomic<int> status{0};
 
-  timer->invokeAfterDelay([&status] { status = 1; });
+  timer->invokeAfterDelay([this, &status] {
+    status = 1;
+    invoked.set_value();
+  });
   invokeTimer();
   ASSERT_EQ(status, 1);
 }
 
 TEST_F(TimerTest, SecondInvokedWhenTwoSubmitted) {
-  int status = 0;
+  std::atomic<int> status{0};
 
   timer->invokeAfterDelay([&status] { status = 1; });
-  timer->invokeAfterDelay([&status] { status = 2; });
+  timer->invokeAfterDelay([this, &status] {
+    status = 2;
+    invoked.set_value();
+  });
   invokeTimer();
+  ASSERT_EQ(wheel->size(), 0);
   ASSERT_EQ(status, 2);
 }
@@ -102,3 +102,19 @@ TEST_F(YacBlockStorageTest, YacBlockStorageWhenIsContains) {
   ASSERT_TRUE(storage.isContains(valid_votes.at(0)));
   ASSERT_FALSE(storage.isContains(valid_votes.at(3)));
 }
+
+/**
+ * @given block storage with a vote
+ * @when the vote of the same peer is inserted again
+ * @and a vote of the peer for another hash is checked
+ * @then the vote is counted once
+ * @and the vote for another hash is not contained
+ */
+TEST_F(YacBlockStorageTest, YacBlockStorageWhenVoteRepeated) {
+  storage.insert(valid_votes.at(0));
+  storage.insert(valid_votes.at(0));
+
+  ASSERT_EQ(1, storage.getNumberOfVotes());
+  ASSERT_FALSE(storage.isContains(createVote(
+      YacHash(iroha::consensus::Round{1, 1}, "proposal", "other"), "0")));
+}
@@ -7,6 +7,7 @@
 
 #include <gtest/gtest.h>
 
+#include "common/thread_pool.hpp"
 #include "consensus/yac/outcome_messages.hpp"
 #include "cryptography/crypto_provider/crypto_defaults.hpp"
 
@@ -75,6 +76,30 @@ namespace iroha {
         ASSERT_FALSE(crypto_provider->verify({vote}));
       }
 
+      /**
+       * @given crypto provider which verifies votes on a thread pool
+       * @when votes are valid
+       * @then they are verified
+       * @when one of them is changed
+       * @then verification fails
+       */
+      TEST_F(YacCryptoProviderTest, ParallelVerification) {
+        crypto_provider = std::make_shared<CryptoProviderImpl>(
+            keypair, std::make_shared<ThreadPool>(2));
+        std::vector<VoteMessage> votes;
+        for (int i = 0; i < 4; ++i) {
+          YacHash hash(Round{1, 1}, "1", "1");
+          hash.block_signature = makeSignature();
+          votes.push_back(crypto_provider->getVote(hash));
+        }
+
+        ASSERT_TRUE(crypto_provider->verify(votes));
+
+        votes[2].hash.vote_hashes.block_hash = "hash changed";
+
+        ASSERT_FALSE(crypto_provider->verify(votes));
+      }
+
     }  // namespace yac
   }    // namespace consensus
 }  // namespace iroha
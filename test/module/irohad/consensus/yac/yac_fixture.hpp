@@ -60,7 +60,11 @@ namespace iroha {
           network->release();
         }
 
-        void initYac(ClusterOrdering ordering) {
+        void initYac(
+            ClusterOrdering ordering,
+            size_t commit_fanout = 0,
+            boost::optional<shared_model::interface::types::PubkeyType>
+                own_key = boost::none) {
           yac = Yac::create(
               YacVoteStorage(
                   std::make_shared<
@@ -74,7 +78,9 @@ namespace iroha {
               initial_round,
               rxcpp::observe_on_one_worker(
                   rxcpp::schedulers::make_current_thread()),
-              getTestLogger("Yac"));
+              getTestLogger("Yac"),
+              commit_fanout,
+              std::move(own_key));
           network->subscribe(yac);
         }
       };
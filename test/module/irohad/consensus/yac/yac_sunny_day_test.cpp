@@ -204,3 +204,62 @@ TEST_F(YacTest, ValidCaseWhenVoteAfterCommit) {
 
   yac->vote(my_hash, my_order.value());
 }
+
+/**
+ * @given yac with commit fan-out 2 as the peer at position 3 of 7 peers
+ * @when it collects supermajority of votes
+ * @then the commit is sent only to the root of the fan-out tree and to itself
+ */
+TEST_F(YacTest, CommitFanoutSentToRoot) {
+  auto my_order = ClusterOrdering::create(default_peers);
+  ASSERT_TRUE(my_order);
+
+  initYac(my_order.value(), 2, default_peers.at(3)->pubkey());
+
+  EXPECT_CALL(*network, sendState(::testing::Ref(*default_peers.at(0)), _))
+      .Times(1);
+  EXPECT_CALL(*network, sendState(::testing::Ref(*default_peers.at(3)), _))
+      .Times(1);
+
+  EXPECT_CALL(*crypto, verify(_)).WillRepeatedly(Return(true));
+
+  YacHash my_hash(initial_round, "proposal_hash", "block_hash");
+  for (auto i = 0; i < 5; ++i) {
+    yac->onState({createVote(my_hash, std::to_string(i))});
+  }
+}
+
+/**
+ * @given yac with commit fan-out 2 as the peer at position 1 of 7 peers
+ * @when it receives a commit
+ * @then the commit is forwarded only to its children at positions 3 and 4
+ * @and the commit is emitted
+ */
+TEST_F(YacTest, CommitFanoutForwardedToChildren) {
+  auto my_order = ClusterOrdering::create(default_peers);
+  ASSERT_TRUE(my_order);
+
+  initYac(my_order.value(), 2, default_peers.at(1)->pubkey());
+
+  EXPECT_CALL(*network, sendState(::testing::Ref(*default_peers.at(3)), _))
+      .Times(1);
+  EXPECT_CALL(*network, sendState(::testing::Ref(*default_peers.at(4)), _))
+      .Times(1);
+
+  EXPECT_CALL(*timer, deny()).Times(AtLeast(1));
+
+  EXPECT_CALL(*crypto, verify(_)).WillRepeatedly(Return(true));
+
+  YacHash my_hash(initial_round, "proposal_hash", "block_hash");
+  auto wrapper = make_test_subscriber<CallExact>(yac->onOutcome(), 1);
+  wrapper.subscribe([my_hash](auto val) {
+    ASSERT_EQ(my_hash, boost::get<CommitMessage>(val).votes.at(0).hash);
+  });
+
+  std::vector<VoteMessage> votes;
+  for (auto i = 0; i < 5; ++i) {
+    votes.push_back(createVote(my_hash, std::to_string(i)));
+  }
+  yac->onState(votes);
+  ASSERT_TRUE(wrapper.validate());
+}
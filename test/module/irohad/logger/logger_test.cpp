@@ -19,6 +19,51 @@ TEST(LoggerTest, basicStandaloneLoggerTest) {
   a_logger->error("testing a standalone logger: error");
 }
 
+/// Counts how many times it was converted to string for logging
+struct FormatCounter {
+  std::string toString() const {
+    ++count;
+    return "counter";
+  }
+  mutable int count = 0;
+};
+
+/**
+ * @given logger with info level
+ * @when an object is logged with debug and info levels
+ * @then the object is formatted only for the enabled info level
+ */
+TEST(LoggerTest, disabledLevelIsNotFormatted) {
+  logger::LoggerConfig config;
+  config.log_level = logger::LogLevel::kInfo;
+  logger::LoggerManagerTree manager(
+      std::make_unique<const logger::LoggerConfig>(std::move(config)));
+  auto a_logger = manager.getChild("test lazy logger")->getLogger();
+  FormatCounter counter;
+  a_logger->debug("disabled: {}", counter);
+  ASSERT_EQ(counter.count, 0);
+  a_logger->info("enabled: {}", counter);
+  ASSERT_EQ(counter.count, 1);
+}
+
+/**
+ * @given asynchronous logger with a small queue dropping old messages
+ * @when more messages than the queue holds are logged
+ * @then logging does not block
+ */
+TEST(LoggerTest, asyncLoggerTest) {
+  logger::LoggerConfig config;
+  config.log_level = logger::LogLevel::kInfo;
+  config.async =
+      logger::AsyncLogConfig{16, logger::LogOverflowPolicy::kDropOldest};
+  logger::LoggerManagerTree manager(
+      std::make_unique<const logger::LoggerConfig>(std::move(config)));
+  auto a_logger = manager.getChild("test async logger")->getLogger();
+  for (int i = 0; i < 100; ++i) {
+    a_logger->info("testing an asynchronous logger: {}", i);
+  }
+}
+
 TEST(LoggerTest, boolReprTest) {
   ASSERT_EQ("true", logger::boolRepr(true));
   ASSERT_EQ("false", logger::boolRepr(false));
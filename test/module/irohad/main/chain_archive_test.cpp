@@ -0,0 +1,170 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "main/chain_archive.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <zlib.h>
+#include <boost/filesystem.hpp>
+#include "backend/protobuf/proto_block_factory.hpp"
+#include "common/thread_pool.hpp"
+#include "framework/result_fixture.hpp"
+#include "framework/test_logger.hpp"
+#include "module/irohad/ametsuchi/mock_block_query.hpp"
+#include "module/irohad/ametsuchi/mock_mutable_storage.hpp"
+#include "module/irohad/ametsuchi/mock_storage.hpp"
+#include "module/shared_model/builders/protobuf/test_block_builder.hpp"
+#include "module/shared_model/validators/validators.hpp"
+
+using namespace iroha;
+using namespace iroha::ametsuchi;
+using namespace framework::expected;
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+class ChainArchiveTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    archive = std::make_unique<main::ChainArchive>(
+        std::make_unique<shared_model::proto::ProtoBlockFactory>(
+            std::make_unique<NiceMock<shared_model::validation::MockValidator<
+                shared_model::interface::Block>>>(),
+            std::make_unique<NiceMock<
+                shared_model::validation::MockValidator<protocol::Block>>>()),
+        std::make_shared<ThreadPool>(2),
+        getTestLogger("ChainArchive"));
+
+    shared_model::crypto::Hash prev_hash("");
+    for (size_t height = 1; height <= kBlocks; ++height) {
+      blocks.push_back(createBlock({}, height, prev_hash));
+      prev_hash = blocks.back()->hash();
+    }
+
+    EXPECT_CALL(block_query, getTopBlockHeight())
+        .WillRepeatedly(Return(kBlocks));
+    EXPECT_CALL(block_query, getBlock(_))
+        .WillRepeatedly(Invoke([this](auto height) -> BlockQuery::BlockResult {
+          return expected::makeValue(blocks.at(height - 1));
+        }));
+  }
+
+  void TearDown() override {
+    boost::filesystem::remove(path);
+  }
+
+  /// read the uncompressed contents of the archive
+  std::string readArchive() {
+    auto file = gzopen(path.c_str(), "rb");
+    std::string contents;
+    char buffer[4096];
+    int read;
+    while ((read = gzread(file, buffer, sizeof(buffer))) > 0) {
+      contents.append(buffer, static_cast<size_t>(read));
+    }
+    gzclose(file);
+    return contents;
+  }
+
+  /// replace the archive with the given uncompressed contents
+  void writeArchive(const std::string &contents) {
+    auto file = gzopen(path.c_str(), "wb");
+    gzwrite(file, contents.data(), static_cast<unsigned>(contents.size()));
+    gzclose(file);
+  }
+
+  /// header followed by the size of the first record
+  static constexpr size_t kFirstRecordOffset = 8 + 4 + 4;
+  static constexpr size_t kBlocks = 3;
+
+  std::unique_ptr<main::ChainArchive> archive;
+  std::vector<std::shared_ptr<const shared_model::interface::Block>> blocks;
+  NiceMock<MockBlockQuery> block_query;
+  MockStorage storage;
+  std::string path = (boost::filesystem::temp_directory_path()
+                      / boost::filesystem::unique_path())
+                         .string();
+};
+
+constexpr size_t ChainArchiveTest::kFirstRecordOffset;
+constexpr size_t ChainArchiveTest::kBlocks;
+
+/**
+ * @given ledger with several blocks
+ * @when the ledger is exported @and the archive is imported
+ * @then the same blocks are committed in the same order
+ */
+TEST_F(ChainArchiveTest, RoundTrip) {
+  ASSERT_TRUE(val(archive->exportChain(block_query, path)));
+
+  std::vector<std::shared_ptr<const shared_model::interface::Block>> imported;
+  EXPECT_CALL(storage, createMutableStorage())
+      .WillOnce(Invoke([&imported]() {
+        auto mutable_storage = std::make_unique<MockMutableStorage>();
+        EXPECT_CALL(
+            *mutable_storage,
+            apply(::testing::A<
+                  std::shared_ptr<const shared_model::interface::Block>>()))
+            .WillRepeatedly(Invoke([&imported](auto block) {
+              imported.push_back(block);
+              return true;
+            }));
+        return expected::makeValue<std::unique_ptr<MutableStorage>>(
+            std::move(mutable_storage));
+      }));
+  EXPECT_CALL(storage, doCommit(_))
+      .WillOnce(Return(expected::makeValue(std::make_shared<LedgerState>(
+          shared_model::interface::types::PeerList{},
+          blocks.back()->height(),
+          blocks.back()->hash()))));
+
+  auto result = archive->importChain(path, storage);
+  ASSERT_TRUE(val(result)) << err(result)->error;
+  EXPECT_EQ(val(result)->value, kBlocks);
+
+  ASSERT_EQ(imported.size(), blocks.size());
+  for (size_t i = 0; i < blocks.size(); ++i) {
+    EXPECT_EQ(imported[i]->height(), blocks[i]->height());
+    EXPECT_EQ(imported[i]->hash(), blocks[i]->hash());
+  }
+}
+
+/**
+ * @given exported archive with a byte of a record changed
+ * @when the archive is verified @and imported
+ * @then both fail on the checksum @and the storage is never touched
+ */
+TEST_F(ChainArchiveTest, CorruptedRecordIsRejected) {
+  ASSERT_TRUE(val(archive->exportChain(block_query, path)));
+  auto contents = readArchive();
+  ASSERT_GT(contents.size(), kFirstRecordOffset);
+  contents[kFirstRecordOffset] ^= 1;
+  writeArchive(contents);
+
+  EXPECT_CALL(storage, createMutableStorage()).Times(0);
+
+  auto verified = archive->verifyChain(path);
+  ASSERT_TRUE(err(verified));
+  EXPECT_THAT(err(verified)->error, ::testing::HasSubstr("checksum"));
+  EXPECT_TRUE(err(archive->importChain(path, storage)));
+}
+
+/**
+ * @given exported archive without its terminating record
+ * @when the archive is verified
+ * @then verification fails
+ */
+TEST_F(ChainArchiveTest, TruncatedArchiveIsRejected) {
+  ASSERT_TRUE(val(archive->exportChain(block_query, path)));
+  auto contents = readArchive();
+  // the terminating record of zero size and the number of blocks
+  contents.resize(contents.size() - 4 - 8);
+  writeArchive(contents);
+
+  EXPECT_TRUE(err(archive->verifyChain(path)));
+}
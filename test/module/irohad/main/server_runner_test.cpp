@@ -60,3 +60,22 @@ TEST(ServerRunnerTest, SamePortWithReuse) {
   port = boost::apply_visitor(port_visitor, result);
   ASSERT_NE(0, port);
 }
+
+/**
+ * @given a ServerRunner with several completion queues and fixed number of
+ * threads serving them
+ * @when it is run
+ * @then Result with port number is returned
+ */
+TEST(ServerRunnerTest, SeveralCompletionQueues) {
+  ServerRunner runner((address % 0).str(),
+                      getTestLogger("ServerRunner"),
+                      true,
+                      ServerRunner::ThreadingOptions{2, 2});
+  auto query_service =
+      std::make_shared<iroha::protocol::QueryService_v1::Service>();
+  auto result = runner.append(query_service).run();
+  auto port = boost::apply_visitor(port_visitor, result);
+  ASSERT_NE(0, port);
+  runner.shutdown();
+}
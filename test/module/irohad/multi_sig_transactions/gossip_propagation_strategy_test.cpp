@@ -84,7 +84,7 @@ PropagationData subscribeAndEmit(boost::optional<PropagationData> data,
   gossip_params.emission_period = period;
   gossip_params.amount_per_once = amount;
   GossipPropagationStrategy strategy(
-      pbfactory, rxcpp::observe_on_event_loop(), gossip_params);
+      pbfactory, std::make_shared<TimerWheel>(1ms), gossip_params);
   return subscribeAndEmit(strategy, take);
 }
 
@@ -196,7 +196,7 @@ TEST(GossipPropagationStrategyTest, MultipleSubsEmission) {
   gossip_params.emission_period = 1ms;
   gossip_params.amount_per_once = amount;
   GossipPropagationStrategy strategy(
-      pbfactory, rxcpp::observe_on_new_thread(), gossip_params);
+      pbfactory, std::make_shared<TimerWheel>(1ms), gossip_params);
 
   // Create separate subscriber for every thread
   // Use result[i] as storage for emitent for i-th one
@@ -213,3 +213,72 @@ TEST(GossipPropagationStrategyTest, MultipleSubsEmission) {
     ASSERT_TRUE(validateEmitted(result[i], peersId));
   });
 }
+
+/**
+ * @given list of peers and strategy that emits two peers
+ * @when large states are reported to be propagated
+ * @then ensure that more peers are emitted per once, up to the maximum
+ */
+TEST(GossipPropagationStrategyTest, AmountGrowsWithPropagatedStates) {
+  std::vector<std::string> peersId;
+  PropagationData peers = generate(peersId, 20);
+
+  auto query = std::make_shared<MockPeerQuery>();
+  auto pbfactory = std::make_shared<MockPeerQueryFactory>();
+  EXPECT_CALL(*pbfactory, createPeerQuery())
+      .WillRepeatedly(testing::Return(boost::make_optional(
+          std::shared_ptr<iroha::ametsuchi::PeerQuery>(query))));
+  EXPECT_CALL(*query, getLedgerPeers()).WillRepeatedly(testing::Return(peers));
+  iroha::GossipPropagationStrategyParams gossip_params;
+  gossip_params.emission_period = 1ms;
+  gossip_params.amount_per_once = 2;
+  gossip_params.max_amount_per_once = 5;
+  gossip_params.batches_per_extra_peer = 10;
+  GossipPropagationStrategy strategy(
+      pbfactory, std::make_shared<TimerWheel>(1ms), gossip_params);
+
+  auto last_emitted_size = [&strategy] {
+    size_t size = 0;
+    // the first emitting may have started before the report
+    strategy.emitter().take(2).as_blocking().subscribe(
+        [&size](const auto &peers) { size = peers.size(); });
+    return size;
+  };
+
+  strategy.onPropagated(1, 25);
+  EXPECT_EQ(last_emitted_size(), 4);
+  strategy.onPropagated(1, 1000);
+  EXPECT_EQ(last_emitted_size(), 5);
+  strategy.onPropagated(1, 0);
+  EXPECT_EQ(last_emitted_size(), 2);
+}
+
+/**
+ * @given a running strategy which emits 2 peers per once
+ * @when its parameters are changed to emit 3 peers
+ * @then 3 peers are emitted afterwards
+ */
+TEST(GossipPropagationStrategyTest, ParamsAreChangedAtRuntime) {
+  std::vector<std::string> peersId;
+  PropagationData peers = generate(peersId, 20);
+
+  auto query = std::make_shared<MockPeerQuery>();
+  auto pbfactory = std::make_shared<MockPeerQueryFactory>();
+  EXPECT_CALL(*pbfactory, createPeerQuery())
+      .WillRepeatedly(testing::Return(boost::make_optional(
+          std::shared_ptr<iroha::ametsuchi::PeerQuery>(query))));
+  EXPECT_CALL(*query, getLedgerPeers()).WillRepeatedly(testing::Return(peers));
+  iroha::GossipPropagationStrategyParams gossip_params;
+  gossip_params.emission_period = 1ms;
+  gossip_params.amount_per_once = 2;
+  GossipPropagationStrategy strategy(
+      pbfactory, std::make_shared<TimerWheel>(1ms), gossip_params);
+
+  gossip_params.amount_per_once = 3;
+  strategy.setParams(gossip_params);
+  size_t size = 0;
+  // the first emitting may have started before the change
+  strategy.emitter().take(2).as_blocking().subscribe(
+      [&size](const auto &peers) { size = peers.size(); });
+  EXPECT_EQ(size, 3);
+}
@@ -0,0 +1,123 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "multi_sig_transactions/storage/mst_journal.hpp"
+
+#include <set>
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include "backend/protobuf/transaction.hpp"
+#include "framework/test_logger.hpp"
+#include "module/irohad/multi_sig_transactions/mst_test_helpers.hpp"
+
+using namespace iroha;
+
+class MstJournalTest : public ::testing::Test {
+ public:
+  void TearDown() override {
+    boost::filesystem::remove(path);
+  }
+
+  std::unique_ptr<MstJournal> open() {
+    auto journal = expected::resultToOptionalValue(
+        MstJournal::open(path, getTestLogger("MstJournal")));
+    EXPECT_TRUE(journal);
+    return journal ? std::move(*journal) : nullptr;
+  }
+
+  /// @return state holding the batch
+  MstState stateOf(const DataType &batch) {
+    auto state = MstState::empty(getTestLogger("MstState"), completer);
+    state += batch;
+    return state;
+  }
+
+  /// @return payload of the first transaction of the batch
+  static std::string payloadOf(const MstJournal::Batch &batch) {
+    return batch.front().payload().SerializeAsString();
+  }
+
+  static std::string payloadOf(const DataType &batch) {
+    return static_cast<const shared_model::proto::Transaction &>(
+               *batch->transactions().front())
+        .getTransport()
+        .payload()
+        .SerializeAsString();
+  }
+
+  const std::string path = (boost::filesystem::temp_directory_path()
+                            / boost::filesystem::unique_path())
+                               .string();
+  std::shared_ptr<TestCompleter> completer = std::make_shared<TestCompleter>();
+  TimeType time = iroha::time::now();
+};
+
+/**
+ * @given a journal with two updated batches
+ * @when it is reopened
+ * @then both batches are restored
+ */
+TEST_F(MstJournalTest, UpdatedBatchesAreRestored) {
+  auto first = makeTestBatch(txBuilder(1, time));
+  auto second = makeTestBatch(txBuilder(2, time));
+  {
+    auto journal = open();
+    ASSERT_TRUE(journal);
+    journal->update(stateOf(first));
+    journal->update(stateOf(second));
+    journal->update(stateOf(first));
+  }
+  auto restored = open()->takeRestored();
+  ASSERT_EQ(restored.size(), 2);
+  std::set<std::string> payloads{payloadOf(restored[0]),
+                                 payloadOf(restored[1])};
+  EXPECT_EQ(payloads,
+            (std::set<std::string>{payloadOf(first), payloadOf(second)}));
+}
+
+/**
+ * @given a journal with an updated batch which is then erased
+ * @when it is reopened
+ * @then nothing is restored
+ */
+TEST_F(MstJournalTest, ErasedBatchIsNotRestored) {
+  auto batch = makeTestBatch(txBuilder(1, time));
+  {
+    auto journal = open();
+    ASSERT_TRUE(journal);
+    journal->update(stateOf(batch));
+    journal->erase(stateOf(batch));
+  }
+  EXPECT_TRUE(open()->takeRestored().empty());
+}
+
+/**
+ * @given a journal whose last record was interrupted
+ * @when it is reopened
+ * @then the batches of the complete records are restored
+ */
+TEST_F(MstJournalTest, IncompleteRecordIsSkipped) {
+  {
+    auto journal = open();
+    ASSERT_TRUE(journal);
+    journal->update(stateOf(makeTestBatch(txBuilder(1, time))));
+    journal->update(stateOf(makeTestBatch(txBuilder(2, time))));
+  }
+  boost::filesystem::resize_file(path, boost::filesystem::file_size(path) - 2);
+  EXPECT_EQ(open()->takeRestored().size(), 1);
+}
+
+/**
+ * @given a file which is not a journal
+ * @when it is opened
+ * @then an error is returned and the file is kept
+ */
+TEST_F(MstJournalTest, OtherFileIsRefused) {
+  std::ofstream(path) << "not a journal";
+  EXPECT_TRUE(expected::hasError(
+      MstJournal::open(path, getTestLogger("MstJournal"))));
+  EXPECT_EQ(boost::filesystem::file_size(path), 13);
+}
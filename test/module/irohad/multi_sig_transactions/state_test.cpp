@@ -236,6 +236,40 @@ TEST(StateTest, DifferenceTest) {
   ASSERT_EQ(*expected_batch, **diff.getBatches().begin());
 }
 
+/**
+ * @given a state with batches of different creation time
+ * @when  difference with a state containing one of them is taken
+ * @then  the difference keeps the other batches ordered by time, so that
+ * expiration extracts only the older one
+ */
+TEST(StateTest, DifferenceKeepsTimeIndex) {
+  auto time = iroha::time::now();
+
+  auto old_batch = addSignatures(
+      makeTestBatch(txBuilder(1, time)), 0, makeSignature("1", "1"));
+  auto common_batch = addSignatures(
+      makeTestBatch(txBuilder(2, time + 1)), 0, makeSignature("2", "2"));
+  auto new_batch = addSignatures(
+      makeTestBatch(txBuilder(3, time + 2)), 0, makeSignature("3", "3"));
+
+  auto state1 = MstState::empty(mst_state_log_, completer_);
+  state1 += new_batch;
+  state1 += common_batch;
+  state1 += old_batch;
+
+  auto state2 = MstState::empty(mst_state_log_, completer_);
+  state2 += common_batch;
+
+  auto diff = state1 - state2;
+  ASSERT_EQ(2, diff.size());
+
+  auto expired_state = diff.extractExpired(time + 1);
+  ASSERT_EQ(1, expired_state.size());
+  ASSERT_EQ(*old_batch, **expired_state.getBatches().begin());
+  ASSERT_EQ(1, diff.size());
+  ASSERT_TRUE(diff.contains(new_batch));
+}
+
 /**
  * @given an empty state
  * @when a partially signed transaction with quorum 3 is inserted 3 times
@@ -117,3 +117,136 @@ TEST_F(StorageTest, StorageDoesNotFindNonExistingBatch) {
   auto distinct_batch = makeTestBatch(txBuilder(4, creation_time));
   EXPECT_FALSE(storage->batchInStorage(distinct_batch));
 }
+
+/**
+ * @given storage with three batches
+ * @when diff for a peer is taken twice
+ * AND a batch is updated with a new signature
+ * AND diff for the peer is taken again
+ * @then the first diff contains all batches, the second one is empty and the
+ * last one contains only the updated batch
+ */
+TEST_F(StorageTest, DiffContainsOnlyUpdatedBatches) {
+  const shared_model::crypto::PublicKey peer_key("peer");
+
+  ASSERT_EQ(3, storage->getDiffState(peer_key, creation_time).size());
+  ASSERT_EQ(0, storage->getDiffState(peer_key, creation_time).size());
+
+  auto updated_batch = addSignatures(makeTestBatch(txBuilder(2, creation_time)),
+                                     0,
+                                     makeSignature("1", "pub_key_1"));
+  storage->updateOwnState(updated_batch);
+
+  auto diff = storage->getDiffState(peer_key, creation_time);
+  ASSERT_EQ(1, diff.size());
+  EXPECT_TRUE(diff.contains(updated_batch));
+  ASSERT_EQ(3, storage->getDiffState(absent_peer_key, creation_time).size());
+}
+
+/**
+ * @given storage with three batches sending the whole state every minute
+ * @when diff for a peer is taken
+ * AND diff for the peer is taken again in less than a minute
+ * AND diff for the peer is taken again after a minute
+ * @then the first and the last diffs contain all batches, since previous
+ * diffs might have not been delivered, and the second one is empty
+ */
+TEST_F(StorageTest, DiffContainsWholeStatePeriodically) {
+  const shared_model::crypto::PublicKey peer_key("peer");
+  const auto minute = 60 * 1000;
+  // batches are expired after their creation time
+  const auto time = creation_time - 2 * minute;
+
+  ASSERT_EQ(3, storage->getDiffState(peer_key, time).size());
+  ASSERT_EQ(0, storage->getDiffState(peer_key, time + minute - 1).size());
+  ASSERT_EQ(3, storage->getDiffState(peer_key, time + minute).size());
+}
+
+/**
+ * @given storage with three batches
+ * @when a peer sends a state with a new batch
+ * @then the diff for this peer does not contain the batch
+ * AND the diff for another peer contains it
+ */
+TEST_F(StorageTest, DiffDoesNotContainBatchesOfTargetPeer) {
+  const shared_model::crypto::PublicKey peer_key("peer");
+  auto new_state = MstState::empty(getTestLogger("MstState"), completer_);
+  auto new_batch = makeTestBatch(txBuilder(4, creation_time));
+  new_state += new_batch;
+
+  storage->apply(peer_key, new_state);
+
+  auto diff = storage->getDiffState(peer_key, creation_time);
+  ASSERT_EQ(3, diff.size());
+  EXPECT_FALSE(diff.contains(new_batch));
+  EXPECT_TRUE(
+      storage->getDiffState(absent_peer_key, creation_time).contains(new_batch));
+}
+
+/// @return total size of payloads of transactions of the batch
+static size_t payloadsSize(const DataType &batch) {
+  size_t size = 0;
+  for (const auto &tx : batch->transactions()) {
+    size += tx->payload().size();
+  }
+  return size;
+}
+
+/**
+ * @given storage limited to the size of two batches
+ * @when three batches are added in order of their creation time
+ * @then the oldest batch is shed
+ * AND it is returned with the expired batches
+ */
+TEST_F(StorageTest, OldestBatchesAreShedOverBudget) {
+  auto batch1 = makeTestBatch(txBuilder(1, creation_time));
+  auto batch2 = makeTestBatch(txBuilder(2, creation_time + 1));
+  auto batch3 = makeTestBatch(txBuilder(3, creation_time + 2));
+  storage = std::make_shared<MstStorageStateImpl>(completer_,
+                                                  getTestLogger("MstState"),
+                                                  getTestLogger("MstStorage"),
+                                                  2 * payloadsSize(batch1));
+
+  storage->updateOwnState(batch1);
+  storage->updateOwnState(batch2);
+  auto state_update = storage->updateOwnState(batch3);
+
+  EXPECT_TRUE(state_update.updated_state_->contains(batch3));
+  EXPECT_FALSE(storage->batchInStorage(batch1));
+  EXPECT_TRUE(storage->batchInStorage(batch2));
+  EXPECT_TRUE(storage->batchInStorage(batch3));
+  auto expired = storage->extractExpiredTransactions(creation_time);
+  ASSERT_EQ(1, expired.size());
+  EXPECT_TRUE(expired.contains(batch1));
+  EXPECT_EQ(0, storage->extractExpiredTransactions(creation_time).size());
+}
+
+/**
+ * @given storage with a quota of a creator account
+ * @when the creator exceeds the quota with a batch AND sends one more batch
+ * AND another creator sends a batch
+ * @then only the batch of the creator over the quota is shed
+ */
+TEST_F(StorageTest, BatchesOfCreatorOverQuotaAreShed) {
+  auto batch1 = makeTestBatch(txBuilder(1, creation_time));
+  auto batch2 = makeTestBatch(txBuilder(2, creation_time));
+  auto other_batch =
+      makeTestBatch(txBuilder(3, creation_time, 3, "other@test"));
+  storage = std::make_shared<MstStorageStateImpl>(completer_,
+                                                  getTestLogger("MstState"),
+                                                  getTestLogger("MstStorage"),
+                                                  0,
+                                                  payloadsSize(batch1));
+
+  storage->updateOwnState(batch1);
+  auto state_update = storage->updateOwnState(batch2);
+  storage->updateOwnState(other_batch);
+
+  EXPECT_TRUE(state_update.updated_state_->isEmpty());
+  EXPECT_TRUE(storage->batchInStorage(batch1));
+  EXPECT_FALSE(storage->batchInStorage(batch2));
+  EXPECT_TRUE(storage->batchInStorage(other_batch));
+  auto expired = storage->extractExpiredTransactions(creation_time);
+  ASSERT_EQ(1, expired.size());
+  EXPECT_TRUE(expired.contains(batch2));
+}
@@ -243,3 +243,94 @@ TEST_F(TransportTest, ReplayAttack) {
   transport->SendState(&context, &proto_state, &response);
   transport->SendState(&context, &proto_state, &response);
 }
+
+/**
+ * @given transport which sends signature deltas
+ * AND a state with a batch
+ * @when the state is sent to a peer three times, a signature is added to the
+ * batch before the last time
+ * @then the batch is sent with payload the first time, nothing is sent the
+ * second time and only the new signature is sent the last time
+ * AND the receiver restores the batch with both signatures
+ */
+TEST_F(TransportTest, SignatureDeltas) {
+  EXPECT_CALL(*tx_presence_cache_,
+              check(A<const shared_model::interface::TransactionBatch &>()))
+      .WillRepeatedly(Invoke([](const auto &batch) {
+        iroha::ametsuchi::TxPresenceCache::BatchStatusCollectionType result;
+        std::transform(
+            batch.transactions().begin(),
+            batch.transactions().end(),
+            std::back_inserter(result),
+            [](auto &tx) {
+              return iroha::ametsuchi::tx_cache_status_responses::Missing{
+                  tx->hash()};
+            });
+        return result;
+      }));
+
+  std::vector<transport::MstState> requests;
+  std::vector<std::unique_ptr<
+      grpc::testing::MockClientAsyncResponseReader<google::protobuf::Empty>>>
+      readers;
+  MstTransportGrpc::SenderFactory sender_factory(
+      [&](const shared_model::interface::Peer &peer) {
+        auto stub = std::make_unique<transport::MockMstTransportGrpcStub>();
+        readers.push_back(
+            std::make_unique<grpc::testing::MockClientAsyncResponseReader<
+                google::protobuf::Empty>>());
+        EXPECT_CALL(*stub, AsyncSendStateRaw(_, _, _))
+            .WillOnce(Invoke([&](::grpc::ClientContext *,
+                                 const transport::MstState &request,
+                                 ::grpc::CompletionQueue *) {
+              requests.push_back(request);
+              return readers.back().get();
+            }));
+        return std::unique_ptr<transport::MstTransportGrpc::StubInterface>(
+            std::move(stub));
+      });
+  auto delta_transport =
+      std::make_shared<MstTransportGrpc>(async_call_,
+                                         tx_factory,
+                                         parser_,
+                                         batch_factory_,
+                                         tx_presence_cache_,
+                                         completer_,
+                                         my_key_.publicKey(),
+                                         getTestLogger("MstState"),
+                                         getTestLogger("MstTransportGrpc"),
+                                         sender_factory,
+                                         true);
+
+  auto batch = addSignaturesFromKeyPairs(
+      makeTestBatch(txBuilder(1, iroha::time::now())), 0, makeKey());
+  auto state = iroha::MstState::empty(getTestLogger("MstState"), completer_);
+  state += batch;
+
+  delta_transport->sendState(*peer, state);
+  delta_transport->sendState(*peer, state);
+  addSignaturesFromKeyPairs(batch, 0, makeKey());
+  delta_transport->sendState(*peer, state);
+
+  ASSERT_EQ(requests.size(), 2);
+  EXPECT_EQ(requests.at(0).transactions_size(), 1);
+  EXPECT_EQ(requests.at(0).signatures_size(), 0);
+  EXPECT_EQ(requests.at(1).transactions_size(), 0);
+  ASSERT_EQ(requests.at(1).signatures_size(), 1);
+  EXPECT_EQ(requests.at(1).signatures(0).signatures_size(), 1);
+
+  EXPECT_CALL(*mst_notification_transport_, onNewState(_, _))
+      .WillOnce(Return())
+      .WillOnce(Invoke([](::testing::Unused, const iroha::MstState &state) {
+        auto batches = state.getBatches();
+        ASSERT_EQ(batches.size(), 1);
+        EXPECT_EQ(boost::size(
+                      (*batches.begin())->transactions().at(0)->signatures()),
+                  2);
+      }));
+
+  grpc::ServerContext context;
+  google::protobuf::Empty response;
+  transport->SendState(&context, &requests.at(0), &response);
+  transport->SendState(&context, &requests.at(1), &response);
+}
@@ -0,0 +1,133 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/async_grpc_client.hpp"
+
+#include <condition_variable>
+#include <mutex>
+
+#include <grpc++/grpc++.h>
+#include <gtest/gtest.h>
+#include "framework/test_logger.hpp"
+#include "yac.grpc.pb.h"
+
+using namespace iroha::network;
+using namespace iroha::consensus::yac;
+
+/**
+ * Yac service counting the received states
+ */
+class CountingYacService : public proto::Yac::Service {
+ public:
+  grpc::Status SendState(grpc::ServerContext *context,
+                         const proto::State *request,
+                         google::protobuf::Empty *response) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++states_;
+    cv_.notify_all();
+    return grpc::Status::OK;
+  }
+
+  /// @return true if the number of states is received in time
+  bool waitStates(size_t states) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return cv_.wait_for(lock, std::chrono::seconds(10), [&] {
+      return states_ >= states;
+    });
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  size_t states_ = 0;
+};
+
+class AsyncGrpcClientTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    grpc::ServerBuilder builder;
+    int port = 0;
+    builder.AddListeningPort(
+        "127.0.0.1:0", grpc::InsecureServerCredentials(), &port);
+    builder.RegisterService(&service);
+    server = builder.BuildAndStart();
+    ASSERT_TRUE(server);
+    ASSERT_NE(port, 0);
+
+    stub = proto::Yac::NewStub(
+        grpc::CreateChannel("127.0.0.1:" + std::to_string(port),
+                            grpc::InsecureChannelCredentials()));
+  }
+
+  void TearDown() override {
+    server->Shutdown();
+  }
+
+  /// send a state through the client, to the peer if it is not empty
+  void sendState(AsyncGrpcClient<google::protobuf::Empty> &client,
+                 const std::string &peer = {}) {
+    auto call = [this](auto context, auto cq) {
+      return stub->AsyncSendState(context, proto::State{}, cq);
+    };
+    if (peer.empty()) {
+      client.Call(call);
+    } else {
+      client.Call(peer, call);
+    }
+  }
+
+  /// @return number of calls pending in the queue
+  int64_t pendingCalls(size_t queue) {
+    return iroha::metrics::registry()
+        .gauge("iroha_grpc_client_queue_" + std::to_string(queue)
+                   + "_pending_calls",
+               "")
+        .value();
+  }
+
+  static constexpr size_t kQueues = 3;
+
+  CountingYacService service;
+  std::unique_ptr<grpc::Server> server;
+  std::unique_ptr<proto::Yac::Stub> stub;
+};
+
+constexpr size_t AsyncGrpcClientTest::kQueues;
+
+/**
+ * @given client with several completion queues
+ * @when calls are sent to several peers @and in turn over the queues
+ * @then every call reaches the server @and no call is left pending in the
+ * queues after the client is destroyed
+ */
+TEST_F(AsyncGrpcClientTest, CallsCompletedByAllQueues) {
+  const size_t calls = 4 * kQueues;
+  {
+    AsyncGrpcClient<google::protobuf::Empty> client(
+        getTestLogger("AsyncCall"), kQueues);
+    for (size_t i = 0; i < calls; ++i) {
+      sendState(client, "peer" + std::to_string(i) + ":10001");
+      sendState(client);
+    }
+    ASSERT_TRUE(service.waitStates(2 * calls));
+  }
+
+  for (size_t i = 0; i < kQueues; ++i) {
+    EXPECT_EQ(pendingCalls(i), 0) << "queue " << i;
+  }
+}
+
+/**
+ * @given client without completion queues requested
+ * @when a call is sent
+ * @then the call reaches the server through the single default queue
+ */
+TEST_F(AsyncGrpcClientTest, AtLeastOneQueue) {
+  AsyncGrpcClient<google::protobuf::Empty> client(getTestLogger("AsyncCall"),
+                                                  0);
+  sendState(client, "peer:10001");
+
+  ASSERT_TRUE(service.waitStates(1));
+}
@@ -9,6 +9,7 @@
 #include <gtest/gtest.h>
 
 #include "builders/protobuf/builder_templates/transaction_template.hpp"
+#include "common/thread_pool.hpp"
 #include "consensus/consensus_block_cache.hpp"
 #include "cryptography/crypto_provider/crypto_defaults.hpp"
 #include "cryptography/hash.hpp"
@@ -24,6 +25,8 @@
 #include "module/shared_model/interface_mocks.hpp"
 #include "network/impl/block_loader_impl.hpp"
 #include "network/impl/block_loader_service.hpp"
+#include "network/peer_chunking.hpp"
+#include "network/peer_compression.hpp"
 #include "validators/default_validator.hpp"
 
 using namespace iroha::network;
@@ -166,8 +169,9 @@ TEST_F(BlockLoaderTest, ValidWhenOneBlock) {
   EXPECT_CALL(*storage, getTopBlockHeight())
       .WillOnce(Return(top_block.height()));
   EXPECT_CALL(*storage, getBlock(top_block.height()))
-      .WillOnce(Return(ByMove(iroha::expected::makeValue(
-          clone<shared_model::interface::Block>(top_block)))));
+      .WillOnce(Return(iroha::expected::makeValue(
+          std::shared_ptr<const shared_model::interface::Block>(
+              clone(top_block)))));
   auto wrapper =
       make_test_subscriber<CallExact>(loader->retrieveBlocks(1, peer_key), 1);
   wrapper.subscribe([&top_block](auto block) { ASSERT_EQ(*block, top_block); });
@@ -203,8 +207,59 @@ TEST_F(BlockLoaderTest, ValidWhenMultipleBlocks) {
                    .finish();
 
     EXPECT_CALL(*storage, getBlock(i))
-        .WillOnce(Return(ByMove(iroha::expected::makeValue(
-            clone<shared_model::interface::Block>(blk)))));
+        .WillOnce(Return(iroha::expected::makeValue(
+            std::shared_ptr<const shared_model::interface::Block>(
+                clone(blk)))));
+  }
+
+  EXPECT_CALL(*peer_query, getLedgerPeers())
+      .WillOnce(Return(std::vector<wPeer>{peer}));
+  auto wrapper = make_test_subscriber<CallExact>(
+      loader->retrieveBlocks(1, peer_key), num_blocks);
+  auto height = next_height;
+  wrapper.subscribe(
+      [&height](auto block) { ASSERT_EQ(block->height(), height++); });
+
+  ASSERT_TRUE(wrapper.validate());
+}
+
+/**
+ * @given block loader validating blocks on a thread pool, a block, and
+ * additional num_blocks blocks which do not fit into a single chunk
+ * @when retrieveBlocks is called
+ * @then it returns consecutive heights
+ */
+TEST_F(BlockLoaderTest, ValidWhenMultipleBlocksValidatedAhead) {
+  loader = std::make_shared<BlockLoaderImpl>(
+      peer_query_factory,
+      shared_model::proto::ProtoBlockFactory(
+          std::make_unique<MockValidator<shared_model::interface::Block>>(),
+          std::make_unique<MockValidator<iroha::protocol::Block>>()),
+      getTestLogger("BlockLoader"),
+      std::make_shared<iroha::ThreadPool>(2));
+
+  auto block = getBaseBlockBuilder()
+                   .createdTime(1337)
+                   .build()
+                   .signAndAddSignature(key)
+                   .finish();
+
+  auto num_blocks = 50;
+  auto next_height = block.height() + 1;
+
+  EXPECT_CALL(*storage, getTopBlockHeight())
+      .WillOnce(Return(block.height() + num_blocks));
+  for (auto i = next_height; i < next_height + num_blocks; ++i) {
+    auto blk = getBaseBlockBuilder()
+                   .height(i)
+                   .build()
+                   .signAndAddSignature(key)
+                   .finish();
+
+    EXPECT_CALL(*storage, getBlock(i))
+        .WillOnce(Return(iroha::expected::makeValue(
+            std::shared_ptr<const shared_model::interface::Block>(
+                clone(blk)))));
   }
 
   EXPECT_CALL(*peer_query, getLedgerPeers())
@@ -244,6 +299,44 @@ TEST_F(BlockLoaderTest, ValidWhenBlockPresent) {
   ASSERT_EQ(*block, **retrieved_block);
 }
 
+/**
+ * @given block loader requesting parts of one transaction @and consensus
+ * cache with a block of several transactions
+ * @when retrieveBlock is called with the related height
+ * @then the block is reassembled from the parts
+ */
+TEST_F(BlockLoaderTest, ValidWhenBlockRetrievedInChunks) {
+  std::vector<shared_model::proto::Transaction> txs;
+  for (int i = 0; i < 3; ++i) {
+    txs.push_back(TestUnsignedTransactionBuilder()
+                      .creatorAccountId("account@domain")
+                      .setAccountQuorum("account@domain", i + 1)
+                      .createdTime(iroha::time::now())
+                      .quorum(1)
+                      .build()
+                      .signAndAddSignature(key)
+                      .finish());
+  }
+  auto block = std::make_shared<shared_model::proto::Block>(
+      getBaseBlockBuilder()
+          .transactions(txs)
+          .build()
+          .signAndAddSignature(key)
+          .finish());
+  block_cache->insert(block);
+
+  EXPECT_CALL(*peer_query, getLedgerPeers())
+      .WillOnce(Return(std::vector<wPeer>{peer}));
+  EXPECT_CALL(*validator, validate(RefAndPointerEq(block)))
+      .WillOnce(Return(Answer{}));
+  peerChunking().max_chunk_bytes = 1;
+  auto retrieved_block = loader->retrieveBlock(peer_key, block->height());
+  peerChunking().max_chunk_bytes = 0;
+
+  ASSERT_TRUE(retrieved_block);
+  ASSERT_EQ(*block, **retrieved_block);
+}
+
 /**
  * @given block loader @and consensus cache with a block @and mocked storage
  * with two blocks
@@ -264,8 +357,9 @@ TEST_F(BlockLoaderTest, ValidWhenBlockMissing) {
   EXPECT_CALL(*peer_query, getLedgerPeers())
       .WillOnce(Return(std::vector<wPeer>{peer}));
   EXPECT_CALL(*storage, getBlock(prev_block->height()))
-      .WillOnce(Return(ByMove(iroha::expected::makeValue(
-          clone<shared_model::interface::Block>(*prev_block)))));
+      .WillOnce(Return(iroha::expected::makeValue(
+          std::shared_ptr<const shared_model::interface::Block>(
+              clone(*prev_block)))));
 
   auto block = loader->retrieveBlock(peer_key, prev_block->height());
   ASSERT_TRUE(block);
@@ -290,8 +384,9 @@ TEST_F(BlockLoaderTest, ValidWithEmptyCache) {
   EXPECT_CALL(*peer_query, getLedgerPeers())
       .WillOnce(Return(std::vector<wPeer>{peer}));
   EXPECT_CALL(*storage, getBlock(prev_block->height()))
-      .WillOnce(Return(ByMove(iroha::expected::makeValue(
-          clone<shared_model::interface::Block>(*prev_block)))));
+      .WillOnce(Return(iroha::expected::makeValue(
+          std::shared_ptr<const shared_model::interface::Block>(
+              clone(*prev_block)))));
 
   auto block = loader->retrieveBlock(peer_key, prev_block->height());
   ASSERT_TRUE(block);
@@ -315,3 +410,64 @@ TEST_F(BlockLoaderTest, NoBlocksInStorage) {
   auto block = loader->retrieveBlock(peer_key, 1);
   ASSERT_FALSE(block);
 }
+
+/**
+ * @given block loader @and consensus cache with a block @and gzip compression
+ * of all peer messages
+ * @when retrieveBlock is called with the related height
+ * @then the same block is received
+ */
+TEST_F(BlockLoaderTest, ValidWhenBlockCompressed) {
+  auto block = std::make_shared<shared_model::proto::Block>(
+      getBaseBlockBuilder().build().signAndAddSignature(key).finish());
+  block_cache->insert(block);
+
+  EXPECT_CALL(*peer_query, getLedgerPeers())
+      .WillOnce(Return(std::vector<wPeer>{peer}));
+  EXPECT_CALL(*validator, validate(RefAndPointerEq(block)))
+      .WillOnce(Return(Answer{}));
+  peerCompression() = {CompressionAlgorithm::kGzip, 0};
+  auto retrieved_block = loader->retrieveBlock(peer_key, block->height());
+  peerCompression() = {};
+
+  ASSERT_TRUE(retrieved_block);
+  ASSERT_EQ(*block, **retrieved_block);
+}
+
+/**
+ * @given block loader @and storage with several blocks @and deflate
+ * compression of all peer messages
+ * @when retrieveBlocks is called
+ * @then the streamed blocks are received with consecutive heights
+ */
+TEST_F(BlockLoaderTest, ValidWhenBlocksStreamedCompressed) {
+  auto num_blocks = 3;
+  auto next_height = 2;
+
+  EXPECT_CALL(*storage, getTopBlockHeight())
+      .WillOnce(Return(next_height + num_blocks - 1));
+  for (auto i = next_height; i < next_height + num_blocks; ++i) {
+    auto blk = getBaseBlockBuilder()
+                   .height(i)
+                   .build()
+                   .signAndAddSignature(key)
+                   .finish();
+
+    EXPECT_CALL(*storage, getBlock(i))
+        .WillOnce(Return(iroha::expected::makeValue(
+            std::shared_ptr<const shared_model::interface::Block>(
+                clone(blk)))));
+  }
+
+  EXPECT_CALL(*peer_query, getLedgerPeers())
+      .WillOnce(Return(std::vector<wPeer>{peer}));
+  peerCompression() = {CompressionAlgorithm::kDeflate, 0};
+  auto wrapper = make_test_subscriber<CallExact>(
+      loader->retrieveBlocks(1, peer_key), num_blocks);
+  auto height = next_height;
+  wrapper.subscribe(
+      [&height](auto block) { ASSERT_EQ(block->height(), height++); });
+  peerCompression() = {};
+
+  ASSERT_TRUE(wrapper.validate());
+}
@@ -0,0 +1,60 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/impl/grpc_channel_builder.hpp"
+
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+using namespace iroha::network;
+
+/**
+ * @given address of a peer
+ * @when the peer channel is requested twice while the first one is used
+ * @then the same channel is returned
+ */
+TEST(GrpcChannelBuilderTest, PeerChannelShared) {
+  auto channel = getPeerChannel("127.0.0.1:50541");
+  EXPECT_EQ(channel, getPeerChannel("127.0.0.1:50541"));
+  EXPECT_NE(channel, getPeerChannel("127.0.0.1:50542"));
+}
+
+/**
+ * @given peer channel which is not used anymore
+ * @when the peer channel is requested again
+ * @then the released channel is destroyed @and a new one is returned
+ */
+TEST(GrpcChannelBuilderTest, PeerChannelReleased) {
+  auto channel = getPeerChannel("127.0.0.1:50543");
+  std::weak_ptr<grpc::Channel> released = channel;
+  channel.reset();
+  EXPECT_TRUE(released.expired());
+
+  channel = getPeerChannel("127.0.0.1:50543");
+  EXPECT_TRUE(channel);
+}
+
+/**
+ * @given peer services
+ * @when arguments of the shared peer channel are created
+ * @then the service config applies to each of the services
+ */
+TEST(GrpcChannelBuilderTest, PeerChannelConfigCoversServices) {
+  auto arguments = details::getChannelArguments(details::kPeerServices);
+  grpc_channel_args args;
+  arguments.SetChannelArgs(&args);
+
+  std::string config;
+  for (size_t i = 0; i < args.num_args; ++i) {
+    if (std::strcmp(args.args[i].key, GRPC_ARG_SERVICE_CONFIG) == 0) {
+      config = args.args[i].value.string;
+    }
+  }
+  for (const auto &service : details::kPeerServices) {
+    EXPECT_NE(config.find("\"" + service + "\""), std::string::npos)
+        << service;
+  }
+}
@@ -51,6 +51,12 @@ namespace iroha {
           rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>(
               const shared_model::interface::types::HeightType,
               const shared_model::crypto::PublicKey &));
+      MOCK_METHOD3(
+          retrieveBlocks,
+          rxcpp::observable<std::shared_ptr<shared_model::interface::Block>>(
+              const shared_model::interface::types::HeightType,
+              const shared_model::interface::types::HeightType,
+              const std::vector<shared_model::crypto::PublicKey> &));
       MOCK_METHOD2(
           retrieveBlock,
           boost::optional<std::shared_ptr<shared_model::interface::Block>>(
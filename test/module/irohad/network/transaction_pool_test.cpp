@@ -0,0 +1,110 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "network/transaction_pool.hpp"
+
+#include <gtest/gtest.h>
+#include "backend/protobuf/transaction.hpp"
+#include "cryptography/public_key.hpp"
+#include "cryptography/signed.hpp"
+
+using iroha::network::TransactionPool;
+
+class TransactionPoolTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    transport.mutable_payload()
+        ->mutable_reduced_payload()
+        ->set_creator_account_id("admin@test");
+    transport.mutable_payload()->mutable_reduced_payload()->set_quorum(1);
+  }
+
+  /// @return new instance of the transaction signed by the signer, with the
+  /// public key of another signer if it is given
+  std::shared_ptr<shared_model::proto::Transaction> makeTx(
+      char signer = 's', char key = 0) const {
+    auto tx = std::make_shared<shared_model::proto::Transaction>(transport);
+    tx->addSignature(
+        shared_model::crypto::Signed(std::string(64, signer)),
+        shared_model::crypto::PublicKey(std::string(32, key ? key : signer)));
+    return tx;
+  }
+
+  iroha::protocol::Transaction transport;
+  TransactionPool pool;
+};
+
+/**
+ * @given pool with a transaction
+ * @when another instance of the transaction is interned
+ * @then the pooled instance is returned
+ */
+TEST_F(TransactionPoolTest, SameTransactionIsShared) {
+  auto pooled = makeTx();
+  ASSERT_EQ(pool.intern(pooled), pooled);
+
+  shared_model::interface::types::SharedTxsCollectionType txs{makeTx(),
+                                                              makeTx()};
+  pool.intern(txs);
+  ASSERT_EQ(txs[0], pooled);
+  ASSERT_EQ(txs[1], pooled);
+  ASSERT_EQ(pool.size(), 1);
+}
+
+/**
+ * @given pool with a transaction
+ * @when the transaction with other signatures is interned
+ * @then it is not replaced, and it becomes the pooled instance
+ */
+TEST_F(TransactionPoolTest, OtherSignaturesAreNotShared) {
+  pool.intern(makeTx('s'));
+
+  auto signed_tx = makeTx('t');
+  ASSERT_EQ(pool.intern(signed_tx), signed_tx);
+  ASSERT_EQ(pool.intern(makeTx('t')), signed_tx);
+  ASSERT_EQ(pool.size(), 1);
+}
+
+/**
+ * @given pool with a transaction
+ * @when the transaction with the same signature bytes but another public key
+ * is interned
+ * @then it is not replaced, and it becomes the pooled instance
+ */
+TEST_F(TransactionPoolTest, OtherPublicKeysAreNotShared) {
+  pool.intern(makeTx('s', 'k'));
+
+  auto signed_tx = makeTx('s', 'l');
+  ASSERT_EQ(pool.intern(signed_tx), signed_tx);
+  ASSERT_EQ(pool.intern(makeTx('s', 'l')), signed_tx);
+  ASSERT_EQ(pool.size(), 1);
+}
+
+/**
+ * @given pool with a transaction which is not held anymore
+ * @when another instance of the transaction is interned
+ * @then the instance is returned
+ */
+TEST_F(TransactionPoolTest, DestroyedTransactionIsNotShared) {
+  pool.intern(makeTx());
+
+  auto tx = makeTx();
+  ASSERT_EQ(pool.intern(tx), tx);
+}
+
+/**
+ * @given transaction without all signatures
+ * @when its instances are interned
+ * @then they are not pooled, since MST may add signatures to them
+ */
+TEST_F(TransactionPoolTest, IncompleteTransactionIsNotPooled) {
+  transport.mutable_payload()->mutable_reduced_payload()->set_quorum(2);
+
+  auto tx = makeTx();
+  ASSERT_EQ(pool.intern(tx), tx);
+  auto other_tx = makeTx();
+  ASSERT_EQ(pool.intern(other_tx), other_tx);
+  ASSERT_EQ(pool.size(), 0);
+}
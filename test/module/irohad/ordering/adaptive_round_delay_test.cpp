@@ -0,0 +1,74 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/adaptive_round_delay.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace iroha;
+using namespace iroha::ordering;
+using namespace std::chrono_literals;
+
+class AdaptiveRoundDelayTest : public ::testing::Test {
+ public:
+  std::chrono::milliseconds next() {
+    return delay(event);
+  }
+
+  size_t pending = 0;
+  const size_t kTransactionLimit = 10;
+  AdaptiveRoundDelay delay{
+      RoundDelayBounds{100ms, 500ms}, kTransactionLimit, [this] {
+        return pending;
+      }};
+  synchronizer::SynchronizationEvent event{
+      synchronizer::SynchronizationOutcomeType::kCommit, {}, nullptr};
+};
+
+/**
+ * @given adaptive delay
+ * @when there are enough pending transactions for a full proposal
+ * @then the delay is minimal
+ */
+TEST_F(AdaptiveRoundDelayTest, FullProposal) {
+  pending = kTransactionLimit * 2;
+  ASSERT_EQ(next(), 100ms);
+}
+
+/**
+ * @given adaptive delay
+ * @when there are no pending transactions
+ * @then the delay is maximal
+ */
+TEST_F(AdaptiveRoundDelayTest, Idle) {
+  ASSERT_EQ(next(), 500ms);
+}
+
+/**
+ * @given adaptive delay
+ * @when pending transactions fill a part of a proposal
+ * @then the delay decreases proportionally to the load
+ */
+TEST_F(AdaptiveRoundDelayTest, PartialProposal) {
+  pending = kTransactionLimit / 2;
+  ASSERT_EQ(next(), 300ms);
+}
+
+/**
+ * @given adaptive delay with minimal value after a full proposal
+ * @when the peer becomes idle
+ * @then the delay grows gradually up to the maximal one
+ */
+TEST_F(AdaptiveRoundDelayTest, GrowsGradually) {
+  pending = kTransactionLimit;
+  ASSERT_EQ(next(), 100ms);
+
+  pending = 0;
+  ASSERT_EQ(next(), 200ms);
+  ASSERT_EQ(next(), 300ms);
+  ASSERT_EQ(next(), 400ms);
+  ASSERT_EQ(next(), 500ms);
+  ASSERT_EQ(next(), 500ms);
+}
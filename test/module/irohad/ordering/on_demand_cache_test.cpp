@@ -140,3 +140,40 @@ TEST(OnDemandCache, Remove) {
    */
   ASSERT_THAT(cache.head(), ElementsAre(batch2));
 }
+
+/**
+ * @given cache with a size limit
+ * @when batches exceeding the limit are added
+ * @then the cache becomes full and does not take more batches
+ * AND it is not full after the batches are popped
+ */
+TEST(OnDemandCache, SizeLimit) {
+  const size_t kTxSize = 10;
+  OnDemandCache cache(kTxSize + kTxSize / 2);
+
+  shared_model::interface::types::BlobType blob{
+      shared_model::interface::types::BlobType::Bytes(kTxSize)};
+  auto make_batch = [&blob](std::string hash) {
+    auto tx = createMockTransactionWithHash(
+        shared_model::interface::types::HashType(hash));
+    ON_CALL(*tx, blob()).WillByDefault(ReturnRef(blob));
+    return createMockBatchWithTransactions({tx}, hash);
+  };
+  auto batch1 = make_batch("hash1");
+  auto batch2 = make_batch("hash2");
+  auto batch3 = make_batch("hash3");
+
+  cache.addToBack({batch1});
+  ASSERT_FALSE(cache.isFull());
+
+  cache.addToBack({batch2});
+  ASSERT_TRUE(cache.isFull());
+
+  cache.addToBack({batch3});
+  ASSERT_THAT(cache.tail(), UnorderedElementsAre(batch1, batch2));
+
+  cache.pop();
+  cache.pop();
+  ASSERT_THAT(cache.pop(), UnorderedElementsAre(batch1, batch2));
+  ASSERT_FALSE(cache.isFull());
+}
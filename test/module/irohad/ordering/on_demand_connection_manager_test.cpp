@@ -17,6 +17,7 @@ using namespace iroha;
 using namespace iroha::ordering;
 using namespace iroha::ordering::transport;
 
+using ::testing::_;
 using ::testing::ByMove;
 using ::testing::Ref;
 using ::testing::Return;
@@ -131,3 +132,182 @@ TEST_F(OnDemandConnectionManagerTest, onRequestProposalNone) {
 
   ASSERT_FALSE(result);
 }
+
+/**
+ * @given OnDemandConnectionManager which coalesces batches until they contain
+ * two transactions
+ * @when two collections with one single-transaction batch each are sent
+ * @then every consumer receives both batches in a single collection
+ */
+TEST_F(OnDemandConnectionManagerTest, onBatchesCoalesced) {
+  manager = std::make_shared<OnDemandConnectionManager>(
+      factory,
+      peers.get_observable(),
+      cpeers,
+      getTestLogger("OsConnectionManager"),
+      BatchCoalescingOptions{std::chrono::hours(1), 2});
+
+  auto makeBatch = [](const std::string &hash) {
+    return createMockBatchWithTransactions(
+        {createMockTransactionWithHash(shared_model::crypto::Hash(hash))},
+        hash);
+  };
+  OdOsNotification::CollectionType first{makeBatch("first")},
+      second{makeBatch("second")}, collection{first.front(), second.front()};
+
+  for (auto type : {OnDemandConnectionManager::kRejectRejectConsumer,
+                    OnDemandConnectionManager::kRejectCommitConsumer,
+                    OnDemandConnectionManager::kCommitRejectConsumer,
+                    OnDemandConnectionManager::kCommitCommitConsumer}) {
+    EXPECT_CALL(*connections[type], onBatches(collection)).Times(1);
+  }
+
+  manager->onBatches(first);
+  manager->onBatches(second);
+}
+
+/**
+ * @given OnDemandConnectionManager which coalesces batches
+ * @when a batch is sent AND the manager is destroyed before the window passes
+ * @then the batch is delivered to consumers
+ */
+TEST_F(OnDemandConnectionManagerTest, onBatchesFlushedOnDestruction) {
+  manager = std::make_shared<OnDemandConnectionManager>(
+      factory,
+      peers.get_observable(),
+      cpeers,
+      getTestLogger("OsConnectionManager"),
+      BatchCoalescingOptions{std::chrono::hours(1), 100});
+
+  OdOsNotification::CollectionType collection{createMockBatchWithTransactions(
+      {createMockTransactionWithHash(shared_model::crypto::Hash("hash"))},
+      "hash")};
+
+  for (auto type : {OnDemandConnectionManager::kRejectRejectConsumer,
+                    OnDemandConnectionManager::kRejectCommitConsumer,
+                    OnDemandConnectionManager::kCommitRejectConsumer,
+                    OnDemandConnectionManager::kCommitCommitConsumer}) {
+    EXPECT_CALL(*connections[type], onBatches(collection)).Times(1);
+  }
+
+  manager->onBatches(collection);
+  manager.reset();
+}
+
+/**
+ * @given OnDemandConnectionManager which prefetches proposals
+ * @when proposal for a round is requested
+ * AND the round is committed, so reject-commit consumer becomes the issuer
+ * AND proposal for the next commit round is requested
+ * @then the proposal is requested from reject-commit consumer in advance
+ * AND the prefetched proposal is returned
+ */
+TEST_F(OnDemandConnectionManagerTest, onRequestProposalPrefetched) {
+  manager = std::make_shared<OnDemandConnectionManager>(
+      factory,
+      peers.get_observable(),
+      cpeers,
+      getTestLogger("OsConnectionManager"),
+      BatchCoalescingOptions{},
+      true);
+
+  consensus::Round round{1, 0};
+  auto next_round = nextCommitRound(round);
+  auto next_issuer =
+      cpeers.peers[OnDemandConnectionManager::kRejectCommitConsumer];
+  MockOdOsNotification *issuer_connection = nullptr;
+  auto &next_issuer_mock = static_cast<MockPeer &>(*next_issuer);
+  EXPECT_CALL(next_issuer_mock, address())
+      .WillRepeatedly(::testing::ReturnRefOfCopy(std::string("next")));
+  EXPECT_CALL(next_issuer_mock, pubkey())
+      .WillRepeatedly(
+          ::testing::ReturnRefOfCopy(shared_model::crypto::PublicKey("key")));
+
+  EXPECT_CALL(*connections[OnDemandConnectionManager::kIssuer],
+              onRequestProposal(round))
+      .WillOnce(Return(ByMove(boost::none)));
+  auto oproposal = boost::make_optional<
+      std::shared_ptr<const OnDemandConnectionManager::ProposalType>>({});
+  auto proposal = oproposal.value().get();
+  auto prefetch_connection = std::make_unique<MockOdOsNotification>();
+  EXPECT_CALL(*prefetch_connection, onRequestProposal(next_round))
+      .WillOnce(Return(ByMove(std::move(oproposal))));
+  EXPECT_CALL(*factory, create(Ref(*next_issuer)))
+      .WillOnce(Return(ByMove(std::unique_ptr<OdOsNotification>(
+          std::move(prefetch_connection)))))
+      .WillRepeatedly(CreateAndSave(&issuer_connection));
+
+  ASSERT_FALSE(manager->onRequestProposal(round));
+
+  auto committed_peers = cpeers;
+  std::swap(
+      committed_peers.peers[OnDemandConnectionManager::kIssuer],
+      committed_peers.peers[OnDemandConnectionManager::kRejectCommitConsumer]);
+  peers.get_subscriber().on_next(committed_peers);
+  ASSERT_NE(issuer_connection, nullptr);
+  EXPECT_CALL(*issuer_connection, onRequestProposal(_)).Times(0);
+
+  auto result = manager->onRequestProposal(next_round);
+
+  ASSERT_TRUE(result);
+  ASSERT_EQ(result.value().get(), proposal);
+}
+
+/**
+ * @given OnDemandConnectionManager which hedges proposal requests
+ * AND the issuer has enough recent request times
+ * @when proposal is requested AND the request stalls
+ * @then the proposal is requested once more over a new connection
+ * AND its reply is returned without waiting for the stalled request
+ */
+TEST_F(OnDemandConnectionManagerTest, onRequestProposalHedged) {
+  manager = std::make_shared<OnDemandConnectionManager>(
+      factory,
+      peers.get_observable(),
+      cpeers,
+      getTestLogger("OsConnectionManager"),
+      BatchCoalescingOptions{},
+      false,
+      0.5);
+
+  consensus::Round round{1, 0};
+  auto issuer = cpeers.peers[OnDemandConnectionManager::kIssuer];
+  EXPECT_CALL(static_cast<MockPeer &>(*issuer), address())
+      .WillRepeatedly(::testing::ReturnRefOfCopy(std::string("issuer")));
+
+  // request times of the issuer are collected before requests are hedged
+  EXPECT_CALL(*connections[OnDemandConnectionManager::kIssuer],
+              onRequestProposal(round))
+      .Times(8);
+  for (int i = 0; i < 8; ++i) {
+    ASSERT_FALSE(manager->onRequestProposal(round));
+  }
+
+  std::promise<void> release;
+  auto stalled_connection = std::make_unique<MockOdOsNotification>();
+  EXPECT_CALL(*stalled_connection, onRequestProposal(round))
+      .WillOnce(::testing::Invoke(
+          [stalled = release.get_future().share()](auto)
+              -> boost::optional<std::shared_ptr<
+                  const OnDemandConnectionManager::ProposalType>> {
+            stalled.wait();
+            return boost::none;
+          }));
+  auto oproposal = boost::make_optional<
+      std::shared_ptr<const OnDemandConnectionManager::ProposalType>>({});
+  auto proposal = oproposal.value().get();
+  auto hedged_connection = std::make_unique<MockOdOsNotification>();
+  EXPECT_CALL(*hedged_connection, onRequestProposal(round))
+      .WillOnce(Return(ByMove(std::move(oproposal))));
+  EXPECT_CALL(*factory, create(Ref(*issuer)))
+      .WillOnce(Return(ByMove(
+          std::unique_ptr<OdOsNotification>(std::move(stalled_connection)))))
+      .WillOnce(Return(ByMove(
+          std::unique_ptr<OdOsNotification>(std::move(hedged_connection)))));
+
+  auto result = manager->onRequestProposal(round);
+  release.set_value();
+
+  ASSERT_TRUE(result);
+  ASSERT_EQ(result.value().get(), proposal);
+}
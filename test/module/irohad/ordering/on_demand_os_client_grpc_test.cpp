@@ -169,3 +169,70 @@ TEST_F(OnDemandOsClientGrpcTest, onRequestProposalNone) {
   ASSERT_EQ(request.round().reject_round(), round.reject_round);
   ASSERT_FALSE(proposal);
 }
+
+/**
+ * @given client with recent transactions
+ * AND a transaction of the proposal which is known to the client
+ * @when onRequestProposal is called
+ * AND compact proposal is returned
+ * @then only the unknown transaction is requested
+ * AND the proposal is reconstructed
+ */
+TEST_F(OnDemandOsClientGrpcTest, onRequestProposalCompact) {
+  auto ustub = std::make_unique<proto::MockOnDemandOrderingStub>();
+  auto compact_stub = ustub.get();
+  auto recent_transactions = std::make_shared<RecentTransactionsCache>(16);
+  auto compact_client =
+      std::make_shared<OnDemandOsClientGrpc>(std::move(ustub),
+                                             async_call,
+                                             proposal_factory,
+                                             [&] { return timepoint; },
+                                             timeout,
+                                             getTestLogger("OdOsClientGrpc"),
+                                             recent_transactions);
+
+  iroha::protocol::Proposal full;
+  full.set_height(3);
+  for (auto creator : {"known", "unknown"}) {
+    full.add_transactions()
+        ->mutable_payload()
+        ->mutable_reduced_payload()
+        ->set_creator_account_id(creator);
+  }
+  shared_model::proto::Proposal original(full);
+  recent_transactions->add({std::make_shared<shared_model::proto::Transaction>(
+      full.transactions(0))});
+
+  proto::ProposalResponse response;
+  auto compact = response.mutable_compact_proposal();
+  compact->set_height(3);
+  for (const auto &tx : original.transactions()) {
+    const auto &hash = tx.hash().blob();
+    compact->add_transaction_hashes(hash.data(), hash.size());
+  }
+  const auto &hash = original.hash().blob();
+  compact->set_proposal_hash(hash.data(), hash.size());
+  proto::ProposalRequest request;
+  EXPECT_CALL(*compact_stub, RequestProposal(_, _, _))
+      .WillOnce(DoAll(SaveArg<1>(&request),
+                      SetArgPointee<2>(response),
+                      Return(grpc::Status::OK)));
+
+  proto::TransactionsResponse transactions;
+  *transactions.add_transactions() = full.transactions(1);
+  proto::TransactionsRequest transactions_request;
+  EXPECT_CALL(*compact_stub, RequestTransactions(_, _, _))
+      .WillOnce(DoAll(SaveArg<1>(&transactions_request),
+                      SetArgPointee<2>(transactions),
+                      Return(grpc::Status::OK)));
+
+  auto proposal = compact_client->onRequestProposal(round);
+
+  ASSERT_TRUE(request.compact());
+  ASSERT_EQ(transactions_request.transaction_hashes_size(), 1);
+  ASSERT_EQ(
+      shared_model::crypto::Hash(transactions_request.transaction_hashes(0)),
+      original.transactions()[1].hash());
+  ASSERT_TRUE(proposal);
+  ASSERT_EQ(proposal.value()->hash(), original.hash());
+}
@@ -131,8 +131,10 @@ TEST_F(OnDemandOsServerGrpcTest, RequestProposal) {
 
   server->RequestProposal(nullptr, &request, &response);
 
-  ASSERT_TRUE(response.has_proposal());
-  ASSERT_EQ(response.proposal()
+  proto::ProposalResponse received;
+  ASSERT_TRUE(received.ParseFromString(response.SerializeAsString()));
+  ASSERT_TRUE(received.has_proposal());
+  ASSERT_EQ(received.proposal()
                 .transactions()
                 .Get(0)
                 .payload()
@@ -159,3 +161,81 @@ TEST_F(OnDemandOsServerGrpcTest, RequestProposalNone) {
 
   ASSERT_FALSE(response.has_proposal());
 }
+
+/**
+ * @given server
+ * @when compact proposal is requested
+ * AND proposal returned
+ * @then hashes of the proposal and its transactions are sent
+ */
+TEST_F(OnDemandOsServerGrpcTest, RequestProposalCompact) {
+  proto::ProposalRequest request;
+  request.mutable_round()->set_block_round(round.block_round);
+  request.mutable_round()->set_reject_round(round.reject_round);
+  request.set_compact(true);
+  proto::ProposalResponse response;
+  protocol::Proposal proposal;
+  proposal.set_height(3);
+  proposal.set_created_time(4);
+  proposal.add_transactions()
+      ->mutable_payload()
+      ->mutable_reduced_payload()
+      ->set_creator_account_id("test");
+
+  auto iproposal =
+      std::make_shared<const shared_model::proto::Proposal>(proposal);
+  EXPECT_CALL(*notification, onRequestProposal(round))
+      .WillOnce(Return(
+          std::shared_ptr<const shared_model::interface::Proposal>(iproposal)));
+
+  server->RequestProposal(nullptr, &request, &response);
+
+  ASSERT_TRUE(response.has_compact_proposal());
+  const auto &compact = response.compact_proposal();
+  ASSERT_EQ(compact.height(), 3);
+  ASSERT_EQ(compact.created_time(), 4);
+  ASSERT_EQ(compact.transaction_hashes_size(), 1);
+  ASSERT_EQ(shared_model::crypto::Hash(compact.transaction_hashes(0)),
+            iproposal->transactions()[0].hash());
+  ASSERT_EQ(shared_model::crypto::Hash(compact.proposal_hash()),
+            iproposal->hash());
+}
+
+/**
+ * @given server
+ * @when transactions of a proposal are requested
+ * @then only the requested transactions are sent in order of the proposal
+ */
+TEST_F(OnDemandOsServerGrpcTest, RequestTransactions) {
+  protocol::Proposal proposal;
+  for (auto creator : {"a", "b", "c"}) {
+    proposal.add_transactions()
+        ->mutable_payload()
+        ->mutable_reduced_payload()
+        ->set_creator_account_id(creator);
+  }
+  auto iproposal =
+      std::make_shared<const shared_model::proto::Proposal>(proposal);
+  EXPECT_CALL(*notification, onRequestProposal(round))
+      .WillOnce(Return(
+          std::shared_ptr<const shared_model::interface::Proposal>(iproposal)));
+
+  proto::TransactionsRequest request;
+  request.mutable_round()->set_block_round(round.block_round);
+  request.mutable_round()->set_reject_round(round.reject_round);
+  for (auto i : {2, 0}) {
+    const auto &hash = iproposal->transactions()[i].hash().blob();
+    request.add_transaction_hashes(hash.data(), hash.size());
+  }
+  proto::TransactionsResponse response;
+
+  server->RequestTransactions(nullptr, &request, &response);
+
+  ASSERT_EQ(response.transactions_size(), 2);
+  ASSERT_EQ(
+      response.transactions(0).payload().reduced_payload().creator_account_id(),
+      "a");
+  ASSERT_EQ(
+      response.transactions(1).payload().reduced_payload().creator_account_id(),
+      "c");
+}
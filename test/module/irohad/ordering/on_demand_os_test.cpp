@@ -47,8 +47,26 @@ class OnDemandOsTest : public ::testing::Test {
                          commit_round = {3, kFirstRejectRound},
                          reject_round = {2, kNextRejectRoundConsumer};
   NiceMock<iroha::ametsuchi::MockTxPresenceCache> *mock_cache;
+  OnDemandOrderingService::CollectionType shed_batches;
 
   void SetUp() override {
+    os = makeOs();
+  }
+
+  /**
+   * @param max_transaction_age - age of pending transactions which are
+   * dropped
+   * @param max_pending_size_bytes - limit of size of pending transactions
+   * @param max_creator_size_bytes - limit of size of pending transactions of
+   * a creator
+   * @return ordering service with the default selection policy, which keeps
+   * shed batches in shed_batches
+   */
+  std::shared_ptr<OnDemandOrderingService> makeOs(
+      std::chrono::milliseconds max_transaction_age =
+          OnDemandOrderingServiceImpl::kDefaultMaxTransactionAge,
+      size_t max_pending_size_bytes = 0,
+      size_t max_creator_size_bytes = 0) {
     // TODO: nickaleks IR-1811 use mock factory
     auto factory = std::make_unique<
         shared_model::proto::ProtoProposalFactory<MockProposalValidator>>(
@@ -64,13 +82,18 @@ class OnDemandOsTest : public ::testing::Test {
                 _)))
         .WillByDefault(Return(std::vector<iroha::ametsuchi::TxCacheStatusType>{
             iroha::ametsuchi::tx_cache_status_responses::Missing()}));
-    os = std::make_shared<OnDemandOrderingServiceImpl>(
+    return std::make_shared<OnDemandOrderingServiceImpl>(
         transaction_limit,
         std::move(factory),
         std::move(tx_cache),
         getTestLogger("OdOrderingService"),
         proposal_limit,
-        initial_round);
+        initial_round,
+        nullptr,
+        max_transaction_age,
+        max_pending_size_bytes,
+        max_creator_size_bytes,
+        [this](const auto &batch) { shed_batches.push_back(batch); });
   }
 
   /**
@@ -83,7 +106,8 @@ class OnDemandOsTest : public ::testing::Test {
 
   OnDemandOrderingService::CollectionType generateTransactions(
       std::pair<uint64_t, uint64_t> range,
-      shared_model::interface::types::TimestampType now = iroha::time::now()) {
+      shared_model::interface::types::TimestampType now = iroha::time::now(),
+      const std::string &creator = "foo@bar") {
     OnDemandOrderingService::CollectionType collection;
 
     for (auto i = range.first; i < range.second; ++i) {
@@ -93,7 +117,7 @@ class OnDemandOsTest : public ::testing::Test {
                   std::make_unique<shared_model::proto::Transaction>(
                       shared_model::proto::TransactionBuilder()
                           .createdTime(now + i)
-                          .creatorAccountId("foo@bar")
+                          .creatorAccountId(creator)
                           .createAsset("asset", "domain", 1)
                           .quorum(1)
                           .build()
@@ -159,6 +183,105 @@ TEST_F(OnDemandOsTest, OverflowRound) {
             (*os->onRequestProposal(target_round))->transactions().size());
 }
 
+/**
+ * @given initialized on-demand OS
+ * @when  send more transactions than fit into a proposal
+ * AND initiate next round
+ * @then  the proposal contains the earliest received transactions in order of
+ * arrival
+ */
+TEST_F(OnDemandOsTest, ArrivalOrder) {
+  auto now = iroha::time::now();
+  os->onBatches(generateTransactions({0, transaction_limit * 2}, now));
+
+  os->onCollaborationOutcome(commit_round);
+
+  auto proposal = os->onRequestProposal(target_round);
+  ASSERT_TRUE(proposal);
+  ASSERT_EQ(transaction_limit, boost::size((*proposal)->transactions()));
+  shared_model::interface::types::TimestampType expected_time = now;
+  for (const auto &tx : (*proposal)->transactions()) {
+    ASSERT_EQ(expected_time++, tx.createdTime());
+  }
+}
+
+/**
+ * @given on-demand OS dropping transactions older than a minute
+ * @when  batches created two minutes ago and new batches are sent
+ * AND initiate next round
+ * @then  the proposal contains only the new batches
+ */
+TEST_F(OnDemandOsTest, ExpiredBatchesAreDropped) {
+  os = makeOs(std::chrono::minutes(1));
+  auto now = iroha::time::now();
+  auto expired_time =
+      now - std::chrono::milliseconds(std::chrono::minutes(2)).count();
+  os->onBatches(generateTransactions({0, 3}, expired_time));
+  os->onBatches(generateTransactions({0, 2}, now));
+
+  os->onCollaborationOutcome(commit_round);
+
+  auto proposal = os->onRequestProposal(target_round);
+  ASSERT_TRUE(proposal);
+  ASSERT_EQ(2, boost::size((*proposal)->transactions()));
+  for (const auto &tx : (*proposal)->transactions()) {
+    ASSERT_GE(tx.createdTime(), now);
+  }
+}
+
+/**
+ * @given on-demand OS limited to the size of three transactions
+ * @when  five batches are sent
+ * AND initiate next round
+ * @then  the proposal contains the three newest batches
+ * AND the two oldest ones are shed
+ */
+TEST_F(OnDemandOsTest, OldestBatchesAreShedOverBudget) {
+  auto now = iroha::time::now();
+  auto batches = generateTransactions({0, 5}, now);
+  auto tx_size = batches.front()->transactions().front()->payload().size();
+  os = makeOs(OnDemandOrderingServiceImpl::kDefaultMaxTransactionAge,
+              3 * tx_size);
+  os->onBatches(batches);
+
+  os->onCollaborationOutcome(commit_round);
+
+  auto proposal = os->onRequestProposal(target_round);
+  ASSERT_TRUE(proposal);
+  ASSERT_EQ(3, boost::size((*proposal)->transactions()));
+  for (const auto &tx : (*proposal)->transactions()) {
+    ASSERT_GE(tx.createdTime(), now + 2);
+  }
+  ASSERT_EQ(2, shed_batches.size());
+  ASSERT_EQ(now, shed_batches[0]->transactions().front()->createdTime());
+  ASSERT_EQ(now + 1, shed_batches[1]->transactions().front()->createdTime());
+}
+
+/**
+ * @given on-demand OS with a quota of a creator account
+ * @when  the creator sends two batches which exceed the quota
+ * AND another creator sends a batch
+ * AND initiate next round
+ * @then  the second batch of the first creator is shed
+ */
+TEST_F(OnDemandOsTest, BatchesOfCreatorOverQuotaAreShed) {
+  auto now = iroha::time::now();
+  auto batches = generateTransactions({0, 2}, now);
+  auto tx_size = batches.front()->transactions().front()->payload().size();
+  os = makeOs(
+      OnDemandOrderingServiceImpl::kDefaultMaxTransactionAge, 0, tx_size);
+  os->onBatches(batches);
+  os->onBatches(generateTransactions({2, 3}, now, "baz@bar"));
+
+  os->onCollaborationOutcome(commit_round);
+
+  auto proposal = os->onRequestProposal(target_round);
+  ASSERT_TRUE(proposal);
+  ASSERT_EQ(2, boost::size((*proposal)->transactions()));
+  ASSERT_EQ(1, shed_batches.size());
+  ASSERT_EQ(now + 1, shed_batches[0]->transactions().front()->createdTime());
+}
+
 /**
  * @given initialized on-demand OS
  * @when  send transactions from different threads
@@ -392,3 +515,34 @@ TEST_F(OnDemandOsTest, RejectCommit) {
   proposal = os->onRequestProposal(commit_round);
   ASSERT_EQ(2, boost::size((*proposal)->transactions()));
 }
+
+/**
+ * @given initialized on-demand OS with a batch in collection
+ * @when consecutive reject rounds follow without new batches
+ * @then the proposal of the rejected round is reissued for the next one
+ * @and a batch arriving before the next reject leads to a new proposal
+ */
+TEST_F(OnDemandOsTest, RejectReissuesProposal) {
+  auto round = [this](auto reject_round) {
+    return consensus::Round{initial_round.block_round,
+                            initial_round.reject_round + reject_round};
+  };
+  os->onBatches(generateTransactions({1, 2}));
+  os->onCollaborationOutcome(round(1));
+  auto proposal = os->onRequestProposal(round(2));
+
+  os->onCollaborationOutcome(round(2));
+  auto reissued = os->onRequestProposal(round(3));
+
+  ASSERT_TRUE(proposal);
+  ASSERT_TRUE(reissued);
+  EXPECT_EQ(*proposal, *reissued);
+
+  os->onBatches(generateTransactions({2, 3}));
+  os->onCollaborationOutcome(round(3));
+  auto repacked = os->onRequestProposal(round(4));
+
+  ASSERT_TRUE(repacked);
+  EXPECT_NE(*reissued, *repacked);
+  EXPECT_EQ(2, boost::size((*repacked)->transactions()));
+}
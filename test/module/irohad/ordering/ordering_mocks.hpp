@@ -32,6 +32,7 @@ namespace iroha {
         MOCK_METHOD1(remove, void(const HashesSetType &));
         MOCK_CONST_METHOD0(head, const BatchesSetType &());
         MOCK_CONST_METHOD0(tail, const BatchesSetType &());
+        MOCK_CONST_METHOD0(isFull, bool());
       };
     }  // namespace cache
 
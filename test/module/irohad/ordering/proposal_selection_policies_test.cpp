@@ -0,0 +1,106 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/proposal_selection_policies.hpp"
+
+#include <gtest/gtest.h>
+#include "builders/protobuf/transaction.hpp"
+#include "cryptography/crypto_provider/crypto_defaults.hpp"
+#include "interfaces/iroha_internal/transaction_batch_impl.hpp"
+
+using namespace iroha::ordering;
+
+class ProposalSelectionPoliciesTest : public ::testing::Test {
+ public:
+  /**
+   * Creates a batch of transactions_count transactions of creator, created
+   * at time, time + 1, ...
+   */
+  ProposalSelectionPolicy::BatchType makeBatch(const std::string &creator,
+                                               uint64_t time,
+                                               size_t transactions_count = 1) {
+    shared_model::interface::types::SharedTxsCollectionType transactions;
+    for (size_t i = 0; i < transactions_count; ++i) {
+      transactions.push_back(std::make_shared<shared_model::proto::Transaction>(
+          shared_model::proto::TransactionBuilder()
+              .createdTime(time + i)
+              .creatorAccountId(creator)
+              .createAsset("asset", "domain", 1)
+              .quorum(1)
+              .build()
+              .signAndAddSignature(keypair)
+              .finish()));
+    }
+    return std::make_shared<shared_model::interface::TransactionBatchImpl>(
+        std::move(transactions));
+  }
+
+  std::vector<ProposalSelectionPolicy::BatchType> select(
+      ProposalSelectionPolicyType type, size_t limit) {
+    return makeProposalSelectionPolicy(type)->select(pending, limit);
+  }
+
+  shared_model::crypto::Keypair keypair =
+      shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair();
+  ProposalSelectionPolicy::BatchListType pending;
+};
+
+/**
+ * @given batches arrived in order which differs from their creation time
+ * @when they are selected with FIFO policy
+ * @then they are taken in order of arrival until the first one which does
+ * not fit
+ */
+TEST_F(ProposalSelectionPoliciesTest, Fifo) {
+  pending = {makeBatch("a@test", 30),
+             makeBatch("b@test", 10),
+             makeBatch("c@test", 20, 3),
+             makeBatch("d@test", 40)};
+
+  auto selected = select(ProposalSelectionPolicyType::kFifo, 4);
+
+  ASSERT_EQ(selected,
+            (std::vector<ProposalSelectionPolicy::BatchType>{pending[0],
+                                                             pending[1]}));
+}
+
+/**
+ * @given batches arrived in order which differs from their creation time
+ * @when they are selected with oldest first policy
+ * @then they are taken in order of creation time
+ */
+TEST_F(ProposalSelectionPoliciesTest, OldestFirst) {
+  pending = {makeBatch("a@test", 30),
+             makeBatch("b@test", 10),
+             makeBatch("c@test", 20, 2),
+             makeBatch("d@test", 40)};
+
+  auto selected = select(ProposalSelectionPolicyType::kOldestFirst, 4);
+
+  ASSERT_EQ(selected,
+            (std::vector<ProposalSelectionPolicy::BatchType>{
+                pending[1], pending[2], pending[0]}));
+}
+
+/**
+ * @given many batches of one creator arrived before batches of others
+ * @when they are selected with fair share policy
+ * @then creators take turns, and a creator whose batch does not fit does not
+ * block the others
+ */
+TEST_F(ProposalSelectionPoliciesTest, FairShare) {
+  pending = {makeBatch("bulk@test", 1),
+             makeBatch("bulk@test", 2),
+             makeBatch("bulk@test", 3),
+             makeBatch("big@test", 4, 5),
+             makeBatch("user@test", 5),
+             makeBatch("user@test", 6)};
+
+  auto selected = select(ProposalSelectionPolicyType::kFairShare, 4);
+
+  ASSERT_EQ(selected,
+            (std::vector<ProposalSelectionPolicy::BatchType>{
+                pending[0], pending[4], pending[1], pending[5]}));
+}
@@ -0,0 +1,124 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "ordering/impl/sharded_connection_manager.hpp"
+
+#include <gtest/gtest.h>
+#include <boost/range/adaptor/indirected.hpp>
+#include "framework/test_logger.hpp"
+#include "interfaces/iroha_internal/proposal.hpp"
+#include "module/irohad/ordering/ordering_mocks.hpp"
+#include "module/shared_model/interface_mocks.hpp"
+
+using namespace iroha;
+using namespace iroha::ordering;
+using namespace iroha::ordering::transport;
+
+using ::testing::_;
+using ::testing::ByMove;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+struct ShardedConnectionManagerTest : public ::testing::Test {
+  void SetUp() override {
+    std::vector<std::shared_ptr<OdOsNotification>> connections;
+    for (auto &shard : shards) {
+      shard = std::make_shared<MockOdOsNotification>();
+      connections.push_back(shard);
+    }
+    factory = std::make_shared<MockUnsafeProposalFactory>();
+    manager = std::make_shared<ShardedConnectionManager>(
+        std::move(connections),
+        factory,
+        getTestLogger("ShardedConnectionManager"));
+  }
+
+  /// @return proposal with the given transactions
+  std::shared_ptr<const OdOsNotification::ProposalType> makeProposal(
+      shared_model::interface::types::TimestampType created_time,
+      shared_model::interface::types::SharedTxsCollectionType txs) {
+    auto proposal = std::make_shared<NiceMock<MockProposal>>();
+    ON_CALL(*proposal, createdTime()).WillByDefault(Return(created_time));
+    ON_CALL(*proposal, transactions())
+        .WillByDefault(Invoke([txs] {
+          return shared_model::interface::types::TransactionsCollectionType(
+              txs | boost::adaptors::indirected);
+        }));
+    return proposal;
+  }
+
+  consensus::Round round{2, 1};
+  std::array<std::shared_ptr<MockOdOsNotification>, 2> shards;
+  std::shared_ptr<MockUnsafeProposalFactory> factory;
+  std::shared_ptr<ShardedConnectionManager> manager;
+};
+
+/**
+ * @given manager with two shards
+ * @when batches with hashes of both shards are sent
+ * @then every shard receives only its batches
+ */
+TEST_F(ShardedConnectionManagerTest, BatchesAreRoutedByHash) {
+  // the last of the leading eight bytes of the hash selects the shard
+  auto odd = createMockBatchWithHash(shared_model::crypto::Hash("aaaaaaaa"));
+  auto even = createMockBatchWithHash(shared_model::crypto::Hash("aaaaaaab"));
+  ASSERT_EQ(manager->shardOf(odd), 1);
+  ASSERT_EQ(manager->shardOf(even), 0);
+
+  EXPECT_CALL(*shards[0], onBatches(OdOsNotification::CollectionType{even}));
+  EXPECT_CALL(*shards[1], onBatches(OdOsNotification::CollectionType{odd}));
+
+  manager->onBatches({odd, even});
+}
+
+/**
+ * @given manager with two shards
+ * @when a proposal is requested AND only one shard has it
+ * @then the proposal of the shard is returned as is
+ */
+TEST_F(ShardedConnectionManagerTest, SingleProposalIsForwarded) {
+  auto proposal = makeProposal(
+      1, {createMockTransactionWithHash(shared_model::crypto::Hash("tx"))});
+  EXPECT_CALL(*shards[0], onRequestProposal(round))
+      .WillOnce(Return(ByMove(boost::none)));
+  EXPECT_CALL(*shards[1], onRequestProposal(round))
+      .WillOnce(Return(ByMove(boost::make_optional(proposal))));
+  EXPECT_CALL(*factory, unsafeCreateProposal(_, _, _)).Times(0);
+
+  auto result = manager->onRequestProposal(round);
+
+  ASSERT_TRUE(result);
+  ASSERT_EQ(result.value(), proposal);
+}
+
+/**
+ * @given manager with two shards
+ * @when a proposal is requested AND both shards have it
+ * @then the proposals are merged in the order of shards without duplicates
+ */
+TEST_F(ShardedConnectionManagerTest, ProposalsAreMerged) {
+  auto first = createMockTransactionWithHash(shared_model::crypto::Hash("1"));
+  auto second = createMockTransactionWithHash(shared_model::crypto::Hash("2"));
+  EXPECT_CALL(*shards[0], onRequestProposal(round))
+      .WillOnce(Return(ByMove(boost::make_optional(makeProposal(3, {first})))));
+  EXPECT_CALL(*shards[1], onRequestProposal(round))
+      .WillOnce(Return(
+          ByMove(boost::make_optional(makeProposal(5, {second, first})))));
+
+  std::vector<shared_model::crypto::Hash> hashes;
+  EXPECT_CALL(*factory, unsafeCreateProposal(round.block_round, 5, _))
+      .WillOnce(Invoke([&hashes](auto, auto, auto transactions) {
+        for (const auto &tx : transactions) {
+          hashes.push_back(tx.hash());
+        }
+        return std::make_unique<MockProposal>();
+      }));
+
+  ASSERT_TRUE(manager->onRequestProposal(round));
+  ASSERT_EQ(hashes,
+            (std::vector<shared_model::crypto::Hash>{first->hash(),
+                                                     second->hash()}));
+}
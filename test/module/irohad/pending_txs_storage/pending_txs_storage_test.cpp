@@ -3,6 +3,8 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <thread>
+
 #include <gtest/gtest.h>
 #include <rxcpp/rx.hpp>
 #include "datetime/time.hpp"
@@ -685,4 +687,55 @@ TEST_F(PendingTxsStorageFixture, QueryAllTheBatches) {
         },
         errorResponseHandler);
   }
-}
\ No newline at end of file
+}
+/**
+ * Pending transactions of accounts are read while batches of other accounts
+ * are updated
+ * @given a storage with a batch of alice and bob
+ * @when batches of other accounts are added from another thread
+ * AND pending transactions of alice are queried meanwhile
+ * @then alice's transactions are returned every time
+ * AND all added batches are stored
+ */
+TEST_F(PendingTxsStorageFixture, ConcurrentReadsAndUpdates) {
+  const auto kAccounts = 50u;
+  auto state = emptyState();
+  auto transactions = twoTransactionsBatch();
+  *state += transactions;
+  std::vector<std::shared_ptr<iroha::MstState>> other_states;
+  for (auto i = 0u; i < kAccounts; ++i) {
+    auto other_state = emptyState();
+    *other_state += addSignatures(
+        makeTestBatch(txBuilder(
+            2, getUniqueTime(), 2, "account" + std::to_string(i) + "@iroha")),
+        0,
+        makeSignature("1", "pub_key_1"));
+    other_states.push_back(std::move(other_state));
+  }
+
+  rxcpp::subjects::subject<std::shared_ptr<iroha::MstState>> updates;
+  iroha::PendingTransactionStorageImpl storage(updates.get_observable(),
+                                               dummyObservable(),
+                                               dummyObservable(),
+                                               dummyPreparedTxsObservable());
+  updates.get_subscriber().on_next(state);
+
+  std::thread updater([&] {
+    for (const auto &other_state : other_states) {
+      updates.get_subscriber().on_next(other_state);
+    }
+  });
+  for (auto i = 0u; i < kAccounts; ++i) {
+    ASSERT_EQ(storage.getPendingTransactions("alice@iroha").size(),
+              transactions->transactions().size());
+  }
+  updater.join();
+
+  for (auto i = 0u; i < kAccounts; ++i) {
+    EXPECT_EQ(storage
+                  .getPendingTransactions("account" + std::to_string(i)
+                                          + "@iroha")
+                  .size(),
+              1);
+  }
+}
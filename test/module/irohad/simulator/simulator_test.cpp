@@ -243,3 +243,43 @@ TEST_F(SimulatorTest, SomeFailingTxs) {
         << rejected_tx->toString() << " missing in rejected transactions.";
   }
 }
+
+/**
+ * @given a proposal processed on a ledger state
+ * @when the same proposal comes on the same ledger state in the next round
+ * @then it is not validated again, and the same result is reused
+ */
+TEST_F(SimulatorTest, SameProposalValidatedOnce) {
+  auto proposal = makeProposal(2);
+
+  EXPECT_CALL(*factory, createTemporaryWsv()).Times(1);
+
+  EXPECT_CALL(*validator, validate(_, _))
+      .WillOnce(Invoke([&proposal](const auto &p, auto &v) {
+        auto result = std::make_unique<VerifiedProposalAndErrors>();
+        result->verified_proposal = proposal;
+        return result;
+      }));
+
+  EXPECT_CALL(*crypto_signer, sign(A<shared_model::interface::Block &>()))
+      .Times(2);
+
+  auto ledger_state = std::make_shared<LedgerState>(
+      ledger_peers, proposal->height() - 1, shared_model::crypto::Hash{"hash"});
+
+  std::vector<std::shared_ptr<VerifiedProposalAndErrors>> results;
+  auto proposal_wrapper =
+      make_test_subscriber<CallExact>(simulator->onVerifiedProposal(), 2);
+  proposal_wrapper.subscribe([&results](auto event) {
+    results.push_back(getVerifiedProposalUnsafe(event));
+  });
+
+  ordering_events.get_subscriber().on_next(
+      OrderingEvent{proposal, consensus::Round{2, 0}, ledger_state});
+  ordering_events.get_subscriber().on_next(
+      OrderingEvent{proposal, consensus::Round{2, 1}, ledger_state});
+
+  EXPECT_TRUE(proposal_wrapper.validate());
+  ASSERT_EQ(2, results.size());
+  EXPECT_EQ(results[0], results[1]);
+}
@@ -0,0 +1,150 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "synchronizer/chain_follower.hpp"
+
+#include <gmock/gmock.h>
+#include "framework/test_logger.hpp"
+#include "module/irohad/ametsuchi/mock_block_query.hpp"
+#include "module/irohad/ametsuchi/mock_block_query_factory.hpp"
+#include "module/irohad/ametsuchi/mock_mutable_factory.hpp"
+#include "module/irohad/ametsuchi/mock_mutable_storage.hpp"
+#include "module/irohad/ametsuchi/mock_peer_query.hpp"
+#include "module/irohad/ametsuchi/mock_peer_query_factory.hpp"
+#include "module/irohad/network/network_mocks.hpp"
+#include "module/irohad/validation/validation_mocks.hpp"
+#include "module/shared_model/interface_mocks.hpp"
+
+using namespace iroha;
+using namespace iroha::ametsuchi;
+using namespace iroha::synchronizer;
+using namespace iroha::validation;
+using namespace iroha::network;
+
+using ::testing::_;
+using ::testing::ByMove;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+static constexpr shared_model::interface::types::HeightType kHeight{5};
+
+class ChainFollowerTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    chain_validator = std::make_shared<MockChainValidator>();
+    mutable_factory = std::make_shared<MockMutableFactory>();
+    block_query_factory = std::make_shared<NiceMock<MockBlockQueryFactory>>();
+    peer_query_factory = std::make_shared<NiceMock<MockPeerQueryFactory>>();
+    block_loader = std::make_shared<MockBlockLoader>();
+    block_query = std::make_shared<NiceMock<MockBlockQuery>>();
+    peer_query = std::make_shared<NiceMock<MockPeerQuery>>();
+
+    for (int i = 0; i < 2; ++i) {
+      ledger_peers.push_back(
+          makePeer(std::to_string(i),
+                   shared_model::crypto::PublicKey(std::to_string(i))));
+    }
+
+    ON_CALL(*block_query_factory, createBlockQuery())
+        .WillByDefault(Return(boost::make_optional(
+            std::shared_ptr<iroha::ametsuchi::BlockQuery>(block_query))));
+    ON_CALL(*block_query, getTopBlockHeight()).WillByDefault(Return(kHeight));
+    ON_CALL(*peer_query_factory, createPeerQuery())
+        .WillByDefault(Return(boost::make_optional(
+            std::shared_ptr<iroha::ametsuchi::PeerQuery>(peer_query))));
+    ON_CALL(*peer_query, getLedgerPeers())
+        .WillByDefault(Return(boost::make_optional(ledger_peers)));
+    EXPECT_CALL(*mutable_factory, createMutableStorage())
+        .WillOnce(Invoke(
+            []() -> expected::Result<std::unique_ptr<MutableStorage>,
+                                     std::string> {
+              return expected::makeValue<std::unique_ptr<MutableStorage>>(
+                  std::make_unique<MockMutableStorage>());
+            }));
+
+    follower = std::make_shared<ChainFollower>(chain_validator,
+                                               mutable_factory,
+                                               block_query_factory,
+                                               peer_query_factory,
+                                               block_loader,
+                                               std::chrono::milliseconds(0),
+                                               getTestLogger("ChainFollower"),
+                                               10);
+  }
+
+  /// @return ledger state with the top block at the given height
+  CommitResult makeCommitResult(
+      shared_model::interface::types::HeightType height) {
+    return expected::makeValue(std::make_shared<LedgerState>(
+        ledger_peers, height, shared_model::crypto::Hash("hash")));
+  }
+
+  /// @return block of the given height
+  std::shared_ptr<shared_model::interface::Block> makeBlock(
+      shared_model::interface::types::HeightType height) {
+    auto block = std::make_shared<NiceMock<MockBlock>>();
+    ON_CALL(*block, height()).WillByDefault(Return(height));
+    return block;
+  }
+
+  std::shared_ptr<MockChainValidator> chain_validator;
+  std::shared_ptr<MockMutableFactory> mutable_factory;
+  std::shared_ptr<MockBlockQueryFactory> block_query_factory;
+  std::shared_ptr<MockPeerQueryFactory> peer_query_factory;
+  std::shared_ptr<MockBlockLoader> block_loader;
+  std::shared_ptr<MockBlockQuery> block_query;
+  std::shared_ptr<MockPeerQuery> peer_query;
+
+  std::vector<std::shared_ptr<shared_model::interface::Peer>> ledger_peers;
+  std::shared_ptr<ChainFollower> follower;
+};
+
+/**
+ * @given two ledger peers
+ * @when the first peer fails to provide the blocks AND the second one
+ * provides valid blocks
+ * @then the blocks of the second peer are committed
+ */
+TEST_F(ChainFollowerTest, BlocksAreLoadedFromNextPeer) {
+  EXPECT_CALL(*block_loader,
+              retrieveBlocks(kHeight, ledger_peers[0]->pubkey()))
+      .WillOnce(Return(
+          rxcpp::observable<>::error<
+              std::shared_ptr<shared_model::interface::Block>>(
+              std::runtime_error("unavailable"))));
+  EXPECT_CALL(*block_loader,
+              retrieveBlocks(kHeight, ledger_peers[1]->pubkey()))
+      .WillOnce(Return(rxcpp::observable<>::from(makeBlock(kHeight + 1),
+                                                 makeBlock(kHeight + 2))));
+  EXPECT_CALL(*chain_validator, validateAndApply(_, _)).WillOnce(Return(true));
+  EXPECT_CALL(*mutable_factory, commitIntermediate(_))
+      .WillOnce(
+          Invoke([this](auto &) { return makeCommitResult(kHeight + 2); }));
+  EXPECT_CALL(*mutable_factory, commit_(_))
+      .WillOnce(Return(ByMove(makeCommitResult(kHeight + 2))));
+
+  ASSERT_EQ(follower->follow(), 2);
+}
+
+/**
+ * @given two ledger peers
+ * @when both peers provide blocks which are not valid
+ * @then nothing is committed
+ */
+TEST_F(ChainFollowerTest, InvalidBlocksAreNotCommitted) {
+  EXPECT_CALL(*block_loader, retrieveBlocks(kHeight, _))
+      .Times(2)
+      .WillRepeatedly(Invoke([this](auto, const auto &) {
+        return rxcpp::observable<>::just(makeBlock(kHeight + 1));
+      }));
+  EXPECT_CALL(*chain_validator, validateAndApply(_, _))
+      .Times(2)
+      .WillRepeatedly(Return(false));
+  EXPECT_CALL(*mutable_factory, commitIntermediate(_)).Times(0);
+  EXPECT_CALL(*mutable_factory, commit_(_)).Times(0);
+
+  ASSERT_EQ(follower->follow(), 0);
+}
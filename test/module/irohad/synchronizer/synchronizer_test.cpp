@@ -93,6 +93,13 @@ class SynchronizerTest : public ::testing::Test {
             std::make_shared<LedgerState>(ledger_peers,
                                           commit_message->height(),
                                           commit_message->hash())))));
+    ON_CALL(*mutable_factory, commitIntermediate(_))
+        .WillByDefault(::testing::Invoke([this](auto &) -> CommitResult {
+          return expected::makeValue(
+              std::make_shared<LedgerState>(ledger_peers,
+                                            commit_message->height(),
+                                            commit_message->hash()));
+        }));
     EXPECT_CALL(*mutable_factory, preparedCommitEnabled())
         .WillRepeatedly(Return(false));
     EXPECT_CALL(*mutable_factory, commitPrepared(_)).Times(0);
@@ -228,7 +235,7 @@ TEST_F(SynchronizerTest, ValidWhenSingleCommitSynchronized) {
   EXPECT_CALL(*mutable_factory, commitPrepared(_)).Times(0);
   mutableStorageExpectChain(*mutable_factory, {commit_message});
   EXPECT_CALL(*chain_validator, validateAndApply(_, _)).Times(0);
-  EXPECT_CALL(*block_loader, retrieveBlocks(_, _)).Times(0);
+  EXPECT_CALL(*block_loader, retrieveBlocks(_, _, _)).Times(0);
 
   auto wrapper =
       make_test_subscriber<CallExact>(synchronizer->on_commit_chain(), 1);
@@ -255,7 +262,7 @@ TEST_F(SynchronizerTest, ValidWhenBadStorage) {
       .WillOnce(Return(ByMove(expected::makeError("Connection was closed"))));
   EXPECT_CALL(*mutable_factory, commit_(_)).Times(0);
   EXPECT_CALL(*chain_validator, validateAndApply(_, _)).Times(0);
-  EXPECT_CALL(*block_loader, retrieveBlocks(_, _)).Times(0);
+  EXPECT_CALL(*block_loader, retrieveBlocks(_, _, _)).Times(0);
 
   auto wrapper =
       make_test_subscriber<CallExact>(synchronizer->on_commit_chain(), 0);
@@ -280,7 +287,7 @@ TEST_F(SynchronizerTest, ValidWhenValidChain) {
 
   EXPECT_CALL(*chain_validator, validateAndApply(ChainEq({commit_message}), _))
       .WillOnce(Return(true));
-  EXPECT_CALL(*block_loader, retrieveBlocks(_, _))
+  EXPECT_CALL(*block_loader, retrieveBlocks(_, _, _))
       .WillOnce(Return(rxcpp::observable<>::just(commit_message)));
 
   auto wrapper =
@@ -316,7 +323,7 @@ TEST_F(SynchronizerTest, ValidWhenValidChainMultipleBlocks) {
       commit_message, target_commit};
   EXPECT_CALL(*chain_validator, validateAndApply(ChainEq(commits), _))
       .WillOnce(Return(true));
-  EXPECT_CALL(*block_loader, retrieveBlocks(_, _))
+  EXPECT_CALL(*block_loader, retrieveBlocks(_, _, _))
       .WillOnce(Return(rxcpp::observable<>::iterate(commits)));
 
   auto wrapper =
@@ -333,19 +340,74 @@ TEST_F(SynchronizerTest, ValidWhenValidChainMultipleBlocks) {
   ASSERT_TRUE(wrapper.validate());
 }
 
+/**
+ * @given synchronizer committing every downloaded block separately
+ * @when gate have voted for other block and multiple blocks are loaded
+ * @then every block is committed by the same mutable storage before the next
+ * one is applied, and the storage is committed at the end
+ */
+TEST_F(SynchronizerTest, BlocksAreCommittedInRanges) {
+  auto gate = std::make_shared<MockConsensusGate>();
+  EXPECT_CALL(*gate, onOutcome())
+      .WillOnce(Return(rxcpp::observable<>::never<consensus::GateObject>()));
+  synchronizer = std::make_shared<SynchronizerImpl>(
+      gate,
+      chain_validator,
+      mutable_factory,
+      block_query_factory,
+      block_loader,
+      getTestLogger("Synchronizer"),
+      1);
+
+  DefaultValue<expected::Result<std::unique_ptr<MutableStorage>, std::string>>::
+      SetFactory(&createMockMutableStorage);
+  EXPECT_CALL(*mutable_factory, createMutableStorage()).Times(1);
+
+  const auto target_height = kHeight + 1;
+  auto target_commit = makeCommit(target_height);
+  {
+    InSequence s;  // ensures the call order
+    EXPECT_CALL(*chain_validator,
+                validateAndApply(ChainEq({commit_message}), _))
+        .WillOnce(Return(true));
+    EXPECT_CALL(*mutable_factory, commitIntermediate(_));
+    EXPECT_CALL(*chain_validator, validateAndApply(ChainEq({target_commit}), _))
+        .WillOnce(Return(true));
+    EXPECT_CALL(*mutable_factory, commitIntermediate(_));
+    EXPECT_CALL(*mutable_factory, commit_(_))
+        .WillOnce(Return(ByMove(expected::makeValue(
+            std::make_shared<LedgerState>(
+                ledger_peers, target_height, target_commit->hash())))));
+  }
+  EXPECT_CALL(*block_loader, retrieveBlocks(_, _, _))
+      .WillOnce(Return(rxcpp::observable<>::iterate(
+          std::vector<std::shared_ptr<shared_model::interface::Block>>{
+              commit_message, target_commit})));
+
+  auto wrapper =
+      make_test_subscriber<CallExact>(synchronizer->on_commit_chain(), 1);
+  wrapper.subscribe([target_height](auto commit_event) {
+    ASSERT_EQ(commit_event.round.block_round, target_height);
+  });
+
+  synchronizer->processOutcome(consensus::VoteOther(
+      consensus::Round{kHeight, 1}, ledger_state, public_keys, hash));
+
+  ASSERT_TRUE(wrapper.validate());
+}
+
 /**
  * @given A commit from consensus and initialized components
  * @when gate have voted for other block
- * @then retrieveBlocks called again after unsuccessful download attempt
+ * @then retrieveBlocks called again after unsuccessful download attempt, and
+ * the same mutable storage is used by all attempts
  */
 TEST_F(SynchronizerTest, ExactlyThreeRetrievals) {
   DefaultValue<expected::Result<std::unique_ptr<MutableStorage>, std::string>>::
       SetFactory(&createMockMutableStorage);
-  EXPECT_CALL(*mutable_factory, createMutableStorage()).Times(3);
+  EXPECT_CALL(*mutable_factory, createMutableStorage()).Times(1);
   {
     InSequence s;  // ensures the call order
-    EXPECT_CALL(*chain_validator, validateAndApply(ChainEq({}), _))
-        .WillOnce(Return(true));
     EXPECT_CALL(*chain_validator,
                 validateAndApply(ChainEq({commit_message}), _))
         .WillOnce(Return(false));
@@ -353,7 +415,7 @@ TEST_F(SynchronizerTest, ExactlyThreeRetrievals) {
                 validateAndApply(ChainEq({commit_message}), _))
         .WillOnce(Return(true));
   }
-  EXPECT_CALL(*block_loader, retrieveBlocks(_, _))
+  EXPECT_CALL(*block_loader, retrieveBlocks(_, _, _))
       .WillOnce(Return(rxcpp::observable<>::empty<
                        std::shared_ptr<shared_model::interface::Block>>()))
       .WillOnce(Return(rxcpp::observable<>::just(commit_message)))
@@ -378,9 +440,8 @@ TEST_F(SynchronizerTest, RetrieveBlockSeveralFailures) {
   const size_t number_of_failures{ledger_peers.size() + 2};
   DefaultValue<expected::Result<std::unique_ptr<MutableStorage>, std::string>>::
       SetFactory(&createMockMutableStorage);
-  EXPECT_CALL(*mutable_factory, createMutableStorage())
-      .Times(number_of_failures + 1);
-  EXPECT_CALL(*block_loader, retrieveBlocks(_, _))
+  EXPECT_CALL(*mutable_factory, createMutableStorage()).Times(1);
+  EXPECT_CALL(*block_loader, retrieveBlocks(_, _, _))
       .WillRepeatedly(Return(rxcpp::observable<>::just(commit_message)));
 
   // fail the chain validation two times so that synchronizer will try more
@@ -512,7 +573,7 @@ TEST_F(SynchronizerTest, VotedForOtherCommitPrepared) {
 
   EXPECT_CALL(*mutable_factory, createMutableStorage()).Times(1);
 
-  EXPECT_CALL(*block_loader, retrieveBlocks(_, _))
+  EXPECT_CALL(*block_loader, retrieveBlocks(_, _, _))
       .WillRepeatedly(Return(rxcpp::observable<>::just(commit_message)));
 
   EXPECT_CALL(*chain_validator, validateAndApply(ChainEq({commit_message}), _))
@@ -567,7 +628,7 @@ TEST_F(SynchronizerTest, CommitFailureVoteSameBlock) {
   EXPECT_CALL(*mutable_factory, commit_(_))
       .WillOnce(Return(ByMove(expected::makeError(""))));
   EXPECT_CALL(*chain_validator, validateAndApply(_, _)).Times(0);
-  EXPECT_CALL(*block_loader, retrieveBlocks(_, _)).Times(0);
+  EXPECT_CALL(*block_loader, retrieveBlocks(_, _, _)).Times(0);
 
   auto wrapper =
       make_test_subscriber<CallExact>(synchronizer->on_commit_chain(), 0);
@@ -591,7 +652,7 @@ TEST_F(SynchronizerTest, CommitFailureVoteOther) {
 
   EXPECT_CALL(*chain_validator, validateAndApply(ChainEq({commit_message}), _))
       .WillOnce(Return(true));
-  EXPECT_CALL(*block_loader, retrieveBlocks(_, _))
+  EXPECT_CALL(*block_loader, retrieveBlocks(_, _, _))
       .WillOnce(Return(rxcpp::observable<>::just(commit_message)));
 
   auto wrapper =
@@ -616,7 +677,7 @@ TEST_F(SynchronizerTest, OneRoundDifference) {
 
   EXPECT_CALL(*chain_validator, validateAndApply(ChainEq({commit_message}), _))
       .WillOnce(Return(true));
-  EXPECT_CALL(*block_loader, retrieveBlocks(_, _))
+  EXPECT_CALL(*block_loader, retrieveBlocks(_, _, _))
       .WillOnce(Return(rxcpp::observable<>::just(commit_message)));
 
   auto wrapper =
@@ -0,0 +1,83 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/admission_control.hpp"
+
+#include <gtest/gtest.h>
+
+using iroha::torii::AdmissionControl;
+using namespace std::chrono_literals;
+
+class AdmissionControlTest : public ::testing::Test {
+ public:
+  std::unique_ptr<AdmissionControl> makeControl(double account_rate,
+                                                double peer_rate) {
+    return std::make_unique<AdmissionControl>(
+        account_rate,
+        peer_rate,
+        AdmissionControl::kDefaultMaxBuckets,
+        [this] { return now; });
+  }
+
+  AdmissionControl::Clock::time_point now = AdmissionControl::Clock::now();
+  const std::string kPeer = "ipv4:127.0.0.1";
+  const std::string kAccount = "account@domain";
+};
+
+/**
+ * @given admission control limiting creator accounts to 2 transactions per
+ * second
+ * @when an account sends 3 transactions at once, then one more after a second
+ * @then the first two are admitted, the third is refused and the last one is
+ * admitted again, while another account is not affected
+ */
+TEST_F(AdmissionControlTest, AccountRateIsLimited) {
+  auto control = makeControl(2, 0);
+  ASSERT_TRUE(control->admit(kPeer, {kAccount}));
+  ASSERT_TRUE(control->admit(kPeer, {kAccount}));
+  ASSERT_FALSE(control->admit(kPeer, {kAccount}));
+  ASSERT_TRUE(control->admit(kPeer, {"other@domain"}));
+
+  now += 1s;
+  ASSERT_TRUE(control->admit(kPeer, {kAccount}));
+}
+
+/**
+ * @given admission control limiting client addresses to 3 transactions per
+ * second
+ * @when a client sends a list of 2 transactions twice
+ * @then the second list is refused as a whole, and no tokens are taken by it
+ */
+TEST_F(AdmissionControlTest, ListIsAdmittedAsWhole) {
+  auto control = makeControl(0, 3);
+  ASSERT_TRUE(control->admit(kPeer, {"a@domain", "b@domain"}));
+  ASSERT_FALSE(control->admit(kPeer, {"a@domain", "b@domain"}));
+  ASSERT_TRUE(control->admit(kPeer, {"a@domain"}));
+  ASSERT_TRUE(control->admit("ipv4:127.0.0.2", {"a@domain", "b@domain"}));
+}
+
+/**
+ * @given admission control with both limits
+ * @when a list is refused by the limit of its creator
+ * @then the tokens of the client are not taken
+ */
+TEST_F(AdmissionControlTest, RefusedListTakesNoTokens) {
+  auto control = makeControl(1, 2);
+  ASSERT_FALSE(control->admit(kPeer, {kAccount, kAccount}));
+  ASSERT_TRUE(control->admit(kPeer, {kAccount, "other@domain"}));
+}
+
+/**
+ * @given gRPC client addresses
+ * @when the host is extracted
+ * @then the port is dropped
+ */
+TEST(ClientHostTest, PortIsDropped) {
+  ASSERT_EQ(iroha::torii::clientHost("ipv4:127.0.0.1:50051"),
+            "ipv4:127.0.0.1");
+  ASSERT_EQ(iroha::torii::clientHost("ipv6:[::1]:50051"), "ipv6:[::1]");
+  ASSERT_EQ(iroha::torii::clientHost("ipv6:[::1]"), "ipv6:[::1]");
+  ASSERT_EQ(iroha::torii::clientHost("unix:/tmp/socket"), "unix:/tmp/socket");
+}
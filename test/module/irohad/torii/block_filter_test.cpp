@@ -0,0 +1,98 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/block_filter.hpp"
+
+#include <gtest/gtest.h>
+
+using iroha::torii::BlockFilter;
+
+class BlockFilterTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    auto payload = block.mutable_block_v1()->mutable_payload();
+    payload->set_height(5);
+
+    // 0: alice creates an asset
+    auto create = payload->add_transactions()->mutable_payload();
+    create->mutable_reduced_payload()->set_creator_account_id(kAlice);
+    create->mutable_reduced_payload()
+        ->add_commands()
+        ->mutable_create_asset()
+        ->set_asset_name("coin");
+
+    // 1: admin transfers coins from alice to bob
+    auto transfer = payload->add_transactions()
+                        ->mutable_payload()
+                        ->mutable_reduced_payload();
+    transfer->set_creator_account_id("admin@test");
+    auto command = transfer->add_commands()->mutable_transfer_asset();
+    command->set_src_account_id(kAlice);
+    command->set_dest_account_id(kBob);
+    command->set_asset_id(kCoin);
+
+    // 2: admin adds coins to its account
+    auto add = payload->add_transactions()
+                   ->mutable_payload()
+                   ->mutable_reduced_payload();
+    add->set_creator_account_id("admin@test");
+    add->add_commands()->mutable_add_asset_quantity()->set_asset_id(kCoin);
+  }
+
+  /// @return indices of transactions of the block matching the filter
+  std::vector<uint32_t> matching(const iroha::protocol::BlocksFilter &filter) {
+    auto response = BlockFilter(filter).apply(block);
+    if (not response) {
+      return {};
+    }
+    EXPECT_EQ(response->filtered_block_response().height(), 5);
+    const auto &indices = response->filtered_block_response().tx_indices();
+    EXPECT_EQ(response->filtered_block_response().transactions_size(),
+              indices.size());
+    return {indices.begin(), indices.end()};
+  }
+
+  iroha::protocol::Block block;
+  const std::string kAlice = "alice@test";
+  const std::string kBob = "bob@test";
+  const std::string kCoin = "coin#test";
+};
+
+/**
+ * @given block with transactions of alice
+ * @when it is filtered by the account of alice
+ * @then the transaction created by alice and the transfer from her match
+ */
+TEST_F(BlockFilterTest, AccountMatchesCreatorAndTransfer) {
+  iroha::protocol::BlocksFilter filter;
+  filter.add_account_ids(kAlice);
+  ASSERT_EQ(matching(filter), (std::vector<uint32_t>{0, 1}));
+}
+
+/**
+ * @given block with transactions of coins
+ * @when it is filtered by the asset and by the type of command
+ * @then only transactions matching both conditions are kept
+ */
+TEST_F(BlockFilterTest, ConditionsAreCombined) {
+  iroha::protocol::BlocksFilter filter;
+  filter.add_asset_ids(kCoin);
+  ASSERT_EQ(matching(filter), (std::vector<uint32_t>{1, 2}));
+
+  filter.add_command_types("add_asset_quantity");
+  ASSERT_EQ(matching(filter), (std::vector<uint32_t>{2}));
+}
+
+/**
+ * @given block without transactions of an account
+ * @when it is filtered by the account
+ * @then there is no response
+ */
+TEST_F(BlockFilterTest, NoMatchingTransactions) {
+  iroha::protocol::BlocksFilter filter;
+  filter.add_account_ids("carol@test");
+  ASSERT_FALSE(BlockFilter(filter).empty());
+  ASSERT_TRUE(matching(filter).empty());
+}
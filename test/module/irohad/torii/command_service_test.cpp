@@ -120,3 +120,87 @@ TEST_F(CommandServiceTest, ProcessBatchOn) {
   initCommandService();
   command_service_->handleTransactionBatch(batch);
 }
+
+/**
+ * @given initialized command service with one status in runtime cache
+ * @when  invoke getStatuses with the cached hash and two other hashes
+ * @then  the other hashes are checked in persistent cache with a single call
+ *        @and statuses are returned in the order of hashes
+ */
+TEST_F(CommandServiceTest, getStatusesChecksMissedHashesAtOnce) {
+  using HashType = shared_model::crypto::Hash;
+  auto cached_hash = HashType("a"), committed_hash = HashType("b"),
+       missing_hash = HashType("c");
+  cache_->addItem(cached_hash,
+                  tx_status_factory_->makeEnoughSignaturesCollected(
+                      cached_hash, {}));
+
+  EXPECT_CALL(*status_bus_, statuses())
+      .WillRepeatedly(Return(
+          rxcpp::observable<>::empty<iroha::torii::StatusBus::Objects>()));
+  EXPECT_CALL(*tx_presence_cache_,
+              check(Matcher<const std::vector<HashType> &>(
+                  ElementsAre(committed_hash, missing_hash))))
+      .WillOnce(Return(std::vector<iroha::ametsuchi::TxCacheStatusType>(
+          {iroha::ametsuchi::tx_cache_status_responses::Committed{
+               committed_hash},
+           iroha::ametsuchi::tx_cache_status_responses::Missing{
+               missing_hash}})));
+
+  initCommandService();
+  auto responses = command_service_->getStatuses(
+      {cached_hash, committed_hash, missing_hash});
+
+  ASSERT_EQ(responses.size(), 3);
+  EXPECT_NO_THROW(boost::get<const shared_model::interface::
+                                 EnoughSignaturesCollectedResponse &>(
+      responses[0]->get()));
+  EXPECT_NO_THROW(
+      boost::get<const shared_model::interface::CommittedTxResponse &>(
+          responses[1]->get()));
+  EXPECT_NO_THROW(
+      boost::get<const shared_model::interface::NotReceivedTxResponse &>(
+          responses[2]->get()));
+  EXPECT_TRUE(cache_->findItem(committed_hash));
+  EXPECT_FALSE(cache_->findItem(missing_hash));
+}
+
+/**
+ * @given initialized command service
+ * @when  invoke handleTransactionBatches with a fresh batch and a batch with
+ * a committed transaction
+ * @then  transactions of both batches are checked in persistent cache with a
+ * single call
+ *        @and only the fresh batch is passed to tx_processor
+ */
+TEST_F(CommandServiceTest, BatchesAreCheckedAtOnce) {
+  using HashType = shared_model::crypto::Hash;
+  auto fresh_hash = HashType("a"), committed_hash = HashType("b");
+  auto fresh_batch = createMockBatchWithTransactions(
+      {createMockTransactionWithHash(fresh_hash)}, "a");
+  auto replayed_batch = createMockBatchWithTransactions(
+      {createMockTransactionWithHash(committed_hash)}, "b");
+  EXPECT_CALL(*status_bus_, statuses())
+      .WillRepeatedly(Return(
+          rxcpp::observable<>::empty<iroha::torii::StatusBus::Objects>()));
+
+  EXPECT_CALL(*tx_presence_cache_,
+              check(Matcher<const std::vector<HashType> &>(
+                  ElementsAre(fresh_hash, committed_hash))))
+      .WillOnce(Return(std::vector<iroha::ametsuchi::TxCacheStatusType>(
+          {iroha::ametsuchi::tx_cache_status_responses::Missing{fresh_hash},
+           iroha::ametsuchi::tx_cache_status_responses::Committed{
+               committed_hash}})));
+  EXPECT_CALL(
+      *tx_presence_cache_,
+      check(Matcher<const shared_model::interface::TransactionBatch &>(_)))
+      .Times(0);
+
+  std::shared_ptr<shared_model::interface::TransactionBatch> handled;
+  EXPECT_CALL(*transaction_processor_, batchHandle(_))
+      .WillOnce(SaveArg<0>(&handled));
+
+  initCommandService();
+  command_service_->handleTransactionBatches({fresh_batch, replayed_batch});
+  EXPECT_EQ(handled, fresh_batch);
+}
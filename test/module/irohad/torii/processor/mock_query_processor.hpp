@@ -23,6 +23,22 @@ namespace iroha {
           rxcpp::observable<
               std::shared_ptr<shared_model::interface::BlockQueryResponse>>(
               const shared_model::interface::BlocksQuery &));
+      MOCK_METHOD1(
+          committedBlock,
+          std::shared_ptr<shared_model::interface::BlockQueryResponse>(
+              shared_model::interface::types::HeightType));
+      MOCK_METHOD3(
+          accountsBlockHeights,
+          boost::optional<
+              std::vector<shared_model::interface::types::HeightType>>(
+              const std::vector<shared_model::interface::types::AccountIdType>
+                  &,
+              shared_model::interface::types::HeightType,
+              size_t));
+      MOCK_METHOD1(
+          blocksQueryError,
+          std::shared_ptr<shared_model::interface::BlockQueryResponse>(
+              const shared_model::interface::BlocksQuery &));
     };
 
   }  // namespace torii
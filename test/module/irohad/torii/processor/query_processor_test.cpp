@@ -3,6 +3,8 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <future>
+
 #include <boost/variant.hpp>
 #include "backend/protobuf/block.hpp"
 #include "backend/protobuf/proto_query_response_factory.hpp"
@@ -140,6 +142,93 @@ TEST_F(QueryProcessorTest, QueryProcessorWithWrongKey) {
       response->get()));
 }
 
+/**
+ * @given QueryProcessorImpl and two GetAccountDetail queries which differ
+ * only in counter
+ * @when both queries are handled before and after a commit
+ * @then the query executor is invoked once per ledger height and every
+ * response carries the hash of its own query
+ */
+TEST_F(QueryProcessorTest, QueryResponseIsCachedUntilCommit) {
+  auto make_query = [this](uint64_t counter) {
+    return TestUnsignedQueryBuilder()
+        .creatorAccountId(kAccountId)
+        .queryCounter(counter)
+        .getAccountDetail(kMaxPageSize, kAccountId)
+        .build()
+        .signAndAddSignature(keypair)
+        .finish();
+  };
+  auto first = make_query(1);
+  auto second = make_query(2);
+
+  EXPECT_CALL(*qry_exec, validateAndExecute_(_))
+      .Times(2)
+      .WillRepeatedly(Invoke([this](const auto &qry) {
+        return query_response_factory
+            ->createAccountDetailResponse("", 1, boost::none, qry.hash())
+            .release();
+      }));
+
+  ASSERT_EQ(qpi->queryHandle(first)->queryHash(), first.hash());
+  ASSERT_EQ(qpi->queryHandle(second)->queryHash(), second.hash());
+
+  storage->notifier.get_subscriber().on_next(
+      clone(TestBlockBuilder().height(2).build()));
+
+  ASSERT_EQ(qpi->queryHandle(second)->queryHash(), second.hash());
+  ASSERT_EQ(qpi->queryHandle(first)->queryHash(), first.hash());
+}
+
+/**
+ * @given QueryProcessorImpl executing queries on a lane of an executor
+ * @when the same query is handled asynchronously twice
+ * @then the first response comes from the executor thread, the second one
+ * is taken from the cache before return
+ */
+TEST_F(QueryProcessorTest, AsyncQueryIsExecutedOnLane) {
+  iroha::WorkStealingExecutor executor(1);
+  qpi = std::make_shared<torii::QueryProcessorImpl>(
+      storage,
+      storage,
+      nullptr,
+      query_response_factory,
+      getTestLogger("QueryProcessor"),
+      torii::QueryResponseCache::kDefaultBytes,
+      executor.makeLane(1));
+  auto query = std::make_shared<shared_model::proto::Query>(
+      TestUnsignedQueryBuilder()
+          .creatorAccountId(kAccountId)
+          .getAccountDetail(kMaxPageSize, kAccountId)
+          .build()
+          .signAndAddSignature(keypair)
+          .finish());
+
+  const auto caller = std::this_thread::get_id();
+  EXPECT_CALL(*qry_exec, validateAndExecute_(_))
+      .WillOnce(Invoke([this, caller](const auto &qry) {
+        EXPECT_NE(std::this_thread::get_id(), caller);
+        return query_response_factory
+            ->createAccountDetailResponse("", 1, boost::none, qry.hash())
+            .release();
+      }));
+
+  std::promise<std::unique_ptr<shared_model::interface::QueryResponse>>
+      executed;
+  qpi->queryHandleAsync(query, [&executed](auto response) {
+    executed.set_value(std::move(response));
+  });
+  auto response = executed.get_future().get();
+  ASSERT_TRUE(response);
+  ASSERT_EQ(response->queryHash(), query->hash());
+
+  bool cached = false;
+  qpi->queryHandleAsync(query, [&cached, caller](auto response) {
+    cached = response and std::this_thread::get_id() == caller;
+  });
+  ASSERT_TRUE(cached);
+}
+
 /**
  * @given account, ametsuchi queries
  * @when valid block query is sent
@@ -195,3 +284,33 @@ TEST_F(QueryProcessorTest, GetBlocksQueryNoPerms) {
   }
   ASSERT_TRUE(wrapper.validate());
 }
+
+/**
+ * @given block store with a block at height 1
+ * @when committed blocks at heights 1 and 2 are requested
+ * @then a response with the first block is returned, and nothing for the
+ * second one
+ */
+TEST_F(QueryProcessorTest, CommittedBlock) {
+  auto block_query = std::make_shared<MockBlockQuery>();
+  EXPECT_CALL(*storage, getBlockQuery()).WillRepeatedly(Return(block_query));
+  EXPECT_CALL(*block_query, getBlock(1)).WillOnce(Invoke([](auto) {
+    return BlockQuery::BlockResult(iroha::expected::makeValue(
+        std::shared_ptr<const shared_model::interface::Block>(
+            clone(TestBlockBuilder().height(1).build()))));
+  }));
+  EXPECT_CALL(*block_query, getBlock(2)).WillOnce(Invoke([](auto) {
+    return BlockQuery::BlockResult(iroha::expected::makeError(
+        BlockQuery::GetBlockError{BlockQuery::GetBlockError::Code::kNoBlock,
+                                  "no block"}));
+  }));
+
+  auto response = qpi->committedBlock(1);
+  ASSERT_TRUE(response);
+  ASSERT_EQ(boost::get<const shared_model::interface::BlockResponse &>(
+                response->get())
+                .block()
+                .height(),
+            1);
+  ASSERT_FALSE(qpi->committedBlock(2));
+}
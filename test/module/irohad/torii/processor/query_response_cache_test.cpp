@@ -0,0 +1,121 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/processor/query_response_cache.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace iroha::torii;
+
+class QueryResponseCacheTest : public ::testing::Test {
+ public:
+  /// @return key of the i-th query
+  std::string key(size_t i) {
+    return std::string(kKeySize, static_cast<char>('a' + i));
+  }
+
+  /// @return response with a detail of the given size
+  iroha::protocol::QueryResponse response(size_t detail_size) {
+    iroha::protocol::QueryResponse response;
+    response.mutable_account_detail_response()->set_detail(
+        std::string(detail_size, 'd'));
+    return response;
+  }
+
+  /// budget which holds the given number of responses with the given detail
+  uint64_t budget(size_t responses, size_t detail_size = 0) {
+    return responses
+        * (QueryResponseCache::kEntryOverhead + kKeySize
+           + response(detail_size).ByteSizeLong());
+  }
+
+  static constexpr size_t kKeySize = 16;
+};
+
+constexpr size_t QueryResponseCacheTest::kKeySize;
+
+/**
+ * @given cache holding two responses
+ * @when three responses are added
+ * @then the first one is evicted
+ */
+TEST_F(QueryResponseCacheTest, EvictsOldestResponses) {
+  QueryResponseCache cache(budget(2));
+  for (size_t i = 0; i < 3; ++i) {
+    cache.addItem(key(i), response(0));
+  }
+
+  EXPECT_FALSE(cache.findItem(key(0)));
+  EXPECT_TRUE(cache.findItem(key(1)));
+  EXPECT_TRUE(cache.findItem(key(2)));
+  EXPECT_EQ(cache.getCacheBytes(), budget(2));
+}
+
+/**
+ * @given cache holding two responses
+ * @when the first response is found @and a third one is added
+ * @then the second response, used least recently, is evicted
+ */
+TEST_F(QueryResponseCacheTest, EvictsLeastRecentlyUsed) {
+  QueryResponseCache cache(budget(2));
+  cache.addItem(key(0), response(0));
+  cache.addItem(key(1), response(0));
+  ASSERT_TRUE(cache.findItem(key(0)));
+  cache.addItem(key(2), response(0));
+
+  EXPECT_TRUE(cache.findItem(key(0)));
+  EXPECT_FALSE(cache.findItem(key(1)));
+  EXPECT_TRUE(cache.findItem(key(2)));
+}
+
+/**
+ * @given cache with budget for several small responses
+ * @when a large response is added
+ * @then small responses are evicted to fit it @and the large one is kept
+ */
+TEST_F(QueryResponseCacheTest, LargeResponseEvictsSmallOnes) {
+  QueryResponseCache cache(budget(1, 1000));
+  for (size_t i = 0; i < 3; ++i) {
+    cache.addItem(key(i), response(0));
+  }
+  cache.addItem(key(3), response(1000));
+
+  EXPECT_EQ(cache.getCacheItemCount(), 1);
+  auto cached = cache.findItem(key(3));
+  ASSERT_TRUE(cached);
+  EXPECT_EQ(cached->account_detail_response().detail().size(), 1000);
+  EXPECT_LE(cache.getCacheBytes(), budget(1, 1000));
+}
+
+/**
+ * @given cache with a response
+ * @when the response of the same key is replaced by a larger one
+ * @then the cache holds one response of the new size
+ */
+TEST_F(QueryResponseCacheTest, ReplacedResponseIsAccounted) {
+  QueryResponseCache cache(budget(4, 100));
+  cache.addItem(key(0), response(0));
+  cache.addItem(key(0), response(100));
+
+  EXPECT_EQ(cache.getCacheItemCount(), 1);
+  EXPECT_EQ(cache.getCacheBytes(), budget(1, 100));
+}
+
+/**
+ * @given cache with responses
+ * @when a response larger than the whole budget is added
+ * @then it is not cached @and the other responses are kept
+ */
+TEST_F(QueryResponseCacheTest, OversizedResponseNotCached) {
+  QueryResponseCache cache(budget(2, 100));
+  cache.addItem(key(0), response(0));
+  cache.addItem(key(1), response(0));
+  cache.addItem(key(2), response(1000));
+
+  EXPECT_FALSE(cache.findItem(key(2)));
+  EXPECT_TRUE(cache.findItem(key(0)));
+  EXPECT_TRUE(cache.findItem(key(1)));
+  EXPECT_EQ(cache.getCacheBytes(), budget(2));
+}
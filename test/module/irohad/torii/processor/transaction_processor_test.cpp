@@ -5,6 +5,9 @@
 
 #include "torii/processor/transaction_processor_impl.hpp"
 
+#include <future>
+#include <thread>
+
 #include <boost/range/adaptor/transformed.hpp>
 #include <boost/range/join.hpp>
 #include <boost/variant.hpp>
@@ -336,6 +339,62 @@ TEST_F(TransactionProcessorTest, TransactionProcessorOnCommitTest) {
   validateStatuses<shared_model::interface::CommittedTxResponse>(txs);
 }
 
+/**
+ * @given transaction processor which publishes statuses on a coordination
+ * @when a proposal is verified @and a block is committed
+ * @then statuses are published on the worker of the coordination
+ * @and committed statuses follow stateful valid ones
+ */
+TEST_F(TransactionProcessorTest, TransactionProcessorAsyncStatusPublishingTest) {
+  tp = std::make_shared<TransactionProcessorImpl>(
+      pcs,
+      mst,
+      status_bus,
+      status_factory,
+      commit_notifier.get_observable(),
+      getTestLogger("TransactionProcessor"),
+      rxcpp::observe_on_one_worker(rxcpp::schedulers::make_same_worker(
+          rxcpp::schedulers::make_new_thread().create_worker())));
+
+  auto tx = addSignaturesFromKeyPairs(baseTestTx(), makeKey());
+  std::vector<shared_model::proto::Transaction> txs{tx};
+
+  std::vector<std::shared_ptr<shared_model::interface::TransactionResponse>>
+      statuses;
+  std::promise<std::thread::id> published;
+  EXPECT_CALL(*status_bus, publish(_))
+      .Times(2)
+      .WillRepeatedly(testing::Invoke([&](auto response) {
+        statuses.push_back(response);
+        if (statuses.size() == 2) {
+          published.set_value(std::this_thread::get_id());
+        }
+      }));
+
+  auto validation_result =
+      std::make_shared<iroha::validation::VerifiedProposalAndErrors>();
+  validation_result->verified_proposal =
+      std::make_unique<shared_model::proto::Proposal>(
+          TestProposalBuilder().transactions(txs).build());
+  verified_prop_notifier.get_subscriber().on_next(
+      simulator::VerifiedProposalCreatorEvent{
+          validation_result, round, ledger_state});
+  auto block = TestBlockBuilder().transactions(txs).build();
+  commit_notifier.get_subscriber().on_next(
+      std::shared_ptr<shared_model::interface::Block>(clone(block)));
+
+  auto worker = published.get_future();
+  ASSERT_EQ(worker.wait_for(std::chrono::seconds(5)),
+            std::future_status::ready);
+  ASSERT_NE(worker.get(), std::this_thread::get_id());
+  ASSERT_NO_THROW(
+      boost::get<const shared_model::interface::StatefulValidTxResponse &>(
+          statuses[0]->get()));
+  ASSERT_NO_THROW(
+      boost::get<const shared_model::interface::CommittedTxResponse &>(
+          statuses[1]->get()));
+}
+
 /**
  * @given transaction processor
  * @when transactions compose proposal which is sent to peer
@@ -486,3 +545,21 @@ TEST_F(TransactionProcessorTest, MultisigExpired) {
   mst_expired_notifier.get_subscriber().on_next(
       framework::batch::createBatchFromSingleTransaction(tx));
 }
+
+/**
+ * @given batch of one transaction with quorum 1
+ * AND one signature
+ * @when transaction_processor handles the batch
+ * @then the batch is relayed to PCS without looking it up in MST storage
+ */
+TEST_F(TransactionProcessorTest, SingleSignatureBatchBypassesMst) {
+  auto &&tx = addSignaturesFromKeyPairs(baseTestTx(), makeKey());
+
+  EXPECT_CALL(*status_bus, publish(_)).Times(1);
+  EXPECT_CALL(*mst, batchInStorageImpl(_)).Times(0);
+  EXPECT_CALL(*mst, propagateBatchImpl(_)).Times(0);
+  EXPECT_CALL(*pcs, propagate_batch(_)).Times(1);
+
+  tp->batchHandle(framework::batch::createBatchFromSingleTransaction(
+      std::shared_ptr<shared_model::interface::Transaction>(clone(tx))));
+}
@@ -0,0 +1,157 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/query_jobs.hpp"
+
+#include <atomic>
+#include <future>
+#include <thread>
+
+#include <gtest/gtest.h>
+#include "common/timer_wheel.hpp"
+#include "framework/test_logger.hpp"
+
+using namespace iroha;
+using namespace iroha::torii;
+
+class QueryJobsTest : public ::testing::Test {
+ public:
+  /// @return a job producing pages numbered from 0, pages_ counts them
+  QueryJobs::NextPage pages(size_t count) {
+    return [this, count]() -> boost::optional<iroha::protocol::QueryResponse> {
+      auto page = pages_.load();
+      if (page == count) {
+        return boost::none;
+      }
+      ++pages_;
+      iroha::protocol::QueryResponse response;
+      response.set_query_hash(std::to_string(page));
+      return response;
+    };
+  }
+
+  std::shared_ptr<QueryJobs> makeJobs(size_t max_jobs) {
+    return std::make_shared<QueryJobs>(max_jobs,
+                                       executor_,
+                                       interactive_lane_,
+                                       timer_wheel_,
+                                       getTestLogger("QueryJobs"));
+  }
+
+  /// @return true if the predicate holds before the timeout
+  template <typename Predicate>
+  bool waitFor(Predicate predicate) {
+    auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (not predicate()) {
+      if (std::chrono::steady_clock::now() > deadline) {
+        return false;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+  }
+
+  /// @return hashes of the responses of the job until it is finished
+  std::vector<std::string> fetchAll(QueryJobs &jobs, const std::string &id) {
+    std::vector<std::string> hashes;
+    bool finished = false;
+    EXPECT_TRUE(waitFor([&] {
+      auto fetched = jobs.fetch(id);
+      if (not fetched) {
+        return true;
+      }
+      for (const auto &response : fetched->responses) {
+        hashes.push_back(response.query_hash());
+      }
+      finished = fetched->finished;
+      return finished;
+    }));
+    EXPECT_TRUE(finished);
+    return hashes;
+  }
+
+  std::atomic<size_t> pages_{0};
+  WorkStealingExecutor executor_{2};
+  std::shared_ptr<WorkStealingExecutor::Lane> interactive_lane_ =
+      executor_.makeLane(1);
+  std::shared_ptr<TimerWheel> timer_wheel_ = std::make_shared<TimerWheel>();
+};
+
+/**
+ * @given query jobs
+ * @when a job executing three pages is submitted and fetched
+ * @then the responses are fetched in order, and the finished job is
+ * forgotten
+ */
+TEST_F(QueryJobsTest, FetchesPagesInOrder) {
+  auto jobs = makeJobs(1);
+  auto id = jobs->submit(pages(3));
+  ASSERT_TRUE(id);
+
+  EXPECT_EQ(fetchAll(*jobs, *id), (std::vector<std::string>{"0", "1", "2"}));
+  EXPECT_FALSE(jobs->fetch(*id));
+}
+
+/**
+ * @given query jobs holding at most one job
+ * @when a second job is submitted while the first one is held
+ * @then it is refused, and it is accepted once the first one is fetched
+ */
+TEST_F(QueryJobsTest, LimitsJobs) {
+  auto jobs = makeJobs(1);
+  auto id = jobs->submit(pages(1));
+  ASSERT_TRUE(id);
+
+  EXPECT_FALSE(jobs->submit(pages(1)));
+  fetchAll(*jobs, *id);
+  EXPECT_TRUE(jobs->submit(pages(1)));
+}
+
+/**
+ * @given query jobs
+ * @when a job has more pages than it buffers
+ * @then it pauses until its responses are fetched, and resumes after that
+ */
+TEST_F(QueryJobsTest, PausesWhenBufferIsFull) {
+  auto jobs = makeJobs(1);
+  auto id = jobs->submit(pages(QueryJobs::kMaxBufferedPages * 3));
+  ASSERT_TRUE(id);
+
+  ASSERT_TRUE(
+      waitFor([this] { return pages_ == QueryJobs::kMaxBufferedPages; }));
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_EQ(pages_, QueryJobs::kMaxBufferedPages);
+
+  auto fetched = jobs->fetch(*id);
+  ASSERT_TRUE(fetched);
+  EXPECT_EQ(fetched->responses.size(), QueryJobs::kMaxBufferedPages);
+  EXPECT_FALSE(fetched->finished);
+  EXPECT_TRUE(
+      waitFor([this] { return pages_ == 2 * QueryJobs::kMaxBufferedPages; }));
+}
+
+/**
+ * @given query jobs and an interactive query waiting for execution
+ * @when a job is submitted
+ * @then its pages are postponed until the interactive query is executed
+ */
+TEST_F(QueryJobsTest, YieldsToInteractiveQueries) {
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  interactive_lane_->post([released] { released.wait(); });
+  std::atomic<bool> executed{false};
+  interactive_lane_->post([&executed] { executed = true; });
+
+  auto jobs = makeJobs(1);
+  auto id = jobs->submit(pages(2));
+  ASSERT_TRUE(id);
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_EQ(pages_, 0);
+
+  release.set_value();
+  EXPECT_EQ(fetchAll(*jobs, *id), (std::vector<std::string>{"0", "1"}));
+  EXPECT_TRUE(waitFor([&executed] { return executed.load(); }));
+}
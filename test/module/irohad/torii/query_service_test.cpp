@@ -9,6 +9,8 @@
 #include "backend/protobuf/query_responses/proto_query_response.hpp"
 #include "builders/protobuf/queries.hpp"
 #include "framework/test_logger.hpp"
+#include "interfaces/queries/asset_pagination_meta.hpp"
+#include "interfaces/queries/get_account_assets.hpp"
 #include "module/irohad/common/validators_config.hpp"
 #include "module/irohad/torii/processor/mock_query_processor.hpp"
 #include "utils/query_error_response_visitor.hpp"
@@ -115,7 +117,7 @@ TEST_F(QueryServiceTest, ValidWhenUniqueHash) {
  * @given query
  * @when query is sent to query service twice
  * @then query processor will be invoked once and second response will have
- * STATELESS_INVALID status
+ * STATELESS_INVALID status with the hash of the query and the reason
  */
 TEST_F(QueryServiceTest, InvalidWhenDuplicateHash) {
   // two same queries => only first query handled by query processor
@@ -131,9 +133,71 @@ TEST_F(QueryServiceTest, InvalidWhenDuplicateHash) {
   // second call of the same query
   query_service->Find(query->getTransport(), response);
   ASSERT_TRUE(response.has_error_response());
+  ASSERT_EQ(response.query_hash(), query->hash().hex());
+  ASSERT_FALSE(response.error_response().message().empty());
   shared_model::proto::QueryResponse resp{protocol::QueryResponse{response}};
   ASSERT_TRUE(boost::apply_visitor(
       shared_model::interface::QueryErrorResponseChecker<
           shared_model::interface::StatelessFailedErrorResponse>(),
       resp.get()));
 }
+
+/**
+ * @given paginated query which result consists of two pages
+ * @when query is sent to query service as a stream
+ * @then query processor is invoked for every page, starting from the cursor
+ * returned with the previous one, and both pages are written to the stream
+ */
+TEST_F(QueryServiceTest, FindStreamWritesAllPages) {
+  auto assets_query = shared_model::proto::QueryBuilder()
+                          .creatorAccountId("user@domain")
+                          .createdTime(iroha::time::now())
+                          .queryCounter(1)
+                          .getAccountAssets("user@domain", 1, boost::none)
+                          .build()
+                          .signAndAddSignature(
+                              shared_model::crypto::DefaultCryptoAlgorithmType::
+                                  generateKeypair())
+                          .finish();
+  shared_model::proto::ProtoQueryResponseFactory factory;
+  std::vector<std::tuple<types::AccountIdType, types::AssetIdType, Amount>>
+      page{{"user@domain", "coin#domain", Amount{"1.0"}}};
+
+  EXPECT_CALL(*query_processor,
+              queryHandle(Truly([](const shared_model::interface::Query &q) {
+                return not boost::get<const GetAccountAssets &>(q.get())
+                               .paginationMeta()
+                               ->firstAssetId();
+              })))
+      .WillOnce(Invoke([&](auto &q) {
+        return factory.createAccountAssetResponse(
+            page, 2, types::AssetIdType{"gold#domain"}, q.hash());
+      }));
+  EXPECT_CALL(*query_processor,
+              queryHandle(Truly([](const shared_model::interface::Query &q) {
+                return boost::get<const GetAccountAssets &>(q.get())
+                           .paginationMeta()
+                           ->firstAssetId()
+                    == types::AssetIdType{"gold#domain"};
+              })))
+      .WillOnce(Invoke([&](auto &q) {
+        return factory.createAccountAssetResponse(
+            page, 2, boost::none, q.hash());
+      }));
+  init();
+
+  std::vector<protocol::QueryResponse> responses;
+  query_service->FindStream(assets_query.getTransport(),
+                            [&responses](const auto &response) {
+                              responses.push_back(response);
+                              return true;
+                            });
+
+  ASSERT_EQ(responses.size(), 2);
+  for (const auto &response : responses) {
+    ASSERT_TRUE(response.has_account_assets_response());
+    ASSERT_EQ(response.query_hash(), assets_query.hash().hex());
+  }
+  ASSERT_EQ(responses[0].account_assets_response().next_asset_id(),
+            "gold#domain");
+}
@@ -0,0 +1,124 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/impl/sharded_status_bus.hpp"
+
+#include <condition_variable>
+#include <mutex>
+
+#include <gtest/gtest.h>
+#include <boost/variant.hpp>
+#include "backend/protobuf/proto_tx_status_factory.hpp"
+#include "cryptography/hash.hpp"
+
+using namespace iroha::torii;
+using namespace std::chrono_literals;
+
+class ShardedStatusBusTest : public ::testing::Test {
+ public:
+  using ResponsePtr = StatusBus::Objects;
+
+  /// publish statuses of several transactions, interleaved
+  void publishStatuses() {
+    for (const auto &hash : hashes) {
+      bus->publish(factory->makeStatelessValid(hash));
+    }
+    for (const auto &hash : hashes) {
+      bus->publish(factory->makeEnoughSignaturesCollected(hash));
+    }
+    for (const auto &hash : hashes) {
+      bus->publish(factory->makeCommitted(hash));
+    }
+  }
+
+  /// wait until the given number of statuses is received
+  void waitFor(size_t number) {
+    std::unique_lock<std::mutex> lock(mutex);
+    ASSERT_TRUE(received_cv.wait_for(
+        lock, 5s, [&] { return received_number >= number; }));
+  }
+
+  static constexpr size_t kShards = 4;
+  static constexpr size_t kTransactions = 16;
+
+  std::shared_ptr<ShardedStatusBus> bus = ShardedStatusBus::create(kShards);
+  std::shared_ptr<shared_model::interface::TxStatusFactory> factory =
+      std::make_shared<shared_model::proto::ProtoTxStatusFactory>();
+  std::vector<shared_model::crypto::Hash> hashes = [] {
+    std::vector<shared_model::crypto::Hash> hashes;
+    for (size_t i = 0; i < kTransactions; ++i) {
+      hashes.emplace_back(std::string(32, static_cast<char>('a' + i)));
+    }
+    return hashes;
+  }();
+
+  std::mutex mutex;
+  std::condition_variable received_cv;
+  size_t received_number = 0;
+};
+
+/**
+ * @given sharded status bus with several workers
+ * @when statuses of several transactions are published
+ * @then subscribers of every transaction receive only its statuses in the
+ * order of publishing
+ */
+TEST_F(ShardedStatusBusTest, TransactionStatusesKeepOrder) {
+  std::vector<std::vector<ResponsePtr>> received(kTransactions);
+  std::vector<rxcpp::composite_subscription> subscriptions;
+  for (size_t i = 0; i < kTransactions; ++i) {
+    subscriptions.push_back(
+        bus->transactionStatuses(hashes[i]).subscribe([&, i](auto response) {
+          std::lock_guard<std::mutex> lock(mutex);
+          received[i].push_back(response);
+          ++received_number;
+          received_cv.notify_one();
+        }));
+  }
+
+  publishStatuses();
+  waitFor(kTransactions * 3);
+
+  std::lock_guard<std::mutex> lock(mutex);
+  EXPECT_EQ(received_number, kTransactions * 3);
+  for (size_t i = 0; i < kTransactions; ++i) {
+    ASSERT_EQ(received[i].size(), 3);
+    for (const auto &response : received[i]) {
+      EXPECT_EQ(response->transactionHash(), hashes[i]);
+    }
+    EXPECT_NO_THROW(
+        boost::get<const shared_model::interface::StatelessValidTxResponse &>(
+            received[i][0]->get()));
+    EXPECT_NO_THROW(boost::get<const shared_model::interface::
+                                   EnoughSignaturesCollectedResponse &>(
+        received[i][1]->get()));
+    EXPECT_NO_THROW(
+        boost::get<const shared_model::interface::CommittedTxResponse &>(
+            received[i][2]->get()));
+  }
+  for (auto &subscription : subscriptions) {
+    subscription.unsubscribe();
+  }
+}
+
+/**
+ * @given sharded status bus with several workers
+ * @when statuses of several transactions are published
+ * @then subscriber of all statuses receives every status of every shard
+ */
+TEST_F(ShardedStatusBusTest, StatusesOfAllShards) {
+  auto subscription = bus->statuses().subscribe([&](auto) {
+    std::lock_guard<std::mutex> lock(mutex);
+    ++received_number;
+    received_cv.notify_one();
+  });
+
+  publishStatuses();
+  waitFor(kTransactions * 3);
+
+  std::lock_guard<std::mutex> lock(mutex);
+  EXPECT_EQ(received_number, kTransactions * 3);
+  subscription.unsubscribe();
+}
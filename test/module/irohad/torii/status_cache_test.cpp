@@ -0,0 +1,115 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/status_cache.hpp"
+
+#include <gtest/gtest.h>
+#include "backend/protobuf/proto_tx_status_factory.hpp"
+
+using namespace iroha::torii;
+using shared_model::interface::TxStatusFactory;
+
+class StatusCacheTest : public ::testing::Test {
+ public:
+  /// @return hash of the i-th transaction
+  shared_model::crypto::Hash hash(size_t i) {
+    return shared_model::crypto::Hash(std::string(32, static_cast<char>(i)));
+  }
+
+  /// budget which holds the given number of statuses without messages
+  uint64_t budget(size_t statuses) {
+    return statuses * (StatusCache::kEntryOverhead + 32);
+  }
+
+  std::shared_ptr<TxStatusFactory> factory_ =
+      std::make_shared<shared_model::proto::ProtoTxStatusFactory>();
+};
+
+/**
+ * @given status cache holding two final statuses
+ * @when three transactions are committed
+ * @then the status of the first one is evicted
+ */
+TEST_F(StatusCacheTest, EvictsOldestFinalStatuses) {
+  StatusCache cache(budget(2), budget(2));
+  for (size_t i = 0; i < 3; ++i) {
+    cache.addItem(hash(i), factory_->makeCommitted(hash(i)));
+  }
+
+  EXPECT_FALSE(cache.findItem(hash(0)));
+  EXPECT_TRUE(cache.findItem(hash(1)));
+  EXPECT_TRUE(cache.findItem(hash(2)));
+  EXPECT_EQ(cache.getCacheBytes(), budget(2));
+}
+
+/**
+ * @given status cache with a final status
+ * @when more intermediate statuses than the intermediate budget are added
+ * @then the final status is kept
+ */
+TEST_F(StatusCacheTest, IntermediateStatusesDoNotEvictFinal) {
+  StatusCache cache(budget(1), budget(2));
+  cache.addItem(hash(0), factory_->makeRejected(hash(0)));
+  for (size_t i = 1; i < 10; ++i) {
+    cache.addItem(hash(i), factory_->makeStatelessValid(hash(i)));
+  }
+
+  EXPECT_TRUE(cache.findItem(hash(0)));
+  EXPECT_EQ(cache.getCacheItemCount(), 3);
+}
+
+/**
+ * @given status cache with an intermediate status of a transaction
+ * @when the transaction gets a final status
+ * @then the status moves to the final tier, freeing the intermediate one
+ */
+TEST_F(StatusCacheTest, FinalStatusMovesToFinalTier) {
+  StatusCache cache(budget(1), budget(1));
+  cache.addItem(hash(0), factory_->makeStatelessValid(hash(0)));
+  cache.addItem(hash(0), factory_->makeCommitted(hash(0)));
+  cache.addItem(hash(1), factory_->makeStatelessValid(hash(1)));
+
+  EXPECT_TRUE(cache.findItem(hash(0)));
+  EXPECT_TRUE(cache.findItem(hash(1)));
+  EXPECT_EQ(cache.getCacheItemCount(), 2);
+}
+
+/**
+ * @given status cache
+ * @when a status with a long error message is added
+ * @then its message is accounted to the size of the cache
+ */
+TEST_F(StatusCacheTest, AccountsErrorMessages) {
+  StatusCache cache(budget(8), budget(8));
+  std::string message(1000, 'x');
+  cache.addItem(hash(0),
+                factory_->makeStatelessFail(
+                    hash(0), TxStatusFactory::TransactionError(message, 0, 0)));
+
+  EXPECT_EQ(cache.getCacheBytes(), budget(1) + message.size());
+}
+
+/**
+ * @given status cache with final statuses @and an intermediate status
+ * @when a final status with a message larger than the final budget is added
+ * for the transaction with the intermediate status
+ * @then the status is not cached @and the other final statuses are kept
+ */
+TEST_F(StatusCacheTest, OversizedStatusNotCached) {
+  StatusCache cache(budget(2), budget(2));
+  cache.addItem(hash(0), factory_->makeCommitted(hash(0)));
+  cache.addItem(hash(1), factory_->makeCommitted(hash(1)));
+  cache.addItem(hash(2), factory_->makeStatelessValid(hash(2)));
+  cache.addItem(hash(2),
+                factory_->makeStatelessFail(
+                    hash(2),
+                    TxStatusFactory::TransactionError(
+                        std::string(budget(2), 'x'), 0, 0)));
+
+  EXPECT_FALSE(cache.findItem(hash(2)));
+  EXPECT_TRUE(cache.findItem(hash(0)));
+  EXPECT_TRUE(cache.findItem(hash(1)));
+  EXPECT_EQ(cache.getCacheBytes(), budget(2));
+}
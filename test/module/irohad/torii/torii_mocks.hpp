@@ -36,6 +36,11 @@ namespace iroha {
           getStatus,
           std::shared_ptr<shared_model::interface::TransactionResponse>(
               const shared_model::crypto::Hash &request));
+      MOCK_METHOD1(
+          getStatuses,
+          std::vector<
+              std::shared_ptr<shared_model::interface::TransactionResponse>>(
+              const std::vector<shared_model::crypto::Hash> &));
       MOCK_METHOD1(
           getStatusStream,
           rxcpp::observable<
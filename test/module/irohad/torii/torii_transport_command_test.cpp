@@ -14,6 +14,7 @@
 #include "backend/protobuf/proto_transport_factory.hpp"
 #include "backend/protobuf/proto_tx_status_factory.hpp"
 #include "backend/protobuf/transaction.hpp"
+#include "common/thread_pool.hpp"
 #include "cryptography/public_key.hpp"
 #include "endpoint.pb.h"
 #include "endpoint_mock.grpc.pb.h"
@@ -170,6 +171,80 @@ TEST_F(CommandServiceTransportGrpcTest, ListTorii) {
   transport_grpc->ListTorii(&context, &request, &response);
 }
 
+/**
+ * @given torii service with validation thread pool and number of transactions
+ * @when calling ListTorii
+ * @then every transaction is validated once and CommandService called
+ * handleTransactionBatch as the tx num
+ */
+TEST_F(CommandServiceTransportGrpcTest, ListToriiParallelValidation) {
+  grpc::ServerContext context;
+  google::protobuf::Empty response;
+  transport_grpc = std::make_shared<CommandServiceTransportGrpc>(
+      command_service,
+      status_bus,
+      status_factory,
+      transaction_factory,
+      batch_parser,
+      batch_factory,
+      rxcpp::observable<>::iterate(gate_objects),
+      gate_objects.size(),
+      getTestLogger("CommandServiceTransportGrpc"),
+      std::make_shared<iroha::ThreadPool>(2));
+
+  iroha::protocol::TxList request;
+  for (size_t i = 0; i < kTimes; ++i) {
+    request.add_transactions();
+  }
+
+  EXPECT_CALL(*proto_tx_validator, validate(_))
+      .Times(kTimes)
+      .WillRepeatedly(Return(shared_model::validation::Answer{}));
+  EXPECT_CALL(*tx_validator, validate(_))
+      .Times(kTimes)
+      .WillRepeatedly(Return(shared_model::validation::Answer{}));
+  EXPECT_CALL(
+      *batch_factory,
+      createTransactionBatch(
+          A<const shared_model::interface::types::SharedTxsCollectionType &>()))
+      .Times(kTimes);
+
+  EXPECT_CALL(*command_service, handleTransactionBatch(_)).Times(kTimes);
+  transport_grpc->ListTorii(&context, &request, &response);
+}
+
+/**
+ * @given overloaded torii service and number of transactions
+ * @when calling ListTorii
+ * @then transactions are refused with retryable status
+ * AND CommandService is not called
+ */
+TEST_F(CommandServiceTransportGrpcTest, ListToriiOverloaded) {
+  grpc::ServerContext context;
+  google::protobuf::Empty response;
+  transport_grpc = std::make_shared<CommandServiceTransportGrpc>(
+      command_service,
+      status_bus,
+      status_factory,
+      transaction_factory,
+      batch_parser,
+      batch_factory,
+      rxcpp::observable<>::iterate(gate_objects),
+      gate_objects.size(),
+      getTestLogger("CommandServiceTransportGrpc"),
+      nullptr,
+      [] { return true; });
+
+  iroha::protocol::TxList request;
+  for (size_t i = 0; i < kTimes; ++i) {
+    request.add_transactions();
+  }
+
+  EXPECT_CALL(*command_service, handleTransactionBatch(_)).Times(0);
+  auto status = transport_grpc->ListTorii(&context, &request, &response);
+  ASSERT_EQ(status.error_code(), grpc::StatusCode::UNAVAILABLE);
+}
+
 /**
  * @given torii service and number of invalid transactions
  * @when calling ListTorii
@@ -294,3 +369,52 @@ TEST_F(CommandServiceTransportGrpcTest, StatusStreamOnNotReceived) {
                           &response_writer))
                   .ok());
 }
+
+/**
+ * @given torii service and status streams of two transactions
+ * @when calling StatusesStream with hashes of both transactions, one of them
+ *       repeated
+ * @then ServerWriter is called once for every status of every transaction
+ */
+TEST_F(CommandServiceTransportGrpcTest, StatusesStreamOfSeveralTransactions) {
+  grpc::ServerContext context;
+  iroha::protocol::TxStatusesRequest request;
+  iroha::MockServerWriter<iroha::protocol::ToriiResponse> response_writer;
+
+  shared_model::crypto::Hash first_hash("1"), second_hash("2");
+  request.add_tx_hashes(first_hash.hex());
+  request.add_tx_hashes(second_hash.hex());
+  request.add_tx_hashes(first_hash.hex());
+
+  std::vector<std::shared_ptr<shared_model::interface::TransactionResponse>>
+      first_responses, second_responses;
+  first_responses.emplace_back(
+      status_factory->makeStatelessValid(first_hash, {}));
+  first_responses.emplace_back(status_factory->makeCommitted(first_hash, {}));
+  second_responses.emplace_back(
+      status_factory->makeNotReceived(second_hash, {}));
+  EXPECT_CALL(*command_service, getStatusStream(first_hash))
+      .WillOnce(Return(rxcpp::observable<>::iterate(first_responses)));
+  EXPECT_CALL(*command_service, getStatusStream(second_hash))
+      .WillOnce(Return(rxcpp::observable<>::iterate(second_responses)));
+  EXPECT_CALL(response_writer,
+              Write(Property(&iroha::protocol::ToriiResponse::tx_hash,
+                             StrEq(first_hash.hex())),
+                    _))
+      .Times(2)
+      .WillRepeatedly(Return(true));
+  EXPECT_CALL(response_writer,
+              Write(Property(&iroha::protocol::ToriiResponse::tx_hash,
+                             StrEq(second_hash.hex())),
+                    _))
+      .WillOnce(Return(true));
+
+  ASSERT_TRUE(transport_grpc
+                  ->StatusesStream(
+                      &context,
+                      &request,
+                      reinterpret_cast<
+                          grpc::ServerWriter<iroha::protocol::ToriiResponse> *>(
+                          &response_writer))
+                  .ok());
+}
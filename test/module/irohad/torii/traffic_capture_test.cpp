@@ -0,0 +1,83 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "torii/traffic_capture.hpp"
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+
+using iroha::torii::TrafficCapture;
+using namespace std::chrono_literals;
+
+class TrafficCaptureTest : public ::testing::Test {
+ public:
+  void TearDown() override {
+    boost::filesystem::remove(path);
+  }
+
+  /// Capture two calls and close the log
+  void capture() {
+    auto capture = TrafficCapture::create(path);
+    auto value = iroha::expected::resultToOptionalValue(capture);
+    ASSERT_TRUE(value);
+    auto received = TrafficCapture::Clock::now();
+    (*value)->record(
+        TrafficCapture::Call::kTransactions, received, received + 5ms, "txs");
+    (*value)->record(
+        TrafficCapture::Call::kQuery, received + 1ms, received + 3ms, "query");
+  }
+
+  std::vector<TrafficCapture::Record> read() {
+    auto records = iroha::expected::resultToOptionalValue(
+        TrafficCapture::read(path));
+    EXPECT_TRUE(records);
+    return records.value_or(std::vector<TrafficCapture::Record>{});
+  }
+
+  const std::string path = (boost::filesystem::temp_directory_path()
+                            / boost::filesystem::unique_path())
+                               .string();
+};
+
+/**
+ * @given a log with two captured calls
+ * @when it is read
+ * @then the calls are read back with their requests and times
+ */
+TEST_F(TrafficCaptureTest, RecordsAreReadBack) {
+  capture();
+  auto records = read();
+  ASSERT_EQ(records.size(), 2);
+  EXPECT_EQ(records[0].call, TrafficCapture::Call::kTransactions);
+  EXPECT_EQ(records[0].duration, 5000us);
+  EXPECT_EQ(records[0].request, "txs");
+  EXPECT_EQ(records[1].call, TrafficCapture::Call::kQuery);
+  EXPECT_EQ(records[1].duration, 2000us);
+  EXPECT_EQ(records[1].request, "query");
+  EXPECT_EQ(records[1].received - records[0].received, 1000us);
+}
+
+/**
+ * @given a log whose last record was interrupted
+ * @when it is read
+ * @then the complete records are read
+ */
+TEST_F(TrafficCaptureTest, IncompleteRecordIsSkipped) {
+  capture();
+  boost::filesystem::resize_file(path, boost::filesystem::file_size(path) - 2);
+  auto records = read();
+  ASSERT_EQ(records.size(), 1);
+  EXPECT_EQ(records[0].request, "txs");
+}
+
+/**
+ * @given a file which is not a log
+ * @when it is read
+ * @then an error is returned
+ */
+TEST_F(TrafficCaptureTest, OtherFileIsRefused) {
+  std::ofstream(path) << "not a capture";
+  EXPECT_TRUE(iroha::expected::hasError(TrafficCapture::read(path)));
+}
@@ -0,0 +1,105 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "tracing/transaction_tracer.hpp"
+
+#include <fstream>
+
+#include <gtest/gtest.h>
+#include <boost/filesystem.hpp>
+#include "framework/test_logger.hpp"
+
+using namespace iroha::tracing;
+namespace fs = boost::filesystem;
+
+class TransactionTracerTest : public ::testing::Test {
+ public:
+  void TearDown() override {
+    fs::remove(path_);
+  }
+
+  std::vector<std::string> readTraces() {
+    std::ifstream file(path_);
+    std::vector<std::string> lines;
+    for (std::string line; std::getline(file, line);) {
+      lines.push_back(line);
+    }
+    return lines;
+  }
+
+  const std::string path_ =
+      (fs::temp_directory_path() / fs::unique_path()).string();
+  const shared_model::crypto::Hash hash_{std::string(32, '\x01')};
+  TransactionTracer tracer_;
+};
+
+/**
+ * @given tracer sampling every transaction
+ * @when a transaction passes all the stages
+ * @then the trace with the span of the whole transaction and the spans of
+ * the stages is written
+ */
+TEST_F(TransactionTracerTest, CommittedTransactionIsWritten) {
+  tracer_.configure(1, path_, getTestLogger("TransactionTracer"));
+  for (auto stage : {TransactionStage::kReceived,
+                     TransactionStage::kProposed,
+                     TransactionStage::kValidated,
+                     TransactionStage::kBlockCreated,
+                     TransactionStage::kAgreed,
+                     TransactionStage::kCommitted}) {
+    tracer_.mark(hash_, stage);
+  }
+
+  auto traces = readTraces();
+  ASSERT_EQ(traces.size(), 1);
+  const auto &trace = traces.front();
+  EXPECT_NE(trace.find(R"("traceId":")" + hash_.hex().substr(0, 32)),
+            std::string::npos);
+  for (auto name : {"transaction",
+                    "ordering",
+                    "validation",
+                    "block_creation",
+                    "consensus",
+                    "commit"}) {
+    EXPECT_NE(trace.find(std::string(R"("name":")") + name + '"'),
+              std::string::npos)
+        << name;
+  }
+  EXPECT_EQ(trace.find(R"("code":2)"), std::string::npos);
+}
+
+/**
+ * @given tracer sampling every transaction
+ * @when a transaction is rejected
+ * @then the trace is written with error status
+ */
+TEST_F(TransactionTracerTest, RejectedTransactionIsWritten) {
+  tracer_.configure(1, path_, getTestLogger("TransactionTracer"));
+  tracer_.mark(hash_, TransactionStage::kProposed);
+  tracer_.mark(hash_, TransactionStage::kRejected);
+
+  auto traces = readTraces();
+  ASSERT_EQ(traces.size(), 1);
+  EXPECT_NE(traces.front().find(R"("code":2)"), std::string::npos);
+}
+
+/**
+ * @given tracer which is not configured and tracer with a sample interval
+ * not dividing the hash
+ * @when a transaction passes the stages
+ * @then nothing is written
+ */
+TEST_F(TransactionTracerTest, NotSampledTransactionIsNotWritten) {
+  tracer_.mark(hash_, TransactionStage::kProposed);
+  tracer_.mark(hash_, TransactionStage::kCommitted);
+  ASSERT_FALSE(tracer_.sampled(hash_));
+
+  // the first 8 bytes of the hash are 0x0101010101010101, which is odd
+  tracer_.configure(2, path_, getTestLogger("TransactionTracer"));
+  ASSERT_FALSE(tracer_.sampled(hash_));
+  tracer_.mark(hash_, TransactionStage::kProposed);
+  tracer_.mark(hash_, TransactionStage::kCommitted);
+  ASSERT_TRUE(readTraces().empty());
+}
@@ -10,12 +10,13 @@
 #include <boost/range/algorithm_ext/push_back.hpp>
 #include "backend/protobuf/proto_proposal_factory.hpp"
 #include "common/result.hpp"
+#include "common/thread_pool.hpp"
 #include "cryptography/crypto_provider/crypto_defaults.hpp"
 #include "framework/test_logger.hpp"
 #include "interfaces/iroha_internal/batch_meta.hpp"
-#include "interfaces/iroha_internal/transaction_batch_parser_impl.hpp"
 #include "interfaces/transaction.hpp"
 #include "module/irohad/ametsuchi/ametsuchi_mocks.hpp"
+#include "module/irohad/ametsuchi/mock_temporary_factory.hpp"
 #include "module/irohad/common/validators_config.hpp"
 #include "module/shared_model/builders/protobuf/test_proposal_builder.hpp"
 #include "module/shared_model/builders/protobuf/test_transaction_builder.hpp"
@@ -103,12 +104,8 @@ class Validator : public testing::Test {
     factory = std::make_unique<shared_model::proto::ProtoProposalFactory<
         shared_model::validation::DefaultProposalValidator>>(
         iroha::test::kTestsValidatorsConfig);
-    parser =
-        std::make_shared<shared_model::interface::TransactionBatchParserImpl>();
     sfv = std::make_shared<StatefulValidatorImpl>(
-        std::move(factory),
-        std::move(parser),
-        getTestLogger("StatefulValidator"));
+        std::move(factory), getTestLogger("StatefulValidator"));
     temp_wsv_mock = std::make_shared<iroha::ametsuchi::MockTemporaryWsv>();
   }
 
@@ -143,7 +140,6 @@ class Validator : public testing::Test {
   std::shared_ptr<StatefulValidator> sfv;
   std::unique_ptr<shared_model::interface::UnsafeProposalFactory> factory;
   std::shared_ptr<iroha::ametsuchi::MockTemporaryWsv> temp_wsv_mock;
-  std::shared_ptr<shared_model::interface::TransactionBatchParser> parser;
 
   const uint32_t sample_error_code = 2;
   const std::string sample_error_extra = "account_id: doge@account";
@@ -340,3 +336,117 @@ TEST_F(Validator, Batches) {
   EXPECT_EQ(verified_proposal_and_errors->rejected_transactions[1].tx_hash,
             txs[4].hash());
 }
+
+/**
+ * @given validator with a pool of one thread @and transactions of two
+ * creators which touch only their own accounts
+ * @when statefully validating these transactions
+ * @then transactions of every creator are applied to their own WSV @and
+ * results are merged in the order of the proposal @and the WSV of the
+ * proposal is reported to not contain all effects
+ */
+TEST_F(Validator, IndependentBatchesInParallel) {
+  auto temporary_factory =
+      std::make_shared<iroha::ametsuchi::MockTemporaryFactory>();
+  sfv = std::make_shared<StatefulValidatorImpl>(
+      std::make_unique<shared_model::proto::ProtoProposalFactory<
+          shared_model::validation::DefaultProposalValidator>>(
+          iroha::test::kTestsValidatorsConfig),
+      getTestLogger("StatefulValidator"),
+      temporary_factory,
+      std::make_shared<iroha::ThreadPool>(1));
+
+  std::vector<std::string> creators{
+      "doge@master", "cate@master", "doge@master"};
+  std::vector<shared_model::proto::Transaction> txs;
+  for (size_t i = 0; i < creators.size(); ++i) {
+    txs.push_back(TestTransactionBuilder()
+                      .creatorAccountId(creators[i])
+                      .createdTime(iroha::time::now() + i)
+                      .quorum(1)
+                      .setAccountDetail(creators[i], "key", "value")
+                      .build());
+  }
+  auto proposal = TestProposalBuilder()
+                      .createdTime(iroha::time::now())
+                      .height(3)
+                      .transactions(txs)
+                      .build();
+
+  auto additional_wsv = std::make_unique<iroha::ametsuchi::MockTemporaryWsv>();
+  EXPECT_CALL(*temp_wsv_mock, apply(Eq(ByRef(txs.at(0)))))
+      .WillOnce(Return(iroha::expected::Value<void>({})));
+  EXPECT_CALL(*additional_wsv, apply(Eq(ByRef(txs.at(1)))))
+      .WillOnce(Return(iroha::expected::makeError(
+          CommandError{"", sample_error_code, sample_error_extra, true})));
+  EXPECT_CALL(*temp_wsv_mock, apply(Eq(ByRef(txs.at(2)))))
+      .WillOnce(Return(iroha::expected::Value<void>({})));
+  EXPECT_CALL(*temporary_factory, createTemporaryWsv())
+      .WillOnce(Return(ByMove(
+          iroha::expected::makeValue<
+              std::unique_ptr<iroha::ametsuchi::TemporaryWsv>>(
+              std::move(additional_wsv)))));
+
+  auto verified_proposal_and_errors = sfv->validate(proposal, *temp_wsv_mock);
+  const auto &verified_txs =
+      verified_proposal_and_errors->verified_proposal->transactions();
+  ASSERT_EQ(verified_txs.size(), 2);
+  EXPECT_EQ(verified_txs[0].hash(), txs[0].hash());
+  EXPECT_EQ(verified_txs[1].hash(), txs[2].hash());
+  ASSERT_EQ(verified_proposal_and_errors->rejected_transactions.size(), 1);
+  EXPECT_EQ(verified_proposal_and_errors->rejected_transactions[0].tx_hash,
+            txs[1].hash());
+  EXPECT_FALSE(verified_proposal_and_errors->wsv_has_all_effects);
+}
+
+/**
+ * @given validator with a pool of one thread @and transactions of two
+ * creators, one of which transfers assets to the other
+ * @when statefully validating these transactions
+ * @then all transactions are applied to the WSV of the proposal
+ */
+TEST_F(Validator, ConflictingBatchesSequentially) {
+  auto temporary_factory =
+      std::make_shared<iroha::ametsuchi::MockTemporaryFactory>();
+  sfv = std::make_shared<StatefulValidatorImpl>(
+      std::make_unique<shared_model::proto::ProtoProposalFactory<
+          shared_model::validation::DefaultProposalValidator>>(
+          iroha::test::kTestsValidatorsConfig),
+      getTestLogger("StatefulValidator"),
+      temporary_factory,
+      std::make_shared<iroha::ThreadPool>(1));
+
+  std::vector<shared_model::proto::Transaction> txs;
+  txs.push_back(TestTransactionBuilder()
+                    .creatorAccountId("doge@master")
+                    .createdTime(iroha::time::now())
+                    .quorum(1)
+                    .transferAsset("doge@master",
+                                   "cate@master",
+                                   "coin#master",
+                                   "transfer",
+                                   "1.0")
+                    .build());
+  txs.push_back(TestTransactionBuilder()
+                    .creatorAccountId("cate@master")
+                    .createdTime(iroha::time::now() + 1)
+                    .quorum(1)
+                    .setAccountDetail("cate@master", "key", "value")
+                    .build());
+  auto proposal = TestProposalBuilder()
+                      .createdTime(iroha::time::now())
+                      .height(3)
+                      .transactions(txs)
+                      .build();
+
+  EXPECT_CALL(*temp_wsv_mock, apply(_))
+      .Times(2)
+      .WillRepeatedly(Return(iroha::expected::Value<void>({})));
+  EXPECT_CALL(*temporary_factory, createTemporaryWsv()).Times(0);
+
+  auto verified_proposal_and_errors = sfv->validate(proposal, *temp_wsv_mock);
+  ASSERT_EQ(
+      verified_proposal_and_errors->verified_proposal->transactions().size(),
+      2);
+  EXPECT_TRUE(verified_proposal_and_errors->wsv_has_all_effects);
+}
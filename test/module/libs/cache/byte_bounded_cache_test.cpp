@@ -0,0 +1,70 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "cache/byte_bounded_cache.hpp"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+using namespace iroha::cache;
+
+using StringCache = ByteBoundedCache<int, std::string>;
+
+/**
+ * @given cache with budget for three items
+ * @when four items are added @and the first remaining one is touched
+ * before a fifth one is added
+ * @then the oldest untouched items are evicted
+ */
+TEST(ByteBoundedCacheTest, EvictsOldestItems) {
+  StringCache cache(30);
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(cache.addItem(i, "value", 10), i < 3 ? 0 : 1);
+  }
+  cache.touch(1);
+  EXPECT_EQ(cache.addItem(4, "value", 10), 1);
+
+  EXPECT_FALSE(cache.findItem(0));
+  EXPECT_TRUE(cache.findItem(1));
+  EXPECT_FALSE(cache.findItem(2));
+  EXPECT_EQ(cache.getCacheItemCount(), 3);
+  EXPECT_EQ(cache.getCacheBytes(), 30);
+}
+
+/**
+ * @given cache with items
+ * @when an item larger than the whole budget is added with a cached key
+ * @then nothing is evicted @and the item and the previous value of its key
+ * are not cached
+ */
+TEST(ByteBoundedCacheTest, OversizedItemNotCached) {
+  StringCache cache(30);
+  cache.addItem(0, "small", 10);
+  cache.addItem(1, "small", 10);
+  EXPECT_EQ(cache.addItem(1, "huge", 31), 0);
+
+  EXPECT_TRUE(cache.findItem(0));
+  EXPECT_FALSE(cache.findItem(1));
+  EXPECT_EQ(cache.getCacheBytes(), 10);
+}
+
+/**
+ * @given cache with an item
+ * @when the item is replaced by a larger one @and then removed
+ * @then the size of the cache follows the size of the item
+ */
+TEST(ByteBoundedCacheTest, ReplacedAndRemovedItemsAccounted) {
+  StringCache cache(30);
+  cache.addItem(0, "small", 10);
+  cache.addItem(0, "large", 20);
+  EXPECT_EQ(*cache.findItem(0), "large");
+  EXPECT_EQ(cache.getCacheBytes(), 20);
+
+  EXPECT_TRUE(cache.removeItem(0));
+  EXPECT_FALSE(cache.removeItem(0));
+  EXPECT_EQ(cache.getCacheItemCount(), 0);
+  EXPECT_EQ(cache.getCacheBytes(), 0);
+}
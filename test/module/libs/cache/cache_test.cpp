@@ -4,8 +4,11 @@
  */
 
 #include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
 
 #include "cache/cache.hpp"
+#include "cache/sharded_cache.hpp"
 #include "endpoint.pb.h"
 
 using namespace iroha::cache;
@@ -179,3 +182,95 @@ TEST(CacheTest, InsertCustomSize) {
   ASSERT_TRUE(cache.findItem("key2"));
   ASSERT_EQ(cache.findItem("key2").value(), "value2");
 }
+
+/**
+ * @given full LRU cache
+ * @when the oldest item is accessed and new items are inserted
+ * @then the accessed item stays in cache while other old items are evicted
+ */
+TEST(CacheTest, LruKeepsAccessedItem) {
+  LruCache<std::string, std::string> cache(3, 2);
+  cache.addItem("0", "value0");
+  cache.addItem("1", "value1");
+  cache.addItem("2", "value2");
+  ASSERT_TRUE(cache.findItem("0"));
+
+  cache.addItem("3", "value3");
+
+  ASSERT_EQ(cache.getCacheItemCount(), cache.getIndexSizeLow());
+  ASSERT_TRUE(cache.findItem("0"));
+  ASSERT_FALSE(cache.findItem("1"));
+  ASSERT_FALSE(cache.findItem("2"));
+  ASSERT_TRUE(cache.findItem("3"));
+}
+
+/**
+ * @given full CLOCK cache
+ * @when the oldest item is accessed and new items are inserted
+ * @then the accessed item gets a second chance and other items are evicted
+ */
+TEST(CacheTest, ClockKeepsAccessedItem) {
+  ClockCache<std::string, std::string> cache(3, 2);
+  cache.addItem("0", "value0");
+  cache.addItem("1", "value1");
+  cache.addItem("2", "value2");
+  ASSERT_TRUE(cache.findItem("0"));
+
+  cache.addItem("3", "value3");
+
+  ASSERT_EQ(cache.getCacheItemCount(), cache.getIndexSizeLow());
+  ASSERT_TRUE(cache.findItem("0"));
+  ASSERT_FALSE(cache.findItem("1"));
+  ASSERT_FALSE(cache.findItem("2"));
+}
+
+/**
+ * @given LRU and CLOCK caches
+ * @when many more items than the cache limit are inserted
+ * @then item count never exceeds the limit and the last item is found
+ */
+TEST(CacheTest, PoliciesChurn) {
+  LruCache<std::string, int> lru(100, 50);
+  ClockCache<std::string, int> clock(100, 50);
+  for (int i = 0; i < 1000; ++i) {
+    lru.addItem(std::to_string(i), i);
+    clock.addItem(std::to_string(i), i);
+    if (i % 3 == 0) {
+      lru.findItem(std::to_string(i / 2));
+      clock.findItem(std::to_string(i / 2));
+    }
+    ASSERT_LE(lru.getCacheItemCount(), lru.getIndexSizeHigh());
+    ASSERT_LE(clock.getCacheItemCount(), clock.getIndexSizeHigh());
+  }
+  ASSERT_EQ(lru.findItem("999").value(), 999);
+  ASSERT_EQ(clock.findItem("999").value(), 999);
+}
+
+/**
+ * @given sharded cache
+ * @when items are added and looked up by several threads at once
+ * @then every thread finds the items it added, and the cache never holds
+ * more items than its limit
+ */
+TEST(CacheTest, ShardedCacheConcurrentAccess) {
+  ShardedCache<std::string, int> cache(1024, 512);
+  std::vector<std::thread> threads;
+  std::atomic<size_t> found{0};
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&cache, &found, t] {
+      for (int i = 0; i < 10000; ++i) {
+        auto key = std::to_string(t) + ":" + std::to_string(i);
+        cache.addItem(key, i);
+        if (cache.findItem(key)) {
+          ++found;
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_GT(found, 0u);
+  EXPECT_LE(cache.getCacheItemCount(), 1024u);
+}
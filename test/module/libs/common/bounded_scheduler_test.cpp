@@ -0,0 +1,75 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/bounded_scheduler.hpp"
+
+#include <atomic>
+#include <future>
+#include <numeric>
+
+#include <gtest/gtest.h>
+
+using namespace iroha::schedulers;
+using namespace std::chrono_literals;
+
+/**
+ * @given subject observed on a bounded stage
+ * @when values are published
+ * @then all of them are delivered in order on the thread of the stage
+ */
+TEST(BoundedSchedulerTest, DeliversInOrderOnOwnThread) {
+  rxcpp::subjects::subject<int> subject;
+  std::vector<int> received;
+  std::promise<std::thread::id> done;
+  subject.get_observable()
+      .observe_on(makeBoundedStage("test_order", 4))
+      .subscribe([&](int value) {
+        received.push_back(value);
+        if (value == 99) {
+          done.set_value(std::this_thread::get_id());
+        }
+      });
+  for (int i = 0; i < 100; ++i) {
+    subject.get_subscriber().on_next(i);
+  }
+
+  auto future = done.get_future();
+  ASSERT_EQ(future.wait_for(1s), std::future_status::ready);
+  ASSERT_NE(future.get(), std::this_thread::get_id());
+  std::vector<int> expected(100);
+  std::iota(expected.begin(), expected.end(), 0);
+  ASSERT_EQ(received, expected);
+}
+
+/**
+ * @given bounded stage of capacity 1 busy with an action
+ * @when two more actions are scheduled
+ * @then the producer is blocked until the busy action finishes
+ */
+TEST(BoundedSchedulerTest, FullQueueBlocksProducer) {
+  auto worker =
+      rxcpp::schedulers::make_scheduler<BoundedScheduler>("test_full", 1)
+          .create_worker();
+  std::promise<void> started, release;
+  auto released = release.get_future().share();
+  worker.schedule([&](const rxcpp::schedulers::schedulable &) {
+    started.set_value();
+    released.wait();
+  });
+  started.get_future().wait();
+
+  std::atomic<bool> scheduled{false};
+  std::thread producer([&] {
+    worker.schedule([](const rxcpp::schedulers::schedulable &) {});
+    worker.schedule([](const rxcpp::schedulers::schedulable &) {});
+    scheduled = true;
+  });
+  std::this_thread::sleep_for(50ms);
+  ASSERT_FALSE(scheduled);
+
+  release.set_value();
+  producer.join();
+  ASSERT_TRUE(scheduled);
+}
@@ -0,0 +1,88 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/broadcast_hub.hpp"
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+using Hub = iroha::BroadcastHub<std::string>;
+using Status = Hub::Subscriber::Status;
+
+/**
+ * @given hub with two subscribers
+ * @when a message is published
+ * @then both subscribers receive the same message, and the subscriber which
+ * waited for it is notified once
+ */
+TEST(BroadcastHubTest, MessageIsShared) {
+  Hub hub(2);
+  int notified = 0;
+  auto waiting = hub.subscribe([&] { ++notified; });
+  auto other = hub.subscribe([] {});
+
+  Hub::MessagePtr first, second;
+  ASSERT_EQ(waiting->pop(first), Status::kEmpty);
+  hub.publish(std::make_shared<const std::string>("block"));
+  hub.publish(std::make_shared<const std::string>("next"));
+  EXPECT_EQ(notified, 1);
+
+  ASSERT_EQ(waiting->pop(first), Status::kMessage);
+  ASSERT_EQ(other->pop(second), Status::kMessage);
+  EXPECT_EQ(first, second);
+  EXPECT_EQ(*first, "block");
+}
+
+/**
+ * @given hub with buffers of two messages and a subscriber which does not
+ * take them
+ * @when the third message is published
+ * @then the subscriber is evicted and notified, another one is not affected
+ */
+TEST(BroadcastHubTest, SlowSubscriberIsEvicted) {
+  Hub hub(2);
+  int notified = 0;
+  auto slow = hub.subscribe([&] { ++notified; });
+  auto fast = hub.subscribe([] {});
+  Hub::MessagePtr message;
+
+  ASSERT_EQ(slow->pop(message), Status::kEmpty);
+  for (auto i = 0; i < 3; ++i) {
+    EXPECT_EQ(hub.publish(std::make_shared<const std::string>("block")),
+              i == 2 ? 1u : 0u);
+    ASSERT_EQ(fast->pop(message), Status::kMessage);
+  }
+  // notified about the first message only, it is not taken
+  EXPECT_EQ(notified, 1);
+  EXPECT_EQ(slow->pop(message), Status::kEvicted);
+  EXPECT_FALSE(hub.empty());
+}
+
+/**
+ * @given subscribers waiting for messages
+ * @when one is cancelled and then the hub is closed
+ * @then only the other is notified, and the closed one receives messages
+ * left in its buffer
+ */
+TEST(BroadcastHubTest, CancelAndClose) {
+  Hub hub(2);
+  int cancelled_notified = 0, closed_notified = 0;
+  auto cancelled = hub.subscribe([&] { ++cancelled_notified; });
+  auto closed = hub.subscribe([&] { ++closed_notified; });
+  Hub::MessagePtr message;
+
+  ASSERT_EQ(cancelled->pop(message), Status::kEmpty);
+  EXPECT_TRUE(cancelled->cancel());
+  hub.publish(std::make_shared<const std::string>("block"));
+  hub.close();
+  EXPECT_EQ(cancelled_notified, 0);
+  EXPECT_EQ(closed_notified, 0);
+
+  ASSERT_EQ(closed->pop(message), Status::kMessage);
+  ASSERT_EQ(closed->pop(message), Status::kClosed);
+  EXPECT_TRUE(hub.empty());
+  EXPECT_EQ(hub.subscribe([] {})->pop(message), Status::kClosed);
+}
@@ -288,3 +288,20 @@ TEST(PolyMorphicResultTest, PolymorphicErrorConstruction) {
                  ASSERT_EQ(kErrorMessage, *e.error);
                });
 }
+
+/**
+ * @given LazyMessage with a renderer
+ * @when the message is read several times
+ * @then the renderer is called only on the first read
+ */
+TEST(LazyMessageTest, RenderedOnceWhenRead) {
+  size_t calls = 0;
+  LazyMessage message([&calls] {
+    ++calls;
+    return std::string{kErrorMessage};
+  });
+  ASSERT_EQ(0, calls);
+  ASSERT_EQ(kErrorMessage, message.str());
+  ASSERT_EQ(std::string{kErrorMessage}, message);
+  ASSERT_EQ(1, calls);
+}
@@ -0,0 +1,70 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/thread_affinity.hpp"
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+using iroha::CpuSet;
+using iroha::parseCpuSet;
+
+/**
+ * @given lists of single CPUs and ranges
+ * @when they are parsed
+ * @then all the listed CPUs are returned
+ */
+TEST(ThreadAffinityTest, CpuSetIsParsed) {
+  EXPECT_EQ(parseCpuSet("3").value_or(CpuSet{}), CpuSet{3});
+  EXPECT_EQ(parseCpuSet("0-3,8").value_or(CpuSet{}),
+            (CpuSet{0, 1, 2, 3, 8}));
+  EXPECT_EQ(parseCpuSet("4,1-2").value_or(CpuSet{}), (CpuSet{4, 1, 2}));
+}
+
+/**
+ * @given malformed lists of CPUs
+ * @when they are parsed
+ * @then none is returned
+ */
+TEST(ThreadAffinityTest, MalformedCpuSetIsRefused) {
+  EXPECT_FALSE(parseCpuSet(""));
+  EXPECT_FALSE(parseCpuSet("0,"));
+  EXPECT_FALSE(parseCpuSet("3-1"));
+  EXPECT_FALSE(parseCpuSet("a-b"));
+  EXPECT_FALSE(parseCpuSet("-1"));
+}
+
+/**
+ * @given no CPUs
+ * @when the thread is pinned to them
+ * @then the thread is left as is
+ */
+TEST(ThreadAffinityTest, EmptyCpuSetIsNoop) {
+  iroha::ScopedCpuAffinity affinity(CpuSet{});
+  EXPECT_TRUE(affinity.ok());
+}
+
+#ifdef __linux__
+/**
+ * @given the CPU the thread runs on
+ * @when the thread is pinned to it and starts another thread
+ * @then both threads run on the CPU
+ */
+TEST(ThreadAffinityTest, StartedThreadInheritsCpus) {
+  auto cpu = static_cast<unsigned>(sched_getcpu());
+  iroha::ScopedCpuAffinity affinity(CpuSet{cpu});
+  ASSERT_TRUE(affinity.ok());
+  EXPECT_EQ(static_cast<unsigned>(sched_getcpu()), cpu);
+
+  int started_cpu = -1;
+  std::thread([&started_cpu] { started_cpu = sched_getcpu(); }).join();
+  EXPECT_EQ(static_cast<unsigned>(started_cpu), cpu);
+}
+#endif
@@ -0,0 +1,61 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/thread_pool.hpp"
+
+#include <gtest/gtest.h>
+
+using iroha::ThreadPool;
+
+/**
+ * @given thread pool
+ * @when parallel loop is executed
+ * @then the task is called exactly once for every item
+ */
+TEST(ThreadPoolTest, EveryItemIsProcessedOnce) {
+  ThreadPool pool(4);
+  std::vector<std::atomic<int>> calls(1000);
+  for (auto &c : calls) {
+    c = 0;
+  }
+  pool.parallelFor(calls.size(), [&calls](size_t i) { ++calls[i]; });
+  for (const auto &c : calls) {
+    ASSERT_EQ(c, 1);
+  }
+}
+
+/**
+ * @given thread pool
+ * @when several parallel loops are executed from different threads at once
+ * @then every loop processes all of its items
+ */
+TEST(ThreadPoolTest, ConcurrentLoops) {
+  ThreadPool pool(2);
+  std::vector<std::thread> callers;
+  std::vector<size_t> sums(4, 0);
+  for (size_t caller = 0; caller < sums.size(); ++caller) {
+    callers.emplace_back([&pool, &sums, caller] {
+      std::atomic<size_t> sum{0};
+      pool.parallelFor(100, [&sum](size_t i) { sum += i; });
+      sums[caller] = sum;
+    });
+  }
+  for (auto &caller : callers) {
+    caller.join();
+  }
+  for (auto sum : sums) {
+    ASSERT_EQ(sum, 4950);
+  }
+}
+
+/**
+ * @given thread pool
+ * @when loop without items is executed
+ * @then the task is not called
+ */
+TEST(ThreadPoolTest, EmptyLoop) {
+  ThreadPool pool(1);
+  pool.parallelFor(0, [](size_t) { FAIL(); });
+}
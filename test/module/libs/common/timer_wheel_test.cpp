@@ -0,0 +1,96 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/timer_wheel.hpp"
+
+#include <atomic>
+#include <future>
+
+#include <gtest/gtest.h>
+
+using iroha::TimerWheel;
+using namespace std::chrono_literals;
+
+/**
+ * @given timer wheel with fewer slots than ticks of the delays
+ * @when tasks are scheduled with different delays
+ * @then every task runs once, not earlier than its delay
+ */
+TEST(TimerWheelTest, TasksRunAfterDelay) {
+  TimerWheel wheel(1ms, 8);
+  std::vector<std::promise<std::chrono::steady_clock::time_point>> ran(4);
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::chrono::milliseconds> delays{0ms, 3ms, 20ms, 50ms};
+  for (size_t i = 0; i < delays.size(); ++i) {
+    wheel.schedule(delays[i], [&ran, i] {
+      ran[i].set_value(std::chrono::steady_clock::now());
+    });
+  }
+  for (size_t i = 0; i < delays.size(); ++i) {
+    auto future = ran[i].get_future();
+    ASSERT_EQ(future.wait_for(1s), std::future_status::ready);
+    ASSERT_GE(future.get() - start, delays[i]);
+  }
+  ASSERT_EQ(wheel.size(), 0);
+}
+
+/**
+ * @given timer wheel with scheduled tasks
+ * @when one of them is cancelled
+ * @then it does not run and the rest do
+ */
+TEST(TimerWheelTest, CancelledTaskDoesNotRun) {
+  TimerWheel wheel(1ms);
+  std::atomic<int> cancelled{0};
+  std::promise<void> ran;
+  auto id = wheel.schedule(5ms, [&cancelled] { ++cancelled; });
+  wheel.schedule(10ms, [&ran] { ran.set_value(); });
+  ASSERT_TRUE(wheel.cancel(id));
+  ASSERT_FALSE(wheel.cancel(id));
+
+  ASSERT_EQ(ran.get_future().wait_for(1s), std::future_status::ready);
+  ASSERT_EQ(cancelled, 0);
+}
+
+/**
+ * @given timer wheel
+ * @when a task schedules itself again
+ * @then it runs periodically until it stops rescheduling
+ */
+TEST(TimerWheelTest, TaskReschedulesItself) {
+  TimerWheel wheel(1ms);
+  std::atomic<int> runs{0};
+  std::promise<void> done;
+  std::function<void()> task = [&] {
+    if (++runs < 10) {
+      wheel.schedule(2ms, task);
+    } else {
+      done.set_value();
+    }
+  };
+  wheel.schedule(0ms, task);
+  ASSERT_EQ(done.get_future().wait_for(1s), std::future_status::ready);
+  ASSERT_EQ(runs, 10);
+}
+
+/**
+ * @given timer wheel with a running task
+ * @when the task is waited for
+ * @then wait returns after the task has finished
+ */
+TEST(TimerWheelTest, WaitForRunningTask) {
+  TimerWheel wheel(1ms);
+  std::promise<void> started;
+  std::atomic<bool> finished{false};
+  auto id = wheel.schedule(0ms, [&] {
+    started.set_value();
+    std::this_thread::sleep_for(20ms);
+    finished = true;
+  });
+  started.get_future().wait();
+  ASSERT_FALSE(wheel.cancel(id));
+  wheel.wait(id);
+  ASSERT_TRUE(finished);
+}
@@ -0,0 +1,111 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "common/work_stealing_executor.hpp"
+
+#include <future>
+
+#include <gtest/gtest.h>
+
+using iroha::WorkStealingExecutor;
+
+/**
+ * @given executor
+ * @when tasks are posted from outside and from the tasks themselves
+ * @then every task runs exactly once
+ */
+TEST(WorkStealingExecutorTest, EveryTaskRunsOnce) {
+  WorkStealingExecutor executor(4);
+  std::vector<std::atomic<int>> calls(1000);
+  for (auto &c : calls) {
+    c = 0;
+  }
+  std::atomic<size_t> done{0};
+  std::promise<void> finished;
+  auto count = [&] {
+    if (++done == calls.size()) {
+      finished.set_value();
+    }
+  };
+  for (size_t i = 0; i < calls.size(); i += 2) {
+    executor.post([&, i] {
+      ++calls[i];
+      count();
+      executor.post([&, i] {
+        ++calls[i + 1];
+        count();
+      });
+    });
+  }
+  finished.get_future().wait();
+  for (const auto &c : calls) {
+    ASSERT_EQ(c, 1);
+  }
+}
+
+/**
+ * @given executor with several threads and a lane of concurrency 1
+ * @when tasks are posted to the lane
+ * @then they run one after another in the order of posting
+ */
+TEST(WorkStealingExecutorTest, SerialLaneKeepsOrder) {
+  WorkStealingExecutor executor(4);
+  auto lane = executor.makeLane(1);
+  std::vector<size_t> order;
+  std::atomic<int> running{0};
+  std::atomic<bool> overlapped{false};
+  std::promise<void> finished;
+  const size_t kTasks = 1000;
+  for (size_t i = 0; i < kTasks; ++i) {
+    lane->post([&, i] {
+      if (++running > 1) {
+        overlapped = true;
+      }
+      order.push_back(i);
+      --running;
+      if (i + 1 == kTasks) {
+        finished.set_value();
+      }
+    });
+  }
+  finished.get_future().wait();
+  ASSERT_FALSE(overlapped);
+  ASSERT_EQ(order.size(), kTasks);
+  for (size_t i = 0; i < kTasks; ++i) {
+    ASSERT_EQ(order[i], i);
+  }
+}
+
+/**
+ * @given executor with four threads and a lane of concurrency 2
+ * @when more blocking tasks than that are posted to the lane
+ * @then only two of them run at once, and the rest of the workers still run
+ * tasks posted directly
+ */
+TEST(WorkStealingExecutorTest, LaneLimitsConcurrency) {
+  WorkStealingExecutor executor(4);
+  auto lane = executor.makeLane(2);
+  std::promise<void> release;
+  auto released = release.get_future().share();
+  std::atomic<int> started{0};
+  for (int i = 0; i < 4; ++i) {
+    lane->post([&started, released] {
+      ++started;
+      released.wait();
+    });
+  }
+
+  std::promise<void> other;
+  executor.post([&other] { other.set_value(); });
+  ASSERT_EQ(other.get_future().wait_for(std::chrono::seconds(5)),
+            std::future_status::ready);
+  ASSERT_LE(started, 2);
+  ASSERT_EQ(lane->pending(), 2);
+
+  release.set_value();
+  while (started != 4) {
+    std::this_thread::yield();
+  }
+}
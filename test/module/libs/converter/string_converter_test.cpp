@@ -4,6 +4,7 @@
  */
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include "common/byteutils.hpp"
 
 using namespace iroha;
@@ -54,3 +55,30 @@ TEST(StringConverterTest, ConvertHexToBinaryAndBack) {
   ASSERT_EQ(ss.str(),
             bytestringToHexstring(hexstringToBytestring(ss.str()).value()));
 }
+
+/**
+ * @given hex strings longer than a vector block with digits of both cases
+ * and invalid characters at different positions
+ * @when they are converted to binary strings
+ * @then valid strings are converted and the invalid ones are rejected
+ */
+TEST(StringConverterTest, LongHexToBinary) {
+  std::string bin;
+  for (int i = 0; i < 37; ++i) {
+    bin.push_back(static_cast<char>(i * 7 + 3));
+  }
+  auto hex = bytestringToHexstring(bin);
+  ASSERT_EQ(hexstringToBytestring(hex).value(), bin);
+
+  auto upper = hex;
+  std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
+  ASSERT_EQ(hexstringToBytestring(upper).value(), bin);
+
+  for (auto position : {0u, 15u, 17u, 40u, 73u}) {
+    for (auto invalid : {'g', 'G', '/', ':', '@', '`', ' ', '\xff'}) {
+      auto corrupted = hex;
+      corrupted[position] = invalid;
+      ASSERT_FALSE(hexstringToBytestring(corrupted));
+    }
+  }
+}
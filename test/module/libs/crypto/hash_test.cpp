@@ -5,6 +5,7 @@
 
 #include <gtest/gtest.h>
 #include <cryptography/ed25519_sha3_impl/internal/sha3_hash.hpp>
+#include <cryptography/ed25519_sha3_impl/internal/sha3_multi_buffer.hpp>
 
 #define LOOP_N (100)
 
@@ -139,3 +140,36 @@ TEST(Hash, sha3_512_RU_text_LOOP) {
                  res.c_str());
   }
 }
+
+/**
+ * @given messages of sizes around SHA3-256 block boundaries, so that some of
+ * them are hashed in SIMD lanes together and some separately
+ * @when they are hashed at once
+ * @then every hash equals the hash of the message computed separately
+ */
+TEST(Hash, sha3_256_multi) {
+  std::vector<std::vector<uint8_t>> messages;
+  for (size_t size = 0; size < 600; size += 7) {
+    std::vector<uint8_t> message(size);
+    for (size_t i = 0; i < size; ++i) {
+      message[i] = static_cast<uint8_t>(i * 31 + size);
+    }
+    messages.push_back(std::move(message));
+  }
+
+  std::vector<const uint8_t *> inputs;
+  std::vector<size_t> sizes;
+  std::vector<iroha::hash256_t> hashes(messages.size());
+  std::vector<uint8_t *> outputs;
+  for (size_t i = 0; i < messages.size(); ++i) {
+    inputs.push_back(messages[i].data());
+    sizes.push_back(messages[i].size());
+    outputs.push_back(hashes[i].data());
+  }
+  iroha::sha3_256_multi(
+      inputs.data(), sizes.data(), outputs.data(), messages.size());
+
+  for (size_t i = 0; i < messages.size(); ++i) {
+    ASSERT_EQ(hashes[i], sha3_256(messages[i])) << "message size " << sizes[i];
+  }
+}
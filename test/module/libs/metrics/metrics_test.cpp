@@ -0,0 +1,198 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "metrics/metrics.hpp"
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <gtest/gtest.h>
+#include "framework/test_logger.hpp"
+#include "metrics/metrics_server.hpp"
+#include "metrics/startup_profiler.hpp"
+
+using namespace iroha::metrics;
+
+/**
+ * @given histogram buckets
+ * @when values are mapped to buckets
+ * @then every value falls into the bucket whose bounds contain it and the
+ * bucket width is within the relative error
+ */
+TEST(MetricsTest, HistogramBucketBounds) {
+  for (uint64_t value : {0ull,
+                         1ull,
+                         7ull,
+                         8ull,
+                         9ull,
+                         15ull,
+                         16ull,
+                         1000ull,
+                         123456789ull,
+                         ~0ull}) {
+    auto index = Histogram::bucketIndex(value);
+    ASSERT_LT(index, Histogram::kBuckets);
+    ASSERT_LE(value, Histogram::bucketUpperBound(index));
+    if (index > 0) {
+      ASSERT_GT(value, Histogram::bucketUpperBound(index - 1));
+    }
+    auto width = Histogram::bucketUpperBound(index)
+        - (index > 0 ? Histogram::bucketUpperBound(index - 1) : 0);
+    ASSERT_LE(width, std::max<uint64_t>(1, value / Histogram::kSubBuckets));
+  }
+  ASSERT_EQ(Histogram::bucketIndex(~0ull), Histogram::kBuckets - 1);
+}
+
+/**
+ * @given histogram
+ * @when values are recorded
+ * @then snapshot reports cumulative counts at power of two bounds up to the
+ * largest value, the total count and the sum
+ */
+TEST(MetricsTest, HistogramSnapshot) {
+  Histogram histogram;
+  for (uint64_t value : {0, 1, 2, 3, 100}) {
+    histogram.record(value);
+  }
+  auto snapshot = histogram.snapshot();
+  ASSERT_EQ(snapshot.count, 5);
+  ASSERT_EQ(snapshot.sum, 106);
+  std::vector<std::pair<uint64_t, uint64_t>> expected{
+      {0, 1}, {1, 2}, {3, 4}, {7, 4}, {15, 4}, {31, 4}, {63, 4}, {127, 5}};
+  ASSERT_EQ(snapshot.cumulative, expected);
+}
+
+/**
+ * @given histogram with values from 1 to 1000
+ * @when quantiles are requested
+ * @then the upper bounds of the buckets holding them are returned
+ */
+TEST(MetricsTest, HistogramQuantile) {
+  Histogram histogram;
+  ASSERT_EQ(histogram.quantile(0.5), 0);
+  for (uint64_t value = 1; value <= 1000; ++value) {
+    histogram.record(value);
+  }
+  auto median = histogram.quantile(0.5);
+  ASSERT_GE(median, 500);
+  ASSERT_LE(median, 500 + 500 / Histogram::kSubBuckets);
+  ASSERT_EQ(histogram.quantile(1), Histogram::bucketUpperBound(
+                                       Histogram::bucketIndex(1000)));
+
+  histogram.reset();
+  ASSERT_EQ(histogram.quantile(0.99), 0);
+  ASSERT_EQ(histogram.snapshot().count, 0);
+}
+
+/**
+ * @given registry with a counter, a gauge and a histogram
+ * @when it is serialized
+ * @then the metrics are reported in Prometheus text format and metrics
+ * looked up by the same name are shared
+ */
+TEST(MetricsTest, Serialize) {
+  Registry registry;
+  registry.counter("test_total", "Counted things").increment(3);
+  registry.counter("test_total", "Counted things").increment();
+  registry.gauge("test_size", "Current size").set(-2);
+  registry.histogram("test_time", "Measured time").record(5);
+
+  ASSERT_EQ(registry.serialize(),
+            "# HELP test_total Counted things\n"
+            "# TYPE test_total counter\n"
+            "test_total 4\n"
+            "# HELP test_size Current size\n"
+            "# TYPE test_size gauge\n"
+            "test_size -2\n"
+            "# HELP test_time Measured time\n"
+            "# TYPE test_time histogram\n"
+            "test_time_bucket{le=\"0\"} 0\n"
+            "test_time_bucket{le=\"1\"} 0\n"
+            "test_time_bucket{le=\"3\"} 0\n"
+            "test_time_bucket{le=\"7\"} 1\n"
+            "test_time_bucket{le=\"+Inf\"} 1\n"
+            "test_time_sum 5\n"
+            "test_time_count 1\n");
+}
+
+/**
+ * @given running metrics server
+ * @when metrics are requested over HTTP
+ * @then the serialized registry is returned
+ */
+TEST(MetricsTest, Server) {
+  Registry registry;
+  registry.counter("test_total", "Counted things").increment();
+  MetricsServer server(registry, getTestLogger("MetricsServer"));
+  auto port = server.run("127.0.0.1", 0);
+  ASSERT_TRUE(iroha::expected::hasValue(port));
+
+  auto client = ::socket(AF_INET, SOCK_STREAM, 0);
+  sockaddr_in address{};
+  address.sin_family = AF_INET;
+  address.sin_port = htons(
+      boost::get<iroha::expected::Value<uint16_t>>(port).value);
+  ::inet_pton(AF_INET, "127.0.0.1", &address.sin_addr);
+  ASSERT_EQ(
+      ::connect(
+          client, reinterpret_cast<sockaddr *>(&address), sizeof(address)),
+      0);
+  std::string request = "GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n";
+  ASSERT_EQ(::send(client, request.data(), request.size(), 0),
+            static_cast<ssize_t>(request.size()));
+
+  std::string reply;
+  char buffer[1024];
+  ssize_t received;
+  while ((received = ::recv(client, buffer, sizeof(buffer), 0)) > 0) {
+    reply.append(buffer, static_cast<size_t>(received));
+  }
+  ::close(client);
+
+  ASSERT_EQ(reply.compare(0, 15, "HTTP/1.1 200 OK"), 0);
+  ASSERT_NE(reply.find("\r\n\r\n" + registry.serialize()), std::string::npos);
+}
+
+/**
+ * @given startup profiler
+ * @when phases are profiled
+ * @then results of the phases are returned AND the phases are recorded in
+ * order AND their durations are exposed with gauges
+ */
+TEST(MetricsTest, StartupProfiler) {
+  Registry registry;
+  StartupProfiler profiler(registry);
+
+  ASSERT_EQ(profiler.profile("first", [] { return 1; }), 1);
+  profiler.record("second", std::chrono::milliseconds(5), 0);
+
+  ASSERT_EQ(profiler.phases().size(), 2);
+  ASSERT_EQ(profiler.phases()[0].name, "first");
+  ASSERT_EQ(profiler.phases()[1].name, "second");
+  ASSERT_EQ(registry.gauge("iroha_startup_second_milliseconds", "").value(),
+            5);
+  ASSERT_EQ(registry.gauge("iroha_startup_milliseconds", "").value(),
+            profiler.phases()[0].duration.count() + 5);
+  ASSERT_NE(profiler.summary().find("second 5 ms"), std::string::npos);
+}
+
+/**
+ * @given registry with a collector
+ * @when the registry is serialized
+ * @then the collector updates its metric before it is serialized
+ */
+TEST(MetricsTest, CollectorsAreCalledOnSerialization) {
+  Registry registry;
+  auto &gauge = registry.gauge("test_collected", "Collected value");
+  int calls = 0;
+  registry.addCollector([&] { gauge.set(++calls); });
+
+  ASSERT_NE(registry.serialize().find("test_collected 1\n"),
+            std::string::npos);
+  ASSERT_NE(registry.serialize().find("test_collected 2\n"),
+            std::string::npos);
+}
@@ -0,0 +1,47 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "metrics/profiled_mutex.hpp"
+
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+using namespace iroha::metrics;
+
+/**
+ * @given profiled shared mutex, built with lock profiling
+ * @when it is locked exclusively and shared
+ * @then waits for both modes and the exclusive ownership are recorded in
+ * the histograms named after the lock
+ */
+TEST(ProfiledMutexTest, LockTimesAreRecorded) {
+  ProfiledMutex<std::shared_timed_mutex> mutex("test_shared");
+  auto &wait_time =
+      registry().histogram("iroha_test_shared_lock_wait_microseconds", "");
+  auto &hold_time =
+      registry().histogram("iroha_test_shared_lock_hold_microseconds", "");
+
+  {
+    std::lock_guard<decltype(mutex)> lock(mutex);
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  }
+  ASSERT_EQ(wait_time.snapshot().count, 1);
+  ASSERT_EQ(hold_time.snapshot().count, 1);
+  ASSERT_GE(hold_time.snapshot().sum, 2000);
+
+  {
+    std::shared_lock<decltype(mutex)> lock(mutex);
+  }
+  ASSERT_EQ(wait_time.snapshot().count, 2);
+  ASSERT_EQ(hold_time.snapshot().count, 1);
+
+  ASSERT_TRUE(mutex.try_lock());
+  ASSERT_FALSE(mutex.try_lock_shared());
+  mutex.unlock();
+  ASSERT_EQ(hold_time.snapshot().count, 2);
+}
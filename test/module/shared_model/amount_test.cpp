@@ -0,0 +1,59 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "interfaces/common_objects/amount.hpp"
+
+#include <gtest/gtest.h>
+
+using shared_model::interface::Amount;
+
+/**
+ * @given well formed amounts
+ * @when they are parsed
+ * @then the integer value ignores the dot and the precision is the number of
+ * digits after it, also for values which do not fit into 64 bits
+ */
+TEST(AmountTest, Parse) {
+  Amount amount("123.456");
+  ASSERT_EQ(amount.intValue(), 123456);
+  ASSERT_EQ(amount.precision(), 3);
+
+  Amount integer("0042");
+  ASSERT_EQ(integer.intValue(), 42);
+  ASSERT_EQ(integer.precision(), 0);
+
+  Amount big("12345678901234567890123.000000000000001");
+  ASSERT_EQ(big.intValue(),
+            boost::multiprecision::uint256_t(
+                "12345678901234567890123000000000000001"));
+  ASSERT_EQ(big.precision(), 15);
+}
+
+/**
+ * @given malformed amounts
+ * @when they are parsed
+ * @then the integer value and the precision are zero
+ */
+TEST(AmountTest, Malformed) {
+  for (auto str : {"", "1.", ".5", "1a", "-1", "1.2.3"}) {
+    Amount amount(str);
+    ASSERT_EQ(amount.intValue(), 0) << str;
+    ASSERT_EQ(amount.precision(), 0) << str;
+  }
+}
+
+/**
+ * @given parsed amount
+ * @when it is copied and moved
+ * @then the copies keep the parsed value and precision
+ */
+TEST(AmountTest, Copy) {
+  Amount amount("10.50");
+  Amount copy(amount);
+  Amount moved(std::move(copy));
+  ASSERT_EQ(moved.intValue(), 1050);
+  ASSERT_EQ(moved.precision(), 2);
+  ASSERT_EQ(moved.toStringRepr(), "10.50");
+}
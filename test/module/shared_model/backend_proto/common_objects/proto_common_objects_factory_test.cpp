@@ -250,3 +250,24 @@ TEST_F(SignatureTest, InvalidSignatureInitialization) {
   signature.match([](const auto &v) { FAIL() << "Expected error case"; },
                   [](const auto &e) { SUCCEED(); });
 }
+
+/**
+ * @given signature protos with the same key and data written as bytes and as
+ * hex strings of older writers
+ * @when they are wrapped by proto::Signature
+ * @then both give the same key and data, and the bytes take less space
+ */
+TEST_F(SignatureTest, HexAndBytesEncodings) {
+  iroha::protocol::Signature bytes;
+  proto::setSignature(bytes, valid_data, valid_pubkey);
+  iroha::protocol::Signature hex;
+  hex.set_public_key(valid_pubkey.hex());
+  hex.set_signature(valid_data.hex());
+
+  for (const auto &signature :
+       {proto::Signature(bytes), proto::Signature(hex)}) {
+    ASSERT_EQ(signature.publicKey(), valid_pubkey);
+    ASSERT_EQ(signature.signedData(), valid_data);
+  }
+  ASSERT_LT(bytes.ByteSizeLong(), hex.ByteSizeLong());
+}
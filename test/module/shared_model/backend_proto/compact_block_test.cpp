@@ -0,0 +1,91 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "backend/protobuf/compact_block.hpp"
+
+#include <gtest/gtest.h>
+#include <google/protobuf/util/message_differencer.h>
+
+using namespace shared_model::proto;
+using google::protobuf::util::MessageDifferencer;
+
+class CompactBlockTest : public ::testing::Test {
+ public:
+  /// @return block of transactions of the same creator signed by one key
+  iroha::protocol::Block_v1 makeBlock(size_t transactions) {
+    iroha::protocol::Block_v1 block;
+    auto *payload = block.mutable_payload();
+    payload->set_height(3);
+    payload->set_prev_block_hash(std::string(32, '\x7f'));
+    for (size_t i = 0; i < transactions; ++i) {
+      auto *tx = payload->add_transactions();
+      auto *reduced = tx->mutable_payload()->mutable_reduced_payload();
+      reduced->set_creator_account_id("admin@test");
+      reduced->set_created_time(i);
+      auto *transfer = reduced->add_commands()->mutable_transfer_asset();
+      transfer->set_src_account_id("admin@test");
+      transfer->set_dest_account_id("user" + std::to_string(i) + "@test");
+      transfer->set_asset_id("coin#test");
+      transfer->set_amount("1.0");
+      auto *signature = tx->add_signatures();
+      signature->set_public_key(std::string(64, 'a'));
+      signature->set_signature(std::string(128, std::to_string(i).back()));
+    }
+    return block;
+  }
+};
+
+/**
+ * @given block with values repeated across its transactions
+ * @when it is encoded to the compact form and decoded
+ * @then the decoded block is the same, and the compact form is smaller than
+ * the binary serialization
+ */
+TEST_F(CompactBlockTest, RoundTrip) {
+  auto block = makeBlock(20);
+  auto compact = CompactBlock::encode(block);
+  ASSERT_TRUE(CompactBlock::isCompact(compact.data(), compact.size()));
+  EXPECT_LT(compact.size(), block.ByteSizeLong());
+
+  auto decoded = CompactBlock::decode(compact.data(), compact.size());
+  ASSERT_TRUE(decoded);
+  EXPECT_TRUE(MessageDifferencer::Equals(*decoded, block));
+}
+
+/**
+ * @given block with values which start with zero bytes, as references do
+ * @when it is encoded to the compact form and decoded
+ * @then the values are decoded as they are
+ */
+TEST_F(CompactBlockTest, EscapesValuesLikeReferences) {
+  auto block = makeBlock(2);
+  block.mutable_payload()->set_prev_block_hash(std::string("\0\x01", 2));
+  block.mutable_payload()->add_rejected_transactions_hashes(
+      std::string("\0\0\x01", 3));
+  block.mutable_payload()->add_rejected_transactions_hashes(
+      std::string(1, '\0'));
+
+  auto compact = CompactBlock::encode(block);
+  auto decoded = CompactBlock::decode(compact.data(), compact.size());
+  ASSERT_TRUE(decoded);
+  EXPECT_TRUE(MessageDifferencer::Equals(*decoded, block));
+}
+
+/**
+ * @given compact form of a block
+ * @when it is truncated, or a reference points past the dictionary
+ * @then it is not decoded
+ */
+TEST_F(CompactBlockTest, RejectsCorrupted) {
+  auto compact = CompactBlock::encode(makeBlock(2));
+  EXPECT_FALSE(CompactBlock::decode(compact.data(), 3));
+
+  iroha::protocol::Block_v1 block;
+  block.mutable_payload()->set_prev_block_hash(std::string("\0\x05", 2));
+  std::string dangling(1, CompactBlock::kVersion);
+  dangling.push_back(0);
+  block.AppendToString(&dangling);
+  EXPECT_FALSE(CompactBlock::decode(dangling.data(), dangling.size()));
+}
@@ -112,6 +112,45 @@ TEST_F(ProtoQueryResponseFactoryTest, CreateAccountAssetResponse) {
   }
 }
 
+/**
+ * Checks createAccountAssetResponse method of QueryResponseFactory with
+ * balances as they are stored
+ * @given collection of account assets with balances as strings
+ * @when creating account asset query response via factory
+ * @then that response is created @and holds the balances
+ */
+TEST_F(ProtoQueryResponseFactoryTest, CreateAccountAssetResponseFromRows) {
+  const HashType kQueryHash{"my_super_hash"};
+  const std::string kAccountId = "doge@meme";
+  const std::string kAssetId = "dogecoin#iroha";
+
+  std::vector<std::tuple<shared_model::interface::types::AccountIdType,
+                         shared_model::interface::types::AssetIdType,
+                         std::string>>
+      assets;
+  assets.push_back(std::make_tuple(kAccountId, kAssetId, "1.50"));
+  assets.push_back(std::make_tuple(kAccountId, kAssetId, "20"));
+
+  auto query_response = response_factory->createAccountAssetResponse(
+      assets, 3, kAssetId, kQueryHash);
+
+  ASSERT_TRUE(query_response);
+  ASSERT_EQ(query_response->queryHash(), kQueryHash);
+  ASSERT_NO_THROW({
+    const auto &response =
+        boost::get<const shared_model::interface::AccountAssetResponse &>(
+            query_response->get());
+    ASSERT_EQ(response.accountAssets().size(), 2);
+    ASSERT_EQ(response.accountAssets()[0].accountId(), kAccountId);
+    ASSERT_EQ(response.accountAssets()[0].balance(),
+              shared_model::interface::Amount("1.50"));
+    ASSERT_EQ(response.accountAssets()[1].balance(),
+              shared_model::interface::Amount("20"));
+    ASSERT_EQ(response.totalAccountAssetsNumber(), 3);
+    ASSERT_EQ(response.nextAssetId(), kAssetId);
+  });
+}
+
 /**
  * Checks createAccountDetailResponse method of QueryResponseFactory
  * @given account details
@@ -111,3 +111,57 @@ TEST(ProtoQueryBuilder, BlocksQueryBuilder) {
   auto proto = query.signAndAddSignature(keypair).finish().getTransport();
   ASSERT_EQ(proto_query.SerializeAsString(), proto.SerializeAsString());
 }
+
+/**
+ * @given blocks queries with the same meta
+ * @when start height is set in some of them
+ * @then the query without start height is signed by its meta
+ * AND queries with other start heights have other payloads and hashes
+ */
+TEST(ProtoQueryBuilder, BlocksQueryStartHeightIsSigned) {
+  iroha::protocol::BlocksQuery proto_query;
+  auto *meta = proto_query.mutable_meta();
+  meta->set_created_time(iroha::time::now());
+  meta->set_creator_account_id("admin@test");
+  meta->set_query_counter(1);
+
+  shared_model::proto::BlocksQuery query(proto_query);
+  ASSERT_EQ(query.payload(),
+            shared_model::crypto::Blob(proto_query.meta().SerializeAsString()));
+
+  proto_query.set_start_height(1);
+  shared_model::proto::BlocksQuery first_query(proto_query);
+  proto_query.set_start_height(2);
+  shared_model::proto::BlocksQuery second_query(proto_query);
+
+  ASSERT_NE(query.payload(), first_query.payload());
+  ASSERT_NE(first_query.payload(), second_query.payload());
+  ASSERT_NE(first_query.hash(), second_query.hash());
+}
+
+/**
+ * @given blocks queries with the same meta
+ * @when filter is set in one of them
+ * @then the query with the filter has another payload and hash
+ * AND it differs from the query without the filter
+ */
+TEST(ProtoQueryBuilder, BlocksQueryFilterIsSigned) {
+  iroha::protocol::BlocksQuery proto_query;
+  auto *meta = proto_query.mutable_meta();
+  meta->set_created_time(iroha::time::now());
+  meta->set_creator_account_id("admin@test");
+  meta->set_query_counter(1);
+
+  shared_model::proto::BlocksQuery query(proto_query);
+  ASSERT_FALSE(query.filter());
+
+  proto_query.mutable_filter()->add_account_ids("admin@test");
+  shared_model::proto::BlocksQuery filtered_query(proto_query);
+
+  ASSERT_TRUE(filtered_query.filter());
+  ASSERT_EQ(filtered_query.filter()->account_ids,
+            std::vector<std::string>{"admin@test"});
+  ASSERT_NE(query.payload(), filtered_query.payload());
+  ASSERT_NE(query.hash(), filtered_query.hash());
+  ASSERT_FALSE(query == filtered_query);
+}
@@ -25,3 +25,23 @@ TEST(UtilTest, StringFromMakeBlob) {
   ASSERT_TRUE(deserialized.ParseFromString(toBinaryString(blob)));
   ASSERT_EQ(deserialized.quorum(), base.quorum());
 }
+
+/**
+ * @given serialized protobuf object with an embedded message
+ * @when extracting bytes of the embedded message field
+ * @then the bytes are the same as the serialized embedded message
+ * @and absent field yields no bytes
+ */
+TEST(UtilTest, FieldBlobOfEmbeddedMessage) {
+  protocol::Command command;
+  command.mutable_set_account_quorum()->set_account_id("admin@test");
+  command.mutable_set_account_quorum()->set_quorum(2);
+  auto blob = makeBlob(command);
+
+  auto field = fieldBlob(blob.blob(),
+                         protocol::Command::kSetAccountQuorumFieldNumber);
+  ASSERT_TRUE(field);
+  ASSERT_EQ(*field, makeBlob(command.set_account_quorum()));
+  ASSERT_FALSE(
+      fieldBlob(blob.blob(), protocol::Command::kAddPeerFieldNumber));
+}
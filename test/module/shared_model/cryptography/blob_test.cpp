@@ -5,6 +5,7 @@
 
 #include "cryptography/blob.hpp"
 #include <gtest/gtest.h>
+#include "cryptography/hash.hpp"
 #include <memory>
 
 using namespace shared_model::crypto;
@@ -43,3 +44,17 @@ TEST_F(BlobMock, BlobIsString) {
     ASSERT_EQ(binary[i], bin_str[i]);
   }
 }
+
+/**
+ * @given hashes of different lengths
+ * @when they are hashed by Hash::Hasher
+ * @then equal hashes give equal values and the hex of the hash is not changed
+ */
+TEST_F(BlobMock, HashHasher) {
+  Hash::Hasher hasher;
+  Hash long_hash(std::string(32, 'a') + data);
+  ASSERT_EQ(hasher(long_hash), hasher(Hash(long_hash)));
+  ASSERT_NE(hasher(long_hash), hasher(Hash(std::string(32, 'b'))));
+  ASSERT_EQ(hasher(Hash(data.substr(0, 3))), hasher(Hash(data.substr(0, 3))));
+  ASSERT_EQ(Hash(data).hex(), blob->hex());
+}
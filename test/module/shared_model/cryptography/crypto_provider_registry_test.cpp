@@ -0,0 +1,110 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "cryptography/crypto_provider/crypto_provider_registry.hpp"
+
+#include <gtest/gtest.h>
+
+#include "cryptography/crypto_provider/crypto_signer.hpp"
+#include "cryptography/crypto_provider/crypto_verifier.hpp"
+#include "cryptography/ed25519_sha3_impl/keypair_signer.hpp"
+
+using namespace shared_model::crypto;
+
+class CryptoProviderRegistryTest : public ::testing::Test {
+ public:
+  void TearDown() override {
+    CryptoProviderRegistry::select(CryptoProviderRegistry::kDefaultProvider);
+  }
+
+  Blob data{"raw data for signing"};
+  Keypair keypair = DefaultCryptoAlgorithmType::generateKeypair();
+};
+
+/**
+ * @given registry without explicit selection
+ * @when data is signed and verified with default signer and verifier
+ * @then the built-in provider is used and the signature is valid
+ */
+TEST_F(CryptoProviderRegistryTest, DefaultProvider) {
+  ASSERT_EQ(CryptoProviderRegistry::selectedName(),
+            CryptoProviderRegistry::kDefaultProvider);
+  auto signature = CryptoSigner<>::sign(data, keypair);
+  ASSERT_TRUE(DefaultCryptoAlgorithmType::verify(
+      signature, data, keypair.publicKey()));
+  ASSERT_TRUE(CryptoVerifier<>::verify(signature, data, keypair.publicKey()));
+}
+
+/**
+ * @given a registered provider which counts its calls
+ * @when it is selected and used through default signer and verifier
+ * @then calls are forwarded to it, and an unknown name or a duplicate
+ * registration are rejected without changing the selection
+ */
+TEST_F(CryptoProviderRegistryTest, SelectRegisteredProvider) {
+  static size_t calls = 0;
+  auto provider = CryptoProvider::from<DefaultCryptoAlgorithmType>();
+  auto sign = provider.sign;
+  provider.sign = [sign](const Blob &blob, const Keypair &keypair) {
+    ++calls;
+    return sign(blob, keypair);
+  };
+  auto verify = provider.verify;
+  provider.verify = [verify](const Signed &signed_data,
+                             const Blob &source,
+                             const PublicKey &public_key) {
+    ++calls;
+    return verify(signed_data, source, public_key);
+  };
+
+  ASSERT_TRUE(CryptoProviderRegistry::registerProvider("counting", provider));
+  ASSERT_FALSE(CryptoProviderRegistry::registerProvider("counting", provider));
+  ASSERT_TRUE(CryptoProviderRegistry::select("counting"));
+  ASSERT_FALSE(CryptoProviderRegistry::select("unknown"));
+  ASSERT_EQ(CryptoProviderRegistry::selectedName(), "counting");
+
+  auto signature = CryptoSigner<>::sign(data, keypair);
+  ASSERT_TRUE(CryptoVerifier<>::verify(signature, data, keypair.publicKey()));
+  ASSERT_EQ(calls, 2);
+
+  auto names = CryptoProviderRegistry::names();
+  ASSERT_EQ(names,
+            (std::vector<std::string>{"counting",
+                                      CryptoProviderRegistry::kDefaultProvider}));
+}
+
+/**
+ * @given registry without explicit selection
+ * @when data is signed by a keypair signer
+ * @then the signature equals the one of the default signer
+ */
+TEST_F(CryptoProviderRegistryTest, KeypairSignerMatchesDefaultProvider) {
+  KeypairSigner signer(keypair);
+  ASSERT_EQ(signer.publicKey(), keypair.publicKey());
+  ASSERT_EQ(signer.sign(data), CryptoSigner<>::sign(data, keypair));
+}
+
+/**
+ * @given another provider selected
+ * @when data is signed by a keypair signer created after the selection
+ * @then the selected provider signs it
+ */
+TEST_F(CryptoProviderRegistryTest, KeypairSignerUsesSelectedProvider) {
+  static size_t calls = 0;
+  auto provider = CryptoProvider::from<DefaultCryptoAlgorithmType>();
+  auto sign = provider.sign;
+  provider.sign = [sign](const Blob &blob, const Keypair &keypair) {
+    ++calls;
+    return sign(blob, keypair);
+  };
+  ASSERT_TRUE(
+      CryptoProviderRegistry::registerProvider("counting_signer", provider));
+  ASSERT_TRUE(CryptoProviderRegistry::select("counting_signer"));
+
+  KeypairSigner signer(keypair);
+  auto signature = signer.sign(data);
+  ASSERT_EQ(calls, 1);
+  ASSERT_TRUE(CryptoVerifier<>::verify(signature, data, keypair.publicKey()));
+}
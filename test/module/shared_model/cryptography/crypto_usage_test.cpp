@@ -68,8 +68,8 @@ class CryptoUsageTest : public ::testing::Test {
   shared_model::crypto::Keypair keypair =
       shared_model::crypto::DefaultCryptoAlgorithmType::generateKeypair();
 
-  shared_model::crypto::CryptoModelSigner<> signer =
-      shared_model::crypto::CryptoModelSigner<>(keypair);
+  shared_model::crypto::CryptoModelSigner signer =
+      shared_model::crypto::CryptoModelSigner(keypair);
 
   std::unique_ptr<shared_model::proto::Block> block;
   std::unique_ptr<shared_model::proto::Query> query;
@@ -89,6 +89,47 @@ TEST_F(CryptoUsageTest, RawSignAndVerifyTest) {
   ASSERT_TRUE(verified);
 }
 
+/**
+ * @given signature which was successfully verified
+ * @when it is verified again against the same and against other data
+ * @then only verification against the signed data succeeds
+ */
+TEST_F(CryptoUsageTest, RepeatedVerify) {
+  auto signed_blob = DefaultCryptoAlgorithmType::sign(data, keypair);
+  ASSERT_TRUE(CryptoVerifier<>::verify(signed_blob, data, keypair.publicKey()));
+  ASSERT_TRUE(CryptoVerifier<>::verify(signed_blob, data, keypair.publicKey()));
+  ASSERT_FALSE(CryptoVerifier<>::verify(
+      signed_blob, Blob("other raw data"), keypair.publicKey()));
+  ASSERT_FALSE(CryptoVerifier<>::verify(
+      signed_blob,
+      data,
+      DefaultCryptoAlgorithmType::generateKeypair().publicKey()));
+}
+
+/**
+ * @given several signatures made by different keys over two messages, one of
+ * which is present as two distinct blobs with equal contents
+ * @when signatures are verified as a batch
+ * @then the batch is valid, and becomes invalid if any signature is replaced
+ * with a signature of other data
+ */
+TEST_F(CryptoUsageTest, BatchVerify) {
+  Blob other_data("other raw data"), data_copy(data.blob());
+  auto other_keypair = DefaultCryptoAlgorithmType::generateKeypair();
+  auto first = DefaultCryptoAlgorithmType::sign(data, keypair);
+  auto second = DefaultCryptoAlgorithmType::sign(data_copy, other_keypair);
+  auto third = DefaultCryptoAlgorithmType::sign(other_data, keypair);
+
+  ASSERT_TRUE(CryptoVerifier<>::verifyBatch(
+      {{first, data, keypair.publicKey()},
+       {second, data_copy, other_keypair.publicKey()},
+       {third, other_data, keypair.publicKey()}}));
+  ASSERT_FALSE(CryptoVerifier<>::verifyBatch(
+      {{first, data, keypair.publicKey()},
+       {third, data_copy, keypair.publicKey()}}));
+  ASSERT_TRUE(CryptoVerifier<>::verifyBatch({}));
+}
+
 /**
  * @given unsigned block
  * @when verify block
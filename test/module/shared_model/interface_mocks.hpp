@@ -264,6 +264,8 @@ struct MockAccount : public shared_model::interface::Account {
 
 struct MockBlockJsonConverter
     : public shared_model::interface::BlockJsonConverter {
+  using shared_model::interface::BlockJsonDeserializer::deserialize;
+
   MOCK_CONST_METHOD1(
       serialize,
       iroha::expected::Result<shared_model::interface::types::JsonType,
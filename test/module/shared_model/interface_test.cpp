@@ -88,3 +88,26 @@ TEST_F(TransactionFixture, checkEqualsOperatorDifferentOrder) {
 
   ASSERT_EQ(*tx1, *tx2);
 }
+
+/**
+ * @given a transaction with a signature
+ * @when  new signatures and a signature of the same key are added
+ * @then  only the new signatures are added and counted
+ */
+TEST_F(TransactionFixture, SignaturesAreCounted) {
+  auto tx = makeTx();
+  ASSERT_EQ(tx->signaturesCount(), 1);
+
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_TRUE(tx->addSignature(
+        shared_model::crypto::Signed("signed_blob_" + std::to_string(i)),
+        shared_model::crypto::PublicKey("pub_key_" + std::to_string(i))));
+  }
+  EXPECT_FALSE(
+      tx->addSignature(shared_model::crypto::Signed("other_signed_blob"),
+                       shared_model::crypto::PublicKey("pub_key_1")));
+
+  EXPECT_EQ(tx->signaturesCount(), 4);
+  EXPECT_EQ(boost::size(tx->signatures()), 4);
+  EXPECT_EQ(tx->getTransport().signatures_size(), 4);
+}
@@ -0,0 +1,43 @@
+/**
+ * Copyright Soramitsu Co., Ltd. All Rights Reserved.
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "utils/memoized.hpp"
+
+#include <gtest/gtest.h>
+
+/**
+ * @given empty memoized value
+ * @when value is accessed several times
+ * @then the value is computed only once
+ */
+TEST(Memoized, ComputedOnce) {
+  shared_model::detail::Memoized<int> m;
+  int calls = 0;
+  auto compute = [&calls] { return ++calls; };
+  ASSERT_EQ(m.get(compute), 1);
+  ASSERT_EQ(m.get(compute), 1);
+  ASSERT_EQ(calls, 1);
+}
+
+/**
+ * @given memoized value created with a precomputed value
+ * @when value is accessed
+ * @then the precomputed value is returned without computation
+ */
+TEST(Memoized, Precomputed) {
+  shared_model::detail::Memoized<int> m(2);
+  ASSERT_EQ(m.get([] { return 3; }), 2);
+}
+
+/**
+ * @given computed memoized value
+ * @when it is reset and accessed again
+ * @then the value is computed anew
+ */
+TEST(Memoized, Reset) {
+  shared_model::detail::Memoized<int> m(2);
+  m.reset();
+  ASSERT_EQ(m.get([] { return 3; }), 3);
+}
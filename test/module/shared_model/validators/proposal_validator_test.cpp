@@ -7,6 +7,7 @@
 
 #include <gtest/gtest.h>
 
+#include "common/thread_pool.hpp"
 #include "framework/batch_helper.hpp"
 #include "module/irohad/common/validators_config.hpp"
 #include "module/shared_model/builders/protobuf/test_proposal_builder.hpp"
@@ -50,3 +51,37 @@ TEST_F(ProposalValidatorTest, IncompleteBatch) {
   auto answer = validator_.validate(*proposal);
   ASSERT_TRUE(answer);
 }
+
+/**
+ * @given a proposal large enough to be validated in parallel, with some
+ * invalid transactions
+ * @when it is validated with and without the validation pool
+ * @then both answers have the same reasons in the same order
+ */
+TEST_F(ProposalValidatorTest, ParallelValidationIsDeterministic) {
+  std::vector<shared_model::proto::Transaction> txs;
+  for (size_t i = 0; i < 2 * kParallelValidationSize; ++i) {
+    txs.push_back(TestTransactionBuilder()
+                      .creatorAccountId(i % 100 == 0 ? "invalid" : "a@domain")
+                      .createdTime(created_time + i)
+                      .quorum(1)
+                      .createDomain("domain" + std::to_string(i), "user")
+                      .build());
+  }
+  auto proposal = TestProposalBuilder()
+                      .height(1)
+                      .createdTime(created_time)
+                      .transactions(txs)
+                      .build();
+
+  DefaultProposalValidator parallel_validator(
+      std::make_shared<ValidatorsConfig>(
+          iroha::test::getTestsMaxBatchSize(),
+          false,
+          std::make_shared<iroha::ThreadPool>(4)));
+
+  auto answer = validator_.validate(proposal);
+  auto parallel_answer = parallel_validator.validate(proposal);
+  ASSERT_TRUE(answer);
+  ASSERT_EQ(answer.reason(), parallel_answer.reason());
+}
@@ -105,6 +105,48 @@ TEST_F(TransactionValidatorTest, UnsetCommand) {
   ASSERT_TRUE(answer.hasErrors());
 }
 
+/**
+ * @given transaction which has already passed validation
+ * @when it is validated again against a time too far from its created time
+ * @then answer has an error about the created time
+ */
+TEST_F(TransactionValidatorTest, ValidatedTransactionTimeChecked) {
+  auto tx = TestTransactionBuilder()
+                .creatorAccountId(account_id)
+                .createdTime(created_time)
+                .quorum(1)
+                .createDomain("validated", "user")
+                .build();
+
+  auto answer = transaction_validator.validate(tx, created_time);
+  ASSERT_FALSE(answer.hasErrors()) << answer.reason();
+
+  answer = transaction_validator.validate(
+      tx, created_time + validation::FieldValidator::kMaxDelay + 1);
+  ASSERT_TRUE(answer.hasErrors());
+}
+
+/**
+ * @given transaction with two invalid commands of the same type
+ * @when it is validated
+ * @then answer has a reason for each of the commands, named by their positions
+ */
+TEST_F(TransactionValidatorTest, InvalidCommandsOfSameType) {
+  auto tx = TestTransactionBuilder()
+                .creatorAccountId(account_id)
+                .createdTime(created_time)
+                .quorum(1)
+                .createDomain("@invalid", "user")
+                .createDomain("#invalid", "user")
+                .build();
+
+  auto answer = transaction_validator.validate(tx, created_time);
+  auto reasons = answer.getReasonsMap();
+  ASSERT_EQ(reasons.size(), 2) << answer.reason();
+  ASSERT_EQ(reasons.count("0 CreateDomain"), 1);
+  ASSERT_EQ(reasons.count("1 CreateDomain"), 1);
+}
+
 /**
  * @given transaction made of commands with invalid fields
  * @when commands validation is invoked
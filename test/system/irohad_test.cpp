@@ -229,6 +229,7 @@ DROP TABLE IF EXISTS role;
 DROP TABLE IF EXISTS position_by_hash;
 DROP TABLE IF EXISTS tx_position_by_creator;
 DROP TABLE IF EXISTS position_by_account_asset;
+DROP TABLE IF EXISTS top_block_info;
 )";
 
     soci::session sql(*soci::factory_postgresql(), pgopts_);